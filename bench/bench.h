@@ -0,0 +1,58 @@
+#pragma once
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+//-----------------------------------------------------------------------------
+
+#include "shared/silkroad_security.h"
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <iostream>
+#include <string>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+
+// Measures wall clock time from when it was created or last restarted
+class BenchTimer
+{
+private:
+	boost::posix_time::ptime m_start;
+
+public:
+	BenchTimer();
+
+	void Restart();
+
+	// Seconds since the timer started
+	double Elapsed() const;
+};
+
+//-----------------------------------------------------------------------------
+
+// Fills data with bytes that depend on their position and the seed, so
+// corrupted or misplaced data shows up
+void FillPattern( std::vector< uint8_t > & data, int32_t seed );
+
+// Runs the handshake between a server and a client security object and
+// discards the identity packets. Throws if it does not complete.
+void CompleteHandshake( SilkroadSecurity & server, SilkroadSecurity & client );
+
+// Returns args[ index ] as a number, or default_value if it was not given
+int32_t GetArgument( const std::vector< std::string > & args, size_t index, int32_t default_value );
+
+//-----------------------------------------------------------------------------
+
+// Every benchmark takes the arguments after its name and returns the exit code
+int BenchLatency( const std::vector< std::string > & args );
+int BenchThroughput( const std::vector< std::string > & args );
+int BenchConnections( const std::vector< std::string > & args );
+int BenchIdle( const std::vector< std::string > & args );
+int BenchRecv( const std::vector< std::string > & args );
+int BenchMassive( const std::vector< std::string > & args );
+int BenchCrc( const std::vector< std::string > & args );
+int BenchBlowfish( const std::vector< std::string > & args );
+
+//-----------------------------------------------------------------------------
+
+#endif
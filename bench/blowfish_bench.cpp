@@ -0,0 +1,101 @@
+#include "bench.h"
+#include "shared/blowfish.h"
+#include <cstring>
+#include <stdexcept>
+
+//-----------------------------------------------------------------------------
+
+// Bytes encoded and decoded by every method
+#define BLOWFISH_TOTAL ( 64 * 1024 * 1024 )
+
+// Size of the span handed over at once, about the size of a large packet
+#define BLOWFISH_SPAN 4096
+
+//-----------------------------------------------------------------------------
+
+namespace
+{
+	// One 8 byte block at a time through a work buffer, the way packets used
+	// to be encoded and decoded
+	void PerBlock( Blowfish & blowfish, uint8_t * data, int32_t size, bool encode )
+	{
+		uint8_t work_buffer[ 8 ];
+		for( int32_t x = 0; x < size; x += 8 )
+		{
+			memcpy( work_buffer, data + x, 8 );
+			if( encode )
+			{
+				blowfish.Encode( work_buffer, 8, work_buffer, 8 );
+			}
+			else
+			{
+				blowfish.Decode( work_buffer, 8, work_buffer, 8 );
+			}
+			memcpy( data + x, work_buffer, 8 );
+		}
+	}
+
+	// The whole span in place with one call
+	void WholeSpan( Blowfish & blowfish, uint8_t * data, int32_t size, bool encode )
+	{
+		if( encode )
+		{
+			blowfish.EncodeBlocks( data, size );
+		}
+		else
+		{
+			blowfish.DecodeBlocks( data, size );
+		}
+	}
+
+	// Encodes and then decodes BLOWFISH_TOTAL bytes, prints MB/s for each and
+	// checks the data came back unchanged
+	void MeasureBlowfish( const char * name, void ( * code )( Blowfish &, uint8_t *, int32_t, bool ) )
+	{
+		Blowfish blowfish;
+		uint64_t key = 0x0123456789ABCDEFULL;
+		blowfish.Initialize( &key, sizeof( key ) );
+
+		std::vector< uint8_t > data( BLOWFISH_SPAN );
+		FillPattern( data, 0 );
+		std::vector< uint8_t > original( data );
+
+		int32_t count = BLOWFISH_TOTAL / BLOWFISH_SPAN;
+		double megabytes = static_cast< double >( BLOWFISH_SPAN ) * count / ( 1024 * 1024 );
+
+		// Decoding as many times as it was encoded restores the data
+		BenchTimer timer;
+		for( int32_t x = 0; x < count; ++x )
+		{
+			code( blowfish, &data[ 0 ], BLOWFISH_SPAN, true );
+		}
+		double encode = timer.Elapsed();
+
+		timer.Restart();
+		for( int32_t x = 0; x < count; ++x )
+		{
+			code( blowfish, &data[ 0 ], BLOWFISH_SPAN, false );
+		}
+		double decode = timer.Elapsed();
+
+		if( data != original )
+		{
+			throw( std::runtime_error( "[MeasureBlowfish] Decoding did not restore the data" ) );
+		}
+
+		std::cout << name << ": encode " << megabytes / encode << " MB/s, decode " << megabytes / decode << " MB/s" << std::endl;
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+// Blowfish over 4 KB spans, block by block through Encode/Decode against the
+// in place EncodeBlocks/DecodeBlocks
+int BenchBlowfish( const std::vector< std::string > & /*args*/ )
+{
+	MeasureBlowfish( "Encode/Decode per block", &PerBlock );
+	MeasureBlowfish( "EncodeBlocks/DecodeBlocks", &WholeSpan );
+	return 0;
+}
+
+//-----------------------------------------------------------------------------
@@ -0,0 +1,86 @@
+#include "bench.h"
+#include "shared/security_table.h"
+#include <stdexcept>
+
+//-----------------------------------------------------------------------------
+
+// Defined in shared/silkroad_security.cpp
+const uint32_t * GetCrcTables( uint32_t seed );
+uint32_t UpdateChecksum( const uint32_t * tables, uint32_t checksum, const uint8_t * data, int32_t length );
+
+//-----------------------------------------------------------------------------
+
+// Bytes checksummed for every packet size
+#define CRC_TOTAL ( 256 * 1024 * 1024 )
+
+// Seed used for every run, any value from the handshake will do
+#define CRC_SEED 0x5A
+
+//-----------------------------------------------------------------------------
+
+namespace
+{
+	// The original loop, one table lookup per byte
+	uint32_t ReferenceChecksum( uint32_t seed, const uint8_t * data, int32_t length )
+	{
+		uint32_t checksum = 0xFFFFFFFF;
+		uint32_t moddedseed = seed << 8;
+		for( int32_t x = 0; x < length; ++x )
+		{
+			checksum = ( checksum >> 8 ) ^ SecurityTable[ moddedseed + ( ( data[ x ] ^ checksum ) & 0xFF ) ];
+		}
+		return checksum;
+	}
+
+	void MeasureCrc( int32_t size )
+	{
+		std::vector< uint8_t > data( size );
+		FillPattern( data, size );
+		int32_t count = CRC_TOTAL / size;
+		double gigabytes = static_cast< double >( size ) * count / ( 1024 * 1024 * 1024 );
+		const uint32_t * tables = GetCrcTables( CRC_SEED );
+
+		// The results are combined so the loops cannot be optimized away
+		uint32_t reference_result = 0;
+		BenchTimer timer;
+		for( int32_t x = 0; x < count; ++x )
+		{
+			data[ 0 ] = static_cast< uint8_t >( x );
+			reference_result += ReferenceChecksum( CRC_SEED, &data[ 0 ], size );
+		}
+		double reference = timer.Elapsed();
+
+		uint32_t sliced_result = 0;
+		timer.Restart();
+		for( int32_t x = 0; x < count; ++x )
+		{
+			data[ 0 ] = static_cast< uint8_t >( x );
+			sliced_result += UpdateChecksum( tables, 0xFFFFFFFF, &data[ 0 ], size );
+		}
+		double sliced = timer.Elapsed();
+
+		if( reference_result != sliced_result )
+		{
+			throw( std::runtime_error( "[MeasureCrc] The checksums do not match" ) );
+		}
+
+		std::cout << size << " bytes: byte at a time " << gigabytes / reference << " GB/s, slicing-by-8 "
+			<< gigabytes / sliced << " GB/s" << std::endl;
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+// The seeded crc behind the security byte, the original byte at a time loop
+// against the slicing-by-8 tables, for packet sizes from 6 bytes to 32 KB
+int BenchCrc( const std::vector< std::string > & /*args*/ )
+{
+	const int32_t sizes[] = { 6, 16, 64, 256, 1024, 4096, 32768 };
+	for( size_t x = 0; x < sizeof( sizes ) / sizeof( sizes[ 0 ] ); ++x )
+	{
+		MeasureCrc( sizes[ x ] );
+	}
+	return 0;
+}
+
+//-----------------------------------------------------------------------------
@@ -0,0 +1,142 @@
+#include "bench.h"
+#include <boost/lexical_cast.hpp>
+#include <cstring>
+#include <stdexcept>
+
+//-----------------------------------------------------------------------------
+
+namespace
+{
+	struct Benchmark
+	{
+		const char * name;
+		const char * usage;
+		int ( * run )( const std::vector< std::string > & args );
+	};
+
+	const Benchmark Benchmarks[] =
+	{
+		{ "latency", "latency [server port] [proxy port] [round trips]", &BenchLatency },
+		{ "throughput", "throughput [server port] [proxy port] [clients] [seconds]", &BenchThroughput },
+		{ "connections", "connections [server port] [proxy port] [clients] [seconds]", &BenchConnections },
+		{ "idle", "idle [server port] [proxy port] [sessions] [proxy pid]", &BenchIdle },
+		{ "recv", "recv [packets]", &BenchRecv },
+		{ "massive", "massive [message KB]", &BenchMassive },
+		{ "crc", "crc", &BenchCrc },
+		{ "blowfish", "blowfish", &BenchBlowfish },
+	};
+
+	void PrintUsage()
+	{
+		std::cout << "Usage: phConnectorBench <benchmark> [arguments]" << std::endl;
+		for( size_t x = 0; x < sizeof( Benchmarks ) / sizeof( Benchmarks[ 0 ] ); ++x )
+		{
+			std::cout << "  " << Benchmarks[ x ].usage << std::endl;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+BenchTimer::BenchTimer()
+{
+	Restart();
+}
+
+void BenchTimer::Restart()
+{
+	m_start = boost::posix_time::microsec_clock::universal_time();
+}
+
+double BenchTimer::Elapsed() const
+{
+	return ( boost::posix_time::microsec_clock::universal_time() - m_start ).total_microseconds() / 1000000.0;
+}
+
+//-----------------------------------------------------------------------------
+
+void FillPattern( std::vector< uint8_t > & data, int32_t seed )
+{
+	for( size_t x = 0; x < data.size(); ++x )
+	{
+		data[ x ] = static_cast< uint8_t >( x * 131 + seed );
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+void CompleteHandshake( SilkroadSecurity & server, SilkroadSecurity & client )
+{
+	std::vector< uint8_t > wire;
+	std::vector< PacketView > packets;
+
+	// Each side needs at most a few round trips
+	for( int x = 0; x < 8; ++x )
+	{
+		SilkroadSecurity * from[ 2 ] = { &server, &client };
+		SilkroadSecurity * to[ 2 ] = { &client, &server };
+		for( int y = 0; y < 2; ++y )
+		{
+			wire.clear();
+			from[ y ]->GetPacketsToSend( wire );
+			if( !wire.empty() )
+			{
+				to[ y ]->Recv( wire );
+			}
+		}
+
+		if( server.IsHandshakeComplete() && client.IsHandshakeComplete() && !server.HasPacketToSend() && !client.HasPacketToSend() )
+		{
+			packets.clear();
+			server.PopPacketsToRecv( server.GetPacketsToRecv( packets ) );
+			packets.clear();
+			client.PopPacketsToRecv( client.GetPacketsToRecv( packets ) );
+			return;
+		}
+	}
+
+	throw( std::runtime_error( "[CompleteHandshake] The handshake did not complete" ) );
+}
+
+//-----------------------------------------------------------------------------
+
+int32_t GetArgument( const std::vector< std::string > & args, size_t index, int32_t default_value )
+{
+	if( index >= args.size() )
+	{
+		return default_value;
+	}
+	return boost::lexical_cast< int32_t >( args[ index ] );
+}
+
+//-----------------------------------------------------------------------------
+
+int main( int argc, char * argv[] )
+{
+	if( argc < 2 )
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	for( size_t x = 0; x < sizeof( Benchmarks ) / sizeof( Benchmarks[ 0 ] ); ++x )
+	{
+		if( strcmp( argv[ 1 ], Benchmarks[ x ].name ) == 0 )
+		{
+			try
+			{
+				return Benchmarks[ x ].run( std::vector< std::string >( argv + 2, argv + argc ) );
+			}
+			catch( std::exception & e )
+			{
+				std::cout << Benchmarks[ x ].name << ": " << e.what() << std::endl;
+				return 1;
+			}
+		}
+	}
+
+	PrintUsage();
+	return 1;
+}
+
+//-----------------------------------------------------------------------------
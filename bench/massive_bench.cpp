@@ -0,0 +1,137 @@
+#include "bench.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+//-----------------------------------------------------------------------------
+
+// Payload bytes pushed through each measurement for every message size
+#define MASSIVE_TOTAL ( 256 * 1024 * 1024 )
+
+// Bytes handed over per simulated socket read
+#define MASSIVE_READ_SIZE 16384
+
+//-----------------------------------------------------------------------------
+
+namespace
+{
+	// Feeds the wire to the security object in socket sized reads and returns
+	// how many packets came out of it. When out is given every packet is
+	// forwarded to it, the way a session does.
+	int32_t Receive( SilkroadSecurity & security, const std::vector< uint8_t > & wire, std::vector< PacketView > & packets, int32_t expected_size, SilkroadSecurity * out )
+	{
+		int32_t received = 0;
+		for( size_t offset = 0; offset < wire.size(); offset += MASSIVE_READ_SIZE )
+		{
+			int32_t count = static_cast< int32_t >( std::min< size_t >( MASSIVE_READ_SIZE, wire.size() - offset ) );
+			int32_t size = 0;
+			uint8_t * buffer = security.GetRecvBuffer( count, size );
+			memcpy( buffer, &wire[ offset ], count );
+			security.CommitRecv( count );
+
+			packets.clear();
+			int32_t ready = security.GetPacketsToRecv( packets );
+			for( int32_t x = 0; x < ready; ++x )
+			{
+				const PacketView & p = packets[ x ];
+				if( out )
+				{
+					out->Send( p.opcode, p.data, p.size, p.encrypted, p.massive );
+				}
+				else if( !p.massive || p.size != expected_size )
+				{
+					throw( std::runtime_error( "[Receive] The massive packet was not reassembled" ) );
+				}
+			}
+			security.PopPacketsToRecv( ready );
+			received += ready;
+		}
+		return received;
+	}
+
+	// Times one message size and prints MB/s of payload for each step
+	void MeasureMassive( int32_t size )
+	{
+		int32_t count = std::max( MASSIVE_TOTAL / size, 1 );
+		double megabytes = static_cast< double >( size ) * count / ( 1024 * 1024 );
+
+		std::vector< uint8_t > payload( size );
+		FillPattern( payload, size );
+
+		// server -> client, the client reassembles
+		SilkroadSecurity server;
+		SilkroadSecurity client;
+		server.GenerateHandshake();
+		CompleteHandshake( server, client );
+
+		// server -> proxy_out ... proxy_in -> (client), the proxy passes parts on
+		SilkroadSecurity proxy_server;
+		SilkroadSecurity proxy_out;
+		SilkroadSecurity proxy_in;
+		SilkroadSecurity proxy_client;
+		proxy_server.GenerateHandshake();
+		CompleteHandshake( proxy_server, proxy_out );
+		proxy_in.GenerateHandshake();
+		CompleteHandshake( proxy_in, proxy_client );
+		proxy_out.SetMassivePassthrough( true );
+
+		std::vector< uint8_t > wire;
+		std::vector< uint8_t > forwarded;
+		std::vector< PacketView > packets;
+
+		// Splitting into 0x600D parts
+		BenchTimer timer;
+		for( int32_t x = 0; x < count; ++x )
+		{
+			server.Send( 0xB002, &payload[ 0 ], size, false, true );
+			wire.clear();
+			server.GetPacketsToSend( wire );
+		}
+		double fragment = timer.Elapsed();
+
+		// Reassembling them, the parts carry no security bytes so the same
+		// wire data can be received again
+		timer.Restart();
+		for( int32_t x = 0; x < count; ++x )
+		{
+			if( Receive( client, wire, packets, size, 0 ) != 1 )
+			{
+				throw( std::runtime_error( "[MeasureMassive] Expected one massive packet" ) );
+			}
+		}
+		double reassemble = timer.Elapsed();
+
+		// Passing every part on as it arrives
+		timer.Restart();
+		for( int32_t x = 0; x < count; ++x )
+		{
+			Receive( proxy_out, wire, packets, size, &proxy_in );
+			forwarded.clear();
+			proxy_in.GetPacketsToSend( forwarded );
+		}
+		double passthrough = timer.Elapsed();
+
+		std::cout << size / 1024 << " KB messages: split " << megabytes / fragment << " MB/s, reassemble "
+			<< megabytes / reassemble << " MB/s, passthrough " << megabytes / passthrough << " MB/s" << std::endl;
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+// Massive (0x600D) messages of a few hundred KB split into parts, reassembled
+// and passed through part by part
+int BenchMassive( const std::vector< std::string > & args )
+{
+	if( !args.empty() )
+	{
+		MeasureMassive( std::max( GetArgument( args, 0, 0 ), 1 ) * 1024 );
+		return 0;
+	}
+
+	MeasureMassive( 256 * 1024 );
+	MeasureMassive( 512 * 1024 );
+	MeasureMassive( 1024 * 1024 );
+	return 0;
+}
+
+//-----------------------------------------------------------------------------
@@ -0,0 +1,468 @@
+#include "bench.h"
+#include <boost/asio.hpp>
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+//-----------------------------------------------------------------------------
+
+// These benchmarks need a running phConnector whose GatewayIP/GatewayPort
+// point at the fake server started here (127.0.0.1 and the server port).
+// Packets are timed once straight to the fake server and once through the
+// proxy, the difference is what the proxy adds.
+
+#define DEFAULT_SERVER_PORT 15779
+#define DEFAULT_PROXY_PORT 15780
+
+// Opcodes the fake server echoes back
+#define ECHO_REQUEST 0x7001
+#define ECHO_REPLY 0xB001
+
+// Echoes each throughput client keeps in flight
+#define ECHO_WINDOW 16
+
+//-----------------------------------------------------------------------------
+
+namespace
+{
+	// One side of a Silkroad connection using blocking socket calls
+	class BenchPeer
+	{
+	private:
+		BenchPeer( const BenchPeer & rhs );
+		BenchPeer & operator =( const BenchPeer & rhs );
+
+	public:
+		boost::asio::io_service io_service;
+		boost::asio::ip::tcp::socket socket;
+		SilkroadSecurity security;
+		std::vector< uint8_t > wire;
+
+	public:
+		BenchPeer() : socket( io_service )
+		{
+		}
+
+		// Writes everything the security object has queued
+		void Flush()
+		{
+			wire.clear();
+			security.GetPacketsToSend( wire );
+			if( !wire.empty() )
+			{
+				boost::asio::write( socket, boost::asio::buffer( wire ) );
+			}
+		}
+
+		// Reads until a packet is ready and returns it, PopPacketToRecv
+		// releases it. Returns false once the connection is closed.
+		bool Next( PacketView & packet )
+		{
+			for( ;; )
+			{
+				Flush();
+				if( security.HasPacketToRecv() )
+				{
+					packet = security.PeekPacketToRecv();
+					return true;
+				}
+
+				int32_t size = 0;
+				uint8_t * buffer = security.GetRecvBuffer( 4096, size );
+				boost::system::error_code error;
+				std::size_t count = socket.read_some( boost::asio::buffer( buffer, size ), error );
+				security.CommitRecv( error ? 0 : static_cast< int32_t >( count ) );
+				if( error )
+				{
+					return false;
+				}
+			}
+		}
+
+		// Connects and finishes the handshake, the server's identity is the
+		// first packet to arrive
+		void Connect( uint16_t port )
+		{
+			socket.connect( boost::asio::ip::tcp::endpoint( boost::asio::ip::address_v4::loopback(), port ) );
+			socket.set_option( boost::asio::ip::tcp::no_delay( true ) );
+
+			PacketView packet;
+			if( !Next( packet ) || packet.opcode != 0x2001 )
+			{
+				throw( std::runtime_error( "[BenchPeer::Connect] The server did not send its identity" ) );
+			}
+			security.PopPacketToRecv();
+		}
+
+		// Sends payload to the echo server and waits for it to come back
+		void Echo( const std::vector< uint8_t > & payload, uint8_t encrypted )
+		{
+			security.Send( ECHO_REQUEST, &payload[ 0 ], static_cast< int32_t >( payload.size() ), encrypted );
+
+			PacketView packet;
+			if( !Next( packet ) )
+			{
+				throw( std::runtime_error( "[BenchPeer::Echo] The connection was closed" ) );
+			}
+			if( packet.opcode != ECHO_REPLY || packet.size != static_cast< int32_t >( payload.size() ) || memcmp( packet.data, &payload[ 0 ], payload.size() ) != 0 )
+			{
+				throw( std::runtime_error( "[BenchPeer::Echo] The echo did not match" ) );
+			}
+			security.PopPacketToRecv();
+		}
+	};
+
+	//-------------------------------------------------------------------------
+
+	// Does the handshake and echoes ECHO_REQUEST packets back, one thread per
+	// connection
+	void ServeConnection( boost::shared_ptr< BenchPeer > peer )
+	{
+		try
+		{
+			peer->socket.set_option( boost::asio::ip::tcp::no_delay( true ) );
+			peer->security.GenerateHandshake();
+
+			PacketView packet;
+			while( peer->Next( packet ) )
+			{
+				if( packet.opcode == 0x2001 )
+				{
+					StreamUtility w;
+					w.Write< uint16_t >( 13 );
+					w.Write_Ascii( "GatewayServer" );
+					w.Write< uint8_t >( 0 );
+					peer->security.Send( 0x2001, w, true );
+				}
+				else if( packet.opcode == ECHO_REQUEST )
+				{
+					peer->security.Send( ECHO_REPLY, packet.data, packet.size, packet.encrypted );
+				}
+				peer->security.PopPacketToRecv();
+			}
+		}
+		catch( std::exception & )
+		{
+			// The client went away
+		}
+	}
+
+	// Owned by the thread accepting connections, so it is never destroyed
+	// while that thread is blocked on it
+	struct FakeServer
+	{
+		boost::asio::io_service io_service;
+		boost::asio::ip::tcp::acceptor acceptor;
+
+		FakeServer() : acceptor( io_service )
+		{
+		}
+	};
+
+	void AcceptConnections( boost::shared_ptr< FakeServer > server )
+	{
+		for( ;; )
+		{
+			boost::shared_ptr< BenchPeer > peer = boost::make_shared< BenchPeer >();
+			boost::system::error_code error;
+			server->acceptor.accept( peer->socket, error );
+			if( error )
+			{
+				return;
+			}
+			boost::thread( boost::bind( &ServeConnection, peer ) ).detach();
+		}
+	}
+
+	// Starts the fake server on its own threads, it runs until the program exits
+	void StartFakeServer( uint16_t port )
+	{
+		boost::shared_ptr< FakeServer > server = boost::make_shared< FakeServer >();
+		boost::asio::ip::tcp::endpoint endpoint( boost::asio::ip::address_v4::loopback(), port );
+		server->acceptor.open( endpoint.protocol() );
+		server->acceptor.set_option( boost::asio::ip::tcp::acceptor::reuse_address( true ) );
+		server->acceptor.bind( endpoint );
+		server->acceptor.listen();
+		boost::thread( boost::bind( &AcceptConnections, server ) ).detach();
+	}
+
+	//-------------------------------------------------------------------------
+
+	// Times single round trips and prints the average and percentiles in
+	// microseconds
+	void MeasureLatency( const char * name, uint16_t port, int32_t count )
+	{
+		BenchPeer peer;
+		peer.Connect( port );
+
+		std::vector< uint8_t > payload( 64 );
+		std::vector< double > times;
+		times.reserve( count );
+
+		// Warm up the connection first
+		for( int32_t x = 0; x < 100; ++x )
+		{
+			FillPattern( payload, x );
+			peer.Echo( payload, x % 2 );
+		}
+
+		BenchTimer timer;
+		for( int32_t x = 0; x < count; ++x )
+		{
+			FillPattern( payload, x );
+			timer.Restart();
+			peer.Echo( payload, x % 2 );
+			times.push_back( timer.Elapsed() * 1000000.0 );
+		}
+
+		double total = 0;
+		for( size_t x = 0; x < times.size(); ++x )
+		{
+			total += times[ x ];
+		}
+		std::sort( times.begin(), times.end() );
+
+		std::cout << name << ": average " << total / count << " us, median " << times[ count / 2 ]
+			<< " us, 99th percentile " << times[ count * 99 / 100 ] << " us" << std::endl;
+	}
+
+	//-------------------------------------------------------------------------
+
+	// What one load client managed before the time ran out
+	struct ClientResult
+	{
+		int64_t count;
+		std::string error;
+
+		ClientResult() : count( 0 )
+		{
+		}
+	};
+
+	typedef void ( * ClientFunction )( uint16_t port, double seconds, ClientResult * result );
+
+	// Keeps ECHO_WINDOW echoes in flight on one connection and counts the replies
+	void RunEchoClient( uint16_t port, double seconds, ClientResult * result )
+	{
+		try
+		{
+			BenchPeer peer;
+			peer.Connect( port );
+
+			std::vector< uint8_t > payload( 64 );
+			FillPattern( payload, 0 );
+			for( int32_t x = 0; x < ECHO_WINDOW; ++x )
+			{
+				peer.security.Send( ECHO_REQUEST, &payload[ 0 ], static_cast< int32_t >( payload.size() ), false );
+			}
+
+			BenchTimer timer;
+			while( timer.Elapsed() < seconds )
+			{
+				PacketView packet;
+				if( !peer.Next( packet ) )
+				{
+					throw( std::runtime_error( "[RunEchoClient] The connection was closed" ) );
+				}
+				if( packet.opcode != ECHO_REPLY || packet.size != static_cast< int32_t >( payload.size() ) )
+				{
+					throw( std::runtime_error( "[RunEchoClient] The echo did not match" ) );
+				}
+				peer.security.PopPacketToRecv();
+				++result->count;
+
+				peer.security.Send( ECHO_REQUEST, &payload[ 0 ], static_cast< int32_t >( payload.size() ), false );
+			}
+		}
+		catch( std::exception & e )
+		{
+			result->error = e.what();
+		}
+	}
+
+	// Connects, does the handshake and one echo, and disconnects, over and over
+	void RunConnectClient( uint16_t port, double seconds, ClientResult * result )
+	{
+		try
+		{
+			std::vector< uint8_t > payload( 64 );
+			FillPattern( payload, 0 );
+
+			BenchTimer timer;
+			while( timer.Elapsed() < seconds )
+			{
+				BenchPeer peer;
+				peer.Connect( port );
+				peer.Echo( payload, false );
+
+				// Reset the connection so closed ones do not use up local ports
+				peer.socket.set_option( boost::asio::socket_base::linger( true, 0 ) );
+				++result->count;
+			}
+		}
+		catch( std::exception & e )
+		{
+			result->error = e.what();
+		}
+	}
+
+	// Returns the resident memory of a process in KB, or -1 where it cannot be read
+	int64_t ResidentKB( int32_t pid )
+	{
+#ifdef __linux__
+		std::ostringstream path;
+		path << "/proc/" << pid << "/status";
+		std::ifstream status( path.str().c_str() );
+
+		std::string line;
+		while( std::getline( status, line ) )
+		{
+			if( line.compare( 0, 6, "VmRSS:" ) == 0 )
+			{
+				std::istringstream value( line.substr( 6 ) );
+				int64_t kb = -1;
+				value >> kb;
+				return kb;
+			}
+		}
+#else
+		( void )pid;
+#endif
+		return -1;
+	}
+
+	// Runs one client function per thread and returns how many things they
+	// did per second in total
+	double RunClients( ClientFunction function, uint16_t port, int32_t clients, double seconds )
+	{
+		std::vector< ClientResult > results( clients );
+
+		BenchTimer timer;
+		boost::thread_group threads;
+		for( int32_t x = 0; x < clients; ++x )
+		{
+			threads.create_thread( boost::bind( function, port, seconds, &results[ x ] ) );
+		}
+		threads.join_all();
+		double elapsed = timer.Elapsed();
+
+		int64_t total = 0;
+		for( int32_t x = 0; x < clients; ++x )
+		{
+			if( !results[ x ].error.empty() )
+			{
+				throw( std::runtime_error( results[ x ].error ) );
+			}
+			total += results[ x ].count;
+		}
+		return total / elapsed;
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+// Round trip time of 64 byte echoes straight to the fake server and through
+// the proxy
+int BenchLatency( const std::vector< std::string > & args )
+{
+	uint16_t server_port = static_cast< uint16_t >( GetArgument( args, 0, DEFAULT_SERVER_PORT ) );
+	uint16_t proxy_port = static_cast< uint16_t >( GetArgument( args, 1, DEFAULT_PROXY_PORT ) );
+	int32_t count = std::max( GetArgument( args, 2, 10000 ), 1 );
+
+	StartFakeServer( server_port );
+
+	MeasureLatency( "Direct", server_port, count );
+	MeasureLatency( "Through the proxy", proxy_port, count );
+	return 0;
+}
+
+//-----------------------------------------------------------------------------
+
+// Echoes per second with many clients, each keeping ECHO_WINDOW 64 byte
+// echoes in flight. Every echo is two packets through the proxy.
+int BenchThroughput( const std::vector< std::string > & args )
+{
+	uint16_t server_port = static_cast< uint16_t >( GetArgument( args, 0, DEFAULT_SERVER_PORT ) );
+	uint16_t proxy_port = static_cast< uint16_t >( GetArgument( args, 1, DEFAULT_PROXY_PORT ) );
+	int32_t clients = std::max( GetArgument( args, 2, 32 ), 1 );
+	double seconds = std::max( GetArgument( args, 3, 5 ), 1 );
+
+	StartFakeServer( server_port );
+
+	std::cout << clients << " clients, direct: " << RunClients( &RunEchoClient, server_port, clients, seconds ) << " echoes/s" << std::endl;
+	std::cout << clients << " clients, through the proxy: " << RunClients( &RunEchoClient, proxy_port, clients, seconds ) << " echoes/s" << std::endl;
+	return 0;
+}
+
+//-----------------------------------------------------------------------------
+
+// Memory a running phConnector uses per idle session. Opens the sessions,
+// lets them go quiet and compares the proxy's resident memory (read from
+// /proc on Linux, pass the proxy's pid) before and after. Without a pid the
+// sessions stay open until Enter is pressed so they can be inspected by hand.
+int BenchIdle( const std::vector< std::string > & args )
+{
+	uint16_t server_port = static_cast< uint16_t >( GetArgument( args, 0, DEFAULT_SERVER_PORT ) );
+	uint16_t proxy_port = static_cast< uint16_t >( GetArgument( args, 1, DEFAULT_PROXY_PORT ) );
+	int32_t count = std::max( GetArgument( args, 2, 1000 ), 1 );
+	int32_t pid = GetArgument( args, 3, 0 );
+
+	StartFakeServer( server_port );
+
+	std::vector< uint8_t > payload( 64 );
+	FillPattern( payload, 0 );
+
+	// One session first, so memory that is only set up once is not counted
+	BenchPeer first;
+	first.Connect( proxy_port );
+	first.Echo( payload, false );
+	boost::this_thread::sleep( boost::posix_time::milliseconds( 500 ) );
+	int64_t before = pid ? ResidentKB( pid ) : -1;
+
+	std::vector< boost::shared_ptr< BenchPeer > > peers;
+	for( int32_t x = 0; x < count; ++x )
+	{
+		boost::shared_ptr< BenchPeer > peer = boost::make_shared< BenchPeer >();
+		peer->Connect( proxy_port );
+		peer->Echo( payload, false );
+		peers.push_back( peer );
+	}
+	boost::this_thread::sleep( boost::posix_time::milliseconds( 500 ) );
+	int64_t after = pid ? ResidentKB( pid ) : -1;
+
+	if( before < 0 || after < 0 )
+	{
+		std::cout << count << " idle sessions are open, press Enter to close them" << std::endl;
+		std::cin.get();
+		return 0;
+	}
+
+	std::cout << count << " idle sessions: " << before << " KB -> " << after << " KB, "
+		<< static_cast< double >( after - before ) * 1024 / count << " bytes/session" << std::endl;
+	return 0;
+}
+
+//-----------------------------------------------------------------------------
+
+// New sessions per second, each one a connect, handshake, echo and disconnect
+int BenchConnections( const std::vector< std::string > & args )
+{
+	uint16_t server_port = static_cast< uint16_t >( GetArgument( args, 0, DEFAULT_SERVER_PORT ) );
+	uint16_t proxy_port = static_cast< uint16_t >( GetArgument( args, 1, DEFAULT_PROXY_PORT ) );
+	int32_t clients = std::max( GetArgument( args, 2, 8 ), 1 );
+	double seconds = std::max( GetArgument( args, 3, 5 ), 1 );
+
+	StartFakeServer( server_port );
+
+	std::cout << clients << " clients, direct: " << RunClients( &RunConnectClient, server_port, clients, seconds ) << " connections/s" << std::endl;
+	std::cout << clients << " clients, through the proxy: " << RunClients( &RunConnectClient, proxy_port, clients, seconds ) << " connections/s" << std::endl;
+	return 0;
+}
+
+//-----------------------------------------------------------------------------
@@ -0,0 +1,153 @@
+#include "bench.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+//-----------------------------------------------------------------------------
+
+// Bytes handed over per simulated socket read
+#define READ_SIZE 4096
+
+// Each path is timed this many times and the best run is reported
+#define RECV_ROUNDS 5
+
+//-----------------------------------------------------------------------------
+
+namespace
+{
+	// Client to server traffic for one run, a fresh pair is needed every time
+	// because the security bytes only accept each packet once
+	struct RecvStream
+	{
+		SilkroadSecurity server;
+		SilkroadSecurity client;
+		std::vector< uint8_t > wire;
+		int32_t packets;
+
+		RecvStream() : packets( 0 )
+		{
+		}
+	};
+
+	// Queues packets of 1 to 900 bytes, mixed encrypted and plain, and formats
+	// them the way the client would send them
+	void PrepareStream( RecvStream & stream, int32_t packets )
+	{
+		stream.server.GenerateHandshake();
+		CompleteHandshake( stream.server, stream.client );
+
+		std::vector< uint8_t > payload( 900 );
+		for( int32_t x = 0; x < packets; ++x )
+		{
+			FillPattern( payload, x );
+			stream.client.Send( 0x7001, &payload[ 0 ], 1 + ( x * 37 ) % 900, x % 2 );
+		}
+		stream.client.GetPacketsToSend( stream.wire );
+		stream.packets = packets;
+	}
+
+	// Reads into the connection's own buffer, copies that into the security
+	// object with Recv and takes owned copies with GetPacketToRecv
+	double RunLegacy( RecvStream & stream, int64_t & copied )
+	{
+		std::vector< uint8_t > data( READ_SIZE );
+		int32_t received = 0;
+		copied = 0;
+
+		BenchTimer timer;
+		for( size_t offset = 0; offset < stream.wire.size(); offset += READ_SIZE )
+		{
+			int32_t count = static_cast< int32_t >( std::min< size_t >( READ_SIZE, stream.wire.size() - offset ) );
+			memcpy( &data[ 0 ], &stream.wire[ offset ], count );
+
+			stream.server.Recv( &data[ 0 ], count );
+			copied += count;
+			while( stream.server.HasPacketToRecv() )
+			{
+				PacketContainer packet = stream.server.GetPacketToRecv();
+				copied += packet.data.GetStreamSize();
+				++received;
+			}
+		}
+		double elapsed = timer.Elapsed();
+
+		if( received != stream.packets )
+		{
+			throw( std::runtime_error( "[RunLegacy] Packets were lost" ) );
+		}
+		return elapsed;
+	}
+
+	// Reads straight into the security object's buffer and looks at the
+	// packets where they were decrypted
+	double RunViews( RecvStream & stream, int64_t & copied )
+	{
+		std::vector< PacketView > packets;
+		int32_t received = 0;
+		copied = 0;
+
+		BenchTimer timer;
+		for( size_t offset = 0; offset < stream.wire.size(); offset += READ_SIZE )
+		{
+			int32_t count = static_cast< int32_t >( std::min< size_t >( READ_SIZE, stream.wire.size() - offset ) );
+			int32_t size = 0;
+			uint8_t * buffer = stream.server.GetRecvBuffer( READ_SIZE, size );
+			memcpy( buffer, &stream.wire[ offset ], count );
+			stream.server.CommitRecv( count );
+
+			packets.clear();
+			int32_t ready = stream.server.GetPacketsToRecv( packets );
+			stream.server.PopPacketsToRecv( ready );
+			received += ready;
+		}
+		double elapsed = timer.Elapsed();
+
+		if( received != stream.packets )
+		{
+			throw( std::runtime_error( "[RunViews] Packets were lost" ) );
+		}
+		return elapsed;
+	}
+
+	void Report( const char * name, double seconds, int64_t copied, int32_t packets, size_t wire_size )
+	{
+		std::cout << name << ": " << seconds * 1000000000.0 / packets << " ns/packet, "
+			<< wire_size / seconds / ( 1024 * 1024 ) << " MB/s, "
+			<< static_cast< double >( copied ) / packets << " bytes copied/packet" << std::endl;
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+// Client to server packets through the legacy Recv/GetPacketToRecv calls and
+// through GetRecvBuffer/CommitRecv and packet views. The copy count leaves out
+// the socket read itself, which both paths need.
+int BenchRecv( const std::vector< std::string > & args )
+{
+	int32_t packets = std::max( GetArgument( args, 0, 20000 ), 1 );
+
+	double legacy = 0, views = 0;
+	int64_t legacy_copied = 0, views_copied = 0;
+	size_t wire_size = 0;
+	for( int32_t round = 0; round < RECV_ROUNDS; ++round )
+	{
+		RecvStream legacy_stream;
+		PrepareStream( legacy_stream, packets );
+		double seconds = RunLegacy( legacy_stream, legacy_copied );
+		legacy = round ? std::min( legacy, seconds ) : seconds;
+
+		RecvStream views_stream;
+		PrepareStream( views_stream, packets );
+		seconds = RunViews( views_stream, views_copied );
+		views = round ? std::min( views, seconds ) : seconds;
+
+		wire_size = views_stream.wire.size();
+	}
+
+	std::cout << packets << " packets, " << wire_size / packets << " bytes/packet on the wire" << std::endl;
+	Report( "Recv + GetPacketToRecv", legacy, legacy_copied, packets, wire_size );
+	Report( "GetRecvBuffer + views", views, views_copied, packets, wire_size );
+	return 0;
+}
+
+//-----------------------------------------------------------------------------
@@ -4,41 +4,145 @@
 #include <fstream>
 #include <string>
 #include <list>
+#include <deque>
 
 #include "shared/silkroad_security.h"
 #include "shared/stream_utility.h"
+#include "shared/ring_queue.h"
+#include "shared/opcode_table.h"
+#include "shared/handler_memory.h"
 
 #include <boost/asio.hpp>
 #include <boost/bind.hpp>
 #include <boost/thread.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/make_shared.hpp>
+#include <boost/enable_shared_from_this.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/function.hpp>
 #include <boost/lexical_cast.hpp>
-#include <boost/unordered_map.hpp>
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/ini_parser.hpp>
 
-//Handles network events
-boost::asio::io_service io_service;
+//Runs handshake crypto so it does not hold up the network thread
+boost::asio::io_service handshake_service;
 
-//Agent server info
-std::string AgentIP;
-uint16_t AgentPort = 0;
-bool AgentConnect = false;
+//How long an agent server redirect waits for the client to reconnect
+#define AGENT_REDIRECT_TIMEOUT 60
 
-//Timer delay for processing packets
-#define PACKET_PROCESS_DELAY 10
+//How long resolved hostnames are cached (seconds)
+#define RESOLVE_CACHE_TTL 300
+
+//Outgoing bytes queued on a connection before it counts as congested, and the level it has to drain to again
+#define SEND_HIGH_WATERMARK (256 * 1024)
+#define SEND_LOW_WATERMARK (64 * 1024)
+
+//Connection attempts and the delay before the first retry (doubles after every attempt)
+#define CONNECT_ATTEMPTS 3
+#define CONNECT_RETRY_DELAY 500
+
+//Server side handshake values generated ahead of time
+#define HANDSHAKE_POOL_SIZE 256
+
+//Largest payload a packet that is not massive can carry
+#define MAX_PACKET_SIZE 0x7FFF
+
+//Bytes a connection reads at first, this doubles up to DataMaxSize while reads keep filling the buffer
+#define READ_SIZE_MIN 4096
 
 boost::filesystem::path executable_path();
 
-//Inject functions
-boost::function<void(uint16_t opcode, StreamUtility & p, bool encrypted)> InjectJoymax;
-boost::function<void(uint16_t opcode, StreamUtility & p, bool encrypted)> InjectSilkroad;
+//Runs handshake work until the program exits
+void RunHandshakeService()
+{
+	boost::system::error_code ec;
+	handshake_service.run(ec);
+}
+
+//Processes network events on one of the network threads
+void RunNetworkService(boost::asio::io_service & io_service)
+{
+	while(true)
+	{
+		try
+		{
+			//Run
+			boost::system::error_code ec;
+			io_service.run(ec);
+
+			if(ec)
+			{
+				std::cout << "[" << __FUNCTION__ << "]" << "[" << __LINE__ << "] " << ec.message() << std::endl;
+			}
+			else
+			{
+				//No more work
+				break;
+			}
+			
+			//Prevent high CPU usage
+			boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+		}
+		catch(std::exception & e)
+		{
+			std::cout << "[" << __FUNCTION__ << "]" << "[" << __LINE__ << "] " << e.what() << std::endl;
+		}
+	}
+}
+
+//Returns the name of the I/O backend asio was built with. io_uring is not supported: an asio
+//build that uses it by default is only named here, the proxy has never been built or tested on one.
+const char * NetworkBackend()
+{
+#if defined(BOOST_ASIO_HAS_IOCP)
+	return "IOCP";
+#elif defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+	return "io_uring";
+#elif defined(BOOST_ASIO_HAS_EPOLL)
+	return "epoll";
+#elif defined(BOOST_ASIO_HAS_KQUEUE)
+	return "kqueue";
+#elif defined(BOOST_ASIO_HAS_DEV_POLL)
+	return "/dev/poll";
+#else
+	return "select";
+#endif
+}
+
+//Inject functions (session 0 is the most recently connected session)
+boost::function<void(uint32_t session, uint16_t opcode, const uint8_t * data, int32_t size, bool encrypted)> InjectJoymax;
+boost::function<void(uint32_t session, uint16_t opcode, const uint8_t * data, int32_t size, bool encrypted)> InjectSilkroad;
+
+//Opcodes with special handling
+boost::shared_ptr<const OpcodeTable> CreateOpcodes()
+{
+	boost::shared_ptr<OpcodeTable> opcodes = boost::make_shared<OpcodeTable>();
+	opcodes->Set(0x600D, Opcode_Massive);
+	opcodes->Set(0x2001, Opcode_Hooked);		//Client identity
+	opcodes->Set(0xA102, Opcode_Hooked);		//Agent server redirect
+	return opcodes;
+}
+
+//What happens to each opcode (blocked, wanted by a bot, handled here), only changed on the bot's thread
+SharedOpcodeTable Opcodes(CreateOpcodes());
+
+//Hands a changed opcode table to the network threads
+boost::function<void(boost::shared_ptr<const OpcodeTable> opcodes)> PublishOpcodes;
+
+//Stores a changed opcode table and publishes it (bot's thread only)
+void StoreOpcodes(boost::shared_ptr<const OpcodeTable> opcodes)
+{
+	Opcodes.Store(opcodes);
+	PublishOpcodes(opcodes);
+}
 
-//Blocked opcode list
-boost::unordered_map<uint16_t, bool> BlockedOpcodes;
+//What happens to a packet when a bot's send queue is full
+enum BotOverflowPolicy
+{
+	Overflow_Drop,			//The new packet is not sent to that bot
+	Overflow_Disconnect,	//The bot is disconnected
+	Overflow_Coalesce		//An older queued packet with the same opcode and direction is replaced
+};
 
 namespace Config
 {
@@ -52,23 +156,71 @@ namespace Config
 
 	//Data
 	uint32_t DataMaxSize;		//The maximum number of bytes to receive in one packet
+
+	//Bot
+	uint32_t BotQueueSize;		//The maximum number of bytes queued for one bot
+	BotOverflowPolicy BotOverflow;	//What to do when a bot's queue is full
+
+	//Massive packets
+	bool MassivePassthrough;	//Forward 0x600D parts as they arrive instead of reassembling them
+
+	//Threads
+	uint32_t NetworkThreads;	//Threads that handle connections, each one owns the sessions it accepts (0 uses one per core)
+	uint32_t HandshakeThreads;	//Threads that do handshake crypto (0 does it on the network thread)
 };
 
 class BotConnection
 {
 private:
 
+	//Subscription direction bits
+	enum
+	{
+		Subscribe_ToClient = 1,		//Joymax -> Silkroad (direction 0)
+		Subscribe_ToServer = 2		//Silkroad -> Joymax (direction 1)
+	};
+
+	//A serialized packet, shared by every bot it is sent to
+	struct BotFrame
+	{
+		boost::shared_ptr<const std::vector<uint8_t> > data;
+		uint16_t opcode;
+		uint8_t direction;
+	};
+
 	struct BotData
 	{
+		//Receive buffer, bytes [recv_begin, recv_end) have not been framed yet
 		std::vector<uint8_t> data;
-		StreamUtility pending_stream;
+		size_t recv_begin;
+		size_t recv_end;
+
+		//The session this bot is attached to (0 follows every session)
+		uint32_t session;
+
+		//Directions subscribed to per opcode (empty when the bot receives everything)
+		std::vector<uint8_t> subscriptions;
+
+		//Frames waiting to be written and the frames currently being written
+		std::deque<BotFrame> send_queue;
+		std::vector<BotFrame> send_active;
+		std::vector<boost::asio::const_buffer> send_buffers;
+		size_t queued_bytes;
 
-		BotData()
+		//Reused by every read and every write
+		HandlerMemory read_memory;
+		HandlerMemory write_memory;
+
+		BotData() : recv_begin(0), recv_end(0), session(0), queued_bytes(0)
 		{
-			data.resize(Config::DataMaxSize + 1);
+			//Room for one full read after the largest partial frame
+			data.resize(Config::DataMaxSize + 0xFFFF + 6);
 		}
 	};
 
+	//The network thread bots are handled on
+	boost::asio::io_service & io_service;
+
 	//Accepts TCP connections
 	boost::asio::ip::tcp::acceptor acceptor;
 
@@ -100,122 +252,379 @@ private:
 			//Add the connection to the list
 			boost::shared_ptr<BotData> temp = boost::make_shared<BotData>();
 			sockets[s] = temp;
+			UpdateMirrors();
 
-			s->async_read_some(boost::asio::buffer(&temp->data[0], Config::DataMaxSize), boost::bind(&BotConnection::HandleRead, this, s, boost::asio::placeholders::bytes_transferred, boost::asio::placeholders::error));
+			PostRead(s, temp);
 
 			//Post another accept
 			PostAccept();
 		}
 	}
 
+	//Returns true if the bot wants this packet
+	static bool Wants(const BotData & bot, uint16_t opcode, uint8_t direction, uint32_t session)
+	{
+		//Bots attached to another session
+		if(bot.session && bot.session != session)
+			return false;
+
+		if(bot.subscriptions.empty())
+			return true;
+
+		return (bot.subscriptions[opcode] & (direction ? Subscribe_ToServer : Subscribe_ToClient)) != 0;
+	}
+
+	//Marks the opcodes at least one bot wants in the opcode table
+	void UpdateMirrors()
+	{
+		boost::shared_ptr<OpcodeTable> opcodes = boost::make_shared<OpcodeTable>(*Opcodes.Load());
+		opcodes->ClearRange(0, 0xFFFF, Opcode_MirrorToClient | Opcode_MirrorToServer);
+
+		std::map<boost::shared_ptr<boost::asio::ip::tcp::socket>, boost::shared_ptr<BotData> >::const_iterator itr = sockets.begin();
+		for(; itr != sockets.end(); ++itr)
+		{
+			const BotData & bot = *itr->second;
+			if(bot.subscriptions.empty())
+			{
+				opcodes->SetRange(0, 0xFFFF, Opcode_MirrorToClient | Opcode_MirrorToServer);
+				break;
+			}
+
+			for(uint32_t opcode = 0; opcode < 0x10000; ++opcode)
+			{
+				uint8_t directions = bot.subscriptions[opcode];
+				if(directions & Subscribe_ToClient)
+					opcodes->Set(static_cast<uint16_t>(opcode), Opcode_MirrorToClient);
+				if(directions & Subscribe_ToServer)
+					opcodes->Set(static_cast<uint16_t>(opcode), Opcode_MirrorToServer);
+			}
+		}
+
+		StoreOpcodes(opcodes);
+	}
+
+	//Blocks or unblocks every opcode in the list (one table update for the whole list)
+	void Block(StreamUtility & r)
+	{
+		bool block = r.Read<uint8_t>() != 0;
+		uint16_t count = r.Read<uint16_t>();
+
+		boost::shared_ptr<OpcodeTable> opcodes = boost::make_shared<OpcodeTable>(*Opcodes.Load());
+		for(uint16_t x = 0; x < count; ++x)
+		{
+			uint16_t opcode = r.Read<uint16_t>();
+			if(r.WasReadError())
+				break;
+
+			if(block)
+				opcodes->Set(opcode, Opcode_Blocked);
+			else
+				opcodes->Clear(opcode, Opcode_Blocked);
+		}
+		StoreOpcodes(opcodes);
+
+		std::cout << count << " opcode(s) have been " << (block ? "blocked" : "unblocked") << std::endl;
+	}
+
+	//Blocks or unblocks a range of opcodes
+	void BlockRange(StreamUtility & r)
+	{
+		bool block = r.Read<uint8_t>() != 0;
+		uint16_t first = r.Read<uint16_t>();
+		uint16_t last = r.Read<uint16_t>();
+		if(r.WasReadError() || first > last)
+			return;
+
+		boost::shared_ptr<OpcodeTable> opcodes = boost::make_shared<OpcodeTable>(*Opcodes.Load());
+		if(block)
+			opcodes->SetRange(first, last, Opcode_Blocked);
+		else
+			opcodes->ClearRange(first, last, Opcode_Blocked);
+		StoreOpcodes(opcodes);
+
+		std::cout << "Opcodes [0x" << std::hex << std::setfill('0') << std::setw(4) << first << "-0x" << std::setw(4) << last << "] have been " << (block ? "blocked" : "unblocked") << std::endl << std::dec;
+	}
+
+	//Subscribes to or unsubscribes from a list of opcodes
+	void Subscribe(BotData & bot, StreamUtility & r, bool subscribe)
+	{
+		uint8_t directions = r.Read<uint8_t>();
+		uint16_t count = r.Read<uint16_t>();
+
+		//Only the two direction bits mean anything, the rest would end up in the opcode table
+		directions &= Subscribe_ToClient | Subscribe_ToServer;
+
+		//Unsubscribing from nothing goes back to receiving every packet
+		if(!subscribe && count == 0)
+		{
+			bot.subscriptions.clear();
+			UpdateMirrors();
+			std::cout << "Bot/Analyzer receives all packets" << std::endl;
+			return;
+		}
+
+		if(bot.subscriptions.empty())
+			bot.subscriptions.resize(0x10000);
+
+		for(uint16_t x = 0; x < count; ++x)
+		{
+			uint16_t opcode = r.Read<uint16_t>();
+			if(r.WasReadError())
+				break;
+
+			if(subscribe)
+				bot.subscriptions[opcode] |= directions;
+			else
+				bot.subscriptions[opcode] &= ~directions;
+		}
+
+		UpdateMirrors();
+
+		std::cout << "Bot/Analyzer " << (subscribe ? "subscribed to " : "unsubscribed from ") << count << " opcode(s)" << std::endl;
+	}
+
+	//Closes a bot connection
+	void Disconnect(boost::shared_ptr<boost::asio::ip::tcp::socket> s)
+	{
+		//Shutdown and close the connection
+		boost::system::error_code ec;
+		s->shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
+		s->close(ec);
+
+		//Remove the socket from the list
+		sockets.erase(s);
+		UpdateMirrors();
+	}
+
+	//Queues a frame for one bot
+	void Queue(boost::shared_ptr<boost::asio::ip::tcp::socket> s, boost::shared_ptr<BotData> data, const BotFrame & frame)
+	{
+		BotData & bot = *data;
+		size_t size = frame.data->size();
+
+		if(bot.queued_bytes + size > Config::BotQueueSize)
+		{
+			if(Config::BotOverflow == Overflow_Disconnect)
+			{
+				std::cout << "Bot/Analyzer disconnected (send queue is full)" << std::endl;
+				Disconnect(s);
+				return;
+			}
+
+			if(Config::BotOverflow == Overflow_Coalesce)
+			{
+				//The newest copy of a packet replaces the oldest one still waiting
+				std::deque<BotFrame>::iterator itr = bot.send_queue.begin();
+				while(itr != bot.send_queue.end())
+				{
+					if(itr->opcode == frame.opcode && itr->direction == frame.direction)
+					{
+						bot.queued_bytes -= itr->data->size();
+						bot.send_queue.erase(itr);
+						break;
+					}
+					++itr;
+				}
+			}
+
+			//Drop the packet if there is still no room for it
+			if(bot.queued_bytes + size > Config::BotQueueSize)
+				return;
+		}
+
+		bot.queued_bytes += size;
+		bot.send_queue.push_back(frame);
+
+		PostWrite(s, data);
+	}
+
+	//Writes everything queued for a bot in one operation
+	void PostWrite(boost::shared_ptr<boost::asio::ip::tcp::socket> s, boost::shared_ptr<BotData> data)
+	{
+		BotData & bot = *data;
+		if(!bot.send_active.empty() || bot.send_queue.empty())
+			return;
+
+		bot.send_active.assign(bot.send_queue.begin(), bot.send_queue.end());
+		bot.send_queue.clear();
+
+		bot.send_buffers.clear();
+		for(size_t x = 0; x < bot.send_active.size(); ++x)
+			bot.send_buffers.push_back(boost::asio::buffer(*bot.send_active[x].data));
+
+		boost::asio::async_write(*s, bot.send_buffers, UseMemory(bot.write_memory, boost::bind(&BotConnection::HandleWrite, this, s, data, boost::asio::placeholders::bytes_transferred, boost::asio::placeholders::error)));
+	}
+
+	//Handles finished writes
+	void HandleWrite(boost::shared_ptr<boost::asio::ip::tcp::socket> s, boost::shared_ptr<BotData> data, size_t bytes_transferred, const boost::system::error_code & error)
+	{
+		//The bot has already been removed
+		if(sockets.find(s) == sockets.end())
+			return;
+
+		BotData & bot = *data;
+		bot.queued_bytes -= bytes_transferred;
+		bot.send_active.clear();
+		bot.send_buffers.clear();
+
+		if(error)
+			Disconnect(s);
+		else
+			PostWrite(s, data);
+	}
+
 	//Handles incoming packets
-	void HandleRead(boost::shared_ptr<boost::asio::ip::tcp::socket> s, size_t bytes_transferred, const boost::system::error_code & error)
+	//Reads into the free space after the unframed bytes
+	void PostRead(boost::shared_ptr<boost::asio::ip::tcp::socket> s, boost::shared_ptr<BotData> data)
+	{
+		BotData & bot = *data;
+
+		if(bot.recv_begin == bot.recv_end)
+		{
+			bot.recv_begin = bot.recv_end = 0;
+		}
+		else if(bot.data.size() - bot.recv_end < Config::DataMaxSize)
+		{
+			//Move the partial frame to the front of the buffer
+			memmove(&bot.data[0], &bot.data[bot.recv_begin], bot.recv_end - bot.recv_begin);
+			bot.recv_end -= bot.recv_begin;
+			bot.recv_begin = 0;
+		}
+
+		s->async_read_some(boost::asio::buffer(&bot.data[bot.recv_end], bot.data.size() - bot.recv_end), UseMemory(bot.read_memory, boost::bind(&BotConnection::HandleRead, this, s, data, boost::asio::placeholders::bytes_transferred, boost::asio::placeholders::error)));
+	}
+
+	//Handles finished reads (data keeps the read memory alive after the bot is removed)
+	void HandleRead(boost::shared_ptr<boost::asio::ip::tcp::socket> s, boost::shared_ptr<BotData> /*data*/, size_t bytes_transferred, const boost::system::error_code & error)
 	{
 		std::map<boost::shared_ptr<boost::asio::ip::tcp::socket>, boost::shared_ptr<BotData> >::iterator itr = sockets.find(s);
 		if(itr != sockets.end())
 		{
 			if(error)
 			{
-				if(s)
-				{
-					//Shutdown and close the connection
-					boost::system::error_code ec;
-					s->shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
-					s->close(ec);
-				}
-
-				//Remove the socket from the list
-				sockets.erase(s);
+				Disconnect(s);
 			}
 			else
 			{
-				//Extract structure objects
-				std::vector<uint8_t> & data = itr->second->data;
-				StreamUtility & pending_stream = itr->second->pending_stream;
+				BotData & bot = *itr->second;
+				bot.recv_end += bytes_transferred;
 
-				//Write the received data to the end of the stream
-				pending_stream.Write<uint8_t>(&data[0], bytes_transferred);
-
-				//Total size of stream
-				int32_t total_bytes = pending_stream.GetStreamSize();
-
-				//Make sure there are enough bytes for the packet size to be read
-				while(total_bytes > 2)
+				//Frame packets in place
+				while(bot.recv_end - bot.recv_begin >= 6)
 				{
+					const uint8_t * frame = &bot.data[bot.recv_begin];
+
 					//Peek the packet size
-					uint16_t required_size = pending_stream.Read<uint16_t>(true) + 6;
+					uint16_t size = frame[0] | (frame[1] << 8);
+					uint32_t required_size = size + 6;
 
-					//See if there are enough bytes for this packet
-					if(required_size <= total_bytes)
-					{
-						StreamUtility r(pending_stream);
+					//Not enough bytes received for this packet
+					if(required_size > bot.recv_end - bot.recv_begin)
+						break;
 
-						//Remove this packet from the stream
-						pending_stream.Delete(0, required_size);
-						pending_stream.SeekRead(0, Seek_Set);
-						total_bytes -= required_size;
+					uint16_t opcode = frame[2] | (frame[3] << 8);
+					uint8_t direction = frame[4];
+					const uint8_t * payload = frame + 6;
 
-						uint16_t size = r.Read<uint16_t>();
-						uint16_t opcode = r.Read<uint16_t>();
-						uint8_t direction = r.Read<uint8_t>();
-						r.Read<uint8_t>();
+					//Remove this packet from the buffer
+					bot.recv_begin += required_size;
 
-						//Remove the header
-						r.Delete(0, 6);
-						r.SeekRead(0, Seek_Set);
+					if(opcode >= 1 && opcode <= 7)
+					{
+						StreamUtility r(payload, size);
 
-						if(opcode == 1 || opcode == 2)
+						if(opcode == 6)
+						{
+							//Block or unblock a list of opcodes
+							Block(r);
+						}
+						else if(opcode == 7)
+						{
+							//Block or unblock a range of opcodes
+							BlockRange(r);
+						}
+						else if(opcode == 4 || opcode == 5)
+						{
+							//Opcode subscriptions
+							Subscribe(bot, r, opcode == 4);
+						}
+						else if(opcode == 3)
+						{
+							//Attach to a session
+							bot.session = r.Read<uint32_t>();
+							if(bot.session)
+								std::cout << "Bot/Analyzer attached to session " << bot.session << std::endl;
+							else
+								std::cout << "Bot/Analyzer detached" << std::endl;
+						}
+						else
 						{
 							uint16_t real_opcode = r.Read<uint16_t>();
 
+							boost::shared_ptr<const OpcodeTable> current = Opcodes.Load();
+
 							//Block opcode
 							if(opcode == 1)
 							{
-								BlockedOpcodes[real_opcode] = true;
+								boost::shared_ptr<OpcodeTable> opcodes = boost::make_shared<OpcodeTable>(*current);
+								opcodes->Set(real_opcode, Opcode_Blocked);
+								StoreOpcodes(opcodes);
 								std::cout << "Opcode [0x" << std::hex << std::setfill('0') << std::setw(4) << real_opcode << "] has been blocked" << std::endl << std::dec;
 							}
 							//Remove blocked opcode
 							else if(opcode == 2)
 							{
-								boost::unordered_map<uint16_t, bool>::iterator itr = BlockedOpcodes.find(real_opcode);
-								if(itr != BlockedOpcodes.end())
+								if(current->Get(real_opcode) & Opcode_Blocked)
 								{
-									BlockedOpcodes.erase(itr);
+									boost::shared_ptr<OpcodeTable> opcodes = boost::make_shared<OpcodeTable>(*current);
+									opcodes->Clear(real_opcode, Opcode_Blocked);
+									StoreOpcodes(opcodes);
 									std::cout << "Opcode [0x" << std::hex << std::setfill('0') << std::setw(4) << real_opcode << "] has been unblocked" << std::endl << std::dec;
 								}
 							}
 						}
-						else
-						{
-							//Silkroad
-							if(direction == 2 || direction == 4)
-							{
-								InjectSilkroad(opcode, r, direction == 4 ? true : false);
-							}
-							//Joymax
-							else if(direction == 1 || direction == 3)
-							{
-								InjectJoymax(opcode, r, direction == 3 ? true : false);
-							}
-						}
 					}
-					else
+					//Silkroad
+					else if(direction == 2 || direction == 4)
 					{
-						//Not enough bytes received for this packet
-						break;
+						InjectSilkroad(bot.session, opcode, payload, size, direction == 4 ? true : false);
+					}
+					//Joymax
+					else if(direction == 1 || direction == 3)
+					{
+						InjectJoymax(bot.session, opcode, payload, size, direction == 3 ? true : false);
 					}
 				}
 
 				//Read more data
-				s->async_read_some(boost::asio::buffer(&data[0], Config::DataMaxSize), boost::bind(&BotConnection::HandleRead, this, s, boost::asio::placeholders::bytes_transferred, boost::asio::placeholders::error));
+				PostRead(s, itr->second);
 			}
 		}
 	}
 
+	//Queues a frame for every bot following this session (runs on the bot thread)
+	void Deliver(const BotFrame & frame, uint32_t session)
+	{
+		std::map<boost::shared_ptr<boost::asio::ip::tcp::socket>, boost::shared_ptr<BotData> >::iterator itr = sockets.begin();
+		while(itr != sockets.end())
+		{
+			//Queue may disconnect the bot
+			std::map<boost::shared_ptr<boost::asio::ip::tcp::socket>, boost::shared_ptr<BotData> >::iterator next = itr;
+			++next;
+
+			if(Wants(*itr->second, frame.opcode, frame.direction, session))
+				Queue(itr->first, itr->second, frame);
+
+			//Next
+			itr = next;
+		}
+	}
+
 public:
 
 	//Constructor
-	BotConnection(uint16_t port) : acceptor(io_service, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port))
+	BotConnection(boost::asio::io_service & io_service_, uint16_t port) : io_service(io_service_),
+		acceptor(io_service_, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port))
 	{
 		PostAccept();
 	}
@@ -225,34 +634,29 @@ public:
 	{
 	}
 
-	//Sends packets to all connections
-	void Send(PacketContainer & container, uint8_t direction)
+	//Sends packets to all connections following this session, can be called from any network thread.
+	//The packet is serialized once by the caller and queued for every bot on the bot thread, a slow
+	//bot never holds up the game connections. Callers only send what the opcode table mirrors.
+	void Send(const PacketView & packet, uint8_t direction, uint32_t session)
 	{
-		StreamUtility & r = container.data;
-
-		StreamUtility w;
-		w.Write<uint16_t>(r.GetReadStreamSize());
-		w.Write<uint16_t>(container.opcode);
-		w.Write<uint8_t>(direction);
-		w.Write<uint8_t>(container.encrypted);
-		
-		while(r.GetReadStreamSize())
-			w.Write<uint8_t>(r.Read<uint8_t>());
-
-		//Reset the read index
-		r.SeekRead(0, Seek_Set);
-
-		//Iterate all connections
-		std::map<boost::shared_ptr<boost::asio::ip::tcp::socket>, boost::shared_ptr<BotData> >::iterator itr = sockets.begin();
-		while(itr != sockets.end())
-		{
-			//Send the packet
-			boost::system::error_code ec;
-			boost::asio::write(*itr->first, boost::asio::buffer(w.GetStreamPtr(), w.GetStreamSize()), boost::asio::transfer_all(), ec);
-			
-			//Next
-			++itr;
-		}
+		int32_t size = packet.size;
+
+		boost::shared_ptr<std::vector<uint8_t> > data = boost::make_shared<std::vector<uint8_t> >(6 + size);
+		StreamUtility w(*data);
+		w.Overwrite<uint16_t>(0, static_cast<uint16_t>(size));
+		w.Overwrite<uint16_t>(2, packet.opcode);
+		w.Overwrite<uint8_t>(4, direction);
+		w.Overwrite<uint8_t>(5, packet.encrypted);
+		if(size)
+			w.Overwrite<uint8_t>(6, packet.data, size);
+
+		BotFrame frame;
+		frame.data = data;
+		frame.opcode = packet.opcode;
+		frame.direction = direction;
+
+		//Runs right away on the bot thread
+		io_service.dispatch(boost::bind(&BotConnection::Deliver, this, frame, session));
 	}
 
 	void Stop()
@@ -278,369 +682,1399 @@ public:
 //Has to be created after the settings are loaded
 boost::shared_ptr<BotConnection> Bot;
 
+//Caches resolved server hostnames (shared by every network thread)
+class ResolveCache
+{
+private:
+
+	//Only addresses are kept, the same host is connected to on more than one port (gateway and agent)
+	struct Entry
+	{
+		std::vector<boost::asio::ip::address> addresses;
+		boost::posix_time::ptime expires;
+	};
+
+	std::map<std::string, Entry> entries;
+	boost::mutex mutex;
+
+public:
+
+	//Retrieves the cached addresses for a hostname as endpoints on port
+	bool Find(const std::string & host, uint16_t port, std::vector<boost::asio::ip::tcp::endpoint> & endpoints)
+	{
+		boost::mutex::scoped_lock lock(mutex);
+
+		std::map<std::string, Entry>::iterator itr = entries.find(host);
+		if(itr == entries.end())
+			return false;
+
+		if(itr->second.expires < boost::posix_time::second_clock::universal_time())
+		{
+			entries.erase(itr);
+			return false;
+		}
+
+		const std::vector<boost::asio::ip::address> & addresses = itr->second.addresses;
+		for(size_t x = 0; x < addresses.size(); ++x)
+			endpoints.push_back(boost::asio::ip::tcp::endpoint(addresses[x], port));
+		return true;
+	}
+
+	//Stores the endpoints a hostname resolved to
+	void Add(const std::string & host, const std::vector<boost::asio::ip::tcp::endpoint> & endpoints)
+	{
+		boost::mutex::scoped_lock lock(mutex);
+
+		Entry & entry = entries[host];
+		entry.addresses.clear();
+		for(size_t x = 0; x < endpoints.size(); ++x)
+			entry.addresses.push_back(endpoints[x].address());
+		entry.expires = boost::posix_time::second_clock::universal_time() + boost::posix_time::seconds(RESOLVE_CACHE_TTL);
+	}
+
+	//Forgets a hostname (the cached endpoints stopped working)
+	void Remove(const std::string & host)
+	{
+		boost::mutex::scoped_lock lock(mutex);
+		entries.erase(host);
+	}
+};
+
+ResolveCache Resolved;
+
 //Silkroad connection class
-class SilkroadConnection
+class SilkroadConnection : public boost::enable_shared_from_this<SilkroadConnection>
 {
 private:
 
-	//Socket
-	boost::shared_ptr<boost::asio::ip::tcp::socket> s;
+	//The network thread this connection belongs to
+	boost::asio::io_service & io_service;
+
+	//Socket
+	boost::shared_ptr<boost::asio::ip::tcp::socket> s;
+
+	//Connection state
+	boost::asio::ip::tcp::resolver resolver;
+	boost::asio::deadline_timer retry_timer;
+	std::vector<boost::asio::ip::tcp::endpoint> endpoints;
+	std::string host;
+	uint16_t connect_port;
+	uint32_t attempt;
+	boost::function<void(const boost::system::error_code &)> connect_handler;
+
+	//Read state
+	bool reading;
+	bool paused;
+
+	//Set while handling a read that emptied the socket, the next read waits for data before it takes a buffer
+	bool drained;
+
+	//Bytes asked for by the next read
+	int32_t read_size;
+
+	//Bytes waiting to be written and the bytes currently being written
+	std::vector<uint8_t> send_queue;
+	std::vector<uint8_t> send_active;
+	size_t queued_bytes;
+	bool congested;
+
+	//Reused by every read and every write (the handlers keep the connection alive)
+	HandlerMemory read_memory;
+	HandlerMemory write_memory;
+
+	//Close once everything queued has been written
+	bool closing;
+
+	//Set while received data is processed on a handshake thread, the security object is left alone until it is done
+	bool handshaking;
+
+	//Packets injected while handshaking
+	RingQueue<PacketContainer> deferred;
+
+	//Closes the socket but keeps the security object so packets that already arrived can still be processed
+	void Disconnect()
+	{
+		if(s)
+		{
+			boost::system::error_code ec;
+			s->shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
+			s->close(ec);
+			s.reset();
+		}
+	}
+
+	//Reads once the socket has data
+	void HandleReady(boost::shared_ptr<SilkroadSecurity> target, const boost::system::error_code & error)
+	{
+		size_t bytes_transferred = 0;
+		boost::system::error_code ec = error;
+
+		if(!ec && s && !closing && target == security)
+		{
+			//The buffer is only borrowed now that there is something to read
+			int32_t size = 0;
+			uint8_t * buffer = security->GetRecvBuffer(read_size, size);
+			bytes_transferred = s->read_some(boost::asio::buffer(buffer, size), ec);
+
+			if(ec == boost::asio::error::would_block)
+			{
+				reading = false;
+				drained = true;
+				PostRead();
+				drained = false;
+				security->ReleaseRecvBuffer();
+				return;
+			}
+
+			//A full buffer probably left more in the socket, that is read right away
+			drained = bytes_transferred < static_cast<size_t>(size);
+
+			//Bulk traffic gets larger reads, they shrink again once it slows down
+			if(bytes_transferred == static_cast<size_t>(size))
+			{
+				if(read_size < static_cast<int32_t>(Config::DataMaxSize))
+					read_size *= 2;
+			}
+			else if(bytes_transferred < static_cast<size_t>(read_size / 4) && read_size > READ_SIZE_MIN)
+			{
+				read_size /= 2;
+			}
+		}
+
+		HandleRead(target, bytes_transferred, ec);
+
+		//Nothing is kept while waiting for more data
+		if(drained && target == security && !handshaking)
+			security->ReleaseRecvBuffer();
+		drained = false;
+	}
+
+	//Handles incoming packets
+	void HandleRead(boost::shared_ptr<SilkroadSecurity> target, size_t bytes_transferred, const boost::system::error_code & error)
+	{
+		reading = false;
+
+		if(closing || target != security)
+		{
+			return;
+		}
+		else if(!error && s && security)
+		{
+			//Handshake packets need several key setups, those are done on a handshake thread
+			if(Config::HandshakeThreads && !security->IsHandshakeComplete())
+			{
+				handshaking = true;
+				handshake_service.post(boost::bind(&SilkroadConnection::CommitHandshake, shared_from_this(), security, static_cast<int32_t>(bytes_transferred)));
+				return;
+			}
+
+			//Data that does not decode ends the connection, the owner sees it closed
+			try
+			{
+				security->CommitRecv(static_cast<int32_t>(bytes_transferred));
+			}
+			catch(std::exception & e)
+			{
+				std::cout << "[Error] " << e.what() << std::endl;
+				Disconnect();
+			}
+
+			if(!paused)
+				PostRead();
+		}
+		else if(s)
+		{
+			Disconnect();
+		}
+		else
+		{
+			return;
+		}
+
+		//Dispatch the packets right away (the copy stays valid if the owner closes this connection)
+		boost::function<void()> handler = OnReceive;
+		if(handler)
+			handler();
+	}
+
+	//Processes received data on a handshake thread (only the security object may be used here)
+	static void CommitHandshake(boost::shared_ptr<SilkroadConnection> connection, boost::shared_ptr<SilkroadSecurity> target, int32_t bytes_transferred)
+	{
+		std::string error;
+		try
+		{
+			target->CommitRecv(bytes_transferred);
+		}
+		catch(std::exception & e)
+		{
+			error = e.what();
+		}
+
+		connection->io_service.post(boost::bind(&SilkroadConnection::HandleHandshake, connection, target, error));
+	}
+
+	//Continues on the connection's network thread once the handshake thread is done
+	void HandleHandshake(boost::shared_ptr<SilkroadSecurity> target, const std::string & error)
+	{
+		if(target != security)
+			return;
+
+		handshaking = false;
+
+		//Hand over the packets injected in the meantime
+		while(!deferred.empty())
+		{
+			PacketContainer & packet = deferred.front();
+			security->Send(packet.opcode, packet.data, packet.encrypted, packet.massive);
+			deferred.pop_front();
+		}
+
+		if(closing)
+			return;
+
+		//Same as bad data on this thread, the owner sees the connection closed
+		if(!error.empty())
+		{
+			std::cout << "[Error] " << error << std::endl;
+			Disconnect();
+		}
+		else if(!paused)
+		{
+			PostRead();
+		}
+
+		boost::function<void()> handler = OnReceive;
+		if(handler)
+			handler();
+	}
+
+	//Hands a packet to the security API, or holds on to it while a handshake is processed
+	void Queue(uint16_t opcode, const uint8_t * data, int32_t size, uint8_t encrypted, uint8_t massive)
+	{
+		if(handshaking)
+		{
+			PacketContainer & packet = deferred.push_back();
+			packet.opcode = opcode;
+			packet.data.Clear();
+			packet.data.Write<uint8_t>(data, size);
+			packet.encrypted = encrypted;
+			packet.massive = massive;
+		}
+		else
+		{
+			security->Send(opcode, data, size, encrypted, massive);
+		}
+	}
+
+	//Starts the next connection attempt
+	void PostConnect()
+	{
+		if(!s) return;
+
+		//Try every endpoint once per attempt
+		s->async_connect(endpoints[attempt % endpoints.size()], boost::bind(&SilkroadConnection::HandleConnect, shared_from_this(), boost::asio::placeholders::error));
+	}
+
+	//Handles hostname resolution
+	void HandleResolve(const boost::system::error_code & error, boost::asio::ip::tcp::resolver::iterator itr)
+	{
+		if(!s) return;
+
+		if(!error)
+		{
+			for(; itr != boost::asio::ip::tcp::resolver::iterator(); ++itr)
+				endpoints.push_back(*itr);
+		}
+
+		if(error || endpoints.empty())
+		{
+			FinishConnect(error ? error : boost::asio::error::host_not_found);
+			return;
+		}
+
+		Resolved.Add(host, endpoints);
+		PostConnect();
+	}
+
+	//Handles connection attempts
+	void HandleConnect(const boost::system::error_code & error)
+	{
+		if(!s) return;
+
+		if(!error)
+		{
+			//Create new Silkroad security
+			security = boost::make_shared<SilkroadSecurity>();
+			security->SetMassivePassthrough(Config::MassivePassthrough);
+
+			//Disable nagle
+			boost::system::error_code ec;
+			s->set_option(boost::asio::ip::tcp::no_delay(true), ec);
+
+			//Reads only start once data is there and must never block
+			s->non_blocking(true, ec);
+
+			FinishConnect(error);
+		}
+		else if(error == boost::asio::error::operation_aborted)
+		{
+			FinishConnect(error);
+		}
+		else if(++attempt < CONNECT_ATTEMPTS * endpoints.size())
+		{
+			boost::system::error_code ec;
+			s->close(ec);
+
+			//Retry the next endpoint right away, wait before starting over
+			if(attempt % endpoints.size())
+			{
+				PostConnect();
+			}
+			else
+			{
+				uint32_t delay = CONNECT_RETRY_DELAY << (attempt / endpoints.size() - 1);
+				retry_timer.expires_from_now(boost::posix_time::milliseconds(delay));
+				retry_timer.async_wait(boost::bind(&SilkroadConnection::HandleRetry, shared_from_this(), boost::asio::placeholders::error));
+			}
+		}
+		else
+		{
+			//The cached address may be stale
+			Resolved.Remove(host);
+			FinishConnect(error);
+		}
+	}
+
+	//Handles the delay between connection attempts
+	void HandleRetry(const boost::system::error_code & error)
+	{
+		if(error || !s)
+			FinishConnect(error ? error : boost::asio::error::operation_aborted);
+		else
+			PostConnect();
+	}
+
+	//Writes everything that has been queued in one operation
+	void PostWrite()
+	{
+		if(!s || !send_active.empty() || send_queue.empty())
+			return;
+
+		//Both buffers keep their capacity, so steady traffic does not allocate
+		send_active.swap(send_queue);
+
+		boost::asio::async_write(*s, boost::asio::buffer(send_active), UseMemory(write_memory, boost::bind(&SilkroadConnection::HandleWrite, shared_from_this(), boost::asio::placeholders::bytes_transferred, boost::asio::placeholders::error)));
+	}
+
+	//Handles finished writes
+	void HandleWrite(size_t bytes_transferred, const boost::system::error_code & error)
+	{
+		queued_bytes -= bytes_transferred < queued_bytes ? bytes_transferred : queued_bytes;
+		send_active.clear();
+
+		if(error)
+		{
+			if(s)
+			{
+				Disconnect();
+
+				//Let the owner know the connection is gone
+				boost::function<void()> handler = OnReceive;
+				if(handler)
+					handler();
+			}
+			return;
+		}
+
+		if(send_queue.empty())
+		{
+			if(closing)
+			{
+				Close();
+				return;
+			}
+		}
+		else
+		{
+			PostWrite();
+		}
+
+		//Let the owner resume once the backlog has drained
+		if(congested && queued_bytes <= SEND_LOW_WATERMARK)
+		{
+			congested = false;
+
+			boost::function<void()> handler = OnDrained;
+			if(handler)
+				handler();
+		}
+	}
+
+	//Reports the result of Connect
+	void FinishConnect(const boost::system::error_code & error)
+	{
+		boost::function<void(const boost::system::error_code &)> handler;
+		handler.swap(connect_handler);
+
+		if(handler)
+			handler(error);
+	}
+
+public:
+
+	//Security
+	boost::shared_ptr<SilkroadSecurity> security;
+
+	//Called after data has been received or the socket was closed by the other side
+	boost::function<void()> OnReceive;
+
+	//Called when the outgoing queue drains below the low watermark after being congested
+	boost::function<void()> OnDrained;
+
+	//Constructor
+	SilkroadConnection(boost::asio::io_service & io_service_) : io_service(io_service_), resolver(io_service_), retry_timer(io_service_), connect_port(0), attempt(0),
+		reading(false), paused(false), drained(false), read_size(READ_SIZE_MIN), queued_bytes(0), congested(false), closing(false), handshaking(false), deferred(4)
+	{
+	}
+
+	//Destructor
+	~SilkroadConnection()
+	{
+		Close();
+	}
+
+	//Gets everything ready for receiving packets
+	void Initialize(boost::shared_ptr<boost::asio::ip::tcp::socket> s_)
+	{
+		s = s_;
+		security = boost::make_shared<SilkroadSecurity>();
+		security->SetMassivePassthrough(Config::MassivePassthrough);
+
+		//Reads only start once data is there and must never block
+		boost::system::error_code ec;
+		s->non_blocking(true, ec);
+	}
+
+	//Returns true if the socket is open
+	bool IsOpen() const
+	{
+		return s ? true : false;
+	}
+
+	//Returns true while a handshake thread owns the security object
+	bool IsHandshaking() const
+	{
+		return handshaking;
+	}
+
+	//Returns true while the connection finishes its writes before it closes itself
+	bool IsClosing() const
+	{
+		return closing;
+	}
+
+	//Returns true while more than the high watermark is queued for sending
+	bool IsCongested() const
+	{
+		return congested;
+	}
+
+	//Returns the number of bytes waiting to be sent
+	size_t GetQueuedBytes() const
+	{
+		return queued_bytes;
+	}
+
+	//Stops reading after the current read finishes
+	void PauseRead()
+	{
+		paused = true;
+	}
+
+	//Starts reading again
+	void ResumeRead()
+	{
+		paused = false;
+		PostRead();
+	}
+
+	//Starts receiving data
+	void PostRead()
+	{
+		if(s && security && !reading && !closing && !handshaking)
+		{
+			reading = true;
+
+			//Wait for data without holding a buffer if the last read emptied the socket. Anything else
+			//may have data waiting already (with nothing left to signal it), that is tried right away.
+			if(drained)
+				s->async_read_some(boost::asio::null_buffers(), UseMemory(read_memory, boost::bind(&SilkroadConnection::HandleReady, shared_from_this(), security, boost::asio::placeholders::error)));
+			else
+				io_service.post(UseMemory(read_memory, boost::bind(&SilkroadConnection::HandleReady, shared_from_this(), security, boost::system::error_code())));
+		}
+	}
+
+	//Closes the socket
+	void Close()
+	{
+		boost::system::error_code ec;
+		resolver.cancel();
+		retry_timer.cancel(ec);
+		connect_handler.clear();
+
+		send_queue.clear();
+		queued_bytes = 0;
+		congested = false;
+		closing = false;
+
+		handshaking = false;
+		while(!deferred.empty())
+			deferred.pop_front();
+
+		if(s)
+		{
+			boost::system::error_code ec;
+			s->shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
+			s->close(ec);
+			s.reset();
+		}
+
+		security.reset();
+		OnReceive.clear();
+		OnDrained.clear();
+	}
+
+	//Closes the socket once everything queued has been sent
+	void CloseAfterWrite()
+	{
+		OnReceive.clear();
+		OnDrained.clear();
+
+		if(!s || (send_active.empty() && send_queue.empty()))
+			Close();
+		else
+			closing = true;
+	}
+
+	//Connects to a server without blocking, the handler is called once connected or after the last failed attempt
+	void Connect(const std::string & IP, uint16_t port, boost::function<void(const boost::system::error_code &)> handler)
+	{
+		//Create the socket
+		s = boost::make_shared<boost::asio::ip::tcp::socket>(io_service);
+
+		host = IP;
+		connect_port = port;
+		connect_handler = handler;
+		attempt = 0;
+		endpoints.clear();
+
+		boost::system::error_code ec;
+		boost::asio::ip::address address = boost::asio::ip::address::from_string(IP, ec);
+
+		//Probably not a valid IP so it's a hostname
+		if(ec)
+		{
+			if(Resolved.Find(IP, port, endpoints))
+			{
+				PostConnect();
+			}
+			else
+			{
+				boost::asio::ip::tcp::resolver::query query(boost::asio::ip::tcp::v4(), IP, boost::lexical_cast<std::string>(port));
+				resolver.async_resolve(query, boost::bind(&SilkroadConnection::HandleResolve, shared_from_this(), boost::asio::placeholders::error, boost::asio::placeholders::iterator));
+			}
+		}
+		else
+		{
+			endpoints.push_back(boost::asio::ip::tcp::endpoint(address, port));
+			PostConnect();
+		}
+	}
+
+	//Hands packets off to the security API
+	bool Inject(uint16_t opcode, StreamUtility & p, bool encrypted = false)
+	{
+		if(security)
+		{
+			Queue(opcode, p.GetStreamPtr(), p.GetStreamSize(), encrypted ? 1 : 0, 0);
+			return true;
+		}
+
+		return false;
+	}
+
+	//Hands packets off to the security API
+	bool Inject(uint16_t opcode, const uint8_t * data, int32_t size, bool encrypted = false)
+	{
+		if(security && size <= MAX_PACKET_SIZE)
+		{
+			Queue(opcode, data, size, encrypted ? 1 : 0, 0);
+			return true;
+		}
+
+		return false;
+	}
+
+	//Hands packets off to the security API
+	bool Inject(uint16_t opcode, bool encrypted = false)
+	{
+		if(security)
+		{
+			Queue(opcode, 0, 0, encrypted ? 1 : 0, 0);
+			return true;
+		}
+
+		return false;
+	}
+
+	//Hands packets off to the security API
+	bool Inject(const PacketView & packet)
+	{
+		if(security)
+		{
+			Queue(packet.opcode, packet.data, packet.size, packet.encrypted, packet.massive);
+			return true;
+		}
+
+		return false;
+	}
+
+	//Formats every packet the security object has ready into the send buffer
+	bool Send()
+	{
+		if(!s || closing || !security || handshaking) return false;
+
+		size_t size = send_queue.size();
+		security->GetPacketsToSend(send_queue);
+
+		queued_bytes += send_queue.size() - size;
+		if(queued_bytes > SEND_HIGH_WATERMARK)
+			congested = true;
+
+		return true;
+	}
+
+	//Starts sending the queued packets
+	void Commit()
+	{
+		PostWrite();
+	}
+};
+
+//Pending agent server redirects (shared by every network thread, the reconnect can arrive on any of them)
+class RedirectTable
+{
+private:
+
+	struct Redirect
+	{
+		std::string IP;
+		uint16_t port;
+		boost::posix_time::ptime expires;
+	};
+
+	//Pending redirects keyed by the loopback address handed to the client
+	std::map<std::string, Redirect> redirects;
+
+	//Next loopback address to hand out (127.0.0.2 - 127.255.255.254)
+	uint32_t next_address;
+
+	boost::mutex mutex;
+
+public:
+
+	RedirectTable() : next_address(1)
+	{
+	}
+
+	//Stores an agent server redirect and returns the loopback address the client should connect to.
+	//Every client gets its own address in 127.0.0.0/8 so the reconnect can be matched by the local
+	//address it arrives on, no matter how many other clients are connecting at the same time.
+	std::string Add(const std::string & IP, uint16_t port)
+	{
+		boost::mutex::scoped_lock lock(mutex);
+
+		boost::posix_time::ptime now = boost::posix_time::second_clock::universal_time();
+
+		//Remove redirects the client never used
+		std::map<std::string, Redirect>::iterator itr = redirects.begin();
+		while(itr != redirects.end())
+		{
+			if(itr->second.expires < now)
+				redirects.erase(itr++);
+			else
+				++itr;
+		}
+
+		//Skip network/broadcast style addresses
+		do
+		{
+			if(++next_address >= 0xFFFFFF)
+				next_address = 2;
+		}
+		while((next_address & 0xFF) == 0 || (next_address & 0xFF) == 0xFF);
+
+		std::string address = boost::asio::ip::address_v4(0x7F000000 | next_address).to_string();
+
+		Redirect & redirect = redirects[address];
+		redirect.IP = IP;
+		redirect.port = port;
+		redirect.expires = now + boost::posix_time::seconds(AGENT_REDIRECT_TIMEOUT);
+
+		return address;
+	}
+
+	//Retrieves (and removes) the redirect for a connection accepted on this local address
+	bool Take(const std::string & address, std::string & IP, uint16_t & port)
+	{
+		boost::mutex::scoped_lock lock(mutex);
+
+		std::map<std::string, Redirect>::iterator itr = redirects.find(address);
+		if(itr == redirects.end())
+			return false;
+
+		IP = itr->second.IP;
+		port = itr->second.port;
+		redirects.erase(itr);
+
+		return true;
+	}
+};
+
+//A client connection and its server connection
+class Session : public boost::enable_shared_from_this<Session>
+{
+private:
+
+	//Session ID
+	uint32_t id;
+
+	//Silkroad connections
+	boost::shared_ptr<SilkroadConnection> Silkroad;
+	boost::shared_ptr<SilkroadConnection> Joymax;
+
+	//Agent server redirects
+	RedirectTable & redirects;
+
+	//The opcode table of the session's network thread
+	const boost::shared_ptr<const OpcodeTable> & opcodes;
+
+	//Packets handed out by the security api (reused between reads)
+	std::vector<PacketView> packets;
+
+	//A massive packet being passed through part by part
+	struct MassiveState
+	{
+		uint16_t opcode;
+		uint16_t count;
+		uint8_t encrypted;
+		bool forward;		//The parts are forwarded
+		bool collect;		//A bot wants the reassembled packet
+		StreamUtility data;
+
+		MassiveState() : opcode(0), count(0), encrypted(0), forward(true), collect(false)
+		{
+		}
+	};
+
+	//Massive packets per direction (0 is Joymax -> Silkroad, 1 is Silkroad -> Joymax)
+	MassiveState massive[2];
+
+	//Follows a passed through 0x600D part, returns false if the part should be dropped
+	bool PassMassive(MassiveState & state, const PacketView & p, uint8_t direction)
+	{
+		//Header part
+		if(p.size >= 5 && p.data[0] == 1)
+		{
+			state.count = p.data[1] | (p.data[2] << 8);
+			state.opcode = p.data[3] | (p.data[4] << 8);
+			state.encrypted = p.encrypted;
+			uint8_t attributes = opcodes->Get(state.opcode);
+			state.forward = (attributes & Opcode_Blocked) == 0;
+			state.collect = state.forward && (attributes & (direction ? Opcode_MirrorToServer : Opcode_MirrorToClient)) != 0;
+			state.data.Clear();
+			return state.forward;
+		}
+
+		if(state.count == 0)
+			return true;
+
+		//Only bots need the whole packet
+		if(state.collect && p.size > 1)
+			state.data.Write<uint8_t>(p.data + 1, p.size - 1);
+
+		if(--state.count == 0 && state.collect)
+		{
+			PacketView packet;
+			packet.opcode = state.opcode;
+			packet.data = state.data.GetStreamPtr();
+			packet.size = state.data.GetStreamSize();
+			packet.encrypted = state.encrypted;
+			packet.massive = 1;
+			Bot->Send(packet, direction, id);
+
+			//Release the buffer so an idle session only holds one part
+			StreamUtility empty;
+			empty.Swap(state.data);
+			state.collect = false;
+		}
+
+		return state.forward;
+	}
+
+	//What a stage decided about a packet
+	enum StageResult
+	{
+		Stage_Forward,		//Nothing changes
+		Stage_Drop,			//The packet is not forwarded
+		Stage_Finish		//The session is done, nothing else is processed
+	};
+
+	//A step packets go through before they are forwarded. A stage only sees the opcodes that have one of its
+	//attribute bits set, new stages are added to Stages without touching ForwardPackets.
+	struct Stage
+	{
+		uint8_t direction;		//0 is Joymax -> Silkroad, 1 is Silkroad -> Joymax
+		uint8_t attributes;
+		StageResult (Session::*process)(const PacketView & p, uint8_t direction);
+	};
+
+	//Every stage in the order they run
+	static const Stage Stages[];
+	static const size_t StageCount;
+
+	//Massive packet parts (only seen when they are passed through)
+	StageResult MassiveStage(const PacketView & p, uint8_t direction)
+	{
+		return PassMassive(massive[direction], p, direction) ? Stage_Forward : Stage_Drop;
+	}
+
+	//Keeps the client's identity from reaching the server
+	StageResult IdentityStage(const PacketView & p, uint8_t /*direction*/)
+	{
+		if(p.opcode != 0x2001)
+			return Stage_Forward;
+
+		std::cout << "[Session " << id << "] Connected" << std::endl;
+		return Stage_Drop;
+	}
+
+	//Sends the client's agent server connection through the proxy
+	StageResult RedirectStage(const PacketView & p, uint8_t /*direction*/)
+	{
+		if(p.opcode != 0xA102)
+			return Stage_Forward;
+
+		StreamUtility r(p.data, p.size);
+		if(r.Read<uint8_t>() != 1 || !Silkroad->security)
+			return Stage_Forward;
+
+		uint32_t LoginID = r.Read<uint32_t>();				//Login ID
+		std::string AgentIP = r.Read_Ascii(r.Read<uint16_t>());	//Agent IP
+		uint16_t AgentPort = r.Read<uint16_t>();			//Agent port
+
+		//The client's next connection will go to the agent server
+		std::string RedirectIP = redirects.Add(AgentIP, AgentPort);
+
+		StreamUtility w;
+		w.Write<uint8_t>(1);								//Success flag
+		w.Write<uint32_t>(LoginID);							//Login ID
+		w.Write<uint16_t>(static_cast<uint16_t>(RedirectIP.length()));	//Length of the IP
+		w.Write_Ascii(RedirectIP);							//IP
+		w.Write<uint16_t>(Config::BindPort);				//Port
+
+		//Inject the packet
+		Silkroad->Inject(p.opcode, w);
+
+		//Inject the packet immediately
+		Flush(*Silkroad);
+
+		//This session is done, the client reconnects as a new one
+		Shutdown();
+		return Stage_Finish;
+	}
+
+	//Forwards the packets one connection received to the other, returns false once the session is finished
+	bool ForwardPackets(SilkroadConnection & from, SilkroadConnection & to, uint8_t direction, const OpcodeTable & opcodes)
+	{
+		if(!from.security || from.IsHandshaking())
+			return true;
+
+		//Look at the packets inside the security api
+		packets.clear();
+		int32_t count = from.security->GetPacketsToRecv(packets);
+
+		uint8_t mirror = direction ? Opcode_MirrorToServer : Opcode_MirrorToClient;
+
+		for(int32_t x = 0; x < count; ++x)
+		{
+			const PacketView & p = packets[x];
+			uint8_t attributes = opcodes.Get(p.opcode);
+
+			//Check the blocked list
+			bool forward = (attributes & Opcode_Blocked) == 0;
+
+			//Packets with special handling
+			for(size_t y = 0; y < StageCount; ++y)
+			{
+				const Stage & stage = Stages[y];
+				if((stage.attributes & attributes) == 0 || stage.direction != direction)
+					continue;
+
+				StageResult result = (this->*stage.process)(p, direction);
+				if(result == Stage_Finish)
+					return false;
+				if(result == Stage_Drop)
+					forward = false;
+			}
+
+			//Forward the packet (bots get massive packets once they have been put back together)
+			if(forward && to.security)
+			{
+				if((attributes & (Opcode_Massive | mirror)) == mirror)
+					Bot->Send(p, direction, id);
+				to.Inject(p);
+			}
+		}
+
+		from.security->PopPacketsToRecv(count);
+		return true;
+	}
+
+	//Handles the server connection
+	void HandleConnect(const std::string & IP, uint16_t port, const boost::system::error_code & error)
+	{
+		//Error check
+		if(error)
+		{
+			if(error != boost::asio::error::operation_aborted)
+			{
+				std::cout << "[Error] Unable to connect to " << IP << ":" << port << std::endl;
+				std::cout << error.message() << std::endl;
+			}
+
+			//Silkroad connection is no longer needed
+			Close();
+			Finish();
+			return;
+		}
+
+		//Packets are processed as soon as they arrive. A plain pointer keeps the handler small enough to copy
+		//without allocating, the connections are closed (which clears it) before the session goes away.
+		Silkroad->OnReceive = boost::bind(&Session::HandleReceive, this);
+		Joymax->OnReceive = boost::bind(&Session::HandleReceive, this);
 
-	//Data
-	std::vector<uint8_t> data;
+		//Stop reading from one side while the other cannot keep up
+		Silkroad->OnDrained = boost::bind(&SilkroadConnection::ResumeRead, Joymax);
+		Joymax->OnDrained = boost::bind(&SilkroadConnection::ResumeRead, Silkroad);
 
-	//Handles incoming packets
-	void HandleRead(size_t bytes_transferred, const boost::system::error_code & error)
+		Silkroad->PostRead();
+		Joymax->PostRead();
+
+		//Send the handshake
+		Flush(*Silkroad);
+	}
+
+	//Removes the session from the network
+	void Finish()
 	{
-		if(!error && s && security)
+		if(OnFinished)
 		{
-			security->Recv(&data[0], bytes_transferred);
-			PostRead();
+			//Copy so the handler outlives its own removal
+			boost::function<void(uint32_t)> handler = OnFinished;
+			OnFinished.clear();
+			handler(id);
 		}
 	}
 
+	//Packets arrived on either connection
+	void HandleReceive()
+	{
+		//Finishing removes the session from the network
+		boost::shared_ptr<Session> self = shared_from_this();
+
+		if(!ProcessPackets())
+			Finish();
+	}
+
 public:
 
-	//Security
-	boost::shared_ptr<SilkroadSecurity> security;
+	//Called once the session has finished
+	boost::function<void(uint32_t)> OnFinished;
 
 	//Constructor
-	SilkroadConnection()
+	Session(uint32_t id_, boost::asio::io_service & io_service, RedirectTable & redirects_, const boost::shared_ptr<const OpcodeTable> & opcodes_) : id(id_),
+		Silkroad(boost::make_shared<SilkroadConnection>(boost::ref(io_service))), Joymax(boost::make_shared<SilkroadConnection>(boost::ref(io_service))), redirects(redirects_), opcodes(opcodes_)
 	{
-		data.resize(Config::DataMaxSize + 1);
 	}
 
 	//Destructor
-	~SilkroadConnection()
+	~Session()
 	{
 		Close();
 	}
 
-	//Gets everything ready for receiving packets
-	void Initialize(boost::shared_ptr<boost::asio::ip::tcp::socket> s_)
+	//Connects the client to the server
+	void Start(boost::shared_ptr<boost::asio::ip::tcp::socket> s, const std::string & IP, uint16_t port)
 	{
-		s = s_;
-		security = boost::make_shared<SilkroadSecurity>();
-	}
+		//Disable nagle
+		boost::system::error_code ec;
+		s->set_option(boost::asio::ip::tcp::no_delay(true), ec);
 
-	//Starts receiving data
-	void PostRead()
-	{
-		if(s && security)
-		{
-			s->async_read_some(boost::asio::buffer(&data[0], Config::DataMaxSize), boost::bind(&SilkroadConnection::HandleRead, this, boost::asio::placeholders::bytes_transferred, boost::asio::placeholders::error));
-		}
+		Silkroad->Initialize(s);
+		Silkroad->security->GenerateHandshake();
+
+		//Connect to the server, the client is not read from until this finishes
+		std::cout << "[Session " << id << "] Connecting to " << IP << ":" << port << std::endl;
+		Joymax->Connect(IP, port, boost::bind(&Session::HandleConnect, shared_from_this(), IP, port, _1));
 	}
 
-	//Closes the socket
+	//Closes both connections (one that is finishing its writes is kept alive by them and closes itself)
 	void Close()
 	{
-		if(s)
-		{
-			boost::system::error_code ec;
-			s->shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
-			s->close(ec);
-			s.reset();
-		}
-
-		security.reset();
+		if(!Silkroad->IsClosing())
+			Silkroad->Close();
+		if(!Joymax->IsClosing())
+			Joymax->Close();
 	}
 
-	boost::system::error_code Connect(const std::string & IP, uint16_t port)
+	//Sends packets that are currently in the security api
+	void Flush(SilkroadConnection & connection)
 	{
-		//Create the socket
-		s = boost::make_shared<boost::asio::ip::tcp::socket>(io_service);
-
-		boost::system::error_code ec;
-		boost::system::error_code resolve_ec;
-
-		for(uint8_t x = 0; x < 3; ++x)
-		{
-			//Connect
-			s->connect(boost::asio::ip::tcp::endpoint(boost::asio::ip::address::from_string(IP, resolve_ec), port), ec);
-
-			//Probably not a valid IP so it's a hostname
-			if(resolve_ec)
-			{
-				boost::asio::ip::tcp::resolver resolver(io_service);
-				boost::asio::ip::tcp::resolver::query query(boost::asio::ip::tcp::v4(), IP, boost::lexical_cast<std::string>(port));
-				boost::asio::ip::tcp::resolver::iterator iterator = resolver.resolve(query);
-				s->connect(*iterator, ec);
-			}
-
-			//See if there was an error
-			if(!ec) break;
+		connection.Send();
 
-			//Error occurred so wait
-			boost::this_thread::sleep(boost::posix_time::milliseconds(500));
-		}
-
-		if(!ec)
-		{
-			//Create new Silkroad security
-			security = boost::make_shared<SilkroadSecurity>();
-
-			//Disable nagle
-			s->set_option(boost::asio::ip::tcp::no_delay(true));
-		}
-
-		return ec;
+		//Everything that is ready goes out in one write
+		connection.Commit();
 	}
 
-	//Hands packets off to the security API
-	bool Inject(uint16_t opcode, StreamUtility & p, bool encrypted = false)
+	//Ends the session once pending packets have been delivered
+	void Shutdown()
 	{
-		if(security)
-		{
-			security->Send(opcode, p, encrypted ? 1 : 0, 0);
-			return true;
-		}
-
-		return false;
+		Silkroad->CloseAfterWrite();
+		Joymax->CloseAfterWrite();
 	}
 
-	//Hands packets off to the security API
-	bool Inject(uint16_t opcode, bool encrypted = false)
+	//Hands a bot packet to the client
+	void InjectSilkroad(uint16_t opcode, const uint8_t * data, int32_t size, bool encrypted)
 	{
-		if(security)
-		{
-			security->Send(opcode, 0, 0, encrypted ? 1 : 0, 0);
-			return true;
-		}
-
-		return false;
+		if(Silkroad->Inject(opcode, data, size, encrypted))
+			Flush(*Silkroad);
 	}
 
-	//Hands packets off to the security API
-	bool Inject(PacketContainer & container)
+	//Hands a bot packet to the server
+	void InjectJoymax(uint16_t opcode, const uint8_t * data, int32_t size, bool encrypted)
 	{
-		if(security)
-		{
-			security->Send(container.opcode, container.data, container.encrypted, container.massive);
-			return true;
-		}
-
-		return false;
+		if(Joymax->Inject(opcode, data, size, encrypted))
+			Flush(*Joymax);
 	}
 
-	//Sends a formatted packet
-	bool Send(const std::vector<uint8_t> & packet)
+	//Processes and forwards packets, returns false once the session is finished
+	bool ProcessPackets()
 	{
-		if(!s) return false;
+		//The table is only replaced by a posted handler on this thread, so it stays the same for the whole pass
+		if(!ForwardPackets(*Silkroad, *Joymax, 1, *opcodes) || !ForwardPackets(*Joymax, *Silkroad, 0, *opcodes))
+			return false;
 
-		//Send the packet all at once
-		boost::system::error_code ec;
-		boost::asio::write(*s, boost::asio::buffer(&packet[0], packet.size()), boost::asio::transfer_all(), ec);
-		
-		//See if there was an error
-		if(ec)
+		//Send packets that are currently in the security api
+		Flush(*Silkroad);
+		Flush(*Joymax);
+
+		//Either side disconnecting ends the session (after what is already queued has been delivered)
+		if(!Silkroad->IsOpen() || !Joymax->IsOpen())
 		{
-			Close();
+			Shutdown();
 			return false;
 		}
 
+		//Stop reading from a side whose packets cannot be delivered fast enough
+		if(Joymax->IsCongested())
+			Silkroad->PauseRead();
+		if(Silkroad->IsCongested())
+			Joymax->PauseRead();
+
 		return true;
 	}
 };
 
+const Session::Stage Session::Stages[] =
+{
+	{0, Opcode_Massive, &Session::MassiveStage},
+	{1, Opcode_Massive, &Session::MassiveStage},
+	{1, Opcode_Hooked, &Session::IdentityStage},
+	{0, Opcode_Hooked, &Session::RedirectStage}
+};
+
+const size_t Session::StageCount = sizeof(Session::Stages) / sizeof(Session::Stages[0]);
+
+#ifdef SO_REUSEPORT
+//Lets every network thread listen on the same port, the OS spreads new connections between them
+typedef boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT> reuse_port;
+#endif
+
 //Networking class (handles connections)
 class Network
 {
 private:
 
-	//Accepts TCP connections
-	boost::asio::ip::tcp::acceptor acceptor;
+	//One network thread with its own event loop. A session stays on the thread that accepted it and
+	//everything it touches per packet belongs to that thread, so the threads never wait on each other.
+	struct Shard
+	{
+		//Index in shards
+		uint32_t index;
 
-	//Packet processing timer
-	boost::shared_ptr<boost::asio::deadline_timer> timer;
+		//Handles network events
+		boost::asio::io_service io_service;
 
-	//Silkroad connections
-	SilkroadConnection Silkroad;
-	SilkroadConnection Joymax;
+		//Keeps the thread running while it has no sessions (shards without an acceptor would stop at once)
+		boost::shared_ptr<boost::asio::io_service::work> work;
+
+		//Accepts TCP connections (only the first shard has one when the port cannot be shared)
+		boost::shared_ptr<boost::asio::ip::tcp::acceptor> acceptor;
+
+		//Active sessions
+		std::map<uint32_t, boost::shared_ptr<Session> > sessions;
+
+		//The opcode table its sessions read, a copy of the pointer only this thread touches
+		boost::shared_ptr<const OpcodeTable> opcodes;
+
+		Shard(uint32_t index_) : index(index_), opcodes(Opcodes.Load())
+		{
+		}
+	};
+
+	//Network threads
+	std::vector<boost::shared_ptr<Shard> > shards;
+
+	//Every shard listens on the port, otherwise the first one accepts for all of them
+	bool shared_port;
+
+	//Next shard to hand a connection to when only the first shard accepts
+	uint32_t next_shard;
+
+	//Every active session and the shard it belongs to (only used when sessions start and end and for bot injects)
+	std::map<uint32_t, uint32_t> owners;
+
+	//Next session ID
+	uint32_t next_session;
+
+	boost::mutex owners_mutex;
+
+	//Agent server redirects
+	RedirectTable redirects;
+
+	//Opens an acceptor on a shard
+	void Listen(Shard & shard, uint16_t port)
+	{
+		boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::tcp::v4(), port);
+
+		shard.acceptor = boost::make_shared<boost::asio::ip::tcp::acceptor>(shard.io_service);
+		shard.acceptor->open(endpoint.protocol());
+		shard.acceptor->set_option(boost::asio::ip::tcp::acceptor::reuse_address(true));
+#ifdef SO_REUSEPORT
+		if(shared_port)
+			shard.acceptor->set_option(reuse_port(true));
+#endif
+		shard.acceptor->bind(endpoint);
+		shard.acceptor->listen();
+	}
+
+	//Opens the acceptors, every shard gets one when the port can be shared. Throws if the port is taken.
+	void ListenAll(uint16_t port)
+	{
+#ifdef SO_REUSEPORT
+		if(shards.size() > 1)
+		{
+			//Bind once without SO_REUSEPORT first. Another program listening on the port with it set
+			//would otherwise silently get part of the connections instead of failing the bind.
+			boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::tcp::v4(), port);
+			boost::asio::ip::tcp::acceptor probe(shards[0]->io_service);
+			probe.open(endpoint.protocol());
+			probe.set_option(boost::asio::ip::tcp::acceptor::reuse_address(true));
+			probe.bind(endpoint);
+
+			//Older kernels do not support it, the first shard accepts for everyone then
+			boost::system::error_code ec;
+			probe.set_option(reuse_port(true), ec);
+			shared_port = !ec;
+		}
+#endif
+		//Every acceptor is open before any of them accepts
+		for(size_t x = 0; x < (shared_port ? shards.size() : 1); ++x)
+			Listen(*shards[x], port);
+	}
 
 	//Starts accepting new connections
-	void PostAccept(uint32_t count = 1)
+	void PostAccept(Shard & shard, uint32_t count = 1)
 	{
 		for(uint32_t x = 0; x < count; ++x)
 		{
+			//A shard with its own acceptor keeps its connections, otherwise they are handed out in turn
+			Shard & target = shared_port ? shard : *shards[next_shard++ % shards.size()];
+
 			//The newly created socket will be used when something connects
-			boost::shared_ptr<boost::asio::ip::tcp::socket> s(boost::make_shared<boost::asio::ip::tcp::socket>(io_service));
-			acceptor.async_accept(*s, boost::bind(&Network::HandleAccept, this, s, boost::asio::placeholders::error));
+			boost::shared_ptr<boost::asio::ip::tcp::socket> s(boost::make_shared<boost::asio::ip::tcp::socket>(target.io_service));
+			shard.acceptor->async_accept(*s, boost::bind(&Network::HandleAccept, this, boost::ref(shard), boost::ref(target), s, boost::asio::placeholders::error));
 		}
 	}
-	
+
 	//Handles new connections
-	void HandleAccept(boost::shared_ptr<boost::asio::ip::tcp::socket> s, const boost::system::error_code & error)
+	void HandleAccept(Shard & shard, Shard & target, boost::shared_ptr<boost::asio::ip::tcp::socket> s, const boost::system::error_code & error)
 	{
 		//Error check
 		if(!error)
 		{
-			//Close active connections
-			Silkroad.Close();
-			Joymax.Close();
-
-			//Disable nagle
-			s->set_option(boost::asio::ip::tcp::no_delay(true));
+			//The session is started on the thread it belongs to
+			target.io_service.dispatch(boost::bind(&Network::StartSession, this, boost::ref(target), s));
 
-			Silkroad.Initialize(s);
-			Silkroad.security->GenerateHandshake();
+			//Post another accept
+			PostAccept(shard);
+		}
+	}
 
-			//Connect to the gateway server
-			std::cout << "Connecting to " << (AgentConnect ? AgentIP : Config::GatewayIP) << ":" << (AgentConnect ? AgentPort : Config::GatewayPort) << std::endl;
-			boost::system::error_code ec = Joymax.Connect(AgentConnect ? AgentIP : Config::GatewayIP, AgentConnect ? AgentPort : Config::GatewayPort);
+	//Creates a session for a new connection
+	void StartSession(Shard & shard, boost::shared_ptr<boost::asio::ip::tcp::socket> s)
+	{
+		//Agent server reconnects arrive on the loopback address from their 0xA102
+		std::string IP = Config::GatewayIP;
+		uint16_t port = Config::GatewayPort;
 
-			//Error check
-			if(ec)
-			{
-				std::cout << "[Error] Unable to connect to " << (AgentConnect ? AgentIP : Config::GatewayIP) << ":" << (AgentConnect ? AgentPort : Config::GatewayPort) << std::endl;
-				std::cout << ec.message() << std::endl;
+		boost::system::error_code ec;
+		boost::asio::ip::tcp::endpoint local = s->local_endpoint(ec);
+		if(!ec)
+			redirects.Take(local.address().to_string(), IP, port);
 
-				//Silkroad connection is no longer needed
-				Silkroad.Close();
-			}
-			else
-			{
-				Silkroad.PostRead();
-				Joymax.PostRead();
-			}
+		uint32_t id;
+		{
+			boost::mutex::scoped_lock lock(owners_mutex);
 
-			//Next connection goes to the gateway server
-			AgentConnect = false;
+			id = next_session++;
+			if(next_session == 0) next_session = 1;
 
-			//Post another accept
-			PostAccept();
+			owners[id] = shard.index;
 		}
+
+		boost::shared_ptr<Session> session = boost::make_shared<Session>(id, boost::ref(shard.io_service), boost::ref(redirects), boost::cref(shard.opcodes));
+		session->OnFinished = boost::bind(&Network::RemoveSession, this, boost::ref(shard), _1);
+		shard.sessions[id] = session;
+		session->Start(s, IP, port);
 	}
 
-	void ProcessPackets(const boost::system::error_code & error)
+	//Finds the shard a session belongs to for a bot inject (0 is the most recent session)
+	bool FindShard(uint32_t & id, uint32_t & index)
 	{
-		if(!error)
-		{
-			if(Silkroad.security)
-			{
-				while(Silkroad.security->HasPacketToRecv())
-				{
-					bool forward = true;
+		boost::mutex::scoped_lock lock(owners_mutex);
 
-					//Retrieve the packet out of the security api
-					PacketContainer p = Silkroad.security->GetPacketToRecv();
+		if(owners.empty())
+			return false;
 
-					//Check the blocked list
-					if(BlockedOpcodes.find(p.opcode) != BlockedOpcodes.end())
-						forward = false;
+		std::map<uint32_t, uint32_t>::iterator itr = id == 0 ? --owners.end() : owners.find(id);
+		if(itr == owners.end())
+			return false;
 
-					if(p.opcode == 0x2001)
-					{
-						std::cout << "Connected" << std::endl;
-						forward = false;
-					}
+		id = itr->first;
+		index = itr->second;
+		return true;
+	}
 
-					//Forward the packet to Joymax
-					if(forward && Joymax.security)
-					{
-						Bot->Send(p, 1);
-						Joymax.Inject(p);
-					}
-				}
+	//Hands a new opcode table to every shard. It is posted (never run inline), so a session in the
+	//middle of a pass keeps the table it started with.
+	void PublishOpcodes(boost::shared_ptr<const OpcodeTable> opcodes)
+	{
+		for(size_t x = 0; x < shards.size(); ++x)
+			shards[x]->io_service.post(boost::bind(&Network::SetOpcodes, this, boost::ref(*shards[x]), opcodes));
+	}
 
-				//Send packets that are currently in the security api
-				while(Silkroad.security->HasPacketToSend())
-				{
-					if(!Silkroad.Send(Silkroad.security->GetPacketToSend()))
-						break;
-				}
-			}
+	//Swaps in a published opcode table on the shard's own thread
+	void SetOpcodes(Shard & shard, boost::shared_ptr<const OpcodeTable> opcodes)
+	{
+		shard.opcodes = opcodes;
+	}
 
-			if(Joymax.security)
-			{
-				while(Joymax.security->HasPacketToRecv())
-				{
-					bool forward = true;
+	//Hands a bot packet to a session on its own thread
+	void Inject(uint32_t id, uint16_t opcode, const uint8_t * data, int32_t size, bool encrypted, bool joymax)
+	{
+		//Bot frames can carry more than fits in one packet
+		if(size > MAX_PACKET_SIZE)
+		{
+			std::cout << "[Error] Injected packet 0x" << std::hex << std::setfill('0') << std::setw(4) << opcode << std::dec << " is too large (" << size << " bytes)" << std::endl;
+			return;
+		}
 
-					//Retrieve the packet out of the security api
-					PacketContainer p = Joymax.security->GetPacketToRecv();
+		uint32_t index;
+		if(!FindShard(id, index))
+			return;
 
-					//Check the blocked list
-					if(BlockedOpcodes.find(p.opcode) != BlockedOpcodes.end())
-						forward = false;
+		//The bot's receive buffer is reused once this returns
+		boost::shared_ptr<std::vector<uint8_t> > packet = boost::make_shared<std::vector<uint8_t> >(data, data + size);
+		shards[index]->io_service.dispatch(boost::bind(&Network::HandleInject, this, boost::ref(*shards[index]), id, opcode, packet, encrypted, joymax));
+	}
 
-					if(p.opcode == 0xA102)
-					{
-						StreamUtility & r = p.data;
-						if(r.Read<uint8_t>() == 1)
-						{
-							//Do not forward the packet to Joymax, we need to replace the agent server data
-							forward = false;
-							
-							//The next connection will go to the agent server
-							AgentConnect = true;
-
-							uint32_t LoginID = r.Read<uint32_t>();				//Login ID
-							AgentIP = r.Read_Ascii(r.Read<uint16_t>());			//Agent IP
-							AgentPort = r.Read<uint16_t>();						//Agent port
-
-							StreamUtility w;
-							w.Write<uint8_t>(1);								//Success flag
-							w.Write<uint32_t>(LoginID);							//Login ID
-							w.Write<uint16_t>(9);								//Length of 127.0.0.1
-							w.Write_Ascii("127.0.0.1");							//IP
-							w.Write<uint16_t>(Config::BindPort);				//Port
-
-							//Inject the packet
-							Silkroad.Inject(p.opcode, w);
-
-							//Inject the packet immediately
-							while(Silkroad.security->HasPacketToSend())
-								Silkroad.Send(Silkroad.security->GetPacketToSend());
-
-							//Close active connections
-							Silkroad.Close();
-							Joymax.Close();
-
-							//Security pointer is now valid so skip to the end
-							goto Post;
-						}
-					}
+	void HandleInject(Shard & shard, uint32_t id, uint16_t opcode, boost::shared_ptr<std::vector<uint8_t> > packet, bool encrypted, bool joymax)
+	{
+		//The session may have finished in the meantime
+		std::map<uint32_t, boost::shared_ptr<Session> >::iterator itr = shard.sessions.find(id);
+		if(itr == shard.sessions.end())
+			return;
+
+		const uint8_t * data = packet->empty() ? 0 : &(*packet)[0];
+		int32_t size = static_cast<int32_t>(packet->size());
+
+		if(joymax)
+			itr->second->InjectJoymax(opcode, data, size, encrypted);
+		else
+			itr->second->InjectSilkroad(opcode, data, size, encrypted);
+	}
 
-					//Forward the packet to Silkroad
-					if(forward && Silkroad.security)
-					{
-						Bot->Send(p, 0);
-						Silkroad.Inject(p);
-					}
-				}
+	void InjectSilkroad(uint32_t id, uint16_t opcode, const uint8_t * data, int32_t size, bool encrypted)
+	{
+		Inject(id, opcode, data, size, encrypted, false);
+	}
 
-				//Send packets that are currently in the security api
-				while(Joymax.security->HasPacketToSend())
-				{
-					if(!Joymax.Send(Joymax.security->GetPacketToSend()))
-						break;
-				}
-			}
+	void InjectJoymax(uint32_t id, uint16_t opcode, const uint8_t * data, int32_t size, bool encrypted)
+	{
+		Inject(id, opcode, data, size, encrypted, true);
+	}
 
-Post:
-			//Repost the timer
-			timer->expires_from_now(boost::posix_time::milliseconds(PACKET_PROCESS_DELAY));
-			timer->async_wait(boost::bind(&Network::ProcessPackets, this, boost::asio::placeholders::error));
-		}
+	//Removes a finished session
+	void RemoveSession(Shard & shard, uint32_t id)
+	{
+		shard.sessions.erase(id);
+
+		boost::mutex::scoped_lock lock(owners_mutex);
+		owners.erase(id);
 	}
 
 public:
 
 	//Constructor
-	Network(uint16_t port) : acceptor(io_service, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port)),
-		timer(boost::make_shared<boost::asio::deadline_timer>(io_service))
+	Network(uint16_t port, uint32_t threads) : shared_port(false), next_shard(0), next_session(1)
 	{
+		for(uint32_t x = 0; x < threads; ++x)
+		{
+			shards.push_back(boost::make_shared<Shard>(x));
+			shards[x]->work = boost::make_shared<boost::asio::io_service::work>(boost::ref(shards[x]->io_service));
+		}
+
+		//Every shard listens on the port where the OS can share it, none stays open if one fails
+		try
+		{
+			ListenAll(port);
+		}
+		catch(...)
+		{
+			Stop();
+			throw;
+		}
+
 		//Bind inject functions
-		InjectJoymax = boost::bind(&SilkroadConnection::Inject, &Joymax, _1, _2, _3);
-		InjectSilkroad = boost::bind(&SilkroadConnection::Inject, &Silkroad, _1, _2, _3);
+		::InjectJoymax = boost::bind(&Network::InjectJoymax, this, _1, _2, _3, _4, _5);
+		::InjectSilkroad = boost::bind(&Network::InjectSilkroad, this, _1, _2, _3, _4, _5);
+		::PublishOpcodes = boost::bind(&Network::PublishOpcodes, this, _1);
 
 		//Start accepting connections
-		PostAccept();
-
-		//Post the packet processing timer
-		timer->expires_from_now(boost::posix_time::milliseconds(PACKET_PROCESS_DELAY));
-		timer->async_wait(boost::bind(&Network::ProcessPackets, this, boost::asio::placeholders::error));
+		for(uint32_t x = 0; x < (shared_port ? threads : 1); ++x)
+			PostAccept(*shards[x]);
 	}
 
 	//Destructor
@@ -650,18 +2084,45 @@ public:
 		Stop();
 	}
 
-	//Stops all networking objects
+	//Returns the number of network threads
+	uint32_t GetThreadCount() const
+	{
+		return static_cast<uint32_t>(shards.size());
+	}
+
+	//Returns the event loop a network thread runs
+	boost::asio::io_service & GetService(uint32_t index)
+	{
+		return shards[index]->io_service;
+	}
+
+	//Stops all networking objects (the network threads have to be finished)
 	void Stop()
 	{
-		boost::system::error_code ec;
-		acceptor.close(ec);
-		acceptor.cancel(ec);
+		for(size_t x = 0; x < shards.size(); ++x)
+		{
+			Shard & shard = *shards[x];
+			shard.work.reset();
+
+			boost::system::error_code ec;
+			if(shard.acceptor)
+			{
+				shard.acceptor->close(ec);
+				shard.acceptor->cancel(ec);
+			}
+
+			std::map<uint32_t, boost::shared_ptr<Session> >::iterator itr = shard.sessions.begin();
+			while(itr != shard.sessions.end())
+			{
+				itr->second->Close();
+				++itr;
+			}
 
-		if(timer)
-			timer->cancel(ec);
+			shard.sessions.clear();
+		}
 
-		Silkroad.Close();
-		Joymax.Close();
+		boost::mutex::scoped_lock lock(owners_mutex);
+		owners.clear();
 	}
 };
 
@@ -690,6 +2151,20 @@ int main(int argc, char* argv[])
 			Config::BindPort = pt.get<uint16_t>("phConnector.BindPort");
 			Config::BotBind = pt.get<uint16_t>("phConnector.BotBind");
 			Config::DataMaxSize = pt.get<uint32_t>("phConnector.DataMaxSize");
+			Config::BotQueueSize = pt.get<uint32_t>("phConnector.BotQueueSize", 4 * 1024 * 1024);
+			Config::MassivePassthrough = pt.get<bool>("phConnector.MassivePassthrough", false);
+			Config::NetworkThreads = pt.get<uint32_t>("phConnector.NetworkThreads", 0);
+			Config::HandshakeThreads = pt.get<uint32_t>("phConnector.HandshakeThreads", 2);
+
+			std::string overflow = pt.get<std::string>("phConnector.BotOverflow", "drop");
+			if(overflow == "drop")
+				Config::BotOverflow = Overflow_Drop;
+			else if(overflow == "disconnect")
+				Config::BotOverflow = Overflow_Disconnect;
+			else if(overflow == "coalesce")
+				Config::BotOverflow = Overflow_Coalesce;
+			else
+				throw std::runtime_error("phConnector.BotOverflow must be drop, disconnect or coalesce");
 		}
 		catch(std::exception & e)
 		{
@@ -711,7 +2186,12 @@ int main(int argc, char* argv[])
 		fs << "GatewayPort=15779\n";				//iSRO gateway port
 		fs << "BindPort=15779\n";					//The port phConnector will listen on
 		fs << "BotBind=22580\n";					//The port the bot or analyzer will connect to
-		fs << "DataMaxSize=16384";					//Maximum number of bytes to receive in one packet
+		fs << "DataMaxSize=16384\n";				//Maximum number of bytes to receive in one packet
+		fs << "BotQueueSize=4194304\n";			//Maximum number of bytes queued for one bot
+		fs << "BotOverflow=drop\n";				//drop, disconnect or coalesce packets when a bot's queue is full
+		fs << "MassivePassthrough=0\n";			//Forward massive packet parts as they arrive (1) or reassemble them first (0)
+		fs << "NetworkThreads=0\n";				//Threads that handle connections (0 uses one per core)
+		fs << "HandshakeThreads=2";				//Threads that do handshake crypto (0 does it on the network thread)
 		fs.close();
 
 		//Exit
@@ -724,43 +2204,61 @@ int main(int argc, char* argv[])
 	std::cout << "Redirect Silkroad to 127.0.0.1:" << Config::BindPort << std::endl;
 	std::cout << "Redirect the bot to 127.0.0.1:" << Config::BotBind << std::endl << std::endl;
 
-	//Create the network objects
-	Network network(Config::BindPort);
-	Bot = boost::make_shared<BotConnection>(Config::BotBind);
+	//One network thread per core (hardware_concurrency returns 0 when it cannot tell)
+	if(Config::NetworkThreads == 0)
+		Config::NetworkThreads = boost::thread::hardware_concurrency();
+	if(Config::NetworkThreads == 0)
+		Config::NetworkThreads = 1;
 
-	//Start processing network events
-	while(true)
+	std::cout << "Network: " << Config::NetworkThreads << " thread(s) using " << NetworkBackend() << std::endl << std::endl;
+
+	//Create the network objects, bots are handled on the first network thread
+	boost::shared_ptr<Network> network;
+	try
 	{
-		try
-		{
-			//Run
-			boost::system::error_code ec;
-			io_service.run(ec);
+		network = boost::make_shared<Network>(Config::BindPort, Config::NetworkThreads);
+		Bot = boost::make_shared<BotConnection>(boost::ref(network->GetService(0)), Config::BotBind);
+	}
+	catch(std::exception & e)
+	{
+		//Display error and exit, nothing is left listening
+		std::cout << "[Fatal Error] Could not open the listening ports (BindPort " << Config::BindPort << ", BotBind " << Config::BotBind << ")." << std::endl;
+		std::cout << e.what() << std::endl;
+		network.reset();
+		std::cin.get();
+		return 0;
+	}
 
-			if(ec)
-			{
-				std::cout << "[" << __FUNCTION__ << "]" << "[" << __LINE__ << "] " << ec.message() << std::endl;
-			}
-			else
-			{
-				//No more work
-				break;
-			}
-			
-			//Prevent high CPU usage
-			boost::this_thread::sleep(boost::posix_time::milliseconds(1));
-		}
-		catch(std::exception & e)
-		{
-			std::cout << "[" << __FUNCTION__ << "]" << "[" << __LINE__ << "] " << e.what() << std::endl;
-		}
+	//Start the handshake threads
+	boost::asio::io_service::work handshake_work(handshake_service);
+	boost::thread_group handshake_threads;
+	if(Config::HandshakeThreads)
+	{
+		SilkroadSecurity::StartHandshakePool(HANDSHAKE_POOL_SIZE);
+		for(uint32_t x = 0; x < Config::HandshakeThreads; ++x)
+			handshake_threads.create_thread(RunHandshakeService);
 	}
 
+	//Start processing network events, this thread runs the first network thread's events
+	boost::thread_group network_threads;
+	for(uint32_t x = 1; x < network->GetThreadCount(); ++x)
+		network_threads.create_thread(boost::bind(RunNetworkService, boost::ref(network->GetService(x))));
+	RunNetworkService(network->GetService(0));
+	network_threads.join_all();
+
 	//Cleanup
-	network.Stop();
+	network->Stop();
 	Bot->Stop();
 	Bot.reset();
 
+	handshake_service.stop();
+	handshake_threads.join_all();
+	SilkroadSecurity::StopHandshakePool();
+
+	//Handshakes still queued hold on to connections of the network threads
+	handshake_service.reset();
+	handshake_service.poll();
+
 	return 0;
 }
 
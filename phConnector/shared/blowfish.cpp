@@ -5,6 +5,7 @@
 #define S(x,i)			(SBoxes[i][x.w.byte##i])
 #define bf_F(x)			(((S(x,0) + S(x,1)) ^ S(x,2)) + S(x,3))
 #define ROUND(a,b,n)	(a.dword ^= bf_F(b) ^ PArray[n])
+#define ROUND4(a,b,n)	ROUND(a##0,b##0,n); ROUND(a##1,b##1,n); ROUND(a##2,b##2,n); ROUND(a##3,b##3,n)
 
 #define MAXKEYBYTES 	56		// 448 bits max
 #define NPASS           16		// SBox passes
@@ -225,6 +226,57 @@ void BlowfishPIMPL::Blowfish_decipher( uint32_t * xl, uint32_t * xr )
 	*xr = Xl.dword;
 }
 
+// Enciphers 4 consecutive blocks. ECB blocks are independent, so the rounds of
+// the 4 blocks are interleaved to keep several S-box lookups in flight instead
+// of waiting on a single dependent round chain.
+void BlowfishPIMPL::Blowfish_encipher4( uint32_t * blocks )
+{
+	union aword Xl0, Xr0, Xl1, Xr1, Xl2, Xr2, Xl3, Xr3;
+
+	Xl0.dword = blocks[0] ^ PArray [0];  Xr0.dword = blocks[1];
+	Xl1.dword = blocks[2] ^ PArray [0];  Xr1.dword = blocks[3];
+	Xl2.dword = blocks[4] ^ PArray [0];  Xr2.dword = blocks[5];
+	Xl3.dword = blocks[6] ^ PArray [0];  Xr3.dword = blocks[7];
+
+	ROUND4(Xr, Xl, 1);  ROUND4(Xl, Xr, 2);
+	ROUND4(Xr, Xl, 3);  ROUND4(Xl, Xr, 4);
+	ROUND4(Xr, Xl, 5);  ROUND4(Xl, Xr, 6);
+	ROUND4(Xr, Xl, 7);  ROUND4(Xl, Xr, 8);
+	ROUND4(Xr, Xl, 9);  ROUND4(Xl, Xr, 10);
+	ROUND4(Xr, Xl, 11); ROUND4(Xl, Xr, 12);
+	ROUND4(Xr, Xl, 13); ROUND4(Xl, Xr, 14);
+	ROUND4(Xr, Xl, 15); ROUND4(Xl, Xr, 16);
+
+	blocks[0] = Xr0.dword ^ PArray [17];  blocks[1] = Xl0.dword;
+	blocks[2] = Xr1.dword ^ PArray [17];  blocks[3] = Xl1.dword;
+	blocks[4] = Xr2.dword ^ PArray [17];  blocks[5] = Xl2.dword;
+	blocks[6] = Xr3.dword ^ PArray [17];  blocks[7] = Xl3.dword;
+}
+
+void BlowfishPIMPL::Blowfish_decipher4( uint32_t * blocks )
+{
+	union aword Xl0, Xr0, Xl1, Xr1, Xl2, Xr2, Xl3, Xr3;
+
+	Xl0.dword = blocks[0] ^ PArray [17];  Xr0.dword = blocks[1];
+	Xl1.dword = blocks[2] ^ PArray [17];  Xr1.dword = blocks[3];
+	Xl2.dword = blocks[4] ^ PArray [17];  Xr2.dword = blocks[5];
+	Xl3.dword = blocks[6] ^ PArray [17];  Xr3.dword = blocks[7];
+
+	ROUND4(Xr, Xl, 16);  ROUND4(Xl, Xr, 15);
+	ROUND4(Xr, Xl, 14);  ROUND4(Xl, Xr, 13);
+	ROUND4(Xr, Xl, 12);  ROUND4(Xl, Xr, 11);
+	ROUND4(Xr, Xl, 10);  ROUND4(Xl, Xr, 9);
+	ROUND4(Xr, Xl, 8);   ROUND4(Xl, Xr, 7);
+	ROUND4(Xr, Xl, 6);   ROUND4(Xl, Xr, 5);
+	ROUND4(Xr, Xl, 4);   ROUND4(Xl, Xr, 3);
+	ROUND4(Xr, Xl, 2);   ROUND4(Xl, Xr, 1);
+
+	blocks[0] = Xr0.dword ^ PArray [0];  blocks[1] = Xl0.dword;
+	blocks[2] = Xr1.dword ^ PArray [0];  blocks[3] = Xl1.dword;
+	blocks[4] = Xr2.dword ^ PArray [0];  blocks[5] = Xl2.dword;
+	blocks[6] = Xr3.dword ^ PArray [0];  blocks[7] = Xl3.dword;
+}
+
 // constructs the encryption sieve
 bool BlowfishPIMPL::Initialize( const void * const key_ptr, int32_t key_size )
 {
@@ -429,6 +481,52 @@ bool BlowfishPIMPL::Decode( const void * const input_ptr, int32_t input_size, vo
 	return true;
 }
 
+// Encode a span of whole blocks in place. The checks are done once up front so
+// the loop itself is nothing but the cipher rounds, 4 blocks at a time while
+// there are enough of them left.
+bool BlowfishPIMPL::EncodeBlocks( void * data_ptr, int32_t data_size )
+{
+	if( !data_ptr || data_size < 0 || data_size % 8 != 0 )
+	{
+		return false;
+	}
+
+	uint32_t * block = reinterpret_cast< uint32_t * >( data_ptr );
+	uint32_t * end = block + data_size / 4;
+	uint32_t * end4 = block + ( data_size / 32 ) * 8;
+	for( ; block != end4; block += 8 )
+	{
+		Blowfish_encipher4( block );
+	}
+	for( ; block != end; block += 2 )
+	{
+		Blowfish_encipher( block, block + 1 );
+	}
+	return true;
+}
+
+// Decode a span of whole blocks in place
+bool BlowfishPIMPL::DecodeBlocks( void * data_ptr, int32_t data_size )
+{
+	if( !data_ptr || data_size < 0 || data_size % 8 != 0 )
+	{
+		return false;
+	}
+
+	uint32_t * block = reinterpret_cast< uint32_t * >( data_ptr );
+	uint32_t * end = block + data_size / 4;
+	uint32_t * end4 = block + ( data_size / 32 ) * 8;
+	for( ; block != end4; block += 8 )
+	{
+		Blowfish_decipher4( block );
+	}
+	for( ; block != end; block += 2 )
+	{
+		Blowfish_decipher( block, block + 1 );
+	}
+	return true;
+}
+
 //-----------------------------------------------------------------------------
 
 Blowfish::Blowfish()
@@ -459,4 +557,14 @@ bool Blowfish::Decode( const void * const input_ptr, int32_t input_size, void *
 	return m_BlowfishPIMPL.Decode( input_ptr, input_size, output_ptr, output_size );
 }
 
+bool Blowfish::EncodeBlocks( void * data_ptr, int32_t data_size )
+{
+	return m_BlowfishPIMPL.EncodeBlocks( data_ptr, data_size );
+}
+
+bool Blowfish::DecodeBlocks( void * data_ptr, int32_t data_size )
+{
+	return m_BlowfishPIMPL.DecodeBlocks( data_ptr, data_size );
+}
+
 //-----------------------------------------------------------------------------
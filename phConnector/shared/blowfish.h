@@ -36,10 +36,14 @@ struct BlowfishPIMPL
 
 	void Blowfish_encipher( uint32_t * xl, uint32_t * xr );
 	void Blowfish_decipher( uint32_t * xl, uint32_t * xr );
+	void Blowfish_encipher4( uint32_t * blocks );
+	void Blowfish_decipher4( uint32_t * blocks );
 	bool Initialize( const void * const key_ptr, int32_t key_size );
 	int32_t GetOutputLength( int32_t input_size );
 	bool Encode( void const * const input_ptr, int32_t input_size, void * output_ptr, int32_t output_size );
 	bool Decode( const void * const input_ptr, int32_t input_size, void * output_ptr, int32_t output_size );
+	bool EncodeBlocks( void * data_ptr, int32_t data_size );
+	bool DecodeBlocks( void * data_ptr, int32_t data_size );
 };
 
 //-----------------------------------------------------------------------------
@@ -66,6 +70,8 @@ public:
 	// sizes, or invalid parameters) and true on success.
 	bool Encode( const void * const input_ptr, int32_t input_size, void * output_ptr, int32_t output_size );
 	bool Decode( const void * const input_ptr, int32_t input_size, void * output_ptr, int32_t output_size );
+	bool EncodeBlocks( void * data_ptr, int32_t data_size );
+	bool DecodeBlocks( void * data_ptr, int32_t data_size );
 };
 
 //-----------------------------------------------------------------------------
@@ -0,0 +1,104 @@
+#include "buffer_pool.h"
+#include <boost/thread/tss.hpp>
+
+//-----------------------------------------------------------------------------
+
+// Smallest class and the number of classes, each one is twice the size of the
+// previous one (4KB up to 256KB)
+#define BUFFER_CLASS_MIN 0x1000
+#define BUFFER_CLASSES 7
+
+// Bytes a thread keeps on each free list, larger classes keep fewer buffers
+#define BUFFER_CLASS_BYTES 0x40000
+
+//-----------------------------------------------------------------------------
+
+namespace
+{
+	// Free buffers of one thread, one list per class
+	struct FreeLists
+	{
+		std::vector< std::vector< uint8_t > > lists[ BUFFER_CLASSES ];
+
+		FreeLists()
+		{
+			// The lists never grow past this so the buffers in them are never copied
+			for( int x = 0; x < BUFFER_CLASSES; ++x )
+			{
+				lists[ x ].reserve( BUFFER_CLASS_BYTES / ( BUFFER_CLASS_MIN << x ) );
+			}
+		}
+	};
+
+	boost::thread_specific_ptr< FreeLists > ThreadFreeLists;
+
+	FreeLists & GetFreeLists()
+	{
+		FreeLists * free_lists = ThreadFreeLists.get();
+		if( free_lists == 0 )
+		{
+			free_lists = new FreeLists;
+			ThreadFreeLists.reset( free_lists );
+		}
+		return *free_lists;
+	}
+
+	// Returns the class index for size bytes or -1 if no class is large enough
+	int GetClass( size_t size )
+	{
+		size_t class_size = BUFFER_CLASS_MIN;
+		for( int x = 0; x < BUFFER_CLASSES; ++x )
+		{
+			if( size <= class_size )
+			{
+				return x;
+			}
+			class_size <<= 1;
+		}
+		return -1;
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+void BufferPool::Borrow( std::vector< uint8_t > & buffer, size_t size )
+{
+	int index = GetClass( size );
+	if( index == -1 )
+	{
+		std::vector< uint8_t >( size ).swap( buffer );
+		return;
+	}
+
+	std::vector< std::vector< uint8_t > > & list = GetFreeLists().lists[ index ];
+	if( list.empty() )
+	{
+		std::vector< uint8_t >( BUFFER_CLASS_MIN << index ).swap( buffer );
+	}
+	else
+	{
+		list.back().swap( buffer );
+		list.pop_back();
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+void BufferPool::Release( std::vector< uint8_t > & buffer )
+{
+	int index = GetClass( buffer.size() );
+	if( index != -1 && buffer.size() == static_cast< size_t >( BUFFER_CLASS_MIN << index ) )
+	{
+		std::vector< std::vector< uint8_t > > & list = GetFreeLists().lists[ index ];
+		if( list.size() < list.capacity() )
+		{
+			list.push_back( std::vector< uint8_t >() );
+			list.back().swap( buffer );
+			return;
+		}
+	}
+
+	std::vector< uint8_t >().swap( buffer );
+}
+
+//-----------------------------------------------------------------------------
@@ -0,0 +1,36 @@
+#pragma once
+
+#ifndef BUFFER_POOL_H_
+#define BUFFER_POOL_H_
+
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <cstddef>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+
+// Receive buffers shared by every connection on a thread. Buffers come in size
+// classes that double from 4KB, so a connection only holds memory while it has
+// data to frame and takes a larger class when its traffic needs one. Each
+// thread keeps its own free lists, nothing here is locked.
+class BufferPool
+{
+private:
+	BufferPool();
+
+public:
+	// Replaces buffer (which should be empty) with one of at least size bytes.
+	// The new buffer is resized to its whole class and its contents are not
+	// cleared. Sizes above the largest class are allocated without the pool.
+	static void Borrow( std::vector< uint8_t > & buffer, size_t size );
+
+	// Gives the buffer back to this thread's free list and leaves it empty.
+	// Buffers that do not match a class or do not fit the list are freed.
+	static void Release( std::vector< uint8_t > & buffer );
+};
+
+//-----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,111 @@
+#pragma once
+
+#ifndef HANDLER_MEMORY_H_
+#define HANDLER_MEMORY_H_
+
+//-----------------------------------------------------------------------------
+
+#include <boost/aligned_storage.hpp>
+#include <cstddef>
+#include <new>
+
+//-----------------------------------------------------------------------------
+
+// Memory for one asynchronous operation at a time. Something that never has
+// more than one read (or write) in flight hands the same block to each of them
+// instead of going through the heap. Operations that do not fit, or overlap
+// the one using the block, fall back to operator new.
+class HandlerMemory
+{
+private:
+	boost::aligned_storage< 512 > m_storage;
+	bool m_in_use;
+
+private:
+	HandlerMemory( const HandlerMemory & rhs );
+	HandlerMemory & operator =( const HandlerMemory & rhs );
+
+public:
+	HandlerMemory()
+		: m_in_use( false )
+	{
+	}
+
+	void * Allocate( std::size_t size )
+	{
+		if( !m_in_use && size <= sizeof( m_storage ) )
+		{
+			m_in_use = true;
+			return m_storage.address();
+		}
+		return ::operator new( size );
+	}
+
+	void Deallocate( void * pointer )
+	{
+		if( pointer == m_storage.address() )
+		{
+			m_in_use = false;
+		}
+		else
+		{
+			::operator delete( pointer );
+		}
+	}
+};
+
+//-----------------------------------------------------------------------------
+
+// Wraps a completion handler so asio allocates its operation from a
+// HandlerMemory block. The block has to outlive the operation.
+template < typename Handler >
+class MemoryHandler
+{
+private:
+	HandlerMemory & m_memory;
+	Handler m_handler;
+
+public:
+	MemoryHandler( HandlerMemory & memory, const Handler & handler )
+		: m_memory( memory ), m_handler( handler )
+	{
+	}
+
+	void operator()()
+	{
+		m_handler();
+	}
+
+	template < typename Arg1 >
+	void operator()( const Arg1 & arg1 )
+	{
+		m_handler( arg1 );
+	}
+
+	template < typename Arg1, typename Arg2 >
+	void operator()( const Arg1 & arg1, const Arg2 & arg2 )
+	{
+		m_handler( arg1, arg2 );
+	}
+
+	friend void * asio_handler_allocate( std::size_t size, MemoryHandler< Handler > * handler )
+	{
+		return handler->m_memory.Allocate( size );
+	}
+
+	friend void asio_handler_deallocate( void * pointer, std::size_t /*size*/, MemoryHandler< Handler > * handler )
+	{
+		handler->m_memory.Deallocate( pointer );
+	}
+};
+
+// Returns the handler wrapped so it uses the memory block
+template < typename Handler >
+inline MemoryHandler< Handler > UseMemory( HandlerMemory & memory, const Handler & handler )
+{
+	return MemoryHandler< Handler >( memory, handler );
+}
+
+//-----------------------------------------------------------------------------
+
+#endif
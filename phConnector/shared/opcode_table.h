@@ -0,0 +1,108 @@
+#pragma once
+
+#ifndef OPCODE_TABLE_H_
+#define OPCODE_TABLE_H_
+
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <cstring>
+#include <boost/shared_ptr.hpp>
+
+//-----------------------------------------------------------------------------
+
+// Attribute bits kept for every opcode
+enum OpcodeAttribute
+{
+	Opcode_Blocked = 1,				// Dropped instead of forwarded
+	Opcode_Encrypted = 2,			// Sent encrypted when the mode only has security bytes
+	Opcode_MirrorToClient = 4,		// A bot wants it on the way to the client
+	Opcode_MirrorToServer = 8,		// A bot wants it on the way to the server
+	Opcode_Massive = 16,			// Carries a part of a massive packet
+	Opcode_Hooked = 32				// Has special handling before it is forwarded
+};
+
+//-----------------------------------------------------------------------------
+
+// Flat table of attribute bits indexed directly by opcode
+class OpcodeTable
+{
+private:
+	uint8_t m_attributes[ 0x10000 ];
+
+public:
+	OpcodeTable()
+	{
+		memset( m_attributes, 0, sizeof( m_attributes ) );
+	}
+
+	uint8_t Get( uint16_t opcode ) const
+	{
+		return m_attributes[ opcode ];
+	}
+
+	void Set( uint16_t opcode, uint8_t attributes )
+	{
+		m_attributes[ opcode ] |= attributes;
+	}
+
+	void Clear( uint16_t opcode, uint8_t attributes )
+	{
+		m_attributes[ opcode ] &= ~attributes;
+	}
+
+	// Both ends of the range are included
+	void SetRange( uint16_t first, uint16_t last, uint8_t attributes )
+	{
+		for( uint32_t opcode = first; opcode <= last; ++opcode )
+		{
+			m_attributes[ opcode ] |= attributes;
+		}
+	}
+
+	void ClearRange( uint16_t first, uint16_t last, uint8_t attributes )
+	{
+		for( uint32_t opcode = first; opcode <= last; ++opcode )
+		{
+			m_attributes[ opcode ] &= ~attributes;
+		}
+	}
+};
+
+//-----------------------------------------------------------------------------
+
+// Publishes opcode tables to readers on any thread. A published table is never
+// changed again; writers copy the current one, change the copy and store it.
+// Load and Store go through boost's shared_ptr atomic functions, which share
+// one spinlock, so a reader can wait on a writer and every Load changes a
+// reference count other threads also touch. Keep Load off per packet paths.
+// Writers have to be serialized by the caller.
+class SharedOpcodeTable
+{
+private:
+	boost::shared_ptr< const OpcodeTable > m_table;
+
+private:
+	SharedOpcodeTable( const SharedOpcodeTable & rhs );
+	SharedOpcodeTable & operator =( const SharedOpcodeTable & rhs );
+
+public:
+	explicit SharedOpcodeTable( const boost::shared_ptr< const OpcodeTable > & table )
+		: m_table( table )
+	{
+	}
+
+	boost::shared_ptr< const OpcodeTable > Load() const
+	{
+		return boost::atomic_load( &m_table );
+	}
+
+	void Store( const boost::shared_ptr< const OpcodeTable > & table )
+	{
+		boost::atomic_store( &m_table, table );
+	}
+};
+
+//-----------------------------------------------------------------------------
+
+#endif
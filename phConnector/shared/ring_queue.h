@@ -0,0 +1,112 @@
+#pragma once
+
+#ifndef RING_QUEUE_H_
+#define RING_QUEUE_H_
+
+//-----------------------------------------------------------------------------
+
+#include <boost/move/move.hpp>
+#include <cstddef>
+
+//-----------------------------------------------------------------------------
+
+// Fixed capacity queue that only grows when it runs full. Slots are never
+// destroyed when popped, so whatever memory an element owns is reused by the
+// next element pushed into that slot. Callers reset the slot they are given.
+template < typename type >
+class RingQueue
+{
+private:
+	type * m_slots;
+	size_t m_capacity;
+	size_t m_head;
+	size_t m_count;
+
+private:
+	RingQueue( const RingQueue & rhs );
+	RingQueue & operator =( const RingQueue & rhs );
+
+	// Doubles the capacity, moving the elements over in order
+	void Grow()
+	{
+		type * slots = new type[ m_capacity * 2 ];
+		for( size_t x = 0; x < m_count; ++x )
+		{
+			slots[ x ] = boost::move( m_slots[ ( m_head + x ) & ( m_capacity - 1 ) ] );
+		}
+		delete [] m_slots;
+		m_slots = slots;
+		m_capacity *= 2;
+		m_head = 0;
+	}
+
+public:
+	// The capacity must be a power of two
+	explicit RingQueue( size_t capacity = 16 )
+		: m_slots( new type[ capacity ] ), m_capacity( capacity ), m_head( 0 ), m_count( 0 )
+	{
+	}
+
+	~RingQueue()
+	{
+		delete [] m_slots;
+	}
+
+	bool empty() const
+	{
+		return m_count == 0;
+	}
+
+	size_t size() const
+	{
+		return m_count;
+	}
+
+	type & operator []( size_t index )
+	{
+		return m_slots[ ( m_head + index ) & ( m_capacity - 1 ) ];
+	}
+
+	type & front()
+	{
+		return m_slots[ m_head ];
+	}
+
+	type & back()
+	{
+		return ( *this )[ m_count - 1 ];
+	}
+
+	// Returns the slot added to the back of the queue
+	type & push_back()
+	{
+		if( m_count == m_capacity )
+		{
+			Grow();
+		}
+		++m_count;
+		return back();
+	}
+
+	// Returns the slot added to the front of the queue
+	type & push_front()
+	{
+		if( m_count == m_capacity )
+		{
+			Grow();
+		}
+		m_head = ( m_head - 1 ) & ( m_capacity - 1 );
+		++m_count;
+		return front();
+	}
+
+	void pop_front()
+	{
+		m_head = ( m_head + 1 ) & ( m_capacity - 1 );
+		--m_count;
+	}
+};
+
+//-----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,8458 @@
+#include "security_table.h"
+
+//-----------------------------------------------------------------------------
+
+// Defined once here, every file that includes the header shares this copy
+const uint32_t SecurityTable[ 0x10000 ] =
+{
+	// Seed 0x00
+	0x00000000, 0x1C7AA1FF, 0x38F543FE, 0x248FE201, 0x71EA87FC, 0x6D902603, 0x491FC402, 0x556565FD,
+	0xE3D50FF8, 0xFFAFAE07, 0xDB204C06, 0xC75AEDF9, 0x923F8804, 0x8E4529FB, 0xAACACBFA, 0xB6B06A05,
+	0xEABDB293, 0xF6C7136C, 0xD248F16D, 0xCE325092, 0x9B57356F, 0x872D9490, 0xA3A27691, 0xBFD8D76E,
+	0x0968BD6B, 0x15121C94, 0x319DFE95, 0x2DE75F6A, 0x78823A97, 0x64F89B68, 0x40777969, 0x5C0DD896,
+	0xF86CC845, 0xE41669BA, 0xC0998BBB, 0xDCE32A44, 0x89864FB9, 0x95FCEE46, 0xB1730C47, 0xAD09ADB8,
+	0x1BB9C7BD, 0x07C36642, 0x234C8443, 0x3F3625BC, 0x6A534041, 0x7629E1BE, 0x52A603BF, 0x4EDCA240,
+	0x12D17AD6, 0x0EABDB29, 0x2A243928, 0x365E98D7, 0x633BFD2A, 0x7F415CD5, 0x5BCEBED4, 0x47B41F2B,
+	0xF104752E, 0xED7ED4D1, 0xC9F136D0, 0xD58B972F, 0x80EEF2D2, 0x9C94532D, 0xB81BB12C, 0xA46110D3,
+	0xDDCE3DE9, 0xC1B49C16, 0xE53B7E17, 0xF941DFE8, 0xAC24BA15, 0xB05E1BEA, 0x94D1F9EB, 0x88AB5814,
+	0x3E1B3211, 0x226193EE, 0x06EE71EF, 0x1A94D010, 0x4FF1B5ED, 0x538B1412, 0x7704F613, 0x6B7E57EC,
+	0x37738F7A, 0x2B092E85, 0x0F86CC84, 0x13FC6D7B, 0x46990886, 0x5AE3A979, 0x7E6C4B78, 0x6216EA87,
+	0xD4A68082, 0xC8DC217D, 0xEC53C37C, 0xF0296283, 0xA54C077E, 0xB936A681, 0x9DB94480, 0x81C3E57F,
+	0x25A2F5AC, 0x39D85453, 0x1D57B652, 0x012D17AD, 0x54487250, 0x4832D3AF, 0x6CBD31AE, 0x70C79051,
+	0xC677FA54, 0xDA0D5BAB, 0xFE82B9AA, 0xE2F81855, 0xB79D7DA8, 0xABE7DC57, 0x8F683E56, 0x93129FA9,
+	0xCF1F473F, 0xD365E6C0, 0xF7EA04C1, 0xEB90A53E, 0xBEF5C0C3, 0xA28F613C, 0x8600833D, 0x9A7A22C2,
+	0x2CCA48C7, 0x30B0E938, 0x143F0B39, 0x0845AAC6, 0x5D20CF3B, 0x415A6EC4, 0x65D58CC5, 0x79AF2D3A,
+	0x968BD6B1, 0x8AF1774E, 0xAE7E954F, 0xB20434B0, 0xE761514D, 0xFB1BF0B2, 0xDF9412B3, 0xC3EEB34C,
+	0x755ED949, 0x692478B6, 0x4DAB9AB7, 0x51D13B48, 0x04B45EB5, 0x18CEFF4A, 0x3C411D4B, 0x203BBCB4,
+	0x7C366422, 0x604CC5DD, 0x44C327DC, 0x58B98623, 0x0DDCE3DE, 0x11A64221, 0x3529A020, 0x295301DF,
+	0x9FE36BDA, 0x8399CA25, 0xA7162824, 0xBB6C89DB, 0xEE09EC26, 0xF2734DD9, 0xD6FCAFD8, 0xCA860E27,
+	0x6EE71EF4, 0x729DBF0B, 0x56125D0A, 0x4A68FCF5, 0x1F0D9908, 0x037738F7, 0x27F8DAF6, 0x3B827B09,
+	0x8D32110C, 0x9148B0F3, 0xB5C752F2, 0xA9BDF30D, 0xFCD896F0, 0xE0A2370F, 0xC42DD50E, 0xD85774F1,
+	0x845AAC67, 0x98200D98, 0xBCAFEF99, 0xA0D54E66, 0xF5B02B9B, 0xE9CA8A64, 0xCD456865, 0xD13FC99A,
+	0x678FA39F, 0x7BF50260, 0x5F7AE061, 0x4300419E, 0x16652463, 0x0A1F859C, 0x2E90679D, 0x32EAC662,
+	0x4B45EB58, 0x573F4AA7, 0x73B0A8A6, 0x6FCA0959, 0x3AAF6CA4, 0x26D5CD5B, 0x025A2F5A, 0x1E208EA5,
+	0xA890E4A0, 0xB4EA455F, 0x9065A75E, 0x8C1F06A1, 0xD97A635C, 0xC500C2A3, 0xE18F20A2, 0xFDF5815D,
+	0xA1F859CB, 0xBD82F834, 0x990D1A35, 0x8577BBCA, 0xD012DE37, 0xCC687FC8, 0xE8E79DC9, 0xF49D3C36,
+	0x422D5633, 0x5E57F7CC, 0x7AD815CD, 0x66A2B432, 0x33C7D1CF, 0x2FBD7030, 0x0B329231, 0x174833CE,
+	0xB329231D, 0xAF5382E2, 0x8BDC60E3, 0x97A6C11C, 0xC2C3A4E1, 0xDEB9051E, 0xFA36E71F, 0xE64C46E0,
+	0x50FC2CE5, 0x4C868D1A, 0x68096F1B, 0x7473CEE4, 0x2116AB19, 0x3D6C0AE6, 0x19E3E8E7, 0x05994918,
+	0x5994918E, 0x45EE3071, 0x6161D270, 0x7D1B738F, 0x287E1672, 0x3404B78D, 0x108B558C, 0x0CF1F473,
+	0xBA419E76, 0xA63B3F89, 0x82B4DD88, 0x9ECE7C77, 0xCBAB198A, 0xD7D1B875, 0xF35E5A74, 0xEF24FB8B,
+	// Seed 0x01
+	0x00000000, 0x60005E4D, 0x2E0EDDB7, 0x4E0E83FA, 0x5C1DBB6E, 0x3C1DE523, 0x721366D9, 0x12133894,
+	0x563517F1, 0x363549BC, 0x783BCA46, 0x183B940B, 0x0A28AC9F, 0x6A28F2D2, 0x24267128, 0x44262F65,
+	0x42644ECF, 0x22641082, 0x6C6A9378, 0x0C6ACD35, 0x1E79F5A1, 0x7E79ABEC, 0x30772816, 0x5077765B,
+	0x1451593E, 0x74510773, 0x3A5F8489, 0x5A5FDAC4, 0x484CE250, 0x284CBC1D, 0x66423FE7, 0x064261AA,
+	0x6AC6FCB3, 0x0AC6A2FE, 0x44C82104, 0x24C87F49, 0x36DB47DD, 0x56DB1990, 0x18D59A6A, 0x78D5C427,
+	0x3CF3EB42, 0x5CF3B50F, 0x12FD36F5, 0x72FD68B8, 0x60EE502C, 0x00EE0E61, 0x4EE08D9B, 0x2EE0D3D6,
+	0x28A2B27C, 0x48A2EC31, 0x06AC6FCB, 0x66AC3186, 0x74BF0912, 0x14BF575F, 0x5AB1D4A5, 0x3AB18AE8,
+	0x7E97A58D, 0x1E97FBC0, 0x5099783A, 0x30992677, 0x228A1EE3, 0x428A40AE, 0x0C84C354, 0x6C849D19,
+	0x3B83984B, 0x5B83C606, 0x158D45FC, 0x758D1BB1, 0x679E2325, 0x079E7D68, 0x4990FE92, 0x2990A0DF,
+	0x6DB68FBA, 0x0DB6D1F7, 0x43B8520D, 0x23B80C40, 0x31AB34D4, 0x51AB6A99, 0x1FA5E963, 0x7FA5B72E,
+	0x79E7D684, 0x19E788C9, 0x57E90B33, 0x37E9557E, 0x25FA6DEA, 0x45FA33A7, 0x0BF4B05D, 0x6BF4EE10,
+	0x2FD2C175, 0x4FD29F38, 0x01DC1CC2, 0x61DC428F, 0x73CF7A1B, 0x13CF2456, 0x5DC1A7AC, 0x3DC1F9E1,
+	0x514564F8, 0x31453AB5, 0x7F4BB94F, 0x1F4BE702, 0x0D58DF96, 0x6D5881DB, 0x23560221, 0x43565C6C,
+	0x07707309, 0x67702D44, 0x297EAEBE, 0x497EF0F3, 0x5B6DC867, 0x3B6D962A, 0x756315D0, 0x15634B9D,
+	0x13212A37, 0x7321747A, 0x3D2FF780, 0x5D2FA9CD, 0x4F3C9159, 0x2F3CCF14, 0x61324CEE, 0x013212A3,
+	0x45143DC6, 0x2514638B, 0x6B1AE071, 0x0B1ABE3C, 0x190986A8, 0x7909D8E5, 0x37075B1F, 0x57070552,
+	0x77073096, 0x17076EDB, 0x5909ED21, 0x3909B36C, 0x2B1A8BF8, 0x4B1AD5B5, 0x0514564F, 0x65140802,
+	0x21322767, 0x4132792A, 0x0F3CFAD0, 0x6F3CA49D, 0x7D2F9C09, 0x1D2FC244, 0x532141BE, 0x33211FF3,
+	0x35637E59, 0x55632014, 0x1B6DA3EE, 0x7B6DFDA3, 0x697EC537, 0x097E9B7A, 0x47701880, 0x277046CD,
+	0x635669A8, 0x035637E5, 0x4D58B41F, 0x2D58EA52, 0x3F4BD2C6, 0x5F4B8C8B, 0x11450F71, 0x7145513C,
+	0x1DC1CC25, 0x7DC19268, 0x33CF1192, 0x53CF4FDF, 0x41DC774B, 0x21DC2906, 0x6FD2AAFC, 0x0FD2F4B1,
+	0x4BF4DBD4, 0x2BF48599, 0x65FA0663, 0x05FA582E, 0x17E960BA, 0x77E93EF7, 0x39E7BD0D, 0x59E7E340,
+	0x5FA582EA, 0x3FA5DCA7, 0x71AB5F5D, 0x11AB0110, 0x03B83984, 0x63B867C9, 0x2DB6E433, 0x4DB6BA7E,
+	0x0990951B, 0x6990CB56, 0x279E48AC, 0x479E16E1, 0x558D2E75, 0x358D7038, 0x7B83F3C2, 0x1B83AD8F,
+	0x4C84A8DD, 0x2C84F690, 0x628A756A, 0x028A2B27, 0x109913B3, 0x70994DFE, 0x3E97CE04, 0x5E979049,
+	0x1AB1BF2C, 0x7AB1E161, 0x34BF629B, 0x54BF3CD6, 0x46AC0442, 0x26AC5A0F, 0x68A2D9F5, 0x08A287B8,
+	0x0EE0E612, 0x6EE0B85F, 0x20EE3BA5, 0x40EE65E8, 0x52FD5D7C, 0x32FD0331, 0x7CF380CB, 0x1CF3DE86,
+	0x58D5F1E3, 0x38D5AFAE, 0x76DB2C54, 0x16DB7219, 0x04C84A8D, 0x64C814C0, 0x2AC6973A, 0x4AC6C977,
+	0x2642546E, 0x46420A23, 0x084C89D9, 0x684CD794, 0x7A5FEF00, 0x1A5FB14D, 0x545132B7, 0x34516CFA,
+	0x7077439F, 0x10771DD2, 0x5E799E28, 0x3E79C065, 0x2C6AF8F1, 0x4C6AA6BC, 0x02642546, 0x62647B0B,
+	0x64261AA1, 0x042644EC, 0x4A28C716, 0x2A28995B, 0x383BA1CF, 0x583BFF82, 0x16357C78, 0x76352235,
+	0x32130D50, 0x5213531D, 0x1C1DD0E7, 0x7C1D8EAA, 0x6E0EB63E, 0x0E0EE873, 0x40006B89, 0x200035C4,
+	// Seed 0x02
+	0x00000000, 0x12FD36F5, 0x25FA6DEA, 0x37075B1F, 0x4BF4DBD4, 0x5909ED21, 0x6E0EB63E, 0x7CF380CB,
+	0x97E9B7A8, 0x8514815D, 0xB213DA42, 0xA0EEECB7, 0xDC1D6C7C, 0xCEE05A89, 0xF9E70196, 0xEB1A3763,
+	0xF3CFAD09, 0xE1329BFC, 0xD635C0E3, 0xC4C8F616, 0xB83B76DD, 0xAAC64028, 0x9DC11B37, 0x8F3C2DC2,
+	0x64261AA1, 0x76DB2C54, 0x41DC774B, 0x532141BE, 0x2FD2C175, 0x3D2FF780, 0x0A28AC9F, 0x18D59A6A,
+	0x3B83984B, 0x297EAEBE, 0x1E79F5A1, 0x0C84C354, 0x7077439F, 0x628A756A, 0x558D2E75, 0x47701880,
+	0xAC6A2FE3, 0xBE971916, 0x89904209, 0x9B6D74FC, 0xE79EF437, 0xF563C2C2, 0xC26499DD, 0xD099AF28,
+	0xC84C3542, 0xDAB103B7, 0xEDB658A8, 0xFF4B6E5D, 0x83B8EE96, 0x9145D863, 0xA642837C, 0xB4BFB589,
+	0x5FA582EA, 0x4D58B41F, 0x7A5FEF00, 0x68A2D9F5, 0x1451593E, 0x06AC6FCB, 0x31AB34D4, 0x23560221,
+	0x77073096, 0x65FA0663, 0x52FD5D7C, 0x40006B89, 0x3CF3EB42, 0x2E0EDDB7, 0x190986A8, 0x0BF4B05D,
+	0xE0EE873E, 0xF213B1CB, 0xC514EAD4, 0xD7E9DC21, 0xAB1A5CEA, 0xB9E76A1F, 0x8EE03100, 0x9C1D07F5,
+	0x84C89D9F, 0x9635AB6A, 0xA132F075, 0xB3CFC680, 0xCF3C464B, 0xDDC170BE, 0xEAC62BA1, 0xF83B1D54,
+	0x13212A37, 0x01DC1CC2, 0x36DB47DD, 0x24267128, 0x58D5F1E3, 0x4A28C716, 0x7D2F9C09, 0x6FD2AAFC,
+	0x4C84A8DD, 0x5E799E28, 0x697EC537, 0x7B83F3C2, 0x07707309, 0x158D45FC, 0x228A1EE3, 0x30772816,
+	0xDB6D1F75, 0xC9902980, 0xFE97729F, 0xEC6A446A, 0x9099C4A1, 0x8264F254, 0xB563A94B, 0xA79E9FBE,
+	0xBF4B05D4, 0xADB63321, 0x9AB1683E, 0x884C5ECB, 0xF4BFDE00, 0xE642E8F5, 0xD145B3EA, 0xC3B8851F,
+	0x28A2B27C, 0x3A5F8489, 0x0D58DF96, 0x1FA5E963, 0x635669A8, 0x71AB5F5D, 0x46AC0442, 0x545132B7,
+	0xEE0E612C, 0xFCF357D9, 0xCBF40CC6, 0xD9093A33, 0xA5FABAF8, 0xB7078C0D, 0x8000D712, 0x92FDE1E7,
+	0x79E7D684, 0x6B1AE071, 0x5C1DBB6E, 0x4EE08D9B, 0x32130D50, 0x20EE3BA5, 0x17E960BA, 0x0514564F,
+	0x1DC1CC25, 0x0F3CFAD0, 0x383BA1CF, 0x2AC6973A, 0x563517F1, 0x44C82104, 0x73CF7A1B, 0x61324CEE,
+	0x8A287B8D, 0x98D54D78, 0xAFD21667, 0xBD2F2092, 0xC1DCA059, 0xD32196AC, 0xE426CDB3, 0xF6DBFB46,
+	0xD58DF967, 0xC770CF92, 0xF077948D, 0xE28AA278, 0x9E7922B3, 0x8C841446, 0xBB834F59, 0xA97E79AC,
+	0x42644ECF, 0x5099783A, 0x679E2325, 0x756315D0, 0x0990951B, 0x1B6DA3EE, 0x2C6AF8F1, 0x3E97CE04,
+	0x2642546E, 0x34BF629B, 0x03B83984, 0x11450F71, 0x6DB68FBA, 0x7F4BB94F, 0x484CE250, 0x5AB1D4A5,
+	0xB1ABE3C6, 0xA356D533, 0x94518E2C, 0x86ACB8D9, 0xFA5F3812, 0xE8A20EE7, 0xDFA555F8, 0xCD58630D,
+	0x990951BA, 0x8BF4674F, 0xBCF33C50, 0xAE0E0AA5, 0xD2FD8A6E, 0xC000BC9B, 0xF707E784, 0xE5FAD171,
+	0x0EE0E612, 0x1C1DD0E7, 0x2B1A8BF8, 0x39E7BD0D, 0x45143DC6, 0x57E90B33, 0x60EE502C, 0x721366D9,
+	0x6AC6FCB3, 0x783BCA46, 0x4F3C9159, 0x5DC1A7AC, 0x21322767, 0x33CF1192, 0x04C84A8D, 0x16357C78,
+	0xFD2F4B1B, 0xEFD27DEE, 0xD8D526F1, 0xCA281004, 0xB6DB90CF, 0xA426A63A, 0x9321FD25, 0x81DCCBD0,
+	0xA28AC9F1, 0xB077FF04, 0x8770A41B, 0x958D92EE, 0xE97E1225, 0xFB8324D0, 0xCC847FCF, 0xDE79493A,
+	0x35637E59, 0x279E48AC, 0x109913B3, 0x02642546, 0x7E97A58D, 0x6C6A9378, 0x5B6DC867, 0x4990FE92,
+	0x514564F8, 0x43B8520D, 0x74BF0912, 0x66423FE7, 0x1AB1BF2C, 0x084C89D9, 0x3F4BD2C6, 0x2DB6E433,
+	0xC6ACD350, 0xD451E5A5, 0xE356BEBA, 0xF1AB884F, 0x8D580884, 0x9FA53E71, 0xA8A2656E, 0xBA5F539B,
+	// Seed 0x03
+	0x00000000, 0x23B80C40, 0x47701880, 0x64C814C0, 0x8EE03100, 0xAD583D40, 0xC9902980, 0xEA2825C0,
+	0x2FD2C175, 0x0C6ACD35, 0x68A2D9F5, 0x4B1AD5B5, 0xA132F075, 0x828AFC35, 0xE642E8F5, 0xC5FAE4B5,
+	0x5FA582EA, 0x7C1D8EAA, 0x18D59A6A, 0x3B6D962A, 0xD145B3EA, 0xF2FDBFAA, 0x9635AB6A, 0xB58DA72A,
+	0x7077439F, 0x53CF4FDF, 0x37075B1F, 0x14BF575F, 0xFE97729F, 0xDD2F7EDF, 0xB9E76A1F, 0x9A5F665F,
+	0xBF4B05D4, 0x9CF30994, 0xF83B1D54, 0xDB831114, 0x31AB34D4, 0x12133894, 0x76DB2C54, 0x55632014,
+	0x9099C4A1, 0xB321C8E1, 0xD7E9DC21, 0xF451D061, 0x1E79F5A1, 0x3DC1F9E1, 0x5909ED21, 0x7AB1E161,
+	0xE0EE873E, 0xC3568B7E, 0xA79E9FBE, 0x842693FE, 0x6E0EB63E, 0x4DB6BA7E, 0x297EAEBE, 0x0AC6A2FE,
+	0xCF3C464B, 0xEC844A0B, 0x884C5ECB, 0xABF4528B, 0x41DC774B, 0x62647B0B, 0x06AC6FCB, 0x2514638B,
+	0x4C84A8DD, 0x6F3CA49D, 0x0BF4B05D, 0x284CBC1D, 0xC26499DD, 0xE1DC959D, 0x8514815D, 0xA6AC8D1D,
+	0x635669A8, 0x40EE65E8, 0x24267128, 0x079E7D68, 0xEDB658A8, 0xCE0E54E8, 0xAAC64028, 0x897E4C68,
+	0x13212A37, 0x30992677, 0x545132B7, 0x77E93EF7, 0x9DC11B37, 0xBE791777, 0xDAB103B7, 0xF9090FF7,
+	0x3CF3EB42, 0x1F4BE702, 0x7B83F3C2, 0x583BFF82, 0xB213DA42, 0x91ABD602, 0xF563C2C2, 0xD6DBCE82,
+	0xF3CFAD09, 0xD077A149, 0xB4BFB589, 0x9707B9C9, 0x7D2F9C09, 0x5E979049, 0x3A5F8489, 0x19E788C9,
+	0xDC1D6C7C, 0xFFA5603C, 0x9B6D74FC, 0xB8D578BC, 0x52FD5D7C, 0x7145513C, 0x158D45FC, 0x363549BC,
+	0xAC6A2FE3, 0x8FD223A3, 0xEB1A3763, 0xC8A23B23, 0x228A1EE3, 0x013212A3, 0x65FA0663, 0x46420A23,
+	0x83B8EE96, 0xA000E2D6, 0xC4C8F616, 0xE770FA56, 0x0D58DF96, 0x2EE0D3D6, 0x4A28C716, 0x6990CB56,
+	0x990951BA, 0xBAB15DFA, 0xDE79493A, 0xFDC1457A, 0x17E960BA, 0x34516CFA, 0x5099783A, 0x7321747A,
+	0xB6DB90CF, 0x95639C8F, 0xF1AB884F, 0xD213840F, 0x383BA1CF, 0x1B83AD8F, 0x7F4BB94F, 0x5CF3B50F,
+	0xC6ACD350, 0xE514DF10, 0x81DCCBD0, 0xA264C790, 0x484CE250, 0x6BF4EE10, 0x0F3CFAD0, 0x2C84F690,
+	0xE97E1225, 0xCAC61E65, 0xAE0E0AA5, 0x8DB606E5, 0x679E2325, 0x44262F65, 0x20EE3BA5, 0x035637E5,
+	0x2642546E, 0x05FA582E, 0x61324CEE, 0x428A40AE, 0xA8A2656E, 0x8B1A692E, 0xEFD27DEE, 0xCC6A71AE,
+	0x0990951B, 0x2A28995B, 0x4EE08D9B, 0x6D5881DB, 0x8770A41B, 0xA4C8A85B, 0xC000BC9B, 0xE3B8B0DB,
+	0x79E7D684, 0x5A5FDAC4, 0x3E97CE04, 0x1D2FC244, 0xF707E784, 0xD4BFEBC4, 0xB077FF04, 0x93CFF344,
+	0x563517F1, 0x758D1BB1, 0x11450F71, 0x32FD0331, 0xD8D526F1, 0xFB6D2AB1, 0x9FA53E71, 0xBC1D3231,
+	0xD58DF967, 0xF635F527, 0x92FDE1E7, 0xB145EDA7, 0x5B6DC867, 0x78D5C427, 0x1C1DD0E7, 0x3FA5DCA7,
+	0xFA5F3812, 0xD9E73452, 0xBD2F2092, 0x9E972CD2, 0x74BF0912, 0x57070552, 0x33CF1192, 0x10771DD2,
+	0x8A287B8D, 0xA99077CD, 0xCD58630D, 0xEEE06F4D, 0x04C84A8D, 0x277046CD, 0x43B8520D, 0x60005E4D,
+	0xA5FABAF8, 0x8642B6B8, 0xE28AA278, 0xC132AE38, 0x2B1A8BF8, 0x08A287B8, 0x6C6A9378, 0x4FD29F38,
+	0x6AC6FCB3, 0x497EF0F3, 0x2DB6E433, 0x0E0EE873, 0xE426CDB3, 0xC79EC1F3, 0xA356D533, 0x80EED973,
+	0x45143DC6, 0x66AC3186, 0x02642546, 0x21DC2906, 0xCBF40CC6, 0xE84C0086, 0x8C841446, 0xAF3C1806,
+	0x35637E59, 0x16DB7219, 0x721366D9, 0x51AB6A99, 0xBB834F59, 0x983B4319, 0xFCF357D9, 0xDF4B5B99,
+	0x1AB1BF2C, 0x3909B36C, 0x5DC1A7AC, 0x7E79ABEC, 0x94518E2C, 0xB7E9826C, 0xD32196AC, 0xF0999AEC,
+	// Seed 0x04
+	0x00000000, 0x005EDEF9, 0x00BDBDF2, 0x00E3630B, 0x017B7BE4, 0x0125A51D, 0x01C6C616, 0x019818EF,
+	0x02F6F7C8, 0x02A82931, 0x024B4A3A, 0x021594C3, 0x038D8C2C, 0x03D352D5, 0x033031DE, 0x036EEF27,
+	0x05EDEF90, 0x05B33169, 0x05505262, 0x050E8C9B, 0x04969474, 0x04C84A8D, 0x042B2986, 0x0475F77F,
+	0x071B1858, 0x0745C6A1, 0x07A6A5AA, 0x07F87B53, 0x066063BC, 0x063EBD45, 0x06DDDE4E, 0x068300B7,
+	0x05005713, 0x055E89EA, 0x05BDEAE1, 0x05E33418, 0x047B2CF7, 0x0425F20E, 0x04C69105, 0x04984FFC,
+	0x07F6A0DB, 0x07A87E22, 0x074B1D29, 0x0715C3D0, 0x068DDB3F, 0x06D305C6, 0x063066CD, 0x066EB834,
+	0x00EDB883, 0x00B3667A, 0x00500571, 0x000EDB88, 0x0196C367, 0x01C81D9E, 0x012B7E95, 0x0175A06C,
+	0x021B4F4B, 0x024591B2, 0x02A6F2B9, 0x02F82C40, 0x036034AF, 0x033EEA56, 0x03DD895D, 0x038357A4,
+	0x04DB2615, 0x0485F8EC, 0x04669BE7, 0x0438451E, 0x05A05DF1, 0x05FE8308, 0x051DE003, 0x05433EFA,
+	0x062DD1DD, 0x06730F24, 0x06906C2F, 0x06CEB2D6, 0x0756AA39, 0x070874C0, 0x07EB17CB, 0x07B5C932,
+	0x0136C985, 0x0168177C, 0x018B7477, 0x01D5AA8E, 0x004DB261, 0x00136C98, 0x00F00F93, 0x00AED16A,
+	0x03C03E4D, 0x039EE0B4, 0x037D83BF, 0x03235D46, 0x02BB45A9, 0x02E59B50, 0x0206F85B, 0x025826A2,
+	0x01DB7106, 0x0185AFFF, 0x0166CCF4, 0x0138120D, 0x00A00AE2, 0x00FED41B, 0x001DB710, 0x004369E9,
+	0x032D86CE, 0x03735837, 0x03903B3C, 0x03CEE5C5, 0x0256FD2A, 0x020823D3, 0x02EB40D8, 0x02B59E21,
+	0x04369E96, 0x0468406F, 0x048B2364, 0x04D5FD9D, 0x054DE572, 0x05133B8B, 0x05F05880, 0x05AE8679,
+	0x06C0695E, 0x069EB7A7, 0x067DD4AC, 0x06230A55, 0x07BB12BA, 0x07E5CC43, 0x0706AF48, 0x075871B1,
+	0x076DC419, 0x07331AE0, 0x07D079EB, 0x078EA712, 0x0616BFFD, 0x06486104, 0x06AB020F, 0x06F5DCF6,
+	0x059B33D1, 0x05C5ED28, 0x05268E23, 0x057850DA, 0x04E04835, 0x04BE96CC, 0x045DF5C7, 0x04032B3E,
+	0x02802B89, 0x02DEF570, 0x023D967B, 0x02634882, 0x03FB506D, 0x03A58E94, 0x0346ED9F, 0x03183366,
+	0x0076DC41, 0x002802B8, 0x00CB61B3, 0x0095BF4A, 0x010DA7A5, 0x0153795C, 0x01B01A57, 0x01EEC4AE,
+	0x026D930A, 0x02334DF3, 0x02D02EF8, 0x028EF001, 0x0316E8EE, 0x03483617, 0x03AB551C, 0x03F58BE5,
+	0x009B64C2, 0x00C5BA3B, 0x0026D930, 0x007807C9, 0x01E01F26, 0x01BEC1DF, 0x015DA2D4, 0x01037C2D,
+	0x07807C9A, 0x07DEA263, 0x073DC168, 0x07631F91, 0x06FB077E, 0x06A5D987, 0x0646BA8C, 0x06186475,
+	0x05768B52, 0x052855AB, 0x05CB36A0, 0x0595E859, 0x040DF0B6, 0x04532E4F, 0x04B04D44, 0x04EE93BD,
+	0x03B6E20C, 0x03E83CF5, 0x030B5FFE, 0x03558107, 0x02CD99E8, 0x02934711, 0x0270241A, 0x022EFAE3,
+	0x014015C4, 0x011ECB3D, 0x01FDA836, 0x01A376CF, 0x003B6E20, 0x0065B0D9, 0x0086D3D2, 0x00D80D2B,
+	0x065B0D9C, 0x0605D365, 0x06E6B06E, 0x06B86E97, 0x07207678, 0x077EA881, 0x079DCB8A, 0x07C31573,
+	0x04ADFA54, 0x04F324AD, 0x041047A6, 0x044E995F, 0x05D681B0, 0x05885F49, 0x056B3C42, 0x0535E2BB,
+	0x06B6B51F, 0x06E86BE6, 0x060B08ED, 0x0655D614, 0x07CDCEFB, 0x07931002, 0x07707309, 0x072EADF0,
+	0x044042D7, 0x041E9C2E, 0x04FDFF25, 0x04A321DC, 0x053B3933, 0x0565E7CA, 0x058684C1, 0x05D85A38,
+	0x035B5A8F, 0x03058476, 0x03E6E77D, 0x03B83984, 0x0220216B, 0x027EFF92, 0x029D9C99, 0x02C34260,
+	0x01ADAD47, 0x01F373BE, 0x011010B5, 0x014ECE4C, 0x00D6D6A3, 0x0088085A, 0x006B6B51, 0x0035B5A8,
+	// Seed 0x05
+	0x00000000, 0x250EB95F, 0x4A1D72BE, 0x6F13CBE1, 0x74EF0C63, 0x51E1B53C, 0x3EF27EDD, 0x1BFCC782,
+	0x090BF1D9, 0x2C054886, 0x43168367, 0x66183A38, 0x7DE4FDBA, 0x58EA44E5, 0x37F98F04, 0x12F7365B,
+	0x1217E3B2, 0x37195AED, 0x580A910C, 0x7D042853, 0x66F8EFD1, 0x43F6568E, 0x2CE59D6F, 0x09EB2430,
+	0x1B1C126B, 0x3E12AB34, 0x510160D5, 0x740FD98A, 0x6FF31E08, 0x4AFDA757, 0x25EE6CB6, 0x00E0D5E9,
+	0x242FC764, 0x01217E3B, 0x6E32B5DA, 0x4B3C0C85, 0x50C0CB07, 0x75CE7258, 0x1ADDB9B9, 0x3FD300E6,
+	0x2D2436BD, 0x082A8FE2, 0x67394403, 0x4237FD5C, 0x59CB3ADE, 0x7CC58381, 0x13D64860, 0x36D8F13F,
+	0x363824D6, 0x13369D89, 0x7C255668, 0x592BEF37, 0x42D728B5, 0x67D991EA, 0x08CA5A0B, 0x2DC4E354,
+	0x3F33D50F, 0x1A3D6C50, 0x752EA7B1, 0x50201EEE, 0x4BDCD96C, 0x6ED26033, 0x01C1ABD2, 0x24CF128D,
+	0x485F8EC8, 0x6D513797, 0x0242FC76, 0x274C4529, 0x3CB082AB, 0x19BE3BF4, 0x76ADF015, 0x53A3494A,
+	0x41547F11, 0x645AC64E, 0x0B490DAF, 0x2E47B4F0, 0x35BB7372, 0x10B5CA2D, 0x7FA601CC, 0x5AA8B893,
+	0x5A486D7A, 0x7F46D425, 0x10551FC4, 0x355BA69B, 0x2EA76119, 0x0BA9D846, 0x64BA13A7, 0x41B4AAF8,
+	0x53439CA3, 0x764D25FC, 0x195EEE1D, 0x3C505742, 0x27AC90C0, 0x02A2299F, 0x6DB1E27E, 0x48BF5B21,
+	0x6C7049AC, 0x497EF0F3, 0x266D3B12, 0x0363824D, 0x189F45CF, 0x3D91FC90, 0x52823771, 0x778C8E2E,
+	0x657BB875, 0x4075012A, 0x2F66CACB, 0x0A687394, 0x1194B416, 0x349A0D49, 0x5B89C6A8, 0x7E877FF7,
+	0x7E67AA1E, 0x5B691341, 0x347AD8A0, 0x117461FF, 0x0A88A67D, 0x2F861F22, 0x4095D4C3, 0x659B6D9C,
+	0x776C5BC7, 0x5262E298, 0x3D712979, 0x187F9026, 0x038357A4, 0x268DEEFB, 0x499E251A, 0x6C909C45,
+	0x706AF48F, 0x55644DD0, 0x3A778631, 0x1F793F6E, 0x0485F8EC, 0x218B41B3, 0x4E988A52, 0x6B96330D,
+	0x79610556, 0x5C6FBC09, 0x337C77E8, 0x1672CEB7, 0x0D8E0935, 0x2880B06A, 0x47937B8B, 0x629DC2D4,
+	0x627D173D, 0x4773AE62, 0x28606583, 0x0D6EDCDC, 0x16921B5E, 0x339CA201, 0x5C8F69E0, 0x7981D0BF,
+	0x6B76E6E4, 0x4E785FBB, 0x216B945A, 0x04652D05, 0x1F99EA87, 0x3A9753D8, 0x55849839, 0x708A2166,
+	0x544533EB, 0x714B8AB4, 0x1E584155, 0x3B56F80A, 0x20AA3F88, 0x05A486D7, 0x6AB74D36, 0x4FB9F469,
+	0x5D4EC232, 0x78407B6D, 0x1753B08C, 0x325D09D3, 0x29A1CE51, 0x0CAF770E, 0x63BCBCEF, 0x46B205B0,
+	0x4652D059, 0x635C6906, 0x0C4FA2E7, 0x29411BB8, 0x32BDDC3A, 0x17B36565, 0x78A0AE84, 0x5DAE17DB,
+	0x4F592180, 0x6A5798DF, 0x0544533E, 0x204AEA61, 0x3BB62DE3, 0x1EB894BC, 0x71AB5F5D, 0x54A5E602,
+	0x38357A47, 0x1D3BC318, 0x722808F9, 0x5726B1A6, 0x4CDA7624, 0x69D4CF7B, 0x06C7049A, 0x23C9BDC5,
+	0x313E8B9E, 0x143032C1, 0x7B23F920, 0x5E2D407F, 0x45D187FD, 0x60DF3EA2, 0x0FCCF543, 0x2AC24C1C,
+	0x2A2299F5, 0x0F2C20AA, 0x603FEB4B, 0x45315214, 0x5ECD9596, 0x7BC32CC9, 0x14D0E728, 0x31DE5E77,
+	0x2329682C, 0x0627D173, 0x69341A92, 0x4C3AA3CD, 0x57C6644F, 0x72C8DD10, 0x1DDB16F1, 0x38D5AFAE,
+	0x1C1ABD23, 0x3914047C, 0x5607CF9D, 0x730976C2, 0x68F5B140, 0x4DFB081F, 0x22E8C3FE, 0x07E67AA1,
+	0x15114CFA, 0x301FF5A5, 0x5F0C3E44, 0x7A02871B, 0x61FE4099, 0x44F0F9C6, 0x2BE33227, 0x0EED8B78,
+	0x0E0D5E91, 0x2B03E7CE, 0x44102C2F, 0x611E9570, 0x7AE252F2, 0x5FECEBAD, 0x30FF204C, 0x15F19913,
+	0x0706AF48, 0x22081617, 0x4D1BDDF6, 0x681564A9, 0x73E9A32B, 0x56E71A74, 0x39F4D195, 0x1CFA68CA,
+	// Seed 0x06
+	0x00000000, 0x56F91B86, 0xADF2370C, 0xFB0B2C8A, 0x89232473, 0xDFDA3FF5, 0x24D1137F, 0x722808F9,
+	0xC081028D, 0x9678190B, 0x6D733581, 0x3B8A2E07, 0x49A226FE, 0x1F5B3D78, 0xE45011F2, 0xB2A90A74,
+	0x53C54F71, 0x053C54F7, 0xFE37787D, 0xA8CE63FB, 0xDAE66B02, 0x8C1F7084, 0x77145C0E, 0x21ED4788,
+	0x93444DFC, 0xC5BD567A, 0x3EB67AF0, 0x684F6176, 0x1A67698F, 0x4C9E7209, 0xB7955E83, 0xE16C4505,
+	0xA78A9EE2, 0xF1738564, 0x0A78A9EE, 0x5C81B268, 0x2EA9BA91, 0x7850A117, 0x835B8D9D, 0xD5A2961B,
+	0x670B9C6F, 0x31F287E9, 0xCAF9AB63, 0x9C00B0E5, 0xEE28B81C, 0xB8D1A39A, 0x43DA8F10, 0x15239496,
+	0xF44FD193, 0xA2B6CA15, 0x59BDE69F, 0x0F44FD19, 0x7D6CF5E0, 0x2B95EE66, 0xD09EC2EC, 0x8667D96A,
+	0x34CED31E, 0x6237C898, 0x993CE412, 0xCFC5FF94, 0xBDEDF76D, 0xEB14ECEB, 0x101FC061, 0x46E6DBE7,
+	0x9DD277AF, 0xCB2B6C29, 0x302040A3, 0x66D95B25, 0x14F153DC, 0x4208485A, 0xB90364D0, 0xEFFA7F56,
+	0x5D537522, 0x0BAA6EA4, 0xF0A1422E, 0xA65859A8, 0xD4705151, 0x82894AD7, 0x7982665D, 0x2F7B7DDB,
+	0xCE1738DE, 0x98EE2358, 0x63E50FD2, 0x351C1454, 0x47341CAD, 0x11CD072B, 0xEAC62BA1, 0xBC3F3027,
+	0x0E963A53, 0x586F21D5, 0xA3640D5F, 0xF59D16D9, 0x87B51E20, 0xD14C05A6, 0x2A47292C, 0x7CBE32AA,
+	0x3A58E94D, 0x6CA1F2CB, 0x97AADE41, 0xC153C5C7, 0xB37BCD3E, 0xE582D6B8, 0x1E89FA32, 0x4870E1B4,
+	0xFAD9EBC0, 0xAC20F046, 0x572BDCCC, 0x01D2C74A, 0x73FACFB3, 0x2503D435, 0xDE08F8BF, 0x88F1E339,
+	0x699DA63C, 0x3F64BDBA, 0xC46F9130, 0x92968AB6, 0xE0BE824F, 0xB64799C9, 0x4D4CB543, 0x1BB5AEC5,
+	0xA91CA4B1, 0xFFE5BF37, 0x04EE93BD, 0x5217883B, 0x203F80C2, 0x76C69B44, 0x8DCDB7CE, 0xDB34AC48,
+	0xE963A535, 0xBF9ABEB3, 0x44919239, 0x126889BF, 0x60408146, 0x36B99AC0, 0xCDB2B64A, 0x9B4BADCC,
+	0x29E2A7B8, 0x7F1BBC3E, 0x841090B4, 0xD2E98B32, 0xA0C183CB, 0xF638984D, 0x0D33B4C7, 0x5BCAAF41,
+	0xBAA6EA44, 0xEC5FF1C2, 0x1754DD48, 0x41ADC6CE, 0x3385CE37, 0x657CD5B1, 0x9E77F93B, 0xC88EE2BD,
+	0x7A27E8C9, 0x2CDEF34F, 0xD7D5DFC5, 0x812CC443, 0xF304CCBA, 0xA5FDD73C, 0x5EF6FBB6, 0x080FE030,
+	0x4EE93BD7, 0x18102051, 0xE31B0CDB, 0xB5E2175D, 0xC7CA1FA4, 0x91330422, 0x6A3828A8, 0x3CC1332E,
+	0x8E68395A, 0xD89122DC, 0x239A0E56, 0x756315D0, 0x074B1D29, 0x51B206AF, 0xAAB92A25, 0xFC4031A3,
+	0x1D2C74A6, 0x4BD56F20, 0xB0DE43AA, 0xE627582C, 0x940F50D5, 0xC2F64B53, 0x39FD67D9, 0x6F047C5F,
+	0xDDAD762B, 0x8B546DAD, 0x705F4127, 0x26A65AA1, 0x548E5258, 0x027749DE, 0xF97C6554, 0xAF857ED2,
+	0x74B1D29A, 0x2248C91C, 0xD943E596, 0x8FBAFE10, 0xFD92F6E9, 0xAB6BED6F, 0x5060C1E5, 0x0699DA63,
+	0xB430D017, 0xE2C9CB91, 0x19C2E71B, 0x4F3BFC9D, 0x3D13F464, 0x6BEAEFE2, 0x90E1C368, 0xC618D8EE,
+	0x27749DEB, 0x718D866D, 0x8A86AAE7, 0xDC7FB161, 0xAE57B998, 0xF8AEA21E, 0x03A58E94, 0x555C9512,
+	0xE7F59F66, 0xB10C84E0, 0x4A07A86A, 0x1CFEB3EC, 0x6ED6BB15, 0x382FA093, 0xC3248C19, 0x95DD979F,
+	0xD33B4C78, 0x85C257FE, 0x7EC97B74, 0x283060F2, 0x5A18680B, 0x0CE1738D, 0xF7EA5F07, 0xA1134481,
+	0x13BA4EF5, 0x45435573, 0xBE4879F9, 0xE8B1627F, 0x9A996A86, 0xCC607100, 0x376B5D8A, 0x6192460C,
+	0x80FE0309, 0xD607188F, 0x2D0C3405, 0x7BF52F83, 0x09DD277A, 0x5F243CFC, 0xA42F1076, 0xF2D60BF0,
+	0x407F0184, 0x16861A02, 0xED8D3688, 0xBB742D0E, 0xC95C25F7, 0x9FA53E71, 0x64AE12FB, 0x3257097D,
+	// Seed 0x07
+	0x00000000, 0x870B1530, 0x32DF0127, 0xB5D41417, 0x65BE024E, 0xE2B5177E, 0x57610369, 0xD06A1659,
+	0xCB7C049C, 0x4C7711AC, 0xF9A305BB, 0x7EA8108B, 0xAEC206D2, 0x29C913E2, 0x9C1D07F5, 0x1B1612C5,
+	0xAA31227F, 0x2D3A374F, 0x98EE2358, 0x1FE53668, 0xCF8F2031, 0x48843501, 0xFD502116, 0x7A5B3426,
+	0x614D26E3, 0xE64633D3, 0x539227C4, 0xD49932F4, 0x04F324AD, 0x83F8319D, 0x362C258A, 0xB12730BA,
+	0x68AB6FB9, 0xEFA07A89, 0x5A746E9E, 0xDD7F7BAE, 0x0D156DF7, 0x8A1E78C7, 0x3FCA6CD0, 0xB8C179E0,
+	0xA3D76B25, 0x24DC7E15, 0x91086A02, 0x16037F32, 0xC669696B, 0x41627C5B, 0xF4B6684C, 0x73BD7D7C,
+	0xC29A4DC6, 0x459158F6, 0xF0454CE1, 0x774E59D1, 0xA7244F88, 0x202F5AB8, 0x95FB4EAF, 0x12F05B9F,
+	0x09E6495A, 0x8EED5C6A, 0x3B39487D, 0xBC325D4D, 0x6C584B14, 0xEB535E24, 0x5E874A33, 0xD98C5F03,
+	0xD156DF72, 0x565DCA42, 0xE389DE55, 0x6482CB65, 0xB4E8DD3C, 0x33E3C80C, 0x8637DC1B, 0x013CC92B,
+	0x1A2ADBEE, 0x9D21CEDE, 0x28F5DAC9, 0xAFFECFF9, 0x7F94D9A0, 0xF89FCC90, 0x4D4BD887, 0xCA40CDB7,
+	0x7B67FD0D, 0xFC6CE83D, 0x49B8FC2A, 0xCEB3E91A, 0x1ED9FF43, 0x99D2EA73, 0x2C06FE64, 0xAB0DEB54,
+	0xB01BF991, 0x3710ECA1, 0x82C4F8B6, 0x05CFED86, 0xD5A5FBDF, 0x52AEEEEF, 0xE77AFAF8, 0x6071EFC8,
+	0xB9FDB0CB, 0x3EF6A5FB, 0x8B22B1EC, 0x0C29A4DC, 0xDC43B285, 0x5B48A7B5, 0xEE9CB3A2, 0x6997A692,
+	0x7281B457, 0xF58AA167, 0x405EB570, 0xC755A040, 0x173FB619, 0x9034A329, 0x25E0B73E, 0xA2EBA20E,
+	0x13CC92B4, 0x94C78784, 0x21139393, 0xA61886A3, 0x767290FA, 0xF17985CA, 0x44AD91DD, 0xC3A684ED,
+	0xD8B09628, 0x5FBB8318, 0xEA6F970F, 0x6D64823F, 0xBD0E9466, 0x3A058156, 0x8FD19541, 0x08DA8071,
+	0x9E6495A3, 0x196F8093, 0xACBB9484, 0x2BB081B4, 0xFBDA97ED, 0x7CD182DD, 0xC90596CA, 0x4E0E83FA,
+	0x5518913F, 0xD213840F, 0x67C79018, 0xE0CC8528, 0x30A69371, 0xB7AD8641, 0x02799256, 0x85728766,
+	0x3455B7DC, 0xB35EA2EC, 0x068AB6FB, 0x8181A3CB, 0x51EBB592, 0xD6E0A0A2, 0x6334B4B5, 0xE43FA185,
+	0xFF29B340, 0x7822A670, 0xCDF6B267, 0x4AFDA757, 0x9A97B10E, 0x1D9CA43E, 0xA848B029, 0x2F43A519,
+	0xF6CFFA1A, 0x71C4EF2A, 0xC410FB3D, 0x431BEE0D, 0x9371F854, 0x147AED64, 0xA1AEF973, 0x26A5EC43,
+	0x3DB3FE86, 0xBAB8EBB6, 0x0F6CFFA1, 0x8867EA91, 0x580DFCC8, 0xDF06E9F8, 0x6AD2FDEF, 0xEDD9E8DF,
+	0x5CFED865, 0xDBF5CD55, 0x6E21D942, 0xE92ACC72, 0x3940DA2B, 0xBE4BCF1B, 0x0B9FDB0C, 0x8C94CE3C,
+	0x9782DCF9, 0x1089C9C9, 0xA55DDDDE, 0x2256C8EE, 0xF23CDEB7, 0x7537CB87, 0xC0E3DF90, 0x47E8CAA0,
+	0x4F324AD1, 0xC8395FE1, 0x7DED4BF6, 0xFAE65EC6, 0x2A8C489F, 0xAD875DAF, 0x185349B8, 0x9F585C88,
+	0x844E4E4D, 0x03455B7D, 0xB6914F6A, 0x319A5A5A, 0xE1F04C03, 0x66FB5933, 0xD32F4D24, 0x54245814,
+	0xE50368AE, 0x62087D9E, 0xD7DC6989, 0x50D77CB9, 0x80BD6AE0, 0x07B67FD0, 0xB2626BC7, 0x35697EF7,
+	0x2E7F6C32, 0xA9747902, 0x1CA06D15, 0x9BAB7825, 0x4BC16E7C, 0xCCCA7B4C, 0x791E6F5B, 0xFE157A6B,
+	0x27992568, 0xA0923058, 0x1546244F, 0x924D317F, 0x42272726, 0xC52C3216, 0x70F82601, 0xF7F33331,
+	0xECE521F4, 0x6BEE34C4, 0xDE3A20D3, 0x593135E3, 0x895B23BA, 0x0E50368A, 0xBB84229D, 0x3C8F37AD,
+	0x8DA80717, 0x0AA31227, 0xBF770630, 0x387C1300, 0xE8160559, 0x6F1D1069, 0xDAC9047E, 0x5DC2114E,
+	0x46D4038B, 0xC1DF16BB, 0x740B02AC, 0xF300179C, 0x236A01C5, 0xA46114F5, 0x11B500E2, 0x96BE15D2,
+	// Seed 0x08
+	0x00000000, 0x0206F85B, 0x040DF0B6, 0x060B08ED, 0x081BE16C, 0x0A1D1937, 0x0C1611DA, 0x0E10E981,
+	0x0D80D2BD, 0x0F862AE6, 0x098D220B, 0x0B8BDA50, 0x059B33D1, 0x079DCB8A, 0x0196C367, 0x03903B3C,
+	0x06B6B51F, 0x04B04D44, 0x02BB45A9, 0x00BDBDF2, 0x0EAD5473, 0x0CABAC28, 0x0AA0A4C5, 0x08A65C9E,
+	0x0B3667A2, 0x09309FF9, 0x0F3B9714, 0x0D3D6F4F, 0x032D86CE, 0x012B7E95, 0x07207678, 0x05268E23,
+	0x0D6D6A3E, 0x0F6B9265, 0x09609A88, 0x0B6662D3, 0x05768B52, 0x07707309, 0x017B7BE4, 0x037D83BF,
+	0x00EDB883, 0x02EB40D8, 0x04E04835, 0x06E6B06E, 0x08F659EF, 0x0AF0A1B4, 0x0CFBA959, 0x0EFD5102,
+	0x0BDBDF21, 0x09DD277A, 0x0FD62F97, 0x0DD0D7CC, 0x03C03E4D, 0x01C6C616, 0x07CDCEFB, 0x05CB36A0,
+	0x065B0D9C, 0x045DF5C7, 0x0256FD2A, 0x00500571, 0x0E40ECF0, 0x0C4614AB, 0x0A4D1C46, 0x084BE41D,
+	0x076DC419, 0x056B3C42, 0x036034AF, 0x0166CCF4, 0x0F762575, 0x0D70DD2E, 0x0B7BD5C3, 0x097D2D98,
+	0x0AED16A4, 0x08EBEEFF, 0x0EE0E612, 0x0CE61E49, 0x02F6F7C8, 0x00F00F93, 0x06FB077E, 0x04FDFF25,
+	0x01DB7106, 0x03DD895D, 0x05D681B0, 0x07D079EB, 0x09C0906A, 0x0BC66831, 0x0DCD60DC, 0x0FCB9887,
+	0x0C5BA3BB, 0x0E5D5BE0, 0x0856530D, 0x0A50AB56, 0x044042D7, 0x0646BA8C, 0x004DB261, 0x024B4A3A,
+	0x0A00AE27, 0x0806567C, 0x0E0D5E91, 0x0C0BA6CA, 0x021B4F4B, 0x001DB710, 0x0616BFFD, 0x041047A6,
+	0x07807C9A, 0x058684C1, 0x038D8C2C, 0x018B7477, 0x0F9B9DF6, 0x0D9D65AD, 0x0B966D40, 0x0990951B,
+	0x0CB61B38, 0x0EB0E363, 0x08BBEB8E, 0x0ABD13D5, 0x04ADFA54, 0x06AB020F, 0x00A00AE2, 0x02A6F2B9,
+	0x0136C985, 0x033031DE, 0x053B3933, 0x073DC168, 0x092D28E9, 0x0B2BD0B2, 0x0D20D85F, 0x0F262004,
+	0x0EDB8832, 0x0CDD7069, 0x0AD67884, 0x08D080DF, 0x06C0695E, 0x04C69105, 0x02CD99E8, 0x00CB61B3,
+	0x035B5A8F, 0x015DA2D4, 0x0756AA39, 0x05505262, 0x0B40BBE3, 0x094643B8, 0x0F4D4B55, 0x0D4BB30E,
+	0x086D3D2D, 0x0A6BC576, 0x0C60CD9B, 0x0E6635C0, 0x0076DC41, 0x0270241A, 0x047B2CF7, 0x067DD4AC,
+	0x05EDEF90, 0x07EB17CB, 0x01E01F26, 0x03E6E77D, 0x0DF60EFC, 0x0FF0F6A7, 0x09FBFE4A, 0x0BFD0611,
+	0x03B6E20C, 0x01B01A57, 0x07BB12BA, 0x05BDEAE1, 0x0BAD0360, 0x09ABFB3B, 0x0FA0F3D6, 0x0DA60B8D,
+	0x0E3630B1, 0x0C30C8EA, 0x0A3BC007, 0x083D385C, 0x062DD1DD, 0x042B2986, 0x0220216B, 0x0026D930,
+	0x05005713, 0x0706AF48, 0x010DA7A5, 0x030B5FFE, 0x0D1BB67F, 0x0F1D4E24, 0x091646C9, 0x0B10BE92,
+	0x088085AE, 0x0A867DF5, 0x0C8D7518, 0x0E8B8D43, 0x009B64C2, 0x029D9C99, 0x04969474, 0x06906C2F,
+	0x09B64C2B, 0x0BB0B470, 0x0DBBBC9D, 0x0FBD44C6, 0x01ADAD47, 0x03AB551C, 0x05A05DF1, 0x07A6A5AA,
+	0x04369E96, 0x063066CD, 0x003B6E20, 0x023D967B, 0x0C2D7FFA, 0x0E2B87A1, 0x08208F4C, 0x0A267717,
+	0x0F00F934, 0x0D06016F, 0x0B0D0982, 0x090BF1D9, 0x071B1858, 0x051DE003, 0x0316E8EE, 0x011010B5,
+	0x02802B89, 0x0086D3D2, 0x068DDB3F, 0x048B2364, 0x0A9BCAE5, 0x089D32BE, 0x0E963A53, 0x0C90C208,
+	0x04DB2615, 0x06DDDE4E, 0x00D6D6A3, 0x02D02EF8, 0x0CC0C779, 0x0EC63F22, 0x08CD37CF, 0x0ACBCF94,
+	0x095BF4A8, 0x0B5D0CF3, 0x0D56041E, 0x0F50FC45, 0x014015C4, 0x0346ED9F, 0x054DE572, 0x074B1D29,
+	0x026D930A, 0x006B6B51, 0x066063BC, 0x04669BE7, 0x0A767266, 0x08708A3D, 0x0E7B82D0, 0x0C7D7A8B,
+	0x0FED41B7, 0x0DEBB9EC, 0x0BE0B101, 0x09E6495A, 0x07F6A0DB, 0x05F05880, 0x03FB506D, 0x01FDA836,
+	// Seed 0x09
+	0x00000000, 0x076E72FB, 0x0EDCE5F6, 0x09B2970D, 0x1DB9CBEC, 0x1AD7B917, 0x13652E1A, 0x140B5CE1,
+	0x3B7397D8, 0x3C1DE523, 0x35AF722E, 0x32C100D5, 0x26CA5C34, 0x21A42ECF, 0x2816B9C2, 0x2F78CB39,
+	0x76E72FB0, 0x71895D4B, 0x783BCA46, 0x7F55B8BD, 0x6B5EE45C, 0x6C3096A7, 0x658201AA, 0x62EC7351,
+	0x4D94B868, 0x4AFACA93, 0x43485D9E, 0x44262F65, 0x502D7384, 0x5743017F, 0x5EF19672, 0x599FE489,
+	0x1E772E29, 0x19195CD2, 0x10ABCBDF, 0x17C5B924, 0x03CEE5C5, 0x04A0973E, 0x0D120033, 0x0A7C72C8,
+	0x2504B9F1, 0x226ACB0A, 0x2BD85C07, 0x2CB62EFC, 0x38BD721D, 0x3FD300E6, 0x366197EB, 0x310FE510,
+	0x68900199, 0x6FFE7362, 0x664CE46F, 0x61229694, 0x7529CA75, 0x7247B88E, 0x7BF52F83, 0x7C9B5D78,
+	0x53E39641, 0x548DE4BA, 0x5D3F73B7, 0x5A51014C, 0x4E5A5DAD, 0x49342F56, 0x4086B85B, 0x47E8CAA0,
+	0x3CEE5C52, 0x3B802EA9, 0x3232B9A4, 0x355CCB5F, 0x215797BE, 0x2639E545, 0x2F8B7248, 0x28E500B3,
+	0x079DCB8A, 0x00F3B971, 0x09412E7C, 0x0E2F5C87, 0x1A240066, 0x1D4A729D, 0x14F8E590, 0x1396976B,
+	0x4A0973E2, 0x4D670119, 0x44D59614, 0x43BBE4EF, 0x57B0B80E, 0x50DECAF5, 0x596C5DF8, 0x5E022F03,
+	0x717AE43A, 0x761496C1, 0x7FA601CC, 0x78C87337, 0x6CC32FD6, 0x6BAD5D2D, 0x621FCA20, 0x6571B8DB,
+	0x2299727B, 0x25F70080, 0x2C45978D, 0x2B2BE576, 0x3F20B997, 0x384ECB6C, 0x31FC5C61, 0x36922E9A,
+	0x19EAE5A3, 0x1E849758, 0x17360055, 0x105872AE, 0x04532E4F, 0x033D5CB4, 0x0A8FCBB9, 0x0DE1B942,
+	0x547E5DCB, 0x53102F30, 0x5AA2B83D, 0x5DCCCAC6, 0x49C79627, 0x4EA9E4DC, 0x471B73D1, 0x4075012A,
+	0x6F0DCA13, 0x6863B8E8, 0x61D12FE5, 0x66BF5D1E, 0x72B401FF, 0x75DA7304, 0x7C68E409, 0x7B0696F2,
+	0x79DCB8A4, 0x7EB2CA5F, 0x77005D52, 0x706E2FA9, 0x64657348, 0x630B01B3, 0x6AB996BE, 0x6DD7E445,
+	0x42AF2F7C, 0x45C15D87, 0x4C73CA8A, 0x4B1DB871, 0x5F16E490, 0x5878966B, 0x51CA0166, 0x56A4739D,
+	0x0F3B9714, 0x0855E5EF, 0x01E772E2, 0x06890019, 0x12825CF8, 0x15EC2E03, 0x1C5EB90E, 0x1B30CBF5,
+	0x344800CC, 0x33267237, 0x3A94E53A, 0x3DFA97C1, 0x29F1CB20, 0x2E9FB9DB, 0x272D2ED6, 0x20435C2D,
+	0x67AB968D, 0x60C5E476, 0x6977737B, 0x6E190180, 0x7A125D61, 0x7D7C2F9A, 0x74CEB897, 0x73A0CA6C,
+	0x5CD80155, 0x5BB673AE, 0x5204E4A3, 0x556A9658, 0x4161CAB9, 0x460FB842, 0x4FBD2F4F, 0x48D35DB4,
+	0x114CB93D, 0x1622CBC6, 0x1F905CCB, 0x18FE2E30, 0x0CF572D1, 0x0B9B002A, 0x02299727, 0x0547E5DC,
+	0x2A3F2EE5, 0x2D515C1E, 0x24E3CB13, 0x238DB9E8, 0x3786E509, 0x30E897F2, 0x395A00FF, 0x3E347204,
+	0x4532E4F6, 0x425C960D, 0x4BEE0100, 0x4C8073FB, 0x588B2F1A, 0x5FE55DE1, 0x5657CAEC, 0x5139B817,
+	0x7E41732E, 0x792F01D5, 0x709D96D8, 0x77F3E423, 0x63F8B8C2, 0x6496CA39, 0x6D245D34, 0x6A4A2FCF,
+	0x33D5CB46, 0x34BBB9BD, 0x3D092EB0, 0x3A675C4B, 0x2E6C00AA, 0x29027251, 0x20B0E55C, 0x27DE97A7,
+	0x08A65C9E, 0x0FC82E65, 0x067AB968, 0x0114CB93, 0x151F9772, 0x1271E589, 0x1BC37284, 0x1CAD007F,
+	0x5B45CADF, 0x5C2BB824, 0x55992F29, 0x52F75DD2, 0x46FC0133, 0x419273C8, 0x4820E4C5, 0x4F4E963E,
+	0x60365D07, 0x67582FFC, 0x6EEAB8F1, 0x6984CA0A, 0x7D8F96EB, 0x7AE1E410, 0x7353731D, 0x743D01E6,
+	0x2DA2E56F, 0x2ACC9794, 0x237E0099, 0x24107262, 0x301B2E83, 0x37755C78, 0x3EC7CB75, 0x39A9B98E,
+	0x16D172B7, 0x11BF004C, 0x180D9741, 0x1F63E5BA, 0x0B68B95B, 0x0C06CBA0, 0x05B45CAD, 0x02DA2E56,
+	// Seed 0x0A
+	0x00000000, 0xD02AC952, 0x61FE4099, 0xB1D489CB, 0xC3FC8132, 0x13D64860, 0xA202C1AB, 0x722808F9,
+	0x4652D059, 0x9678190B, 0x27AC90C0, 0xF7865992, 0x85AE516B, 0x55849839, 0xE45011F2, 0x347AD8A0,
+	0x8CA5A0B2, 0x5C8F69E0, 0xED5BE02B, 0x3D712979, 0x4F592180, 0x9F73E8D2, 0x2EA76119, 0xFE8DA84B,
+	0xCAF770EB, 0x1ADDB9B9, 0xAB093072, 0x7B23F920, 0x090BF1D9, 0xD921388B, 0x68F5B140, 0xB8DF7812,
+	0xD8E09359, 0x08CA5A0B, 0xB91ED3C0, 0x69341A92, 0x1B1C126B, 0xCB36DB39, 0x7AE252F2, 0xAAC89BA0,
+	0x9EB24300, 0x4E988A52, 0xFF4C0399, 0x2F66CACB, 0x5D4EC232, 0x8D640B60, 0x3CB082AB, 0xEC9A4BF9,
+	0x544533EB, 0x846FFAB9, 0x35BB7372, 0xE591BA20, 0x97B9B2D9, 0x47937B8B, 0xF647F240, 0x266D3B12,
+	0x1217E3B2, 0xC23D2AE0, 0x73E9A32B, 0xA3C36A79, 0xD1EB6280, 0x01C1ABD2, 0xB0152219, 0x603FEB4B,
+	0x706AF48F, 0xA0403DDD, 0x1194B416, 0xC1BE7D44, 0xB39675BD, 0x63BCBCEF, 0xD2683524, 0x0242FC76,
+	0x363824D6, 0xE612ED84, 0x57C6644F, 0x87ECAD1D, 0xF5C4A5E4, 0x25EE6CB6, 0x943AE57D, 0x44102C2F,
+	0xFCCF543D, 0x2CE59D6F, 0x9D3114A4, 0x4D1BDDF6, 0x3F33D50F, 0xEF191C5D, 0x5ECD9596, 0x8EE75CC4,
+	0xBA9D8464, 0x6AB74D36, 0xDB63C4FD, 0x0B490DAF, 0x79610556, 0xA94BCC04, 0x189F45CF, 0xC8B58C9D,
+	0xA88A67D6, 0x78A0AE84, 0xC974274F, 0x195EEE1D, 0x6B76E6E4, 0xBB5C2FB6, 0x0A88A67D, 0xDAA26F2F,
+	0xEED8B78F, 0x3EF27EDD, 0x8F26F716, 0x5F0C3E44, 0x2D2436BD, 0xFD0EFFEF, 0x4CDA7624, 0x9CF0BF76,
+	0x242FC764, 0xF4050E36, 0x45D187FD, 0x95FB4EAF, 0xE7D34656, 0x37F98F04, 0x862D06CF, 0x5607CF9D,
+	0x627D173D, 0xB257DE6F, 0x038357A4, 0xD3A99EF6, 0xA181960F, 0x71AB5F5D, 0xC07FD696, 0x10551FC4,
+	0xE0D5E91E, 0x30FF204C, 0x812BA987, 0x510160D5, 0x2329682C, 0xF303A17E, 0x42D728B5, 0x92FDE1E7,
+	0xA6873947, 0x76ADF015, 0xC77979DE, 0x1753B08C, 0x657BB875, 0xB5517127, 0x0485F8EC, 0xD4AF31BE,
+	0x6C7049AC, 0xBC5A80FE, 0x0D8E0935, 0xDDA4C067, 0xAF8CC89E, 0x7FA601CC, 0xCE728807, 0x1E584155,
+	0x2A2299F5, 0xFA0850A7, 0x4BDCD96C, 0x9BF6103E, 0xE9DE18C7, 0x39F4D195, 0x8820585E, 0x580A910C,
+	0x38357A47, 0xE81FB315, 0x59CB3ADE, 0x89E1F38C, 0xFBC9FB75, 0x2BE33227, 0x9A37BBEC, 0x4A1D72BE,
+	0x7E67AA1E, 0xAE4D634C, 0x1F99EA87, 0xCFB323D5, 0xBD9B2B2C, 0x6DB1E27E, 0xDC656BB5, 0x0C4FA2E7,
+	0xB490DAF5, 0x64BA13A7, 0xD56E9A6C, 0x0544533E, 0x776C5BC7, 0xA7469295, 0x16921B5E, 0xC6B8D20C,
+	0xF2C20AAC, 0x22E8C3FE, 0x933C4A35, 0x43168367, 0x313E8B9E, 0xE11442CC, 0x50C0CB07, 0x80EA0255,
+	0x90BF1D91, 0x4095D4C3, 0xF1415D08, 0x216B945A, 0x53439CA3, 0x836955F1, 0x32BDDC3A, 0xE2971568,
+	0xD6EDCDC8, 0x06C7049A, 0xB7138D51, 0x67394403, 0x15114CFA, 0xC53B85A8, 0x74EF0C63, 0xA4C5C531,
+	0x1C1ABD23, 0xCC307471, 0x7DE4FDBA, 0xADCE34E8, 0xDFE63C11, 0x0FCCF543, 0xBE187C88, 0x6E32B5DA,
+	0x5A486D7A, 0x8A62A428, 0x3BB62DE3, 0xEB9CE4B1, 0x99B4EC48, 0x499E251A, 0xF84AACD1, 0x28606583,
+	0x485F8EC8, 0x9875479A, 0x29A1CE51, 0xF98B0703, 0x8BA30FFA, 0x5B89C6A8, 0xEA5D4F63, 0x3A778631,
+	0x0E0D5E91, 0xDE2797C3, 0x6FF31E08, 0xBFD9D75A, 0xCDF1DFA3, 0x1DDB16F1, 0xAC0F9F3A, 0x7C255668,
+	0xC4FA2E7A, 0x14D0E728, 0xA5046EE3, 0x752EA7B1, 0x0706AF48, 0xD72C661A, 0x66F8EFD1, 0xB6D22683,
+	0x82A8FE23, 0x52823771, 0xE356BEBA, 0x337C77E8, 0x41547F11, 0x917EB643, 0x20AA3F88, 0xF080F6DA,
+	// Seed 0x0B
+	0x00000000, 0x13D5FE82, 0x27ABFD04, 0x347E0386, 0x4F57FA08, 0x5C82048A, 0x68FC070C, 0x7B29F98E,
+	0x9EAFF410, 0x8D7A0A92, 0xB9040914, 0xAAD1F796, 0xD1F80E18, 0xC22DF09A, 0xF653F31C, 0xE5860D9E,
+	0x12FA5B31, 0x012FA5B3, 0x3551A635, 0x268458B7, 0x5DADA139, 0x4E785FBB, 0x7A065C3D, 0x69D3A2BF,
+	0x8C55AF21, 0x9F8051A3, 0xABFE5225, 0xB82BACA7, 0xC3025529, 0xD0D7ABAB, 0xE4A9A82D, 0xF77C56AF,
+	0x25F4B662, 0x362148E0, 0x025F4B66, 0x118AB5E4, 0x6AA34C6A, 0x7976B2E8, 0x4D08B16E, 0x5EDD4FEC,
+	0xBB5B4272, 0xA88EBCF0, 0x9CF0BF76, 0x8F2541F4, 0xF40CB87A, 0xE7D946F8, 0xD3A7457E, 0xC072BBFC,
+	0x370EED53, 0x24DB13D1, 0x10A51057, 0x0370EED5, 0x7859175B, 0x6B8CE9D9, 0x5FF2EA5F, 0x4C2714DD,
+	0xA9A11943, 0xBA74E7C1, 0x8E0AE447, 0x9DDF1AC5, 0xE6F6E34B, 0xF5231DC9, 0xC15D1E4F, 0xD288E0CD,
+	0x4BE96CC4, 0x583C9246, 0x6C4291C0, 0x7F976F42, 0x04BE96CC, 0x176B684E, 0x23156BC8, 0x30C0954A,
+	0xD54698D4, 0xC6936656, 0xF2ED65D0, 0xE1389B52, 0x9A1162DC, 0x89C49C5E, 0xBDBA9FD8, 0xAE6F615A,
+	0x591337F5, 0x4AC6C977, 0x7EB8CAF1, 0x6D6D3473, 0x1644CDFD, 0x0591337F, 0x31EF30F9, 0x223ACE7B,
+	0xC7BCC3E5, 0xD4693D67, 0xE0173EE1, 0xF3C2C063, 0x88EB39ED, 0x9B3EC76F, 0xAF40C4E9, 0xBC953A6B,
+	0x6E1DDAA6, 0x7DC82424, 0x49B627A2, 0x5A63D920, 0x214A20AE, 0x329FDE2C, 0x06E1DDAA, 0x15342328,
+	0xF0B22EB6, 0xE367D034, 0xD719D3B2, 0xC4CC2D30, 0xBFE5D4BE, 0xAC302A3C, 0x984E29BA, 0x8B9BD738,
+	0x7CE78197, 0x6F327F15, 0x5B4C7C93, 0x48998211, 0x33B07B9F, 0x2065851D, 0x141B869B, 0x07CE7819,
+	0xE2487587, 0xF19D8B05, 0xC5E38883, 0xD6367601, 0xAD1F8F8F, 0xBECA710D, 0x8AB4728B, 0x99618C09,
+	0x97D2D988, 0x8407270A, 0xB079248C, 0xA3ACDA0E, 0xD8852380, 0xCB50DD02, 0xFF2EDE84, 0xECFB2006,
+	0x097D2D98, 0x1AA8D31A, 0x2ED6D09C, 0x3D032E1E, 0x462AD790, 0x55FF2912, 0x61812A94, 0x7254D416,
+	0x852882B9, 0x96FD7C3B, 0xA2837FBD, 0xB156813F, 0xCA7F78B1, 0xD9AA8633, 0xEDD485B5, 0xFE017B37,
+	0x1B8776A9, 0x0852882B, 0x3C2C8BAD, 0x2FF9752F, 0x54D08CA1, 0x47057223, 0x737B71A5, 0x60AE8F27,
+	0xB2266FEA, 0xA1F39168, 0x958D92EE, 0x86586C6C, 0xFD7195E2, 0xEEA46B60, 0xDADA68E6, 0xC90F9664,
+	0x2C899BFA, 0x3F5C6578, 0x0B2266FE, 0x18F7987C, 0x63DE61F2, 0x700B9F70, 0x44759CF6, 0x57A06274,
+	0xA0DC34DB, 0xB309CA59, 0x8777C9DF, 0x94A2375D, 0xEF8BCED3, 0xFC5E3051, 0xC82033D7, 0xDBF5CD55,
+	0x3E73C0CB, 0x2DA63E49, 0x19D83DCF, 0x0A0DC34D, 0x71243AC3, 0x62F1C441, 0x568FC7C7, 0x455A3945,
+	0xDC3BB54C, 0xCFEE4BCE, 0xFB904848, 0xE845B6CA, 0x936C4F44, 0x80B9B1C6, 0xB4C7B240, 0xA7124CC2,
+	0x4294415C, 0x5141BFDE, 0x653FBC58, 0x76EA42DA, 0x0DC3BB54, 0x1E1645D6, 0x2A684650, 0x39BDB8D2,
+	0xCEC1EE7D, 0xDD1410FF, 0xE96A1379, 0xFABFEDFB, 0x81961475, 0x9243EAF7, 0xA63DE971, 0xB5E817F3,
+	0x506E1A6D, 0x43BBE4EF, 0x77C5E769, 0x641019EB, 0x1F39E065, 0x0CEC1EE7, 0x38921D61, 0x2B47E3E3,
+	0xF9CF032E, 0xEA1AFDAC, 0xDE64FE2A, 0xCDB100A8, 0xB698F926, 0xA54D07A4, 0x91330422, 0x82E6FAA0,
+	0x6760F73E, 0x74B509BC, 0x40CB0A3A, 0x531EF4B8, 0x28370D36, 0x3BE2F3B4, 0x0F9CF032, 0x1C490EB0,
+	0xEB35581F, 0xF8E0A69D, 0xCC9EA51B, 0xDF4B5B99, 0xA462A217, 0xB7B75C95, 0x83C95F13, 0x901CA191,
+	0x759AAC0F, 0x664F528D, 0x5231510B, 0x41E4AF89, 0x3ACD5607, 0x2918A885, 0x1D66AB03, 0x0EB35581,
+	// Seed 0x0C
+	0x00000000, 0x0DC3BB54, 0x08EBEEFF, 0x052855AB, 0x02BB45A9, 0x0F78FEFD, 0x0A50AB56, 0x07931002,
+	0x05768B52, 0x08B53006, 0x0D9D65AD, 0x005EDEF9, 0x07CDCEFB, 0x0A0E75AF, 0x0F262004, 0x02E59B50,
+	0x0AED16A4, 0x072EADF0, 0x0206F85B, 0x0FC5430F, 0x0856530D, 0x0595E859, 0x00BDBDF2, 0x0D7E06A6,
+	0x0F9B9DF6, 0x025826A2, 0x07707309, 0x0AB3C85D, 0x0D20D85F, 0x00E3630B, 0x05CB36A0, 0x08088DF4,
+	0x06B6B51F, 0x0B750E4B, 0x0E5D5BE0, 0x039EE0B4, 0x040DF0B6, 0x09CE4BE2, 0x0CE61E49, 0x0125A51D,
+	0x03C03E4D, 0x0E038519, 0x0B2BD0B2, 0x06E86BE6, 0x017B7BE4, 0x0CB8C0B0, 0x0990951B, 0x04532E4F,
+	0x0C5BA3BB, 0x019818EF, 0x04B04D44, 0x0973F610, 0x0EE0E612, 0x03235D46, 0x060B08ED, 0x0BC8B3B9,
+	0x092D28E9, 0x04EE93BD, 0x01C6C616, 0x0C057D42, 0x0B966D40, 0x0655D614, 0x037D83BF, 0x0EBE38EB,
+	0x0D6D6A3E, 0x00AED16A, 0x058684C1, 0x08453F95, 0x0FD62F97, 0x021594C3, 0x073DC168, 0x0AFE7A3C,
+	0x081BE16C, 0x05D85A38, 0x00F00F93, 0x0D33B4C7, 0x0AA0A4C5, 0x07631F91, 0x024B4A3A, 0x0F88F16E,
+	0x07807C9A, 0x0A43C7CE, 0x0F6B9265, 0x02A82931, 0x053B3933, 0x08F88267, 0x0DD0D7CC, 0x00136C98,
+	0x02F6F7C8, 0x0F354C9C, 0x0A1D1937, 0x07DEA263, 0x004DB261, 0x0D8E0935, 0x08A65C9E, 0x0565E7CA,
+	0x0BDBDF21, 0x06186475, 0x033031DE, 0x0EF38A8A, 0x09609A88, 0x04A321DC, 0x018B7477, 0x0C48CF23,
+	0x0EAD5473, 0x036EEF27, 0x0646BA8C, 0x0B8501D8, 0x0C1611DA, 0x01D5AA8E, 0x04FDFF25, 0x093E4471,
+	0x0136C985, 0x0CF572D1, 0x09DD277A, 0x041E9C2E, 0x038D8C2C, 0x0E4E3778, 0x0B6662D3, 0x06A5D987,
+	0x044042D7, 0x0983F983, 0x0CABAC28, 0x0168177C, 0x06FB077E, 0x0B38BC2A, 0x0E10E981, 0x03D352D5,
+	0x09B64C2B, 0x0475F77F, 0x015DA2D4, 0x0C9E1980, 0x0B0D0982, 0x06CEB2D6, 0x03E6E77D, 0x0E255C29,
+	0x0CC0C779, 0x01037C2D, 0x042B2986, 0x09E892D2, 0x0E7B82D0, 0x03B83984, 0x06906C2F, 0x0B53D77B,
+	0x035B5A8F, 0x0E98E1DB, 0x0BB0B470, 0x06730F24, 0x01E01F26, 0x0C23A472, 0x090BF1D9, 0x04C84A8D,
+	0x062DD1DD, 0x0BEE6A89, 0x0EC63F22, 0x03058476, 0x04969474, 0x09552F20, 0x0C7D7A8B, 0x01BEC1DF,
+	0x0F00F934, 0x02C34260, 0x07EB17CB, 0x0A28AC9F, 0x0DBBBC9D, 0x007807C9, 0x05505262, 0x0893E936,
+	0x0A767266, 0x07B5C932, 0x029D9C99, 0x0F5E27CD, 0x08CD37CF, 0x050E8C9B, 0x0026D930, 0x0DE56264,
+	0x05EDEF90, 0x082E54C4, 0x0D06016F, 0x00C5BA3B, 0x0756AA39, 0x0A95116D, 0x0FBD44C6, 0x027EFF92,
+	0x009B64C2, 0x0D58DF96, 0x08708A3D, 0x05B33169, 0x0220216B, 0x0FE39A3F, 0x0ACBCF94, 0x070874C0,
+	0x04DB2615, 0x09189D41, 0x0C30C8EA, 0x01F373BE, 0x066063BC, 0x0BA3D8E8, 0x0E8B8D43, 0x03483617,
+	0x01ADAD47, 0x0C6E1613, 0x094643B8, 0x0485F8EC, 0x0316E8EE, 0x0ED553BA, 0x0BFD0611, 0x063EBD45,
+	0x0E3630B1, 0x03F58BE5, 0x06DDDE4E, 0x0B1E651A, 0x0C8D7518, 0x014ECE4C, 0x04669BE7, 0x09A520B3,
+	0x0B40BBE3, 0x068300B7, 0x03AB551C, 0x0E68EE48, 0x09FBFE4A, 0x0438451E, 0x011010B5, 0x0CD3ABE1,
+	0x026D930A, 0x0FAE285E, 0x0A867DF5, 0x0745C6A1, 0x00D6D6A3, 0x0D156DF7, 0x083D385C, 0x05FE8308,
+	0x071B1858, 0x0AD8A30C, 0x0FF0F6A7, 0x02334DF3, 0x05A05DF1, 0x0863E6A5, 0x0D4BB30E, 0x0088085A,
+	0x088085AE, 0x05433EFA, 0x006B6B51, 0x0DA8D005, 0x0A3BC007, 0x07F87B53, 0x02D02EF8, 0x0F1395AC,
+	0x0DF60EFC, 0x0035B5A8, 0x051DE003, 0x08DE5B57, 0x0F4D4B55, 0x028EF001, 0x07A6A5AA, 0x0A651EFE,
+	// Seed 0x0D
+	0x00000000, 0x1D5E73C1, 0x3ABCE782, 0x27E29443, 0x7579CF04, 0x6827BCC5, 0x4FC52886, 0x529B5B47,
+	0x17916773, 0x0ACF14B2, 0x2D2D80F1, 0x3073F330, 0x62E8A877, 0x7FB6DBB6, 0x58544FF5, 0x450A3C34,
+	0x2F22CEE6, 0x327CBD27, 0x159E2964, 0x08C05AA5, 0x5A5B01E2, 0x47057223, 0x60E7E660, 0x7DB995A1,
+	0x38B3A995, 0x25EDDA54, 0x020F4E17, 0x1F513DD6, 0x4DCA6691, 0x50941550, 0x77768113, 0x6A28F2D2,
+	0x5E459DCC, 0x431BEE0D, 0x64F97A4E, 0x79A7098F, 0x2B3C52C8, 0x36622109, 0x1180B54A, 0x0CDEC68B,
+	0x49D4FABF, 0x548A897E, 0x73681D3D, 0x6E366EFC, 0x3CAD35BB, 0x21F3467A, 0x0611D239, 0x1B4FA1F8,
+	0x7167532A, 0x6C3920EB, 0x4BDBB4A8, 0x5685C769, 0x041E9C2E, 0x1940EFEF, 0x3EA27BAC, 0x23FC086D,
+	0x66F63459, 0x7BA84798, 0x5C4AD3DB, 0x4114A01A, 0x138FFB5D, 0x0ED1889C, 0x29331CDF, 0x346D6F1E,
+	0x41E9C2E3, 0x5CB7B122, 0x7B552561, 0x660B56A0, 0x34900DE7, 0x29CE7E26, 0x0E2CEA65, 0x137299A4,
+	0x5678A590, 0x4B26D651, 0x6CC44212, 0x719A31D3, 0x23016A94, 0x3E5F1955, 0x19BD8D16, 0x04E3FED7,
+	0x6ECB0C05, 0x73957FC4, 0x5477EB87, 0x49299846, 0x1BB2C301, 0x06ECB0C0, 0x210E2483, 0x3C505742,
+	0x795A6B76, 0x640418B7, 0x43E68CF4, 0x5EB8FF35, 0x0C23A472, 0x117DD7B3, 0x369F43F0, 0x2BC13031,
+	0x1FAC5F2F, 0x02F22CEE, 0x2510B8AD, 0x384ECB6C, 0x6AD5902B, 0x778BE3EA, 0x506977A9, 0x4D370468,
+	0x083D385C, 0x15634B9D, 0x3281DFDE, 0x2FDFAC1F, 0x7D44F758, 0x601A8499, 0x47F810DA, 0x5AA6631B,
+	0x308E91C9, 0x2DD0E208, 0x0A32764B, 0x176C058A, 0x45F75ECD, 0x58A92D0C, 0x7F4BB94F, 0x6215CA8E,
+	0x271FF6BA, 0x3A41857B, 0x1DA31138, 0x00FD62F9, 0x526639BE, 0x4F384A7F, 0x68DADE3C, 0x7584ADFD,
+	0x7EB17CBD, 0x63EF0F7C, 0x440D9B3F, 0x5953E8FE, 0x0BC8B3B9, 0x1696C078, 0x3174543B, 0x2C2A27FA,
+	0x69201BCE, 0x747E680F, 0x539CFC4C, 0x4EC28F8D, 0x1C59D4CA, 0x0107A70B, 0x26E53348, 0x3BBB4089,
+	0x5193B25B, 0x4CCDC19A, 0x6B2F55D9, 0x76712618, 0x24EA7D5F, 0x39B40E9E, 0x1E569ADD, 0x0308E91C,
+	0x4602D528, 0x5B5CA6E9, 0x7CBE32AA, 0x61E0416B, 0x337B1A2C, 0x2E2569ED, 0x09C7FDAE, 0x14998E6F,
+	0x20F4E171, 0x3DAA92B0, 0x1A4806F3, 0x07167532, 0x558D2E75, 0x48D35DB4, 0x6F31C9F7, 0x726FBA36,
+	0x37658602, 0x2A3BF5C3, 0x0DD96180, 0x10871241, 0x421C4906, 0x5F423AC7, 0x78A0AE84, 0x65FEDD45,
+	0x0FD62F97, 0x12885C56, 0x356AC815, 0x2834BBD4, 0x7AAFE093, 0x67F19352, 0x40130711, 0x5D4D74D0,
+	0x184748E4, 0x05193B25, 0x22FBAF66, 0x3FA5DCA7, 0x6D3E87E0, 0x7060F421, 0x57826062, 0x4ADC13A3,
+	0x3F58BE5E, 0x2206CD9F, 0x05E459DC, 0x18BA2A1D, 0x4A21715A, 0x577F029B, 0x709D96D8, 0x6DC3E519,
+	0x28C9D92D, 0x3597AAEC, 0x12753EAF, 0x0F2B4D6E, 0x5DB01629, 0x40EE65E8, 0x670CF1AB, 0x7A52826A,
+	0x107A70B8, 0x0D240379, 0x2AC6973A, 0x3798E4FB, 0x6503BFBC, 0x785DCC7D, 0x5FBF583E, 0x42E12BFF,
+	0x07EB17CB, 0x1AB5640A, 0x3D57F049, 0x20098388, 0x7292D8CF, 0x6FCCAB0E, 0x482E3F4D, 0x55704C8C,
+	0x611D2392, 0x7C435053, 0x5BA1C410, 0x46FFB7D1, 0x1464EC96, 0x093A9F57, 0x2ED80B14, 0x338678D5,
+	0x768C44E1, 0x6BD23720, 0x4C30A363, 0x516ED0A2, 0x03F58BE5, 0x1EABF824, 0x39496C67, 0x24171FA6,
+	0x4E3FED74, 0x53619EB5, 0x74830AF6, 0x69DD7937, 0x3B462270, 0x261851B1, 0x01FAC5F2, 0x1CA4B633,
+	0x59AE8A07, 0x44F0F9C6, 0x63126D85, 0x7E4C1E44, 0x2CD74503, 0x318936C2, 0x166BA281, 0x0B35D140,
+	// Seed 0x0E
+	0x00000000, 0x27489E0F, 0x4E913C1E, 0x69D9A211, 0x9D22783C, 0xBA6AE633, 0xD3B34422, 0xF4FBDA2D,
+	0xF534AA77, 0xD27C3478, 0xBBA59669, 0x9CED0866, 0x6816D24B, 0x4F5E4C44, 0x2687EE55, 0x01CF705A,
+	0x25190EE1, 0x025190EE, 0x6B8832FF, 0x4CC0ACF0, 0xB83B76DD, 0x9F73E8D2, 0xF6AA4AC3, 0xD1E2D4CC,
+	0xD02DA496, 0xF7653A99, 0x9EBC9888, 0xB9F40687, 0x4D0FDCAA, 0x6A4742A5, 0x039EE0B4, 0x24D67EBB,
+	0x4A321DC2, 0x6D7A83CD, 0x04A321DC, 0x23EBBFD3, 0xD71065FE, 0xF058FBF1, 0x998159E0, 0xBEC9C7EF,
+	0xBF06B7B5, 0x984E29BA, 0xF1978BAB, 0xD6DF15A4, 0x2224CF89, 0x056C5186, 0x6CB5F397, 0x4BFD6D98,
+	0x6F2B1323, 0x48638D2C, 0x21BA2F3D, 0x06F2B132, 0xF2096B1F, 0xD541F510, 0xBC985701, 0x9BD0C90E,
+	0x9A1FB954, 0xBD57275B, 0xD48E854A, 0xF3C61B45, 0x073DC168, 0x20755F67, 0x49ACFD76, 0x6EE46379,
+	0x94643B84, 0xB32CA58B, 0xDAF5079A, 0xFDBD9995, 0x094643B8, 0x2E0EDDB7, 0x47D77FA6, 0x609FE1A9,
+	0x615091F3, 0x46180FFC, 0x2FC1ADED, 0x088933E2, 0xFC72E9CF, 0xDB3A77C0, 0xB2E3D5D1, 0x95AB4BDE,
+	0xB17D3565, 0x9635AB6A, 0xFFEC097B, 0xD8A49774, 0x2C5F4D59, 0x0B17D356, 0x62CE7147, 0x4586EF48,
+	0x44499F12, 0x6301011D, 0x0AD8A30C, 0x2D903D03, 0xD96BE72E, 0xFE237921, 0x97FADB30, 0xB0B2453F,
+	0xDE562646, 0xF91EB849, 0x90C71A58, 0xB78F8457, 0x43745E7A, 0x643CC075, 0x0DE56264, 0x2AADFC6B,
+	0x2B628C31, 0x0C2A123E, 0x65F3B02F, 0x42BB2E20, 0xB640F40D, 0x91086A02, 0xF8D1C813, 0xDF99561C,
+	0xFB4F28A7, 0xDC07B6A8, 0xB5DE14B9, 0x92968AB6, 0x666D509B, 0x4125CE94, 0x28FC6C85, 0x0FB4F28A,
+	0x0E7B82D0, 0x29331CDF, 0x40EABECE, 0x67A220C1, 0x9359FAEC, 0xB41164E3, 0xDDC8C6F2, 0xFA8058FD,
+	0xE7B82D07, 0xC0F0B308, 0xA9291119, 0x8E618F16, 0x7A9A553B, 0x5DD2CB34, 0x340B6925, 0x1343F72A,
+	0x128C8770, 0x35C4197F, 0x5C1DBB6E, 0x7B552561, 0x8FAEFF4C, 0xA8E66143, 0xC13FC352, 0xE6775D5D,
+	0xC2A123E6, 0xE5E9BDE9, 0x8C301FF8, 0xAB7881F7, 0x5F835BDA, 0x78CBC5D5, 0x111267C4, 0x365AF9CB,
+	0x37958991, 0x10DD179E, 0x7904B58F, 0x5E4C2B80, 0xAAB7F1AD, 0x8DFF6FA2, 0xE426CDB3, 0xC36E53BC,
+	0xAD8A30C5, 0x8AC2AECA, 0xE31B0CDB, 0xC45392D4, 0x30A848F9, 0x17E0D6F6, 0x7E3974E7, 0x5971EAE8,
+	0x58BE9AB2, 0x7FF604BD, 0x162FA6AC, 0x316738A3, 0xC59CE28E, 0xE2D47C81, 0x8B0DDE90, 0xAC45409F,
+	0x88933E24, 0xAFDBA02B, 0xC602023A, 0xE14A9C35, 0x15B14618, 0x32F9D817, 0x5B207A06, 0x7C68E409,
+	0x7DA79453, 0x5AEF0A5C, 0x3336A84D, 0x147E3642, 0xE085EC6F, 0xC7CD7260, 0xAE14D071, 0x895C4E7E,
+	0x73DC1683, 0x5494888C, 0x3D4D2A9D, 0x1A05B492, 0xEEFE6EBF, 0xC9B6F0B0, 0xA06F52A1, 0x8727CCAE,
+	0x86E8BCF4, 0xA1A022FB, 0xC87980EA, 0xEF311EE5, 0x1BCAC4C8, 0x3C825AC7, 0x555BF8D6, 0x721366D9,
+	0x56C51862, 0x718D866D, 0x1854247C, 0x3F1CBA73, 0xCBE7605E, 0xECAFFE51, 0x85765C40, 0xA23EC24F,
+	0xA3F1B215, 0x84B92C1A, 0xED608E0B, 0xCA281004, 0x3ED3CA29, 0x199B5426, 0x7042F637, 0x570A6838,
+	0x39EE0B41, 0x1EA6954E, 0x777F375F, 0x5037A950, 0xA4CC737D, 0x8384ED72, 0xEA5D4F63, 0xCD15D16C,
+	0xCCDAA136, 0xEB923F39, 0x824B9D28, 0xA5030327, 0x51F8D90A, 0x76B04705, 0x1F69E514, 0x38217B1B,
+	0x1CF705A0, 0x3BBF9BAF, 0x526639BE, 0x752EA7B1, 0x81D57D9C, 0xA69DE393, 0xCF444182, 0xE80CDF8D,
+	0xE9C3AFD7, 0xCE8B31D8, 0xA75293C9, 0x801A0DC6, 0x74E1D7EB, 0x53A949E4, 0x3A70EBF5, 0x1D3875FA,
+	// Seed 0x0F
+	0x00000000, 0x54A5E602, 0xA94BCC04, 0xFDEE2A06, 0x73E9A32B, 0x274C4529, 0xDAA26F2F, 0x8E07892D,
+	0xE7D34656, 0xB376A054, 0x4E988A52, 0x1A3D6C50, 0x943AE57D, 0xC09F037F, 0x3D712979, 0x69D4CF7B,
+	0xEED8B78F, 0xBA7D518D, 0x47937B8B, 0x13369D89, 0x9D3114A4, 0xC994F2A6, 0x347AD8A0, 0x60DF3EA2,
+	0x090BF1D9, 0x5DAE17DB, 0xA0403DDD, 0xF4E5DBDF, 0x7AE252F2, 0x2E47B4F0, 0xD3A99EF6, 0x870C78F4,
+	0xFCCF543D, 0xA86AB23F, 0x55849839, 0x01217E3B, 0x8F26F716, 0xDB831114, 0x266D3B12, 0x72C8DD10,
+	0x1B1C126B, 0x4FB9F469, 0xB257DE6F, 0xE6F2386D, 0x68F5B140, 0x3C505742, 0xC1BE7D44, 0x951B9B46,
+	0x1217E3B2, 0x46B205B0, 0xBB5C2FB6, 0xEFF9C9B4, 0x61FE4099, 0x355BA69B, 0xC8B58C9D, 0x9C106A9F,
+	0xF5C4A5E4, 0xA16143E6, 0x5C8F69E0, 0x082A8FE2, 0x862D06CF, 0xD288E0CD, 0x2F66CACB, 0x7BC32CC9,
+	0xD8E09359, 0x8C45755B, 0x71AB5F5D, 0x250EB95F, 0xAB093072, 0xFFACD670, 0x0242FC76, 0x56E71A74,
+	0x3F33D50F, 0x6B96330D, 0x9678190B, 0xC2DDFF09, 0x4CDA7624, 0x187F9026, 0xE591BA20, 0xB1345C22,
+	0x363824D6, 0x629DC2D4, 0x9F73E8D2, 0xCBD60ED0, 0x45D187FD, 0x117461FF, 0xEC9A4BF9, 0xB83FADFB,
+	0xD1EB6280, 0x854E8482, 0x78A0AE84, 0x2C054886, 0xA202C1AB, 0xF6A727A9, 0x0B490DAF, 0x5FECEBAD,
+	0x242FC764, 0x708A2166, 0x8D640B60, 0xD9C1ED62, 0x57C6644F, 0x0363824D, 0xFE8DA84B, 0xAA284E49,
+	0xC3FC8132, 0x97596730, 0x6AB74D36, 0x3E12AB34, 0xB0152219, 0xE4B0C41B, 0x195EEE1D, 0x4DFB081F,
+	0xCAF770EB, 0x9E5296E9, 0x63BCBCEF, 0x37195AED, 0xB91ED3C0, 0xEDBB35C2, 0x10551FC4, 0x44F0F9C6,
+	0x2D2436BD, 0x7981D0BF, 0x846FFAB9, 0xD0CA1CBB, 0x5ECD9596, 0x0A687394, 0xF7865992, 0xA323BF90,
+	0x90BF1D91, 0xC41AFB93, 0x39F4D195, 0x6D513797, 0xE356BEBA, 0xB7F358B8, 0x4A1D72BE, 0x1EB894BC,
+	0x776C5BC7, 0x23C9BDC5, 0xDE2797C3, 0x8A8271C1, 0x0485F8EC, 0x50201EEE, 0xADCE34E8, 0xF96BD2EA,
+	0x7E67AA1E, 0x2AC24C1C, 0xD72C661A, 0x83898018, 0x0D8E0935, 0x592BEF37, 0xA4C5C531, 0xF0602333,
+	0x99B4EC48, 0xCD110A4A, 0x30FF204C, 0x645AC64E, 0xEA5D4F63, 0xBEF8A961, 0x43168367, 0x17B36565,
+	0x6C7049AC, 0x38D5AFAE, 0xC53B85A8, 0x919E63AA, 0x1F99EA87, 0x4B3C0C85, 0xB6D22683, 0xE277C081,
+	0x8BA30FFA, 0xDF06E9F8, 0x22E8C3FE, 0x764D25FC, 0xF84AACD1, 0xACEF4AD3, 0x510160D5, 0x05A486D7,
+	0x82A8FE23, 0xD60D1821, 0x2BE33227, 0x7F46D425, 0xF1415D08, 0xA5E4BB0A, 0x580A910C, 0x0CAF770E,
+	0x657BB875, 0x31DE5E77, 0xCC307471, 0x98959273, 0x16921B5E, 0x4237FD5C, 0xBFD9D75A, 0xEB7C3158,
+	0x485F8EC8, 0x1CFA68CA, 0xE11442CC, 0xB5B1A4CE, 0x3BB62DE3, 0x6F13CBE1, 0x92FDE1E7, 0xC65807E5,
+	0xAF8CC89E, 0xFB292E9C, 0x06C7049A, 0x5262E298, 0xDC656BB5, 0x88C08DB7, 0x752EA7B1, 0x218B41B3,
+	0xA6873947, 0xF222DF45, 0x0FCCF543, 0x5B691341, 0xD56E9A6C, 0x81CB7C6E, 0x7C255668, 0x2880B06A,
+	0x41547F11, 0x15F19913, 0xE81FB315, 0xBCBA5517, 0x32BDDC3A, 0x66183A38, 0x9BF6103E, 0xCF53F63C,
+	0xB490DAF5, 0xE0353CF7, 0x1DDB16F1, 0x497EF0F3, 0xC77979DE, 0x93DC9FDC, 0x6E32B5DA, 0x3A9753D8,
+	0x53439CA3, 0x07E67AA1, 0xFA0850A7, 0xAEADB6A5, 0x20AA3F88, 0x740FD98A, 0x89E1F38C, 0xDD44158E,
+	0x5A486D7A, 0x0EED8B78, 0xF303A17E, 0xA7A6477C, 0x29A1CE51, 0x7D042853, 0x80EA0255, 0xD44FE457,
+	0xBD9B2B2C, 0xE93ECD2E, 0x14D0E728, 0x4075012A, 0xCE728807, 0x9AD76E05, 0x67394403, 0x339CA201,
+	// Seed 0x10
+	0x00000000, 0x1C570F42, 0x03C03E4D, 0x1F97310F, 0x07807C9A, 0x1BD773D8, 0x044042D7, 0x18174D95,
+	0x0F00F934, 0x1357F676, 0x0CC0C779, 0x1097C83B, 0x088085AE, 0x14D78AEC, 0x0B40BBE3, 0x1717B4A1,
+	0x1E01F268, 0x0256FD2A, 0x1DC1CC25, 0x0196C367, 0x19818EF2, 0x05D681B0, 0x1A41B0BF, 0x0616BFFD,
+	0x11010B5C, 0x0D56041E, 0x12C13511, 0x0E963A53, 0x168177C6, 0x0AD67884, 0x1541498B, 0x091646C9,
+	0x076DC419, 0x1B3ACB5B, 0x04ADFA54, 0x18FAF516, 0x00EDB883, 0x1CBAB7C1, 0x032D86CE, 0x1F7A898C,
+	0x086D3D2D, 0x143A326F, 0x0BAD0360, 0x17FA0C22, 0x0FED41B7, 0x13BA4EF5, 0x0C2D7FFA, 0x107A70B8,
+	0x196C3671, 0x053B3933, 0x1AAC083C, 0x06FB077E, 0x1EEC4AEB, 0x02BB45A9, 0x1D2C74A6, 0x017B7BE4,
+	0x166CCF45, 0x0A3BC007, 0x15ACF108, 0x09FBFE4A, 0x11ECB3DF, 0x0DBBBC9D, 0x122C8D92, 0x0E7B82D0,
+	0x0EDB8832, 0x128C8770, 0x0D1BB67F, 0x114CB93D, 0x095BF4A8, 0x150CFBEA, 0x0A9BCAE5, 0x16CCC5A7,
+	0x01DB7106, 0x1D8C7E44, 0x021B4F4B, 0x1E4C4009, 0x065B0D9C, 0x1A0C02DE, 0x059B33D1, 0x19CC3C93,
+	0x10DA7A5A, 0x0C8D7518, 0x131A4417, 0x0F4D4B55, 0x175A06C0, 0x0B0D0982, 0x149A388D, 0x08CD37CF,
+	0x1FDA836E, 0x038D8C2C, 0x1C1ABD23, 0x004DB261, 0x185AFFF4, 0x040DF0B6, 0x1B9AC1B9, 0x07CDCEFB,
+	0x09B64C2B, 0x15E14369, 0x0A767266, 0x16217D24, 0x0E3630B1, 0x12613FF3, 0x0DF60EFC, 0x11A101BE,
+	0x06B6B51F, 0x1AE1BA5D, 0x05768B52, 0x19218410, 0x0136C985, 0x1D61C6C7, 0x02F6F7C8, 0x1EA1F88A,
+	0x17B7BE43, 0x0BE0B101, 0x1477800E, 0x08208F4C, 0x1037C2D9, 0x0C60CD9B, 0x13F7FC94, 0x0FA0F3D6,
+	0x18B74777, 0x04E04835, 0x1B77793A, 0x07207678, 0x1F373BED, 0x036034AF, 0x1CF705A0, 0x00A00AE2,
+	0x1DB71064, 0x01E01F26, 0x1E772E29, 0x0220216B, 0x1A376CFE, 0x066063BC, 0x19F752B3, 0x05A05DF1,
+	0x12B7E950, 0x0EE0E612, 0x1177D71D, 0x0D20D85F, 0x153795CA, 0x09609A88, 0x16F7AB87, 0x0AA0A4C5,
+	0x03B6E20C, 0x1FE1ED4E, 0x0076DC41, 0x1C21D303, 0x04369E96, 0x186191D4, 0x07F6A0DB, 0x1BA1AF99,
+	0x0CB61B38, 0x10E1147A, 0x0F762575, 0x13212A37, 0x0B3667A2, 0x176168E0, 0x08F659EF, 0x14A156AD,
+	0x1ADAD47D, 0x068DDB3F, 0x191AEA30, 0x054DE572, 0x1D5AA8E7, 0x010DA7A5, 0x1E9A96AA, 0x02CD99E8,
+	0x15DA2D49, 0x098D220B, 0x161A1304, 0x0A4D1C46, 0x125A51D3, 0x0E0D5E91, 0x119A6F9E, 0x0DCD60DC,
+	0x04DB2615, 0x188C2957, 0x071B1858, 0x1B4C171A, 0x035B5A8F, 0x1F0C55CD, 0x009B64C2, 0x1CCC6B80,
+	0x0BDBDF21, 0x178CD063, 0x081BE16C, 0x144CEE2E, 0x0C5BA3BB, 0x100CACF9, 0x0F9B9DF6, 0x13CC92B4,
+	0x136C9856, 0x0F3B9714, 0x10ACA61B, 0x0CFBA959, 0x14ECE4CC, 0x08BBEB8E, 0x172CDA81, 0x0B7BD5C3,
+	0x1C6C6162, 0x003B6E20, 0x1FAC5F2F, 0x03FB506D, 0x1BEC1DF8, 0x07BB12BA, 0x182C23B5, 0x047B2CF7,
+	0x0D6D6A3E, 0x113A657C, 0x0EAD5473, 0x12FA5B31, 0x0AED16A4, 0x16BA19E6, 0x092D28E9, 0x157A27AB,
+	0x026D930A, 0x1E3A9C48, 0x01ADAD47, 0x1DFAA205, 0x05EDEF90, 0x19BAE0D2, 0x062DD1DD, 0x1A7ADE9F,
+	0x14015C4F, 0x0856530D, 0x17C16202, 0x0B966D40, 0x138120D5, 0x0FD62F97, 0x10411E98, 0x0C1611DA,
+	0x1B01A57B, 0x0756AA39, 0x18C19B36, 0x04969474, 0x1C81D9E1, 0x00D6D6A3, 0x1F41E7AC, 0x0316E8EE,
+	0x0A00AE27, 0x1657A165, 0x09C0906A, 0x15979F28, 0x0D80D2BD, 0x11D7DDFF, 0x0E40ECF0, 0x1217E3B2,
+	0x05005713, 0x19575851, 0x06C0695E, 0x1A97661C, 0x02802B89, 0x1ED724CB, 0x014015C4, 0x1D171A86,
+	// Seed 0x11
+	0x00000000, 0x7ECACD96, 0x28F5DAC9, 0x563F175F, 0x51EBB592, 0x2F217804, 0x791E6F5B, 0x07D4A2CD,
+	0x76B72AC1, 0x087DE757, 0x5E42F008, 0x20883D9E, 0x275C9F53, 0x599652C5, 0x0FA9459A, 0x7163880C,
+	0x380E1467, 0x46C4D9F1, 0x10FBCEAE, 0x6E310338, 0x69E5A1F5, 0x172F6C63, 0x41107B3C, 0x3FDAB6AA,
+	0x4EB93EA6, 0x3073F330, 0x664CE46F, 0x188629F9, 0x1F528B34, 0x619846A2, 0x37A751FD, 0x496D9C6B,
+	0x701C28CE, 0x0ED6E558, 0x58E9F207, 0x26233F91, 0x21F79D5C, 0x5F3D50CA, 0x09024795, 0x77C88A03,
+	0x06AB020F, 0x7861CF99, 0x2E5ED8C6, 0x50941550, 0x5740B79D, 0x298A7A0B, 0x7FB56D54, 0x017FA0C2,
+	0x48123CA9, 0x36D8F13F, 0x60E7E660, 0x1E2D2BF6, 0x19F9893B, 0x673344AD, 0x310C53F2, 0x4FC69E64,
+	0x3EA51668, 0x406FDBFE, 0x1650CCA1, 0x689A0137, 0x6F4EA3FA, 0x11846E6C, 0x47BB7933, 0x3971B4A5,
+	0x35581079, 0x4B92DDEF, 0x1DADCAB0, 0x63670726, 0x64B3A5EB, 0x1A79687D, 0x4C467F22, 0x328CB2B4,
+	0x43EF3AB8, 0x3D25F72E, 0x6B1AE071, 0x15D02DE7, 0x12048F2A, 0x6CCE42BC, 0x3AF155E3, 0x443B9875,
+	0x0D56041E, 0x739CC988, 0x25A3DED7, 0x5B691341, 0x5CBDB18C, 0x22777C1A, 0x74486B45, 0x0A82A6D3,
+	0x7BE12EDF, 0x052BE349, 0x5314F416, 0x2DDE3980, 0x2A0A9B4D, 0x54C056DB, 0x02FF4184, 0x7C358C12,
+	0x454438B7, 0x3B8EF521, 0x6DB1E27E, 0x137B2FE8, 0x14AF8D25, 0x6A6540B3, 0x3C5A57EC, 0x42909A7A,
+	0x33F31276, 0x4D39DFE0, 0x1B06C8BF, 0x65CC0529, 0x6218A7E4, 0x1CD26A72, 0x4AED7D2D, 0x3427B0BB,
+	0x7D4A2CD0, 0x0380E146, 0x55BFF619, 0x2B753B8F, 0x2CA19942, 0x526B54D4, 0x0454438B, 0x7A9E8E1D,
+	0x0BFD0611, 0x7537CB87, 0x2308DCD8, 0x5DC2114E, 0x5A16B383, 0x24DC7E15, 0x72E3694A, 0x0C29A4DC,
+	0x6AB020F2, 0x147AED64, 0x4245FA3B, 0x3C8F37AD, 0x3B5B9560, 0x459158F6, 0x13AE4FA9, 0x6D64823F,
+	0x1C070A33, 0x62CDC7A5, 0x34F2D0FA, 0x4A381D6C, 0x4DECBFA1, 0x33267237, 0x65196568, 0x1BD3A8FE,
+	0x52BE3495, 0x2C74F903, 0x7A4BEE5C, 0x048123CA, 0x03558107, 0x7D9F4C91, 0x2BA05BCE, 0x556A9658,
+	0x24091E54, 0x5AC3D3C2, 0x0CFCC49D, 0x7236090B, 0x75E2ABC6, 0x0B286650, 0x5D17710F, 0x23DDBC99,
+	0x1AAC083C, 0x6466C5AA, 0x3259D2F5, 0x4C931F63, 0x4B47BDAE, 0x358D7038, 0x63B26767, 0x1D78AAF1,
+	0x6C1B22FD, 0x12D1EF6B, 0x44EEF834, 0x3A2435A2, 0x3DF0976F, 0x433A5AF9, 0x15054DA6, 0x6BCF8030,
+	0x22A21C5B, 0x5C68D1CD, 0x0A57C692, 0x749D0B04, 0x7349A9C9, 0x0D83645F, 0x5BBC7300, 0x2576BE96,
+	0x5415369A, 0x2ADFFB0C, 0x7CE0EC53, 0x022A21C5, 0x05FE8308, 0x7B344E9E, 0x2D0B59C1, 0x53C19457,
+	0x5FE8308B, 0x2122FD1D, 0x771DEA42, 0x09D727D4, 0x0E038519, 0x70C9488F, 0x26F65FD0, 0x583C9246,
+	0x295F1A4A, 0x5795D7DC, 0x01AAC083, 0x7F600D15, 0x78B4AFD8, 0x067E624E, 0x50417511, 0x2E8BB887,
+	0x67E624EC, 0x192CE97A, 0x4F13FE25, 0x31D933B3, 0x360D917E, 0x48C75CE8, 0x1EF84BB7, 0x60328621,
+	0x11510E2D, 0x6F9BC3BB, 0x39A4D4E4, 0x476E1972, 0x40BABBBF, 0x3E707629, 0x684F6176, 0x1685ACE0,
+	0x2FF41845, 0x513ED5D3, 0x0701C28C, 0x79CB0F1A, 0x7E1FADD7, 0x00D56041, 0x56EA771E, 0x2820BA88,
+	0x59433284, 0x2789FF12, 0x71B6E84D, 0x0F7C25DB, 0x08A88716, 0x76624A80, 0x205D5DDF, 0x5E979049,
+	0x17FA0C22, 0x6930C1B4, 0x3F0FD6EB, 0x41C51B7D, 0x4611B9B0, 0x38DB7426, 0x6EE46379, 0x102EAEEF,
+	0x614D26E3, 0x1F87EB75, 0x49B8FC2A, 0x377231BC, 0x30A69371, 0x4E6C5EE7, 0x185349B8, 0x6699842E,
+	// Seed 0x12
+	0x00000000, 0xEC203D83, 0x3F229997, 0xD302A414, 0x7E45332E, 0x92650EAD, 0x4167AAB9, 0xAD47973A,
+	0xFC8A665C, 0x10AA5BDF, 0xC3A8FFCB, 0x2F88C248, 0x82CF5572, 0x6EEF68F1, 0xBDEDCCE5, 0x51CDF166,
+	0x1E762E29, 0xF25613AA, 0x2154B7BE, 0xCD748A3D, 0x60331D07, 0x8C132084, 0x5F118490, 0xB331B913,
+	0xE2FC4875, 0x0EDC75F6, 0xDDDED1E2, 0x31FEEC61, 0x9CB97B5B, 0x709946D8, 0xA39BE2CC, 0x4FBBDF4F,
+	0x3CEC5C52, 0xD0CC61D1, 0x03CEC5C5, 0xEFEEF846, 0x42A96F7C, 0xAE8952FF, 0x7D8BF6EB, 0x91ABCB68,
+	0xC0663A0E, 0x2C46078D, 0xFF44A399, 0x13649E1A, 0xBE230920, 0x520334A3, 0x810190B7, 0x6D21AD34,
+	0x229A727B, 0xCEBA4FF8, 0x1DB8EBEC, 0xF198D66F, 0x5CDF4155, 0xB0FF7CD6, 0x63FDD8C2, 0x8FDDE541,
+	0xDE101427, 0x323029A4, 0xE1328DB0, 0x0D12B033, 0xA0552709, 0x4C751A8A, 0x9F77BE9E, 0x7357831D,
+	0x79D8B8A4, 0x95F88527, 0x46FA2133, 0xAADA1CB0, 0x079D8B8A, 0xEBBDB609, 0x38BF121D, 0xD49F2F9E,
+	0x8552DEF8, 0x6972E37B, 0xBA70476F, 0x56507AEC, 0xFB17EDD6, 0x1737D055, 0xC4357441, 0x281549C2,
+	0x67AE968D, 0x8B8EAB0E, 0x588C0F1A, 0xB4AC3299, 0x19EBA5A3, 0xF5CB9820, 0x26C93C34, 0xCAE901B7,
+	0x9B24F0D1, 0x7704CD52, 0xA4066946, 0x482654C5, 0xE561C3FF, 0x0941FE7C, 0xDA435A68, 0x366367EB,
+	0x4534E4F6, 0xA914D975, 0x7A167D61, 0x963640E2, 0x3B71D7D8, 0xD751EA5B, 0x04534E4F, 0xE87373CC,
+	0xB9BE82AA, 0x559EBF29, 0x869C1B3D, 0x6ABC26BE, 0xC7FBB184, 0x2BDB8C07, 0xF8D92813, 0x14F91590,
+	0x5B42CADF, 0xB762F75C, 0x64605348, 0x88406ECB, 0x2507F9F1, 0xC927C472, 0x1A256066, 0xF6055DE5,
+	0xA7C8AC83, 0x4BE89100, 0x98EA3514, 0x74CA0897, 0xD98D9FAD, 0x35ADA22E, 0xE6AF063A, 0x0A8F3BB9,
+	0xF3B17148, 0x1F914CCB, 0xCC93E8DF, 0x20B3D55C, 0x8DF44266, 0x61D47FE5, 0xB2D6DBF1, 0x5EF6E672,
+	0x0F3B1714, 0xE31B2A97, 0x30198E83, 0xDC39B300, 0x717E243A, 0x9D5E19B9, 0x4E5CBDAD, 0xA27C802E,
+	0xEDC75F61, 0x01E762E2, 0xD2E5C6F6, 0x3EC5FB75, 0x93826C4F, 0x7FA251CC, 0xACA0F5D8, 0x4080C85B,
+	0x114D393D, 0xFD6D04BE, 0x2E6FA0AA, 0xC24F9D29, 0x6F080A13, 0x83283790, 0x502A9384, 0xBC0AAE07,
+	0xCF5D2D1A, 0x237D1099, 0xF07FB48D, 0x1C5F890E, 0xB1181E34, 0x5D3823B7, 0x8E3A87A3, 0x621ABA20,
+	0x33D74B46, 0xDFF776C5, 0x0CF5D2D1, 0xE0D5EF52, 0x4D927868, 0xA1B245EB, 0x72B0E1FF, 0x9E90DC7C,
+	0xD12B0333, 0x3D0B3EB0, 0xEE099AA4, 0x0229A727, 0xAF6E301D, 0x434E0D9E, 0x904CA98A, 0x7C6C9409,
+	0x2DA1656F, 0xC18158EC, 0x1283FCF8, 0xFEA3C17B, 0x53E45641, 0xBFC46BC2, 0x6CC6CFD6, 0x80E6F255,
+	0x8A69C9EC, 0x6649F46F, 0xB54B507B, 0x596B6DF8, 0xF42CFAC2, 0x180CC741, 0xCB0E6355, 0x272E5ED6,
+	0x76E3AFB0, 0x9AC39233, 0x49C13627, 0xA5E10BA4, 0x08A69C9E, 0xE486A11D, 0x37840509, 0xDBA4388A,
+	0x941FE7C5, 0x783FDA46, 0xAB3D7E52, 0x471D43D1, 0xEA5AD4EB, 0x067AE968, 0xD5784D7C, 0x395870FF,
+	0x68958199, 0x84B5BC1A, 0x57B7180E, 0xBB97258D, 0x16D0B2B7, 0xFAF08F34, 0x29F22B20, 0xC5D216A3,
+	0xB68595BE, 0x5AA5A83D, 0x89A70C29, 0x658731AA, 0xC8C0A690, 0x24E09B13, 0xF7E23F07, 0x1BC20284,
+	0x4A0FF3E2, 0xA62FCE61, 0x752D6A75, 0x990D57F6, 0x344AC0CC, 0xD86AFD4F, 0x0B68595B, 0xE74864D8,
+	0xA8F3BB97, 0x44D38614, 0x97D12200, 0x7BF11F83, 0xD6B688B9, 0x3A96B53A, 0xE994112E, 0x05B42CAD,
+	0x5479DDCB, 0xB859E048, 0x6B5B445C, 0x877B79DF, 0x2A3CEEE5, 0xC61CD366, 0x151E7772, 0xF93E4AF1,
+	// Seed 0x13
+	0x00000000, 0x2E98FAE7, 0x5D31F5CE, 0x73A90F29, 0xBA63EB9C, 0x94FB117B, 0xE7521E52, 0xC9CAE4B5,
+	0x6DBB5485, 0x4323AE62, 0x308AA14B, 0x1E125BAC, 0xD7D8BF19, 0xF94045FE, 0x8AE94AD7, 0xA471B030,
+	0xDB76A90A, 0xF5EE53ED, 0x86475CC4, 0xA8DFA623, 0x61154296, 0x4F8DB871, 0x3C24B758, 0x12BC4DBF,
+	0xB6CDFD8F, 0x98550768, 0xEBFC0841, 0xC564F2A6, 0x0CAE1613, 0x2236ECF4, 0x519FE3DD, 0x7F07193A,
+	0xAF91D1A9, 0x81092B4E, 0xF2A02467, 0xDC38DE80, 0x15F23A35, 0x3B6AC0D2, 0x48C3CFFB, 0x665B351C,
+	0xC22A852C, 0xECB27FCB, 0x9F1B70E2, 0xB1838A05, 0x78496EB0, 0x56D19457, 0x25789B7E, 0x0BE06199,
+	0x74E778A3, 0x5A7F8244, 0x29D68D6D, 0x074E778A, 0xCE84933F, 0xE01C69D8, 0x93B566F1, 0xBD2D9C16,
+	0x195C2C26, 0x37C4D6C1, 0x446DD9E8, 0x6AF5230F, 0xA33FC7BA, 0x8DA73D5D, 0xFE0E3274, 0xD096C893,
+	0x465F20EF, 0x68C7DA08, 0x1B6ED521, 0x35F62FC6, 0xFC3CCB73, 0xD2A43194, 0xA10D3EBD, 0x8F95C45A,
+	0x2BE4746A, 0x057C8E8D, 0x76D581A4, 0x584D7B43, 0x91879FF6, 0xBF1F6511, 0xCCB66A38, 0xE22E90DF,
+	0x9D2989E5, 0xB3B17302, 0xC0187C2B, 0xEE8086CC, 0x274A6279, 0x09D2989E, 0x7A7B97B7, 0x54E36D50,
+	0xF092DD60, 0xDE0A2787, 0xADA328AE, 0x833BD249, 0x4AF136FC, 0x6469CC1B, 0x17C0C332, 0x395839D5,
+	0xE9CEF146, 0xC7560BA1, 0xB4FF0488, 0x9A67FE6F, 0x53AD1ADA, 0x7D35E03D, 0x0E9CEF14, 0x200415F3,
+	0x8475A5C3, 0xAAED5F24, 0xD944500D, 0xF7DCAAEA, 0x3E164E5F, 0x108EB4B8, 0x6327BB91, 0x4DBF4176,
+	0x32B8584C, 0x1C20A2AB, 0x6F89AD82, 0x41115765, 0x88DBB3D0, 0xA6434937, 0xD5EA461E, 0xFB72BCF9,
+	0x5F030CC9, 0x719BF62E, 0x0232F907, 0x2CAA03E0, 0xE560E755, 0xCBF81DB2, 0xB851129B, 0x96C9E87C,
+	0x8CBE41DE, 0xA226BB39, 0xD18FB410, 0xFF174EF7, 0x36DDAA42, 0x184550A5, 0x6BEC5F8C, 0x4574A56B,
+	0xE105155B, 0xCF9DEFBC, 0xBC34E095, 0x92AC1A72, 0x5B66FEC7, 0x75FE0420, 0x06570B09, 0x28CFF1EE,
+	0x57C8E8D4, 0x79501233, 0x0AF91D1A, 0x2461E7FD, 0xEDAB0348, 0xC333F9AF, 0xB09AF686, 0x9E020C61,
+	0x3A73BC51, 0x14EB46B6, 0x6742499F, 0x49DAB378, 0x801057CD, 0xAE88AD2A, 0xDD21A203, 0xF3B958E4,
+	0x232F9077, 0x0DB76A90, 0x7E1E65B9, 0x50869F5E, 0x994C7BEB, 0xB7D4810C, 0xC47D8E25, 0xEAE574C2,
+	0x4E94C4F2, 0x600C3E15, 0x13A5313C, 0x3D3DCBDB, 0xF4F72F6E, 0xDA6FD589, 0xA9C6DAA0, 0x875E2047,
+	0xF859397D, 0xD6C1C39A, 0xA568CCB3, 0x8BF03654, 0x423AD2E1, 0x6CA22806, 0x1F0B272F, 0x3193DDC8,
+	0x95E26DF8, 0xBB7A971F, 0xC8D39836, 0xE64B62D1, 0x2F818664, 0x01197C83, 0x72B073AA, 0x5C28894D,
+	0xCAE16131, 0xE4799BD6, 0x97D094FF, 0xB9486E18, 0x70828AAD, 0x5E1A704A, 0x2DB37F63, 0x032B8584,
+	0xA75A35B4, 0x89C2CF53, 0xFA6BC07A, 0xD4F33A9D, 0x1D39DE28, 0x33A124CF, 0x40082BE6, 0x6E90D101,
+	0x1197C83B, 0x3F0F32DC, 0x4CA63DF5, 0x623EC712, 0xABF423A7, 0x856CD940, 0xF6C5D669, 0xD85D2C8E,
+	0x7C2C9CBE, 0x52B46659, 0x211D6970, 0x0F859397, 0xC64F7722, 0xE8D78DC5, 0x9B7E82EC, 0xB5E6780B,
+	0x6570B098, 0x4BE84A7F, 0x38414556, 0x16D9BFB1, 0xDF135B04, 0xF18BA1E3, 0x8222AECA, 0xACBA542D,
+	0x08CBE41D, 0x26531EFA, 0x55FA11D3, 0x7B62EB34, 0xB2A80F81, 0x9C30F566, 0xEF99FA4F, 0xC10100A8,
+	0xBE061992, 0x909EE375, 0xE337EC5C, 0xCDAF16BB, 0x0465F20E, 0x2AFD08E9, 0x595407C0, 0x77CCFD27,
+	0xD3BD4D17, 0xFD25B7F0, 0x8E8CB8D9, 0xA014423E, 0x69DEA68B, 0x47465C6C, 0x34EF5345, 0x1A77A9A2,
+	// Seed 0x14
+	0x00000000, 0x1CE46938, 0x0C7D7A8B, 0x109913B3, 0x18FAF516, 0x041E9C2E, 0x14878F9D, 0x0863E6A5,
+	0x044042D7, 0x18A42BEF, 0x083D385C, 0x14D95164, 0x1CBAB7C1, 0x005EDEF9, 0x10C7CD4A, 0x0C23A472,
+	0x088085AE, 0x1464EC96, 0x04FDFF25, 0x1819961D, 0x107A70B8, 0x0C9E1980, 0x1C070A33, 0x00E3630B,
+	0x0CC0C779, 0x1024AE41, 0x00BDBDF2, 0x1C59D4CA, 0x143A326F, 0x08DE5B57, 0x184748E4, 0x04A321DC,
+	0x11010B5C, 0x0DE56264, 0x1D7C71D7, 0x019818EF, 0x09FBFE4A, 0x151F9772, 0x058684C1, 0x1962EDF9,
+	0x1541498B, 0x09A520B3, 0x193C3300, 0x05D85A38, 0x0DBBBC9D, 0x115FD5A5, 0x01C6C616, 0x1D22AF2E,
+	0x19818EF2, 0x0565E7CA, 0x15FCF479, 0x09189D41, 0x017B7BE4, 0x1D9F12DC, 0x0D06016F, 0x11E26857,
+	0x1DC1CC25, 0x0125A51D, 0x11BCB6AE, 0x0D58DF96, 0x053B3933, 0x19DF500B, 0x094643B8, 0x15A22A80,
+	0x17B7BE43, 0x0B53D77B, 0x1BCAC4C8, 0x072EADF0, 0x0F4D4B55, 0x13A9226D, 0x033031DE, 0x1FD458E6,
+	0x13F7FC94, 0x0F1395AC, 0x1F8A861F, 0x036EEF27, 0x0B0D0982, 0x17E960BA, 0x07707309, 0x1B941A31,
+	0x1F373BED, 0x03D352D5, 0x134A4166, 0x0FAE285E, 0x07CDCEFB, 0x1B29A7C3, 0x0BB0B470, 0x1754DD48,
+	0x1B77793A, 0x07931002, 0x170A03B1, 0x0BEE6A89, 0x038D8C2C, 0x1F69E514, 0x0FF0F6A7, 0x13149F9F,
+	0x06B6B51F, 0x1A52DC27, 0x0ACBCF94, 0x162FA6AC, 0x1E4C4009, 0x02A82931, 0x12313A82, 0x0ED553BA,
+	0x02F6F7C8, 0x1E129EF0, 0x0E8B8D43, 0x126FE47B, 0x1A0C02DE, 0x06E86BE6, 0x16717855, 0x0A95116D,
+	0x0E3630B1, 0x12D25989, 0x024B4A3A, 0x1EAF2302, 0x16CCC5A7, 0x0A28AC9F, 0x1AB1BF2C, 0x0655D614,
+	0x0A767266, 0x16921B5E, 0x060B08ED, 0x1AEF61D5, 0x128C8770, 0x0E68EE48, 0x1EF1FDFB, 0x021594C3,
+	0x1ADAD47D, 0x063EBD45, 0x16A7AEF6, 0x0A43C7CE, 0x0220216B, 0x1EC44853, 0x0E5D5BE0, 0x12B932D8,
+	0x1E9A96AA, 0x027EFF92, 0x12E7EC21, 0x0E038519, 0x066063BC, 0x1A840A84, 0x0A1D1937, 0x16F9700F,
+	0x125A51D3, 0x0EBE38EB, 0x1E272B58, 0x02C34260, 0x0AA0A4C5, 0x1644CDFD, 0x06DDDE4E, 0x1A39B776,
+	0x161A1304, 0x0AFE7A3C, 0x1A67698F, 0x068300B7, 0x0EE0E612, 0x12048F2A, 0x029D9C99, 0x1E79F5A1,
+	0x0BDBDF21, 0x173FB619, 0x07A6A5AA, 0x1B42CC92, 0x13212A37, 0x0FC5430F, 0x1F5C50BC, 0x03B83984,
+	0x0F9B9DF6, 0x137FF4CE, 0x03E6E77D, 0x1F028E45, 0x176168E0, 0x0B8501D8, 0x1B1C126B, 0x07F87B53,
+	0x035B5A8F, 0x1FBF33B7, 0x0F262004, 0x13C2493C, 0x1BA1AF99, 0x0745C6A1, 0x17DCD512, 0x0B38BC2A,
+	0x071B1858, 0x1BFF7160, 0x0B6662D3, 0x17820BEB, 0x1FE1ED4E, 0x03058476, 0x139C97C5, 0x0F78FEFD,
+	0x0D6D6A3E, 0x11890306, 0x011010B5, 0x1DF4798D, 0x15979F28, 0x0973F610, 0x19EAE5A3, 0x050E8C9B,
+	0x092D28E9, 0x15C941D1, 0x05505262, 0x19B43B5A, 0x11D7DDFF, 0x0D33B4C7, 0x1DAAA774, 0x014ECE4C,
+	0x05EDEF90, 0x190986A8, 0x0990951B, 0x1574FC23, 0x1D171A86, 0x01F373BE, 0x116A600D, 0x0D8E0935,
+	0x01ADAD47, 0x1D49C47F, 0x0DD0D7CC, 0x1134BEF4, 0x19575851, 0x05B33169, 0x152A22DA, 0x09CE4BE2,
+	0x1C6C6162, 0x0088085A, 0x10111BE9, 0x0CF572D1, 0x04969474, 0x1872FD4C, 0x08EBEEFF, 0x140F87C7,
+	0x182C23B5, 0x04C84A8D, 0x1451593E, 0x08B53006, 0x00D6D6A3, 0x1C32BF9B, 0x0CABAC28, 0x104FC510,
+	0x14ECE4CC, 0x08088DF4, 0x18919E47, 0x0475F77F, 0x0C1611DA, 0x10F278E2, 0x006B6B51, 0x1C8F0269,
+	0x10ACA61B, 0x0C48CF23, 0x1CD1DC90, 0x0035B5A8, 0x0856530D, 0x14B23A35, 0x042B2986, 0x18CF40BE,
+	// Seed 0x15
+	0x00000000, 0x315FE061, 0x62BFC0C2, 0x53E020A3, 0x1EC44853, 0x2F9BA832, 0x7C7B8891, 0x4D2468F0,
+	0x3D8890A6, 0x0CD770C7, 0x5F375064, 0x6E68B005, 0x234CD8F5, 0x12133894, 0x41F31837, 0x70ACF856,
+	0x7B11214C, 0x4A4EC12D, 0x19AEE18E, 0x28F101EF, 0x65D5691F, 0x548A897E, 0x076AA9DD, 0x363549BC,
+	0x4699B1EA, 0x77C6518B, 0x24267128, 0x15799149, 0x585DF9B9, 0x690219D8, 0x3AE2397B, 0x0BBDD91A,
+	0x2D998B4F, 0x1CC66B2E, 0x4F264B8D, 0x7E79ABEC, 0x335DC31C, 0x0202237D, 0x51E203DE, 0x60BDE3BF,
+	0x10111BE9, 0x214EFB88, 0x72AEDB2B, 0x43F13B4A, 0x0ED553BA, 0x3F8AB3DB, 0x6C6A9378, 0x5D357319,
+	0x5688AA03, 0x67D74A62, 0x34376AC1, 0x05688AA0, 0x484CE250, 0x79130231, 0x2AF32292, 0x1BACC2F3,
+	0x6B003AA5, 0x5A5FDAC4, 0x09BFFA67, 0x38E01A06, 0x75C472F6, 0x449B9297, 0x177BB234, 0x26245255,
+	0x5B33169E, 0x6A6CF6FF, 0x398CD65C, 0x08D3363D, 0x45F75ECD, 0x74A8BEAC, 0x27489E0F, 0x16177E6E,
+	0x66BB8638, 0x57E46659, 0x040446FA, 0x355BA69B, 0x787FCE6B, 0x49202E0A, 0x1AC00EA9, 0x2B9FEEC8,
+	0x202237D2, 0x117DD7B3, 0x429DF710, 0x73C21771, 0x3EE67F81, 0x0FB99FE0, 0x5C59BF43, 0x6D065F22,
+	0x1DAAA774, 0x2CF54715, 0x7F1567B6, 0x4E4A87D7, 0x036EEF27, 0x32310F46, 0x61D12FE5, 0x508ECF84,
+	0x76AA9DD1, 0x47F57DB0, 0x14155D13, 0x254ABD72, 0x686ED582, 0x593135E3, 0x0AD11540, 0x3B8EF521,
+	0x4B220D77, 0x7A7DED16, 0x299DCDB5, 0x18C22DD4, 0x55E64524, 0x64B9A545, 0x375985E6, 0x06066587,
+	0x0DBBBC9D, 0x3CE45CFC, 0x6F047C5F, 0x5E5B9C3E, 0x137FF4CE, 0x222014AF, 0x71C0340C, 0x409FD46D,
+	0x30332C3B, 0x016CCC5A, 0x528CECF9, 0x63D30C98, 0x2EF76468, 0x1FA88409, 0x4C48A4AA, 0x7D1744CB,
+	0x6DDDE4EB, 0x5C82048A, 0x0F622429, 0x3E3DC448, 0x7319ACB8, 0x42464CD9, 0x11A66C7A, 0x20F98C1B,
+	0x5055744D, 0x610A942C, 0x32EAB48F, 0x03B554EE, 0x4E913C1E, 0x7FCEDC7F, 0x2C2EFCDC, 0x1D711CBD,
+	0x16CCC5A7, 0x279325C6, 0x74730565, 0x452CE504, 0x08088DF4, 0x39576D95, 0x6AB74D36, 0x5BE8AD57,
+	0x2B445501, 0x1A1BB560, 0x49FB95C3, 0x78A475A2, 0x35801D52, 0x04DFFD33, 0x573FDD90, 0x66603DF1,
+	0x40446FA4, 0x711B8FC5, 0x22FBAF66, 0x13A44F07, 0x5E8027F7, 0x6FDFC796, 0x3C3FE735, 0x0D600754,
+	0x7DCCFF02, 0x4C931F63, 0x1F733FC0, 0x2E2CDFA1, 0x6308B751, 0x52575730, 0x01B77793, 0x30E897F2,
+	0x3B554EE8, 0x0A0AAE89, 0x59EA8E2A, 0x68B56E4B, 0x259106BB, 0x14CEE6DA, 0x472EC679, 0x76712618,
+	0x06DDDE4E, 0x37823E2F, 0x64621E8C, 0x553DFEED, 0x1819961D, 0x2946767C, 0x7AA656DF, 0x4BF9B6BE,
+	0x36EEF275, 0x07B11214, 0x545132B7, 0x650ED2D6, 0x282ABA26, 0x19755A47, 0x4A957AE4, 0x7BCA9A85,
+	0x0B6662D3, 0x3A3982B2, 0x69D9A211, 0x58864270, 0x15A22A80, 0x24FDCAE1, 0x771DEA42, 0x46420A23,
+	0x4DFFD339, 0x7CA03358, 0x2F4013FB, 0x1E1FF39A, 0x533B9B6A, 0x62647B0B, 0x31845BA8, 0x00DBBBC9,
+	0x7077439F, 0x4128A3FE, 0x12C8835D, 0x2397633C, 0x6EB30BCC, 0x5FECEBAD, 0x0C0CCB0E, 0x3D532B6F,
+	0x1B77793A, 0x2A28995B, 0x79C8B9F8, 0x48975999, 0x05B33169, 0x34ECD108, 0x670CF1AB, 0x565311CA,
+	0x26FFE99C, 0x17A009FD, 0x4440295E, 0x751FC93F, 0x383BA1CF, 0x096441AE, 0x5A84610D, 0x6BDB816C,
+	0x60665876, 0x5139B817, 0x02D998B4, 0x338678D5, 0x7EA21025, 0x4FFDF044, 0x1C1DD0E7, 0x2D423086,
+	0x5DEEC8D0, 0x6CB128B1, 0x3F510812, 0x0E0EE873, 0x432A8083, 0x727560E2, 0x21954041, 0x10CAA020,
+	// Seed 0x16
+	0x00000000, 0x9AF56C13, 0xDC43B285, 0x46B6DE96, 0x512E0FA9, 0xCBDB63BA, 0x8D6DBD2C, 0x1798D13F,
+	0xA25C1F52, 0x38A97341, 0x7E1FADD7, 0xE4EAC1C4, 0xF37210FB, 0x69877CE8, 0x2F31A27E, 0xB5C4CE6D,
+	0xAD115407, 0x37E43814, 0x7152E682, 0xEBA78A91, 0xFC3F5BAE, 0x66CA37BD, 0x207CE92B, 0xBA898538,
+	0x0F4D4B55, 0x95B82746, 0xD30EF9D0, 0x49FB95C3, 0x5E6344FC, 0xC49628EF, 0x8220F679, 0x18D59A6A,
+	0xB38BC2AD, 0x297EAEBE, 0x6FC87028, 0xF53D1C3B, 0xE2A5CD04, 0x7850A117, 0x3EE67F81, 0xA4131392,
+	0x11D7DDFF, 0x8B22B1EC, 0xCD946F7A, 0x57610369, 0x40F9D256, 0xDA0CBE45, 0x9CBA60D3, 0x064F0CC0,
+	0x1E9A96AA, 0x846FFAB9, 0xC2D9242F, 0x582C483C, 0x4FB49903, 0xD541F510, 0x93F72B86, 0x09024795,
+	0xBCC689F8, 0x2633E5EB, 0x60853B7D, 0xFA70576E, 0xEDE88651, 0x771DEA42, 0x31AB34D4, 0xAB5E58C7,
+	0x8EBEEFF9, 0x144B83EA, 0x52FD5D7C, 0xC808316F, 0xDF90E050, 0x45658C43, 0x03D352D5, 0x99263EC6,
+	0x2CE2F0AB, 0xB6179CB8, 0xF0A1422E, 0x6A542E3D, 0x7DCCFF02, 0xE7399311, 0xA18F4D87, 0x3B7A2194,
+	0x23AFBBFE, 0xB95AD7ED, 0xFFEC097B, 0x65196568, 0x7281B457, 0xE874D844, 0xAEC206D2, 0x34376AC1,
+	0x81F3A4AC, 0x1B06C8BF, 0x5DB01629, 0xC7457A3A, 0xD0DDAB05, 0x4A28C716, 0x0C9E1980, 0x966B7593,
+	0x3D352D54, 0xA7C04147, 0xE1769FD1, 0x7B83F3C2, 0x6C1B22FD, 0xF6EE4EEE, 0xB0589078, 0x2AADFC6B,
+	0x9F693206, 0x059C5E15, 0x432A8083, 0xD9DFEC90, 0xCE473DAF, 0x54B251BC, 0x12048F2A, 0x88F1E339,
+	0x90247953, 0x0AD11540, 0x4C67CBD6, 0xD692A7C5, 0xC10A76FA, 0x5BFF1AE9, 0x1D49C47F, 0x87BCA86C,
+	0x32786601, 0xA88D0A12, 0xEE3BD484, 0x74CEB897, 0x635669A8, 0xF9A305BB, 0xBF15DB2D, 0x25E0B73E,
+	0xF4D4B551, 0x6E21D942, 0x289707D4, 0xB2626BC7, 0xA5FABAF8, 0x3F0FD6EB, 0x79B9087D, 0xE34C646E,
+	0x5688AA03, 0xCC7DC610, 0x8ACB1886, 0x103E7495, 0x07A6A5AA, 0x9D53C9B9, 0xDBE5172F, 0x41107B3C,
+	0x59C5E156, 0xC3308D45, 0x858653D3, 0x1F733FC0, 0x08EBEEFF, 0x921E82EC, 0xD4A85C7A, 0x4E5D3069,
+	0xFB99FE04, 0x616C9217, 0x27DA4C81, 0xBD2F2092, 0xAAB7F1AD, 0x30429DBE, 0x76F44328, 0xEC012F3B,
+	0x475F77FC, 0xDDAA1BEF, 0x9B1CC579, 0x01E9A96A, 0x16717855, 0x8C841446, 0xCA32CAD0, 0x50C7A6C3,
+	0xE50368AE, 0x7FF604BD, 0x3940DA2B, 0xA3B5B638, 0xB42D6707, 0x2ED80B14, 0x686ED582, 0xF29BB991,
+	0xEA4E23FB, 0x70BB4FE8, 0x360D917E, 0xACF8FD6D, 0xBB602C52, 0x21954041, 0x67239ED7, 0xFDD6F2C4,
+	0x48123CA9, 0xD2E750BA, 0x94518E2C, 0x0EA4E23F, 0x193C3300, 0x83C95F13, 0xC57F8185, 0x5F8AED96,
+	0x7A6A5AA8, 0xE09F36BB, 0xA629E82D, 0x3CDC843E, 0x2B445501, 0xB1B13912, 0xF707E784, 0x6DF28B97,
+	0xD83645FA, 0x42C329E9, 0x0475F77F, 0x9E809B6C, 0x89184A53, 0x13ED2640, 0x555BF8D6, 0xCFAE94C5,
+	0xD77B0EAF, 0x4D8E62BC, 0x0B38BC2A, 0x91CDD039, 0x86550106, 0x1CA06D15, 0x5A16B383, 0xC0E3DF90,
+	0x752711FD, 0xEFD27DEE, 0xA964A378, 0x3391CF6B, 0x24091E54, 0xBEFC7247, 0xF84AACD1, 0x62BFC0C2,
+	0xC9E19805, 0x5314F416, 0x15A22A80, 0x8F574693, 0x98CF97AC, 0x023AFBBF, 0x448C2529, 0xDE79493A,
+	0x6BBD8757, 0xF148EB44, 0xB7FE35D2, 0x2D0B59C1, 0x3A9388FE, 0xA066E4ED, 0xE6D03A7B, 0x7C255668,
+	0x64F0CC02, 0xFE05A011, 0xB8B37E87, 0x22461294, 0x35DEC3AB, 0xAF2BAFB8, 0xE99D712E, 0x73681D3D,
+	0xC6ACD350, 0x5C59BF43, 0x1AEF61D5, 0x801A0DC6, 0x9782DCF9, 0x0D77B0EA, 0x4BC16E7C, 0xD134026F,
+	// Seed 0x17
+	0x00000000, 0xB055FD12, 0x670CF1AB, 0xD7590CB9, 0xCE19E356, 0x7E4C1E44, 0xA91512FD, 0x1940EFEF,
+	0x9B94CD23, 0x2BC13031, 0xFC983C88, 0x4CCDC19A, 0x558D2E75, 0xE5D8D367, 0x3281DFDE, 0x82D422CC,
+	0x308E91C9, 0x80DB6CDB, 0x57826062, 0xE7D79D70, 0xFE97729F, 0x4EC28F8D, 0x999B8334, 0x29CE7E26,
+	0xAB1A5CEA, 0x1B4FA1F8, 0xCC16AD41, 0x7C435053, 0x6503BFBC, 0xD55642AE, 0x020F4E17, 0xB25AB305,
+	0x611D2392, 0xD148DE80, 0x0611D239, 0xB6442F2B, 0xAF04C0C4, 0x1F513DD6, 0xC808316F, 0x785DCC7D,
+	0xFA89EEB1, 0x4ADC13A3, 0x9D851F1A, 0x2DD0E208, 0x34900DE7, 0x84C5F0F5, 0x539CFC4C, 0xE3C9015E,
+	0x5193B25B, 0xE1C64F49, 0x369F43F0, 0x86CABEE2, 0x9F8A510D, 0x2FDFAC1F, 0xF886A0A6, 0x48D35DB4,
+	0xCA077F78, 0x7A52826A, 0xAD0B8ED3, 0x1D5E73C1, 0x041E9C2E, 0xB44B613C, 0x63126D85, 0xD3479097,
+	0xC23A4724, 0x726FBA36, 0xA536B68F, 0x15634B9D, 0x0C23A472, 0xBC765960, 0x6B2F55D9, 0xDB7AA8CB,
+	0x59AE8A07, 0xE9FB7715, 0x3EA27BAC, 0x8EF786BE, 0x97B76951, 0x27E29443, 0xF0BB98FA, 0x40EE65E8,
+	0xF2B4D6ED, 0x42E12BFF, 0x95B82746, 0x25EDDA54, 0x3CAD35BB, 0x8CF8C8A9, 0x5BA1C410, 0xEBF43902,
+	0x69201BCE, 0xD975E6DC, 0x0E2CEA65, 0xBE791777, 0xA739F898, 0x176C058A, 0xC0350933, 0x7060F421,
+	0xA32764B6, 0x137299A4, 0xC42B951D, 0x747E680F, 0x6D3E87E0, 0xDD6B7AF2, 0x0A32764B, 0xBA678B59,
+	0x38B3A995, 0x88E65487, 0x5FBF583E, 0xEFEAA52C, 0xF6AA4AC3, 0x46FFB7D1, 0x91A6BB68, 0x21F3467A,
+	0x93A9F57F, 0x23FC086D, 0xF4A504D4, 0x44F0F9C6, 0x5DB01629, 0xEDE5EB3B, 0x3ABCE782, 0x8AE91A90,
+	0x083D385C, 0xB868C54E, 0x6F31C9F7, 0xDF6434E5, 0xC624DB0A, 0x76712618, 0xA1282AA1, 0x117DD7B3,
+	0x83D385C7, 0x338678D5, 0xE4DF746C, 0x548A897E, 0x4DCA6691, 0xFD9F9B83, 0x2AC6973A, 0x9A936A28,
+	0x184748E4, 0xA812B5F6, 0x7F4BB94F, 0xCF1E445D, 0xD65EABB2, 0x660B56A0, 0xB1525A19, 0x0107A70B,
+	0xB35D140E, 0x0308E91C, 0xD451E5A5, 0x640418B7, 0x7D44F758, 0xCD110A4A, 0x1A4806F3, 0xAA1DFBE1,
+	0x28C9D92D, 0x989C243F, 0x4FC52886, 0xFF90D594, 0xE6D03A7B, 0x5685C769, 0x81DCCBD0, 0x318936C2,
+	0xE2CEA655, 0x529B5B47, 0x85C257FE, 0x3597AAEC, 0x2CD74503, 0x9C82B811, 0x4BDBB4A8, 0xFB8E49BA,
+	0x795A6B76, 0xC90F9664, 0x1E569ADD, 0xAE0367CF, 0xB7438820, 0x07167532, 0xD04F798B, 0x601A8499,
+	0xD240379C, 0x6215CA8E, 0xB54CC637, 0x05193B25, 0x1C59D4CA, 0xAC0C29D8, 0x7B552561, 0xCB00D873,
+	0x49D4FABF, 0xF98107AD, 0x2ED80B14, 0x9E8DF606, 0x87CD19E9, 0x3798E4FB, 0xE0C1E842, 0x50941550,
+	0x41E9C2E3, 0xF1BC3FF1, 0x26E53348, 0x96B0CE5A, 0x8FF021B5, 0x3FA5DCA7, 0xE8FCD01E, 0x58A92D0C,
+	0xDA7D0FC0, 0x6A28F2D2, 0xBD71FE6B, 0x0D240379, 0x1464EC96, 0xA4311184, 0x73681D3D, 0xC33DE02F,
+	0x7167532A, 0xC132AE38, 0x166BA281, 0xA63E5F93, 0xBF7EB07C, 0x0F2B4D6E, 0xD87241D7, 0x6827BCC5,
+	0xEAF39E09, 0x5AA6631B, 0x8DFF6FA2, 0x3DAA92B0, 0x24EA7D5F, 0x94BF804D, 0x43E68CF4, 0xF3B371E6,
+	0x20F4E171, 0x90A11C63, 0x47F810DA, 0xF7ADEDC8, 0xEEED0227, 0x5EB8FF35, 0x89E1F38C, 0x39B40E9E,
+	0xBB602C52, 0x0B35D140, 0xDC6CDDF9, 0x6C3920EB, 0x7579CF04, 0xC52C3216, 0x12753EAF, 0xA220C3BD,
+	0x107A70B8, 0xA02F8DAA, 0x77768113, 0xC7237C01, 0xDE6393EE, 0x6E366EFC, 0xB96F6245, 0x093A9F57,
+	0x8BEEBD9B, 0x3BBB4089, 0xECE24C30, 0x5CB7B122, 0x45F75ECD, 0xF5A2A3DF, 0x22FBAF66, 0x92AE5274,
+	// Seed 0x18
+	0x00000000, 0x073DC168, 0x0E7B82D0, 0x094643B8, 0x1CF705A0, 0x1BCAC4C8, 0x128C8770, 0x15B14618,
+	0x1F373BED, 0x180AFA85, 0x114CB93D, 0x16717855, 0x03C03E4D, 0x04FDFF25, 0x0DBBBC9D, 0x0A867DF5,
+	0x18B74777, 0x1F8A861F, 0x16CCC5A7, 0x11F104CF, 0x044042D7, 0x037D83BF, 0x0A3BC007, 0x0D06016F,
+	0x07807C9A, 0x00BDBDF2, 0x09FBFE4A, 0x0EC63F22, 0x1B77793A, 0x1C4AB852, 0x150CFBEA, 0x12313A82,
+	0x17B7BE43, 0x108A7F2B, 0x19CC3C93, 0x1EF1FDFB, 0x0B40BBE3, 0x0C7D7A8B, 0x053B3933, 0x0206F85B,
+	0x088085AE, 0x0FBD44C6, 0x06FB077E, 0x01C6C616, 0x1477800E, 0x134A4166, 0x1A0C02DE, 0x1D31C3B6,
+	0x0F00F934, 0x083D385C, 0x017B7BE4, 0x0646BA8C, 0x13F7FC94, 0x14CA3DFC, 0x1D8C7E44, 0x1AB1BF2C,
+	0x1037C2D9, 0x170A03B1, 0x1E4C4009, 0x19718161, 0x0CC0C779, 0x0BFD0611, 0x02BB45A9, 0x058684C1,
+	0x09B64C2B, 0x0E8B8D43, 0x07CDCEFB, 0x00F00F93, 0x1541498B, 0x127C88E3, 0x1B3ACB5B, 0x1C070A33,
+	0x168177C6, 0x11BCB6AE, 0x18FAF516, 0x1FC7347E, 0x0A767266, 0x0D4BB30E, 0x040DF0B6, 0x033031DE,
+	0x11010B5C, 0x163CCA34, 0x1F7A898C, 0x184748E4, 0x0DF60EFC, 0x0ACBCF94, 0x038D8C2C, 0x04B04D44,
+	0x0E3630B1, 0x090BF1D9, 0x004DB261, 0x07707309, 0x12C13511, 0x15FCF479, 0x1CBAB7C1, 0x1B8776A9,
+	0x1E01F268, 0x193C3300, 0x107A70B8, 0x1747B1D0, 0x02F6F7C8, 0x05CB36A0, 0x0C8D7518, 0x0BB0B470,
+	0x0136C985, 0x060B08ED, 0x0F4D4B55, 0x08708A3D, 0x1DC1CC25, 0x1AFC0D4D, 0x13BA4EF5, 0x14878F9D,
+	0x06B6B51F, 0x018B7477, 0x08CD37CF, 0x0FF0F6A7, 0x1A41B0BF, 0x1D7C71D7, 0x143A326F, 0x1307F307,
+	0x19818EF2, 0x1EBC4F9A, 0x17FA0C22, 0x10C7CD4A, 0x05768B52, 0x024B4A3A, 0x0B0D0982, 0x0C30C8EA,
+	0x136C9856, 0x1451593E, 0x1D171A86, 0x1A2ADBEE, 0x0F9B9DF6, 0x08A65C9E, 0x01E01F26, 0x06DDDE4E,
+	0x0C5BA3BB, 0x0B6662D3, 0x0220216B, 0x051DE003, 0x10ACA61B, 0x17916773, 0x1ED724CB, 0x19EAE5A3,
+	0x0BDBDF21, 0x0CE61E49, 0x05A05DF1, 0x029D9C99, 0x172CDA81, 0x10111BE9, 0x19575851, 0x1E6A9939,
+	0x14ECE4CC, 0x13D125A4, 0x1A97661C, 0x1DAAA774, 0x081BE16C, 0x0F262004, 0x066063BC, 0x015DA2D4,
+	0x04DB2615, 0x03E6E77D, 0x0AA0A4C5, 0x0D9D65AD, 0x182C23B5, 0x1F11E2DD, 0x1657A165, 0x116A600D,
+	0x1BEC1DF8, 0x1CD1DC90, 0x15979F28, 0x12AA5E40, 0x071B1858, 0x0026D930, 0x09609A88, 0x0E5D5BE0,
+	0x1C6C6162, 0x1B51A00A, 0x1217E3B2, 0x152A22DA, 0x009B64C2, 0x07A6A5AA, 0x0EE0E612, 0x09DD277A,
+	0x035B5A8F, 0x04669BE7, 0x0D20D85F, 0x0A1D1937, 0x1FAC5F2F, 0x18919E47, 0x11D7DDFF, 0x16EA1C97,
+	0x1ADAD47D, 0x1DE71515, 0x14A156AD, 0x139C97C5, 0x062DD1DD, 0x011010B5, 0x0856530D, 0x0F6B9265,
+	0x05EDEF90, 0x02D02EF8, 0x0B966D40, 0x0CABAC28, 0x191AEA30, 0x1E272B58, 0x176168E0, 0x105CA988,
+	0x026D930A, 0x05505262, 0x0C1611DA, 0x0B2BD0B2, 0x1E9A96AA, 0x19A757C2, 0x10E1147A, 0x17DCD512,
+	0x1D5AA8E7, 0x1A67698F, 0x13212A37, 0x141CEB5F, 0x01ADAD47, 0x06906C2F, 0x0FD62F97, 0x08EBEEFF,
+	0x0D6D6A3E, 0x0A50AB56, 0x0316E8EE, 0x042B2986, 0x119A6F9E, 0x16A7AEF6, 0x1FE1ED4E, 0x18DC2C26,
+	0x125A51D3, 0x156790BB, 0x1C21D303, 0x1B1C126B, 0x0EAD5473, 0x0990951B, 0x00D6D6A3, 0x07EB17CB,
+	0x15DA2D49, 0x12E7EC21, 0x1BA1AF99, 0x1C9C6EF1, 0x092D28E9, 0x0E10E981, 0x0756AA39, 0x006B6B51,
+	0x0AED16A4, 0x0DD0D7CC, 0x04969474, 0x03AB551C, 0x161A1304, 0x1127D26C, 0x186191D4, 0x1F5C50BC,
+	// Seed 0x19
+	0x00000000, 0x64A37F91, 0x0191AEA3, 0x6532D132, 0x03235D46, 0x678022D7, 0x02B2F3E5, 0x66118C74,
+	0x0646BA8C, 0x62E5C51D, 0x07D7142F, 0x63746BBE, 0x0565E7CA, 0x61C6985B, 0x04F44969, 0x605736F8,
+	0x0C8D7518, 0x682E0A89, 0x0D1CDBBB, 0x69BFA42A, 0x0FAE285E, 0x6B0D57CF, 0x0E3F86FD, 0x6A9CF96C,
+	0x0ACBCF94, 0x6E68B005, 0x0B5A6137, 0x6FF91EA6, 0x09E892D2, 0x6D4BED43, 0x08793C71, 0x6CDA43E0,
+	0x191AEA30, 0x7DB995A1, 0x188B4493, 0x7C283B02, 0x1A39B776, 0x7E9AC8E7, 0x1BA819D5, 0x7F0B6644,
+	0x1F5C50BC, 0x7BFF2F2D, 0x1ECDFE1F, 0x7A6E818E, 0x1C7F0DFA, 0x78DC726B, 0x1DEEA359, 0x794DDCC8,
+	0x15979F28, 0x7134E0B9, 0x1406318B, 0x70A54E1A, 0x16B4C26E, 0x7217BDFF, 0x17256CCD, 0x7386135C,
+	0x13D125A4, 0x77725A35, 0x12408B07, 0x76E3F496, 0x10F278E2, 0x74510773, 0x1163D641, 0x75C0A9D0,
+	0x3235D460, 0x5696ABF1, 0x33A47AC3, 0x57070552, 0x31168926, 0x55B5F6B7, 0x30872785, 0x54245814,
+	0x34736EEC, 0x50D0117D, 0x35E2C04F, 0x5141BFDE, 0x375033AA, 0x53F34C3B, 0x36C19D09, 0x5262E298,
+	0x3EB8A178, 0x5A1BDEE9, 0x3F290FDB, 0x5B8A704A, 0x3D9BFC3E, 0x593883AF, 0x3C0A529D, 0x58A92D0C,
+	0x38FE1BF4, 0x5C5D6465, 0x396FB557, 0x5DCCCAC6, 0x3BDD46B2, 0x5F7E3923, 0x3A4CE811, 0x5EEF9780,
+	0x2B2F3E50, 0x4F8C41C1, 0x2ABE90F3, 0x4E1DEF62, 0x280C6316, 0x4CAF1C87, 0x299DCDB5, 0x4D3EB224,
+	0x2D6984DC, 0x49CAFB4D, 0x2CF82A7F, 0x485B55EE, 0x2E4AD99A, 0x4AE9A60B, 0x2FDB7739, 0x4B7808A8,
+	0x27A24B48, 0x430134D9, 0x2633E5EB, 0x42909A7A, 0x2481160E, 0x4022699F, 0x2510B8AD, 0x41B3C73C,
+	0x21E4F1C4, 0x45478E55, 0x20755F67, 0x44D620F6, 0x22C7AC82, 0x4664D313, 0x23560221, 0x47F57DB0,
+	0x646BA8C0, 0x00C8D751, 0x65FA0663, 0x015979F2, 0x6748F586, 0x03EB8A17, 0x66D95B25, 0x027A24B4,
+	0x622D124C, 0x068E6DDD, 0x63BCBCEF, 0x071FC37E, 0x610E4F0A, 0x05AD309B, 0x609FE1A9, 0x043C9E38,
+	0x68E6DDD8, 0x0C45A249, 0x6977737B, 0x0DD40CEA, 0x6BC5809E, 0x0F66FF0F, 0x6A542E3D, 0x0EF751AC,
+	0x6EA06754, 0x0A0318C5, 0x6F31C9F7, 0x0B92B666, 0x6D833A12, 0x09204583, 0x6C1294B1, 0x08B1EB20,
+	0x7D7142F0, 0x19D23D61, 0x7CE0EC53, 0x184393C2, 0x7E521FB6, 0x1AF16027, 0x7FC3B115, 0x1B60CE84,
+	0x7B37F87C, 0x1F9487ED, 0x7AA656DF, 0x1E05294E, 0x7814A53A, 0x1CB7DAAB, 0x79850B99, 0x1D267408,
+	0x71FC37E8, 0x155F4879, 0x706D994B, 0x14CEE6DA, 0x72DF6AAE, 0x167C153F, 0x734EC40D, 0x17EDBB9C,
+	0x77BA8D64, 0x1319F2F5, 0x762B23C7, 0x12885C56, 0x7499D022, 0x103AAFB3, 0x75087E81, 0x11AB0110,
+	0x565E7CA0, 0x32FD0331, 0x57CFD203, 0x336CAD92, 0x557D21E6, 0x31DE5E77, 0x54EC8F45, 0x304FF0D4,
+	0x5018C62C, 0x34BBB9BD, 0x5189688F, 0x352A171E, 0x533B9B6A, 0x3798E4FB, 0x52AA35C9, 0x36094A58,
+	0x5AD309B8, 0x3E707629, 0x5B42A71B, 0x3FE1D88A, 0x59F054FE, 0x3D532B6F, 0x5861FA5D, 0x3CC285CC,
+	0x5C95B334, 0x3836CCA5, 0x5D041D97, 0x39A76206, 0x5FB6EE72, 0x3B1591E3, 0x5E2740D1, 0x3A843F40,
+	0x4F449690, 0x2BE7E901, 0x4ED53833, 0x2A7647A2, 0x4C67CBD6, 0x28C4B447, 0x4DF66575, 0x29551AE4,
+	0x49022C1C, 0x2DA1538D, 0x489382BF, 0x2C30FD2E, 0x4A21715A, 0x2E820ECB, 0x4BB0DFF9, 0x2F13A068,
+	0x43C9E388, 0x276A9C19, 0x42584D2B, 0x26FB32BA, 0x40EABECE, 0x2449C15F, 0x417B106D, 0x25D86FFC,
+	0x458F5904, 0x212C2695, 0x441EF7A7, 0x20BD8836, 0x46AC0442, 0x220F7BD3, 0x473DAAE1, 0x239ED570,
+	// Seed 0x1A
+	0x00000000, 0xC42B951D, 0x7292D8CF, 0xB6B94DD2, 0xE525B19E, 0x210E2483, 0x97B76951, 0x539CFC4C,
+	0x308E91C9, 0xF4A504D4, 0x421C4906, 0x8637DC1B, 0xD5AB2057, 0x1180B54A, 0xA739F898, 0x63126D85,
+	0x611D2392, 0xA536B68F, 0x138FFB5D, 0xD7A46E40, 0x8438920C, 0x40130711, 0xF6AA4AC3, 0x3281DFDE,
+	0x5193B25B, 0x95B82746, 0x23016A94, 0xE72AFF89, 0xB4B603C5, 0x709D96D8, 0xC624DB0A, 0x020F4E17,
+	0xC23A4724, 0x0611D239, 0xB0A89FEB, 0x74830AF6, 0x271FF6BA, 0xE33463A7, 0x558D2E75, 0x91A6BB68,
+	0xF2B4D6ED, 0x369F43F0, 0x80260E22, 0x440D9B3F, 0x17916773, 0xD3BAF26E, 0x6503BFBC, 0xA1282AA1,
+	0xA32764B6, 0x670CF1AB, 0xD1B5BC79, 0x159E2964, 0x4602D528, 0x82294035, 0x34900DE7, 0xF0BB98FA,
+	0x93A9F57F, 0x57826062, 0xE13B2DB0, 0x2510B8AD, 0x768C44E1, 0xB2A7D1FC, 0x041E9C2E, 0xC0350933,
+	0x7EB17CBD, 0xBA9AE9A0, 0x0C23A472, 0xC808316F, 0x9B94CD23, 0x5FBF583E, 0xE90615EC, 0x2D2D80F1,
+	0x4E3FED74, 0x8A147869, 0x3CAD35BB, 0xF886A0A6, 0xAB1A5CEA, 0x6F31C9F7, 0xD9888425, 0x1DA31138,
+	0x1FAC5F2F, 0xDB87CA32, 0x6D3E87E0, 0xA91512FD, 0xFA89EEB1, 0x3EA27BAC, 0x881B367E, 0x4C30A363,
+	0x2F22CEE6, 0xEB095BFB, 0x5DB01629, 0x999B8334, 0xCA077F78, 0x0E2CEA65, 0xB895A7B7, 0x7CBE32AA,
+	0xBC8B3B99, 0x78A0AE84, 0xCE19E356, 0x0A32764B, 0x59AE8A07, 0x9D851F1A, 0x2B3C52C8, 0xEF17C7D5,
+	0x8C05AA50, 0x482E3F4D, 0xFE97729F, 0x3ABCE782, 0x69201BCE, 0xAD0B8ED3, 0x1BB2C301, 0xDF99561C,
+	0xDD96180B, 0x19BD8D16, 0xAF04C0C4, 0x6B2F55D9, 0x38B3A995, 0xFC983C88, 0x4A21715A, 0x8E0AE447,
+	0xED1889C2, 0x29331CDF, 0x9F8A510D, 0x5BA1C410, 0x083D385C, 0xCC16AD41, 0x7AAFE093, 0xBE84758E,
+	0xFD62F97A, 0x39496C67, 0x8FF021B5, 0x4BDBB4A8, 0x184748E4, 0xDC6CDDF9, 0x6AD5902B, 0xAEFE0536,
+	0xCDEC68B3, 0x09C7FDAE, 0xBF7EB07C, 0x7B552561, 0x28C9D92D, 0xECE24C30, 0x5A5B01E2, 0x9E7094FF,
+	0x9C7FDAE8, 0x58544FF5, 0xEEED0227, 0x2AC6973A, 0x795A6B76, 0xBD71FE6B, 0x0BC8B3B9, 0xCFE326A4,
+	0xACF14B21, 0x68DADE3C, 0xDE6393EE, 0x1A4806F3, 0x49D4FABF, 0x8DFF6FA2, 0x3B462270, 0xFF6DB76D,
+	0x3F58BE5E, 0xFB732B43, 0x4DCA6691, 0x89E1F38C, 0xDA7D0FC0, 0x1E569ADD, 0xA8EFD70F, 0x6CC44212,
+	0x0FD62F97, 0xCBFDBA8A, 0x7D44F758, 0xB96F6245, 0xEAF39E09, 0x2ED80B14, 0x986146C6, 0x5C4AD3DB,
+	0x5E459DCC, 0x9A6E08D1, 0x2CD74503, 0xE8FCD01E, 0xBB602C52, 0x7F4BB94F, 0xC9F2F49D, 0x0DD96180,
+	0x6ECB0C05, 0xAAE09918, 0x1C59D4CA, 0xD87241D7, 0x8BEEBD9B, 0x4FC52886, 0xF97C6554, 0x3D57F049,
+	0x83D385C7, 0x47F810DA, 0xF1415D08, 0x356AC815, 0x66F63459, 0xA2DDA144, 0x1464EC96, 0xD04F798B,
+	0xB35D140E, 0x77768113, 0xC1CFCCC1, 0x05E459DC, 0x5678A590, 0x9253308D, 0x24EA7D5F, 0xE0C1E842,
+	0xE2CEA655, 0x26E53348, 0x905C7E9A, 0x5477EB87, 0x07EB17CB, 0xC3C082D6, 0x7579CF04, 0xB1525A19,
+	0xD240379C, 0x166BA281, 0xA0D2EF53, 0x64F97A4E, 0x37658602, 0xF34E131F, 0x45F75ECD, 0x81DCCBD0,
+	0x41E9C2E3, 0x85C257FE, 0x337B1A2C, 0xF7508F31, 0xA4CC737D, 0x60E7E660, 0xD65EABB2, 0x12753EAF,
+	0x7167532A, 0xB54CC637, 0x03F58BE5, 0xC7DE1EF8, 0x9442E2B4, 0x506977A9, 0xE6D03A7B, 0x22FBAF66,
+	0x20F4E171, 0xE4DF746C, 0x526639BE, 0x964DACA3, 0xC5D150EF, 0x01FAC5F2, 0xB7438820, 0x73681D3D,
+	0x107A70B8, 0xD451E5A5, 0x62E8A877, 0xA6C33D6A, 0xF55FC126, 0x3174543B, 0x87CD19E9, 0x43E68CF4,
+	// Seed 0x1B
+	0x00000000, 0x929BE7DC, 0x31FC5C61, 0xA367BBBD, 0x63F8B8C2, 0xF1635F1E, 0x5204E4A3, 0xC09F037F,
+	0xC7F17184, 0x556A9658, 0xF60D2DE5, 0x6496CA39, 0xA409C946, 0x36922E9A, 0x95F59527, 0x076E72FB,
+	0x9B2970D1, 0x09B2970D, 0xAAD52CB0, 0x384ECB6C, 0xF8D1C813, 0x6A4A2FCF, 0xC92D9472, 0x5BB673AE,
+	0x5CD80155, 0xCE43E689, 0x6D245D34, 0xFFBFBAE8, 0x3F20B997, 0xADBB5E4B, 0x0EDCE5F6, 0x9C47022A,
+	0x2299727B, 0xB00295A7, 0x13652E1A, 0x81FEC9C6, 0x4161CAB9, 0xD3FA2D65, 0x709D96D8, 0xE2067104,
+	0xE56803FF, 0x77F3E423, 0xD4945F9E, 0x460FB842, 0x8690BB3D, 0x140B5CE1, 0xB76CE75C, 0x25F70080,
+	0xB9B002AA, 0x2B2BE576, 0x884C5ECB, 0x1AD7B917, 0xDA48BA68, 0x48D35DB4, 0xEBB4E609, 0x792F01D5,
+	0x7E41732E, 0xECDA94F2, 0x4FBD2F4F, 0xDD26C893, 0x1DB9CBEC, 0x8F222C30, 0x2C45978D, 0xBEDE7051,
+	0x4532E4F6, 0xD7A9032A, 0x74CEB897, 0xE6555F4B, 0x26CA5C34, 0xB451BBE8, 0x17360055, 0x85ADE789,
+	0x82C39572, 0x105872AE, 0xB33FC913, 0x21A42ECF, 0xE13B2DB0, 0x73A0CA6C, 0xD0C771D1, 0x425C960D,
+	0xDE1B9427, 0x4C8073FB, 0xEFE7C846, 0x7D7C2F9A, 0xBDE32CE5, 0x2F78CB39, 0x8C1F7084, 0x1E849758,
+	0x19EAE5A3, 0x8B71027F, 0x2816B9C2, 0xBA8D5E1E, 0x7A125D61, 0xE889BABD, 0x4BEE0100, 0xD975E6DC,
+	0x67AB968D, 0xF5307151, 0x5657CAEC, 0xC4CC2D30, 0x04532E4F, 0x96C8C993, 0x35AF722E, 0xA73495F2,
+	0xA05AE709, 0x32C100D5, 0x91A6BB68, 0x033D5CB4, 0xC3A25FCB, 0x5139B817, 0xF25E03AA, 0x60C5E476,
+	0xFC82E65C, 0x6E190180, 0xCD7EBA3D, 0x5FE55DE1, 0x9F7A5E9E, 0x0DE1B942, 0xAE8602FF, 0x3C1DE523,
+	0x3B7397D8, 0xA9E87004, 0x0A8FCBB9, 0x98142C65, 0x588B2F1A, 0xCA10C8C6, 0x6977737B, 0xFBEC94A7,
+	0x8A65C9EC, 0x18FE2E30, 0xBB99958D, 0x29027251, 0xE99D712E, 0x7B0696F2, 0xD8612D4F, 0x4AFACA93,
+	0x4D94B868, 0xDF0F5FB4, 0x7C68E409, 0xEEF303D5, 0x2E6C00AA, 0xBCF7E776, 0x1F905CCB, 0x8D0BBB17,
+	0x114CB93D, 0x83D75EE1, 0x20B0E55C, 0xB22B0280, 0x72B401FF, 0xE02FE623, 0x43485D9E, 0xD1D3BA42,
+	0xD6BDC8B9, 0x44262F65, 0xE74194D8, 0x75DA7304, 0xB545707B, 0x27DE97A7, 0x84B92C1A, 0x1622CBC6,
+	0xA8FCBB97, 0x3A675C4B, 0x9900E7F6, 0x0B9B002A, 0xCB040355, 0x599FE489, 0xFAF85F34, 0x6863B8E8,
+	0x6F0DCA13, 0xFD962DCF, 0x5EF19672, 0xCC6A71AE, 0x0CF572D1, 0x9E6E950D, 0x3D092EB0, 0xAF92C96C,
+	0x33D5CB46, 0xA14E2C9A, 0x02299727, 0x90B270FB, 0x502D7384, 0xC2B69458, 0x61D12FE5, 0xF34AC839,
+	0xF424BAC2, 0x66BF5D1E, 0xC5D8E6A3, 0x5743017F, 0x97DC0200, 0x0547E5DC, 0xA6205E61, 0x34BBB9BD,
+	0xCF572D1A, 0x5DCCCAC6, 0xFEAB717B, 0x6C3096A7, 0xACAF95D8, 0x3E347204, 0x9D53C9B9, 0x0FC82E65,
+	0x08A65C9E, 0x9A3DBB42, 0x395A00FF, 0xABC1E723, 0x6B5EE45C, 0xF9C50380, 0x5AA2B83D, 0xC8395FE1,
+	0x547E5DCB, 0xC6E5BA17, 0x658201AA, 0xF719E676, 0x3786E509, 0xA51D02D5, 0x067AB968, 0x94E15EB4,
+	0x938F2C4F, 0x0114CB93, 0xA273702E, 0x30E897F2, 0xF077948D, 0x62EC7351, 0xC18BC8EC, 0x53102F30,
+	0xEDCE5F61, 0x7F55B8BD, 0xDC320300, 0x4EA9E4DC, 0x8E36E7A3, 0x1CAD007F, 0xBFCABBC2, 0x2D515C1E,
+	0x2A3F2EE5, 0xB8A4C939, 0x1BC37284, 0x89589558, 0x49C79627, 0xDB5C71FB, 0x783BCA46, 0xEAA02D9A,
+	0x76E72FB0, 0xE47CC86C, 0x471B73D1, 0xD580940D, 0x151F9772, 0x878470AE, 0x24E3CB13, 0xB6782CCF,
+	0xB1165E34, 0x238DB9E8, 0x80EA0255, 0x1271E589, 0xD2EEE6F6, 0x4075012A, 0xE312BA97, 0x71895D4B,
+	// Seed 0x1C
+	0x00000000, 0x1B79A2B2, 0x1EF1FDFB, 0x05885F49, 0x15E14369, 0x0E98E1DB, 0x0B10BE92, 0x10691C20,
+	0x03C03E4D, 0x18B99CFF, 0x1D31C3B6, 0x06486104, 0x16217D24, 0x0D58DF96, 0x08D080DF, 0x13A9226D,
+	0x07807C9A, 0x1CF9DE28, 0x19718161, 0x020823D3, 0x12613FF3, 0x09189D41, 0x0C90C208, 0x17E960BA,
+	0x044042D7, 0x1F39E065, 0x1AB1BF2C, 0x01C81D9E, 0x11A101BE, 0x0AD8A30C, 0x0F50FC45, 0x14295EF7,
+	0x0F00F934, 0x14795B86, 0x11F104CF, 0x0A88A67D, 0x1AE1BA5D, 0x019818EF, 0x041047A6, 0x1F69E514,
+	0x0CC0C779, 0x17B965CB, 0x12313A82, 0x09489830, 0x19218410, 0x025826A2, 0x07D079EB, 0x1CA9DB59,
+	0x088085AE, 0x13F9271C, 0x16717855, 0x0D08DAE7, 0x1D61C6C7, 0x06186475, 0x03903B3C, 0x18E9998E,
+	0x0B40BBE3, 0x10391951, 0x15B14618, 0x0EC8E4AA, 0x1EA1F88A, 0x05D85A38, 0x00500571, 0x1B29A7C3,
+	0x1E01F268, 0x057850DA, 0x00F00F93, 0x1B89AD21, 0x0BE0B101, 0x109913B3, 0x15114CFA, 0x0E68EE48,
+	0x1DC1CC25, 0x06B86E97, 0x033031DE, 0x1849936C, 0x08208F4C, 0x13592DFE, 0x16D172B7, 0x0DA8D005,
+	0x19818EF2, 0x02F82C40, 0x07707309, 0x1C09D1BB, 0x0C60CD9B, 0x17196F29, 0x12913060, 0x09E892D2,
+	0x1A41B0BF, 0x0138120D, 0x04B04D44, 0x1FC9EFF6, 0x0FA0F3D6, 0x14D95164, 0x11510E2D, 0x0A28AC9F,
+	0x11010B5C, 0x0A78A9EE, 0x0FF0F6A7, 0x14895415, 0x04E04835, 0x1F99EA87, 0x1A11B5CE, 0x0168177C,
+	0x12C13511, 0x09B897A3, 0x0C30C8EA, 0x17496A58, 0x07207678, 0x1C59D4CA, 0x19D18B83, 0x02A82931,
+	0x168177C6, 0x0DF8D574, 0x08708A3D, 0x1309288F, 0x036034AF, 0x1819961D, 0x1D91C954, 0x06E86BE6,
+	0x1541498B, 0x0E38EB39, 0x0BB0B470, 0x10C916C2, 0x00A00AE2, 0x1BD9A850, 0x1E51F719, 0x052855AB,
+	0x14015C4F, 0x0F78FEFD, 0x0AF0A1B4, 0x11890306, 0x01E01F26, 0x1A99BD94, 0x1F11E2DD, 0x0468406F,
+	0x17C16202, 0x0CB8C0B0, 0x09309FF9, 0x12493D4B, 0x0220216B, 0x195983D9, 0x1CD1DC90, 0x07A87E22,
+	0x138120D5, 0x08F88267, 0x0D70DD2E, 0x16097F9C, 0x066063BC, 0x1D19C10E, 0x18919E47, 0x03E83CF5,
+	0x10411E98, 0x0B38BC2A, 0x0EB0E363, 0x15C941D1, 0x05A05DF1, 0x1ED9FF43, 0x1B51A00A, 0x002802B8,
+	0x1B01A57B, 0x007807C9, 0x05F05880, 0x1E89FA32, 0x0EE0E612, 0x159944A0, 0x10111BE9, 0x0B68B95B,
+	0x18C19B36, 0x03B83984, 0x063066CD, 0x1D49C47F, 0x0D20D85F, 0x16597AED, 0x13D125A4, 0x08A88716,
+	0x1C81D9E1, 0x07F87B53, 0x0270241A, 0x190986A8, 0x09609A88, 0x1219383A, 0x17916773, 0x0CE8C5C1,
+	0x1F41E7AC, 0x0438451E, 0x01B01A57, 0x1AC9B8E5, 0x0AA0A4C5, 0x11D90677, 0x1451593E, 0x0F28FB8C,
+	0x0A00AE27, 0x11790C95, 0x14F153DC, 0x0F88F16E, 0x1FE1ED4E, 0x04984FFC, 0x011010B5, 0x1A69B207,
+	0x09C0906A, 0x12B932D8, 0x17316D91, 0x0C48CF23, 0x1C21D303, 0x075871B1, 0x02D02EF8, 0x19A98C4A,
+	0x0D80D2BD, 0x16F9700F, 0x13712F46, 0x08088DF4, 0x186191D4, 0x03183366, 0x06906C2F, 0x1DE9CE9D,
+	0x0E40ECF0, 0x15394E42, 0x10B1110B, 0x0BC8B3B9, 0x1BA1AF99, 0x00D80D2B, 0x05505262, 0x1E29F0D0,
+	0x05005713, 0x1E79F5A1, 0x1BF1AAE8, 0x0088085A, 0x10E1147A, 0x0B98B6C8, 0x0E10E981, 0x15694B33,
+	0x06C0695E, 0x1DB9CBEC, 0x183194A5, 0x03483617, 0x13212A37, 0x08588885, 0x0DD0D7CC, 0x16A9757E,
+	0x02802B89, 0x19F9893B, 0x1C71D672, 0x070874C0, 0x176168E0, 0x0C18CA52, 0x0990951B, 0x12E937A9,
+	0x014015C4, 0x1A39B776, 0x1FB1E83F, 0x04C84A8D, 0x14A156AD, 0x0FD8F41F, 0x0A50AB56, 0x112909E4,
+	// Seed 0x1D
+	0x00000000, 0x67642C18, 0x08C48183, 0x6FA0AD9B, 0x11890306, 0x76ED2F1E, 0x194D8285, 0x7E29AE9D,
+	0x2312060C, 0x44762A14, 0x2BD6878F, 0x4CB2AB97, 0x329B050A, 0x55FF2912, 0x3A5F8489, 0x5D3BA891,
+	0x46240C18, 0x21402000, 0x4EE08D9B, 0x2984A183, 0x57AD0F1E, 0x30C92306, 0x5F698E9D, 0x380DA285,
+	0x65360A14, 0x0252260C, 0x6DF28B97, 0x0A96A78F, 0x74BF0912, 0x13DB250A, 0x7C7B8891, 0x1B1FA489,
+	0x4A44C183, 0x2D20ED9B, 0x42804000, 0x25E46C18, 0x5BCDC285, 0x3CA9EE9D, 0x53094306, 0x346D6F1E,
+	0x6956C78F, 0x0E32EB97, 0x6192460C, 0x06F66A14, 0x78DFC489, 0x1FBBE891, 0x701B450A, 0x177F6912,
+	0x0C60CD9B, 0x6B04E183, 0x04A44C18, 0x63C06000, 0x1DE9CE9D, 0x7A8DE285, 0x152D4F1E, 0x72496306,
+	0x2F72CB97, 0x4816E78F, 0x27B64A14, 0x40D2660C, 0x3EFBC891, 0x599FE489, 0x363F4912, 0x515B650A,
+	0x52855AB5, 0x35E176AD, 0x5A41DB36, 0x3D25F72E, 0x430C59B3, 0x246875AB, 0x4BC8D830, 0x2CACF428,
+	0x71975CB9, 0x16F370A1, 0x7953DD3A, 0x1E37F122, 0x601E5FBF, 0x077A73A7, 0x68DADE3C, 0x0FBEF224,
+	0x14A156AD, 0x73C57AB5, 0x1C65D72E, 0x7B01FB36, 0x052855AB, 0x624C79B3, 0x0DECD428, 0x6A88F830,
+	0x37B350A1, 0x50D77CB9, 0x3F77D122, 0x5813FD3A, 0x263A53A7, 0x415E7FBF, 0x2EFED224, 0x499AFE3C,
+	0x18C19B36, 0x7FA5B72E, 0x10051AB5, 0x776136AD, 0x09489830, 0x6E2CB428, 0x018C19B3, 0x66E835AB,
+	0x3BD39D3A, 0x5CB7B122, 0x33171CB9, 0x547330A1, 0x2A5A9E3C, 0x4D3EB224, 0x229E1FBF, 0x45FA33A7,
+	0x5EE5972E, 0x3981BB36, 0x562116AD, 0x31453AB5, 0x4F6C9428, 0x2808B830, 0x47A815AB, 0x20CC39B3,
+	0x7DF79122, 0x1A93BD3A, 0x753310A1, 0x12573CB9, 0x6C7E9224, 0x0B1ABE3C, 0x64BA13A7, 0x03DE3FBF,
+	0x63066CD9, 0x046240C1, 0x6BC2ED5A, 0x0CA6C142, 0x728F6FDF, 0x15EB43C7, 0x7A4BEE5C, 0x1D2FC244,
+	0x40146AD5, 0x277046CD, 0x48D0EB56, 0x2FB4C74E, 0x519D69D3, 0x36F945CB, 0x5959E850, 0x3E3DC448,
+	0x252260C1, 0x42464CD9, 0x2DE6E142, 0x4A82CD5A, 0x34AB63C7, 0x53CF4FDF, 0x3C6FE244, 0x5B0BCE5C,
+	0x063066CD, 0x61544AD5, 0x0EF4E74E, 0x6990CB56, 0x17B965CB, 0x70DD49D3, 0x1F7DE448, 0x7819C850,
+	0x2942AD5A, 0x4E268142, 0x21862CD9, 0x46E200C1, 0x38CBAE5C, 0x5FAF8244, 0x300F2FDF, 0x576B03C7,
+	0x0A50AB56, 0x6D34874E, 0x02942AD5, 0x65F006CD, 0x1BD9A850, 0x7CBD8448, 0x131D29D3, 0x747905CB,
+	0x6F66A142, 0x08028D5A, 0x67A220C1, 0x00C60CD9, 0x7EEFA244, 0x198B8E5C, 0x762B23C7, 0x114F0FDF,
+	0x4C74A74E, 0x2B108B56, 0x44B026CD, 0x23D40AD5, 0x5DFDA448, 0x3A998850, 0x553925CB, 0x325D09D3,
+	0x3183366C, 0x56E71A74, 0x3947B7EF, 0x5E239BF7, 0x200A356A, 0x476E1972, 0x28CEB4E9, 0x4FAA98F1,
+	0x12913060, 0x75F51C78, 0x1A55B1E3, 0x7D319DFB, 0x03183366, 0x647C1F7E, 0x0BDCB2E5, 0x6CB89EFD,
+	0x77A73A74, 0x10C3166C, 0x7F63BBF7, 0x180797EF, 0x662E3972, 0x014A156A, 0x6EEAB8F1, 0x098E94E9,
+	0x54B53C78, 0x33D11060, 0x5C71BDFB, 0x3B1591E3, 0x453C3F7E, 0x22581366, 0x4DF8BEFD, 0x2A9C92E5,
+	0x7BC7F7EF, 0x1CA3DBF7, 0x7303766C, 0x14675A74, 0x6A4EF4E9, 0x0D2AD8F1, 0x628A756A, 0x05EE5972,
+	0x58D5F1E3, 0x3FB1DDFB, 0x50117060, 0x37755C78, 0x495CF2E5, 0x2E38DEFD, 0x41987366, 0x26FC5F7E,
+	0x3DE3FBF7, 0x5A87D7EF, 0x35277A74, 0x5243566C, 0x2C6AF8F1, 0x4B0ED4E9, 0x24AE7972, 0x43CA556A,
+	0x1EF1FDFB, 0x7995D1E3, 0x16357C78, 0x71515060, 0x0F78FEFD, 0x681CD2E5, 0x07BC7F7E, 0x60D85366,
+	// Seed 0x1E
+	0x00000000, 0x12FD36F5, 0x25FA6DEA, 0x37075B1F, 0x4BF4DBD4, 0x5909ED21, 0x6E0EB63E, 0x7CF380CB,
+	0x97E9B7A8, 0x8514815D, 0xB213DA42, 0xA0EEECB7, 0xDC1D6C7C, 0xCEE05A89, 0xF9E70196, 0xEB1A3763,
+	0xDBCD1597, 0xC9302362, 0xFE37787D, 0xECCA4E88, 0x9039CE43, 0x82C4F8B6, 0xB5C3A3A9, 0xA73E955C,
+	0x4C24A23F, 0x5ED994CA, 0x69DECFD5, 0x7B23F920, 0x07D079EB, 0x152D4F1E, 0x222A1401, 0x30D722F4,
+	0x438451E9, 0x5179671C, 0x667E3C03, 0x74830AF6, 0x08708A3D, 0x1A8DBCC8, 0x2D8AE7D7, 0x3F77D122,
+	0xD46DE641, 0xC690D0B4, 0xF1978BAB, 0xE36ABD5E, 0x9F993D95, 0x8D640B60, 0xBA63507F, 0xA89E668A,
+	0x9849447E, 0x8AB4728B, 0xBDB32994, 0xAF4E1F61, 0xD3BD9FAA, 0xC140A95F, 0xF647F240, 0xE4BAC4B5,
+	0x0FA0F3D6, 0x1D5DC523, 0x2A5A9E3C, 0x38A7A8C9, 0x44542802, 0x56A91EF7, 0x61AE45E8, 0x7353731D,
+	0x8708A3D2, 0x95F59527, 0xA2F2CE38, 0xB00FF8CD, 0xCCFC7806, 0xDE014EF3, 0xE90615EC, 0xFBFB2319,
+	0x10E1147A, 0x021C228F, 0x351B7990, 0x27E64F65, 0x5B15CFAE, 0x49E8F95B, 0x7EEFA244, 0x6C1294B1,
+	0x5CC5B645, 0x4E3880B0, 0x793FDBAF, 0x6BC2ED5A, 0x17316D91, 0x05CC5B64, 0x32CB007B, 0x2036368E,
+	0xCB2C01ED, 0xD9D13718, 0xEED66C07, 0xFC2B5AF2, 0x80D8DA39, 0x9225ECCC, 0xA522B7D3, 0xB7DF8126,
+	0xC48CF23B, 0xD671C4CE, 0xE1769FD1, 0xF38BA924, 0x8F7829EF, 0x9D851F1A, 0xAA824405, 0xB87F72F0,
+	0x53654593, 0x41987366, 0x769F2879, 0x64621E8C, 0x18919E47, 0x0A6CA8B2, 0x3D6BF3AD, 0x2F96C558,
+	0x1F41E7AC, 0x0DBCD159, 0x3ABB8A46, 0x2846BCB3, 0x54B53C78, 0x46480A8D, 0x714F5192, 0x63B26767,
+	0x88A85004, 0x9A5566F1, 0xAD523DEE, 0xBFAF0B1B, 0xC35C8BD0, 0xD1A1BD25, 0xE6A6E63A, 0xF45BD0CF,
+	0xFA0F3D63, 0xE8F20B96, 0xDFF55089, 0xCD08667C, 0xB1FBE6B7, 0xA306D042, 0x94018B5D, 0x86FCBDA8,
+	0x6DE68ACB, 0x7F1BBC3E, 0x481CE721, 0x5AE1D1D4, 0x2612511F, 0x34EF67EA, 0x03E83CF5, 0x11150A00,
+	0x21C228F4, 0x333F1E01, 0x0438451E, 0x16C573EB, 0x6A36F320, 0x78CBC5D5, 0x4FCC9ECA, 0x5D31A83F,
+	0xB62B9F5C, 0xA4D6A9A9, 0x93D1F2B6, 0x812CC443, 0xFDDF4488, 0xEF22727D, 0xD8252962, 0xCAD81F97,
+	0xB98B6C8A, 0xAB765A7F, 0x9C710160, 0x8E8C3795, 0xF27FB75E, 0xE08281AB, 0xD785DAB4, 0xC578EC41,
+	0x2E62DB22, 0x3C9FEDD7, 0x0B98B6C8, 0x1965803D, 0x659600F6, 0x776B3603, 0x406C6D1C, 0x52915BE9,
+	0x6246791D, 0x70BB4FE8, 0x47BC14F7, 0x55412202, 0x29B2A2C9, 0x3B4F943C, 0x0C48CF23, 0x1EB5F9D6,
+	0xF5AFCEB5, 0xE752F840, 0xD055A35F, 0xC2A895AA, 0xBE5B1561, 0xACA62394, 0x9BA1788B, 0x895C4E7E,
+	0x7D079EB1, 0x6FFAA844, 0x58FDF35B, 0x4A00C5AE, 0x36F34565, 0x240E7390, 0x1309288F, 0x01F41E7A,
+	0xEAEE2919, 0xF8131FEC, 0xCF1444F3, 0xDDE97206, 0xA11AF2CD, 0xB3E7C438, 0x84E09F27, 0x961DA9D2,
+	0xA6CA8B26, 0xB437BDD3, 0x8330E6CC, 0x91CDD039, 0xED3E50F2, 0xFFC36607, 0xC8C43D18, 0xDA390BED,
+	0x31233C8E, 0x23DE0A7B, 0x14D95164, 0x06246791, 0x7AD7E75A, 0x682AD1AF, 0x5F2D8AB0, 0x4DD0BC45,
+	0x3E83CF58, 0x2C7EF9AD, 0x1B79A2B2, 0x09849447, 0x7577148C, 0x678A2279, 0x508D7966, 0x42704F93,
+	0xA96A78F0, 0xBB974E05, 0x8C90151A, 0x9E6D23EF, 0xE29EA324, 0xF06395D1, 0xC764CECE, 0xD599F83B,
+	0xE54EDACF, 0xF7B3EC3A, 0xC0B4B725, 0xD24981D0, 0xAEBA011B, 0xBC4737EE, 0x8B406CF1, 0x99BD5A04,
+	0x72A76D67, 0x605A5B92, 0x575D008D, 0x45A03678, 0x3953B6B3, 0x2BAE8046, 0x1CA9DB59, 0x0E54EDAC,
+	// Seed 0x1F
+	0x00000000, 0xFE29798F, 0xE642E8F5, 0x186B917A, 0xD695CA01, 0x28BCB38E, 0x30D722F4, 0xCEFE5B7B,
+	0xB73B8FE9, 0x4912F666, 0x5179671C, 0xAF501E93, 0x61AE45E8, 0x9F873C67, 0x87ECAD1D, 0x79C5D492,
+	0x74670439, 0x8A4E7DB6, 0x9225ECCC, 0x6C0C9543, 0xA2F2CE38, 0x5CDBB7B7, 0x44B026CD, 0xBA995F42,
+	0xC35C8BD0, 0x3D75F25F, 0x251E6325, 0xDB371AAA, 0x15C941D1, 0xEBE0385E, 0xF38BA924, 0x0DA2D0AB,
+	0xE8CE0872, 0x16E771FD, 0x0E8CE087, 0xF0A59908, 0x3E5BC273, 0xC072BBFC, 0xD8192A86, 0x26305309,
+	0x5FF5879B, 0xA1DCFE14, 0xB9B76F6E, 0x479E16E1, 0x89604D9A, 0x77493415, 0x6F22A56F, 0x910BDCE0,
+	0x9CA90C4B, 0x628075C4, 0x7AEBE4BE, 0x84C29D31, 0x4A3CC64A, 0xB415BFC5, 0xAC7E2EBF, 0x52575730,
+	0x2B9283A2, 0xD5BBFA2D, 0xCDD06B57, 0x33F912D8, 0xFD0749A3, 0x032E302C, 0x1B45A156, 0xE56CD8D9,
+	0xCB8C0B0F, 0x35A57280, 0x2DCEE3FA, 0xD3E79A75, 0x1D19C10E, 0xE330B881, 0xFB5B29FB, 0x05725074,
+	0x7CB784E6, 0x829EFD69, 0x9AF56C13, 0x64DC159C, 0xAA224EE7, 0x540B3768, 0x4C60A612, 0xB249DF9D,
+	0xBFEB0F36, 0x41C276B9, 0x59A9E7C3, 0xA7809E4C, 0x697EC537, 0x9757BCB8, 0x8F3C2DC2, 0x7115544D,
+	0x08D080DF, 0xF6F9F950, 0xEE92682A, 0x10BB11A5, 0xDE454ADE, 0x206C3351, 0x3807A22B, 0xC62EDBA4,
+	0x2342037D, 0xDD6B7AF2, 0xC500EB88, 0x3B299207, 0xF5D7C97C, 0x0BFEB0F3, 0x13952189, 0xEDBC5806,
+	0x94798C94, 0x6A50F51B, 0x723B6461, 0x8C121DEE, 0x42EC4695, 0xBCC53F1A, 0xA4AEAE60, 0x5A87D7EF,
+	0x57250744, 0xA90C7ECB, 0xB167EFB1, 0x4F4E963E, 0x81B0CD45, 0x7F99B4CA, 0x67F225B0, 0x99DB5C3F,
+	0xE01E88AD, 0x1E37F122, 0x065C6058, 0xF87519D7, 0x368B42AC, 0xC8A23B23, 0xD0C9AA59, 0x2EE0D3D6,
+	0x8D080DF5, 0x7321747A, 0x6B4AE500, 0x95639C8F, 0x5B9DC7F4, 0xA5B4BE7B, 0xBDDF2F01, 0x43F6568E,
+	0x3A33821C, 0xC41AFB93, 0xDC716AE9, 0x22581366, 0xECA6481D, 0x128F3192, 0x0AE4A0E8, 0xF4CDD967,
+	0xF96F09CC, 0x07467043, 0x1F2DE139, 0xE10498B6, 0x2FFAC3CD, 0xD1D3BA42, 0xC9B82B38, 0x379152B7,
+	0x4E548625, 0xB07DFFAA, 0xA8166ED0, 0x563F175F, 0x98C14C24, 0x66E835AB, 0x7E83A4D1, 0x80AADD5E,
+	0x65C60587, 0x9BEF7C08, 0x8384ED72, 0x7DAD94FD, 0xB353CF86, 0x4D7AB609, 0x55112773, 0xAB385EFC,
+	0xD2FD8A6E, 0x2CD4F3E1, 0x34BF629B, 0xCA961B14, 0x0468406F, 0xFA4139E0, 0xE22AA89A, 0x1C03D115,
+	0x11A101BE, 0xEF887831, 0xF7E3E94B, 0x09CA90C4, 0xC734CBBF, 0x391DB230, 0x2176234A, 0xDF5F5AC5,
+	0xA69A8E57, 0x58B3F7D8, 0x40D866A2, 0xBEF11F2D, 0x700F4456, 0x8E263DD9, 0x964DACA3, 0x6864D52C,
+	0x468406FA, 0xB8AD7F75, 0xA0C6EE0F, 0x5EEF9780, 0x9011CCFB, 0x6E38B574, 0x7653240E, 0x887A5D81,
+	0xF1BF8913, 0x0F96F09C, 0x17FD61E6, 0xE9D41869, 0x272A4312, 0xD9033A9D, 0xC168ABE7, 0x3F41D268,
+	0x32E302C3, 0xCCCA7B4C, 0xD4A1EA36, 0x2A8893B9, 0xE476C8C2, 0x1A5FB14D, 0x02342037, 0xFC1D59B8,
+	0x85D88D2A, 0x7BF1F4A5, 0x639A65DF, 0x9DB31C50, 0x534D472B, 0xAD643EA4, 0xB50FAFDE, 0x4B26D651,
+	0xAE4A0E88, 0x50637707, 0x4808E67D, 0xB6219FF2, 0x78DFC489, 0x86F6BD06, 0x9E9D2C7C, 0x60B455F3,
+	0x19718161, 0xE758F8EE, 0xFF336994, 0x011A101B, 0xCFE44B60, 0x31CD32EF, 0x29A6A395, 0xD78FDA1A,
+	0xDA2D0AB1, 0x2404733E, 0x3C6FE244, 0xC2469BCB, 0x0CB8C0B0, 0xF291B93F, 0xEAFA2845, 0x14D351CA,
+	0x6D168558, 0x933FFCD7, 0x8B546DAD, 0x757D1422, 0xBB834F59, 0x45AA36D6, 0x5DC1A7AC, 0xA3E8DE23,
+	// Seed 0x20
+	0x00000000, 0x3C753890, 0x0E3630B1, 0x32430821, 0x1C6C6162, 0x201959F2, 0x125A51D3, 0x2E2F6943,
+	0x38D8C2C4, 0x04ADFA54, 0x36EEF275, 0x0A9BCAE5, 0x24B4A3A6, 0x18C19B36, 0x2A829317, 0x16F7AB87,
+	0x076DC419, 0x3B18FC89, 0x095BF4A8, 0x352ECC38, 0x1B01A57B, 0x27749DEB, 0x153795CA, 0x2942AD5A,
+	0x3FB506DD, 0x03C03E4D, 0x3183366C, 0x0DF60EFC, 0x23D967BF, 0x1FAC5F2F, 0x2DEF570E, 0x119A6F9E,
+	0x0EDB8832, 0x32AEB0A2, 0x00EDB883, 0x3C988013, 0x12B7E950, 0x2EC2D1C0, 0x1C81D9E1, 0x20F4E171,
+	0x36034AF6, 0x0A767266, 0x38357A47, 0x044042D7, 0x2A6F2B94, 0x161A1304, 0x24591B25, 0x182C23B5,
+	0x09B64C2B, 0x35C374BB, 0x07807C9A, 0x3BF5440A, 0x15DA2D49, 0x29AF15D9, 0x1BEC1DF8, 0x27992568,
+	0x316E8EEF, 0x0D1BB67F, 0x3F58BE5E, 0x032D86CE, 0x2D02EF8D, 0x1177D71D, 0x2334DF3C, 0x1F41E7AC,
+	0x1DB71064, 0x21C228F4, 0x138120D5, 0x2FF41845, 0x01DB7106, 0x3DAE4996, 0x0FED41B7, 0x33987927,
+	0x256FD2A0, 0x191AEA30, 0x2B59E211, 0x172CDA81, 0x3903B3C2, 0x05768B52, 0x37358373, 0x0B40BBE3,
+	0x1ADAD47D, 0x26AFECED, 0x14ECE4CC, 0x2899DC5C, 0x06B6B51F, 0x3AC38D8F, 0x088085AE, 0x34F5BD3E,
+	0x220216B9, 0x1E772E29, 0x2C342608, 0x10411E98, 0x3E6E77DB, 0x021B4F4B, 0x3058476A, 0x0C2D7FFA,
+	0x136C9856, 0x2F19A0C6, 0x1D5AA8E7, 0x212F9077, 0x0F00F934, 0x3375C1A4, 0x0136C985, 0x3D43F115,
+	0x2BB45A92, 0x17C16202, 0x25826A23, 0x19F752B3, 0x37D83BF0, 0x0BAD0360, 0x39EE0B41, 0x059B33D1,
+	0x14015C4F, 0x287464DF, 0x1A376CFE, 0x2642546E, 0x086D3D2D, 0x341805BD, 0x065B0D9C, 0x3A2E350C,
+	0x2CD99E8B, 0x10ACA61B, 0x22EFAE3A, 0x1E9A96AA, 0x30B5FFE9, 0x0CC0C779, 0x3E83CF58, 0x02F6F7C8,
+	0x3B6E20C8, 0x071B1858, 0x35581079, 0x092D28E9, 0x270241AA, 0x1B77793A, 0x2934711B, 0x1541498B,
+	0x03B6E20C, 0x3FC3DA9C, 0x0D80D2BD, 0x31F5EA2D, 0x1FDA836E, 0x23AFBBFE, 0x11ECB3DF, 0x2D998B4F,
+	0x3C03E4D1, 0x0076DC41, 0x3235D460, 0x0E40ECF0, 0x206F85B3, 0x1C1ABD23, 0x2E59B502, 0x122C8D92,
+	0x04DB2615, 0x38AE1E85, 0x0AED16A4, 0x36982E34, 0x18B74777, 0x24C27FE7, 0x168177C6, 0x2AF44F56,
+	0x35B5A8FA, 0x09C0906A, 0x3B83984B, 0x07F6A0DB, 0x29D9C998, 0x15ACF108, 0x27EFF929, 0x1B9AC1B9,
+	0x0D6D6A3E, 0x311852AE, 0x035B5A8F, 0x3F2E621F, 0x11010B5C, 0x2D7433CC, 0x1F373BED, 0x2342037D,
+	0x32D86CE3, 0x0EAD5473, 0x3CEE5C52, 0x009B64C2, 0x2EB40D81, 0x12C13511, 0x20823D30, 0x1CF705A0,
+	0x0A00AE27, 0x367596B7, 0x04369E96, 0x3843A606, 0x166CCF45, 0x2A19F7D5, 0x185AFFF4, 0x242FC764,
+	0x26D930AC, 0x1AAC083C, 0x28EF001D, 0x149A388D, 0x3AB551CE, 0x06C0695E, 0x3483617F, 0x08F659EF,
+	0x1E01F268, 0x2274CAF8, 0x1037C2D9, 0x2C42FA49, 0x026D930A, 0x3E18AB9A, 0x0C5BA3BB, 0x302E9B2B,
+	0x21B4F4B5, 0x1DC1CC25, 0x2F82C404, 0x13F7FC94, 0x3DD895D7, 0x01ADAD47, 0x33EEA566, 0x0F9B9DF6,
+	0x196C3671, 0x25190EE1, 0x175A06C0, 0x2B2F3E50, 0x05005713, 0x39756F83, 0x0B3667A2, 0x37435F32,
+	0x2802B89E, 0x1477800E, 0x2634882F, 0x1A41B0BF, 0x346ED9FC, 0x081BE16C, 0x3A58E94D, 0x062DD1DD,
+	0x10DA7A5A, 0x2CAF42CA, 0x1EEC4AEB, 0x2299727B, 0x0CB61B38, 0x30C323A8, 0x02802B89, 0x3EF51319,
+	0x2F6F7C87, 0x131A4417, 0x21594C36, 0x1D2C74A6, 0x33031DE5, 0x0F762575, 0x3D352D54, 0x014015C4,
+	0x17B7BE43, 0x2BC286D3, 0x19818EF2, 0x25F4B662, 0x0BDBDF21, 0x37AEE7B1, 0x05EDEF90, 0x3998D700,
+	// Seed 0x21
+	0x00000000, 0x15274FB0, 0x2A4E9F60, 0x3F69D0D0, 0x549D3EC0, 0x41BA7170, 0x7ED3A1A0, 0x6BF4EE10,
+	0x31E85D3D, 0x24CF128D, 0x1BA6C25D, 0x0E818DED, 0x657563FD, 0x70522C4D, 0x4F3BFC9D, 0x5A1CB32D,
+	0x63D0BA7A, 0x76F7F5CA, 0x499E251A, 0x5CB96AAA, 0x374D84BA, 0x226ACB0A, 0x1D031BDA, 0x0824546A,
+	0x5238E747, 0x471FA8F7, 0x78767827, 0x6D513797, 0x06A5D987, 0x13829637, 0x2CEB46E7, 0x39CC0957,
+	0x5F735449, 0x4A541BF9, 0x753DCB29, 0x601A8499, 0x0BEE6A89, 0x1EC92539, 0x21A0F5E9, 0x3487BA59,
+	0x6E9B0974, 0x7BBC46C4, 0x44D59614, 0x51F2D9A4, 0x3A0637B4, 0x2F217804, 0x1048A8D4, 0x056FE764,
+	0x3CA3EE33, 0x2984A183, 0x16ED7153, 0x03CA3EE3, 0x683ED0F3, 0x7D199F43, 0x42704F93, 0x57570023,
+	0x0D4BB30E, 0x186CFCBE, 0x27052C6E, 0x322263DE, 0x59D68DCE, 0x4CF1C27E, 0x739812AE, 0x66BF5D1E,
+	0x2634882F, 0x3313C79F, 0x0C7A174F, 0x195D58FF, 0x72A9B6EF, 0x678EF95F, 0x58E7298F, 0x4DC0663F,
+	0x17DCD512, 0x02FB9AA2, 0x3D924A72, 0x28B505C2, 0x4341EBD2, 0x5666A462, 0x690F74B2, 0x7C283B02,
+	0x45E43255, 0x50C37DE5, 0x6FAAAD35, 0x7A8DE285, 0x11790C95, 0x045E4325, 0x3B3793F5, 0x2E10DC45,
+	0x740C6F68, 0x612B20D8, 0x5E42F008, 0x4B65BFB8, 0x209151A8, 0x35B61E18, 0x0ADFCEC8, 0x1FF88178,
+	0x7947DC66, 0x6C6093D6, 0x53094306, 0x462E0CB6, 0x2DDAE2A6, 0x38FDAD16, 0x07947DC6, 0x12B33276,
+	0x48AF815B, 0x5D88CEEB, 0x62E11E3B, 0x77C6518B, 0x1C32BF9B, 0x0915F02B, 0x367C20FB, 0x235B6F4B,
+	0x1A97661C, 0x0FB029AC, 0x30D9F97C, 0x25FEB6CC, 0x4E0A58DC, 0x5B2D176C, 0x6444C7BC, 0x7163880C,
+	0x2B7F3B21, 0x3E587491, 0x0131A441, 0x1416EBF1, 0x7FE205E1, 0x6AC54A51, 0x55AC9A81, 0x408BD531,
+	0x4C69105E, 0x594E5FEE, 0x66278F3E, 0x7300C08E, 0x18F42E9E, 0x0DD3612E, 0x32BAB1FE, 0x279DFE4E,
+	0x7D814D63, 0x68A602D3, 0x57CFD203, 0x42E89DB3, 0x291C73A3, 0x3C3B3C13, 0x0352ECC3, 0x1675A373,
+	0x2FB9AA24, 0x3A9EE594, 0x05F73544, 0x10D07AF4, 0x7B2494E4, 0x6E03DB54, 0x516A0B84, 0x444D4434,
+	0x1E51F719, 0x0B76B8A9, 0x341F6879, 0x213827C9, 0x4ACCC9D9, 0x5FEB8669, 0x608256B9, 0x75A51909,
+	0x131A4417, 0x063D0BA7, 0x3954DB77, 0x2C7394C7, 0x47877AD7, 0x52A03567, 0x6DC9E5B7, 0x78EEAA07,
+	0x22F2192A, 0x37D5569A, 0x08BC864A, 0x1D9BC9FA, 0x766F27EA, 0x6348685A, 0x5C21B88A, 0x4906F73A,
+	0x70CAFE6D, 0x65EDB1DD, 0x5A84610D, 0x4FA32EBD, 0x2457C0AD, 0x31708F1D, 0x0E195FCD, 0x1B3E107D,
+	0x4122A350, 0x5405ECE0, 0x6B6C3C30, 0x7E4B7380, 0x15BF9D90, 0x0098D220, 0x3FF102F0, 0x2AD64D40,
+	0x6A5D9871, 0x7F7AD7C1, 0x40130711, 0x553448A1, 0x3EC0A6B1, 0x2BE7E901, 0x148E39D1, 0x01A97661,
+	0x5BB5C54C, 0x4E928AFC, 0x71FB5A2C, 0x64DC159C, 0x0F28FB8C, 0x1A0FB43C, 0x256664EC, 0x30412B5C,
+	0x098D220B, 0x1CAA6DBB, 0x23C3BD6B, 0x36E4F2DB, 0x5D101CCB, 0x4837537B, 0x775E83AB, 0x6279CC1B,
+	0x38657F36, 0x2D423086, 0x122BE056, 0x070CAFE6, 0x6CF841F6, 0x79DF0E46, 0x46B6DE96, 0x53919126,
+	0x352ECC38, 0x20098388, 0x1F605358, 0x0A471CE8, 0x61B3F2F8, 0x7494BD48, 0x4BFD6D98, 0x5EDA2228,
+	0x04C69105, 0x11E1DEB5, 0x2E880E65, 0x3BAF41D5, 0x505BAFC5, 0x457CE075, 0x7A1530A5, 0x6F327F15,
+	0x56FE7642, 0x43D939F2, 0x7CB0E922, 0x6997A692, 0x02634882, 0x17440732, 0x282DD7E2, 0x3D0A9852,
+	0x67162B7F, 0x723164CF, 0x4D58B41F, 0x587FFBAF, 0x338B15BF, 0x26AC5A0F, 0x19C58ADF, 0x0CE2C56F,
+	// Seed 0x22
+	0x00000000, 0xD99C8579, 0x19F9893B, 0xC0650C42, 0x33F31276, 0xEA6F970F, 0x2A0A9B4D, 0xF3961E34,
+	0x67E624EC, 0xBE7AA195, 0x7E1FADD7, 0xA78328AE, 0x5415369A, 0x8D89B3E3, 0x4DECBFA1, 0x94703AD8,
+	0xCFCC49D8, 0x1650CCA1, 0xD635C0E3, 0x0FA9459A, 0xFC3F5BAE, 0x25A3DED7, 0xE5C6D295, 0x3C5A57EC,
+	0xA82A6D34, 0x71B6E84D, 0xB1D3E40F, 0x684F6176, 0x9BD97F42, 0x4245FA3B, 0x8220F679, 0x5BBC7300,
+	0x35581079, 0xECC49500, 0x2CA19942, 0xF53D1C3B, 0x06AB020F, 0xDF378776, 0x1F528B34, 0xC6CE0E4D,
+	0x52BE3495, 0x8B22B1EC, 0x4B47BDAE, 0x92DB38D7, 0x614D26E3, 0xB8D1A39A, 0x78B4AFD8, 0xA1282AA1,
+	0xFA9459A1, 0x2308DCD8, 0xE36DD09A, 0x3AF155E3, 0xC9674BD7, 0x10FBCEAE, 0xD09EC2EC, 0x09024795,
+	0x9D727D4D, 0x44EEF834, 0x848BF476, 0x5D17710F, 0xAE816F3B, 0x771DEA42, 0xB778E600, 0x6EE46379,
+	0x6AB020F2, 0xB32CA58B, 0x7349A9C9, 0xAAD52CB0, 0x59433284, 0x80DFB7FD, 0x40BABBBF, 0x99263EC6,
+	0x0D56041E, 0xD4CA8167, 0x14AF8D25, 0xCD33085C, 0x3EA51668, 0xE7399311, 0x275C9F53, 0xFEC01A2A,
+	0xA57C692A, 0x7CE0EC53, 0xBC85E011, 0x65196568, 0x968F7B5C, 0x4F13FE25, 0x8F76F267, 0x56EA771E,
+	0xC29A4DC6, 0x1B06C8BF, 0xDB63C4FD, 0x02FF4184, 0xF1695FB0, 0x28F5DAC9, 0xE890D68B, 0x310C53F2,
+	0x5FE8308B, 0x8674B5F2, 0x4611B9B0, 0x9F8D3CC9, 0x6C1B22FD, 0xB587A784, 0x75E2ABC6, 0xAC7E2EBF,
+	0x380E1467, 0xE192911E, 0x21F79D5C, 0xF86B1825, 0x0BFD0611, 0xD2618368, 0x12048F2A, 0xCB980A53,
+	0x90247953, 0x49B8FC2A, 0x89DDF068, 0x50417511, 0xA3D76B25, 0x7A4BEE5C, 0xBA2EE21E, 0x63B26767,
+	0xF7C25DBF, 0x2E5ED8C6, 0xEE3BD484, 0x37A751FD, 0xC4314FC9, 0x1DADCAB0, 0xDDC8C6F2, 0x0454438B,
+	0xD56041E4, 0x0CFCC49D, 0xCC99C8DF, 0x15054DA6, 0xE6935392, 0x3F0FD6EB, 0xFF6ADAA9, 0x26F65FD0,
+	0xB2866508, 0x6B1AE071, 0xAB7FEC33, 0x72E3694A, 0x8175777E, 0x58E9F207, 0x988CFE45, 0x41107B3C,
+	0x1AAC083C, 0xC3308D45, 0x03558107, 0xDAC9047E, 0x295F1A4A, 0xF0C39F33, 0x30A69371, 0xE93A1608,
+	0x7D4A2CD0, 0xA4D6A9A9, 0x64B3A5EB, 0xBD2F2092, 0x4EB93EA6, 0x9725BBDF, 0x5740B79D, 0x8EDC32E4,
+	0xE038519D, 0x39A4D4E4, 0xF9C1D8A6, 0x205D5DDF, 0xD3CB43EB, 0x0A57C692, 0xCA32CAD0, 0x13AE4FA9,
+	0x87DE7571, 0x5E42F008, 0x9E27FC4A, 0x47BB7933, 0xB42D6707, 0x6DB1E27E, 0xADD4EE3C, 0x74486B45,
+	0x2FF41845, 0xF6689D3C, 0x360D917E, 0xEF911407, 0x1C070A33, 0xC59B8F4A, 0x05FE8308, 0xDC620671,
+	0x48123CA9, 0x918EB9D0, 0x51EBB592, 0x887730EB, 0x7BE12EDF, 0xA27DABA6, 0x6218A7E4, 0xBB84229D,
+	0xBFD06116, 0x664CE46F, 0xA629E82D, 0x7FB56D54, 0x8C237360, 0x55BFF619, 0x95DAFA5B, 0x4C467F22,
+	0xD83645FA, 0x01AAC083, 0xC1CFCCC1, 0x185349B8, 0xEBC5578C, 0x3259D2F5, 0xF23CDEB7, 0x2BA05BCE,
+	0x701C28CE, 0xA980ADB7, 0x69E5A1F5, 0xB079248C, 0x43EF3AB8, 0x9A73BFC1, 0x5A16B383, 0x838A36FA,
+	0x17FA0C22, 0xCE66895B, 0x0E038519, 0xD79F0060, 0x24091E54, 0xFD959B2D, 0x3DF0976F, 0xE46C1216,
+	0x8A88716F, 0x5314F416, 0x9371F854, 0x4AED7D2D, 0xB97B6319, 0x60E7E660, 0xA082EA22, 0x791E6F5B,
+	0xED6E5583, 0x34F2D0FA, 0xF497DCB8, 0x2D0B59C1, 0xDE9D47F5, 0x0701C28C, 0xC764CECE, 0x1EF84BB7,
+	0x454438B7, 0x9CD8BDCE, 0x5CBDB18C, 0x852134F5, 0x76B72AC1, 0xAF2BAFB8, 0x6F4EA3FA, 0xB6D22683,
+	0x22A21C5B, 0xFB3E9922, 0x3B5B9560, 0xE2C71019, 0x11510E2D, 0xC8CD8B54, 0x08A88716, 0xD134026F,
+	// Seed 0x23
+	0x00000000, 0x9AE5B669, 0x71058E37, 0xEBE0385E, 0xE20B1C6E, 0x78EEAA07, 0x930E9259, 0x09EB2430,
+	0x80D8DA39, 0x1A3D6C50, 0xF1DD540E, 0x6B38E267, 0x62D3C657, 0xF836703E, 0x13D64860, 0x8933FE09,
+	0x457F5697, 0xDF9AE0FE, 0x347AD8A0, 0xAE9F6EC9, 0xA7744AF9, 0x3D91FC90, 0xD671C4CE, 0x4C9472A7,
+	0xC5A78CAE, 0x5F423AC7, 0xB4A20299, 0x2E47B4F0, 0x27AC90C0, 0xBD4926A9, 0x56A91EF7, 0xCC4CA89E,
+	0x8AFEAD2E, 0x101B1B47, 0xFBFB2319, 0x611E9570, 0x68F5B140, 0xF2100729, 0x19F03F77, 0x8315891E,
+	0x0A267717, 0x90C3C17E, 0x7B23F920, 0xE1C64F49, 0xE82D6B79, 0x72C8DD10, 0x9928E54E, 0x03CD5327,
+	0xCF81FBB9, 0x55644DD0, 0xBE84758E, 0x2461C3E7, 0x2D8AE7D7, 0xB76F51BE, 0x5C8F69E0, 0xC66ADF89,
+	0x4F592180, 0xD5BC97E9, 0x3E5CAFB7, 0xA4B919DE, 0xAD523DEE, 0x37B78B87, 0xDC57B3D9, 0x46B205B0,
+	0x5133B8B9, 0xCBD60ED0, 0x2036368E, 0xBAD380E7, 0xB338A4D7, 0x29DD12BE, 0xC23D2AE0, 0x58D89C89,
+	0xD1EB6280, 0x4B0ED4E9, 0xA0EEECB7, 0x3A0B5ADE, 0x33E07EEE, 0xA905C887, 0x42E5F0D9, 0xD80046B0,
+	0x144CEE2E, 0x8EA95847, 0x65496019, 0xFFACD670, 0xF647F240, 0x6CA24429, 0x87427C77, 0x1DA7CA1E,
+	0x94943417, 0x0E71827E, 0xE591BA20, 0x7F740C49, 0x769F2879, 0xEC7A9E10, 0x079AA64E, 0x9D7F1027,
+	0xDBCD1597, 0x4128A3FE, 0xAAC89BA0, 0x302D2DC9, 0x39C609F9, 0xA323BF90, 0x48C387CE, 0xD22631A7,
+	0x5B15CFAE, 0xC1F079C7, 0x2A104199, 0xB0F5F7F0, 0xB91ED3C0, 0x23FB65A9, 0xC81B5DF7, 0x52FEEB9E,
+	0x9EB24300, 0x0457F569, 0xEFB7CD37, 0x75527B5E, 0x7CB95F6E, 0xE65CE907, 0x0DBCD159, 0x97596730,
+	0x1E6A9939, 0x848F2F50, 0x6F6F170E, 0xF58AA167, 0xFC618557, 0x6684333E, 0x8D640B60, 0x1781BD09,
+	0xA2677172, 0x3882C71B, 0xD362FF45, 0x4987492C, 0x406C6D1C, 0xDA89DB75, 0x3169E32B, 0xAB8C5542,
+	0x22BFAB4B, 0xB85A1D22, 0x53BA257C, 0xC95F9315, 0xC0B4B725, 0x5A51014C, 0xB1B13912, 0x2B548F7B,
+	0xE71827E5, 0x7DFD918C, 0x961DA9D2, 0x0CF81FBB, 0x05133B8B, 0x9FF68DE2, 0x7416B5BC, 0xEEF303D5,
+	0x67C0FDDC, 0xFD254BB5, 0x16C573EB, 0x8C20C582, 0x85CBE1B2, 0x1F2E57DB, 0xF4CE6F85, 0x6E2BD9EC,
+	0x2899DC5C, 0xB27C6A35, 0x599C526B, 0xC379E402, 0xCA92C032, 0x5077765B, 0xBB974E05, 0x2172F86C,
+	0xA8410665, 0x32A4B00C, 0xD9448852, 0x43A13E3B, 0x4A4A1A0B, 0xD0AFAC62, 0x3B4F943C, 0xA1AA2255,
+	0x6DE68ACB, 0xF7033CA2, 0x1CE304FC, 0x8606B295, 0x8FED96A5, 0x150820CC, 0xFEE81892, 0x640DAEFB,
+	0xED3E50F2, 0x77DBE69B, 0x9C3BDEC5, 0x06DE68AC, 0x0F354C9C, 0x95D0FAF5, 0x7E30C2AB, 0xE4D574C2,
+	0xF354C9CB, 0x69B17FA2, 0x825147FC, 0x18B4F195, 0x115FD5A5, 0x8BBA63CC, 0x605A5B92, 0xFABFEDFB,
+	0x738C13F2, 0xE969A59B, 0x02899DC5, 0x986C2BAC, 0x91870F9C, 0x0B62B9F5, 0xE08281AB, 0x7A6737C2,
+	0xB62B9F5C, 0x2CCE2935, 0xC72E116B, 0x5DCBA702, 0x54208332, 0xCEC5355B, 0x25250D05, 0xBFC0BB6C,
+	0x36F34565, 0xAC16F30C, 0x47F6CB52, 0xDD137D3B, 0xD4F8590B, 0x4E1DEF62, 0xA5FDD73C, 0x3F186155,
+	0x79AA64E5, 0xE34FD28C, 0x08AFEAD2, 0x924A5CBB, 0x9BA1788B, 0x0144CEE2, 0xEAA4F6BC, 0x704140D5,
+	0xF972BEDC, 0x639708B5, 0x887730EB, 0x12928682, 0x1B79A2B2, 0x819C14DB, 0x6A7C2C85, 0xF0999AEC,
+	0x3CD53272, 0xA630841B, 0x4DD0BC45, 0xD7350A2C, 0xDEDE2E1C, 0x443B9875, 0xAFDBA02B, 0x353E1642,
+	0xBC0DE84B, 0x26E85E22, 0xCD08667C, 0x57EDD015, 0x5E06F425, 0xC4E3424C, 0x2F037A12, 0xB5E6CC7B,
+	// Seed 0x24
+	0x00000000, 0x272A4312, 0x36534F87, 0x11790C95, 0x14A156AD, 0x338B15BF, 0x22F2192A, 0x05D85A38,
+	0x2942AD5A, 0x0E68EE48, 0x1F11E2DD, 0x383BA1CF, 0x3DE3FBF7, 0x1AC9B8E5, 0x0BB0B470, 0x2C9AF762,
+	0x2A829317, 0x0DA8D005, 0x1CD1DC90, 0x3BFB9F82, 0x3E23C5BA, 0x190986A8, 0x08708A3D, 0x2F5AC92F,
+	0x03C03E4D, 0x24EA7D5F, 0x359371CA, 0x12B932D8, 0x176168E0, 0x304B2BF2, 0x21322767, 0x06186475,
+	0x2D02EF8D, 0x0A28AC9F, 0x1B51A00A, 0x3C7BE318, 0x39A3B920, 0x1E89FA32, 0x0FF0F6A7, 0x28DAB5B5,
+	0x044042D7, 0x236A01C5, 0x32130D50, 0x15394E42, 0x10E1147A, 0x37CB5768, 0x26B25BFD, 0x019818EF,
+	0x07807C9A, 0x20AA3F88, 0x31D3331D, 0x16F9700F, 0x13212A37, 0x340B6925, 0x257265B0, 0x025826A2,
+	0x2EC2D1C0, 0x09E892D2, 0x18919E47, 0x3FBBDD55, 0x3A63876D, 0x1D49C47F, 0x0C30C8EA, 0x2B1A8BF8,
+	0x220216B9, 0x052855AB, 0x1451593E, 0x337B1A2C, 0x36A34014, 0x11890306, 0x00F00F93, 0x27DA4C81,
+	0x0B40BBE3, 0x2C6AF8F1, 0x3D13F464, 0x1A39B776, 0x1FE1ED4E, 0x38CBAE5C, 0x29B2A2C9, 0x0E98E1DB,
+	0x088085AE, 0x2FAAC6BC, 0x3ED3CA29, 0x19F9893B, 0x1C21D303, 0x3B0B9011, 0x2A729C84, 0x0D58DF96,
+	0x21C228F4, 0x06E86BE6, 0x17916773, 0x30BB2461, 0x35637E59, 0x12493D4B, 0x033031DE, 0x241A72CC,
+	0x0F00F934, 0x282ABA26, 0x3953B6B3, 0x1E79F5A1, 0x1BA1AF99, 0x3C8BEC8B, 0x2DF2E01E, 0x0AD8A30C,
+	0x2642546E, 0x0168177C, 0x10111BE9, 0x373B58FB, 0x32E302C3, 0x15C941D1, 0x04B04D44, 0x239A0E56,
+	0x25826A23, 0x02A82931, 0x13D125A4, 0x34FB66B6, 0x31233C8E, 0x16097F9C, 0x07707309, 0x205A301B,
+	0x0CC0C779, 0x2BEA846B, 0x3A9388FE, 0x1DB9CBEC, 0x186191D4, 0x3F4BD2C6, 0x2E32DE53, 0x09189D41,
+	0x3C03E4D1, 0x1B29A7C3, 0x0A50AB56, 0x2D7AE844, 0x28A2B27C, 0x0F88F16E, 0x1EF1FDFB, 0x39DBBEE9,
+	0x1541498B, 0x326B0A99, 0x2312060C, 0x0438451E, 0x01E01F26, 0x26CA5C34, 0x37B350A1, 0x109913B3,
+	0x168177C6, 0x31AB34D4, 0x20D23841, 0x07F87B53, 0x0220216B, 0x250A6279, 0x34736EEC, 0x13592DFE,
+	0x3FC3DA9C, 0x18E9998E, 0x0990951B, 0x2EBAD609, 0x2B628C31, 0x0C48CF23, 0x1D31C3B6, 0x3A1B80A4,
+	0x11010B5C, 0x362B484E, 0x275244DB, 0x007807C9, 0x05A05DF1, 0x228A1EE3, 0x33F31276, 0x14D95164,
+	0x3843A606, 0x1F69E514, 0x0E10E981, 0x293AAA93, 0x2CE2F0AB, 0x0BC8B3B9, 0x1AB1BF2C, 0x3D9BFC3E,
+	0x3B83984B, 0x1CA9DB59, 0x0DD0D7CC, 0x2AFA94DE, 0x2F22CEE6, 0x08088DF4, 0x19718161, 0x3E5BC273,
+	0x12C13511, 0x35EB7603, 0x24927A96, 0x03B83984, 0x066063BC, 0x214A20AE, 0x30332C3B, 0x17196F29,
+	0x1E01F268, 0x392BB17A, 0x2852BDEF, 0x0F78FEFD, 0x0AA0A4C5, 0x2D8AE7D7, 0x3CF3EB42, 0x1BD9A850,
+	0x37435F32, 0x10691C20, 0x011010B5, 0x263A53A7, 0x23E2099F, 0x04C84A8D, 0x15B14618, 0x329B050A,
+	0x3483617F, 0x13A9226D, 0x02D02EF8, 0x25FA6DEA, 0x202237D2, 0x070874C0, 0x16717855, 0x315B3B47,
+	0x1DC1CC25, 0x3AEB8F37, 0x2B9283A2, 0x0CB8C0B0, 0x09609A88, 0x2E4AD99A, 0x3F33D50F, 0x1819961D,
+	0x33031DE5, 0x14295EF7, 0x05505262, 0x227A1170, 0x27A24B48, 0x0088085A, 0x11F104CF, 0x36DB47DD,
+	0x1A41B0BF, 0x3D6BF3AD, 0x2C12FF38, 0x0B38BC2A, 0x0EE0E612, 0x29CAA500, 0x38B3A995, 0x1F99EA87,
+	0x19818EF2, 0x3EABCDE0, 0x2FD2C175, 0x08F88267, 0x0D20D85F, 0x2A0A9B4D, 0x3B7397D8, 0x1C59D4CA,
+	0x30C323A8, 0x17E960BA, 0x06906C2F, 0x21BA2F3D, 0x24627505, 0x03483617, 0x12313A82, 0x351B7990,
+	// Seed 0x25
+	0x00000000, 0x511F6127, 0x34376AC1, 0x65280BE6, 0x686ED582, 0x3971B4A5, 0x5C59BF43, 0x0D46DE64,
+	0x46D4038B, 0x17CB62AC, 0x72E3694A, 0x23FC086D, 0x2EBAD609, 0x7FA5B72E, 0x1A8DBCC8, 0x4B92DDEF,
+	0x1BA1AF99, 0x4ABECEBE, 0x2F96C558, 0x7E89A47F, 0x73CF7A1B, 0x22D01B3C, 0x47F810DA, 0x16E771FD,
+	0x5D75AC12, 0x0C6ACD35, 0x6942C6D3, 0x385DA7F4, 0x351B7990, 0x640418B7, 0x012C1351, 0x50337276,
+	0x37435F32, 0x665C3E15, 0x037435F3, 0x526B54D4, 0x5F2D8AB0, 0x0E32EB97, 0x6B1AE071, 0x3A058156,
+	0x71975CB9, 0x20883D9E, 0x45A03678, 0x14BF575F, 0x19F9893B, 0x48E6E81C, 0x2DCEE3FA, 0x7CD182DD,
+	0x2CE2F0AB, 0x7DFD918C, 0x18D59A6A, 0x49CAFB4D, 0x448C2529, 0x1593440E, 0x70BB4FE8, 0x21A42ECF,
+	0x6A36F320, 0x3B299207, 0x5E0199E1, 0x0F1EF8C6, 0x025826A2, 0x53474785, 0x366F4C63, 0x67702D44,
+	0x6E86BE64, 0x3F99DF43, 0x5AB1D4A5, 0x0BAEB582, 0x06E86BE6, 0x57F70AC1, 0x32DF0127, 0x63C06000,
+	0x2852BDEF, 0x794DDCC8, 0x1C65D72E, 0x4D7AB609, 0x403C686D, 0x1123094A, 0x740B02AC, 0x2514638B,
+	0x752711FD, 0x243870DA, 0x41107B3C, 0x100F1A1B, 0x1D49C47F, 0x4C56A558, 0x297EAEBE, 0x7861CF99,
+	0x33F31276, 0x62EC7351, 0x07C478B7, 0x56DB1990, 0x5B9DC7F4, 0x0A82A6D3, 0x6FAAAD35, 0x3EB5CC12,
+	0x59C5E156, 0x08DA8071, 0x6DF28B97, 0x3CEDEAB0, 0x31AB34D4, 0x60B455F3, 0x059C5E15, 0x54833F32,
+	0x1F11E2DD, 0x4E0E83FA, 0x2B26881C, 0x7A39E93B, 0x777F375F, 0x26605678, 0x43485D9E, 0x12573CB9,
+	0x42644ECF, 0x137B2FE8, 0x7653240E, 0x274C4529, 0x2A0A9B4D, 0x7B15FA6A, 0x1E3DF18C, 0x4F2290AB,
+	0x04B04D44, 0x55AF2C63, 0x30872785, 0x619846A2, 0x6CDE98C6, 0x3DC1F9E1, 0x58E9F207, 0x09F69320,
+	0x4B04D447, 0x1A1BB560, 0x7F33BE86, 0x2E2CDFA1, 0x236A01C5, 0x727560E2, 0x175D6B04, 0x46420A23,
+	0x0DD0D7CC, 0x5CCFB6EB, 0x39E7BD0D, 0x68F8DC2A, 0x65BE024E, 0x34A16369, 0x5189688F, 0x009609A8,
+	0x50A57BDE, 0x01BA1AF9, 0x6492111F, 0x358D7038, 0x38CBAE5C, 0x69D4CF7B, 0x0CFCC49D, 0x5DE3A5BA,
+	0x16717855, 0x476E1972, 0x22461294, 0x735973B3, 0x7E1FADD7, 0x2F00CCF0, 0x4A28C716, 0x1B37A631,
+	0x7C478B75, 0x2D58EA52, 0x4870E1B4, 0x196F8093, 0x14295EF7, 0x45363FD0, 0x201E3436, 0x71015511,
+	0x3A9388FE, 0x6B8CE9D9, 0x0EA4E23F, 0x5FBB8318, 0x52FD5D7C, 0x03E23C5B, 0x66CA37BD, 0x37D5569A,
+	0x67E624EC, 0x36F945CB, 0x53D14E2D, 0x02CE2F0A, 0x0F88F16E, 0x5E979049, 0x3BBF9BAF, 0x6AA0FA88,
+	0x21322767, 0x702D4640, 0x15054DA6, 0x441A2C81, 0x495CF2E5, 0x184393C2, 0x7D6B9824, 0x2C74F903,
+	0x25826A23, 0x749D0B04, 0x11B500E2, 0x40AA61C5, 0x4DECBFA1, 0x1CF3DE86, 0x79DBD560, 0x28C4B447,
+	0x635669A8, 0x3249088F, 0x57610369, 0x067E624E, 0x0B38BC2A, 0x5A27DD0D, 0x3F0FD6EB, 0x6E10B7CC,
+	0x3E23C5BA, 0x6F3CA49D, 0x0A14AF7B, 0x5B0BCE5C, 0x564D1038, 0x0752711F, 0x627A7AF9, 0x33651BDE,
+	0x78F7C631, 0x29E8A716, 0x4CC0ACF0, 0x1DDFCDD7, 0x109913B3, 0x41867294, 0x24AE7972, 0x75B11855,
+	0x12C13511, 0x43DE5436, 0x26F65FD0, 0x77E93EF7, 0x7AAFE093, 0x2BB081B4, 0x4E988A52, 0x1F87EB75,
+	0x5415369A, 0x050A57BD, 0x60225C5B, 0x313D3D7C, 0x3C7BE318, 0x6D64823F, 0x084C89D9, 0x5953E8FE,
+	0x09609A88, 0x587FFBAF, 0x3D57F049, 0x6C48916E, 0x610E4F0A, 0x30112E2D, 0x553925CB, 0x042644EC,
+	0x4FB49903, 0x1EABF824, 0x7B83F3C2, 0x2A9C92E5, 0x27DA4C81, 0x76C52DA6, 0x13ED2640, 0x42F24767,
+	// Seed 0x26
+	0x00000000, 0xE2F2A5B1, 0x61FE4099, 0x830CE528, 0xC3FC8132, 0x210E2483, 0xA202C1AB, 0x40F0641A,
+	0x23E2099F, 0xC110AC2E, 0x421C4906, 0xA0EEECB7, 0xE01E88AD, 0x02EC2D1C, 0x81E0C834, 0x63126D85,
+	0x47C4133E, 0xA536B68F, 0x263A53A7, 0xC4C8F616, 0x8438920C, 0x66CA37BD, 0xE5C6D295, 0x07347724,
+	0x64261AA1, 0x86D4BF10, 0x05D85A38, 0xE72AFF89, 0xA7DA9B93, 0x45283E22, 0xC624DB0A, 0x24D67EBB,
+	0x8F88267C, 0x6D7A83CD, 0xEE7666E5, 0x0C84C354, 0x4C74A74E, 0xAE8602FF, 0x2D8AE7D7, 0xCF784266,
+	0xAC6A2FE3, 0x4E988A52, 0xCD946F7A, 0x2F66CACB, 0x6F96AED1, 0x8D640B60, 0x0E68EE48, 0xEC9A4BF9,
+	0xC84C3542, 0x2ABE90F3, 0xA9B275DB, 0x4B40D06A, 0x0BB0B470, 0xE94211C1, 0x6A4EF4E9, 0x88BC5158,
+	0xEBAE3CDD, 0x095C996C, 0x8A507C44, 0x68A2D9F5, 0x2852BDEF, 0xCAA0185E, 0x49ACFD76, 0xAB5E58C7,
+	0xBB0B4703, 0x59F9E2B2, 0xDAF5079A, 0x3807A22B, 0x78F7C631, 0x9A056380, 0x190986A8, 0xFBFB2319,
+	0x98E94E9C, 0x7A1BEB2D, 0xF9170E05, 0x1BE5ABB4, 0x5B15CFAE, 0xB9E76A1F, 0x3AEB8F37, 0xD8192A86,
+	0xFCCF543D, 0x1E3DF18C, 0x9D3114A4, 0x7FC3B115, 0x3F33D50F, 0xDDC170BE, 0x5ECD9596, 0xBC3F3027,
+	0xDF2D5DA2, 0x3DDFF813, 0xBED31D3B, 0x5C21B88A, 0x1CD1DC90, 0xFE237921, 0x7D2F9C09, 0x9FDD39B8,
+	0x3483617F, 0xD671C4CE, 0x557D21E6, 0xB78F8457, 0xF77FE04D, 0x158D45FC, 0x9681A0D4, 0x74730565,
+	0x176168E0, 0xF593CD51, 0x769F2879, 0x946D8DC8, 0xD49DE9D2, 0x366F4C63, 0xB563A94B, 0x57910CFA,
+	0x73477241, 0x91B5D7F0, 0x12B932D8, 0xF04B9769, 0xB0BBF373, 0x524956C2, 0xD145B3EA, 0x33B7165B,
+	0x50A57BDE, 0xB257DE6F, 0x315B3B47, 0xD3A99EF6, 0x9359FAEC, 0x71AB5F5D, 0xF2A7BA75, 0x10551FC4,
+	0xD20D85FD, 0x30FF204C, 0xB3F3C564, 0x510160D5, 0x11F104CF, 0xF303A17E, 0x700F4456, 0x92FDE1E7,
+	0xF1EF8C62, 0x131D29D3, 0x9011CCFB, 0x72E3694A, 0x32130D50, 0xD0E1A8E1, 0x53ED4DC9, 0xB11FE878,
+	0x95C996C3, 0x773B3372, 0xF437D65A, 0x16C573EB, 0x563517F1, 0xB4C7B240, 0x37CB5768, 0xD539F2D9,
+	0xB62B9F5C, 0x54D93AED, 0xD7D5DFC5, 0x35277A74, 0x75D71E6E, 0x9725BBDF, 0x14295EF7, 0xF6DBFB46,
+	0x5D85A381, 0xBF770630, 0x3C7BE318, 0xDE8946A9, 0x9E7922B3, 0x7C8B8702, 0xFF87622A, 0x1D75C79B,
+	0x7E67AA1E, 0x9C950FAF, 0x1F99EA87, 0xFD6B4F36, 0xBD9B2B2C, 0x5F698E9D, 0xDC656BB5, 0x3E97CE04,
+	0x1A41B0BF, 0xF8B3150E, 0x7BBFF026, 0x994D5597, 0xD9BD318D, 0x3B4F943C, 0xB8437114, 0x5AB1D4A5,
+	0x39A3B920, 0xDB511C91, 0x585DF9B9, 0xBAAF5C08, 0xFA5F3812, 0x18AD9DA3, 0x9BA1788B, 0x7953DD3A,
+	0x6906C2FE, 0x8BF4674F, 0x08F88267, 0xEA0A27D6, 0xAAFA43CC, 0x4808E67D, 0xCB040355, 0x29F6A6E4,
+	0x4AE4CB61, 0xA8166ED0, 0x2B1A8BF8, 0xC9E82E49, 0x89184A53, 0x6BEAEFE2, 0xE8E60ACA, 0x0A14AF7B,
+	0x2EC2D1C0, 0xCC307471, 0x4F3C9159, 0xADCE34E8, 0xED3E50F2, 0x0FCCF543, 0x8CC0106B, 0x6E32B5DA,
+	0x0D20D85F, 0xEFD27DEE, 0x6CDE98C6, 0x8E2C3D77, 0xCEDC596D, 0x2C2EFCDC, 0xAF2219F4, 0x4DD0BC45,
+	0xE68EE482, 0x047C4133, 0x8770A41B, 0x658201AA, 0x257265B0, 0xC780C001, 0x448C2529, 0xA67E8098,
+	0xC56CED1D, 0x279E48AC, 0xA492AD84, 0x46600835, 0x06906C2F, 0xE462C99E, 0x676E2CB6, 0x859C8907,
+	0xA14AF7BC, 0x43B8520D, 0xC0B4B725, 0x22461294, 0x62B6768E, 0x8044D33F, 0x03483617, 0xE1BA93A6,
+	0x82A8FE23, 0x605A5B92, 0xE356BEBA, 0x01A41B0B, 0x41547F11, 0xA3A6DAA0, 0x20AA3F88, 0xC2589A39,
+	// Seed 0x27
+	0x00000000, 0x5B0BCE5C, 0xB6179CB8, 0xED1C52E4, 0x263A53A7, 0x7D319DFB, 0x902DCF1F, 0xCB260143,
+	0x4C74A74E, 0x177F6912, 0xFA633BF6, 0xA168F5AA, 0x6A4EF4E9, 0x31453AB5, 0xDC596851, 0x8752A60D,
+	0x98E94E9C, 0xC3E280C0, 0x2EFED224, 0x75F51C78, 0xBED31D3B, 0xE5D8D367, 0x08C48183, 0x53CF4FDF,
+	0xD49DE9D2, 0x8F96278E, 0x628A756A, 0x3981BB36, 0xF2A7BA75, 0xA9AC7429, 0x44B026CD, 0x1FBBE891,
+	0x7BC7F7EF, 0x20CC39B3, 0xCDD06B57, 0x96DBA50B, 0x5DFDA448, 0x06F66A14, 0xEBEA38F0, 0xB0E1F6AC,
+	0x37B350A1, 0x6CB89EFD, 0x81A4CC19, 0xDAAF0245, 0x11890306, 0x4A82CD5A, 0xA79E9FBE, 0xFC9551E2,
+	0xE32EB973, 0xB825772F, 0x553925CB, 0x0E32EB97, 0xC514EAD4, 0x9E1F2488, 0x7303766C, 0x2808B830,
+	0xAF5A1E3D, 0xF451D061, 0x194D8285, 0x42464CD9, 0x89604D9A, 0xD26B83C6, 0x3F77D122, 0x647C1F7E,
+	0xF78FEFDE, 0xAC842182, 0x41987366, 0x1A93BD3A, 0xD1B5BC79, 0x8ABE7225, 0x67A220C1, 0x3CA9EE9D,
+	0xBBFB4890, 0xE0F086CC, 0x0DECD428, 0x56E71A74, 0x9DC11B37, 0xC6CAD56B, 0x2BD6878F, 0x70DD49D3,
+	0x6F66A142, 0x346D6F1E, 0xD9713DFA, 0x827AF3A6, 0x495CF2E5, 0x12573CB9, 0xFF4B6E5D, 0xA440A001,
+	0x2312060C, 0x7819C850, 0x95059AB4, 0xCE0E54E8, 0x052855AB, 0x5E239BF7, 0xB33FC913, 0xE834074F,
+	0x8C481831, 0xD743D66D, 0x3A5F8489, 0x61544AD5, 0xAA724B96, 0xF17985CA, 0x1C65D72E, 0x476E1972,
+	0xC03CBF7F, 0x9B377123, 0x762B23C7, 0x2D20ED9B, 0xE606ECD8, 0xBD0D2284, 0x50117060, 0x0B1ABE3C,
+	0x14A156AD, 0x4FAA98F1, 0xA2B6CA15, 0xF9BD0449, 0x329B050A, 0x6990CB56, 0x848C99B2, 0xDF8757EE,
+	0x58D5F1E3, 0x03DE3FBF, 0xEEC26D5B, 0xB5C9A307, 0x7EEFA244, 0x25E46C18, 0xC8F83EFC, 0x93F3F0A0,
+	0xA50AB56B, 0xFE017B37, 0x131D29D3, 0x4816E78F, 0x8330E6CC, 0xD83B2890, 0x35277A74, 0x6E2CB428,
+	0xE97E1225, 0xB275DC79, 0x5F698E9D, 0x046240C1, 0xCF444182, 0x944F8FDE, 0x7953DD3A, 0x22581366,
+	0x3DE3FBF7, 0x66E835AB, 0x8BF4674F, 0xD0FFA913, 0x1BD9A850, 0x40D2660C, 0xADCE34E8, 0xF6C5FAB4,
+	0x71975CB9, 0x2A9C92E5, 0xC780C001, 0x9C8B0E5D, 0x57AD0F1E, 0x0CA6C142, 0xE1BA93A6, 0xBAB15DFA,
+	0xDECD4284, 0x85C68CD8, 0x68DADE3C, 0x33D11060, 0xF8F71123, 0xA3FCDF7F, 0x4EE08D9B, 0x15EB43C7,
+	0x92B9E5CA, 0xC9B22B96, 0x24AE7972, 0x7FA5B72E, 0xB483B66D, 0xEF887831, 0x02942AD5, 0x599FE489,
+	0x46240C18, 0x1D2FC244, 0xF03390A0, 0xAB385EFC, 0x601E5FBF, 0x3B1591E3, 0xD609C307, 0x8D020D5B,
+	0x0A50AB56, 0x515B650A, 0xBC4737EE, 0xE74CF9B2, 0x2C6AF8F1, 0x776136AD, 0x9A7D6449, 0xC176AA15,
+	0x52855AB5, 0x098E94E9, 0xE492C60D, 0xBF990851, 0x74BF0912, 0x2FB4C74E, 0xC2A895AA, 0x99A35BF6,
+	0x1EF1FDFB, 0x45FA33A7, 0xA8E66143, 0xF3EDAF1F, 0x38CBAE5C, 0x63C06000, 0x8EDC32E4, 0xD5D7FCB8,
+	0xCA6C1429, 0x9167DA75, 0x7C7B8891, 0x277046CD, 0xEC56478E, 0xB75D89D2, 0x5A41DB36, 0x014A156A,
+	0x8618B367, 0xDD137D3B, 0x300F2FDF, 0x6B04E183, 0xA022E0C0, 0xFB292E9C, 0x16357C78, 0x4D3EB224,
+	0x2942AD5A, 0x72496306, 0x9F5531E2, 0xC45EFFBE, 0x0F78FEFD, 0x547330A1, 0xB96F6245, 0xE264AC19,
+	0x65360A14, 0x3E3DC448, 0xD32196AC, 0x882A58F0, 0x430C59B3, 0x180797EF, 0xF51BC50B, 0xAE100B57,
+	0xB1ABE3C6, 0xEAA02D9A, 0x07BC7F7E, 0x5CB7B122, 0x9791B061, 0xCC9A7E3D, 0x21862CD9, 0x7A8DE285,
+	0xFDDF4488, 0xA6D48AD4, 0x4BC8D830, 0x10C3166C, 0xDBE5172F, 0x80EED973, 0x6DF28B97, 0x36F945CB,
+	// Seed 0x28
+	0x00000000, 0x391E04D2, 0x19575851, 0x20495C83, 0x32AEB0A2, 0x0BB0B470, 0x2BF9E8F3, 0x12E7EC21,
+	0x0E3630B1, 0x37283463, 0x176168E0, 0x2E7F6C32, 0x3C988013, 0x058684C1, 0x25CFD842, 0x1CD1DC90,
+	0x1C6C6162, 0x257265B0, 0x053B3933, 0x3C253DE1, 0x2EC2D1C0, 0x17DCD512, 0x37958991, 0x0E8B8D43,
+	0x125A51D3, 0x2B445501, 0x0B0D0982, 0x32130D50, 0x20F4E171, 0x19EAE5A3, 0x39A3B920, 0x00BDBDF2,
+	0x38D8C2C4, 0x01C6C616, 0x218F9A95, 0x18919E47, 0x0A767266, 0x336876B4, 0x13212A37, 0x2A3F2EE5,
+	0x36EEF275, 0x0FF0F6A7, 0x2FB9AA24, 0x16A7AEF6, 0x044042D7, 0x3D5E4605, 0x1D171A86, 0x24091E54,
+	0x24B4A3A6, 0x1DAAA774, 0x3DE3FBF7, 0x04FDFF25, 0x161A1304, 0x2F0417D6, 0x0F4D4B55, 0x36534F87,
+	0x2A829317, 0x139C97C5, 0x33D5CB46, 0x0ACBCF94, 0x182C23B5, 0x21322767, 0x017B7BE4, 0x38657F36,
+	0x1ADAD47D, 0x23C4D0AF, 0x038D8C2C, 0x3A9388FE, 0x287464DF, 0x116A600D, 0x31233C8E, 0x083D385C,
+	0x14ECE4CC, 0x2DF2E01E, 0x0DBBBC9D, 0x34A5B84F, 0x2642546E, 0x1F5C50BC, 0x3F150C3F, 0x060B08ED,
+	0x06B6B51F, 0x3FA8B1CD, 0x1FE1ED4E, 0x26FFE99C, 0x341805BD, 0x0D06016F, 0x2D4F5DEC, 0x1451593E,
+	0x088085AE, 0x319E817C, 0x11D7DDFF, 0x28C9D92D, 0x3A2E350C, 0x033031DE, 0x23796D5D, 0x1A67698F,
+	0x220216B9, 0x1B1C126B, 0x3B554EE8, 0x024B4A3A, 0x10ACA61B, 0x29B2A2C9, 0x09FBFE4A, 0x30E5FA98,
+	0x2C342608, 0x152A22DA, 0x35637E59, 0x0C7D7A8B, 0x1E9A96AA, 0x27849278, 0x07CDCEFB, 0x3ED3CA29,
+	0x3E6E77DB, 0x07707309, 0x27392F8A, 0x1E272B58, 0x0CC0C779, 0x35DEC3AB, 0x15979F28, 0x2C899BFA,
+	0x3058476A, 0x094643B8, 0x290F1F3B, 0x10111BE9, 0x02F6F7C8, 0x3BE8F31A, 0x1BA1AF99, 0x22BFAB4B,
+	0x35B5A8FA, 0x0CABAC28, 0x2CE2F0AB, 0x15FCF479, 0x071B1858, 0x3E051C8A, 0x1E4C4009, 0x275244DB,
+	0x3B83984B, 0x029D9C99, 0x22D4C01A, 0x1BCAC4C8, 0x092D28E9, 0x30332C3B, 0x107A70B8, 0x2964746A,
+	0x29D9C998, 0x10C7CD4A, 0x308E91C9, 0x0990951B, 0x1B77793A, 0x22697DE8, 0x0220216B, 0x3B3E25B9,
+	0x27EFF929, 0x1EF1FDFB, 0x3EB8A178, 0x07A6A5AA, 0x1541498B, 0x2C5F4D59, 0x0C1611DA, 0x35081508,
+	0x0D6D6A3E, 0x34736EEC, 0x143A326F, 0x2D2436BD, 0x3FC3DA9C, 0x06DDDE4E, 0x269482CD, 0x1F8A861F,
+	0x035B5A8F, 0x3A455E5D, 0x1A0C02DE, 0x2312060C, 0x31F5EA2D, 0x08EBEEFF, 0x28A2B27C, 0x11BCB6AE,
+	0x11010B5C, 0x281F0F8E, 0x0856530D, 0x314857DF, 0x23AFBBFE, 0x1AB1BF2C, 0x3AF8E3AF, 0x03E6E77D,
+	0x1F373BED, 0x26293F3F, 0x066063BC, 0x3F7E676E, 0x2D998B4F, 0x14878F9D, 0x34CED31E, 0x0DD0D7CC,
+	0x2F6F7C87, 0x16717855, 0x363824D6, 0x0F262004, 0x1DC1CC25, 0x24DFC8F7, 0x04969474, 0x3D8890A6,
+	0x21594C36, 0x184748E4, 0x380E1467, 0x011010B5, 0x13F7FC94, 0x2AE9F846, 0x0AA0A4C5, 0x33BEA017,
+	0x33031DE5, 0x0A1D1937, 0x2A5445B4, 0x134A4166, 0x01ADAD47, 0x38B3A995, 0x18FAF516, 0x21E4F1C4,
+	0x3D352D54, 0x042B2986, 0x24627505, 0x1D7C71D7, 0x0F9B9DF6, 0x36859924, 0x16CCC5A7, 0x2FD2C175,
+	0x17B7BE43, 0x2EA9BA91, 0x0EE0E612, 0x37FEE2C0, 0x25190EE1, 0x1C070A33, 0x3C4E56B0, 0x05505262,
+	0x19818EF2, 0x209F8A20, 0x00D6D6A3, 0x39C8D271, 0x2B2F3E50, 0x12313A82, 0x32786601, 0x0B6662D3,
+	0x0BDBDF21, 0x32C5DBF3, 0x128C8770, 0x2B9283A2, 0x39756F83, 0x006B6B51, 0x202237D2, 0x193C3300,
+	0x05EDEF90, 0x3CF3EB42, 0x1CBAB7C1, 0x25A4B313, 0x37435F32, 0x0E5D5BE0, 0x2E140763, 0x170A03B1,
+	// Seed 0x29
+	0x00000000, 0x4E4A87D7, 0x19F03F77, 0x57BAB8A0, 0x33E07EEE, 0x7DAAF939, 0x2A104199, 0x645AC64E,
+	0x67C0FDDC, 0x298A7A0B, 0x7E30C2AB, 0x307A457C, 0x54208332, 0x1A6A04E5, 0x4DD0BC45, 0x039A3B92,
+	0x4AE4CB61, 0x04AE4CB6, 0x5314F416, 0x1D5E73C1, 0x7904B58F, 0x374E3258, 0x60F48AF8, 0x2EBE0D2F,
+	0x2D2436BD, 0x636EB16A, 0x34D409CA, 0x7A9E8E1D, 0x1EC44853, 0x508ECF84, 0x07347724, 0x497EF0F3,
+	0x10ACA61B, 0x5EE621CC, 0x095C996C, 0x47161EBB, 0x234CD8F5, 0x6D065F22, 0x3ABCE782, 0x74F66055,
+	0x776C5BC7, 0x3926DC10, 0x6E9C64B0, 0x20D6E367, 0x448C2529, 0x0AC6A2FE, 0x5D7C1A5E, 0x13369D89,
+	0x5A486D7A, 0x1402EAAD, 0x43B8520D, 0x0DF2D5DA, 0x69A81394, 0x27E29443, 0x70582CE3, 0x3E12AB34,
+	0x3D8890A6, 0x73C21771, 0x2478AFD1, 0x6A322806, 0x0E68EE48, 0x4022699F, 0x1798D13F, 0x59D256E8,
+	0x21594C36, 0x6F13CBE1, 0x38A97341, 0x76E3F496, 0x12B932D8, 0x5CF3B50F, 0x0B490DAF, 0x45038A78,
+	0x4699B1EA, 0x08D3363D, 0x5F698E9D, 0x1123094A, 0x7579CF04, 0x3B3348D3, 0x6C89F073, 0x22C377A4,
+	0x6BBD8757, 0x25F70080, 0x724DB820, 0x3C073FF7, 0x585DF9B9, 0x16177E6E, 0x41ADC6CE, 0x0FE74119,
+	0x0C7D7A8B, 0x4237FD5C, 0x158D45FC, 0x5BC7C22B, 0x3F9D0465, 0x71D783B2, 0x266D3B12, 0x6827BCC5,
+	0x31F5EA2D, 0x7FBF6DFA, 0x2805D55A, 0x664F528D, 0x021594C3, 0x4C5F1314, 0x1BE5ABB4, 0x55AF2C63,
+	0x563517F1, 0x187F9026, 0x4FC52886, 0x018FAF51, 0x65D5691F, 0x2B9FEEC8, 0x7C255668, 0x326FD1BF,
+	0x7B11214C, 0x355BA69B, 0x62E11E3B, 0x2CAB99EC, 0x48F15FA2, 0x06BBD875, 0x510160D5, 0x1F4BE702,
+	0x1CD1DC90, 0x529B5B47, 0x0521E3E7, 0x4B6B6430, 0x2F31A27E, 0x617B25A9, 0x36C19D09, 0x788B1ADE,
+	0x42B2986C, 0x0CF81FBB, 0x5B42A71B, 0x150820CC, 0x7152E682, 0x3F186155, 0x68A2D9F5, 0x26E85E22,
+	0x257265B0, 0x6B38E267, 0x3C825AC7, 0x72C8DD10, 0x16921B5E, 0x58D89C89, 0x0F622429, 0x4128A3FE,
+	0x0856530D, 0x461CD4DA, 0x11A66C7A, 0x5FECEBAD, 0x3BB62DE3, 0x75FCAA34, 0x22461294, 0x6C0C9543,
+	0x6F96AED1, 0x21DC2906, 0x766691A6, 0x382C1671, 0x5C76D03F, 0x123C57E8, 0x4586EF48, 0x0BCC689F,
+	0x521E3E77, 0x1C54B9A0, 0x4BEE0100, 0x05A486D7, 0x61FE4099, 0x2FB4C74E, 0x780E7FEE, 0x3644F839,
+	0x35DEC3AB, 0x7B94447C, 0x2C2EFCDC, 0x62647B0B, 0x063EBD45, 0x48743A92, 0x1FCE8232, 0x518405E5,
+	0x18FAF516, 0x56B072C1, 0x010ACA61, 0x4F404DB6, 0x2B1A8BF8, 0x65500C2F, 0x32EAB48F, 0x7CA03358,
+	0x7F3A08CA, 0x31708F1D, 0x66CA37BD, 0x2880B06A, 0x4CDA7624, 0x0290F1F3, 0x552A4953, 0x1B60CE84,
+	0x63EBD45A, 0x2DA1538D, 0x7A1BEB2D, 0x34516CFA, 0x500BAAB4, 0x1E412D63, 0x49FB95C3, 0x07B11214,
+	0x042B2986, 0x4A61AE51, 0x1DDB16F1, 0x53919126, 0x37CB5768, 0x7981D0BF, 0x2E3B681F, 0x6071EFC8,
+	0x290F1F3B, 0x674598EC, 0x30FF204C, 0x7EB5A79B, 0x1AEF61D5, 0x54A5E602, 0x031F5EA2, 0x4D55D975,
+	0x4ECFE2E7, 0x00856530, 0x573FDD90, 0x19755A47, 0x7D2F9C09, 0x33651BDE, 0x64DFA37E, 0x2A9524A9,
+	0x73477241, 0x3D0DF596, 0x6AB74D36, 0x24FDCAE1, 0x40A70CAF, 0x0EED8B78, 0x595733D8, 0x171DB40F,
+	0x14878F9D, 0x5ACD084A, 0x0D77B0EA, 0x433D373D, 0x2767F173, 0x692D76A4, 0x3E97CE04, 0x70DD49D3,
+	0x39A3B920, 0x77E93EF7, 0x20538657, 0x6E190180, 0x0A43C7CE, 0x44094019, 0x13B3F8B9, 0x5DF97F6E,
+	0x5E6344FC, 0x1029C32B, 0x47937B8B, 0x09D9FC5C, 0x6D833A12, 0x23C9BDC5, 0x74730565, 0x3A3982B2,
+	// Seed 0x2A
+	0x00000000, 0x27489E0F, 0x4E913C1E, 0x69D9A211, 0x9D22783C, 0xBA6AE633, 0xD3B34422, 0xF4FBDA2D,
+	0x8D3363D5, 0xAA7BFDDA, 0xC3A25FCB, 0xE4EAC1C4, 0x10111BE9, 0x375985E6, 0x5E8027F7, 0x79C8B9F8,
+	0xAD115407, 0x8A59CA08, 0xE3806819, 0xC4C8F616, 0x30332C3B, 0x177BB234, 0x7EA21025, 0x59EA8E2A,
+	0x202237D2, 0x076AA9DD, 0x6EB30BCC, 0x49FB95C3, 0xBD004FEE, 0x9A48D1E1, 0xF39173F0, 0xD4D9EDFF,
+	0xED553BA3, 0xCA1DA5AC, 0xA3C407BD, 0x848C99B2, 0x7077439F, 0x573FDD90, 0x3EE67F81, 0x19AEE18E,
+	0x60665876, 0x472EC679, 0x2EF76468, 0x09BFFA67, 0xFD44204A, 0xDA0CBE45, 0xB3D51C54, 0x949D825B,
+	0x40446FA4, 0x670CF1AB, 0x0ED553BA, 0x299DCDB5, 0xDD661798, 0xFA2E8997, 0x93F72B86, 0xB4BFB589,
+	0xCD770C71, 0xEA3F927E, 0x83E6306F, 0xA4AEAE60, 0x5055744D, 0x771DEA42, 0x1EC44853, 0x398CD65C,
+	0x6DDDE4EB, 0x4A957AE4, 0x234CD8F5, 0x040446FA, 0xF0FF9CD7, 0xD7B702D8, 0xBE6EA0C9, 0x99263EC6,
+	0xE0EE873E, 0xC7A61931, 0xAE7FBB20, 0x8937252F, 0x7DCCFF02, 0x5A84610D, 0x335DC31C, 0x14155D13,
+	0xC0CCB0EC, 0xE7842EE3, 0x8E5D8CF2, 0xA91512FD, 0x5DEEC8D0, 0x7AA656DF, 0x137FF4CE, 0x34376AC1,
+	0x4DFFD339, 0x6AB74D36, 0x036EEF27, 0x24267128, 0xD0DDAB05, 0xF795350A, 0x9E4C971B, 0xB9040914,
+	0x8088DF48, 0xA7C04147, 0xCE19E356, 0xE9517D59, 0x1DAAA774, 0x3AE2397B, 0x533B9B6A, 0x74730565,
+	0x0DBBBC9D, 0x2AF32292, 0x432A8083, 0x64621E8C, 0x9099C4A1, 0xB7D15AAE, 0xDE08F8BF, 0xF94066B0,
+	0x2D998B4F, 0x0AD11540, 0x6308B751, 0x4440295E, 0xB0BBF373, 0x97F36D7C, 0xFE2ACF6D, 0xD9625162,
+	0xA0AAE89A, 0x87E27695, 0xEE3BD484, 0xC9734A8B, 0x3D8890A6, 0x1AC00EA9, 0x7319ACB8, 0x545132B7,
+	0xDBBBC9D6, 0xFCF357D9, 0x952AF5C8, 0xB2626BC7, 0x4699B1EA, 0x61D12FE5, 0x08088DF4, 0x2F4013FB,
+	0x5688AA03, 0x71C0340C, 0x1819961D, 0x3F510812, 0xCBAAD23F, 0xECE24C30, 0x853BEE21, 0xA273702E,
+	0x76AA9DD1, 0x51E203DE, 0x383BA1CF, 0x1F733FC0, 0xEB88E5ED, 0xCCC07BE2, 0xA519D9F3, 0x825147FC,
+	0xFB99FE04, 0xDCD1600B, 0xB508C21A, 0x92405C15, 0x66BB8638, 0x41F31837, 0x282ABA26, 0x0F622429,
+	0x36EEF275, 0x11A66C7A, 0x787FCE6B, 0x5F375064, 0xABCC8A49, 0x8C841446, 0xE55DB657, 0xC2152858,
+	0xBBDD91A0, 0x9C950FAF, 0xF54CADBE, 0xD20433B1, 0x26FFE99C, 0x01B77793, 0x686ED582, 0x4F264B8D,
+	0x9BFFA672, 0xBCB7387D, 0xD56E9A6C, 0xF2260463, 0x06DDDE4E, 0x21954041, 0x484CE250, 0x6F047C5F,
+	0x16CCC5A7, 0x31845BA8, 0x585DF9B9, 0x7F1567B6, 0x8BEEBD9B, 0xACA62394, 0xC57F8185, 0xE2371F8A,
+	0xB6662D3D, 0x912EB332, 0xF8F71123, 0xDFBF8F2C, 0x2B445501, 0x0C0CCB0E, 0x65D5691F, 0x429DF710,
+	0x3B554EE8, 0x1C1DD0E7, 0x75C472F6, 0x528CECF9, 0xA67736D4, 0x813FA8DB, 0xE8E60ACA, 0xCFAE94C5,
+	0x1B77793A, 0x3C3FE735, 0x55E64524, 0x72AEDB2B, 0x86550106, 0xA11D9F09, 0xC8C43D18, 0xEF8CA317,
+	0x96441AEF, 0xB10C84E0, 0xD8D526F1, 0xFF9DB8FE, 0x0B6662D3, 0x2C2EFCDC, 0x45F75ECD, 0x62BFC0C2,
+	0x5B33169E, 0x7C7B8891, 0x15A22A80, 0x32EAB48F, 0xC6116EA2, 0xE159F0AD, 0x888052BC, 0xAFC8CCB3,
+	0xD600754B, 0xF148EB44, 0x98914955, 0xBFD9D75A, 0x4B220D77, 0x6C6A9378, 0x05B33169, 0x22FBAF66,
+	0xF6224299, 0xD16ADC96, 0xB8B37E87, 0x9FFBE088, 0x6B003AA5, 0x4C48A4AA, 0x259106BB, 0x02D998B4,
+	0x7B11214C, 0x5C59BF43, 0x35801D52, 0x12C8835D, 0xE6335970, 0xC17BC77F, 0xA8A2656E, 0x8FEAFB61,
+	// Seed 0x2B
+	0x00000000, 0xADE580B2, 0x02B2F3E5, 0xAF577357, 0x0565E7CA, 0xA8806778, 0x07D7142F, 0xAA32949D,
+	0x0ACBCF94, 0xA72E4F26, 0x08793C71, 0xA59CBCC3, 0x0FAE285E, 0xA24BA8EC, 0x0D1CDBBB, 0xA0F95B09,
+	0x15979F28, 0xB8721F9A, 0x17256CCD, 0xBAC0EC7F, 0x10F278E2, 0xBD17F850, 0x12408B07, 0xBFA50BB5,
+	0x1F5C50BC, 0xB2B9D00E, 0x1DEEA359, 0xB00B23EB, 0x1A39B776, 0xB7DC37C4, 0x188B4493, 0xB56EC421,
+	0x2B2F3E50, 0x86CABEE2, 0x299DCDB5, 0x84784D07, 0x2E4AD99A, 0x83AF5928, 0x2CF82A7F, 0x811DAACD,
+	0x21E4F1C4, 0x8C017176, 0x23560221, 0x8EB38293, 0x2481160E, 0x896496BC, 0x2633E5EB, 0x8BD66559,
+	0x3EB8A178, 0x935D21CA, 0x3C0A529D, 0x91EFD22F, 0x3BDD46B2, 0x9638C600, 0x396FB557, 0x948A35E5,
+	0x34736EEC, 0x9996EE5E, 0x36C19D09, 0x9B241DBB, 0x31168926, 0x9CF30994, 0x33A47AC3, 0x9E41FA71,
+	0x565E7CA0, 0xFBBBFC12, 0x54EC8F45, 0xF9090FF7, 0x533B9B6A, 0xFEDE1BD8, 0x5189688F, 0xFC6CE83D,
+	0x5C95B334, 0xF1703386, 0x5E2740D1, 0xF3C2C063, 0x59F054FE, 0xF415D44C, 0x5B42A71B, 0xF6A727A9,
+	0x43C9E388, 0xEE2C633A, 0x417B106D, 0xEC9E90DF, 0x46AC0442, 0xEB4984F0, 0x441EF7A7, 0xE9FB7715,
+	0x49022C1C, 0xE4E7ACAE, 0x4BB0DFF9, 0xE6555F4B, 0x4C67CBD6, 0xE1824B64, 0x4ED53833, 0xE330B881,
+	0x7D7142F0, 0xD094C242, 0x7FC3B115, 0xD22631A7, 0x7814A53A, 0xD5F12588, 0x7AA656DF, 0xD743D66D,
+	0x77BA8D64, 0xDA5F0DD6, 0x75087E81, 0xD8EDFE33, 0x72DF6AAE, 0xDF3AEA1C, 0x706D994B, 0xDD8819F9,
+	0x68E6DDD8, 0xC5035D6A, 0x6A542E3D, 0xC7B1AE8F, 0x6D833A12, 0xC066BAA0, 0x6F31C9F7, 0xC2D44945,
+	0x622D124C, 0xCFC892FE, 0x609FE1A9, 0xCD7A611B, 0x6748F586, 0xCAAD7534, 0x65FA0663, 0xC81F86D1,
+	0xACBCF940, 0x015979F2, 0xAE0E0AA5, 0x03EB8A17, 0xA9D91E8A, 0x043C9E38, 0xAB6BED6F, 0x068E6DDD,
+	0xA67736D4, 0x0B92B666, 0xA4C5C531, 0x09204583, 0xA312D11E, 0x0EF751AC, 0xA1A022FB, 0x0C45A249,
+	0xB92B6668, 0x14CEE6DA, 0xBB99958D, 0x167C153F, 0xBC4E81A2, 0x11AB0110, 0xBEFC7247, 0x1319F2F5,
+	0xB3E0A9FC, 0x1E05294E, 0xB1525A19, 0x1CB7DAAB, 0xB6854E36, 0x1B60CE84, 0xB437BDD3, 0x19D23D61,
+	0x8793C710, 0x2A7647A2, 0x852134F5, 0x28C4B447, 0x82F620DA, 0x2F13A068, 0x8044D33F, 0x2DA1538D,
+	0x8D580884, 0x20BD8836, 0x8FEAFB61, 0x220F7BD3, 0x883DEF4E, 0x25D86FFC, 0x8A8F1CAB, 0x276A9C19,
+	0x92045838, 0x3FE1D88A, 0x90B6ABDD, 0x3D532B6F, 0x9761BFF2, 0x3A843F40, 0x95D34C17, 0x3836CCA5,
+	0x98CF97AC, 0x352A171E, 0x9A7D6449, 0x3798E4FB, 0x9DAA7066, 0x304FF0D4, 0x9F188383, 0x32FD0331,
+	0xFAE285E0, 0x57070552, 0xF8507605, 0x55B5F6B7, 0xFF87622A, 0x5262E298, 0xFD3591CF, 0x50D0117D,
+	0xF0294A74, 0x5DCCCAC6, 0xF29BB991, 0x5F7E3923, 0xF54CADBE, 0x58A92D0C, 0xF7FE5E5B, 0x5A1BDEE9,
+	0xEF751AC8, 0x42909A7A, 0xEDC7E92D, 0x4022699F, 0xEA10FD02, 0x47F57DB0, 0xE8A20EE7, 0x45478E55,
+	0xE5BED55C, 0x485B55EE, 0xE70C26B9, 0x4AE9A60B, 0xE0DB3296, 0x4D3EB224, 0xE269C173, 0x4F8C41C1,
+	0xD1CDBBB0, 0x7C283B02, 0xD37F4855, 0x7E9AC8E7, 0xD4A85C7A, 0x794DDCC8, 0xD61AAF9F, 0x7BFF2F2D,
+	0xDB067424, 0x76E3F496, 0xD9B487C1, 0x74510773, 0xDE6393EE, 0x7386135C, 0xDCD1600B, 0x7134E0B9,
+	0xC45A2498, 0x69BFA42A, 0xC6E8D77D, 0x6B0D57CF, 0xC13FC352, 0x6CDA43E0, 0xC38D30B7, 0x6E68B005,
+	0xCE91EB0C, 0x63746BBE, 0xCC2318E9, 0x61C6985B, 0xCBF40CC6, 0x66118C74, 0xC946FF23, 0x64A37F91,
+	// Seed 0x2C
+	0x00000000, 0x05D85A38, 0x0BB0B470, 0x0E68EE48, 0x176168E0, 0x12B932D8, 0x1CD1DC90, 0x190986A8,
+	0x2EC2D1C0, 0x2B1A8BF8, 0x257265B0, 0x20AA3F88, 0x39A3B920, 0x3C7BE318, 0x32130D50, 0x37CB5768,
+	0x38357A47, 0x3DED207F, 0x3385CE37, 0x365D940F, 0x2F5412A7, 0x2A8C489F, 0x24E4A6D7, 0x213CFCEF,
+	0x16F7AB87, 0x132FF1BF, 0x1D471FF7, 0x189F45CF, 0x0196C367, 0x044E995F, 0x0A267717, 0x0FFE2D2F,
+	0x15DA2D49, 0x10027771, 0x1E6A9939, 0x1BB2C301, 0x02BB45A9, 0x07631F91, 0x090BF1D9, 0x0CD3ABE1,
+	0x3B18FC89, 0x3EC0A6B1, 0x30A848F9, 0x357012C1, 0x2C799469, 0x29A1CE51, 0x27C92019, 0x22117A21,
+	0x2DEF570E, 0x28370D36, 0x265FE37E, 0x2387B946, 0x3A8E3FEE, 0x3F5665D6, 0x313E8B9E, 0x34E6D1A6,
+	0x032D86CE, 0x06F5DCF6, 0x089D32BE, 0x0D456886, 0x144CEE2E, 0x1194B416, 0x1FFC5A5E, 0x1A240066,
+	0x2BB45A92, 0x2E6C00AA, 0x2004EEE2, 0x25DCB4DA, 0x3CD53272, 0x390D684A, 0x37658602, 0x32BDDC3A,
+	0x05768B52, 0x00AED16A, 0x0EC63F22, 0x0B1E651A, 0x1217E3B2, 0x17CFB98A, 0x19A757C2, 0x1C7F0DFA,
+	0x138120D5, 0x16597AED, 0x183194A5, 0x1DE9CE9D, 0x04E04835, 0x0138120D, 0x0F50FC45, 0x0A88A67D,
+	0x3D43F115, 0x389BAB2D, 0x36F34565, 0x332B1F5D, 0x2A2299F5, 0x2FFAC3CD, 0x21922D85, 0x244A77BD,
+	0x3E6E77DB, 0x3BB62DE3, 0x35DEC3AB, 0x30069993, 0x290F1F3B, 0x2CD74503, 0x22BFAB4B, 0x2767F173,
+	0x10ACA61B, 0x1574FC23, 0x1B1C126B, 0x1EC44853, 0x07CDCEFB, 0x021594C3, 0x0C7D7A8B, 0x09A520B3,
+	0x065B0D9C, 0x038357A4, 0x0DEBB9EC, 0x0833E3D4, 0x113A657C, 0x14E23F44, 0x1A8AD10C, 0x1F528B34,
+	0x2899DC5C, 0x2D418664, 0x2329682C, 0x26F13214, 0x3FF8B4BC, 0x3A20EE84, 0x344800CC, 0x31905AF4,
+	0x32D86CE3, 0x370036DB, 0x3968D893, 0x3CB082AB, 0x25B90403, 0x20615E3B, 0x2E09B073, 0x2BD1EA4B,
+	0x1C1ABD23, 0x19C2E71B, 0x17AA0953, 0x1272536B, 0x0B7BD5C3, 0x0EA38FFB, 0x00CB61B3, 0x05133B8B,
+	0x0AED16A4, 0x0F354C9C, 0x015DA2D4, 0x0485F8EC, 0x1D8C7E44, 0x1854247C, 0x163CCA34, 0x13E4900C,
+	0x242FC764, 0x21F79D5C, 0x2F9F7314, 0x2A47292C, 0x334EAF84, 0x3696F5BC, 0x38FE1BF4, 0x3D2641CC,
+	0x270241AA, 0x22DA1B92, 0x2CB2F5DA, 0x296AAFE2, 0x3063294A, 0x35BB7372, 0x3BD39D3A, 0x3E0BC702,
+	0x09C0906A, 0x0C18CA52, 0x0270241A, 0x07A87E22, 0x1EA1F88A, 0x1B79A2B2, 0x15114CFA, 0x10C916C2,
+	0x1F373BED, 0x1AEF61D5, 0x14878F9D, 0x115FD5A5, 0x0856530D, 0x0D8E0935, 0x03E6E77D, 0x063EBD45,
+	0x31F5EA2D, 0x342DB015, 0x3A455E5D, 0x3F9D0465, 0x269482CD, 0x234CD8F5, 0x2D2436BD, 0x28FC6C85,
+	0x196C3671, 0x1CB46C49, 0x12DC8201, 0x1704D839, 0x0E0D5E91, 0x0BD504A9, 0x05BDEAE1, 0x0065B0D9,
+	0x37AEE7B1, 0x3276BD89, 0x3C1E53C1, 0x39C609F9, 0x20CF8F51, 0x2517D569, 0x2B7F3B21, 0x2EA76119,
+	0x21594C36, 0x2481160E, 0x2AE9F846, 0x2F31A27E, 0x363824D6, 0x33E07EEE, 0x3D8890A6, 0x3850CA9E,
+	0x0F9B9DF6, 0x0A43C7CE, 0x042B2986, 0x01F373BE, 0x18FAF516, 0x1D22AF2E, 0x134A4166, 0x16921B5E,
+	0x0CB61B38, 0x096E4100, 0x0706AF48, 0x02DEF570, 0x1BD773D8, 0x1E0F29E0, 0x1067C7A8, 0x15BF9D90,
+	0x2274CAF8, 0x27AC90C0, 0x29C47E88, 0x2C1C24B0, 0x3515A218, 0x30CDF820, 0x3EA51668, 0x3B7D4C50,
+	0x3483617F, 0x315B3B47, 0x3F33D50F, 0x3AEB8F37, 0x23E2099F, 0x263A53A7, 0x2852BDEF, 0x2D8AE7D7,
+	0x1A41B0BF, 0x1F99EA87, 0x11F104CF, 0x14295EF7, 0x0D20D85F, 0x08F88267, 0x06906C2F, 0x03483617,
+	// Seed 0x2D
+	0x00000000, 0x7D4EF7F6, 0x71235707, 0x0C6DA0F1, 0x69F816E5, 0x14B6E113, 0x18DB41E2, 0x6595B614,
+	0x584E9521, 0x250062D7, 0x296DC226, 0x542335D0, 0x31B683C4, 0x4CF87432, 0x4095D4C3, 0x3DDB2335,
+	0x3B2392A9, 0x466D655F, 0x4A00C5AE, 0x374E3258, 0x52DB844C, 0x2F9573BA, 0x23F8D34B, 0x5EB624BD,
+	0x636D0788, 0x1E23F07E, 0x124E508F, 0x6F00A779, 0x0A95116D, 0x77DBE69B, 0x7BB6466A, 0x06F8B19C,
+	0x76472552, 0x0B09D2A4, 0x07647255, 0x7A2A85A3, 0x1FBF33B7, 0x62F1C441, 0x6E9C64B0, 0x13D29346,
+	0x2E09B073, 0x53474785, 0x5F2AE774, 0x22641082, 0x47F1A696, 0x3ABF5160, 0x36D2F191, 0x4B9C0667,
+	0x4D64B7FB, 0x302A400D, 0x3C47E0FC, 0x4109170A, 0x249CA11E, 0x59D256E8, 0x55BFF619, 0x28F101EF,
+	0x152A22DA, 0x6864D52C, 0x640975DD, 0x1947822B, 0x7CD2343F, 0x019CC3C9, 0x0DF16338, 0x70BF94CE,
+	0x6730F24F, 0x1A7E05B9, 0x1613A548, 0x6B5D52BE, 0x0EC8E4AA, 0x7386135C, 0x7FEBB3AD, 0x02A5445B,
+	0x3F7E676E, 0x42309098, 0x4E5D3069, 0x3313C79F, 0x5686718B, 0x2BC8867D, 0x27A5268C, 0x5AEBD17A,
+	0x5C1360E6, 0x215D9710, 0x2D3037E1, 0x507EC017, 0x35EB7603, 0x48A581F5, 0x44C82104, 0x3986D6F2,
+	0x045DF5C7, 0x79130231, 0x757EA2C0, 0x08305536, 0x6DA5E322, 0x10EB14D4, 0x1C86B425, 0x61C843D3,
+	0x1177D71D, 0x6C3920EB, 0x6054801A, 0x1D1A77EC, 0x788FC1F8, 0x05C1360E, 0x09AC96FF, 0x74E26109,
+	0x4939423C, 0x3477B5CA, 0x381A153B, 0x4554E2CD, 0x20C154D9, 0x5D8FA32F, 0x51E203DE, 0x2CACF428,
+	0x2A5445B4, 0x571AB242, 0x5B7712B3, 0x2639E545, 0x43AC5351, 0x3EE2A4A7, 0x328F0456, 0x4FC1F3A0,
+	0x721AD095, 0x0F542763, 0x03398792, 0x7E777064, 0x1BE2C670, 0x66AC3186, 0x6AC19177, 0x178F6681,
+	0x45DF5C75, 0x3891AB83, 0x34FC0B72, 0x49B2FC84, 0x2C274A90, 0x5169BD66, 0x5D041D97, 0x204AEA61,
+	0x1D91C954, 0x60DF3EA2, 0x6CB29E53, 0x11FC69A5, 0x7469DFB1, 0x09272847, 0x054A88B6, 0x78047F40,
+	0x7EFCCEDC, 0x03B2392A, 0x0FDF99DB, 0x72916E2D, 0x1704D839, 0x6A4A2FCF, 0x66278F3E, 0x1B6978C8,
+	0x26B25BFD, 0x5BFCAC0B, 0x57910CFA, 0x2ADFFB0C, 0x4F4A4D18, 0x3204BAEE, 0x3E691A1F, 0x4327EDE9,
+	0x33987927, 0x4ED68ED1, 0x42BB2E20, 0x3FF5D9D6, 0x5A606FC2, 0x272E9834, 0x2B4338C5, 0x560DCF33,
+	0x6BD6EC06, 0x16981BF0, 0x1AF5BB01, 0x67BB4CF7, 0x022EFAE3, 0x7F600D15, 0x730DADE4, 0x0E435A12,
+	0x08BBEB8E, 0x75F51C78, 0x7998BC89, 0x04D64B7F, 0x6143FD6B, 0x1C0D0A9D, 0x1060AA6C, 0x6D2E5D9A,
+	0x50F57EAF, 0x2DBB8959, 0x21D629A8, 0x5C98DE5E, 0x390D684A, 0x44439FBC, 0x482E3F4D, 0x3560C8BB,
+	0x22EFAE3A, 0x5FA159CC, 0x53CCF93D, 0x2E820ECB, 0x4B17B8DF, 0x36594F29, 0x3A34EFD8, 0x477A182E,
+	0x7AA13B1B, 0x07EFCCED, 0x0B826C1C, 0x76CC9BEA, 0x13592DFE, 0x6E17DA08, 0x627A7AF9, 0x1F348D0F,
+	0x19CC3C93, 0x6482CB65, 0x68EF6B94, 0x15A19C62, 0x70342A76, 0x0D7ADD80, 0x01177D71, 0x7C598A87,
+	0x4182A9B2, 0x3CCC5E44, 0x30A1FEB5, 0x4DEF0943, 0x287ABF57, 0x553448A1, 0x5959E850, 0x24171FA6,
+	0x54A88B68, 0x29E67C9E, 0x258BDC6F, 0x58C52B99, 0x3D509D8D, 0x401E6A7B, 0x4C73CA8A, 0x313D3D7C,
+	0x0CE61E49, 0x71A8E9BF, 0x7DC5494E, 0x008BBEB8, 0x651E08AC, 0x1850FF5A, 0x143D5FAB, 0x6973A85D,
+	0x6F8B19C1, 0x12C5EE37, 0x1EA84EC6, 0x63E6B930, 0x06730F24, 0x7B3DF8D2, 0x77505823, 0x0A1EAFD5,
+	0x37C58CE0, 0x4A8B7B16, 0x46E6DBE7, 0x3BA82C11, 0x5E3D9A05, 0x23736DF3, 0x2F1ECD02, 0x52503AF4,
+	// Seed 0x2E
+	0x00000000, 0x87427C77, 0xB728E371, 0x306A9F06, 0xD7FDDD7D, 0x50BFA10A, 0x60D53E0C, 0xE797427B,
+	0x1657A165, 0x9115DD12, 0xA17F4214, 0x263D3E63, 0xC1AA7C18, 0x46E8006F, 0x76829F69, 0xF1C0E31E,
+	0x2CAF42CA, 0xABED3EBD, 0x9B87A1BB, 0x1CC5DDCC, 0xFB529FB7, 0x7C10E3C0, 0x4C7A7CC6, 0xCB3800B1,
+	0x3AF8E3AF, 0xBDBA9FD8, 0x8DD000DE, 0x0A927CA9, 0xED053ED2, 0x6A4742A5, 0x5A2DDDA3, 0xDD6FA1D4,
+	0x595E8594, 0xDE1CF9E3, 0xEE7666E5, 0x69341A92, 0x8EA358E9, 0x09E1249E, 0x398BBB98, 0xBEC9C7EF,
+	0x4F0924F1, 0xC84B5886, 0xF821C780, 0x7F63BBF7, 0x98F4F98C, 0x1FB685FB, 0x2FDC1AFD, 0xA89E668A,
+	0x75F1C75E, 0xF2B3BB29, 0xC2D9242F, 0x459B5858, 0xA20C1A23, 0x254E6654, 0x1524F952, 0x92668525,
+	0x63A6663B, 0xE4E41A4C, 0xD48E854A, 0x53CCF93D, 0xB45BBB46, 0x3319C731, 0x03735837, 0x84312440,
+	0xB2BD0B28, 0x35FF775F, 0x0595E859, 0x82D7942E, 0x6540D655, 0xE202AA22, 0xD2683524, 0x552A4953,
+	0xA4EAAA4D, 0x23A8D63A, 0x13C2493C, 0x9480354B, 0x73177730, 0xF4550B47, 0xC43F9441, 0x437DE836,
+	0x9E1249E2, 0x19503595, 0x293AAA93, 0xAE78D6E4, 0x49EF949F, 0xCEADE8E8, 0xFEC777EE, 0x79850B99,
+	0x8845E887, 0x0F0794F0, 0x3F6D0BF6, 0xB82F7781, 0x5FB835FA, 0xD8FA498D, 0xE890D68B, 0x6FD2AAFC,
+	0xEBE38EBC, 0x6CA1F2CB, 0x5CCB6DCD, 0xDB8911BA, 0x3C1E53C1, 0xBB5C2FB6, 0x8B36B0B0, 0x0C74CCC7,
+	0xFDB42FD9, 0x7AF653AE, 0x4A9CCCA8, 0xCDDEB0DF, 0x2A49F2A4, 0xAD0B8ED3, 0x9D6111D5, 0x1A236DA2,
+	0xC74CCC76, 0x400EB001, 0x70642F07, 0xF7265370, 0x10B1110B, 0x97F36D7C, 0xA799F27A, 0x20DB8E0D,
+	0xD11B6D13, 0x56591164, 0x66338E62, 0xE171F215, 0x06E6B06E, 0x81A4CC19, 0xB1CE531F, 0x368C2F68,
+	0xDCD60DCF, 0x5B9471B8, 0x6BFEEEBE, 0xECBC92C9, 0x0B2BD0B2, 0x8C69ACC5, 0xBC0333C3, 0x3B414FB4,
+	0xCA81ACAA, 0x4DC3D0DD, 0x7DA94FDB, 0xFAEB33AC, 0x1D7C71D7, 0x9A3E0DA0, 0xAA5492A6, 0x2D16EED1,
+	0xF0794F05, 0x773B3372, 0x4751AC74, 0xC013D003, 0x27849278, 0xA0C6EE0F, 0x90AC7109, 0x17EE0D7E,
+	0xE62EEE60, 0x616C9217, 0x51060D11, 0xD6447166, 0x31D3331D, 0xB6914F6A, 0x86FBD06C, 0x01B9AC1B,
+	0x8588885B, 0x02CAF42C, 0x32A06B2A, 0xB5E2175D, 0x52755526, 0xD5372951, 0xE55DB657, 0x621FCA20,
+	0x93DF293E, 0x149D5549, 0x24F7CA4F, 0xA3B5B638, 0x4422F443, 0xC3608834, 0xF30A1732, 0x74486B45,
+	0xA927CA91, 0x2E65B6E6, 0x1E0F29E0, 0x994D5597, 0x7EDA17EC, 0xF9986B9B, 0xC9F2F49D, 0x4EB088EA,
+	0xBF706BF4, 0x38321783, 0x08588885, 0x8F1AF4F2, 0x688DB689, 0xEFCFCAFE, 0xDFA555F8, 0x58E7298F,
+	0x6E6B06E7, 0xE9297A90, 0xD943E596, 0x5E0199E1, 0xB996DB9A, 0x3ED4A7ED, 0x0EBE38EB, 0x89FC449C,
+	0x783CA782, 0xFF7EDBF5, 0xCF1444F3, 0x48563884, 0xAFC17AFF, 0x28830688, 0x18E9998E, 0x9FABE5F9,
+	0x42C4442D, 0xC586385A, 0xF5ECA75C, 0x72AEDB2B, 0x95399950, 0x127BE527, 0x22117A21, 0xA5530656,
+	0x5493E548, 0xD3D1993F, 0xE3BB0639, 0x64F97A4E, 0x836E3835, 0x042C4442, 0x3446DB44, 0xB304A733,
+	0x37358373, 0xB077FF04, 0x801D6002, 0x075F1C75, 0xE0C85E0E, 0x678A2279, 0x57E0BD7F, 0xD0A2C108,
+	0x21622216, 0xA6205E61, 0x964AC167, 0x1108BD10, 0xF69FFF6B, 0x71DD831C, 0x41B71C1A, 0xC6F5606D,
+	0x1B9AC1B9, 0x9CD8BDCE, 0xACB222C8, 0x2BF05EBF, 0xCC671CC4, 0x4B2560B3, 0x7B4FFFB5, 0xFC0D83C2,
+	0x0DCD60DC, 0x8A8F1CAB, 0xBAE583AD, 0x3DA7FFDA, 0xDA30BDA1, 0x5D72C1D6, 0x6D185ED0, 0xEA5A22A7,
+	// Seed 0x2F
+	0x00000000, 0xA7CA41E9, 0x1836F961, 0xBFFCB888, 0x306DF2C2, 0x97A7B32B, 0x285B0BA3, 0x8F914A4A,
+	0x60DBE584, 0xC711A46D, 0x78ED1CE5, 0xDF275D0C, 0x50B61746, 0xF77C56AF, 0x4880EE27, 0xEF4AAFCE,
+	0xC1B7CB08, 0x667D8AE1, 0xD9813269, 0x7E4B7380, 0xF1DA39CA, 0x56107823, 0xE9ECC0AB, 0x4E268142,
+	0xA16C2E8C, 0x06A66F65, 0xB95AD7ED, 0x1E909604, 0x9101DC4E, 0x36CB9DA7, 0x8937252F, 0x2EFD64C6,
+	0xD4CDECA3, 0x7307AD4A, 0xCCFB15C2, 0x6B31542B, 0xE4A01E61, 0x436A5F88, 0xFC96E700, 0x5B5CA6E9,
+	0xB4160927, 0x13DC48CE, 0xAC20F046, 0x0BEAB1AF, 0x847BFBE5, 0x23B1BA0C, 0x9C4D0284, 0x3B87436D,
+	0x157A27AB, 0xB2B06642, 0x0D4CDECA, 0xAA869F23, 0x2517D569, 0x82DD9480, 0x3D212C08, 0x9AEB6DE1,
+	0x75A1C22F, 0xD26B83C6, 0x6D973B4E, 0xCA5D7AA7, 0x45CC30ED, 0xE2067104, 0x5DFAC98C, 0xFA308865,
+	0xFE39A3F5, 0x59F3E21C, 0xE60F5A94, 0x41C51B7D, 0xCE545137, 0x699E10DE, 0xD662A856, 0x71A8E9BF,
+	0x9EE24671, 0x39280798, 0x86D4BF10, 0x211EFEF9, 0xAE8FB4B3, 0x0945F55A, 0xB6B94DD2, 0x11730C3B,
+	0x3F8E68FD, 0x98442914, 0x27B8919C, 0x8072D075, 0x0FE39A3F, 0xA829DBD6, 0x17D5635E, 0xB01F22B7,
+	0x5F558D79, 0xF89FCC90, 0x47637418, 0xE0A935F1, 0x6F387FBB, 0xC8F23E52, 0x770E86DA, 0xD0C4C733,
+	0x2AF44F56, 0x8D3E0EBF, 0x32C2B637, 0x9508F7DE, 0x1A99BD94, 0xBD53FC7D, 0x02AF44F5, 0xA565051C,
+	0x4A2FAAD2, 0xEDE5EB3B, 0x521953B3, 0xF5D3125A, 0x7A425810, 0xDD8819F9, 0x6274A171, 0xC5BEE098,
+	0xEB43845E, 0x4C89C5B7, 0xF3757D3F, 0x54BF3CD6, 0xDB2E769C, 0x7CE43775, 0xC3188FFD, 0x64D2CE14,
+	0x8B9861DA, 0x2C522033, 0x93AE98BB, 0x3464D952, 0xBBF59318, 0x1C3FD2F1, 0xA3C36A79, 0x04092B90,
+	0xABD13D59, 0x0C1B7CB0, 0xB3E7C438, 0x142D85D1, 0x9BBCCF9B, 0x3C768E72, 0x838A36FA, 0x24407713,
+	0xCB0AD8DD, 0x6CC09934, 0xD33C21BC, 0x74F66055, 0xFB672A1F, 0x5CAD6BF6, 0xE351D37E, 0x449B9297,
+	0x6A66F651, 0xCDACB7B8, 0x72500F30, 0xD59A4ED9, 0x5A0B0493, 0xFDC1457A, 0x423DFDF2, 0xE5F7BC1B,
+	0x0ABD13D5, 0xAD77523C, 0x128BEAB4, 0xB541AB5D, 0x3AD0E117, 0x9D1AA0FE, 0x22E61876, 0x852C599F,
+	0x7F1CD1FA, 0xD8D69013, 0x672A289B, 0xC0E06972, 0x4F712338, 0xE8BB62D1, 0x5747DA59, 0xF08D9BB0,
+	0x1FC7347E, 0xB80D7597, 0x07F1CD1F, 0xA03B8CF6, 0x2FAAC6BC, 0x88608755, 0x379C3FDD, 0x90567E34,
+	0xBEAB1AF2, 0x19615B1B, 0xA69DE393, 0x0157A27A, 0x8EC6E830, 0x290CA9D9, 0x96F01151, 0x313A50B8,
+	0xDE70FF76, 0x79BABE9F, 0xC6460617, 0x618C47FE, 0xEE1D0DB4, 0x49D74C5D, 0xF62BF4D5, 0x51E1B53C,
+	0x55E89EAC, 0xF222DF45, 0x4DDE67CD, 0xEA142624, 0x65856C6E, 0xC24F2D87, 0x7DB3950F, 0xDA79D4E6,
+	0x35337B28, 0x92F93AC1, 0x2D058249, 0x8ACFC3A0, 0x055E89EA, 0xA294C803, 0x1D68708B, 0xBAA23162,
+	0x945F55A4, 0x3395144D, 0x8C69ACC5, 0x2BA3ED2C, 0xA432A766, 0x03F8E68F, 0xBC045E07, 0x1BCE1FEE,
+	0xF484B020, 0x534EF1C9, 0xECB24941, 0x4B7808A8, 0xC4E942E2, 0x6323030B, 0xDCDFBB83, 0x7B15FA6A,
+	0x8125720F, 0x26EF33E6, 0x99138B6E, 0x3ED9CA87, 0xB14880CD, 0x1682C124, 0xA97E79AC, 0x0EB43845,
+	0xE1FE978B, 0x4634D662, 0xF9C86EEA, 0x5E022F03, 0xD1936549, 0x765924A0, 0xC9A59C28, 0x6E6FDDC1,
+	0x4092B907, 0xE758F8EE, 0x58A44066, 0xFF6E018F, 0x70FF4BC5, 0xD7350A2C, 0x68C9B2A4, 0xCF03F34D,
+	0x20495C83, 0x87831D6A, 0x387FA5E2, 0x9FB5E40B, 0x1024AE41, 0xB7EEEFA8, 0x08125720, 0xAFD816C9,
+	// Seed 0x30
+	0x00000000, 0x06FB077E, 0x0DF60EFC, 0x0B0D0982, 0x1BEC1DF8, 0x1D171A86, 0x161A1304, 0x10E1147A,
+	0x37D83BF0, 0x31233C8E, 0x3A2E350C, 0x3CD53272, 0x2C342608, 0x2ACF2176, 0x21C228F4, 0x27392F8A,
+	0x220216B9, 0x24F911C7, 0x2FF41845, 0x290F1F3B, 0x39EE0B41, 0x3F150C3F, 0x341805BD, 0x32E302C3,
+	0x15DA2D49, 0x13212A37, 0x182C23B5, 0x1ED724CB, 0x0E3630B1, 0x08CD37CF, 0x03C03E4D, 0x053B3933,
+	0x09B64C2B, 0x0F4D4B55, 0x044042D7, 0x02BB45A9, 0x125A51D3, 0x14A156AD, 0x1FAC5F2F, 0x19575851,
+	0x3E6E77DB, 0x389570A5, 0x33987927, 0x35637E59, 0x25826A23, 0x23796D5D, 0x287464DF, 0x2E8F63A1,
+	0x2BB45A92, 0x2D4F5DEC, 0x2642546E, 0x20B95310, 0x3058476A, 0x36A34014, 0x3DAE4996, 0x3B554EE8,
+	0x1C6C6162, 0x1A97661C, 0x119A6F9E, 0x176168E0, 0x07807C9A, 0x017B7BE4, 0x0A767266, 0x0C8D7518,
+	0x136C9856, 0x15979F28, 0x1E9A96AA, 0x186191D4, 0x088085AE, 0x0E7B82D0, 0x05768B52, 0x038D8C2C,
+	0x24B4A3A6, 0x224FA4D8, 0x2942AD5A, 0x2FB9AA24, 0x3F58BE5E, 0x39A3B920, 0x32AEB0A2, 0x3455B7DC,
+	0x316E8EEF, 0x37958991, 0x3C988013, 0x3A63876D, 0x2A829317, 0x2C799469, 0x27749DEB, 0x218F9A95,
+	0x06B6B51F, 0x004DB261, 0x0B40BBE3, 0x0DBBBC9D, 0x1D5AA8E7, 0x1BA1AF99, 0x10ACA61B, 0x1657A165,
+	0x1ADAD47D, 0x1C21D303, 0x172CDA81, 0x11D7DDFF, 0x0136C985, 0x07CDCEFB, 0x0CC0C779, 0x0A3BC007,
+	0x2D02EF8D, 0x2BF9E8F3, 0x20F4E171, 0x260FE60F, 0x36EEF275, 0x3015F50B, 0x3B18FC89, 0x3DE3FBF7,
+	0x38D8C2C4, 0x3E23C5BA, 0x352ECC38, 0x33D5CB46, 0x2334DF3C, 0x25CFD842, 0x2EC2D1C0, 0x2839D6BE,
+	0x0F00F934, 0x09FBFE4A, 0x02F6F7C8, 0x040DF0B6, 0x14ECE4CC, 0x1217E3B2, 0x191AEA30, 0x1FE1ED4E,
+	0x26D930AC, 0x202237D2, 0x2B2F3E50, 0x2DD4392E, 0x3D352D54, 0x3BCE2A2A, 0x30C323A8, 0x363824D6,
+	0x11010B5C, 0x17FA0C22, 0x1CF705A0, 0x1A0C02DE, 0x0AED16A4, 0x0C1611DA, 0x071B1858, 0x01E01F26,
+	0x04DB2615, 0x0220216B, 0x092D28E9, 0x0FD62F97, 0x1F373BED, 0x19CC3C93, 0x12C13511, 0x143A326F,
+	0x33031DE5, 0x35F81A9B, 0x3EF51319, 0x380E1467, 0x28EF001D, 0x2E140763, 0x25190EE1, 0x23E2099F,
+	0x2F6F7C87, 0x29947BF9, 0x2299727B, 0x24627505, 0x3483617F, 0x32786601, 0x39756F83, 0x3F8E68FD,
+	0x18B74777, 0x1E4C4009, 0x1541498B, 0x13BA4EF5, 0x035B5A8F, 0x05A05DF1, 0x0EAD5473, 0x0856530D,
+	0x0D6D6A3E, 0x0B966D40, 0x009B64C2, 0x066063BC, 0x168177C6, 0x107A70B8, 0x1B77793A, 0x1D8C7E44,
+	0x3AB551CE, 0x3C4E56B0, 0x37435F32, 0x31B8584C, 0x21594C36, 0x27A24B48, 0x2CAF42CA, 0x2A5445B4,
+	0x35B5A8FA, 0x334EAF84, 0x3843A606, 0x3EB8A178, 0x2E59B502, 0x28A2B27C, 0x23AFBBFE, 0x2554BC80,
+	0x026D930A, 0x04969474, 0x0F9B9DF6, 0x09609A88, 0x19818EF2, 0x1F7A898C, 0x1477800E, 0x128C8770,
+	0x17B7BE43, 0x114CB93D, 0x1A41B0BF, 0x1CBAB7C1, 0x0C5BA3BB, 0x0AA0A4C5, 0x01ADAD47, 0x0756AA39,
+	0x206F85B3, 0x269482CD, 0x2D998B4F, 0x2B628C31, 0x3B83984B, 0x3D789F35, 0x367596B7, 0x308E91C9,
+	0x3C03E4D1, 0x3AF8E3AF, 0x31F5EA2D, 0x370EED53, 0x27EFF929, 0x2114FE57, 0x2A19F7D5, 0x2CE2F0AB,
+	0x0BDBDF21, 0x0D20D85F, 0x062DD1DD, 0x00D6D6A3, 0x1037C2D9, 0x16CCC5A7, 0x1DC1CC25, 0x1B3ACB5B,
+	0x1E01F268, 0x18FAF516, 0x13F7FC94, 0x150CFBEA, 0x05EDEF90, 0x0316E8EE, 0x081BE16C, 0x0EE0E612,
+	0x29D9C998, 0x2F22CEE6, 0x242FC764, 0x22D4C01A, 0x3235D460, 0x34CED31E, 0x3FC3DA9C, 0x3938DDE2,
+	// Seed 0x31
+	0x00000000, 0x165ACC0F, 0x2CB5981E, 0x3AEF5411, 0x596B303C, 0x4F31FC33, 0x75DEA822, 0x6384642D,
+	0x116A600D, 0x0730AC02, 0x3DDFF813, 0x2B85341C, 0x48015031, 0x5E5B9C3E, 0x64B4C82F, 0x72EE0420,
+	0x22D4C01A, 0x348E0C15, 0x0E615804, 0x183B940B, 0x7BBFF026, 0x6DE53C29, 0x570A6838, 0x4150A437,
+	0x33BEA017, 0x25E46C18, 0x1F0B3809, 0x0951F406, 0x6AD5902B, 0x7C8F5C24, 0x46600835, 0x503AC43A,
+	0x45A98034, 0x53F34C3B, 0x691C182A, 0x7F46D425, 0x1CC2B008, 0x0A987C07, 0x30772816, 0x262DE419,
+	0x54C3E039, 0x42992C36, 0x78767827, 0x6E2CB428, 0x0DA8D005, 0x1BF21C0A, 0x211D481B, 0x37478414,
+	0x677D402E, 0x71278C21, 0x4BC8D830, 0x5D92143F, 0x3E167012, 0x284CBC1D, 0x12A3E80C, 0x04F92403,
+	0x76172023, 0x604DEC2C, 0x5AA2B83D, 0x4CF87432, 0x2F7C101F, 0x3926DC10, 0x03C98801, 0x1593440E,
+	0x28EF001D, 0x3EB5CC12, 0x045A9803, 0x1200540C, 0x71843021, 0x67DEFC2E, 0x5D31A83F, 0x4B6B6430,
+	0x39856010, 0x2FDFAC1F, 0x1530F80E, 0x036A3401, 0x60EE502C, 0x76B49C23, 0x4C5BC832, 0x5A01043D,
+	0x0A3BC007, 0x1C610C08, 0x268E5819, 0x30D49416, 0x5350F03B, 0x450A3C34, 0x7FE56825, 0x69BFA42A,
+	0x1B51A00A, 0x0D0B6C05, 0x37E43814, 0x21BEF41B, 0x423A9036, 0x54605C39, 0x6E8F0828, 0x78D5C427,
+	0x6D468029, 0x7B1C4C26, 0x41F31837, 0x57A9D438, 0x342DB015, 0x22777C1A, 0x1898280B, 0x0EC2E404,
+	0x7C2CE024, 0x6A762C2B, 0x5099783A, 0x46C3B435, 0x2547D018, 0x331D1C17, 0x09F24806, 0x1FA88409,
+	0x4F924033, 0x59C88C3C, 0x6327D82D, 0x757D1422, 0x16F9700F, 0x00A3BC00, 0x3A4CE811, 0x2C16241E,
+	0x5EF8203E, 0x48A2EC31, 0x724DB820, 0x6417742F, 0x07931002, 0x11C9DC0D, 0x2B26881C, 0x3D7C4413,
+	0x51DE003A, 0x4784CC35, 0x7D6B9824, 0x6B31542B, 0x08B53006, 0x1EEFFC09, 0x2400A818, 0x325A6417,
+	0x40B46037, 0x56EEAC38, 0x6C01F829, 0x7A5B3426, 0x19DF500B, 0x0F859C04, 0x356AC815, 0x2330041A,
+	0x730AC020, 0x65500C2F, 0x5FBF583E, 0x49E59431, 0x2A61F01C, 0x3C3B3C13, 0x06D46802, 0x108EA40D,
+	0x6260A02D, 0x743A6C22, 0x4ED53833, 0x588FF43C, 0x3B0B9011, 0x2D515C1E, 0x17BE080F, 0x01E4C400,
+	0x1477800E, 0x022D4C01, 0x38C21810, 0x2E98D41F, 0x4D1CB032, 0x5B467C3D, 0x61A9282C, 0x77F3E423,
+	0x051DE003, 0x13472C0C, 0x29A8781D, 0x3FF2B412, 0x5C76D03F, 0x4A2C1C30, 0x70C34821, 0x6699842E,
+	0x36A34014, 0x20F98C1B, 0x1A16D80A, 0x0C4C1405, 0x6FC87028, 0x7992BC27, 0x437DE836, 0x55272439,
+	0x27C92019, 0x3193EC16, 0x0B7CB807, 0x1D267408, 0x7EA21025, 0x68F8DC2A, 0x5217883B, 0x444D4434,
+	0x79310027, 0x6F6BCC28, 0x55849839, 0x43DE5436, 0x205A301B, 0x3600FC14, 0x0CEFA805, 0x1AB5640A,
+	0x685B602A, 0x7E01AC25, 0x44EEF834, 0x52B4343B, 0x31305016, 0x276A9C19, 0x1D85C808, 0x0BDF0407,
+	0x5BE5C03D, 0x4DBF0C32, 0x77505823, 0x610A942C, 0x028EF001, 0x14D43C0E, 0x2E3B681F, 0x3861A410,
+	0x4A8FA030, 0x5CD56C3F, 0x663A382E, 0x7060F421, 0x13E4900C, 0x05BE5C03, 0x3F510812, 0x290BC41D,
+	0x3C988013, 0x2AC24C1C, 0x102D180D, 0x0677D402, 0x65F3B02F, 0x73A97C20, 0x49462831, 0x5F1CE43E,
+	0x2DF2E01E, 0x3BA82C11, 0x01477800, 0x171DB40F, 0x7499D022, 0x62C31C2D, 0x582C483C, 0x4E768433,
+	0x1E4C4009, 0x08168C06, 0x32F9D817, 0x24A31418, 0x47277035, 0x517DBC3A, 0x6B92E82B, 0x7DC82424,
+	0x0F262004, 0x197CEC0B, 0x2393B81A, 0x35C97415, 0x564D1038, 0x4017DC37, 0x7AF88826, 0x6CA24429,
+	// Seed 0x32
+	0x00000000, 0x0191AEA3, 0x03235D46, 0x02B2F3E5, 0x0646BA8C, 0x07D7142F, 0x0565E7CA, 0x04F44969,
+	0x0C8D7518, 0x0D1CDBBB, 0x0FAE285E, 0x0E3F86FD, 0x0ACBCF94, 0x0B5A6137, 0x09E892D2, 0x08793C71,
+	0x191AEA30, 0x188B4493, 0x1A39B776, 0x1BA819D5, 0x1F5C50BC, 0x1ECDFE1F, 0x1C7F0DFA, 0x1DEEA359,
+	0x15979F28, 0x1406318B, 0x16B4C26E, 0x17256CCD, 0x13D125A4, 0x12408B07, 0x10F278E2, 0x1163D641,
+	0x3235D460, 0x33A47AC3, 0x31168926, 0x30872785, 0x34736EEC, 0x35E2C04F, 0x375033AA, 0x36C19D09,
+	0x3EB8A178, 0x3F290FDB, 0x3D9BFC3E, 0x3C0A529D, 0x38FE1BF4, 0x396FB557, 0x3BDD46B2, 0x3A4CE811,
+	0x2B2F3E50, 0x2ABE90F3, 0x280C6316, 0x299DCDB5, 0x2D6984DC, 0x2CF82A7F, 0x2E4AD99A, 0x2FDB7739,
+	0x27A24B48, 0x2633E5EB, 0x2481160E, 0x2510B8AD, 0x21E4F1C4, 0x20755F67, 0x22C7AC82, 0x23560221,
+	0x646BA8C0, 0x65FA0663, 0x6748F586, 0x66D95B25, 0x622D124C, 0x63BCBCEF, 0x610E4F0A, 0x609FE1A9,
+	0x68E6DDD8, 0x6977737B, 0x6BC5809E, 0x6A542E3D, 0x6EA06754, 0x6F31C9F7, 0x6D833A12, 0x6C1294B1,
+	0x7D7142F0, 0x7CE0EC53, 0x7E521FB6, 0x7FC3B115, 0x7B37F87C, 0x7AA656DF, 0x7814A53A, 0x79850B99,
+	0x71FC37E8, 0x706D994B, 0x72DF6AAE, 0x734EC40D, 0x77BA8D64, 0x762B23C7, 0x7499D022, 0x75087E81,
+	0x565E7CA0, 0x57CFD203, 0x557D21E6, 0x54EC8F45, 0x5018C62C, 0x5189688F, 0x533B9B6A, 0x52AA35C9,
+	0x5AD309B8, 0x5B42A71B, 0x59F054FE, 0x5861FA5D, 0x5C95B334, 0x5D041D97, 0x5FB6EE72, 0x5E2740D1,
+	0x4F449690, 0x4ED53833, 0x4C67CBD6, 0x4DF66575, 0x49022C1C, 0x489382BF, 0x4A21715A, 0x4BB0DFF9,
+	0x43C9E388, 0x42584D2B, 0x40EABECE, 0x417B106D, 0x458F5904, 0x441EF7A7, 0x46AC0442, 0x473DAAE1,
+	0xC8D75180, 0xC946FF23, 0xCBF40CC6, 0xCA65A265, 0xCE91EB0C, 0xCF0045AF, 0xCDB2B64A, 0xCC2318E9,
+	0xC45A2498, 0xC5CB8A3B, 0xC77979DE, 0xC6E8D77D, 0xC21C9E14, 0xC38D30B7, 0xC13FC352, 0xC0AE6DF1,
+	0xD1CDBBB0, 0xD05C1513, 0xD2EEE6F6, 0xD37F4855, 0xD78B013C, 0xD61AAF9F, 0xD4A85C7A, 0xD539F2D9,
+	0xDD40CEA8, 0xDCD1600B, 0xDE6393EE, 0xDFF23D4D, 0xDB067424, 0xDA97DA87, 0xD8252962, 0xD9B487C1,
+	0xFAE285E0, 0xFB732B43, 0xF9C1D8A6, 0xF8507605, 0xFCA43F6C, 0xFD3591CF, 0xFF87622A, 0xFE16CC89,
+	0xF66FF0F8, 0xF7FE5E5B, 0xF54CADBE, 0xF4DD031D, 0xF0294A74, 0xF1B8E4D7, 0xF30A1732, 0xF29BB991,
+	0xE3F86FD0, 0xE269C173, 0xE0DB3296, 0xE14A9C35, 0xE5BED55C, 0xE42F7BFF, 0xE69D881A, 0xE70C26B9,
+	0xEF751AC8, 0xEEE4B46B, 0xEC56478E, 0xEDC7E92D, 0xE933A044, 0xE8A20EE7, 0xEA10FD02, 0xEB8153A1,
+	0xACBCF940, 0xAD2D57E3, 0xAF9FA406, 0xAE0E0AA5, 0xAAFA43CC, 0xAB6BED6F, 0xA9D91E8A, 0xA848B029,
+	0xA0318C58, 0xA1A022FB, 0xA312D11E, 0xA2837FBD, 0xA67736D4, 0xA7E69877, 0xA5546B92, 0xA4C5C531,
+	0xB5A61370, 0xB437BDD3, 0xB6854E36, 0xB714E095, 0xB3E0A9FC, 0xB271075F, 0xB0C3F4BA, 0xB1525A19,
+	0xB92B6668, 0xB8BAC8CB, 0xBA083B2E, 0xBB99958D, 0xBF6DDCE4, 0xBEFC7247, 0xBC4E81A2, 0xBDDF2F01,
+	0x9E892D20, 0x9F188383, 0x9DAA7066, 0x9C3BDEC5, 0x98CF97AC, 0x995E390F, 0x9BECCAEA, 0x9A7D6449,
+	0x92045838, 0x9395F69B, 0x9127057E, 0x90B6ABDD, 0x9442E2B4, 0x95D34C17, 0x9761BFF2, 0x96F01151,
+	0x8793C710, 0x860269B3, 0x84B09A56, 0x852134F5, 0x81D57D9C, 0x8044D33F, 0x82F620DA, 0x83678E79,
+	0x8B1EB208, 0x8A8F1CAB, 0x883DEF4E, 0x89AC41ED, 0x8D580884, 0x8CC9A627, 0x8E7B55C2, 0x8FEAFB61,
+	// Seed 0x33
+	0x00000000, 0x88A250AA, 0x6EE46379, 0xE64633D3, 0xDDC8C6F2, 0x556A9658, 0xB32CA58B, 0x3B8EF521,
+	0xC4314FC9, 0x4C931F63, 0xAAD52CB0, 0x22777C1A, 0x19F9893B, 0x915BD991, 0x771DEA42, 0xFFBFBAE8,
+	0xF7C25DBF, 0x7F600D15, 0x99263EC6, 0x11846E6C, 0x2A0A9B4D, 0xA2A8CBE7, 0x44EEF834, 0xCC4CA89E,
+	0x33F31276, 0xBB5142DC, 0x5D17710F, 0xD5B521A5, 0xEE3BD484, 0x6699842E, 0x80DFB7FD, 0x087DE757,
+	0x90247953, 0x188629F9, 0xFEC01A2A, 0x76624A80, 0x4DECBFA1, 0xC54EEF0B, 0x2308DCD8, 0xABAA8C72,
+	0x5415369A, 0xDCB76630, 0x3AF155E3, 0xB2530549, 0x89DDF068, 0x017FA0C2, 0xE7399311, 0x6F9BC3BB,
+	0x67E624EC, 0xEF447446, 0x09024795, 0x81A0173F, 0xBA2EE21E, 0x328CB2B4, 0xD4CA8167, 0x5C68D1CD,
+	0xA3D76B25, 0x2B753B8F, 0xCD33085C, 0x459158F6, 0x7E1FADD7, 0xF6BDFD7D, 0x10FBCEAE, 0x98599E04,
+	0x5FE8308B, 0xD74A6021, 0x310C53F2, 0xB9AE0358, 0x8220F679, 0x0A82A6D3, 0xECC49500, 0x6466C5AA,
+	0x9BD97F42, 0x137B2FE8, 0xF53D1C3B, 0x7D9F4C91, 0x4611B9B0, 0xCEB3E91A, 0x28F5DAC9, 0xA0578A63,
+	0xA82A6D34, 0x20883D9E, 0xC6CE0E4D, 0x4E6C5EE7, 0x75E2ABC6, 0xFD40FB6C, 0x1B06C8BF, 0x93A49815,
+	0x6C1B22FD, 0xE4B97257, 0x02FF4184, 0x8A5D112E, 0xB1D3E40F, 0x3971B4A5, 0xDF378776, 0x5795D7DC,
+	0xCFCC49D8, 0x476E1972, 0xA1282AA1, 0x298A7A0B, 0x12048F2A, 0x9AA6DF80, 0x7CE0EC53, 0xF442BCF9,
+	0x0BFD0611, 0x835F56BB, 0x65196568, 0xEDBB35C2, 0xD635C0E3, 0x5E979049, 0xB8D1A39A, 0x3073F330,
+	0x380E1467, 0xB0AC44CD, 0x56EA771E, 0xDE4827B4, 0xE5C6D295, 0x6D64823F, 0x8B22B1EC, 0x0380E146,
+	0xFC3F5BAE, 0x749D0B04, 0x92DB38D7, 0x1A79687D, 0x21F79D5C, 0xA955CDF6, 0x4F13FE25, 0xC7B1AE8F,
+	0xBFD06116, 0x377231BC, 0xD134026F, 0x599652C5, 0x6218A7E4, 0xEABAF74E, 0x0CFCC49D, 0x845E9437,
+	0x7BE12EDF, 0xF3437E75, 0x15054DA6, 0x9DA71D0C, 0xA629E82D, 0x2E8BB887, 0xC8CD8B54, 0x406FDBFE,
+	0x48123CA9, 0xC0B06C03, 0x26F65FD0, 0xAE540F7A, 0x95DAFA5B, 0x1D78AAF1, 0xFB3E9922, 0x739CC988,
+	0x8C237360, 0x048123CA, 0xE2C71019, 0x6A6540B3, 0x51EBB592, 0xD949E538, 0x3F0FD6EB, 0xB7AD8641,
+	0x2FF41845, 0xA75648EF, 0x41107B3C, 0xC9B22B96, 0xF23CDEB7, 0x7A9E8E1D, 0x9CD8BDCE, 0x147AED64,
+	0xEBC5578C, 0x63670726, 0x852134F5, 0x0D83645F, 0x360D917E, 0xBEAFC1D4, 0x58E9F207, 0xD04BA2AD,
+	0xD83645FA, 0x50941550, 0xB6D22683, 0x3E707629, 0x05FE8308, 0x8D5CD3A2, 0x6B1AE071, 0xE3B8B0DB,
+	0x1C070A33, 0x94A55A99, 0x72E3694A, 0xFA4139E0, 0xC1CFCCC1, 0x496D9C6B, 0xAF2BAFB8, 0x2789FF12,
+	0xE038519D, 0x689A0137, 0x8EDC32E4, 0x067E624E, 0x3DF0976F, 0xB552C7C5, 0x5314F416, 0xDBB6A4BC,
+	0x24091E54, 0xACAB4EFE, 0x4AED7D2D, 0xC24F2D87, 0xF9C1D8A6, 0x7163880C, 0x9725BBDF, 0x1F87EB75,
+	0x17FA0C22, 0x9F585C88, 0x791E6F5B, 0xF1BC3FF1, 0xCA32CAD0, 0x42909A7A, 0xA4D6A9A9, 0x2C74F903,
+	0xD3CB43EB, 0x5B691341, 0xBD2F2092, 0x358D7038, 0x0E038519, 0x86A1D5B3, 0x60E7E660, 0xE845B6CA,
+	0x701C28CE, 0xF8BE7864, 0x1EF84BB7, 0x965A1B1D, 0xADD4EE3C, 0x2576BE96, 0xC3308D45, 0x4B92DDEF,
+	0xB42D6707, 0x3C8F37AD, 0xDAC9047E, 0x526B54D4, 0x69E5A1F5, 0xE147F15F, 0x0701C28C, 0x8FA39226,
+	0x87DE7571, 0x0F7C25DB, 0xE93A1608, 0x619846A2, 0x5A16B383, 0xD2B4E329, 0x34F2D0FA, 0xBC508050,
+	0x43EF3AB8, 0xCB4D6A12, 0x2D0B59C1, 0xA5A9096B, 0x9E27FC4A, 0x1685ACE0, 0xF0C39F33, 0x7861CF99,
+	// Seed 0x34
+	0x00000000, 0x1D49C47F, 0x3A9388FE, 0x27DA4C81, 0x364EF897, 0x2B073CE8, 0x0CDD7069, 0x1194B416,
+	0x2FF41845, 0x32BDDC3A, 0x156790BB, 0x082E54C4, 0x19BAE0D2, 0x04F324AD, 0x2329682C, 0x3E60AC53,
+	0x1C81D9E1, 0x01C81D9E, 0x2612511F, 0x3B5B9560, 0x2ACF2176, 0x3786E509, 0x105CA988, 0x0D156DF7,
+	0x3375C1A4, 0x2E3C05DB, 0x09E6495A, 0x14AF8D25, 0x053B3933, 0x1872FD4C, 0x3FA8B1CD, 0x22E175B2,
+	0x3903B3C2, 0x244A77BD, 0x03903B3C, 0x1ED9FF43, 0x0F4D4B55, 0x12048F2A, 0x35DEC3AB, 0x289707D4,
+	0x16F7AB87, 0x0BBE6FF8, 0x2C642379, 0x312DE706, 0x20B95310, 0x3DF0976F, 0x1A2ADBEE, 0x07631F91,
+	0x25826A23, 0x38CBAE5C, 0x1F11E2DD, 0x025826A2, 0x13CC92B4, 0x0E8556CB, 0x295F1A4A, 0x3416DE35,
+	0x0A767266, 0x173FB619, 0x30E5FA98, 0x2DAC3EE7, 0x3C388AF1, 0x21714E8E, 0x06AB020F, 0x1BE2C670,
+	0x316E8EEF, 0x2C274A90, 0x0BFD0611, 0x16B4C26E, 0x07207678, 0x1A69B207, 0x3DB3FE86, 0x20FA3AF9,
+	0x1E9A96AA, 0x03D352D5, 0x24091E54, 0x3940DA2B, 0x28D46E3D, 0x359DAA42, 0x1247E6C3, 0x0F0E22BC,
+	0x2DEF570E, 0x30A69371, 0x177CDFF0, 0x0A351B8F, 0x1BA1AF99, 0x06E86BE6, 0x21322767, 0x3C7BE318,
+	0x021B4F4B, 0x1F528B34, 0x3888C7B5, 0x25C103CA, 0x3455B7DC, 0x291C73A3, 0x0EC63F22, 0x138FFB5D,
+	0x086D3D2D, 0x1524F952, 0x32FEB5D3, 0x2FB771AC, 0x3E23C5BA, 0x236A01C5, 0x04B04D44, 0x19F9893B,
+	0x27992568, 0x3AD0E117, 0x1D0AAD96, 0x004369E9, 0x11D7DDFF, 0x0C9E1980, 0x2B445501, 0x360D917E,
+	0x14ECE4CC, 0x09A520B3, 0x2E7F6C32, 0x3336A84D, 0x22A21C5B, 0x3FEBD824, 0x183194A5, 0x057850DA,
+	0x3B18FC89, 0x265138F6, 0x018B7477, 0x1CC2B008, 0x0D56041E, 0x101FC061, 0x37C58CE0, 0x2A8C489F,
+	0x21B4F4B5, 0x3CFD30CA, 0x1B277C4B, 0x066EB834, 0x17FA0C22, 0x0AB3C85D, 0x2D6984DC, 0x302040A3,
+	0x0E40ECF0, 0x1309288F, 0x34D3640E, 0x299AA071, 0x380E1467, 0x2547D018, 0x029D9C99, 0x1FD458E6,
+	0x3D352D54, 0x207CE92B, 0x07A6A5AA, 0x1AEF61D5, 0x0B7BD5C3, 0x163211BC, 0x31E85D3D, 0x2CA19942,
+	0x12C13511, 0x0F88F16E, 0x2852BDEF, 0x351B7990, 0x248FCD86, 0x39C609F9, 0x1E1C4578, 0x03558107,
+	0x18B74777, 0x05FE8308, 0x2224CF89, 0x3F6D0BF6, 0x2EF9BFE0, 0x33B07B9F, 0x146A371E, 0x0923F361,
+	0x37435F32, 0x2A0A9B4D, 0x0DD0D7CC, 0x109913B3, 0x010DA7A5, 0x1C4463DA, 0x3B9E2F5B, 0x26D7EB24,
+	0x04369E96, 0x197F5AE9, 0x3EA51668, 0x23ECD217, 0x32786601, 0x2F31A27E, 0x08EBEEFF, 0x15A22A80,
+	0x2BC286D3, 0x368B42AC, 0x11510E2D, 0x0C18CA52, 0x1D8C7E44, 0x00C5BA3B, 0x271FF6BA, 0x3A5632C5,
+	0x10DA7A5A, 0x0D93BE25, 0x2A49F2A4, 0x370036DB, 0x269482CD, 0x3BDD46B2, 0x1C070A33, 0x014ECE4C,
+	0x3F2E621F, 0x2267A660, 0x05BDEAE1, 0x18F42E9E, 0x09609A88, 0x14295EF7, 0x33F31276, 0x2EBAD609,
+	0x0C5BA3BB, 0x111267C4, 0x36C82B45, 0x2B81EF3A, 0x3A155B2C, 0x275C9F53, 0x0086D3D2, 0x1DCF17AD,
+	0x23AFBBFE, 0x3EE67F81, 0x193C3300, 0x0475F77F, 0x15E14369, 0x08A88716, 0x2F72CB97, 0x323B0FE8,
+	0x29D9C998, 0x34900DE7, 0x134A4166, 0x0E038519, 0x1F97310F, 0x02DEF570, 0x2504B9F1, 0x384D7D8E,
+	0x062DD1DD, 0x1B6415A2, 0x3CBE5923, 0x21F79D5C, 0x3063294A, 0x2D2AED35, 0x0AF0A1B4, 0x17B965CB,
+	0x35581079, 0x2811D406, 0x0FCB9887, 0x12825CF8, 0x0316E8EE, 0x1E5F2C91, 0x39856010, 0x24CCA46F,
+	0x1AAC083C, 0x07E5CC43, 0x203F80C2, 0x3D7644BD, 0x2CE2F0AB, 0x31AB34D4, 0x16717855, 0x0B38BC2A,
+	// Seed 0x35
+	0x00000000, 0x58F9287D, 0x1C95D8BD, 0x446CF0C0, 0x392BB17A, 0x61D29907, 0x25BE69C7, 0x7D4741BA,
+	0x725762F4, 0x2AAE4A89, 0x6EC2BA49, 0x363B9234, 0x4B7CD38E, 0x1385FBF3, 0x57E90B33, 0x0F10234E,
+	0x49C94DAF, 0x113065D2, 0x555C9512, 0x0DA5BD6F, 0x70E2FCD5, 0x281BD4A8, 0x6C772468, 0x348E0C15,
+	0x3B9E2F5B, 0x63670726, 0x270BF7E6, 0x7FF2DF9B, 0x02B59E21, 0x5A4CB65C, 0x1E20469C, 0x46D96EE1,
+	0x3EF51319, 0x660C3B64, 0x2260CBA4, 0x7A99E3D9, 0x07DEA263, 0x5F278A1E, 0x1B4B7ADE, 0x43B252A3,
+	0x4CA271ED, 0x145B5990, 0x5037A950, 0x08CE812D, 0x7589C097, 0x2D70E8EA, 0x691C182A, 0x31E53057,
+	0x773C5EB6, 0x2FC576CB, 0x6BA9860B, 0x3350AE76, 0x4E17EFCC, 0x16EEC7B1, 0x52823771, 0x0A7B1F0C,
+	0x056B3C42, 0x5D92143F, 0x19FEE4FF, 0x4107CC82, 0x3C408D38, 0x64B9A545, 0x20D55585, 0x782C7DF8,
+	0x7DEA2632, 0x25130E4F, 0x617FFE8F, 0x3986D6F2, 0x44C19748, 0x1C38BF35, 0x58544FF5, 0x00AD6788,
+	0x0FBD44C6, 0x57446CBB, 0x13289C7B, 0x4BD1B406, 0x3696F5BC, 0x6E6FDDC1, 0x2A032D01, 0x72FA057C,
+	0x34236B9D, 0x6CDA43E0, 0x28B6B320, 0x704F9B5D, 0x0D08DAE7, 0x55F1F29A, 0x119D025A, 0x49642A27,
+	0x46740969, 0x1E8D2114, 0x5AE1D1D4, 0x0218F9A9, 0x7F5FB813, 0x27A6906E, 0x63CA60AE, 0x3B3348D3,
+	0x431F352B, 0x1BE61D56, 0x5F8AED96, 0x0773C5EB, 0x7A348451, 0x22CDAC2C, 0x66A15CEC, 0x3E587491,
+	0x314857DF, 0x69B17FA2, 0x2DDD8F62, 0x7524A71F, 0x0863E6A5, 0x509ACED8, 0x14F63E18, 0x4C0F1665,
+	0x0AD67884, 0x522F50F9, 0x1643A039, 0x4EBA8844, 0x33FDC9FE, 0x6B04E183, 0x2F681143, 0x7791393E,
+	0x78811A70, 0x2078320D, 0x6414C2CD, 0x3CEDEAB0, 0x41AAAB0A, 0x19538377, 0x5D3F73B7, 0x05C65BCA,
+	0x56B3C423, 0x0E4AEC5E, 0x4A261C9E, 0x12DF34E3, 0x6F987559, 0x37615D24, 0x730DADE4, 0x2BF48599,
+	0x24E4A6D7, 0x7C1D8EAA, 0x38717E6A, 0x60885617, 0x1DCF17AD, 0x45363FD0, 0x015ACF10, 0x59A3E76D,
+	0x1F7A898C, 0x4783A1F1, 0x03EF5131, 0x5B16794C, 0x265138F6, 0x7EA8108B, 0x3AC4E04B, 0x623DC836,
+	0x6D2DEB78, 0x35D4C305, 0x71B833C5, 0x29411BB8, 0x54065A02, 0x0CFF727F, 0x489382BF, 0x106AAAC2,
+	0x6846D73A, 0x30BFFF47, 0x74D30F87, 0x2C2A27FA, 0x516D6640, 0x09944E3D, 0x4DF8BEFD, 0x15019680,
+	0x1A11B5CE, 0x42E89DB3, 0x06846D73, 0x5E7D450E, 0x233A04B4, 0x7BC32CC9, 0x3FAFDC09, 0x6756F474,
+	0x218F9A95, 0x7976B2E8, 0x3D1A4228, 0x65E36A55, 0x18A42BEF, 0x405D0392, 0x0431F352, 0x5CC8DB2F,
+	0x53D8F861, 0x0B21D01C, 0x4F4D20DC, 0x17B408A1, 0x6AF3491B, 0x320A6166, 0x766691A6, 0x2E9FB9DB,
+	0x2B59E211, 0x73A0CA6C, 0x37CC3AAC, 0x6F3512D1, 0x1272536B, 0x4A8B7B16, 0x0EE78BD6, 0x561EA3AB,
+	0x590E80E5, 0x01F7A898, 0x459B5858, 0x1D627025, 0x6025319F, 0x38DC19E2, 0x7CB0E922, 0x2449C15F,
+	0x6290AFBE, 0x3A6987C3, 0x7E057703, 0x26FC5F7E, 0x5BBB1EC4, 0x034236B9, 0x472EC679, 0x1FD7EE04,
+	0x10C7CD4A, 0x483EE537, 0x0C5215F7, 0x54AB3D8A, 0x29EC7C30, 0x7115544D, 0x3579A48D, 0x6D808CF0,
+	0x15ACF108, 0x4D55D975, 0x093929B5, 0x51C001C8, 0x2C874072, 0x747E680F, 0x301298CF, 0x68EBB0B2,
+	0x67FB93FC, 0x3F02BB81, 0x7B6E4B41, 0x2397633C, 0x5ED02286, 0x06290AFB, 0x4245FA3B, 0x1ABCD246,
+	0x5C65BCA7, 0x049C94DA, 0x40F0641A, 0x18094C67, 0x654E0DDD, 0x3DB725A0, 0x79DBD560, 0x2122FD1D,
+	0x2E32DE53, 0x76CBF62E, 0x32A706EE, 0x6A5E2E93, 0x17196F29, 0x4FE04754, 0x0B8CB794, 0x53759FE9,
+	// Seed 0x36
+	0x00000000, 0x0827E288, 0x104FC510, 0x18682798, 0x209F8A20, 0x28B868A8, 0x30D04F30, 0x38F7ADB8,
+	0x413F1440, 0x4918F6C8, 0x5170D150, 0x595733D8, 0x61A09E60, 0x69877CE8, 0x71EF5B70, 0x79C8B9F8,
+	0x827E2880, 0x8A59CA08, 0x9231ED90, 0x9A160F18, 0xA2E1A2A0, 0xAAC64028, 0xB2AE67B0, 0xBA898538,
+	0xC3413CC0, 0xCB66DE48, 0xD30EF9D0, 0xDB291B58, 0xE3DEB6E0, 0xEBF95468, 0xF39173F0, 0xFBB69178,
+	0x9B897A33, 0x93AE98BB, 0x8BC6BF23, 0x83E15DAB, 0xBB16F013, 0xB331129B, 0xAB593503, 0xA37ED78B,
+	0xDAB66E73, 0xD2918CFB, 0xCAF9AB63, 0xC2DE49EB, 0xFA29E453, 0xF20E06DB, 0xEA662143, 0xE241C3CB,
+	0x19F752B3, 0x11D0B03B, 0x09B897A3, 0x019F752B, 0x3968D893, 0x314F3A1B, 0x29271D83, 0x2100FF0B,
+	0x58C846F3, 0x50EFA47B, 0x488783E3, 0x40A0616B, 0x7857CCD3, 0x70702E5B, 0x681809C3, 0x603FEB4B,
+	0xA867DF55, 0xA0403DDD, 0xB8281A45, 0xB00FF8CD, 0x88F85575, 0x80DFB7FD, 0x98B79065, 0x909072ED,
+	0xE958CB15, 0xE17F299D, 0xF9170E05, 0xF130EC8D, 0xC9C74135, 0xC1E0A3BD, 0xD9888425, 0xD1AF66AD,
+	0x2A19F7D5, 0x223E155D, 0x3A5632C5, 0x3271D04D, 0x0A867DF5, 0x02A19F7D, 0x1AC9B8E5, 0x12EE5A6D,
+	0x6B26E395, 0x6301011D, 0x7B692685, 0x734EC40D, 0x4BB969B5, 0x439E8B3D, 0x5BF6ACA5, 0x53D14E2D,
+	0x33EEA566, 0x3BC947EE, 0x23A16076, 0x2B8682FE, 0x13712F46, 0x1B56CDCE, 0x033EEA56, 0x0B1908DE,
+	0x72D1B126, 0x7AF653AE, 0x629E7436, 0x6AB996BE, 0x524E3B06, 0x5A69D98E, 0x4201FE16, 0x4A261C9E,
+	0xB1908DE6, 0xB9B76F6E, 0xA1DF48F6, 0xA9F8AA7E, 0x910F07C6, 0x9928E54E, 0x8140C2D6, 0x8967205E,
+	0xF0AF99A6, 0xF8887B2E, 0xE0E05CB6, 0xE8C7BE3E, 0xD0301386, 0xD817F10E, 0xC07FD696, 0xC858341E,
+	0xCFBA9599, 0xC79D7711, 0xDFF55089, 0xD7D2B201, 0xEF251FB9, 0xE702FD31, 0xFF6ADAA9, 0xF74D3821,
+	0x8E8581D9, 0x86A26351, 0x9ECA44C9, 0x96EDA641, 0xAE1A0BF9, 0xA63DE971, 0xBE55CEE9, 0xB6722C61,
+	0x4DC4BD19, 0x45E35F91, 0x5D8B7809, 0x55AC9A81, 0x6D5B3739, 0x657CD5B1, 0x7D14F229, 0x753310A1,
+	0x0CFBA959, 0x04DC4BD1, 0x1CB46C49, 0x14938EC1, 0x2C642379, 0x2443C1F1, 0x3C2BE669, 0x340C04E1,
+	0x5433EFAA, 0x5C140D22, 0x447C2ABA, 0x4C5BC832, 0x74AC658A, 0x7C8B8702, 0x64E3A09A, 0x6CC44212,
+	0x150CFBEA, 0x1D2B1962, 0x05433EFA, 0x0D64DC72, 0x359371CA, 0x3DB49342, 0x25DCB4DA, 0x2DFB5652,
+	0xD64DC72A, 0xDE6A25A2, 0xC602023A, 0xCE25E0B2, 0xF6D24D0A, 0xFEF5AF82, 0xE69D881A, 0xEEBA6A92,
+	0x9772D36A, 0x9F5531E2, 0x873D167A, 0x8F1AF4F2, 0xB7ED594A, 0xBFCABBC2, 0xA7A29C5A, 0xAF857ED2,
+	0x67DD4ACC, 0x6FFAA844, 0x77928FDC, 0x7FB56D54, 0x4742C0EC, 0x4F652264, 0x570D05FC, 0x5F2AE774,
+	0x26E25E8C, 0x2EC5BC04, 0x36AD9B9C, 0x3E8A7914, 0x067DD4AC, 0x0E5A3624, 0x163211BC, 0x1E15F334,
+	0xE5A3624C, 0xED8480C4, 0xF5ECA75C, 0xFDCB45D4, 0xC53CE86C, 0xCD1B0AE4, 0xD5732D7C, 0xDD54CFF4,
+	0xA49C760C, 0xACBB9484, 0xB4D3B31C, 0xBCF45194, 0x8403FC2C, 0x8C241EA4, 0x944C393C, 0x9C6BDBB4,
+	0xFC5430FF, 0xF473D277, 0xEC1BF5EF, 0xE43C1767, 0xDCCBBADF, 0xD4EC5857, 0xCC847FCF, 0xC4A39D47,
+	0xBD6B24BF, 0xB54CC637, 0xAD24E1AF, 0xA5030327, 0x9DF4AE9F, 0x95D34C17, 0x8DBB6B8F, 0x859C8907,
+	0x7E2A187F, 0x760DFAF7, 0x6E65DD6F, 0x66423FE7, 0x5EB5925F, 0x569270D7, 0x4EFA574F, 0x46DDB5C7,
+	0x3F150C3F, 0x3732EEB7, 0x2F5AC92F, 0x277D2BA7, 0x1F8A861F, 0x17AD6497, 0x0FC5430F, 0x07E2A187,
+	// Seed 0x37
+	0x00000000, 0x71E58A1A, 0xE3CB1434, 0x922E9E2E, 0xB6F96277, 0xC71CE86D, 0x55327643, 0x24D7FC59,
+	0x1C9D8EF1, 0x6D7804EB, 0xFF569AC5, 0x8EB310DF, 0xAA64EC86, 0xDB81669C, 0x49AFF8B2, 0x384A72A8,
+	0x393B1DE2, 0x48DE97F8, 0xDAF009D6, 0xAB1583CC, 0x8FC27F95, 0xFE27F58F, 0x6C096BA1, 0x1DECE1BB,
+	0x25A69313, 0x54431909, 0xC66D8727, 0xB7880D3D, 0x935FF164, 0xE2BA7B7E, 0x7094E550, 0x01716F4A,
+	0x72763BC4, 0x0393B1DE, 0x91BD2FF0, 0xE058A5EA, 0xC48F59B3, 0xB56AD3A9, 0x27444D87, 0x56A1C79D,
+	0x6EEBB535, 0x1F0E3F2F, 0x8D20A101, 0xFCC52B1B, 0xD812D742, 0xA9F75D58, 0x3BD9C376, 0x4A3C496C,
+	0x4B4D2626, 0x3AA8AC3C, 0xA8863212, 0xD963B808, 0xFDB44451, 0x8C51CE4B, 0x1E7F5065, 0x6F9ADA7F,
+	0x57D0A8D7, 0x263522CD, 0xB41BBCE3, 0xC5FE36F9, 0xE129CAA0, 0x90CC40BA, 0x02E2DE94, 0x7307548E,
+	0xE4EC7788, 0x9509FD92, 0x072763BC, 0x76C2E9A6, 0x521515FF, 0x23F09FE5, 0xB1DE01CB, 0xC03B8BD1,
+	0xF871F979, 0x89947363, 0x1BBAED4D, 0x6A5F6757, 0x4E889B0E, 0x3F6D1114, 0xAD438F3A, 0xDCA60520,
+	0xDDD76A6A, 0xAC32E070, 0x3E1C7E5E, 0x4FF9F444, 0x6B2E081D, 0x1ACB8207, 0x88E51C29, 0xF9009633,
+	0xC14AE49B, 0xB0AF6E81, 0x2281F0AF, 0x53647AB5, 0x77B386EC, 0x06560CF6, 0x947892D8, 0xE59D18C2,
+	0x969A4C4C, 0xE77FC656, 0x75515878, 0x04B4D262, 0x20632E3B, 0x5186A421, 0xC3A83A0F, 0xB24DB015,
+	0x8A07C2BD, 0xFBE248A7, 0x69CCD689, 0x18295C93, 0x3CFEA0CA, 0x4D1B2AD0, 0xDF35B4FE, 0xAED03EE4,
+	0xAFA151AE, 0xDE44DBB4, 0x4C6A459A, 0x3D8FCF80, 0x195833D9, 0x68BDB9C3, 0xFA9327ED, 0x8B76ADF7,
+	0xB33CDF5F, 0xC2D95545, 0x50F7CB6B, 0x21124171, 0x05C5BD28, 0x74203732, 0xE60EA91C, 0x97EB2306,
+	0xB8B7A50F, 0xC9522F15, 0x5B7CB13B, 0x2A993B21, 0x0E4EC778, 0x7FAB4D62, 0xED85D34C, 0x9C605956,
+	0xA42A2BFE, 0xD5CFA1E4, 0x47E13FCA, 0x3604B5D0, 0x12D34989, 0x6336C393, 0xF1185DBD, 0x80FDD7A7,
+	0x818CB8ED, 0xF06932F7, 0x6247ACD9, 0x13A226C3, 0x3775DA9A, 0x46905080, 0xD4BECEAE, 0xA55B44B4,
+	0x9D11361C, 0xECF4BC06, 0x7EDA2228, 0x0F3FA832, 0x2BE8546B, 0x5A0DDE71, 0xC823405F, 0xB9C6CA45,
+	0xCAC19ECB, 0xBB2414D1, 0x290A8AFF, 0x58EF00E5, 0x7C38FCBC, 0x0DDD76A6, 0x9FF3E888, 0xEE166292,
+	0xD65C103A, 0xA7B99A20, 0x3597040E, 0x44728E14, 0x60A5724D, 0x1140F857, 0x836E6679, 0xF28BEC63,
+	0xF3FA8329, 0x821F0933, 0x1031971D, 0x61D41D07, 0x4503E15E, 0x34E66B44, 0xA6C8F56A, 0xD72D7F70,
+	0xEF670DD8, 0x9E8287C2, 0x0CAC19EC, 0x7D4993F6, 0x599E6FAF, 0x287BE5B5, 0xBA557B9B, 0xCBB0F181,
+	0x5C5BD287, 0x2DBE589D, 0xBF90C6B3, 0xCE754CA9, 0xEAA2B0F0, 0x9B473AEA, 0x0969A4C4, 0x788C2EDE,
+	0x40C65C76, 0x3123D66C, 0xA30D4842, 0xD2E8C258, 0xF63F3E01, 0x87DAB41B, 0x15F42A35, 0x6411A02F,
+	0x6560CF65, 0x1485457F, 0x86ABDB51, 0xF74E514B, 0xD399AD12, 0xA27C2708, 0x3052B926, 0x41B7333C,
+	0x79FD4194, 0x0818CB8E, 0x9A3655A0, 0xEBD3DFBA, 0xCF0423E3, 0xBEE1A9F9, 0x2CCF37D7, 0x5D2ABDCD,
+	0x2E2DE943, 0x5FC86359, 0xCDE6FD77, 0xBC03776D, 0x98D48B34, 0xE931012E, 0x7B1F9F00, 0x0AFA151A,
+	0x32B067B2, 0x4355EDA8, 0xD17B7386, 0xA09EF99C, 0x844905C5, 0xF5AC8FDF, 0x678211F1, 0x16679BEB,
+	0x1716F4A1, 0x66F37EBB, 0xF4DDE095, 0x85386A8F, 0xA1EF96D6, 0xD00A1CCC, 0x422482E2, 0x33C108F8,
+	0x0B8B7A50, 0x7A6EF04A, 0xE8406E64, 0x99A5E47E, 0xBD721827, 0xCC97923D, 0x5EB90C13, 0x2F5C8609,
+	// Seed 0x38
+	0x00000000, 0x21922D85, 0x13212A37, 0x32B307B2, 0x2642546E, 0x07D079EB, 0x35637E59, 0x14F153DC,
+	0x1C81D9E1, 0x3D13F464, 0x0FA0F3D6, 0x2E32DE53, 0x3AC38D8F, 0x1B51A00A, 0x29E2A7B8, 0x08708A3D,
+	0x3903B3C2, 0x18919E47, 0x2A2299F5, 0x0BB0B470, 0x1F41E7AC, 0x3ED3CA29, 0x0C60CD9B, 0x2DF2E01E,
+	0x25826A23, 0x041047A6, 0x36A34014, 0x17316D91, 0x03C03E4D, 0x225213C8, 0x10E1147A, 0x317339FF,
+	0x220216B9, 0x03903B3C, 0x31233C8E, 0x10B1110B, 0x044042D7, 0x25D26F52, 0x176168E0, 0x36F34565,
+	0x3E83CF58, 0x1F11E2DD, 0x2DA2E56F, 0x0C30C8EA, 0x18C19B36, 0x3953B6B3, 0x0BE0B101, 0x2A729C84,
+	0x1B01A57B, 0x3A9388FE, 0x08208F4C, 0x29B2A2C9, 0x3D43F115, 0x1CD1DC90, 0x2E62DB22, 0x0FF0F6A7,
+	0x07807C9A, 0x2612511F, 0x14A156AD, 0x35337B28, 0x21C228F4, 0x00500571, 0x32E302C3, 0x13712F46,
+	0x14015C4F, 0x359371CA, 0x07207678, 0x26B25BFD, 0x32430821, 0x13D125A4, 0x21622216, 0x00F00F93,
+	0x088085AE, 0x2912A82B, 0x1BA1AF99, 0x3A33821C, 0x2EC2D1C0, 0x0F50FC45, 0x3DE3FBF7, 0x1C71D672,
+	0x2D02EF8D, 0x0C90C208, 0x3E23C5BA, 0x1FB1E83F, 0x0B40BBE3, 0x2AD29666, 0x186191D4, 0x39F3BC51,
+	0x3183366C, 0x10111BE9, 0x22A21C5B, 0x033031DE, 0x17C16202, 0x36534F87, 0x04E04835, 0x257265B0,
+	0x36034AF6, 0x17916773, 0x252260C1, 0x04B04D44, 0x10411E98, 0x31D3331D, 0x036034AF, 0x22F2192A,
+	0x2A829317, 0x0B10BE92, 0x39A3B920, 0x183194A5, 0x0CC0C779, 0x2D52EAFC, 0x1FE1ED4E, 0x3E73C0CB,
+	0x0F00F934, 0x2E92D4B1, 0x1C21D303, 0x3DB3FE86, 0x2942AD5A, 0x08D080DF, 0x3A63876D, 0x1BF1AAE8,
+	0x138120D5, 0x32130D50, 0x00A00AE2, 0x21322767, 0x35C374BB, 0x1451593E, 0x26E25E8C, 0x07707309,
+	0x2802B89E, 0x0990951B, 0x3B2392A9, 0x1AB1BF2C, 0x0E40ECF0, 0x2FD2C175, 0x1D61C6C7, 0x3CF3EB42,
+	0x3483617F, 0x15114CFA, 0x27A24B48, 0x063066CD, 0x12C13511, 0x33531894, 0x01E01F26, 0x207232A3,
+	0x11010B5C, 0x309326D9, 0x0220216B, 0x23B20CEE, 0x37435F32, 0x16D172B7, 0x24627505, 0x05F05880,
+	0x0D80D2BD, 0x2C12FF38, 0x1EA1F88A, 0x3F33D50F, 0x2BC286D3, 0x0A50AB56, 0x38E3ACE4, 0x19718161,
+	0x0A00AE27, 0x2B9283A2, 0x19218410, 0x38B3A995, 0x2C42FA49, 0x0DD0D7CC, 0x3F63D07E, 0x1EF1FDFB,
+	0x168177C6, 0x37135A43, 0x05A05DF1, 0x24327074, 0x30C323A8, 0x11510E2D, 0x23E2099F, 0x0270241A,
+	0x33031DE5, 0x12913060, 0x202237D2, 0x01B01A57, 0x1541498B, 0x34D3640E, 0x066063BC, 0x27F24E39,
+	0x2F82C404, 0x0E10E981, 0x3CA3EE33, 0x1D31C3B6, 0x09C0906A, 0x2852BDEF, 0x1AE1BA5D, 0x3B7397D8,
+	0x3C03E4D1, 0x1D91C954, 0x2F22CEE6, 0x0EB0E363, 0x1A41B0BF, 0x3BD39D3A, 0x09609A88, 0x28F2B70D,
+	0x20823D30, 0x011010B5, 0x33A31707, 0x12313A82, 0x06C0695E, 0x275244DB, 0x15E14369, 0x34736EEC,
+	0x05005713, 0x24927A96, 0x16217D24, 0x37B350A1, 0x2342037D, 0x02D02EF8, 0x3063294A, 0x11F104CF,
+	0x19818EF2, 0x3813A377, 0x0AA0A4C5, 0x2B328940, 0x3FC3DA9C, 0x1E51F719, 0x2CE2F0AB, 0x0D70DD2E,
+	0x1E01F268, 0x3F93DFED, 0x0D20D85F, 0x2CB2F5DA, 0x3843A606, 0x19D18B83, 0x2B628C31, 0x0AF0A1B4,
+	0x02802B89, 0x2312060C, 0x11A101BE, 0x30332C3B, 0x24C27FE7, 0x05505262, 0x37E355D0, 0x16717855,
+	0x270241AA, 0x06906C2F, 0x34236B9D, 0x15B14618, 0x014015C4, 0x20D23841, 0x12613FF3, 0x33F31276,
+	0x3B83984B, 0x1A11B5CE, 0x28A2B27C, 0x09309FF9, 0x1DC1CC25, 0x3C53E1A0, 0x0EE0E612, 0x2F72CB97,
+	// Seed 0x39
+	0x00000000, 0x0B5EBA11, 0x16BD7422, 0x1DE3CE33, 0x2D7AE844, 0x26245255, 0x3BC79C66, 0x30992677,
+	0x5AF5D088, 0x51AB6A99, 0x4C48A4AA, 0x47161EBB, 0x778F38CC, 0x7CD182DD, 0x61324CEE, 0x6A6CF6FF,
+	0x0BE0B101, 0x00BE0B10, 0x1D5DC523, 0x16037F32, 0x269A5945, 0x2DC4E354, 0x30272D67, 0x3B799776,
+	0x51156189, 0x5A4BDB98, 0x47A815AB, 0x4CF6AFBA, 0x7C6F89CD, 0x773133DC, 0x6AD2FDEF, 0x618C47FE,
+	0x17C16202, 0x1C9FD813, 0x017C1620, 0x0A22AC31, 0x3ABB8A46, 0x31E53057, 0x2C06FE64, 0x27584475,
+	0x4D34B28A, 0x466A089B, 0x5B89C6A8, 0x50D77CB9, 0x604E5ACE, 0x6B10E0DF, 0x76F32EEC, 0x7DAD94FD,
+	0x1C21D303, 0x177F6912, 0x0A9CA721, 0x01C21D30, 0x315B3B47, 0x3A058156, 0x27E64F65, 0x2CB8F574,
+	0x46D4038B, 0x4D8AB99A, 0x506977A9, 0x5B37CDB8, 0x6BAEEBCF, 0x60F051DE, 0x7D139FED, 0x764D25FC,
+	0x2F82C404, 0x24DC7E15, 0x393FB026, 0x32610A37, 0x02F82C40, 0x09A69651, 0x14455862, 0x1F1BE273,
+	0x7577148C, 0x7E29AE9D, 0x63CA60AE, 0x6894DABF, 0x580DFCC8, 0x535346D9, 0x4EB088EA, 0x45EE32FB,
+	0x24627505, 0x2F3CCF14, 0x32DF0127, 0x3981BB36, 0x09189D41, 0x02462750, 0x1FA5E963, 0x14FB5372,
+	0x7E97A58D, 0x75C91F9C, 0x682AD1AF, 0x63746BBE, 0x53ED4DC9, 0x58B3F7D8, 0x455039EB, 0x4E0E83FA,
+	0x3843A606, 0x331D1C17, 0x2EFED224, 0x25A06835, 0x15394E42, 0x1E67F453, 0x03843A60, 0x08DA8071,
+	0x62B6768E, 0x69E8CC9F, 0x740B02AC, 0x7F55B8BD, 0x4FCC9ECA, 0x449224DB, 0x5971EAE8, 0x522F50F9,
+	0x33A31707, 0x38FDAD16, 0x251E6325, 0x2E40D934, 0x1ED9FF43, 0x15874552, 0x08648B61, 0x033A3170,
+	0x6956C78F, 0x62087D9E, 0x7FEBB3AD, 0x74B509BC, 0x442C2FCB, 0x4F7295DA, 0x52915BE9, 0x59CFE1F8,
+	0x5F058808, 0x545B3219, 0x49B8FC2A, 0x42E6463B, 0x727F604C, 0x7921DA5D, 0x64C2146E, 0x6F9CAE7F,
+	0x05F05880, 0x0EAEE291, 0x134D2CA2, 0x181396B3, 0x288AB0C4, 0x23D40AD5, 0x3E37C4E6, 0x35697EF7,
+	0x54E53909, 0x5FBB8318, 0x42584D2B, 0x4906F73A, 0x799FD14D, 0x72C16B5C, 0x6F22A56F, 0x647C1F7E,
+	0x0E10E981, 0x054E5390, 0x18AD9DA3, 0x13F327B2, 0x236A01C5, 0x2834BBD4, 0x35D775E7, 0x3E89CFF6,
+	0x48C4EA0A, 0x439A501B, 0x5E799E28, 0x55272439, 0x65BE024E, 0x6EE0B85F, 0x7303766C, 0x785DCC7D,
+	0x12313A82, 0x196F8093, 0x048C4EA0, 0x0FD2F4B1, 0x3F4BD2C6, 0x341568D7, 0x29F6A6E4, 0x22A81CF5,
+	0x43245B0B, 0x487AE11A, 0x55992F29, 0x5EC79538, 0x6E5EB34F, 0x6500095E, 0x78E3C76D, 0x73BD7D7C,
+	0x19D18B83, 0x128F3192, 0x0F6CFFA1, 0x043245B0, 0x34AB63C7, 0x3FF5D9D6, 0x221617E5, 0x2948ADF4,
+	0x70874C0C, 0x7BD9F61D, 0x663A382E, 0x6D64823F, 0x5DFDA448, 0x56A31E59, 0x4B40D06A, 0x401E6A7B,
+	0x2A729C84, 0x212C2695, 0x3CCFE8A6, 0x379152B7, 0x070874C0, 0x0C56CED1, 0x11B500E2, 0x1AEBBAF3,
+	0x7B67FD0D, 0x7039471C, 0x6DDA892F, 0x6684333E, 0x561D1549, 0x5D43AF58, 0x40A0616B, 0x4BFEDB7A,
+	0x21922D85, 0x2ACC9794, 0x372F59A7, 0x3C71E3B6, 0x0CE8C5C1, 0x07B67FD0, 0x1A55B1E3, 0x110B0BF2,
+	0x67462E0E, 0x6C18941F, 0x71FB5A2C, 0x7AA5E03D, 0x4A3CC64A, 0x41627C5B, 0x5C81B268, 0x57DF0879,
+	0x3DB3FE86, 0x36ED4497, 0x2B0E8AA4, 0x205030B5, 0x10C916C2, 0x1B97ACD3, 0x067462E0, 0x0D2AD8F1,
+	0x6CA69F0F, 0x67F8251E, 0x7A1BEB2D, 0x7145513C, 0x41DC774B, 0x4A82CD5A, 0x57610369, 0x5C3FB978,
+	0x36534F87, 0x3D0DF596, 0x20EE3BA5, 0x2BB081B4, 0x1B29A7C3, 0x10771DD2, 0x0D94D3E1, 0x06CA69F0,
+	// Seed 0x3A
+	0x00000000, 0x2EDC1224, 0x5DB82448, 0x7364366C, 0xBB704890, 0x95AC5AB4, 0xE6C86CD8, 0xC8147EFC,
+	0xFB392245, 0xD5E53061, 0xA681060D, 0x885D1429, 0x40496AD5, 0x6E9578F1, 0x1DF14E9D, 0x332D5CB9,
+	0x7BABF7EF, 0x5577E5CB, 0x2613D3A7, 0x08CFC183, 0xC0DBBF7F, 0xEE07AD5B, 0x9D639B37, 0xB3BF8913,
+	0x8092D5AA, 0xAE4EC78E, 0xDD2AF1E2, 0xF3F6E3C6, 0x3BE29D3A, 0x153E8F1E, 0x665AB972, 0x4886AB56,
+	0xF757EFDE, 0xD98BFDFA, 0xAAEFCB96, 0x8433D9B2, 0x4C27A74E, 0x62FBB56A, 0x119F8306, 0x3F439122,
+	0x0C6ECD9B, 0x22B2DFBF, 0x51D6E9D3, 0x7F0AFBF7, 0xB71E850B, 0x99C2972F, 0xEAA6A143, 0xC47AB367,
+	0x8CFC1831, 0xA2200A15, 0xD1443C79, 0xFF982E5D, 0x378C50A1, 0x19504285, 0x6A3474E9, 0x44E866CD,
+	0x77C53A74, 0x59192850, 0x2A7D1E3C, 0x04A10C18, 0xCCB572E4, 0xE26960C0, 0x910D56AC, 0xBFD14488,
+	0x63766CD9, 0x4DAA7EFD, 0x3ECE4891, 0x10125AB5, 0xD8062449, 0xF6DA366D, 0x85BE0001, 0xAB621225,
+	0x984F4E9C, 0xB6935CB8, 0xC5F76AD4, 0xEB2B78F0, 0x233F060C, 0x0DE31428, 0x7E872244, 0x505B3060,
+	0x18DD9B36, 0x36018912, 0x4565BF7E, 0x6BB9AD5A, 0xA3ADD3A6, 0x8D71C182, 0xFE15F7EE, 0xD0C9E5CA,
+	0xE3E4B973, 0xCD38AB57, 0xBE5C9D3B, 0x90808F1F, 0x5894F1E3, 0x7648E3C7, 0x052CD5AB, 0x2BF0C78F,
+	0x94218307, 0xBAFD9123, 0xC999A74F, 0xE745B56B, 0x2F51CB97, 0x018DD9B3, 0x72E9EFDF, 0x5C35FDFB,
+	0x6F18A142, 0x41C4B366, 0x32A0850A, 0x1C7C972E, 0xD468E9D2, 0xFAB4FBF6, 0x89D0CD9A, 0xA70CDFBE,
+	0xEF8A74E8, 0xC15666CC, 0xB23250A0, 0x9CEE4284, 0x54FA3C78, 0x7A262E5C, 0x09421830, 0x279E0A14,
+	0x14B356AD, 0x3A6F4489, 0x490B72E5, 0x67D760C1, 0xAFC31E3D, 0x811F0C19, 0xF27B3A75, 0xDCA72851,
+	0xC6ECD9B2, 0xE830CB96, 0x9B54FDFA, 0xB588EFDE, 0x7D9C9122, 0x53408306, 0x2024B56A, 0x0EF8A74E,
+	0x3DD5FBF7, 0x1309E9D3, 0x606DDFBF, 0x4EB1CD9B, 0x86A5B367, 0xA879A143, 0xDB1D972F, 0xF5C1850B,
+	0xBD472E5D, 0x939B3C79, 0xE0FF0A15, 0xCE231831, 0x063766CD, 0x28EB74E9, 0x5B8F4285, 0x755350A1,
+	0x467E0C18, 0x68A21E3C, 0x1BC62850, 0x351A3A74, 0xFD0E4488, 0xD3D256AC, 0xA0B660C0, 0x8E6A72E4,
+	0x31BB366C, 0x1F672448, 0x6C031224, 0x42DF0000, 0x8ACB7EFC, 0xA4176CD8, 0xD7735AB4, 0xF9AF4890,
+	0xCA821429, 0xE45E060D, 0x973A3061, 0xB9E62245, 0x71F25CB9, 0x5F2E4E9D, 0x2C4A78F1, 0x02966AD5,
+	0x4A10C183, 0x64CCD3A7, 0x17A8E5CB, 0x3974F7EF, 0xF1608913, 0xDFBC9B37, 0xACD8AD5B, 0x8204BF7F,
+	0xB129E3C6, 0x9FF5F1E2, 0xEC91C78E, 0xC24DD5AA, 0x0A59AB56, 0x2485B972, 0x57E18F1E, 0x793D9D3A,
+	0xA59AB56B, 0x8B46A74F, 0xF8229123, 0xD6FE8307, 0x1EEAFDFB, 0x3036EFDF, 0x4352D9B3, 0x6D8ECB97,
+	0x5EA3972E, 0x707F850A, 0x031BB366, 0x2DC7A142, 0xE5D3DFBE, 0xCB0FCD9A, 0xB86BFBF6, 0x96B7E9D2,
+	0xDE314284, 0xF0ED50A0, 0x838966CC, 0xAD5574E8, 0x65410A14, 0x4B9D1830, 0x38F92E5C, 0x16253C78,
+	0x250860C1, 0x0BD472E5, 0x78B04489, 0x566C56AD, 0x9E782851, 0xB0A43A75, 0xC3C00C19, 0xED1C1E3D,
+	0x52CD5AB5, 0x7C114891, 0x0F757EFD, 0x21A96CD9, 0xE9BD1225, 0xC7610001, 0xB405366D, 0x9AD92449,
+	0xA9F478F0, 0x87286AD4, 0xF44C5CB8, 0xDA904E9C, 0x12843060, 0x3C582244, 0x4F3C1428, 0x61E0060C,
+	0x2966AD5A, 0x07BABF7E, 0x74DE8912, 0x5A029B36, 0x9216E5CA, 0xBCCAF7EE, 0xCFAEC182, 0xE172D3A6,
+	0xD25F8F1F, 0xFC839D3B, 0x8FE7AB57, 0xA13BB973, 0x692FC78F, 0x47F3D5AB, 0x3497E3C7, 0x1A4BF1E3,
+	// Seed 0x3B
+	0x00000000, 0x0A72A940, 0x14E55280, 0x1E97FBC0, 0x29CAA500, 0x23B80C40, 0x3D2FF780, 0x375D5EC0,
+	0x53954A00, 0x59E7E340, 0x47701880, 0x4D02B1C0, 0x7A5FEF00, 0x702D4640, 0x6EBABD80, 0x64C814C0,
+	0xA72A9400, 0xAD583D40, 0xB3CFC680, 0xB9BD6FC0, 0x8EE03100, 0x84929840, 0x9A056380, 0x9077CAC0,
+	0xF4BFDE00, 0xFECD7740, 0xE05A8C80, 0xEA2825C0, 0xDD757B00, 0xD707D240, 0xC9902980, 0xC3E280C0,
+	0x2C42FA49, 0x26305309, 0x38A7A8C9, 0x32D50189, 0x05885F49, 0x0FFAF609, 0x116D0DC9, 0x1B1FA489,
+	0x7FD7B049, 0x75A51909, 0x6B32E2C9, 0x61404B89, 0x561D1549, 0x5C6FBC09, 0x42F847C9, 0x488AEE89,
+	0x8B686E49, 0x811AC709, 0x9F8D3CC9, 0x95FF9589, 0xA2A2CB49, 0xA8D06209, 0xB64799C9, 0xBC353089,
+	0xD8FD2449, 0xD28F8D09, 0xCC1876C9, 0xC66ADF89, 0xF1378149, 0xFB452809, 0xE5D2D3C9, 0xEFA07A89,
+	0x5885F492, 0x52F75DD2, 0x4C60A612, 0x46120F52, 0x714F5192, 0x7B3DF8D2, 0x65AA0312, 0x6FD8AA52,
+	0x0B10BE92, 0x016217D2, 0x1FF5EC12, 0x15874552, 0x22DA1B92, 0x28A8B2D2, 0x363F4912, 0x3C4DE052,
+	0xFFAF6092, 0xF5DDC9D2, 0xEB4A3212, 0xE1389B52, 0xD665C592, 0xDC176CD2, 0xC2809712, 0xC8F23E52,
+	0xAC3A2A92, 0xA64883D2, 0xB8DF7812, 0xB2ADD152, 0x85F08F92, 0x8F8226D2, 0x9115DD12, 0x9B677452,
+	0x74C70EDB, 0x7EB5A79B, 0x60225C5B, 0x6A50F51B, 0x5D0DABDB, 0x577F029B, 0x49E8F95B, 0x439A501B,
+	0x275244DB, 0x2D20ED9B, 0x33B7165B, 0x39C5BF1B, 0x0E98E1DB, 0x04EA489B, 0x1A7DB35B, 0x100F1A1B,
+	0xD3ED9ADB, 0xD99F339B, 0xC708C85B, 0xCD7A611B, 0xFA273FDB, 0xF055969B, 0xEEC26D5B, 0xE4B0C41B,
+	0x8078D0DB, 0x8A0A799B, 0x949D825B, 0x9EEF2B1B, 0xA9B275DB, 0xA3C0DC9B, 0xBD57275B, 0xB7258E1B,
+	0xB10BE924, 0xBB794064, 0xA5EEBBA4, 0xAF9C12E4, 0x98C14C24, 0x92B3E564, 0x8C241EA4, 0x8656B7E4,
+	0xE29EA324, 0xE8EC0A64, 0xF67BF1A4, 0xFC0958E4, 0xCB540624, 0xC126AF64, 0xDFB154A4, 0xD5C3FDE4,
+	0x16217D24, 0x1C53D464, 0x02C42FA4, 0x08B686E4, 0x3FEBD824, 0x35997164, 0x2B0E8AA4, 0x217C23E4,
+	0x45B43724, 0x4FC69E64, 0x515165A4, 0x5B23CCE4, 0x6C7E9224, 0x660C3B64, 0x789BC0A4, 0x72E969E4,
+	0x9D49136D, 0x973BBA2D, 0x89AC41ED, 0x83DEE8AD, 0xB483B66D, 0xBEF11F2D, 0xA066E4ED, 0xAA144DAD,
+	0xCEDC596D, 0xC4AEF02D, 0xDA390BED, 0xD04BA2AD, 0xE716FC6D, 0xED64552D, 0xF3F3AEED, 0xF98107AD,
+	0x3A63876D, 0x30112E2D, 0x2E86D5ED, 0x24F47CAD, 0x13A9226D, 0x19DB8B2D, 0x074C70ED, 0x0D3ED9AD,
+	0x69F6CD6D, 0x6384642D, 0x7D139FED, 0x776136AD, 0x403C686D, 0x4A4EC12D, 0x54D93AED, 0x5EAB93AD,
+	0xE98E1DB6, 0xE3FCB4F6, 0xFD6B4F36, 0xF719E676, 0xC044B8B6, 0xCA3611F6, 0xD4A1EA36, 0xDED34376,
+	0xBA1B57B6, 0xB069FEF6, 0xAEFE0536, 0xA48CAC76, 0x93D1F2B6, 0x99A35BF6, 0x8734A036, 0x8D460976,
+	0x4EA489B6, 0x44D620F6, 0x5A41DB36, 0x50337276, 0x676E2CB6, 0x6D1C85F6, 0x738B7E36, 0x79F9D776,
+	0x1D31C3B6, 0x17436AF6, 0x09D49136, 0x03A63876, 0x34FB66B6, 0x3E89CFF6, 0x201E3436, 0x2A6C9D76,
+	0xC5CCE7FF, 0xCFBE4EBF, 0xD129B57F, 0xDB5B1C3F, 0xEC0642FF, 0xE674EBBF, 0xF8E3107F, 0xF291B93F,
+	0x9659ADFF, 0x9C2B04BF, 0x82BCFF7F, 0x88CE563F, 0xBF9308FF, 0xB5E1A1BF, 0xAB765A7F, 0xA104F33F,
+	0x62E673FF, 0x6894DABF, 0x7603217F, 0x7C71883F, 0x4B2CD6FF, 0x415E7FBF, 0x5FC9847F, 0x55BB2D3F,
+	0x317339FF, 0x3B0190BF, 0x25966B7F, 0x2FE4C23F, 0x18B99CFF, 0x12CB35BF, 0x0C5CCE7F, 0x062E673F,
+	// Seed 0x3C
+	0x00000000, 0x0ED553BA, 0x1DAAA774, 0x137FF4CE, 0x3B554EE8, 0x35801D52, 0x26FFE99C, 0x282ABA26,
+	0x287464DF, 0x26A13765, 0x35DEC3AB, 0x3B0B9011, 0x13212A37, 0x1DF4798D, 0x0E8B8D43, 0x005EDEF9,
+	0x0E3630B1, 0x00E3630B, 0x139C97C5, 0x1D49C47F, 0x35637E59, 0x3BB62DE3, 0x28C9D92D, 0x261C8A97,
+	0x2642546E, 0x289707D4, 0x3BE8F31A, 0x353DA0A0, 0x1D171A86, 0x13C2493C, 0x00BDBDF2, 0x0E68EE48,
+	0x1C6C6162, 0x12B932D8, 0x01C6C616, 0x0F1395AC, 0x27392F8A, 0x29EC7C30, 0x3A9388FE, 0x3446DB44,
+	0x341805BD, 0x3ACD5607, 0x29B2A2C9, 0x2767F173, 0x0F4D4B55, 0x019818EF, 0x12E7EC21, 0x1C32BF9B,
+	0x125A51D3, 0x1C8F0269, 0x0FF0F6A7, 0x0125A51D, 0x290F1F3B, 0x27DA4C81, 0x34A5B84F, 0x3A70EBF5,
+	0x3A2E350C, 0x34FB66B6, 0x27849278, 0x2951C1C2, 0x017B7BE4, 0x0FAE285E, 0x1CD1DC90, 0x12048F2A,
+	0x38D8C2C4, 0x360D917E, 0x257265B0, 0x2BA7360A, 0x038D8C2C, 0x0D58DF96, 0x1E272B58, 0x10F278E2,
+	0x10ACA61B, 0x1E79F5A1, 0x0D06016F, 0x03D352D5, 0x2BF9E8F3, 0x252CBB49, 0x36534F87, 0x38861C3D,
+	0x36EEF275, 0x383BA1CF, 0x2B445501, 0x259106BB, 0x0DBBBC9D, 0x036EEF27, 0x10111BE9, 0x1EC44853,
+	0x1E9A96AA, 0x104FC510, 0x033031DE, 0x0DE56264, 0x25CFD842, 0x2B1A8BF8, 0x38657F36, 0x36B02C8C,
+	0x24B4A3A6, 0x2A61F01C, 0x391E04D2, 0x37CB5768, 0x1FE1ED4E, 0x1134BEF4, 0x024B4A3A, 0x0C9E1980,
+	0x0CC0C779, 0x021594C3, 0x116A600D, 0x1FBF33B7, 0x37958991, 0x3940DA2B, 0x2A3F2EE5, 0x24EA7D5F,
+	0x2A829317, 0x2457C0AD, 0x37283463, 0x39FD67D9, 0x11D7DDFF, 0x1F028E45, 0x0C7D7A8B, 0x02A82931,
+	0x02F6F7C8, 0x0C23A472, 0x1F5C50BC, 0x11890306, 0x39A3B920, 0x3776EA9A, 0x24091E54, 0x2ADC4DEE,
+	0x2F6F7C87, 0x21BA2F3D, 0x32C5DBF3, 0x3C108849, 0x143A326F, 0x1AEF61D5, 0x0990951B, 0x0745C6A1,
+	0x071B1858, 0x09CE4BE2, 0x1AB1BF2C, 0x1464EC96, 0x3C4E56B0, 0x329B050A, 0x21E4F1C4, 0x2F31A27E,
+	0x21594C36, 0x2F8C1F8C, 0x3CF3EB42, 0x3226B8F8, 0x1A0C02DE, 0x14D95164, 0x07A6A5AA, 0x0973F610,
+	0x092D28E9, 0x07F87B53, 0x14878F9D, 0x1A52DC27, 0x32786601, 0x3CAD35BB, 0x2FD2C175, 0x210792CF,
+	0x33031DE5, 0x3DD64E5F, 0x2EA9BA91, 0x207CE92B, 0x0856530D, 0x068300B7, 0x15FCF479, 0x1B29A7C3,
+	0x1B77793A, 0x15A22A80, 0x06DDDE4E, 0x08088DF4, 0x202237D2, 0x2EF76468, 0x3D8890A6, 0x335DC31C,
+	0x3D352D54, 0x33E07EEE, 0x209F8A20, 0x2E4AD99A, 0x066063BC, 0x08B53006, 0x1BCAC4C8, 0x151F9772,
+	0x1541498B, 0x1B941A31, 0x08EBEEFF, 0x063EBD45, 0x2E140763, 0x20C154D9, 0x33BEA017, 0x3D6BF3AD,
+	0x17B7BE43, 0x1962EDF9, 0x0A1D1937, 0x04C84A8D, 0x2CE2F0AB, 0x2237A311, 0x314857DF, 0x3F9D0465,
+	0x3FC3DA9C, 0x31168926, 0x22697DE8, 0x2CBC2E52, 0x04969474, 0x0A43C7CE, 0x193C3300, 0x17E960BA,
+	0x19818EF2, 0x1754DD48, 0x042B2986, 0x0AFE7A3C, 0x22D4C01A, 0x2C0193A0, 0x3F7E676E, 0x31AB34D4,
+	0x31F5EA2D, 0x3F20B997, 0x2C5F4D59, 0x228A1EE3, 0x0AA0A4C5, 0x0475F77F, 0x170A03B1, 0x19DF500B,
+	0x0BDBDF21, 0x050E8C9B, 0x16717855, 0x18A42BEF, 0x308E91C9, 0x3E5BC273, 0x2D2436BD, 0x23F16507,
+	0x23AFBBFE, 0x2D7AE844, 0x3E051C8A, 0x30D04F30, 0x18FAF516, 0x162FA6AC, 0x05505262, 0x0B8501D8,
+	0x05EDEF90, 0x0B38BC2A, 0x184748E4, 0x16921B5E, 0x3EB8A178, 0x306DF2C2, 0x2312060C, 0x2DC755B6,
+	0x2D998B4F, 0x234CD8F5, 0x30332C3B, 0x3EE67F81, 0x16CCC5A7, 0x1819961D, 0x0B6662D3, 0x05B33169,
+	// Seed 0x3D
+	0x00000000, 0x21AD9883, 0x435B3106, 0x62F6A985, 0x3666FA2F, 0x17CB62AC, 0x753DCB29, 0x549053AA,
+	0x6CCDF45E, 0x4D606CDD, 0x2F96C558, 0x0E3B5DDB, 0x5AAB0E71, 0x7B0696F2, 0x19F03F77, 0x385DA7F4,
+	0x694B709F, 0x48E6E81C, 0x2A104199, 0x0BBDD91A, 0x5F2D8AB0, 0x7E801233, 0x1C76BBB6, 0x3DDB2335,
+	0x058684C1, 0x242B1C42, 0x46DDB5C7, 0x67702D44, 0x33E07EEE, 0x124DE66D, 0x70BB4FE8, 0x5116D76B,
+	0x6246791D, 0x43EBE19E, 0x211D481B, 0x00B0D098, 0x54208332, 0x758D1BB1, 0x177BB234, 0x36D62AB7,
+	0x0E8B8D43, 0x2F2615C0, 0x4DD0BC45, 0x6C7D24C6, 0x38ED776C, 0x1940EFEF, 0x7BB6466A, 0x5A1BDEE9,
+	0x0B0D0982, 0x2AA09101, 0x48563884, 0x69FBA007, 0x3D6BF3AD, 0x1CC66B2E, 0x7E30C2AB, 0x5F9D5A28,
+	0x67C0FDDC, 0x466D655F, 0x249BCCDA, 0x05365459, 0x51A607F3, 0x700B9F70, 0x12FD36F5, 0x3350AE76,
+	0x745C6A19, 0x55F1F29A, 0x37075B1F, 0x16AAC39C, 0x423A9036, 0x639708B5, 0x0161A130, 0x20CC39B3,
+	0x18919E47, 0x393C06C4, 0x5BCAAF41, 0x7A6737C2, 0x2EF76468, 0x0F5AFCEB, 0x6DAC556E, 0x4C01CDED,
+	0x1D171A86, 0x3CBA8205, 0x5E4C2B80, 0x7FE1B303, 0x2B71E0A9, 0x0ADC782A, 0x682AD1AF, 0x4987492C,
+	0x71DAEED8, 0x5077765B, 0x3281DFDE, 0x132C475D, 0x47BC14F7, 0x66118C74, 0x04E725F1, 0x254ABD72,
+	0x161A1304, 0x37B78B87, 0x55412202, 0x74ECBA81, 0x207CE92B, 0x01D171A8, 0x6327D82D, 0x428A40AE,
+	0x7AD7E75A, 0x5B7A7FD9, 0x398CD65C, 0x18214EDF, 0x4CB11D75, 0x6D1C85F6, 0x0FEA2C73, 0x2E47B4F0,
+	0x7F51639B, 0x5EFCFB18, 0x3C0A529D, 0x1DA7CA1E, 0x493799B4, 0x689A0137, 0x0A6CA8B2, 0x2BC13031,
+	0x139C97C5, 0x32310F46, 0x50C7A6C3, 0x716A3E40, 0x25FA6DEA, 0x0457F569, 0x66A15CEC, 0x470CC46F,
+	0x58684C11, 0x79C5D492, 0x1B337D17, 0x3A9EE594, 0x6E0EB63E, 0x4FA32EBD, 0x2D558738, 0x0CF81FBB,
+	0x34A5B84F, 0x150820CC, 0x77FE8949, 0x565311CA, 0x02C34260, 0x236EDAE3, 0x41987366, 0x6035EBE5,
+	0x31233C8E, 0x108EA40D, 0x72780D88, 0x53D5950B, 0x0745C6A1, 0x26E85E22, 0x441EF7A7, 0x65B36F24,
+	0x5DEEC8D0, 0x7C435053, 0x1EB5F9D6, 0x3F186155, 0x6B8832FF, 0x4A25AA7C, 0x28D303F9, 0x097E9B7A,
+	0x3A2E350C, 0x1B83AD8F, 0x7975040A, 0x58D89C89, 0x0C48CF23, 0x2DE557A0, 0x4F13FE25, 0x6EBE66A6,
+	0x56E3C152, 0x774E59D1, 0x15B8F054, 0x341568D7, 0x60853B7D, 0x4128A3FE, 0x23DE0A7B, 0x027392F8,
+	0x53654593, 0x72C8DD10, 0x103E7495, 0x3193EC16, 0x6503BFBC, 0x44AE273F, 0x26588EBA, 0x07F51639,
+	0x3FA8B1CD, 0x1E05294E, 0x7CF380CB, 0x5D5E1848, 0x09CE4BE2, 0x2863D361, 0x4A957AE4, 0x6B38E267,
+	0x2C342608, 0x0D99BE8B, 0x6F6F170E, 0x4EC28F8D, 0x1A52DC27, 0x3BFF44A4, 0x5909ED21, 0x78A475A2,
+	0x40F9D256, 0x61544AD5, 0x03A2E350, 0x220F7BD3, 0x769F2879, 0x5732B0FA, 0x35C4197F, 0x146981FC,
+	0x457F5697, 0x64D2CE14, 0x06246791, 0x2789FF12, 0x7319ACB8, 0x52B4343B, 0x30429DBE, 0x11EF053D,
+	0x29B2A2C9, 0x081F3A4A, 0x6AE993CF, 0x4B440B4C, 0x1FD458E6, 0x3E79C065, 0x5C8F69E0, 0x7D22F163,
+	0x4E725F15, 0x6FDFC796, 0x0D296E13, 0x2C84F690, 0x7814A53A, 0x59B93DB9, 0x3B4F943C, 0x1AE20CBF,
+	0x22BFAB4B, 0x031233C8, 0x61E49A4D, 0x404902CE, 0x14D95164, 0x3574C9E7, 0x57826062, 0x762FF8E1,
+	0x27392F8A, 0x0694B709, 0x64621E8C, 0x45CF860F, 0x115FD5A5, 0x30F24D26, 0x5204E4A3, 0x73A97C20,
+	0x4BF4DBD4, 0x6A594357, 0x08AFEAD2, 0x29027251, 0x7D9221FB, 0x5C3FB978, 0x3EC910FD, 0x1F64887E,
+	// Seed 0x3E
+	0x00000000, 0xAF40C4E9, 0xDC43B285, 0x7303766C, 0x3A455E5D, 0x95059AB4, 0xE606ECD8, 0x49462831,
+	0x748ABCBA, 0xDBCA7853, 0xA8C90E3F, 0x0789CAD6, 0x4ECFE2E7, 0xE18F260E, 0x928C5062, 0x3DCC948B,
+	0xE9157974, 0x4655BD9D, 0x3556CBF1, 0x9A160F18, 0xD3502729, 0x7C10E3C0, 0x0F1395AC, 0xA0535145,
+	0x9D9FC5CE, 0x32DF0127, 0x41DC774B, 0xEE9CB3A2, 0xA7DA9B93, 0x089A5F7A, 0x7B992916, 0xD4D9EDFF,
+	0x50E8C9BF, 0xFFA80D56, 0x8CAB7B3A, 0x23EBBFD3, 0x6AAD97E2, 0xC5ED530B, 0xB6EE2567, 0x19AEE18E,
+	0x24627505, 0x8B22B1EC, 0xF821C780, 0x57610369, 0x1E272B58, 0xB167EFB1, 0xC26499DD, 0x6D245D34,
+	0xB9FDB0CB, 0x16BD7422, 0x65BE024E, 0xCAFEC6A7, 0x83B8EE96, 0x2CF82A7F, 0x5FFB5C13, 0xF0BB98FA,
+	0xCD770C71, 0x6237C898, 0x1134BEF4, 0xBE747A1D, 0xF732522C, 0x587296C5, 0x2B71E0A9, 0x84312440,
+	0xA1D1937E, 0x0E915797, 0x7D9221FB, 0xD2D2E512, 0x9B94CD23, 0x34D409CA, 0x47D77FA6, 0xE897BB4F,
+	0xD55B2FC4, 0x7A1BEB2D, 0x09189D41, 0xA65859A8, 0xEF1E7199, 0x405EB570, 0x335DC31C, 0x9C1D07F5,
+	0x48C4EA0A, 0xE7842EE3, 0x9487588F, 0x3BC79C66, 0x7281B457, 0xDDC170BE, 0xAEC206D2, 0x0182C23B,
+	0x3C4E56B0, 0x930E9259, 0xE00DE435, 0x4F4D20DC, 0x060B08ED, 0xA94BCC04, 0xDA48BA68, 0x75087E81,
+	0xF1395AC1, 0x5E799E28, 0x2D7AE844, 0x823A2CAD, 0xCB7C049C, 0x643CC075, 0x173FB619, 0xB87F72F0,
+	0x85B3E67B, 0x2AF32292, 0x59F054FE, 0xF6B09017, 0xBFF6B826, 0x10B67CCF, 0x63B50AA3, 0xCCF5CE4A,
+	0x182C23B5, 0xB76CE75C, 0xC46F9130, 0x6B2F55D9, 0x22697DE8, 0x8D29B901, 0xFE2ACF6D, 0x516A0B84,
+	0x6CA69F0F, 0xC3E65BE6, 0xB0E52D8A, 0x1FA5E963, 0x56E3C152, 0xF9A305BB, 0x8AA073D7, 0x25E0B73E,
+	0xC1611DAB, 0x6E21D942, 0x1D22AF2E, 0xB2626BC7, 0xFB2443F6, 0x5464871F, 0x2767F173, 0x8827359A,
+	0xB5EBA111, 0x1AAB65F8, 0x69A81394, 0xC6E8D77D, 0x8FAEFF4C, 0x20EE3BA5, 0x53ED4DC9, 0xFCAD8920,
+	0x287464DF, 0x8734A036, 0xF437D65A, 0x5B7712B3, 0x12313A82, 0xBD71FE6B, 0xCE728807, 0x61324CEE,
+	0x5CFED865, 0xF3BE1C8C, 0x80BD6AE0, 0x2FFDAE09, 0x66BB8638, 0xC9FB42D1, 0xBAF834BD, 0x15B8F054,
+	0x9189D414, 0x3EC910FD, 0x4DCA6691, 0xE28AA278, 0xABCC8A49, 0x048C4EA0, 0x778F38CC, 0xD8CFFC25,
+	0xE50368AE, 0x4A43AC47, 0x3940DA2B, 0x96001EC2, 0xDF4636F3, 0x7006F21A, 0x03058476, 0xAC45409F,
+	0x789CAD60, 0xD7DC6989, 0xA4DF1FE5, 0x0B9FDB0C, 0x42D9F33D, 0xED9937D4, 0x9E9A41B8, 0x31DA8551,
+	0x0C1611DA, 0xA356D533, 0xD055A35F, 0x7F1567B6, 0x36534F87, 0x99138B6E, 0xEA10FD02, 0x455039EB,
+	0x60B08ED5, 0xCFF04A3C, 0xBCF33C50, 0x13B3F8B9, 0x5AF5D088, 0xF5B51461, 0x86B6620D, 0x29F6A6E4,
+	0x143A326F, 0xBB7AF686, 0xC87980EA, 0x67394403, 0x2E7F6C32, 0x813FA8DB, 0xF23CDEB7, 0x5D7C1A5E,
+	0x89A5F7A1, 0x26E53348, 0x55E64524, 0xFAA681CD, 0xB3E0A9FC, 0x1CA06D15, 0x6FA31B79, 0xC0E3DF90,
+	0xFD2F4B1B, 0x526F8FF2, 0x216CF99E, 0x8E2C3D77, 0xC76A1546, 0x682AD1AF, 0x1B29A7C3, 0xB469632A,
+	0x3058476A, 0x9F188383, 0xEC1BF5EF, 0x435B3106, 0x0A1D1937, 0xA55DDDDE, 0xD65EABB2, 0x791E6F5B,
+	0x44D2FBD0, 0xEB923F39, 0x98914955, 0x37D18DBC, 0x7E97A58D, 0xD1D76164, 0xA2D41708, 0x0D94D3E1,
+	0xD94D3E1E, 0x760DFAF7, 0x050E8C9B, 0xAA4E4872, 0xE3086043, 0x4C48A4AA, 0x3F4BD2C6, 0x900B162F,
+	0xADC782A4, 0x0287464D, 0x71843021, 0xDEC4F4C8, 0x9782DCF9, 0x38C21810, 0x4BC16E7C, 0xE481AA95,
+	// Seed 0x3F
+	0x00000000, 0x2B9FEEC8, 0x573FDD90, 0x7CA03358, 0xAE7FBB20, 0x85E055E8, 0xF94066B0, 0xD2DF8878,
+	0x30332C3B, 0x1BACC2F3, 0x670CF1AB, 0x4C931F63, 0x9E4C971B, 0xB5D379D3, 0xC9734A8B, 0xE2ECA443,
+	0x60665876, 0x4BF9B6BE, 0x375985E6, 0x1CC66B2E, 0xCE19E356, 0xE5860D9E, 0x99263EC6, 0xB2B9D00E,
+	0x5055744D, 0x7BCA9A85, 0x076AA9DD, 0x2CF54715, 0xFE2ACF6D, 0xD5B521A5, 0xA91512FD, 0x828AFC35,
+	0xC0CCB0EC, 0xEB535E24, 0x97F36D7C, 0xBC6C83B4, 0x6EB30BCC, 0x452CE504, 0x398CD65C, 0x12133894,
+	0xF0FF9CD7, 0xDB60721F, 0xA7C04147, 0x8C5FAF8F, 0x5E8027F7, 0x751FC93F, 0x09BFFA67, 0x222014AF,
+	0xA0AAE89A, 0x8B350652, 0xF795350A, 0xDC0ADBC2, 0x0ED553BA, 0x254ABD72, 0x59EA8E2A, 0x727560E2,
+	0x9099C4A1, 0xBB062A69, 0xC7A61931, 0xEC39F7F9, 0x3EE67F81, 0x15799149, 0x69D9A211, 0x42464CD9,
+	0xED553BA3, 0xC6CAD56B, 0xBA6AE633, 0x91F508FB, 0x432A8083, 0x68B56E4B, 0x14155D13, 0x3F8AB3DB,
+	0xDD661798, 0xF6F9F950, 0x8A59CA08, 0xA1C624C0, 0x7319ACB8, 0x58864270, 0x24267128, 0x0FB99FE0,
+	0x8D3363D5, 0xA6AC8D1D, 0xDA0CBE45, 0xF193508D, 0x234CD8F5, 0x08D3363D, 0x74730565, 0x5FECEBAD,
+	0xBD004FEE, 0x969FA126, 0xEA3F927E, 0xC1A07CB6, 0x137FF4CE, 0x38E01A06, 0x4440295E, 0x6FDFC796,
+	0x2D998B4F, 0x06066587, 0x7AA656DF, 0x5139B817, 0x83E6306F, 0xA879DEA7, 0xD4D9EDFF, 0xFF460337,
+	0x1DAAA774, 0x363549BC, 0x4A957AE4, 0x610A942C, 0xB3D51C54, 0x984AF29C, 0xE4EAC1C4, 0xCF752F0C,
+	0x4DFFD339, 0x66603DF1, 0x1AC00EA9, 0x315FE061, 0xE3806819, 0xC81F86D1, 0xB4BFB589, 0x9F205B41,
+	0x7DCCFF02, 0x565311CA, 0x2AF32292, 0x016CCC5A, 0xD3B34422, 0xF82CAAEA, 0x848C99B2, 0xAF13777A,
+	0xB6662D3D, 0x9DF9C3F5, 0xE159F0AD, 0xCAC61E65, 0x1819961D, 0x338678D5, 0x4F264B8D, 0x64B9A545,
+	0x86550106, 0xADCAEFCE, 0xD16ADC96, 0xFAF5325E, 0x282ABA26, 0x03B554EE, 0x7F1567B6, 0x548A897E,
+	0xD600754B, 0xFD9F9B83, 0x813FA8DB, 0xAAA04613, 0x787FCE6B, 0x53E020A3, 0x2F4013FB, 0x04DFFD33,
+	0xE6335970, 0xCDACB7B8, 0xB10C84E0, 0x9A936A28, 0x484CE250, 0x63D30C98, 0x1F733FC0, 0x34ECD108,
+	0x76AA9DD1, 0x5D357319, 0x21954041, 0x0A0AAE89, 0xD8D526F1, 0xF34AC839, 0x8FEAFB61, 0xA47515A9,
+	0x4699B1EA, 0x6D065F22, 0x11A66C7A, 0x3A3982B2, 0xE8E60ACA, 0xC379E402, 0xBFD9D75A, 0x94463992,
+	0x16CCC5A7, 0x3D532B6F, 0x41F31837, 0x6A6CF6FF, 0xB8B37E87, 0x932C904F, 0xEF8CA317, 0xC4134DDF,
+	0x26FFE99C, 0x0D600754, 0x71C0340C, 0x5A5FDAC4, 0x888052BC, 0xA31FBC74, 0xDFBF8F2C, 0xF42061E4,
+	0x5B33169E, 0x70ACF856, 0x0C0CCB0E, 0x279325C6, 0xF54CADBE, 0xDED34376, 0xA273702E, 0x89EC9EE6,
+	0x6B003AA5, 0x409FD46D, 0x3C3FE735, 0x17A009FD, 0xC57F8185, 0xEEE06F4D, 0x92405C15, 0xB9DFB2DD,
+	0x3B554EE8, 0x10CAA020, 0x6C6A9378, 0x47F57DB0, 0x952AF5C8, 0xBEB51B00, 0xC2152858, 0xE98AC690,
+	0x0B6662D3, 0x20F98C1B, 0x5C59BF43, 0x77C6518B, 0xA519D9F3, 0x8E86373B, 0xF2260463, 0xD9B9EAAB,
+	0x9BFFA672, 0xB06048BA, 0xCCC07BE2, 0xE75F952A, 0x35801D52, 0x1E1FF39A, 0x62BFC0C2, 0x49202E0A,
+	0xABCC8A49, 0x80536481, 0xFCF357D9, 0xD76CB911, 0x05B33169, 0x2E2CDFA1, 0x528CECF9, 0x79130231,
+	0xFB99FE04, 0xD00610CC, 0xACA62394, 0x8739CD5C, 0x55E64524, 0x7E79ABEC, 0x02D998B4, 0x2946767C,
+	0xCBAAD23F, 0xE0353CF7, 0x9C950FAF, 0xB70AE167, 0x65D5691F, 0x4E4A87D7, 0x32EAB48F, 0x19755A47,
+	// Seed 0x40
+	0x00000000, 0x1D5AA8E7, 0x3AB551CE, 0x27EFF929, 0x756AA39C, 0x68300B7B, 0x4FDFF252, 0x52855AB5,
+	0x076DC419, 0x1A376CFE, 0x3DD895D7, 0x20823D30, 0x72076785, 0x6F5DCF62, 0x48B2364B, 0x55E89EAC,
+	0x0EDB8832, 0x138120D5, 0x346ED9FC, 0x2934711B, 0x7BB12BAE, 0x66EB8349, 0x41047A60, 0x5C5ED287,
+	0x09B64C2B, 0x14ECE4CC, 0x33031DE5, 0x2E59B502, 0x7CDCEFB7, 0x61864750, 0x4669BE79, 0x5B33169E,
+	0x1DB71064, 0x00EDB883, 0x270241AA, 0x3A58E94D, 0x68DDB3F8, 0x75871B1F, 0x5268E236, 0x4F324AD1,
+	0x1ADAD47D, 0x07807C9A, 0x206F85B3, 0x3D352D54, 0x6FB077E1, 0x72EADF06, 0x5505262F, 0x485F8EC8,
+	0x136C9856, 0x0E3630B1, 0x29D9C998, 0x3483617F, 0x66063BCA, 0x7B5C932D, 0x5CB36A04, 0x41E9C2E3,
+	0x14015C4F, 0x095BF4A8, 0x2EB40D81, 0x33EEA566, 0x616BFFD3, 0x7C315734, 0x5BDEAE1D, 0x468406FA,
+	0x3B6E20C8, 0x2634882F, 0x01DB7106, 0x1C81D9E1, 0x4E048354, 0x535E2BB3, 0x74B1D29A, 0x69EB7A7D,
+	0x3C03E4D1, 0x21594C36, 0x06B6B51F, 0x1BEC1DF8, 0x4969474D, 0x5433EFAA, 0x73DC1683, 0x6E86BE64,
+	0x35B5A8FA, 0x28EF001D, 0x0F00F934, 0x125A51D3, 0x40DF0B66, 0x5D85A381, 0x7A6A5AA8, 0x6730F24F,
+	0x32D86CE3, 0x2F82C404, 0x086D3D2D, 0x153795CA, 0x47B2CF7F, 0x5AE86798, 0x7D079EB1, 0x605D3656,
+	0x26D930AC, 0x3B83984B, 0x1C6C6162, 0x0136C985, 0x53B39330, 0x4EE93BD7, 0x6906C2FE, 0x745C6A19,
+	0x21B4F4B5, 0x3CEE5C52, 0x1B01A57B, 0x065B0D9C, 0x54DE5729, 0x4984FFCE, 0x6E6B06E7, 0x7331AE00,
+	0x2802B89E, 0x35581079, 0x12B7E950, 0x0FED41B7, 0x5D681B02, 0x4032B3E5, 0x67DD4ACC, 0x7A87E22B,
+	0x2F6F7C87, 0x3235D460, 0x15DA2D49, 0x088085AE, 0x5A05DF1B, 0x475F77FC, 0x60B08ED5, 0x7DEA2632,
+	0x76DC4190, 0x6B86E977, 0x4C69105E, 0x5133B8B9, 0x03B6E20C, 0x1EEC4AEB, 0x3903B3C2, 0x24591B25,
+	0x71B18589, 0x6CEB2D6E, 0x4B04D447, 0x565E7CA0, 0x04DB2615, 0x19818EF2, 0x3E6E77DB, 0x2334DF3C,
+	0x7807C9A2, 0x655D6145, 0x42B2986C, 0x5FE8308B, 0x0D6D6A3E, 0x1037C2D9, 0x37D83BF0, 0x2A829317,
+	0x7F6A0DBB, 0x6230A55C, 0x45DF5C75, 0x5885F492, 0x0A00AE27, 0x175A06C0, 0x30B5FFE9, 0x2DEF570E,
+	0x6B6B51F4, 0x7631F913, 0x51DE003A, 0x4C84A8DD, 0x1E01F268, 0x035B5A8F, 0x24B4A3A6, 0x39EE0B41,
+	0x6C0695ED, 0x715C3D0A, 0x56B3C423, 0x4BE96CC4, 0x196C3671, 0x04369E96, 0x23D967BF, 0x3E83CF58,
+	0x65B0D9C6, 0x78EA7121, 0x5F058808, 0x425F20EF, 0x10DA7A5A, 0x0D80D2BD, 0x2A6F2B94, 0x37358373,
+	0x62DD1DDF, 0x7F87B538, 0x58684C11, 0x4532E4F6, 0x17B7BE43, 0x0AED16A4, 0x2D02EF8D, 0x3058476A,
+	0x4DB26158, 0x50E8C9BF, 0x77073096, 0x6A5D9871, 0x38D8C2C4, 0x25826A23, 0x026D930A, 0x1F373BED,
+	0x4ADFA541, 0x57850DA6, 0x706AF48F, 0x6D305C68, 0x3FB506DD, 0x22EFAE3A, 0x05005713, 0x185AFFF4,
+	0x4369E96A, 0x5E33418D, 0x79DCB8A4, 0x64861043, 0x36034AF6, 0x2B59E211, 0x0CB61B38, 0x11ECB3DF,
+	0x44042D73, 0x595E8594, 0x7EB17CBD, 0x63EBD45A, 0x316E8EEF, 0x2C342608, 0x0BDBDF21, 0x168177C6,
+	0x5005713C, 0x4D5FD9DB, 0x6AB020F2, 0x77EA8815, 0x256FD2A0, 0x38357A47, 0x1FDA836E, 0x02802B89,
+	0x5768B525, 0x4A321DC2, 0x6DDDE4EB, 0x70874C0C, 0x220216B9, 0x3F58BE5E, 0x18B74777, 0x05EDEF90,
+	0x5EDEF90E, 0x438451E9, 0x646BA8C0, 0x79310027, 0x2BB45A92, 0x36EEF275, 0x11010B5C, 0x0C5BA3BB,
+	0x59B33D17, 0x44E995F0, 0x63066CD9, 0x7E5CC43E, 0x2CD99E8B, 0x3183366C, 0x166CCF45, 0x0B3667A2,
+	// Seed 0x41
+	0x00000000, 0x01F0C55C, 0x005768B5, 0x01A7ADE9, 0x00AED16A, 0x015E1436, 0x00F9B9DF, 0x01097C83,
+	0x015DA2D4, 0x00AD6788, 0x010ACA61, 0x00FA0F3D, 0x01F373BE, 0x0003B6E2, 0x01A41B0B, 0x0054DE57,
+	0x010DA7A5, 0x00FD62F9, 0x015ACF10, 0x00AA0A4C, 0x01A376CF, 0x0053B393, 0x01F41E7A, 0x0004DB26,
+	0x00500571, 0x01A0C02D, 0x00076DC4, 0x01F7A898, 0x00FED41B, 0x010E1147, 0x00A9BCAE, 0x015979F2,
+	0x01ADAD47, 0x005D681B, 0x01FAC5F2, 0x000A00AE, 0x01037C2D, 0x00F3B971, 0x01541498, 0x00A4D1C4,
+	0x00F00F93, 0x0100CACF, 0x00A76726, 0x0157A27A, 0x005EDEF9, 0x01AE1BA5, 0x0009B64C, 0x01F97310,
+	0x00A00AE2, 0x0150CFBE, 0x00F76257, 0x0107A70B, 0x000EDB88, 0x01FE1ED4, 0x0059B33D, 0x01A97661,
+	0x01FDA836, 0x000D6D6A, 0x01AAC083, 0x005A05DF, 0x0153795C, 0x00A3BC00, 0x010411E9, 0x00F4D4B5,
+	0x00EDB883, 0x011D7DDF, 0x00BAD036, 0x014A156A, 0x004369E9, 0x01B3ACB5, 0x0014015C, 0x01E4C400,
+	0x01B01A57, 0x0040DF0B, 0x01E772E2, 0x0017B7BE, 0x011ECB3D, 0x00EE0E61, 0x0149A388, 0x00B966D4,
+	0x01E01F26, 0x0010DA7A, 0x01B77793, 0x0047B2CF, 0x014ECE4C, 0x00BE0B10, 0x0119A6F9, 0x00E963A5,
+	0x00BDBDF2, 0x014D78AE, 0x00EAD547, 0x011A101B, 0x00136C98, 0x01E3A9C4, 0x0044042D, 0x01B4C171,
+	0x014015C4, 0x00B0D098, 0x01177D71, 0x00E7B82D, 0x01EEC4AE, 0x001E01F2, 0x01B9AC1B, 0x00496947,
+	0x001DB710, 0x01ED724C, 0x004ADFA5, 0x01BA1AF9, 0x00B3667A, 0x0143A326, 0x00E40ECF, 0x0114CB93,
+	0x004DB261, 0x01BD773D, 0x001ADAD4, 0x01EA1F88, 0x00E3630B, 0x0113A657, 0x00B40BBE, 0x0144CEE2,
+	0x011010B5, 0x00E0D5E9, 0x01477800, 0x00B7BD5C, 0x01BEC1DF, 0x004E0483, 0x01E9A96A, 0x00196C36,
+	0x01DB7106, 0x002BB45A, 0x018C19B3, 0x007CDCEF, 0x0175A06C, 0x00856530, 0x0122C8D9, 0x00D20D85,
+	0x0086D3D2, 0x0176168E, 0x00D1BB67, 0x01217E3B, 0x002802B8, 0x01D8C7E4, 0x007F6A0D, 0x018FAF51,
+	0x00D6D6A3, 0x012613FF, 0x0081BE16, 0x01717B4A, 0x007807C9, 0x0188C295, 0x002F6F7C, 0x01DFAA20,
+	0x018B7477, 0x007BB12B, 0x01DC1CC2, 0x002CD99E, 0x0125A51D, 0x00D56041, 0x0172CDA8, 0x008208F4,
+	0x0076DC41, 0x0186191D, 0x0021B4F4, 0x01D171A8, 0x00D80D2B, 0x0128C877, 0x008F659E, 0x017FA0C2,
+	0x012B7E95, 0x00DBBBC9, 0x017C1620, 0x008CD37C, 0x0185AFFF, 0x00756AA3, 0x01D2C74A, 0x00220216,
+	0x017B7BE4, 0x008BBEB8, 0x012C1351, 0x00DCD60D, 0x01D5AA8E, 0x00256FD2, 0x0182C23B, 0x00720767,
+	0x0026D930, 0x01D61C6C, 0x0071B185, 0x018174D9, 0x0088085A, 0x0178CD06, 0x00DF60EF, 0x012FA5B3,
+	0x0136C985, 0x00C60CD9, 0x0161A130, 0x0091646C, 0x019818EF, 0x0068DDB3, 0x01CF705A, 0x003FB506,
+	0x006B6B51, 0x019BAE0D, 0x003C03E4, 0x01CCC6B8, 0x00C5BA3B, 0x01357F67, 0x0092D28E, 0x016217D2,
+	0x003B6E20, 0x01CBAB7C, 0x006C0695, 0x019CC3C9, 0x0095BF4A, 0x01657A16, 0x00C2D7FF, 0x013212A3,
+	0x0166CCF4, 0x009609A8, 0x0131A441, 0x00C1611D, 0x01C81D9E, 0x0038D8C2, 0x019F752B, 0x006FB077,
+	0x009B64C2, 0x016BA19E, 0x00CC0C77, 0x013CC92B, 0x0035B5A8, 0x01C570F4, 0x0062DD1D, 0x01921841,
+	0x01C6C616, 0x0036034A, 0x0191AEA3, 0x00616BFF, 0x0168177C, 0x0098D220, 0x013F7FC9, 0x00CFBA95,
+	0x0196C367, 0x0066063B, 0x01C1ABD2, 0x00316E8E, 0x0138120D, 0x00C8D751, 0x016F7AB8, 0x009FBFE4,
+	0x00CB61B3, 0x013BA4EF, 0x009C0906, 0x016CCC5A, 0x0065B0D9, 0x01957585, 0x0032D86C, 0x01C21D30,
+	// Seed 0x42
+	0x00000000, 0x3D924A72, 0x7B2494E4, 0x46B6DE96, 0xF64929C8, 0xCBDB63BA, 0x8D6DBD2C, 0xB0FFF75E,
+	0xDD3612E9, 0xE0A4589B, 0xA612860D, 0x9B80CC7F, 0x2B7F3B21, 0x16ED7153, 0x505BAFC5, 0x6DC9E5B7,
+	0x8BC864AB, 0xB65A2ED9, 0xF0ECF04F, 0xCD7EBA3D, 0x7D814D63, 0x40130711, 0x06A5D987, 0x3B3793F5,
+	0x56FE7642, 0x6B6C3C30, 0x2DDAE2A6, 0x1048A8D4, 0xA0B75F8A, 0x9D2515F8, 0xDB93CB6E, 0xE601811C,
+	0x2634882F, 0x1BA6C25D, 0x5D101CCB, 0x608256B9, 0xD07DA1E7, 0xEDEFEB95, 0xAB593503, 0x96CB7F71,
+	0xFB029AC6, 0xC690D0B4, 0x80260E22, 0xBDB44450, 0x0D4BB30E, 0x30D9F97C, 0x766F27EA, 0x4BFD6D98,
+	0xADFCEC84, 0x906EA6F6, 0xD6D87860, 0xEB4A3212, 0x5BB5C54C, 0x66278F3E, 0x209151A8, 0x1D031BDA,
+	0x70CAFE6D, 0x4D58B41F, 0x0BEE6A89, 0x367C20FB, 0x8683D7A5, 0xBB119DD7, 0xFDA74341, 0xC0350933,
+	0x4C69105E, 0x71FB5A2C, 0x374D84BA, 0x0ADFCEC8, 0xBA203996, 0x87B273E4, 0xC104AD72, 0xFC96E700,
+	0x915F02B7, 0xACCD48C5, 0xEA7B9653, 0xD7E9DC21, 0x67162B7F, 0x5A84610D, 0x1C32BF9B, 0x21A0F5E9,
+	0xC7A174F5, 0xFA333E87, 0xBC85E011, 0x8117AA63, 0x31E85D3D, 0x0C7A174F, 0x4ACCC9D9, 0x775E83AB,
+	0x1A97661C, 0x27052C6E, 0x61B3F2F8, 0x5C21B88A, 0xECDE4FD4, 0xD14C05A6, 0x97FADB30, 0xAA689142,
+	0x6A5D9871, 0x57CFD203, 0x11790C95, 0x2CEB46E7, 0x9C14B1B9, 0xA186FBCB, 0xE730255D, 0xDAA26F2F,
+	0xB76B8A98, 0x8AF9C0EA, 0xCC4F1E7C, 0xF1DD540E, 0x4122A350, 0x7CB0E922, 0x3A0637B4, 0x07947DC6,
+	0xE195FCDA, 0xDC07B6A8, 0x9AB1683E, 0xA723224C, 0x17DCD512, 0x2A4E9F60, 0x6CF841F6, 0x516A0B84,
+	0x3CA3EE33, 0x0131A441, 0x47877AD7, 0x7A1530A5, 0xCAEAC7FB, 0xF7788D89, 0xB1CE531F, 0x8C5C196D,
+	0x98D220BC, 0xA5406ACE, 0xE3F6B458, 0xDE64FE2A, 0x6E9B0974, 0x53094306, 0x15BF9D90, 0x282DD7E2,
+	0x45E43255, 0x78767827, 0x3EC0A6B1, 0x0352ECC3, 0xB3AD1B9D, 0x8E3F51EF, 0xC8898F79, 0xF51BC50B,
+	0x131A4417, 0x2E880E65, 0x683ED0F3, 0x55AC9A81, 0xE5536DDF, 0xD8C127AD, 0x9E77F93B, 0xA3E5B349,
+	0xCE2C56FE, 0xF3BE1C8C, 0xB508C21A, 0x889A8868, 0x38657F36, 0x05F73544, 0x4341EBD2, 0x7ED3A1A0,
+	0xBEE6A893, 0x8374E2E1, 0xC5C23C77, 0xF8507605, 0x48AF815B, 0x753DCB29, 0x338B15BF, 0x0E195FCD,
+	0x63D0BA7A, 0x5E42F008, 0x18F42E9E, 0x256664EC, 0x959993B2, 0xA80BD9C0, 0xEEBD0756, 0xD32F4D24,
+	0x352ECC38, 0x08BC864A, 0x4E0A58DC, 0x739812AE, 0xC367E5F0, 0xFEF5AF82, 0xB8437114, 0x85D13B66,
+	0xE818DED1, 0xD58A94A3, 0x933C4A35, 0xAEAE0047, 0x1E51F719, 0x23C3BD6B, 0x657563FD, 0x58E7298F,
+	0xD4BB30E2, 0xE9297A90, 0xAF9FA406, 0x920DEE74, 0x22F2192A, 0x1F605358, 0x59D68DCE, 0x6444C7BC,
+	0x098D220B, 0x341F6879, 0x72A9B6EF, 0x4F3BFC9D, 0xFFC40BC3, 0xC25641B1, 0x84E09F27, 0xB972D555,
+	0x5F735449, 0x62E11E3B, 0x2457C0AD, 0x19C58ADF, 0xA93A7D81, 0x94A837F3, 0xD21EE965, 0xEF8CA317,
+	0x824546A0, 0xBFD70CD2, 0xF961D244, 0xC4F39836, 0x740C6F68, 0x499E251A, 0x0F28FB8C, 0x32BAB1FE,
+	0xF28FB8CD, 0xCF1DF2BF, 0x89AB2C29, 0xB439665B, 0x04C69105, 0x3954DB77, 0x7FE205E1, 0x42704F93,
+	0x2FB9AA24, 0x122BE056, 0x549D3EC0, 0x690F74B2, 0xD9F083EC, 0xE462C99E, 0xA2D41708, 0x9F465D7A,
+	0x7947DC66, 0x44D59614, 0x02634882, 0x3FF102F0, 0x8F0EF5AE, 0xB29CBFDC, 0xF42A614A, 0xC9B82B38,
+	0xA471CE8F, 0x99E384FD, 0xDF555A6B, 0xE2C71019, 0x5238E747, 0x6FAAAD35, 0x291C73A3, 0x148E39D1,
+	// Seed 0x43
+	0x00000000, 0x06A102A1, 0x0D420542, 0x0BE307E3, 0x1A840A84, 0x1C250825, 0x17C60FC6, 0x11670D67,
+	0x35081508, 0x33A917A9, 0x384A104A, 0x3EEB12EB, 0x2F8C1F8C, 0x292D1D2D, 0x22CE1ACE, 0x246F186F,
+	0x6A102A10, 0x6CB128B1, 0x67522F52, 0x61F32DF3, 0x70942094, 0x76352235, 0x7DD625D6, 0x7B772777,
+	0x5F183F18, 0x59B93DB9, 0x525A3A5A, 0x54FB38FB, 0x459C359C, 0x433D373D, 0x48DE30DE, 0x4E7F327F,
+	0xD4205420, 0xD2815681, 0xD9625162, 0xDFC353C3, 0xCEA45EA4, 0xC8055C05, 0xC3E65BE6, 0xC5475947,
+	0xE1284128, 0xE7894389, 0xEC6A446A, 0xEACB46CB, 0xFBAC4BAC, 0xFD0D490D, 0xF6EE4EEE, 0xF04F4C4F,
+	0xBE307E30, 0xB8917C91, 0xB3727B72, 0xB5D379D3, 0xA4B474B4, 0xA2157615, 0xA9F671F6, 0xAF577357,
+	0x8B386B38, 0x8D996999, 0x867A6E7A, 0x80DB6CDB, 0x91BC61BC, 0x971D631D, 0x9CFE64FE, 0x9A5F665F,
+	0x77EA8815, 0x714B8AB4, 0x7AA88D57, 0x7C098FF6, 0x6D6E8291, 0x6BCF8030, 0x602C87D3, 0x668D8572,
+	0x42E29D1D, 0x44439FBC, 0x4FA0985F, 0x49019AFE, 0x58669799, 0x5EC79538, 0x552492DB, 0x5385907A,
+	0x1DFAA205, 0x1B5BA0A4, 0x10B8A747, 0x1619A5E6, 0x077EA881, 0x01DFAA20, 0x0A3CADC3, 0x0C9DAF62,
+	0x28F2B70D, 0x2E53B5AC, 0x25B0B24F, 0x2311B0EE, 0x3276BD89, 0x34D7BF28, 0x3F34B8CB, 0x3995BA6A,
+	0xA3CADC35, 0xA56BDE94, 0xAE88D977, 0xA829DBD6, 0xB94ED6B1, 0xBFEFD410, 0xB40CD3F3, 0xB2ADD152,
+	0x96C2C93D, 0x9063CB9C, 0x9B80CC7F, 0x9D21CEDE, 0x8C46C3B9, 0x8AE7C118, 0x8104C6FB, 0x87A5C45A,
+	0xC9DAF625, 0xCF7BF484, 0xC498F367, 0xC239F1C6, 0xD35EFCA1, 0xD5FFFE00, 0xDE1CF9E3, 0xD8BDFB42,
+	0xFCD2E32D, 0xFA73E18C, 0xF190E66F, 0xF731E4CE, 0xE656E9A9, 0xE0F7EB08, 0xEB14ECEB, 0xEDB5EE4A,
+	0xEFD5102A, 0xE974128B, 0xE2971568, 0xE43617C9, 0xF5511AAE, 0xF3F0180F, 0xF8131FEC, 0xFEB21D4D,
+	0xDADD0522, 0xDC7C0783, 0xD79F0060, 0xD13E02C1, 0xC0590FA6, 0xC6F80D07, 0xCD1B0AE4, 0xCBBA0845,
+	0x85C53A3A, 0x8364389B, 0x88873F78, 0x8E263DD9, 0x9F4130BE, 0x99E0321F, 0x920335FC, 0x94A2375D,
+	0xB0CD2F32, 0xB66C2D93, 0xBD8F2A70, 0xBB2E28D1, 0xAA4925B6, 0xACE82717, 0xA70B20F4, 0xA1AA2255,
+	0x3BF5440A, 0x3D5446AB, 0x36B74148, 0x301643E9, 0x21714E8E, 0x27D04C2F, 0x2C334BCC, 0x2A92496D,
+	0x0EFD5102, 0x085C53A3, 0x03BF5440, 0x051E56E1, 0x14795B86, 0x12D85927, 0x193B5EC4, 0x1F9A5C65,
+	0x51E56E1A, 0x57446CBB, 0x5CA76B58, 0x5A0669F9, 0x4B61649E, 0x4DC0663F, 0x462361DC, 0x4082637D,
+	0x64ED7B12, 0x624C79B3, 0x69AF7E50, 0x6F0E7CF1, 0x7E697196, 0x78C87337, 0x732B74D4, 0x758A7675,
+	0x983F983F, 0x9E9E9A9E, 0x957D9D7D, 0x93DC9FDC, 0x82BB92BB, 0x841A901A, 0x8FF997F9, 0x89589558,
+	0xAD378D37, 0xAB968F96, 0xA0758875, 0xA6D48AD4, 0xB7B387B3, 0xB1128512, 0xBAF182F1, 0xBC508050,
+	0xF22FB22F, 0xF48EB08E, 0xFF6DB76D, 0xF9CCB5CC, 0xE8ABB8AB, 0xEE0ABA0A, 0xE5E9BDE9, 0xE348BF48,
+	0xC727A727, 0xC186A586, 0xCA65A265, 0xCCC4A0C4, 0xDDA3ADA3, 0xDB02AF02, 0xD0E1A8E1, 0xD640AA40,
+	0x4C1FCC1F, 0x4ABECEBE, 0x415DC95D, 0x47FCCBFC, 0x569BC69B, 0x503AC43A, 0x5BD9C3D9, 0x5D78C178,
+	0x7917D917, 0x7FB6DBB6, 0x7455DC55, 0x72F4DEF4, 0x6393D393, 0x6532D132, 0x6ED1D6D1, 0x6870D470,
+	0x260FE60F, 0x20AEE4AE, 0x2B4DE34D, 0x2DECE1EC, 0x3C8BEC8B, 0x3A2AEE2A, 0x31C9E9C9, 0x3768EB68,
+	0x1307F307, 0x15A6F1A6, 0x1E45F645, 0x18E4F4E4, 0x0983F983, 0x0F22FB22, 0x04C1FCC1, 0x0260FE60,
+	// Seed 0x44
+	0x00000000, 0x686ED582, 0x33BEA017, 0x5BD07595, 0x677D402E, 0x0F1395AC, 0x54C3E039, 0x3CAD35BB,
+	0x2D998B4F, 0x45F75ECD, 0x1E272B58, 0x7649FEDA, 0x4AE4CB61, 0x228A1EE3, 0x795A6B76, 0x1134BEF4,
+	0x5B33169E, 0x335DC31C, 0x688DB689, 0x00E3630B, 0x3C4E56B0, 0x54208332, 0x0FF0F6A7, 0x679E2325,
+	0x76AA9DD1, 0x1EC44853, 0x45143DC6, 0x2D7AE844, 0x11D7DDFF, 0x79B9087D, 0x22697DE8, 0x4A07A86A,
+	0x5505262F, 0x3D6BF3AD, 0x66BB8638, 0x0ED553BA, 0x32786601, 0x5A16B383, 0x01C6C616, 0x69A81394,
+	0x789CAD60, 0x10F278E2, 0x4B220D77, 0x234CD8F5, 0x1FE1ED4E, 0x778F38CC, 0x2C5F4D59, 0x443198DB,
+	0x0E3630B1, 0x6658E533, 0x3D8890A6, 0x55E64524, 0x694B709F, 0x0125A51D, 0x5AF5D088, 0x329B050A,
+	0x23AFBBFE, 0x4BC16E7C, 0x10111BE9, 0x787FCE6B, 0x44D2FBD0, 0x2CBC2E52, 0x776C5BC7, 0x1F028E45,
+	0x4969474D, 0x210792CF, 0x7AD7E75A, 0x12B932D8, 0x2E140763, 0x467AD2E1, 0x1DAAA774, 0x75C472F6,
+	0x64F0CC02, 0x0C9E1980, 0x574E6C15, 0x3F20B997, 0x038D8C2C, 0x6BE359AE, 0x30332C3B, 0x585DF9B9,
+	0x125A51D3, 0x7A348451, 0x21E4F1C4, 0x498A2446, 0x752711FD, 0x1D49C47F, 0x4699B1EA, 0x2EF76468,
+	0x3FC3DA9C, 0x57AD0F1E, 0x0C7D7A8B, 0x6413AF09, 0x58BE9AB2, 0x30D04F30, 0x6B003AA5, 0x036EEF27,
+	0x1C6C6162, 0x7402B4E0, 0x2FD2C175, 0x47BC14F7, 0x7B11214C, 0x137FF4CE, 0x48AF815B, 0x20C154D9,
+	0x31F5EA2D, 0x599B3FAF, 0x024B4A3A, 0x6A259FB8, 0x5688AA03, 0x3EE67F81, 0x65360A14, 0x0D58DF96,
+	0x475F77FC, 0x2F31A27E, 0x74E1D7EB, 0x1C8F0269, 0x202237D2, 0x484CE250, 0x139C97C5, 0x7BF24247,
+	0x6AC6FCB3, 0x02A82931, 0x59785CA4, 0x31168926, 0x0DBBBC9D, 0x65D5691F, 0x3E051C8A, 0x566BC908,
+	0x71B18589, 0x19DF500B, 0x420F259E, 0x2A61F01C, 0x16CCC5A7, 0x7EA21025, 0x257265B0, 0x4D1CB032,
+	0x5C280EC6, 0x3446DB44, 0x6F96AED1, 0x07F87B53, 0x3B554EE8, 0x533B9B6A, 0x08EBEEFF, 0x60853B7D,
+	0x2A829317, 0x42EC4695, 0x193C3300, 0x7152E682, 0x4DFFD339, 0x259106BB, 0x7E41732E, 0x162FA6AC,
+	0x071B1858, 0x6F75CDDA, 0x34A5B84F, 0x5CCB6DCD, 0x60665876, 0x08088DF4, 0x53D8F861, 0x3BB62DE3,
+	0x24B4A3A6, 0x4CDA7624, 0x170A03B1, 0x7F64D633, 0x43C9E388, 0x2BA7360A, 0x7077439F, 0x1819961D,
+	0x092D28E9, 0x6143FD6B, 0x3A9388FE, 0x52FD5D7C, 0x6E5068C7, 0x063EBD45, 0x5DEEC8D0, 0x35801D52,
+	0x7F87B538, 0x17E960BA, 0x4C39152F, 0x2457C0AD, 0x18FAF516, 0x70942094, 0x2B445501, 0x432A8083,
+	0x521E3E77, 0x3A70EBF5, 0x61A09E60, 0x09CE4BE2, 0x35637E59, 0x5D0DABDB, 0x06DDDE4E, 0x6EB30BCC,
+	0x38D8C2C4, 0x50B61746, 0x0B6662D3, 0x6308B751, 0x5FA582EA, 0x37CB5768, 0x6C1B22FD, 0x0475F77F,
+	0x1541498B, 0x7D2F9C09, 0x26FFE99C, 0x4E913C1E, 0x723C09A5, 0x1A52DC27, 0x4182A9B2, 0x29EC7C30,
+	0x63EBD45A, 0x0B8501D8, 0x5055744D, 0x383BA1CF, 0x04969474, 0x6CF841F6, 0x37283463, 0x5F46E1E1,
+	0x4E725F15, 0x261C8A97, 0x7DCCFF02, 0x15A22A80, 0x290F1F3B, 0x4161CAB9, 0x1AB1BF2C, 0x72DF6AAE,
+	0x6DDDE4EB, 0x05B33169, 0x5E6344FC, 0x360D917E, 0x0AA0A4C5, 0x62CE7147, 0x391E04D2, 0x5170D150,
+	0x40446FA4, 0x282ABA26, 0x73FACFB3, 0x1B941A31, 0x27392F8A, 0x4F57FA08, 0x14878F9D, 0x7CE95A1F,
+	0x36EEF275, 0x5E8027F7, 0x05505262, 0x6D3E87E0, 0x5193B25B, 0x39FD67D9, 0x622D124C, 0x0A43C7CE,
+	0x1B77793A, 0x7319ACB8, 0x28C9D92D, 0x40A70CAF, 0x7C0A3914, 0x1464EC96, 0x4FB49903, 0x27DA4C81,
+	// Seed 0x45
+	0x00000000, 0x05FA582E, 0x0699DA63, 0x0363824D, 0x005EDEF9, 0x05A486D7, 0x06C7049A, 0x033D5CB4,
+	0x00BDBDF2, 0x0547E5DC, 0x06246791, 0x03DE3FBF, 0x00E3630B, 0x05193B25, 0x067AB968, 0x0380E146,
+	0x017B7BE4, 0x048123CA, 0x07E2A187, 0x0218F9A9, 0x0125A51D, 0x04DFFD33, 0x07BC7F7E, 0x02462750,
+	0x01C6C616, 0x043C9E38, 0x075F1C75, 0x02A5445B, 0x019818EF, 0x046240C1, 0x0701C28C, 0x02FB9AA2,
+	0x02F6F7C8, 0x070CAFE6, 0x046F2DAB, 0x01957585, 0x02A82931, 0x0752711F, 0x0431F352, 0x01CBAB7C,
+	0x024B4A3A, 0x07B11214, 0x04D29059, 0x0128C877, 0x021594C3, 0x07EFCCED, 0x048C4EA0, 0x0176168E,
+	0x038D8C2C, 0x0677D402, 0x0514564F, 0x00EE0E61, 0x03D352D5, 0x06290AFB, 0x054A88B6, 0x00B0D098,
+	0x033031DE, 0x06CA69F0, 0x05A9EBBD, 0x0053B393, 0x036EEF27, 0x0694B709, 0x05F73544, 0x000D6D6A,
+	0x05EDEF90, 0x0017B7BE, 0x037435F3, 0x068E6DDD, 0x05B33169, 0x00496947, 0x032AEB0A, 0x06D0B324,
+	0x05505262, 0x00AA0A4C, 0x03C98801, 0x0633D02F, 0x050E8C9B, 0x00F4D4B5, 0x039756F8, 0x066D0ED6,
+	0x04969474, 0x016CCC5A, 0x020F4E17, 0x07F51639, 0x04C84A8D, 0x013212A3, 0x025190EE, 0x07ABC8C0,
+	0x042B2986, 0x01D171A8, 0x02B2F3E5, 0x0748ABCB, 0x0475F77F, 0x018FAF51, 0x02EC2D1C, 0x07167532,
+	0x071B1858, 0x02E14076, 0x0182C23B, 0x04789A15, 0x0745C6A1, 0x02BF9E8F, 0x01DC1CC2, 0x042644EC,
+	0x07A6A5AA, 0x025CFD84, 0x013F7FC9, 0x04C527E7, 0x07F87B53, 0x0202237D, 0x0161A130, 0x049BF91E,
+	0x066063BC, 0x039A3B92, 0x00F9B9DF, 0x0503E1F1, 0x063EBD45, 0x03C4E56B, 0x00A76726, 0x055D3F08,
+	0x06DDDE4E, 0x03278660, 0x0044042D, 0x05BE5C03, 0x068300B7, 0x03795899, 0x001ADAD4, 0x05E082FA,
+	0x06B6B51F, 0x034CED31, 0x002F6F7C, 0x05D53752, 0x06E86BE6, 0x031233C8, 0x0071B185, 0x058BE9AB,
+	0x060B08ED, 0x03F150C3, 0x0092D28E, 0x05688AA0, 0x0655D614, 0x03AF8E3A, 0x00CC0C77, 0x05365459,
+	0x07CDCEFB, 0x023796D5, 0x01541498, 0x04AE4CB6, 0x07931002, 0x0269482C, 0x010ACA61, 0x04F0924F,
+	0x07707309, 0x028A2B27, 0x01E9A96A, 0x0413F144, 0x072EADF0, 0x02D4F5DE, 0x01B77793, 0x044D2FBD,
+	0x044042D7, 0x01BA1AF9, 0x02D998B4, 0x0723C09A, 0x041E9C2E, 0x01E4C400, 0x0287464D, 0x077D1E63,
+	0x04FDFF25, 0x0107A70B, 0x02642546, 0x079E7D68, 0x04A321DC, 0x015979F2, 0x023AFBBF, 0x07C0A391,
+	0x053B3933, 0x00C1611D, 0x03A2E350, 0x0658BB7E, 0x0565E7CA, 0x009FBFE4, 0x03FC3DA9, 0x06066587,
+	0x058684C1, 0x007CDCEF, 0x031F5EA2, 0x06E5068C, 0x05D85A38, 0x00220216, 0x0341805B, 0x06BBD875,
+	0x035B5A8F, 0x06A102A1, 0x05C280EC, 0x0038D8C2, 0x03058476, 0x06FFDC58, 0x059C5E15, 0x0066063B,
+	0x03E6E77D, 0x061CBF53, 0x057F3D1E, 0x00856530, 0x03B83984, 0x064261AA, 0x0521E3E7, 0x00DBBBC9,
+	0x0220216B, 0x07DA7945, 0x04B9FB08, 0x0143A326, 0x027EFF92, 0x0784A7BC, 0x04E725F1, 0x011D7DDF,
+	0x029D9C99, 0x0767C4B7, 0x040446FA, 0x01FE1ED4, 0x02C34260, 0x07391A4E, 0x045A9803, 0x01A0C02D,
+	0x01ADAD47, 0x0457F569, 0x07347724, 0x02CE2F0A, 0x01F373BE, 0x04092B90, 0x076AA9DD, 0x0290F1F3,
+	0x011010B5, 0x04EA489B, 0x0789CAD6, 0x027392F8, 0x014ECE4C, 0x04B49662, 0x07D7142F, 0x022D4C01,
+	0x00D6D6A3, 0x052C8E8D, 0x064F0CC0, 0x03B554EE, 0x0088085A, 0x05725074, 0x0611D239, 0x03EB8A17,
+	0x006B6B51, 0x0591337F, 0x06F2B132, 0x0308E91C, 0x0035B5A8, 0x05CFED86, 0x06AC6FCB, 0x035637E5,
+	// Seed 0x46
+	0x00000000, 0xC42B951D, 0xB728E371, 0x7303766C, 0x512E0FA9, 0x95059AB4, 0xE606ECD8, 0x222D79C5,
+	0xA25C1F52, 0x66778A4F, 0x1574FC23, 0xD15F693E, 0xF37210FB, 0x375985E6, 0x445AF38A, 0x80716697,
+	0x7BC7F7EF, 0xBFEC62F2, 0xCCEF149E, 0x08C48183, 0x2AE9F846, 0xEEC26D5B, 0x9DC11B37, 0x59EA8E2A,
+	0xD99BE8BD, 0x1DB07DA0, 0x6EB30BCC, 0xAA989ED1, 0x88B5E714, 0x4C9E7209, 0x3F9D0465, 0xFBB69178,
+	0xF78FEFDE, 0x33A47AC3, 0x40A70CAF, 0x848C99B2, 0xA6A1E077, 0x628A756A, 0x11890306, 0xD5A2961B,
+	0x55D3F08C, 0x91F86591, 0xE2FB13FD, 0x26D086E0, 0x04FDFF25, 0xC0D66A38, 0xB3D51C54, 0x77FE8949,
+	0x8C481831, 0x48638D2C, 0x3B60FB40, 0xFF4B6E5D, 0xDD661798, 0x194D8285, 0x6A4EF4E9, 0xAE6561F4,
+	0x2E140763, 0xEA3F927E, 0x993CE412, 0x5D17710F, 0x7F3A08CA, 0xBB119DD7, 0xC812EBBB, 0x0C397EA6,
+	0xD06016F7, 0x144B83EA, 0x6748F586, 0xA363609B, 0x814E195E, 0x45658C43, 0x3666FA2F, 0xF24D6F32,
+	0x723C09A5, 0xB6179CB8, 0xC514EAD4, 0x013F7FC9, 0x2312060C, 0xE7399311, 0x943AE57D, 0x50117060,
+	0xABA7E118, 0x6F8C7405, 0x1C8F0269, 0xD8A49774, 0xFA89EEB1, 0x3EA27BAC, 0x4DA10DC0, 0x898A98DD,
+	0x09FBFE4A, 0xCDD06B57, 0xBED31D3B, 0x7AF88826, 0x58D5F1E3, 0x9CFE64FE, 0xEFFD1292, 0x2BD6878F,
+	0x27EFF929, 0xE3C46C34, 0x90C71A58, 0x54EC8F45, 0x76C1F680, 0xB2EA639D, 0xC1E915F1, 0x05C280EC,
+	0x85B3E67B, 0x41987366, 0x329B050A, 0xF6B09017, 0xD49DE9D2, 0x10B67CCF, 0x63B50AA3, 0xA79E9FBE,
+	0x5C280EC6, 0x98039BDB, 0xEB00EDB7, 0x2F2B78AA, 0x0D06016F, 0xC92D9472, 0xBA2EE21E, 0x7E057703,
+	0xFE741194, 0x3A5F8489, 0x495CF2E5, 0x8D7767F8, 0xAF5A1E3D, 0x6B718B20, 0x1872FD4C, 0xDC596851,
+	0x9FBFE4A5, 0x5B9471B8, 0x289707D4, 0xECBC92C9, 0xCE91EB0C, 0x0ABA7E11, 0x79B9087D, 0xBD929D60,
+	0x3DE3FBF7, 0xF9C86EEA, 0x8ACB1886, 0x4EE08D9B, 0x6CCDF45E, 0xA8E66143, 0xDBE5172F, 0x1FCE8232,
+	0xE478134A, 0x20538657, 0x5350F03B, 0x977B6526, 0xB5561CE3, 0x717D89FE, 0x027EFF92, 0xC6556A8F,
+	0x46240C18, 0x820F9905, 0xF10CEF69, 0x35277A74, 0x170A03B1, 0xD32196AC, 0xA022E0C0, 0x640975DD,
+	0x68300B7B, 0xAC1B9E66, 0xDF18E80A, 0x1B337D17, 0x391E04D2, 0xFD3591CF, 0x8E36E7A3, 0x4A1D72BE,
+	0xCA6C1429, 0x0E478134, 0x7D44F758, 0xB96F6245, 0x9B421B80, 0x5F698E9D, 0x2C6AF8F1, 0xE8416DEC,
+	0x13F7FC94, 0xD7DC6989, 0xA4DF1FE5, 0x60F48AF8, 0x42D9F33D, 0x86F26620, 0xF5F1104C, 0x31DA8551,
+	0xB1ABE3C6, 0x758076DB, 0x068300B7, 0xC2A895AA, 0xE085EC6F, 0x24AE7972, 0x57AD0F1E, 0x93869A03,
+	0x4FDFF252, 0x8BF4674F, 0xF8F71123, 0x3CDC843E, 0x1EF1FDFB, 0xDADA68E6, 0xA9D91E8A, 0x6DF28B97,
+	0xED83ED00, 0x29A8781D, 0x5AAB0E71, 0x9E809B6C, 0xBCADE2A9, 0x788677B4, 0x0B8501D8, 0xCFAE94C5,
+	0x341805BD, 0xF03390A0, 0x8330E6CC, 0x471B73D1, 0x65360A14, 0xA11D9F09, 0xD21EE965, 0x16357C78,
+	0x96441AEF, 0x526F8FF2, 0x216CF99E, 0xE5476C83, 0xC76A1546, 0x0341805B, 0x7042F637, 0xB469632A,
+	0xB8501D8C, 0x7C7B8891, 0x0F78FEFD, 0xCB536BE0, 0xE97E1225, 0x2D558738, 0x5E56F154, 0x9A7D6449,
+	0x1A0C02DE, 0xDE2797C3, 0xAD24E1AF, 0x690F74B2, 0x4B220D77, 0x8F09986A, 0xFC0AEE06, 0x38217B1B,
+	0xC397EA63, 0x07BC7F7E, 0x74BF0912, 0xB0949C0F, 0x92B9E5CA, 0x569270D7, 0x259106BB, 0xE1BA93A6,
+	0x61CBF531, 0xA5E0602C, 0xD6E31640, 0x12C8835D, 0x30E5FA98, 0xF4CE6F85, 0x87CD19E9, 0x43E68CF4,
+	// Seed 0x47
+	0x00000000, 0x2BC13031, 0x57826062, 0x7C435053, 0xAF04C0C4, 0x84C5F0F5, 0xF886A0A6, 0xD3479097,
+	0x8F7829EF, 0xA4B919DE, 0xD8FA498D, 0xF33B79BC, 0x207CE92B, 0x0BBDD91A, 0x77FE8949, 0x5C3FB978,
+	0xCF81FBB9, 0xE440CB88, 0x98039BDB, 0xB3C2ABEA, 0x60853B7D, 0x4B440B4C, 0x37075B1F, 0x1CC66B2E,
+	0x40F9D256, 0x6B38E267, 0x177BB234, 0x3CBA8205, 0xEFFD1292, 0xC43C22A3, 0xB87F72F0, 0x93BE42C1,
+	0x4E725F15, 0x65B36F24, 0x19F03F77, 0x32310F46, 0xE1769FD1, 0xCAB7AFE0, 0xB6F4FFB3, 0x9D35CF82,
+	0xC10A76FA, 0xEACB46CB, 0x96881698, 0xBD4926A9, 0x6E0EB63E, 0x45CF860F, 0x398CD65C, 0x124DE66D,
+	0x81F3A4AC, 0xAA32949D, 0xD671C4CE, 0xFDB0F4FF, 0x2EF76468, 0x05365459, 0x7975040A, 0x52B4343B,
+	0x0E8B8D43, 0x254ABD72, 0x5909ED21, 0x72C8DD10, 0xA18F4D87, 0x8A4E7DB6, 0xF60D2DE5, 0xDDCC1DD4,
+	0x9CE4BE2A, 0xB7258E1B, 0xCB66DE48, 0xE0A7EE79, 0x33E07EEE, 0x18214EDF, 0x64621E8C, 0x4FA32EBD,
+	0x139C97C5, 0x385DA7F4, 0x441EF7A7, 0x6FDFC796, 0xBC985701, 0x97596730, 0xEB1A3763, 0xC0DB0752,
+	0x53654593, 0x78A475A2, 0x04E725F1, 0x2F2615C0, 0xFC618557, 0xD7A0B566, 0xABE3E535, 0x8022D504,
+	0xDC1D6C7C, 0xF7DC5C4D, 0x8B9F0C1E, 0xA05E3C2F, 0x7319ACB8, 0x58D89C89, 0x249BCCDA, 0x0F5AFCEB,
+	0xD296E13F, 0xF957D10E, 0x8514815D, 0xAED5B16C, 0x7D9221FB, 0x565311CA, 0x2A104199, 0x01D171A8,
+	0x5DEEC8D0, 0x762FF8E1, 0x0A6CA8B2, 0x21AD9883, 0xF2EA0814, 0xD92B3825, 0xA5686876, 0x8EA95847,
+	0x1D171A86, 0x36D62AB7, 0x4A957AE4, 0x61544AD5, 0xB213DA42, 0x99D2EA73, 0xE591BA20, 0xCE508A11,
+	0x926F3369, 0xB9AE0358, 0xC5ED530B, 0xEE2C633A, 0x3D6BF3AD, 0x16AAC39C, 0x6AE993CF, 0x4128A3FE,
+	0xE8B8D433, 0xC379E402, 0xBF3AB451, 0x94FB8460, 0x47BC14F7, 0x6C7D24C6, 0x103E7495, 0x3BFF44A4,
+	0x67C0FDDC, 0x4C01CDED, 0x30429DBE, 0x1B83AD8F, 0xC8C43D18, 0xE3050D29, 0x9F465D7A, 0xB4876D4B,
+	0x27392F8A, 0x0CF81FBB, 0x70BB4FE8, 0x5B7A7FD9, 0x883DEF4E, 0xA3FCDF7F, 0xDFBF8F2C, 0xF47EBF1D,
+	0xA8410665, 0x83803654, 0xFFC36607, 0xD4025636, 0x0745C6A1, 0x2C84F690, 0x50C7A6C3, 0x7B0696F2,
+	0xA6CA8B26, 0x8D0BBB17, 0xF148EB44, 0xDA89DB75, 0x09CE4BE2, 0x220F7BD3, 0x5E4C2B80, 0x758D1BB1,
+	0x29B2A2C9, 0x027392F8, 0x7E30C2AB, 0x55F1F29A, 0x86B6620D, 0xAD77523C, 0xD134026F, 0xFAF5325E,
+	0x694B709F, 0x428A40AE, 0x3EC910FD, 0x150820CC, 0xC64FB05B, 0xED8E806A, 0x91CDD039, 0xBA0CE008,
+	0xE6335970, 0xCDF26941, 0xB1B13912, 0x9A700923, 0x493799B4, 0x62F6A985, 0x1EB5F9D6, 0x3574C9E7,
+	0x745C6A19, 0x5F9D5A28, 0x23DE0A7B, 0x081F3A4A, 0xDB58AADD, 0xF0999AEC, 0x8CDACABF, 0xA71BFA8E,
+	0xFB2443F6, 0xD0E573C7, 0xACA62394, 0x876713A5, 0x54208332, 0x7FE1B303, 0x03A2E350, 0x2863D361,
+	0xBBDD91A0, 0x901CA191, 0xEC5FF1C2, 0xC79EC1F3, 0x14D95164, 0x3F186155, 0x435B3106, 0x689A0137,
+	0x34A5B84F, 0x1F64887E, 0x6327D82D, 0x48E6E81C, 0x9BA1788B, 0xB06048BA, 0xCC2318E9, 0xE7E228D8,
+	0x3A2E350C, 0x11EF053D, 0x6DAC556E, 0x466D655F, 0x952AF5C8, 0xBEEBC5F9, 0xC2A895AA, 0xE969A59B,
+	0xB5561CE3, 0x9E972CD2, 0xE2D47C81, 0xC9154CB0, 0x1A52DC27, 0x3193EC16, 0x4DD0BC45, 0x66118C74,
+	0xF5AFCEB5, 0xDE6EFE84, 0xA22DAED7, 0x89EC9EE6, 0x5AAB0E71, 0x716A3E40, 0x0D296E13, 0x26E85E22,
+	0x7AD7E75A, 0x5116D76B, 0x2D558738, 0x0694B709, 0xD5D3279E, 0xFE1217AF, 0x825147FC, 0xA99077CD,
+	// Seed 0x48
+	0x00000000, 0x0C30C8EA, 0x186191D4, 0x1451593E, 0x30C323A8, 0x3CF3EB42, 0x28A2B27C, 0x24927A96,
+	0x61864750, 0x6DB68FBA, 0x79E7D684, 0x75D71E6E, 0x514564F8, 0x5D75AC12, 0x4924F52C, 0x45143DC6,
+	0x33031DE5, 0x3F33D50F, 0x2B628C31, 0x275244DB, 0x03C03E4D, 0x0FF0F6A7, 0x1BA1AF99, 0x17916773,
+	0x52855AB5, 0x5EB5925F, 0x4AE4CB61, 0x46D4038B, 0x6246791D, 0x6E76B1F7, 0x7A27E8C9, 0x76172023,
+	0x66063BCA, 0x6A36F320, 0x7E67AA1E, 0x725762F4, 0x56C51862, 0x5AF5D088, 0x4EA489B6, 0x4294415C,
+	0x07807C9A, 0x0BB0B470, 0x1FE1ED4E, 0x13D125A4, 0x37435F32, 0x3B7397D8, 0x2F22CEE6, 0x2312060C,
+	0x5505262F, 0x5935EEC5, 0x4D64B7FB, 0x41547F11, 0x65C60587, 0x69F6CD6D, 0x7DA79453, 0x71975CB9,
+	0x3483617F, 0x38B3A995, 0x2CE2F0AB, 0x20D23841, 0x044042D7, 0x08708A3D, 0x1C21D303, 0x10111BE9,
+	0x3C03E4D1, 0x30332C3B, 0x24627505, 0x2852BDEF, 0x0CC0C779, 0x00F00F93, 0x14A156AD, 0x18919E47,
+	0x5D85A381, 0x51B56B6B, 0x45E43255, 0x49D4FABF, 0x6D468029, 0x617648C3, 0x752711FD, 0x7917D917,
+	0x0F00F934, 0x033031DE, 0x176168E0, 0x1B51A00A, 0x3FC3DA9C, 0x33F31276, 0x27A24B48, 0x2B9283A2,
+	0x6E86BE64, 0x62B6768E, 0x76E72FB0, 0x7AD7E75A, 0x5E459DCC, 0x52755526, 0x46240C18, 0x4A14C4F2,
+	0x5A05DF1B, 0x563517F1, 0x42644ECF, 0x4E548625, 0x6AC6FCB3, 0x66F63459, 0x72A76D67, 0x7E97A58D,
+	0x3B83984B, 0x37B350A1, 0x23E2099F, 0x2FD2C175, 0x0B40BBE3, 0x07707309, 0x13212A37, 0x1F11E2DD,
+	0x6906C2FE, 0x65360A14, 0x7167532A, 0x7D579BC0, 0x59C5E156, 0x55F529BC, 0x41A47082, 0x4D94B868,
+	0x088085AE, 0x04B04D44, 0x10E1147A, 0x1CD1DC90, 0x3843A606, 0x34736EEC, 0x202237D2, 0x2C12FF38,
+	0x7807C9A2, 0x74370148, 0x60665876, 0x6C56909C, 0x48C4EA0A, 0x44F422E0, 0x50A57BDE, 0x5C95B334,
+	0x19818EF2, 0x15B14618, 0x01E01F26, 0x0DD0D7CC, 0x2942AD5A, 0x257265B0, 0x31233C8E, 0x3D13F464,
+	0x4B04D447, 0x47341CAD, 0x53654593, 0x5F558D79, 0x7BC7F7EF, 0x77F73F05, 0x63A6663B, 0x6F96AED1,
+	0x2A829317, 0x26B25BFD, 0x32E302C3, 0x3ED3CA29, 0x1A41B0BF, 0x16717855, 0x0220216B, 0x0E10E981,
+	0x1E01F268, 0x12313A82, 0x066063BC, 0x0A50AB56, 0x2EC2D1C0, 0x22F2192A, 0x36A34014, 0x3A9388FE,
+	0x7F87B538, 0x73B77DD2, 0x67E624EC, 0x6BD6EC06, 0x4F449690, 0x43745E7A, 0x57250744, 0x5B15CFAE,
+	0x2D02EF8D, 0x21322767, 0x35637E59, 0x3953B6B3, 0x1DC1CC25, 0x11F104CF, 0x05A05DF1, 0x0990951B,
+	0x4C84A8DD, 0x40B46037, 0x54E53909, 0x58D5F1E3, 0x7C478B75, 0x7077439F, 0x64261AA1, 0x6816D24B,
+	0x44042D73, 0x4834E599, 0x5C65BCA7, 0x5055744D, 0x74C70EDB, 0x78F7C631, 0x6CA69F0F, 0x609657E5,
+	0x25826A23, 0x29B2A2C9, 0x3DE3FBF7, 0x31D3331D, 0x1541498B, 0x19718161, 0x0D20D85F, 0x011010B5,
+	0x77073096, 0x7B37F87C, 0x6F66A142, 0x635669A8, 0x47C4133E, 0x4BF4DBD4, 0x5FA582EA, 0x53954A00,
+	0x168177C6, 0x1AB1BF2C, 0x0EE0E612, 0x02D02EF8, 0x2642546E, 0x2A729C84, 0x3E23C5BA, 0x32130D50,
+	0x220216B9, 0x2E32DE53, 0x3A63876D, 0x36534F87, 0x12C13511, 0x1EF1FDFB, 0x0AA0A4C5, 0x06906C2F,
+	0x438451E9, 0x4FB49903, 0x5BE5C03D, 0x57D508D7, 0x73477241, 0x7F77BAAB, 0x6B26E395, 0x67162B7F,
+	0x11010B5C, 0x1D31C3B6, 0x09609A88, 0x05505262, 0x21C228F4, 0x2DF2E01E, 0x39A3B920, 0x359371CA,
+	0x70874C0C, 0x7CB784E6, 0x68E6DDD8, 0x64D61532, 0x40446FA4, 0x4C74A74E, 0x5825FE70, 0x5415369A,
+	// Seed 0x49
+	0x00000000, 0x030D702C, 0x061AE058, 0x05179074, 0x0C35C0B0, 0x0F38B09C, 0x0A2F20E8, 0x092250C4,
+	0x072A7309, 0x04270325, 0x01309351, 0x023DE37D, 0x0B1FB3B9, 0x0812C395, 0x0D0553E1, 0x0E0823CD,
+	0x0E54E612, 0x0D59963E, 0x084E064A, 0x0B437666, 0x026126A2, 0x016C568E, 0x047BC6FA, 0x0776B6D6,
+	0x097E951B, 0x0A73E537, 0x0F647543, 0x0C69056F, 0x054B55AB, 0x06462587, 0x0351B5F3, 0x005CC5DF,
+	0x03E83E4D, 0x00E54E61, 0x05F2DE15, 0x06FFAE39, 0x0FDDFEFD, 0x0CD08ED1, 0x09C71EA5, 0x0ACA6E89,
+	0x04C24D44, 0x07CF3D68, 0x02D8AD1C, 0x01D5DD30, 0x08F78DF4, 0x0BFAFDD8, 0x0EED6DAC, 0x0DE01D80,
+	0x0DBCD85F, 0x0EB1A873, 0x0BA63807, 0x08AB482B, 0x018918EF, 0x028468C3, 0x0793F8B7, 0x049E889B,
+	0x0A96AB56, 0x099BDB7A, 0x0C8C4B0E, 0x0F813B22, 0x06A36BE6, 0x05AE1BCA, 0x00B98BBE, 0x03B4FB92,
+	0x07D07C9A, 0x04DD0CB6, 0x01CA9CC2, 0x02C7ECEE, 0x0BE5BC2A, 0x08E8CC06, 0x0DFF5C72, 0x0EF22C5E,
+	0x00FA0F93, 0x03F77FBF, 0x06E0EFCB, 0x05ED9FE7, 0x0CCFCF23, 0x0FC2BF0F, 0x0AD52F7B, 0x09D85F57,
+	0x09849A88, 0x0A89EAA4, 0x0F9E7AD0, 0x0C930AFC, 0x05B15A38, 0x06BC2A14, 0x03ABBA60, 0x00A6CA4C,
+	0x0EAEE981, 0x0DA399AD, 0x08B409D9, 0x0BB979F5, 0x029B2931, 0x0196591D, 0x0481C969, 0x078CB945,
+	0x043842D7, 0x073532FB, 0x0222A28F, 0x012FD2A3, 0x080D8267, 0x0B00F24B, 0x0E17623F, 0x0D1A1213,
+	0x031231DE, 0x001F41F2, 0x0508D186, 0x0605A1AA, 0x0F27F16E, 0x0C2A8142, 0x093D1136, 0x0A30611A,
+	0x0A6CA4C5, 0x0961D4E9, 0x0C76449D, 0x0F7B34B1, 0x06596475, 0x05541459, 0x0043842D, 0x034EF401,
+	0x0D46D7CC, 0x0E4BA7E0, 0x0B5C3794, 0x085147B8, 0x0173177C, 0x027E6750, 0x0769F724, 0x04648708,
+	0x0FA0F934, 0x0CAD8918, 0x09BA196C, 0x0AB76940, 0x03953984, 0x009849A8, 0x058FD9DC, 0x0682A9F0,
+	0x088A8A3D, 0x0B87FA11, 0x0E906A65, 0x0D9D1A49, 0x04BF4A8D, 0x07B23AA1, 0x02A5AAD5, 0x01A8DAF9,
+	0x01F41F26, 0x02F96F0A, 0x07EEFF7E, 0x04E38F52, 0x0DC1DF96, 0x0ECCAFBA, 0x0BDB3FCE, 0x08D64FE2,
+	0x06DE6C2F, 0x05D31C03, 0x00C48C77, 0x03C9FC5B, 0x0AEBAC9F, 0x09E6DCB3, 0x0CF14CC7, 0x0FFC3CEB,
+	0x0C48C779, 0x0F45B755, 0x0A522721, 0x095F570D, 0x007D07C9, 0x037077E5, 0x0667E791, 0x056A97BD,
+	0x0B62B470, 0x086FC45C, 0x0D785428, 0x0E752404, 0x075774C0, 0x045A04EC, 0x014D9498, 0x0240E4B4,
+	0x021C216B, 0x01115147, 0x0406C133, 0x070BB11F, 0x0E29E1DB, 0x0D2491F7, 0x08330183, 0x0B3E71AF,
+	0x05365262, 0x063B224E, 0x032CB23A, 0x0021C216, 0x090392D2, 0x0A0EE2FE, 0x0F19728A, 0x0C1402A6,
+	0x087085AE, 0x0B7DF582, 0x0E6A65F6, 0x0D6715DA, 0x0445451E, 0x07483532, 0x025FA546, 0x0152D56A,
+	0x0F5AF6A7, 0x0C57868B, 0x094016FF, 0x0A4D66D3, 0x036F3617, 0x0062463B, 0x0575D64F, 0x0678A663,
+	0x062463BC, 0x05291390, 0x003E83E4, 0x0333F3C8, 0x0A11A30C, 0x091CD320, 0x0C0B4354, 0x0F063378,
+	0x010E10B5, 0x02036099, 0x0714F0ED, 0x041980C1, 0x0D3BD005, 0x0E36A029, 0x0B21305D, 0x082C4071,
+	0x0B98BBE3, 0x0895CBCF, 0x0D825BBB, 0x0E8F2B97, 0x07AD7B53, 0x04A00B7F, 0x01B79B0B, 0x02BAEB27,
+	0x0CB2C8EA, 0x0FBFB8C6, 0x0AA828B2, 0x09A5589E, 0x0087085A, 0x038A7876, 0x069DE802, 0x0590982E,
+	0x05CC5DF1, 0x06C12DDD, 0x03D6BDA9, 0x00DBCD85, 0x09F99D41, 0x0AF4ED6D, 0x0FE37D19, 0x0CEE0D35,
+	0x02E62EF8, 0x01EB5ED4, 0x04FCCEA0, 0x07F1BE8C, 0x0ED3EE48, 0x0DDE9E64, 0x08C90E10, 0x0BC47E3C,
+	// Seed 0x4A
+	0x00000000, 0x9AF56C13, 0x19F9893B, 0x830CE528, 0x33F31276, 0xA9067E65, 0x2A0A9B4D, 0xB0FFF75E,
+	0x67E624EC, 0xFD1348FF, 0x7E1FADD7, 0xE4EAC1C4, 0x5415369A, 0xCEE05A89, 0x4DECBFA1, 0xD719D3B2,
+	0xCFCC49D8, 0x553925CB, 0xD635C0E3, 0x4CC0ACF0, 0xFC3F5BAE, 0x66CA37BD, 0xE5C6D295, 0x7F33BE86,
+	0xA82A6D34, 0x32DF0127, 0xB1D3E40F, 0x2B26881C, 0x9BD97F42, 0x012C1351, 0x8220F679, 0x18D59A6A,
+	0xB38BC2AD, 0x297EAEBE, 0xAA724B96, 0x30872785, 0x8078D0DB, 0x1A8DBCC8, 0x998159E0, 0x037435F3,
+	0xD46DE641, 0x4E988A52, 0xCD946F7A, 0x57610369, 0xE79EF437, 0x7D6B9824, 0xFE677D0C, 0x6492111F,
+	0x7C478B75, 0xE6B2E766, 0x65BE024E, 0xFF4B6E5D, 0x4FB49903, 0xD541F510, 0x564D1038, 0xCCB87C2B,
+	0x1BA1AF99, 0x8154C38A, 0x025826A2, 0x98AD4AB1, 0x2852BDEF, 0xB2A7D1FC, 0x31AB34D4, 0xAB5E58C7,
+	0x4B04D447, 0xD1F1B854, 0x52FD5D7C, 0xC808316F, 0x78F7C631, 0xE202AA22, 0x610E4F0A, 0xFBFB2319,
+	0x2CE2F0AB, 0xB6179CB8, 0x351B7990, 0xAFEE1583, 0x1F11E2DD, 0x85E48ECE, 0x06E86BE6, 0x9C1D07F5,
+	0x84C89D9F, 0x1E3DF18C, 0x9D3114A4, 0x07C478B7, 0xB73B8FE9, 0x2DCEE3FA, 0xAEC206D2, 0x34376AC1,
+	0xE32EB973, 0x79DBD560, 0xFAD73048, 0x60225C5B, 0xD0DDAB05, 0x4A28C716, 0xC924223E, 0x53D14E2D,
+	0xF88F16EA, 0x627A7AF9, 0xE1769FD1, 0x7B83F3C2, 0xCB7C049C, 0x5189688F, 0xD2858DA7, 0x4870E1B4,
+	0x9F693206, 0x059C5E15, 0x8690BB3D, 0x1C65D72E, 0xAC9A2070, 0x366F4C63, 0xB563A94B, 0x2F96C558,
+	0x37435F32, 0xADB63321, 0x2EBAD609, 0xB44FBA1A, 0x04B04D44, 0x9E452157, 0x1D49C47F, 0x87BCA86C,
+	0x50A57BDE, 0xCA5017CD, 0x495CF2E5, 0xD3A99EF6, 0x635669A8, 0xF9A305BB, 0x7AAFE093, 0xE05A8C80,
+	0x9609A88E, 0x0CFCC49D, 0x8FF021B5, 0x15054DA6, 0xA5FABAF8, 0x3F0FD6EB, 0xBC0333C3, 0x26F65FD0,
+	0xF1EF8C62, 0x6B1AE071, 0xE8160559, 0x72E3694A, 0xC21C9E14, 0x58E9F207, 0xDBE5172F, 0x41107B3C,
+	0x59C5E156, 0xC3308D45, 0x403C686D, 0xDAC9047E, 0x6A36F320, 0xF0C39F33, 0x73CF7A1B, 0xE93A1608,
+	0x3E23C5BA, 0xA4D6A9A9, 0x27DA4C81, 0xBD2F2092, 0x0DD0D7CC, 0x9725BBDF, 0x14295EF7, 0x8EDC32E4,
+	0x25826A23, 0xBF770630, 0x3C7BE318, 0xA68E8F0B, 0x16717855, 0x8C841446, 0x0F88F16E, 0x957D9D7D,
+	0x42644ECF, 0xD89122DC, 0x5B9DC7F4, 0xC168ABE7, 0x71975CB9, 0xEB6230AA, 0x686ED582, 0xF29BB991,
+	0xEA4E23FB, 0x70BB4FE8, 0xF3B7AAC0, 0x6942C6D3, 0xD9BD318D, 0x43485D9E, 0xC044B8B6, 0x5AB1D4A5,
+	0x8DA80717, 0x175D6B04, 0x94518E2C, 0x0EA4E23F, 0xBE5B1561, 0x24AE7972, 0xA7A29C5A, 0x3D57F049,
+	0xDD0D7CC9, 0x47F810DA, 0xC4F4F5F2, 0x5E0199E1, 0xEEFE6EBF, 0x740B02AC, 0xF707E784, 0x6DF28B97,
+	0xBAEB5825, 0x201E3436, 0xA312D11E, 0x39E7BD0D, 0x89184A53, 0x13ED2640, 0x90E1C368, 0x0A14AF7B,
+	0x12C13511, 0x88345902, 0x0B38BC2A, 0x91CDD039, 0x21322767, 0xBBC74B74, 0x38CBAE5C, 0xA23EC24F,
+	0x752711FD, 0xEFD27DEE, 0x6CDE98C6, 0xF62BF4D5, 0x46D4038B, 0xDC216F98, 0x5F2D8AB0, 0xC5D8E6A3,
+	0x6E86BE64, 0xF473D277, 0x777F375F, 0xED8A5B4C, 0x5D75AC12, 0xC780C001, 0x448C2529, 0xDE79493A,
+	0x09609A88, 0x9395F69B, 0x109913B3, 0x8A6C7FA0, 0x3A9388FE, 0xA066E4ED, 0x236A01C5, 0xB99F6DD6,
+	0xA14AF7BC, 0x3BBF9BAF, 0xB8B37E87, 0x22461294, 0x92B9E5CA, 0x084C89D9, 0x8B406CF1, 0x11B500E2,
+	0xC6ACD350, 0x5C59BF43, 0xDF555A6B, 0x45A03678, 0xF55FC126, 0x6FAAAD35, 0xECA6481D, 0x7653240E,
+	// Seed 0x4B
+	0x00000000, 0x25A06835, 0x4B40D06A, 0x6EE0B85F, 0x9681A0D4, 0xB321C8E1, 0xDDC170BE, 0xF861188B,
+	0xEF1E7199, 0xCABE19AC, 0xA45EA1F3, 0x81FEC9C6, 0x799FD14D, 0x5C3FB978, 0x32DF0127, 0x177F6912,
+	0x1C21D303, 0x3981BB36, 0x57610369, 0x72C16B5C, 0x8AA073D7, 0xAF001BE2, 0xC1E0A3BD, 0xE440CB88,
+	0xF33FA29A, 0xD69FCAAF, 0xB87F72F0, 0x9DDF1AC5, 0x65BE024E, 0x401E6A7B, 0x2EFED224, 0x0B5EBA11,
+	0x3843A606, 0x1DE3CE33, 0x7303766C, 0x56A31E59, 0xAEC206D2, 0x8B626EE7, 0xE582D6B8, 0xC022BE8D,
+	0xD75DD79F, 0xF2FDBFAA, 0x9C1D07F5, 0xB9BD6FC0, 0x41DC774B, 0x647C1F7E, 0x0A9CA721, 0x2F3CCF14,
+	0x24627505, 0x01C21D30, 0x6F22A56F, 0x4A82CD5A, 0xB2E3D5D1, 0x9743BDE4, 0xF9A305BB, 0xDC036D8E,
+	0xCB7C049C, 0xEEDC6CA9, 0x803CD4F6, 0xA59CBCC3, 0x5DFDA448, 0x785DCC7D, 0x16BD7422, 0x331D1C17,
+	0x70874C0C, 0x55272439, 0x3BC79C66, 0x1E67F453, 0xE606ECD8, 0xC3A684ED, 0xAD463CB2, 0x88E65487,
+	0x9F993D95, 0xBA3955A0, 0xD4D9EDFF, 0xF17985CA, 0x09189D41, 0x2CB8F574, 0x42584D2B, 0x67F8251E,
+	0x6CA69F0F, 0x4906F73A, 0x27E64F65, 0x02462750, 0xFA273FDB, 0xDF8757EE, 0xB167EFB1, 0x94C78784,
+	0x83B8EE96, 0xA61886A3, 0xC8F83EFC, 0xED5856C9, 0x15394E42, 0x30992677, 0x5E799E28, 0x7BD9F61D,
+	0x48C4EA0A, 0x6D64823F, 0x03843A60, 0x26245255, 0xDE454ADE, 0xFBE522EB, 0x95059AB4, 0xB0A5F281,
+	0xA7DA9B93, 0x827AF3A6, 0xEC9A4BF9, 0xC93A23CC, 0x315B3B47, 0x14FB5372, 0x7A1BEB2D, 0x5FBB8318,
+	0x54E53909, 0x7145513C, 0x1FA5E963, 0x3A058156, 0xC26499DD, 0xE7C4F1E8, 0x892449B7, 0xAC842182,
+	0xBBFB4890, 0x9E5B20A5, 0xF0BB98FA, 0xD51BF0CF, 0x2D7AE844, 0x08DA8071, 0x663A382E, 0x439A501B,
+	0xE10E9818, 0xC4AEF02D, 0xAA4E4872, 0x8FEE2047, 0x778F38CC, 0x522F50F9, 0x3CCFE8A6, 0x196F8093,
+	0x0E10E981, 0x2BB081B4, 0x455039EB, 0x60F051DE, 0x98914955, 0xBD312160, 0xD3D1993F, 0xF671F10A,
+	0xFD2F4B1B, 0xD88F232E, 0xB66F9B71, 0x93CFF344, 0x6BAEEBCF, 0x4E0E83FA, 0x20EE3BA5, 0x054E5390,
+	0x12313A82, 0x379152B7, 0x5971EAE8, 0x7CD182DD, 0x84B09A56, 0xA110F263, 0xCFF04A3C, 0xEA502209,
+	0xD94D3E1E, 0xFCED562B, 0x920DEE74, 0xB7AD8641, 0x4FCC9ECA, 0x6A6CF6FF, 0x048C4EA0, 0x212C2695,
+	0x36534F87, 0x13F327B2, 0x7D139FED, 0x58B3F7D8, 0xA0D2EF53, 0x85728766, 0xEB923F39, 0xCE32570C,
+	0xC56CED1D, 0xE0CC8528, 0x8E2C3D77, 0xAB8C5542, 0x53ED4DC9, 0x764D25FC, 0x18AD9DA3, 0x3D0DF596,
+	0x2A729C84, 0x0FD2F4B1, 0x61324CEE, 0x449224DB, 0xBCF33C50, 0x99535465, 0xF7B3EC3A, 0xD213840F,
+	0x9189D414, 0xB429BC21, 0xDAC9047E, 0xFF696C4B, 0x070874C0, 0x22A81CF5, 0x4C48A4AA, 0x69E8CC9F,
+	0x7E97A58D, 0x5B37CDB8, 0x35D775E7, 0x10771DD2, 0xE8160559, 0xCDB66D6C, 0xA356D533, 0x86F6BD06,
+	0x8DA80717, 0xA8086F22, 0xC6E8D77D, 0xE348BF48, 0x1B29A7C3, 0x3E89CFF6, 0x506977A9, 0x75C91F9C,
+	0x62B6768E, 0x47161EBB, 0x29F6A6E4, 0x0C56CED1, 0xF437D65A, 0xD197BE6F, 0xBF770630, 0x9AD76E05,
+	0xA9CA7212, 0x8C6A1A27, 0xE28AA278, 0xC72ACA4D, 0x3F4BD2C6, 0x1AEBBAF3, 0x740B02AC, 0x51AB6A99,
+	0x46D4038B, 0x63746BBE, 0x0D94D3E1, 0x2834BBD4, 0xD055A35F, 0xF5F5CB6A, 0x9B157335, 0xBEB51B00,
+	0xB5EBA111, 0x904BC924, 0xFEAB717B, 0xDB0B194E, 0x236A01C5, 0x06CA69F0, 0x682AD1AF, 0x4D8AB99A,
+	0x5AF5D088, 0x7F55B8BD, 0x11B500E2, 0x341568D7, 0xCC74705C, 0xE9D41869, 0x8734A036, 0xA294C803,
+	// Seed 0x4C
+	0x00000000, 0x269A5945, 0x4D34B28A, 0x6BAEEBCF, 0x64BD7E63, 0x42272726, 0x2989CCE9, 0x0F1395AC,
+	0x37AEE7B1, 0x1134BEF4, 0x7A9A553B, 0x5C000C7E, 0x531399D2, 0x7589C097, 0x1E272B58, 0x38BD721D,
+	0x6F5DCF62, 0x49C79627, 0x22697DE8, 0x04F324AD, 0x0BE0B101, 0x2D7AE844, 0x46D4038B, 0x604E5ACE,
+	0x58F328D3, 0x7E697196, 0x15C79A59, 0x335DC31C, 0x3C4E56B0, 0x1AD40FF5, 0x717AE43A, 0x57E0BD7F,
+	0x206F85B3, 0x06F5DCF6, 0x6D5B3739, 0x4BC16E7C, 0x44D2FBD0, 0x6248A295, 0x09E6495A, 0x2F7C101F,
+	0x17C16202, 0x315B3B47, 0x5AF5D088, 0x7C6F89CD, 0x737C1C61, 0x55E64524, 0x3E48AEEB, 0x18D2F7AE,
+	0x4F324AD1, 0x69A81394, 0x0206F85B, 0x249CA11E, 0x2B8F34B2, 0x0D156DF7, 0x66BB8638, 0x4021DF7D,
+	0x789CAD60, 0x5E06F425, 0x35A81FEA, 0x133246AF, 0x1C21D303, 0x3ABB8A46, 0x51156189, 0x778F38CC,
+	0x40DF0B66, 0x66455223, 0x0DEBB9EC, 0x2B71E0A9, 0x24627505, 0x02F82C40, 0x6956C78F, 0x4FCC9ECA,
+	0x7771ECD7, 0x51EBB592, 0x3A455E5D, 0x1CDF0718, 0x13CC92B4, 0x3556CBF1, 0x5EF8203E, 0x7862797B,
+	0x2F82C404, 0x09189D41, 0x62B6768E, 0x442C2FCB, 0x4B3FBA67, 0x6DA5E322, 0x060B08ED, 0x209151A8,
+	0x182C23B5, 0x3EB67AF0, 0x5518913F, 0x7382C87A, 0x7C915DD6, 0x5A0B0493, 0x31A5EF5C, 0x173FB619,
+	0x60B08ED5, 0x462AD790, 0x2D843C5F, 0x0B1E651A, 0x040DF0B6, 0x2297A9F3, 0x4939423C, 0x6FA31B79,
+	0x571E6964, 0x71843021, 0x1A2ADBEE, 0x3CB082AB, 0x33A31707, 0x15394E42, 0x7E97A58D, 0x580DFCC8,
+	0x0FED41B7, 0x297718F2, 0x42D9F33D, 0x6443AA78, 0x6B503FD4, 0x4DCA6691, 0x26648D5E, 0x00FED41B,
+	0x3843A606, 0x1ED9FF43, 0x7577148C, 0x53ED4DC9, 0x5CFED865, 0x7A648120, 0x11CA6AEF, 0x375033AA,
+	0x7F6A0DBB, 0x59F054FE, 0x325EBF31, 0x14C4E674, 0x1BD773D8, 0x3D4D2A9D, 0x56E3C152, 0x70799817,
+	0x48C4EA0A, 0x6E5EB34F, 0x05F05880, 0x236A01C5, 0x2C799469, 0x0AE3CD2C, 0x614D26E3, 0x47D77FA6,
+	0x1037C2D9, 0x36AD9B9C, 0x5D037053, 0x7B992916, 0x748ABCBA, 0x5210E5FF, 0x39BE0E30, 0x1F245775,
+	0x27992568, 0x01037C2D, 0x6AAD97E2, 0x4C37CEA7, 0x43245B0B, 0x65BE024E, 0x0E10E981, 0x288AB0C4,
+	0x5F058808, 0x799FD14D, 0x12313A82, 0x34AB63C7, 0x3BB8F66B, 0x1D22AF2E, 0x768C44E1, 0x50161DA4,
+	0x68AB6FB9, 0x4E3136FC, 0x259FDD33, 0x03058476, 0x0C1611DA, 0x2A8C489F, 0x4122A350, 0x67B8FA15,
+	0x3058476A, 0x16C21E2F, 0x7D6CF5E0, 0x5BF6ACA5, 0x54E53909, 0x727F604C, 0x19D18B83, 0x3F4BD2C6,
+	0x07F6A0DB, 0x216CF99E, 0x4AC21251, 0x6C584B14, 0x634BDEB8, 0x45D187FD, 0x2E7F6C32, 0x08E53577,
+	0x3FB506DD, 0x192F5F98, 0x7281B457, 0x541BED12, 0x5B0878BE, 0x7D9221FB, 0x163CCA34, 0x30A69371,
+	0x081BE16C, 0x2E81B829, 0x452F53E6, 0x63B50AA3, 0x6CA69F0F, 0x4A3CC64A, 0x21922D85, 0x070874C0,
+	0x50E8C9BF, 0x767290FA, 0x1DDC7B35, 0x3B462270, 0x3455B7DC, 0x12CFEE99, 0x79610556, 0x5FFB5C13,
+	0x67462E0E, 0x41DC774B, 0x2A729C84, 0x0CE8C5C1, 0x03FB506D, 0x25610928, 0x4ECFE2E7, 0x6855BBA2,
+	0x1FDA836E, 0x3940DA2B, 0x52EE31E4, 0x747468A1, 0x7B67FD0D, 0x5DFDA448, 0x36534F87, 0x10C916C2,
+	0x287464DF, 0x0EEE3D9A, 0x6540D655, 0x43DA8F10, 0x4CC91ABC, 0x6A5343F9, 0x01FDA836, 0x2767F173,
+	0x70874C0C, 0x561D1549, 0x3DB3FE86, 0x1B29A7C3, 0x143A326F, 0x32A06B2A, 0x590E80E5, 0x7F94D9A0,
+	0x4729ABBD, 0x61B3F2F8, 0x0A1D1937, 0x2C874072, 0x2394D5DE, 0x050E8C9B, 0x6EA06754, 0x483A3E11,
+	// Seed 0x4D
+	0x00000000, 0x081F3A4A, 0x00E40ECF, 0x08FB3485, 0x01C81D9E, 0x09D727D4, 0x012C1351, 0x0933291B,
+	0x03903B3C, 0x0B8F0176, 0x037435F3, 0x0B6B0FB9, 0x025826A2, 0x0A471CE8, 0x02BC286D, 0x0AA31227,
+	0x07207678, 0x0F3F4C32, 0x07C478B7, 0x0FDB42FD, 0x06E86BE6, 0x0EF751AC, 0x060C6529, 0x0E135F63,
+	0x04B04D44, 0x0CAF770E, 0x0454438B, 0x0C4B79C1, 0x057850DA, 0x0D676A90, 0x059C5E15, 0x0D83645F,
+	0x0E40ECF0, 0x065FD6BA, 0x0EA4E23F, 0x06BBD875, 0x0F88F16E, 0x0797CB24, 0x0F6CFFA1, 0x0773C5EB,
+	0x0DD0D7CC, 0x05CFED86, 0x0D34D903, 0x052BE349, 0x0C18CA52, 0x0407F018, 0x0CFCC49D, 0x04E3FED7,
+	0x09609A88, 0x017FA0C2, 0x09849447, 0x019BAE0D, 0x08A88716, 0x00B7BD5C, 0x084C89D9, 0x0053B393,
+	0x0AF0A1B4, 0x02EF9BFE, 0x0A14AF7B, 0x020B9531, 0x0B38BC2A, 0x03278660, 0x0BDCB2E5, 0x03C388AF,
+	0x0C5BA3BB, 0x044499F1, 0x0CBFAD74, 0x04A0973E, 0x0D93BE25, 0x058C846F, 0x0D77B0EA, 0x05688AA0,
+	0x0FCB9887, 0x07D4A2CD, 0x0F2F9648, 0x0730AC02, 0x0E038519, 0x061CBF53, 0x0EE78BD6, 0x06F8B19C,
+	0x0B7BD5C3, 0x0364EF89, 0x0B9FDB0C, 0x0380E146, 0x0AB3C85D, 0x02ACF217, 0x0A57C692, 0x0248FCD8,
+	0x08EBEEFF, 0x00F4D4B5, 0x080FE030, 0x0010DA7A, 0x0923F361, 0x013CC92B, 0x09C7FDAE, 0x01D8C7E4,
+	0x021B4F4B, 0x0A047501, 0x02FF4184, 0x0AE07BCE, 0x03D352D5, 0x0BCC689F, 0x03375C1A, 0x0B286650,
+	0x018B7477, 0x09944E3D, 0x016F7AB8, 0x097040F2, 0x004369E9, 0x085C53A3, 0x00A76726, 0x08B85D6C,
+	0x053B3933, 0x0D240379, 0x05DF37FC, 0x0DC00DB6, 0x04F324AD, 0x0CEC1EE7, 0x04172A62, 0x0C081028,
+	0x06AB020F, 0x0EB43845, 0x064F0CC0, 0x0E50368A, 0x07631F91, 0x0F7C25DB, 0x0787115E, 0x0F982B14,
+	0x086D3D2D, 0x00720767, 0x088933E2, 0x009609A8, 0x09A520B3, 0x01BA1AF9, 0x09412E7C, 0x015E1436,
+	0x0BFD0611, 0x03E23C5B, 0x0B1908DE, 0x03063294, 0x0A351B8F, 0x022A21C5, 0x0AD11540, 0x02CE2F0A,
+	0x0F4D4B55, 0x0752711F, 0x0FA9459A, 0x07B67FD0, 0x0E8556CB, 0x069A6C81, 0x0E615804, 0x067E624E,
+	0x0CDD7069, 0x04C24A23, 0x0C397EA6, 0x042644EC, 0x0D156DF7, 0x050A57BD, 0x0DF16338, 0x05EE5972,
+	0x062DD1DD, 0x0E32EB97, 0x06C9DF12, 0x0ED6E558, 0x07E5CC43, 0x0FFAF609, 0x0701C28C, 0x0F1EF8C6,
+	0x05BDEAE1, 0x0DA2D0AB, 0x0559E42E, 0x0D46DE64, 0x0475F77F, 0x0C6ACD35, 0x0491F9B0, 0x0C8EC3FA,
+	0x010DA7A5, 0x09129DEF, 0x01E9A96A, 0x09F69320, 0x00C5BA3B, 0x08DA8071, 0x0021B4F4, 0x083E8EBE,
+	0x029D9C99, 0x0A82A6D3, 0x02799256, 0x0A66A81C, 0x03558107, 0x0B4ABB4D, 0x03B18FC8, 0x0BAEB582,
+	0x04369E96, 0x0C29A4DC, 0x04D29059, 0x0CCDAA13, 0x05FE8308, 0x0DE1B942, 0x051A8DC7, 0x0D05B78D,
+	0x07A6A5AA, 0x0FB99FE0, 0x0742AB65, 0x0F5D912F, 0x066EB834, 0x0E71827E, 0x068AB6FB, 0x0E958CB1,
+	0x0316E8EE, 0x0B09D2A4, 0x03F2E621, 0x0BEDDC6B, 0x02DEF570, 0x0AC1CF3A, 0x023AFBBF, 0x0A25C1F5,
+	0x0086D3D2, 0x0899E998, 0x0062DD1D, 0x087DE757, 0x014ECE4C, 0x0951F406, 0x01AAC083, 0x09B5FAC9,
+	0x0A767266, 0x0269482C, 0x0A927CA9, 0x028D46E3, 0x0BBE6FF8, 0x03A155B2, 0x0B5A6137, 0x03455B7D,
+	0x09E6495A, 0x01F97310, 0x09024795, 0x011D7DDF, 0x082E54C4, 0x00316E8E, 0x08CA5A0B, 0x00D56041,
+	0x0D56041E, 0x05493E54, 0x0DB20AD1, 0x05AD309B, 0x0C9E1980, 0x048123CA, 0x0C7A174F, 0x04652D05,
+	0x0EC63F22, 0x06D90568, 0x0E2231ED, 0x063D0BA7, 0x0F0E22BC, 0x071118F6, 0x0FEA2C73, 0x07F51639,
+	// Seed 0x4E
+	0x00000000, 0x802FB86E, 0x2297A9F3, 0xA2B8119D, 0x452F53E6, 0xC500EB88, 0x67B8FA15, 0xE797427B,
+	0x8A5EA7CC, 0x0A711FA2, 0xA8C90E3F, 0x28E6B651, 0xCF71F42A, 0x4F5E4C44, 0xEDE65DD9, 0x6DC9E5B7,
+	0x367596B7, 0xB65A2ED9, 0x14E23F44, 0x94CD872A, 0x735AC551, 0xF3757D3F, 0x51CD6CA2, 0xD1E2D4CC,
+	0xBC2B317B, 0x3C048915, 0x9EBC9888, 0x1E9320E6, 0xF904629D, 0x792BDAF3, 0xDB93CB6E, 0x5BBC7300,
+	0x6CEB2D6E, 0xECC49500, 0x4E7C849D, 0xCE533CF3, 0x29C47E88, 0xA9EBC6E6, 0x0B53D77B, 0x8B7C6F15,
+	0xE6B58AA2, 0x669A32CC, 0xC4222351, 0x440D9B3F, 0xA39AD944, 0x23B5612A, 0x810D70B7, 0x0122C8D9,
+	0x5A9EBBD9, 0xDAB103B7, 0x7809122A, 0xF826AA44, 0x1FB1E83F, 0x9F9E5051, 0x3D2641CC, 0xBD09F9A2,
+	0xD0C01C15, 0x50EFA47B, 0xF257B5E6, 0x72780D88, 0x95EF4FF3, 0x15C0F79D, 0xB778E600, 0x37575E6E,
+	0xD9D65ADC, 0x59F9E2B2, 0xFB41F32F, 0x7B6E4B41, 0x9CF9093A, 0x1CD6B154, 0xBE6EA0C9, 0x3E4118A7,
+	0x5388FD10, 0xD3A7457E, 0x711F54E3, 0xF130EC8D, 0x16A7AEF6, 0x96881698, 0x34300705, 0xB41FBF6B,
+	0xEFA3CC6B, 0x6F8C7405, 0xCD346598, 0x4D1BDDF6, 0xAA8C9F8D, 0x2AA327E3, 0x881B367E, 0x08348E10,
+	0x65FD6BA7, 0xE5D2D3C9, 0x476AC254, 0xC7457A3A, 0x20D23841, 0xA0FD802F, 0x024591B2, 0x826A29DC,
+	0xB53D77B2, 0x3512CFDC, 0x97AADE41, 0x1785662F, 0xF0122454, 0x703D9C3A, 0xD2858DA7, 0x52AA35C9,
+	0x3F63D07E, 0xBF4C6810, 0x1DF4798D, 0x9DDBC1E3, 0x7A4C8398, 0xFA633BF6, 0x58DB2A6B, 0xD8F49205,
+	0x8348E105, 0x0367596B, 0xA1DF48F6, 0x21F0F098, 0xC667B2E3, 0x46480A8D, 0xE4F01B10, 0x64DFA37E,
+	0x091646C9, 0x8939FEA7, 0x2B81EF3A, 0xABAE5754, 0x4C39152F, 0xCC16AD41, 0x6EAEBCDC, 0xEE8104B2,
+	0x91646C97, 0x114BD4F9, 0xB3F3C564, 0x33DC7D0A, 0xD44B3F71, 0x5464871F, 0xF6DC9682, 0x76F32EEC,
+	0x1B3ACB5B, 0x9B157335, 0x39AD62A8, 0xB982DAC6, 0x5E1598BD, 0xDE3A20D3, 0x7C82314E, 0xFCAD8920,
+	0xA711FA20, 0x273E424E, 0x858653D3, 0x05A9EBBD, 0xE23EA9C6, 0x621111A8, 0xC0A90035, 0x4086B85B,
+	0x2D4F5DEC, 0xAD60E582, 0x0FD8F41F, 0x8FF74C71, 0x68600E0A, 0xE84FB664, 0x4AF7A7F9, 0xCAD81F97,
+	0xFD8F41F9, 0x7DA0F997, 0xDF18E80A, 0x5F375064, 0xB8A0121F, 0x388FAA71, 0x9A37BBEC, 0x1A180382,
+	0x77D1E635, 0xF7FE5E5B, 0x55464FC6, 0xD569F7A8, 0x32FEB5D3, 0xB2D10DBD, 0x10691C20, 0x9046A44E,
+	0xCBFAD74E, 0x4BD56F20, 0xE96D7EBD, 0x6942C6D3, 0x8ED584A8, 0x0EFA3CC6, 0xAC422D5B, 0x2C6D9535,
+	0x41A47082, 0xC18BC8EC, 0x6333D971, 0xE31C611F, 0x048B2364, 0x84A49B0A, 0x261C8A97, 0xA63332F9,
+	0x48B2364B, 0xC89D8E25, 0x6A259FB8, 0xEA0A27D6, 0x0D9D65AD, 0x8DB2DDC3, 0x2F0ACC5E, 0xAF257430,
+	0xC2EC9187, 0x42C329E9, 0xE07B3874, 0x6054801A, 0x87C3C261, 0x07EC7A0F, 0xA5546B92, 0x257BD3FC,
+	0x7EC7A0FC, 0xFEE81892, 0x5C50090F, 0xDC7FB161, 0x3BE8F31A, 0xBBC74B74, 0x197F5AE9, 0x9950E287,
+	0xF4990730, 0x74B6BF5E, 0xD60EAEC3, 0x562116AD, 0xB1B654D6, 0x3199ECB8, 0x9321FD25, 0x130E454B,
+	0x24591B25, 0xA476A34B, 0x06CEB2D6, 0x86E10AB8, 0x617648C3, 0xE159F0AD, 0x43E1E130, 0xC3CE595E,
+	0xAE07BCE9, 0x2E280487, 0x8C90151A, 0x0CBFAD74, 0xEB28EF0F, 0x6B075761, 0xC9BF46FC, 0x4990FE92,
+	0x122C8D92, 0x920335FC, 0x30BB2461, 0xB0949C0F, 0x5703DE74, 0xD72C661A, 0x75947787, 0xF5BBCFE9,
+	0x98722A5E, 0x185D9230, 0xBAE583AD, 0x3ACA3BC3, 0xDD5D79B8, 0x5D72C1D6, 0xFFCAD04B, 0x7FE56825,
+	// Seed 0x4F
+	0x00000000, 0xBB062A69, 0xBACAECD1, 0x01CCC6B8, 0xB95361A1, 0x02554BC8, 0x03998D70, 0xB89FA719,
+	0xBE607B41, 0x05665128, 0x04AA9790, 0xBFACBDF9, 0x07331AE0, 0xBC353089, 0xBDF9F631, 0x06FFDC58,
+	0xB0064E81, 0x0B0064E8, 0x0ACCA250, 0xB1CA8839, 0x09552F20, 0xB2530549, 0xB39FC3F1, 0x0899E998,
+	0x0E6635C0, 0xB5601FA9, 0xB4ACD911, 0x0FAAF378, 0xB7355461, 0x0C337E08, 0x0DFFB8B0, 0xB6F992D9,
+	0xACCA2501, 0x17CC0F68, 0x1600C9D0, 0xAD06E3B9, 0x159944A0, 0xAE9F6EC9, 0xAF53A871, 0x14558218,
+	0x12AA5E40, 0xA9AC7429, 0xA860B291, 0x136698F8, 0xABF93FE1, 0x10FF1588, 0x1133D330, 0xAA35F959,
+	0x1CCC6B80, 0xA7CA41E9, 0xA6068751, 0x1D00AD38, 0xA59F0A21, 0x1E992048, 0x1F55E6F0, 0xA453CC99,
+	0xA2AC10C1, 0x19AA3AA8, 0x1866FC10, 0xA360D679, 0x1BFF7160, 0xA0F95B09, 0xA1359DB1, 0x1A33B7D8,
+	0x9552F201, 0x2E54D868, 0x2F981ED0, 0x949E34B9, 0x2C0193A0, 0x9707B9C9, 0x96CB7F71, 0x2DCD5518,
+	0x2B328940, 0x9034A329, 0x91F86591, 0x2AFE4FF8, 0x9261E8E1, 0x2967C288, 0x28AB0430, 0x93AD2E59,
+	0x2554BC80, 0x9E5296E9, 0x9F9E5051, 0x24987A38, 0x9C07DD21, 0x2701F748, 0x26CD31F0, 0x9DCB1B99,
+	0x9B34C7C1, 0x2032EDA8, 0x21FE2B10, 0x9AF80179, 0x2267A660, 0x99618C09, 0x98AD4AB1, 0x23AB60D8,
+	0x3998D700, 0x829EFD69, 0x83523BD1, 0x385411B8, 0x80CBB6A1, 0x3BCD9CC8, 0x3A015A70, 0x81077019,
+	0x87F8AC41, 0x3CFE8628, 0x3D324090, 0x86346AF9, 0x3EABCDE0, 0x85ADE789, 0x84612131, 0x3F670B58,
+	0x899E9981, 0x3298B3E8, 0x33547550, 0x88525F39, 0x30CDF820, 0x8BCBD249, 0x8A0714F1, 0x31013E98,
+	0x37FEE2C0, 0x8CF8C8A9, 0x8D340E11, 0x36322478, 0x8EAD8361, 0x35ABA908, 0x34676FB0, 0x8F6145D9,
+	0xE6635C01, 0x5D657668, 0x5CA9B0D0, 0xE7AF9AB9, 0x5F303DA0, 0xE43617C9, 0xE5FAD171, 0x5EFCFB18,
+	0x58032740, 0xE3050D29, 0xE2C9CB91, 0x59CFE1F8, 0xE15046E1, 0x5A566C88, 0x5B9AAA30, 0xE09C8059,
+	0x56651280, 0xED6338E9, 0xECAFFE51, 0x57A9D438, 0xEF367321, 0x54305948, 0x55FC9FF0, 0xEEFAB599,
+	0xE80569C1, 0x530343A8, 0x52CF8510, 0xE9C9AF79, 0x51560860, 0xEA502209, 0xEB9CE4B1, 0x509ACED8,
+	0x4AA97900, 0xF1AF5369, 0xF06395D1, 0x4B65BFB8, 0xF3FA18A1, 0x48FC32C8, 0x4930F470, 0xF236DE19,
+	0xF4C90241, 0x4FCF2828, 0x4E03EE90, 0xF505C4F9, 0x4D9A63E0, 0xF69C4989, 0xF7508F31, 0x4C56A558,
+	0xFAAF3781, 0x41A91DE8, 0x4065DB50, 0xFB63F139, 0x43FC5620, 0xF8FA7C49, 0xF936BAF1, 0x42309098,
+	0x44CF4CC0, 0xFFC966A9, 0xFE05A011, 0x45038A78, 0xFD9C2D61, 0x469A0708, 0x4756C1B0, 0xFC50EBD9,
+	0x7331AE00, 0xC8378469, 0xC9FB42D1, 0x72FD68B8, 0xCA62CFA1, 0x7164E5C8, 0x70A82370, 0xCBAE0919,
+	0xCD51D541, 0x7657FF28, 0x779B3990, 0xCC9D13F9, 0x7402B4E0, 0xCF049E89, 0xCEC85831, 0x75CE7258,
+	0xC337E081, 0x7831CAE8, 0x79FD0C50, 0xC2FB2639, 0x7A648120, 0xC162AB49, 0xC0AE6DF1, 0x7BA84798,
+	0x7D579BC0, 0xC651B1A9, 0xC79D7711, 0x7C9B5D78, 0xC404FA61, 0x7F02D008, 0x7ECE16B0, 0xC5C83CD9,
+	0xDFFB8B01, 0x64FDA168, 0x653167D0, 0xDE374DB9, 0x66A8EAA0, 0xDDAEC0C9, 0xDC620671, 0x67642C18,
+	0x619BF040, 0xDA9DDA29, 0xDB511C91, 0x605736F8, 0xD8C891E1, 0x63CEBB88, 0x62027D30, 0xD9045759,
+	0x6FFDC580, 0xD4FBEFE9, 0xD5372951, 0x6E310338, 0xD6AEA421, 0x6DA88E48, 0x6C6448F0, 0xD7626299,
+	0xD19DBEC1, 0x6A9B94A8, 0x6B575210, 0xD0517879, 0x68CEDF60, 0xD3C8F509, 0xD20433B1, 0x690219D8,
+	// Seed 0x50
+	0x00000000, 0x77D1E635, 0x39756F83, 0x4EA489B6, 0x72EADF06, 0x053B3933, 0x4B9FB085, 0x3C4E56B0,
+	0x33031DE5, 0x44D2FBD0, 0x0A767266, 0x7DA79453, 0x41E9C2E3, 0x363824D6, 0x789CAD60, 0x0F4D4B55,
+	0x66063BCA, 0x11D7DDFF, 0x5F735449, 0x28A2B27C, 0x14ECE4CC, 0x633D02F9, 0x2D998B4F, 0x5A486D7A,
+	0x5505262F, 0x22D4C01A, 0x6C7049AC, 0x1BA1AF99, 0x27EFF929, 0x503E1F1C, 0x1E9A96AA, 0x694B709F,
+	0x1ADAD47D, 0x6D0B3248, 0x23AFBBFE, 0x547E5DCB, 0x68300B7B, 0x1FE1ED4E, 0x514564F8, 0x269482CD,
+	0x29D9C998, 0x5E082FAD, 0x10ACA61B, 0x677D402E, 0x5B33169E, 0x2CE2F0AB, 0x6246791D, 0x15979F28,
+	0x7CDCEFB7, 0x0B0D0982, 0x45A98034, 0x32786601, 0x0E3630B1, 0x79E7D684, 0x37435F32, 0x4092B907,
+	0x4FDFF252, 0x380E1467, 0x76AA9DD1, 0x017B7BE4, 0x3D352D54, 0x4AE4CB61, 0x044042D7, 0x7391A4E2,
+	0x35B5A8FA, 0x42644ECF, 0x0CC0C779, 0x7B11214C, 0x475F77FC, 0x308E91C9, 0x7E2A187F, 0x09FBFE4A,
+	0x06B6B51F, 0x7167532A, 0x3FC3DA9C, 0x48123CA9, 0x745C6A19, 0x038D8C2C, 0x4D29059A, 0x3AF8E3AF,
+	0x53B39330, 0x24627505, 0x6AC6FCB3, 0x1D171A86, 0x21594C36, 0x5688AA03, 0x182C23B5, 0x6FFDC580,
+	0x60B08ED5, 0x176168E0, 0x59C5E156, 0x2E140763, 0x125A51D3, 0x658BB7E6, 0x2B2F3E50, 0x5CFED865,
+	0x2F6F7C87, 0x58BE9AB2, 0x161A1304, 0x61CBF531, 0x5D85A381, 0x2A5445B4, 0x64F0CC02, 0x13212A37,
+	0x1C6C6162, 0x6BBD8757, 0x25190EE1, 0x52C8E8D4, 0x6E86BE64, 0x19575851, 0x57F3D1E7, 0x202237D2,
+	0x4969474D, 0x3EB8A178, 0x701C28CE, 0x07CDCEFB, 0x3B83984B, 0x4C527E7E, 0x02F6F7C8, 0x752711FD,
+	0x7A6A5AA8, 0x0DBBBC9D, 0x431F352B, 0x34CED31E, 0x088085AE, 0x7F51639B, 0x31F5EA2D, 0x46240C18,
+	0x6B6B51F4, 0x1CBAB7C1, 0x521E3E77, 0x25CFD842, 0x19818EF2, 0x6E5068C7, 0x20F4E171, 0x57250744,
+	0x58684C11, 0x2FB9AA24, 0x611D2392, 0x16CCC5A7, 0x2A829317, 0x5D537522, 0x13F7FC94, 0x64261AA1,
+	0x0D6D6A3E, 0x7ABC8C0B, 0x341805BD, 0x43C9E388, 0x7F87B538, 0x0856530D, 0x46F2DABB, 0x31233C8E,
+	0x3E6E77DB, 0x49BF91EE, 0x071B1858, 0x70CAFE6D, 0x4C84A8DD, 0x3B554EE8, 0x75F1C75E, 0x0220216B,
+	0x71B18589, 0x066063BC, 0x48C4EA0A, 0x3F150C3F, 0x035B5A8F, 0x748ABCBA, 0x3A2E350C, 0x4DFFD339,
+	0x42B2986C, 0x35637E59, 0x7BC7F7EF, 0x0C1611DA, 0x3058476A, 0x4789A15F, 0x092D28E9, 0x7EFCCEDC,
+	0x17B7BE43, 0x60665876, 0x2EC2D1C0, 0x591337F5, 0x655D6145, 0x128C8770, 0x5C280EC6, 0x2BF9E8F3,
+	0x24B4A3A6, 0x53654593, 0x1DC1CC25, 0x6A102A10, 0x565E7CA0, 0x218F9A95, 0x6F2B1323, 0x18FAF516,
+	0x5EDEF90E, 0x290F1F3B, 0x67AB968D, 0x107A70B8, 0x2C342608, 0x5BE5C03D, 0x1541498B, 0x6290AFBE,
+	0x6DDDE4EB, 0x1A0C02DE, 0x54A88B68, 0x23796D5D, 0x1F373BED, 0x68E6DDD8, 0x2642546E, 0x5193B25B,
+	0x38D8C2C4, 0x4F0924F1, 0x01ADAD47, 0x767C4B72, 0x4A321DC2, 0x3DE3FBF7, 0x73477241, 0x04969474,
+	0x0BDBDF21, 0x7C0A3914, 0x32AEB0A2, 0x457F5697, 0x79310027, 0x0EE0E612, 0x40446FA4, 0x37958991,
+	0x44042D73, 0x33D5CB46, 0x7D7142F0, 0x0AA0A4C5, 0x36EEF275, 0x413F1440, 0x0F9B9DF6, 0x784A7BC3,
+	0x77073096, 0x00D6D6A3, 0x4E725F15, 0x39A3B920, 0x05EDEF90, 0x723C09A5, 0x3C988013, 0x4B496626,
+	0x220216B9, 0x55D3F08C, 0x1B77793A, 0x6CA69F0F, 0x50E8C9BF, 0x27392F8A, 0x699DA63C, 0x1E4C4009,
+	0x11010B5C, 0x66D0ED69, 0x287464DF, 0x5FA582EA, 0x63EBD45A, 0x143A326F, 0x5A9EBBD9, 0x2D4F5DEC,
+	// Seed 0x51
+	0x00000000, 0x1F3A5687, 0x06AC6FCB, 0x1996394C, 0x0D58DF96, 0x12628911, 0x0BF4B05D, 0x14CEE6DA,
+	0x1AB1BF2C, 0x058BE9AB, 0x1C1DD0E7, 0x03278660, 0x17E960BA, 0x08D3363D, 0x11450F71, 0x0E7F59F6,
+	0x0DBBBC9D, 0x1281EA1A, 0x0B17D356, 0x142D85D1, 0x00E3630B, 0x1FD9358C, 0x064F0CC0, 0x19755A47,
+	0x170A03B1, 0x08305536, 0x11A66C7A, 0x0E9C3AFD, 0x1A52DC27, 0x05688AA0, 0x1CFEB3EC, 0x03C4E56B,
+	0x1B77793A, 0x044D2FBD, 0x1DDB16F1, 0x02E14076, 0x162FA6AC, 0x0915F02B, 0x1083C967, 0x0FB99FE0,
+	0x01C6C616, 0x1EFC9091, 0x076AA9DD, 0x1850FF5A, 0x0C9E1980, 0x13A44F07, 0x0A32764B, 0x150820CC,
+	0x16CCC5A7, 0x09F69320, 0x1060AA6C, 0x0F5AFCEB, 0x1B941A31, 0x04AE4CB6, 0x1D3875FA, 0x0202237D,
+	0x0C7D7A8B, 0x13472C0C, 0x0AD11540, 0x15EB43C7, 0x0125A51D, 0x1E1FF39A, 0x0789CAD6, 0x18B39C51,
+	0x0E3630B1, 0x110C6636, 0x089A5F7A, 0x17A009FD, 0x036EEF27, 0x1C54B9A0, 0x05C280EC, 0x1AF8D66B,
+	0x14878F9D, 0x0BBDD91A, 0x122BE056, 0x0D11B6D1, 0x19DF500B, 0x06E5068C, 0x1F733FC0, 0x00496947,
+	0x038D8C2C, 0x1CB7DAAB, 0x0521E3E7, 0x1A1BB560, 0x0ED553BA, 0x11EF053D, 0x08793C71, 0x17436AF6,
+	0x193C3300, 0x06066587, 0x1F905CCB, 0x00AA0A4C, 0x1464EC96, 0x0B5EBA11, 0x12C8835D, 0x0DF2D5DA,
+	0x1541498B, 0x0A7B1F0C, 0x13ED2640, 0x0CD770C7, 0x1819961D, 0x0723C09A, 0x1EB5F9D6, 0x018FAF51,
+	0x0FF0F6A7, 0x10CAA020, 0x095C996C, 0x1666CFEB, 0x02A82931, 0x1D927FB6, 0x040446FA, 0x1B3E107D,
+	0x18FAF516, 0x07C0A391, 0x1E569ADD, 0x016CCC5A, 0x15A22A80, 0x0A987C07, 0x130E454B, 0x0C3413CC,
+	0x024B4A3A, 0x1D711CBD, 0x04E725F1, 0x1BDD7376, 0x0F1395AC, 0x1029C32B, 0x09BFFA67, 0x1685ACE0,
+	0x1C6C6162, 0x035637E5, 0x1AC00EA9, 0x05FA582E, 0x1134BEF4, 0x0E0EE873, 0x1798D13F, 0x08A287B8,
+	0x06DDDE4E, 0x19E788C9, 0x0071B185, 0x1F4BE702, 0x0B8501D8, 0x14BF575F, 0x0D296E13, 0x12133894,
+	0x11D7DDFF, 0x0EED8B78, 0x177BB234, 0x0841E4B3, 0x1C8F0269, 0x03B554EE, 0x1A236DA2, 0x05193B25,
+	0x0B6662D3, 0x145C3454, 0x0DCA0D18, 0x12F05B9F, 0x063EBD45, 0x1904EBC2, 0x0092D28E, 0x1FA88409,
+	0x071B1858, 0x18214EDF, 0x01B77793, 0x1E8D2114, 0x0A43C7CE, 0x15799149, 0x0CEFA805, 0x13D5FE82,
+	0x1DAAA774, 0x0290F1F3, 0x1B06C8BF, 0x043C9E38, 0x10F278E2, 0x0FC82E65, 0x165E1729, 0x096441AE,
+	0x0AA0A4C5, 0x159AF242, 0x0C0CCB0E, 0x13369D89, 0x07F87B53, 0x18C22DD4, 0x01541498, 0x1E6E421F,
+	0x10111BE9, 0x0F2B4D6E, 0x16BD7422, 0x098722A5, 0x1D49C47F, 0x027392F8, 0x1BE5ABB4, 0x04DFFD33,
+	0x125A51D3, 0x0D600754, 0x14F63E18, 0x0BCC689F, 0x1F028E45, 0x0038D8C2, 0x19AEE18E, 0x0694B709,
+	0x08EBEEFF, 0x17D1B878, 0x0E478134, 0x117DD7B3, 0x05B33169, 0x1A8967EE, 0x031F5EA2, 0x1C250825,
+	0x1FE1ED4E, 0x00DBBBC9, 0x194D8285, 0x0677D402, 0x12B932D8, 0x0D83645F, 0x14155D13, 0x0B2F0B94,
+	0x05505262, 0x1A6A04E5, 0x03FC3DA9, 0x1CC66B2E, 0x08088DF4, 0x1732DB73, 0x0EA4E23F, 0x119EB4B8,
+	0x092D28E9, 0x16177E6E, 0x0F814722, 0x10BB11A5, 0x0475F77F, 0x1B4FA1F8, 0x02D998B4, 0x1DE3CE33,
+	0x139C97C5, 0x0CA6C142, 0x1530F80E, 0x0A0AAE89, 0x1EC44853, 0x01FE1ED4, 0x18682798, 0x0752711F,
+	0x04969474, 0x1BACC2F3, 0x023AFBBF, 0x1D00AD38, 0x09CE4BE2, 0x16F41D65, 0x0F622429, 0x105872AE,
+	0x1E272B58, 0x011D7DDF, 0x188B4493, 0x07B11214, 0x137FF4CE, 0x0C45A249, 0x15D39B05, 0x0AE9CD82,
+	// Seed 0x52
+	0x00000000, 0xB59A1094, 0x61FE4099, 0xD464500D, 0xC3FC8132, 0x766691A6, 0xA202C1AB, 0x1798D13F,
+	0x8D3363D5, 0x38A97341, 0xECCD234C, 0x595733D8, 0x4ECFE2E7, 0xFB55F273, 0x2F31A27E, 0x9AABB2EA,
+	0x10ACA61B, 0xA536B68F, 0x7152E682, 0xC4C8F616, 0xD3502729, 0x66CA37BD, 0xB2AE67B0, 0x07347724,
+	0x9D9FC5CE, 0x2805D55A, 0xFC618557, 0x49FB95C3, 0x5E6344FC, 0xEBF95468, 0x3F9D0465, 0x8A0714F1,
+	0x21594C36, 0x94C35CA2, 0x40A70CAF, 0xF53D1C3B, 0xE2A5CD04, 0x573FDD90, 0x835B8D9D, 0x36C19D09,
+	0xAC6A2FE3, 0x19F03F77, 0xCD946F7A, 0x780E7FEE, 0x6F96AED1, 0xDA0CBE45, 0x0E68EE48, 0xBBF2FEDC,
+	0x31F5EA2D, 0x846FFAB9, 0x500BAAB4, 0xE591BA20, 0xF2096B1F, 0x47937B8B, 0x93F72B86, 0x266D3B12,
+	0xBCC689F8, 0x095C996C, 0xDD38C961, 0x68A2D9F5, 0x7F3A08CA, 0xCAA0185E, 0x1EC44853, 0xAB5E58C7,
+	0x42B2986C, 0xF72888F8, 0x234CD8F5, 0x96D6C861, 0x814E195E, 0x34D409CA, 0xE0B059C7, 0x552A4953,
+	0xCF81FBB9, 0x7A1BEB2D, 0xAE7FBB20, 0x1BE5ABB4, 0x0C7D7A8B, 0xB9E76A1F, 0x6D833A12, 0xD8192A86,
+	0x521E3E77, 0xE7842EE3, 0x33E07EEE, 0x867A6E7A, 0x91E2BF45, 0x2478AFD1, 0xF01CFFDC, 0x4586EF48,
+	0xDF2D5DA2, 0x6AB74D36, 0xBED31D3B, 0x0B490DAF, 0x1CD1DC90, 0xA94BCC04, 0x7D2F9C09, 0xC8B58C9D,
+	0x63EBD45A, 0xD671C4CE, 0x021594C3, 0xB78F8457, 0xA0175568, 0x158D45FC, 0xC1E915F1, 0x74730565,
+	0xEED8B78F, 0x5B42A71B, 0x8F26F716, 0x3ABCE782, 0x2D2436BD, 0x98BE2629, 0x4CDA7624, 0xF94066B0,
+	0x73477241, 0xC6DD62D5, 0x12B932D8, 0xA723224C, 0xB0BBF373, 0x0521E3E7, 0xD145B3EA, 0x64DFA37E,
+	0xFE741194, 0x4BEE0100, 0x9F8A510D, 0x2A104199, 0x3D8890A6, 0x88128032, 0x5C76D03F, 0xE9ECC0AB,
+	0x856530D8, 0x30FF204C, 0xE49B7041, 0x510160D5, 0x4699B1EA, 0xF303A17E, 0x2767F173, 0x92FDE1E7,
+	0x0856530D, 0xBDCC4399, 0x69A81394, 0xDC320300, 0xCBAAD23F, 0x7E30C2AB, 0xAA5492A6, 0x1FCE8232,
+	0x95C996C3, 0x20538657, 0xF437D65A, 0x41ADC6CE, 0x563517F1, 0xE3AF0765, 0x37CB5768, 0x825147FC,
+	0x18FAF516, 0xAD60E582, 0x7904B58F, 0xCC9EA51B, 0xDB067424, 0x6E9C64B0, 0xBAF834BD, 0x0F622429,
+	0xA43C7CEE, 0x11A66C7A, 0xC5C23C77, 0x70582CE3, 0x67C0FDDC, 0xD25AED48, 0x063EBD45, 0xB3A4ADD1,
+	0x290F1F3B, 0x9C950FAF, 0x48F15FA2, 0xFD6B4F36, 0xEAF39E09, 0x5F698E9D, 0x8B0DDE90, 0x3E97CE04,
+	0xB490DAF5, 0x010ACA61, 0xD56E9A6C, 0x60F48AF8, 0x776C5BC7, 0xC2F64B53, 0x16921B5E, 0xA3080BCA,
+	0x39A3B920, 0x8C39A9B4, 0x585DF9B9, 0xEDC7E92D, 0xFA5F3812, 0x4FC52886, 0x9BA1788B, 0x2E3B681F,
+	0xC7D7A8B4, 0x724DB820, 0xA629E82D, 0x13B3F8B9, 0x042B2986, 0xB1B13912, 0x65D5691F, 0xD04F798B,
+	0x4AE4CB61, 0xFF7EDBF5, 0x2B1A8BF8, 0x9E809B6C, 0x89184A53, 0x3C825AC7, 0xE8E60ACA, 0x5D7C1A5E,
+	0xD77B0EAF, 0x62E11E3B, 0xB6854E36, 0x031F5EA2, 0x14878F9D, 0xA11D9F09, 0x7579CF04, 0xC0E3DF90,
+	0x5A486D7A, 0xEFD27DEE, 0x3BB62DE3, 0x8E2C3D77, 0x99B4EC48, 0x2C2EFCDC, 0xF84AACD1, 0x4DD0BC45,
+	0xE68EE482, 0x5314F416, 0x8770A41B, 0x32EAB48F, 0x257265B0, 0x90E87524, 0x448C2529, 0xF11635BD,
+	0x6BBD8757, 0xDE2797C3, 0x0A43C7CE, 0xBFD9D75A, 0xA8410665, 0x1DDB16F1, 0xC9BF46FC, 0x7C255668,
+	0xF6224299, 0x43B8520D, 0x97DC0200, 0x22461294, 0x35DEC3AB, 0x8044D33F, 0x54208332, 0xE1BA93A6,
+	0x7B11214C, 0xCE8B31D8, 0x1AEF61D5, 0xAF757141, 0xB8EDA07E, 0x0D77B0EA, 0xD913E0E7, 0x6C89F073,
+	// Seed 0x53
+	0x00000000, 0x0951F406, 0x12A3E80C, 0x1BF21C0A, 0x2547D018, 0x2C16241E, 0x37E43814, 0x3EB5CC12,
+	0x4A8FA030, 0x43DE5436, 0x582C483C, 0x517DBC3A, 0x6FC87028, 0x6699842E, 0x7D6B9824, 0x743A6C22,
+	0x951F4060, 0x9C4EB466, 0x87BCA86C, 0x8EED5C6A, 0xB0589078, 0xB909647E, 0xA2FB7874, 0xABAA8C72,
+	0xDF90E050, 0xD6C11456, 0xCD33085C, 0xC462FC5A, 0xFAD73048, 0xF386C44E, 0xE874D844, 0xE1252C42,
+	0xCEFA805D, 0xC7AB745B, 0xDC596851, 0xD5089C57, 0xEBBD5045, 0xE2ECA443, 0xF91EB849, 0xF04F4C4F,
+	0x8475206D, 0x8D24D46B, 0x96D6C861, 0x9F873C67, 0xA132F075, 0xA8630473, 0xB3911879, 0xBAC0EC7F,
+	0x5BE5C03D, 0x52B4343B, 0x49462831, 0x4017DC37, 0x7EA21025, 0x77F3E423, 0x6C01F829, 0x65500C2F,
+	0x116A600D, 0x183B940B, 0x03C98801, 0x0A987C07, 0x342DB015, 0x3D7C4413, 0x268E5819, 0x2FDFAC1F,
+	0x79310027, 0x7060F421, 0x6B92E82B, 0x62C31C2D, 0x5C76D03F, 0x55272439, 0x4ED53833, 0x4784CC35,
+	0x33BEA017, 0x3AEF5411, 0x211D481B, 0x284CBC1D, 0x16F9700F, 0x1FA88409, 0x045A9803, 0x0D0B6C05,
+	0xEC2E4047, 0xE57FB441, 0xFE8DA84B, 0xF7DC5C4D, 0xC969905F, 0xC0386459, 0xDBCA7853, 0xD29B8C55,
+	0xA6A1E077, 0xAFF01471, 0xB402087B, 0xBD53FC7D, 0x83E6306F, 0x8AB7C469, 0x9145D863, 0x98142C65,
+	0xB7CB807A, 0xBE9A747C, 0xA5686876, 0xAC399C70, 0x928C5062, 0x9BDDA464, 0x802FB86E, 0x897E4C68,
+	0xFD44204A, 0xF415D44C, 0xEFE7C846, 0xE6B63C40, 0xD803F052, 0xD1520454, 0xCAA0185E, 0xC3F1EC58,
+	0x22D4C01A, 0x2B85341C, 0x30772816, 0x3926DC10, 0x07931002, 0x0EC2E404, 0x1530F80E, 0x1C610C08,
+	0x685B602A, 0x610A942C, 0x7AF88826, 0x73A97C20, 0x4D1CB032, 0x444D4434, 0x5FBF583E, 0x56EEAC38,
+	0xF262004E, 0xFB33F448, 0xE0C1E842, 0xE9901C44, 0xD725D056, 0xDE742450, 0xC586385A, 0xCCD7CC5C,
+	0xB8EDA07E, 0xB1BC5478, 0xAA4E4872, 0xA31FBC74, 0x9DAA7066, 0x94FB8460, 0x8F09986A, 0x86586C6C,
+	0x677D402E, 0x6E2CB428, 0x75DEA822, 0x7C8F5C24, 0x423A9036, 0x4B6B6430, 0x5099783A, 0x59C88C3C,
+	0x2DF2E01E, 0x24A31418, 0x3F510812, 0x3600FC14, 0x08B53006, 0x01E4C400, 0x1A16D80A, 0x13472C0C,
+	0x3C988013, 0x35C97415, 0x2E3B681F, 0x276A9C19, 0x19DF500B, 0x108EA40D, 0x0B7CB807, 0x022D4C01,
+	0x76172023, 0x7F46D425, 0x64B4C82F, 0x6DE53C29, 0x5350F03B, 0x5A01043D, 0x41F31837, 0x48A2EC31,
+	0xA987C073, 0xA0D63475, 0xBB24287F, 0xB275DC79, 0x8CC0106B, 0x8591E46D, 0x9E63F867, 0x97320C61,
+	0xE3086043, 0xEA599445, 0xF1AB884F, 0xF8FA7C49, 0xC64FB05B, 0xCF1E445D, 0xD4EC5857, 0xDDBDAC51,
+	0x8B530069, 0x8202F46F, 0x99F0E865, 0x90A11C63, 0xAE14D071, 0xA7452477, 0xBCB7387D, 0xB5E6CC7B,
+	0xC1DCA059, 0xC88D545F, 0xD37F4855, 0xDA2EBC53, 0xE49B7041, 0xEDCA8447, 0xF638984D, 0xFF696C4B,
+	0x1E4C4009, 0x171DB40F, 0x0CEFA805, 0x05BE5C03, 0x3B0B9011, 0x325A6417, 0x29A8781D, 0x20F98C1B,
+	0x54C3E039, 0x5D92143F, 0x46600835, 0x4F31FC33, 0x71843021, 0x78D5C427, 0x6327D82D, 0x6A762C2B,
+	0x45A98034, 0x4CF87432, 0x570A6838, 0x5E5B9C3E, 0x60EE502C, 0x69BFA42A, 0x724DB820, 0x7B1C4C26,
+	0x0F262004, 0x0677D402, 0x1D85C808, 0x14D43C0E, 0x2A61F01C, 0x2330041A, 0x38C21810, 0x3193EC16,
+	0xD0B6C054, 0xD9E73452, 0xC2152858, 0xCB44DC5E, 0xF5F1104C, 0xFCA0E44A, 0xE752F840, 0xEE030C46,
+	0x9A396064, 0x93689462, 0x889A8868, 0x81CB7C6E, 0xBF7EB07C, 0xB62F447A, 0xADDD5870, 0xA48CAC76,
+	// Seed 0x54
+	0x00000000, 0x020823D3, 0x041047A6, 0x06186475, 0x08208F4C, 0x0A28AC9F, 0x0C30C8EA, 0x0E38EB39,
+	0x10411E98, 0x12493D4B, 0x1451593E, 0x16597AED, 0x186191D4, 0x1A69B207, 0x1C71D672, 0x1E79F5A1,
+	0x20823D30, 0x228A1EE3, 0x24927A96, 0x269A5945, 0x28A2B27C, 0x2AAA91AF, 0x2CB2F5DA, 0x2EBAD609,
+	0x30C323A8, 0x32CB007B, 0x34D3640E, 0x36DB47DD, 0x38E3ACE4, 0x3AEB8F37, 0x3CF3EB42, 0x3EFBC891,
+	0x41047A60, 0x430C59B3, 0x45143DC6, 0x471C1E15, 0x4924F52C, 0x4B2CD6FF, 0x4D34B28A, 0x4F3C9159,
+	0x514564F8, 0x534D472B, 0x5555235E, 0x575D008D, 0x5965EBB4, 0x5B6DC867, 0x5D75AC12, 0x5F7D8FC1,
+	0x61864750, 0x638E6483, 0x659600F6, 0x679E2325, 0x69A6C81C, 0x6BAEEBCF, 0x6DB68FBA, 0x6FBEAC69,
+	0x71C759C8, 0x73CF7A1B, 0x75D71E6E, 0x77DF3DBD, 0x79E7D684, 0x7BEFF557, 0x7DF79122, 0x7FFFB2F1,
+	0x5A05DF1B, 0x580DFCC8, 0x5E1598BD, 0x5C1DBB6E, 0x52255057, 0x502D7384, 0x563517F1, 0x543D3422,
+	0x4A44C183, 0x484CE250, 0x4E548625, 0x4C5CA5F6, 0x42644ECF, 0x406C6D1C, 0x46740969, 0x447C2ABA,
+	0x7A87E22B, 0x788FC1F8, 0x7E97A58D, 0x7C9F865E, 0x72A76D67, 0x70AF4EB4, 0x76B72AC1, 0x74BF0912,
+	0x6AC6FCB3, 0x68CEDF60, 0x6ED6BB15, 0x6CDE98C6, 0x62E673FF, 0x60EE502C, 0x66F63459, 0x64FE178A,
+	0x1B01A57B, 0x190986A8, 0x1F11E2DD, 0x1D19C10E, 0x13212A37, 0x112909E4, 0x17316D91, 0x15394E42,
+	0x0B40BBE3, 0x09489830, 0x0F50FC45, 0x0D58DF96, 0x036034AF, 0x0168177C, 0x07707309, 0x057850DA,
+	0x3B83984B, 0x398BBB98, 0x3F93DFED, 0x3D9BFC3E, 0x33A31707, 0x31AB34D4, 0x37B350A1, 0x35BB7372,
+	0x2BC286D3, 0x29CAA500, 0x2FD2C175, 0x2DDAE2A6, 0x23E2099F, 0x21EA2A4C, 0x27F24E39, 0x25FA6DEA,
+	0x6C0695ED, 0x6E0EB63E, 0x6816D24B, 0x6A1EF198, 0x64261AA1, 0x662E3972, 0x60365D07, 0x623E7ED4,
+	0x7C478B75, 0x7E4FA8A6, 0x7857CCD3, 0x7A5FEF00, 0x74670439, 0x766F27EA, 0x7077439F, 0x727F604C,
+	0x4C84A8DD, 0x4E8C8B0E, 0x4894EF7B, 0x4A9CCCA8, 0x44A42791, 0x46AC0442, 0x40B46037, 0x42BC43E4,
+	0x5CC5B645, 0x5ECD9596, 0x58D5F1E3, 0x5ADDD230, 0x54E53909, 0x56ED1ADA, 0x50F57EAF, 0x52FD5D7C,
+	0x2D02EF8D, 0x2F0ACC5E, 0x2912A82B, 0x2B1A8BF8, 0x252260C1, 0x272A4312, 0x21322767, 0x233A04B4,
+	0x3D43F115, 0x3F4BD2C6, 0x3953B6B3, 0x3B5B9560, 0x35637E59, 0x376B5D8A, 0x317339FF, 0x337B1A2C,
+	0x0D80D2BD, 0x0F88F16E, 0x0990951B, 0x0B98B6C8, 0x05A05DF1, 0x07A87E22, 0x01B01A57, 0x03B83984,
+	0x1DC1CC25, 0x1FC9EFF6, 0x19D18B83, 0x1BD9A850, 0x15E14369, 0x17E960BA, 0x11F104CF, 0x13F9271C,
+	0x36034AF6, 0x340B6925, 0x32130D50, 0x301B2E83, 0x3E23C5BA, 0x3C2BE669, 0x3A33821C, 0x383BA1CF,
+	0x2642546E, 0x244A77BD, 0x225213C8, 0x205A301B, 0x2E62DB22, 0x2C6AF8F1, 0x2A729C84, 0x287ABF57,
+	0x168177C6, 0x14895415, 0x12913060, 0x109913B3, 0x1EA1F88A, 0x1CA9DB59, 0x1AB1BF2C, 0x18B99CFF,
+	0x06C0695E, 0x04C84A8D, 0x02D02EF8, 0x00D80D2B, 0x0EE0E612, 0x0CE8C5C1, 0x0AF0A1B4, 0x08F88267,
+	0x77073096, 0x750F1345, 0x73177730, 0x711F54E3, 0x7F27BFDA, 0x7D2F9C09, 0x7B37F87C, 0x793FDBAF,
+	0x67462E0E, 0x654E0DDD, 0x635669A8, 0x615E4A7B, 0x6F66A142, 0x6D6E8291, 0x6B76E6E4, 0x697EC537,
+	0x57850DA6, 0x558D2E75, 0x53954A00, 0x519D69D3, 0x5FA582EA, 0x5DADA139, 0x5BB5C54C, 0x59BDE69F,
+	0x47C4133E, 0x45CC30ED, 0x43D45498, 0x41DC774B, 0x4FE49C72, 0x4DECBFA1, 0x4BF4DBD4, 0x49FCF807,
+	// Seed 0x55
+	0x00000000, 0x11AB0110, 0x155548D7, 0x04FE49C7, 0x1CA9DB59, 0x0D02DA49, 0x09FC938E, 0x1857929E,
+	0x0F50FC45, 0x1EFBFD55, 0x1A05B492, 0x0BAEB582, 0x13F9271C, 0x0252260C, 0x06AC6FCB, 0x17076EDB,
+	0x1EA1F88A, 0x0F0AF99A, 0x0BF4B05D, 0x1A5FB14D, 0x020823D3, 0x13A322C3, 0x175D6B04, 0x06F66A14,
+	0x11F104CF, 0x005A05DF, 0x04A44C18, 0x150F4D08, 0x0D58DF96, 0x1CF3DE86, 0x180D9741, 0x09A69651,
+	0x0B40BBE3, 0x1AEBBAF3, 0x1E15F334, 0x0FBEF224, 0x17E960BA, 0x064261AA, 0x02BC286D, 0x1317297D,
+	0x041047A6, 0x15BB46B6, 0x11450F71, 0x00EE0E61, 0x18B99CFF, 0x09129DEF, 0x0DECD428, 0x1C47D538,
+	0x15E14369, 0x044A4279, 0x00B40BBE, 0x111F0AAE, 0x09489830, 0x18E39920, 0x1C1DD0E7, 0x0DB6D1F7,
+	0x1AB1BF2C, 0x0B1ABE3C, 0x0FE4F7FB, 0x1E4FF6EB, 0x06186475, 0x17B36565, 0x134D2CA2, 0x02E62DB2,
+	0x168177C6, 0x072A76D6, 0x03D43F11, 0x127F3E01, 0x0A28AC9F, 0x1B83AD8F, 0x1F7DE448, 0x0ED6E558,
+	0x19D18B83, 0x087A8A93, 0x0C84C354, 0x1D2FC244, 0x057850DA, 0x14D351CA, 0x102D180D, 0x0186191D,
+	0x08208F4C, 0x198B8E5C, 0x1D75C79B, 0x0CDEC68B, 0x14895415, 0x05225505, 0x01DC1CC2, 0x10771DD2,
+	0x07707309, 0x16DB7219, 0x12253BDE, 0x038E3ACE, 0x1BD9A850, 0x0A72A940, 0x0E8CE087, 0x1F27E197,
+	0x1DC1CC25, 0x0C6ACD35, 0x089484F2, 0x193F85E2, 0x0168177C, 0x10C3166C, 0x143D5FAB, 0x05965EBB,
+	0x12913060, 0x033A3170, 0x07C478B7, 0x166F79A7, 0x0E38EB39, 0x1F93EA29, 0x1B6DA3EE, 0x0AC6A2FE,
+	0x036034AF, 0x12CB35BF, 0x16357C78, 0x079E7D68, 0x1FC9EFF6, 0x0E62EEE6, 0x0A9CA721, 0x1B37A631,
+	0x0C30C8EA, 0x1D9BC9FA, 0x1965803D, 0x08CE812D, 0x109913B3, 0x013212A3, 0x05CC5B64, 0x14675A74,
+	0x1B01A57B, 0x0AAAA46B, 0x0E54EDAC, 0x1FFFECBC, 0x07A87E22, 0x16037F32, 0x12FD36F5, 0x035637E5,
+	0x1451593E, 0x05FA582E, 0x010411E9, 0x10AF10F9, 0x08F88267, 0x19538377, 0x1DADCAB0, 0x0C06CBA0,
+	0x05A05DF1, 0x140B5CE1, 0x10F51526, 0x015E1436, 0x190986A8, 0x08A287B8, 0x0C5CCE7F, 0x1DF7CF6F,
+	0x0AF0A1B4, 0x1B5BA0A4, 0x1FA5E963, 0x0E0EE873, 0x16597AED, 0x07F27BFD, 0x030C323A, 0x12A7332A,
+	0x10411E98, 0x01EA1F88, 0x0514564F, 0x14BF575F, 0x0CE8C5C1, 0x1D43C4D1, 0x19BD8D16, 0x08168C06,
+	0x1F11E2DD, 0x0EBAE3CD, 0x0A44AA0A, 0x1BEFAB1A, 0x03B83984, 0x12133894, 0x16ED7153, 0x07467043,
+	0x0EE0E612, 0x1F4BE702, 0x1BB5AEC5, 0x0A1EAFD5, 0x12493D4B, 0x03E23C5B, 0x071C759C, 0x16B7748C,
+	0x01B01A57, 0x101B1B47, 0x14E55280, 0x054E5390, 0x1D19C10E, 0x0CB2C01E, 0x084C89D9, 0x19E788C9,
+	0x0D80D2BD, 0x1C2BD3AD, 0x18D59A6A, 0x097E9B7A, 0x112909E4, 0x008208F4, 0x047C4133, 0x15D74023,
+	0x02D02EF8, 0x137B2FE8, 0x1785662F, 0x062E673F, 0x1E79F5A1, 0x0FD2F4B1, 0x0B2CBD76, 0x1A87BC66,
+	0x13212A37, 0x028A2B27, 0x067462E0, 0x17DF63F0, 0x0F88F16E, 0x1E23F07E, 0x1ADDB9B9, 0x0B76B8A9,
+	0x1C71D672, 0x0DDAD762, 0x09249EA5, 0x188F9FB5, 0x00D80D2B, 0x11730C3B, 0x158D45FC, 0x042644EC,
+	0x06C0695E, 0x176B684E, 0x13952189, 0x023E2099, 0x1A69B207, 0x0BC2B317, 0x0F3CFAD0, 0x1E97FBC0,
+	0x0990951B, 0x183B940B, 0x1CC5DDCC, 0x0D6EDCDC, 0x15394E42, 0x04924F52, 0x006C0695, 0x11C70785,
+	0x186191D4, 0x09CA90C4, 0x0D34D903, 0x1C9FD813, 0x04C84A8D, 0x15634B9D, 0x119D025A, 0x0036034A,
+	0x17316D91, 0x069A6C81, 0x02642546, 0x13CF2456, 0x0B98B6C8, 0x1A33B7D8, 0x1ECDFE1F, 0x0F66FF0F,
+	// Seed 0x56
+	0x00000000, 0x7EFBA318, 0xFDF74630, 0x830CE528, 0xFFFF65E3, 0x8104C6FB, 0x020823D3, 0x7CF380CB,
+	0xFBEF2245, 0x8514815D, 0x06186475, 0x78E3C76D, 0x041047A6, 0x7AEBE4BE, 0xF9E70196, 0x871CA28E,
+	0xF3CFAD09, 0x8D340E11, 0x0E38EB39, 0x70C34821, 0x0C30C8EA, 0x72CB6BF2, 0xF1C78EDA, 0x8F3C2DC2,
+	0x08208F4C, 0x76DB2C54, 0xF5D7C97C, 0x8B2C6A64, 0xF7DFEAAF, 0x892449B7, 0x0A28AC9F, 0x74D30F87,
+	0xE38EB391, 0x9D751089, 0x1E79F5A1, 0x608256B9, 0x1C71D672, 0x628A756A, 0xE1869042, 0x9F7D335A,
+	0x186191D4, 0x669A32CC, 0xE596D7E4, 0x9B6D74FC, 0xE79EF437, 0x9965572F, 0x1A69B207, 0x6492111F,
+	0x10411E98, 0x6EBABD80, 0xEDB658A8, 0x934DFBB0, 0xEFBE7B7B, 0x9145D863, 0x12493D4B, 0x6CB29E53,
+	0xEBAE3CDD, 0x95559FC5, 0x16597AED, 0x68A2D9F5, 0x1451593E, 0x6AAAFA26, 0xE9A61F0E, 0x975DBC16,
+	0xC30C8EA1, 0xBDF72DB9, 0x3EFBC891, 0x40006B89, 0x3CF3EB42, 0x4208485A, 0xC104AD72, 0xBFFF0E6A,
+	0x38E3ACE4, 0x46180FFC, 0xC514EAD4, 0xBBEF49CC, 0xC71CC907, 0xB9E76A1F, 0x3AEB8F37, 0x44102C2F,
+	0x30C323A8, 0x4E3880B0, 0xCD346598, 0xB3CFC680, 0xCF3C464B, 0xB1C7E553, 0x32CB007B, 0x4C30A363,
+	0xCB2C01ED, 0xB5D7A2F5, 0x36DB47DD, 0x4820E4C5, 0x34D3640E, 0x4A28C716, 0xC924223E, 0xB7DF8126,
+	0x20823D30, 0x5E799E28, 0xDD757B00, 0xA38ED818, 0xDF7D58D3, 0xA186FBCB, 0x228A1EE3, 0x5C71BDFB,
+	0xDB6D1F75, 0xA596BC6D, 0x269A5945, 0x5861FA5D, 0x24927A96, 0x5A69D98E, 0xD9653CA6, 0xA79E9FBE,
+	0xD34D9039, 0xADB63321, 0x2EBAD609, 0x50417511, 0x2CB2F5DA, 0x524956C2, 0xD145B3EA, 0xAFBE10F2,
+	0x28A2B27C, 0x56591164, 0xD555F44C, 0xABAE5754, 0xD75DD79F, 0xA9A67487, 0x2AAA91AF, 0x545132B7,
+	0x8208F4C1, 0xFCF357D9, 0x7FFFB2F1, 0x010411E9, 0x7DF79122, 0x030C323A, 0x8000D712, 0xFEFB740A,
+	0x79E7D684, 0x071C759C, 0x841090B4, 0xFAEB33AC, 0x8618B367, 0xF8E3107F, 0x7BEFF557, 0x0514564F,
+	0x71C759C8, 0x0F3CFAD0, 0x8C301FF8, 0xF2CBBCE0, 0x8E383C2B, 0xF0C39F33, 0x73CF7A1B, 0x0D34D903,
+	0x8A287B8D, 0xF4D3D895, 0x77DF3DBD, 0x09249EA5, 0x75D71E6E, 0x0B2CBD76, 0x8820585E, 0xF6DBFB46,
+	0x61864750, 0x1F7DE448, 0x9C710160, 0xE28AA278, 0x9E7922B3, 0xE08281AB, 0x638E6483, 0x1D75C79B,
+	0x9A696515, 0xE492C60D, 0x679E2325, 0x1965803D, 0x659600F6, 0x1B6DA3EE, 0x986146C6, 0xE69AE5DE,
+	0x9249EA59, 0xECB24941, 0x6FBEAC69, 0x11450F71, 0x6DB68FBA, 0x134D2CA2, 0x9041C98A, 0xEEBA6A92,
+	0x69A6C81C, 0x175D6B04, 0x94518E2C, 0xEAAA2D34, 0x9659ADFF, 0xE8A20EE7, 0x6BAEEBCF, 0x155548D7,
+	0x41047A60, 0x3FFFD978, 0xBCF33C50, 0xC2089F48, 0xBEFB1F83, 0xC000BC9B, 0x430C59B3, 0x3DF7FAAB,
+	0xBAEB5825, 0xC410FB3D, 0x471C1E15, 0x39E7BD0D, 0x45143DC6, 0x3BEF9EDE, 0xB8E37BF6, 0xC618D8EE,
+	0xB2CBD769, 0xCC307471, 0x4F3C9159, 0x31C73241, 0x4D34B28A, 0x33CF1192, 0xB0C3F4BA, 0xCE3857A2,
+	0x4924F52C, 0x37DF5634, 0xB4D3B31C, 0xCA281004, 0xB6DB90CF, 0xC82033D7, 0x4B2CD6FF, 0x35D775E7,
+	0xA28AC9F1, 0xDC716AE9, 0x5F7D8FC1, 0x21862CD9, 0x5D75AC12, 0x238E0F0A, 0xA082EA22, 0xDE79493A,
+	0x5965EBB4, 0x279E48AC, 0xA492AD84, 0xDA690E9C, 0xA69A8E57, 0xD8612D4F, 0x5B6DC867, 0x25966B7F,
+	0x514564F8, 0x2FBEC7E0, 0xACB222C8, 0xD24981D0, 0xAEBA011B, 0xD041A203, 0x534D472B, 0x2DB6E433,
+	0xAAAA46BD, 0xD451E5A5, 0x575D008D, 0x29A6A395, 0x5555235E, 0x2BAE8046, 0xA8A2656E, 0xD659C676,
+	// Seed 0x57
+	0x00000000, 0x1C9FD813, 0x393FB026, 0x25A06835, 0x727F604C, 0x6EE0B85F, 0x4B40D06A, 0x57DF0879,
+	0xE4FEC098, 0xF861188B, 0xDDC170BE, 0xC15EA8AD, 0x9681A0D4, 0x8A1E78C7, 0xAFBE10F2, 0xB321C8E1,
+	0x23E2099F, 0x3F7DD18C, 0x1ADDB9B9, 0x064261AA, 0x519D69D3, 0x4D02B1C0, 0x68A2D9F5, 0x743D01E6,
+	0xC71CC907, 0xDB831114, 0xFE237921, 0xE2BCA132, 0xB563A94B, 0xA9FC7158, 0x8C5C196D, 0x90C3C17E,
+	0x47C4133E, 0x5B5BCB2D, 0x7EFBA318, 0x62647B0B, 0x35BB7372, 0x2924AB61, 0x0C84C354, 0x101B1B47,
+	0xA33AD3A6, 0xBFA50BB5, 0x9A056380, 0x869ABB93, 0xD145B3EA, 0xCDDA6BF9, 0xE87A03CC, 0xF4E5DBDF,
+	0x64261AA1, 0x78B9C2B2, 0x5D19AA87, 0x41867294, 0x16597AED, 0x0AC6A2FE, 0x2F66CACB, 0x33F912D8,
+	0x80D8DA39, 0x9C47022A, 0xB9E76A1F, 0xA578B20C, 0xF2A7BA75, 0xEE386266, 0xCB980A53, 0xD707D240,
+	0x8F88267C, 0x9317FE6F, 0xB6B7965A, 0xAA284E49, 0xFDF74630, 0xE1689E23, 0xC4C8F616, 0xD8572E05,
+	0x6B76E6E4, 0x77E93EF7, 0x524956C2, 0x4ED68ED1, 0x190986A8, 0x05965EBB, 0x2036368E, 0x3CA9EE9D,
+	0xAC6A2FE3, 0xB0F5F7F0, 0x95559FC5, 0x89CA47D6, 0xDE154FAF, 0xC28A97BC, 0xE72AFF89, 0xFBB5279A,
+	0x4894EF7B, 0x540B3768, 0x71AB5F5D, 0x6D34874E, 0x3AEB8F37, 0x26745724, 0x03D43F11, 0x1F4BE702,
+	0xC84C3542, 0xD4D3ED51, 0xF1738564, 0xEDEC5D77, 0xBA33550E, 0xA6AC8D1D, 0x830CE528, 0x9F933D3B,
+	0x2CB2F5DA, 0x302D2DC9, 0x158D45FC, 0x09129DEF, 0x5ECD9596, 0x42524D85, 0x67F225B0, 0x7B6DFDA3,
+	0xEBAE3CDD, 0xF731E4CE, 0xD2918CFB, 0xCE0E54E8, 0x99D15C91, 0x854E8482, 0xA0EEECB7, 0xBC7134A4,
+	0x0F50FC45, 0x13CF2456, 0x366F4C63, 0x2AF09470, 0x7D2F9C09, 0x61B0441A, 0x44102C2F, 0x588FF43C,
+	0xF50FC457, 0xE9901C44, 0xCC307471, 0xD0AFAC62, 0x8770A41B, 0x9BEF7C08, 0xBE4F143D, 0xA2D0CC2E,
+	0x11F104CF, 0x0D6EDCDC, 0x28CEB4E9, 0x34516CFA, 0x638E6483, 0x7F11BC90, 0x5AB1D4A5, 0x462E0CB6,
+	0xD6EDCDC8, 0xCA7215DB, 0xEFD27DEE, 0xF34DA5FD, 0xA492AD84, 0xB80D7597, 0x9DAD1DA2, 0x8132C5B1,
+	0x32130D50, 0x2E8CD543, 0x0B2CBD76, 0x17B36565, 0x406C6D1C, 0x5CF3B50F, 0x7953DD3A, 0x65CC0529,
+	0xB2CBD769, 0xAE540F7A, 0x8BF4674F, 0x976BBF5C, 0xC0B4B725, 0xDC2B6F36, 0xF98B0703, 0xE514DF10,
+	0x563517F1, 0x4AAACFE2, 0x6F0AA7D7, 0x73957FC4, 0x244A77BD, 0x38D5AFAE, 0x1D75C79B, 0x01EA1F88,
+	0x9129DEF6, 0x8DB606E5, 0xA8166ED0, 0xB489B6C3, 0xE356BEBA, 0xFFC966A9, 0xDA690E9C, 0xC6F6D68F,
+	0x75D71E6E, 0x6948C67D, 0x4CE8AE48, 0x5077765B, 0x07A87E22, 0x1B37A631, 0x3E97CE04, 0x22081617,
+	0x7A87E22B, 0x66183A38, 0x43B8520D, 0x5F278A1E, 0x08F88267, 0x14675A74, 0x31C73241, 0x2D58EA52,
+	0x9E7922B3, 0x82E6FAA0, 0xA7469295, 0xBBD94A86, 0xEC0642FF, 0xF0999AEC, 0xD539F2D9, 0xC9A62ACA,
+	0x5965EBB4, 0x45FA33A7, 0x605A5B92, 0x7CC58381, 0x2B1A8BF8, 0x378553EB, 0x12253BDE, 0x0EBAE3CD,
+	0xBD9B2B2C, 0xA104F33F, 0x84A49B0A, 0x983B4319, 0xCFE44B60, 0xD37B9373, 0xF6DBFB46, 0xEA442355,
+	0x3D43F115, 0x21DC2906, 0x047C4133, 0x18E39920, 0x4F3C9159, 0x53A3494A, 0x7603217F, 0x6A9CF96C,
+	0xD9BD318D, 0xC522E99E, 0xE08281AB, 0xFC1D59B8, 0xABC251C1, 0xB75D89D2, 0x92FDE1E7, 0x8E6239F4,
+	0x1EA1F88A, 0x023E2099, 0x279E48AC, 0x3B0190BF, 0x6CDE98C6, 0x704140D5, 0x55E128E0, 0x497EF0F3,
+	0xFA5F3812, 0xE6C0E001, 0xC3608834, 0xDFFF5027, 0x8820585E, 0x94BF804D, 0xB11FE878, 0xAD80306B,
+	// Seed 0x58
+	0x00000000, 0x0997F1D9, 0x132FE3B2, 0x1AB8126B, 0x265FC764, 0x2FC836BD, 0x357024D6, 0x3CE7D50F,
+	0x4CBF8EC8, 0x45287F11, 0x5F906D7A, 0x56079CA3, 0x6AE049AC, 0x6377B875, 0x79CFAA1E, 0x70585BC7,
+	0x5E1EAE1D, 0x57895FC4, 0x4D314DAF, 0x44A6BC76, 0x78416979, 0x71D698A0, 0x6B6E8ACB, 0x62F97B12,
+	0x12A120D5, 0x1B36D10C, 0x018EC367, 0x081932BE, 0x34FEE7B1, 0x3D691668, 0x27D10403, 0x2E46F5DA,
+	0x7B5CEFB7, 0x72CB1E6E, 0x68730C05, 0x61E4FDDC, 0x5D0328D3, 0x5494D90A, 0x4E2CCB61, 0x47BB3AB8,
+	0x37E3617F, 0x3E7490A6, 0x24CC82CD, 0x2D5B7314, 0x11BCA61B, 0x182B57C2, 0x029345A9, 0x0B04B470,
+	0x254241AA, 0x2CD5B073, 0x366DA218, 0x3FFA53C1, 0x031D86CE, 0x0A8A7717, 0x1032657C, 0x19A594A5,
+	0x69FDCF62, 0x606A3EBB, 0x7AD22CD0, 0x7345DD09, 0x4FA20806, 0x4635F9DF, 0x5C8DEBB4, 0x551A1A6D,
+	0x31D86CE3, 0x384F9D3A, 0x22F78F51, 0x2B607E88, 0x1787AB87, 0x1E105A5E, 0x04A84835, 0x0D3FB9EC,
+	0x7D67E22B, 0x74F013F2, 0x6E480199, 0x67DFF040, 0x5B38254F, 0x52AFD496, 0x4817C6FD, 0x41803724,
+	0x6FC6C2FE, 0x66513327, 0x7CE9214C, 0x757ED095, 0x4999059A, 0x400EF443, 0x5AB6E628, 0x532117F1,
+	0x23794C36, 0x2AEEBDEF, 0x3056AF84, 0x39C15E5D, 0x05268B52, 0x0CB17A8B, 0x160968E0, 0x1F9E9939,
+	0x4A848354, 0x4313728D, 0x59AB60E6, 0x503C913F, 0x6CDB4430, 0x654CB5E9, 0x7FF4A782, 0x7663565B,
+	0x063B0D9C, 0x0FACFC45, 0x1514EE2E, 0x1C831FF7, 0x2064CAF8, 0x29F33B21, 0x334B294A, 0x3ADCD893,
+	0x149A2D49, 0x1D0DDC90, 0x07B5CEFB, 0x0E223F22, 0x32C5EA2D, 0x3B521BF4, 0x21EA099F, 0x287DF846,
+	0x5825A381, 0x51B25258, 0x4B0A4033, 0x429DB1EA, 0x7E7A64E5, 0x77ED953C, 0x6D558757, 0x64C2768E,
+	0x63B0D9C6, 0x6A27281F, 0x709F3A74, 0x7908CBAD, 0x45EF1EA2, 0x4C78EF7B, 0x56C0FD10, 0x5F570CC9,
+	0x2F0F570E, 0x2698A6D7, 0x3C20B4BC, 0x35B74565, 0x0950906A, 0x00C761B3, 0x1A7F73D8, 0x13E88201,
+	0x3DAE77DB, 0x34398602, 0x2E819469, 0x271665B0, 0x1BF1B0BF, 0x12664166, 0x08DE530D, 0x0149A2D4,
+	0x7111F913, 0x788608CA, 0x623E1AA1, 0x6BA9EB78, 0x574E3E77, 0x5ED9CFAE, 0x4461DDC5, 0x4DF62C1C,
+	0x18EC3671, 0x117BC7A8, 0x0BC3D5C3, 0x0254241A, 0x3EB3F115, 0x372400CC, 0x2D9C12A7, 0x240BE37E,
+	0x5453B8B9, 0x5DC44960, 0x477C5B0B, 0x4EEBAAD2, 0x720C7FDD, 0x7B9B8E04, 0x61239C6F, 0x68B46DB6,
+	0x46F2986C, 0x4F6569B5, 0x55DD7BDE, 0x5C4A8A07, 0x60AD5F08, 0x693AAED1, 0x7382BCBA, 0x7A154D63,
+	0x0A4D16A4, 0x03DAE77D, 0x1962F516, 0x10F504CF, 0x2C12D1C0, 0x25852019, 0x3F3D3272, 0x36AAC3AB,
+	0x5268B525, 0x5BFF44FC, 0x41475697, 0x48D0A74E, 0x74377241, 0x7DA08398, 0x671891F3, 0x6E8F602A,
+	0x1ED73BED, 0x1740CA34, 0x0DF8D85F, 0x046F2986, 0x3888FC89, 0x311F0D50, 0x2BA71F3B, 0x2230EEE2,
+	0x0C761B38, 0x05E1EAE1, 0x1F59F88A, 0x16CE0953, 0x2A29DC5C, 0x23BE2D85, 0x39063FEE, 0x3091CE37,
+	0x40C995F0, 0x495E6429, 0x53E67642, 0x5A71879B, 0x66965294, 0x6F01A34D, 0x75B9B126, 0x7C2E40FF,
+	0x29345A92, 0x20A3AB4B, 0x3A1BB920, 0x338C48F9, 0x0F6B9DF6, 0x06FC6C2F, 0x1C447E44, 0x15D38F9D,
+	0x658BD45A, 0x6C1C2583, 0x76A437E8, 0x7F33C631, 0x43D4133E, 0x4A43E2E7, 0x50FBF08C, 0x596C0155,
+	0x772AF48F, 0x7EBD0556, 0x6405173D, 0x6D92E6E4, 0x517533EB, 0x58E2C232, 0x425AD059, 0x4BCD2180,
+	0x3B957A47, 0x32028B9E, 0x28BA99F5, 0x212D682C, 0x1DCABD23, 0x145D4CFA, 0x0EE55E91, 0x0772AF48,
+	// Seed 0x59
+	0x00000000, 0x163F7CD6, 0x09112B0D, 0x1F2E57DB, 0x1222561A, 0x041D2ACC, 0x1B337D17, 0x0D0C01C1,
+	0x012B7E95, 0x17140243, 0x083A5598, 0x1E05294E, 0x1309288F, 0x05365459, 0x1A180382, 0x0C277F54,
+	0x0256FD2A, 0x146981FC, 0x0B47D627, 0x1D78AAF1, 0x1074AB30, 0x064BD7E6, 0x1965803D, 0x0F5AFCEB,
+	0x037D83BF, 0x1542FF69, 0x0A6CA8B2, 0x1C53D464, 0x115FD5A5, 0x0760A973, 0x184EFEA8, 0x0E71827E,
+	0x04ADFA54, 0x12928682, 0x0DBCD159, 0x1B83AD8F, 0x168FAC4E, 0x00B0D098, 0x1F9E8743, 0x09A1FB95,
+	0x058684C1, 0x13B9F817, 0x0C97AFCC, 0x1AA8D31A, 0x17A4D2DB, 0x019BAE0D, 0x1EB5F9D6, 0x088A8500,
+	0x06FB077E, 0x10C47BA8, 0x0FEA2C73, 0x19D550A5, 0x14D95164, 0x02E62DB2, 0x1DC87A69, 0x0BF706BF,
+	0x07D079EB, 0x11EF053D, 0x0EC152E6, 0x18FE2E30, 0x15F22FF1, 0x03CD5327, 0x1CE304FC, 0x0ADC782A,
+	0x095BF4A8, 0x1F64887E, 0x004ADFA5, 0x1675A373, 0x1B79A2B2, 0x0D46DE64, 0x126889BF, 0x0457F569,
+	0x08708A3D, 0x1E4FF6EB, 0x0161A130, 0x175EDDE6, 0x1A52DC27, 0x0C6DA0F1, 0x1343F72A, 0x057C8BFC,
+	0x0B0D0982, 0x1D327554, 0x021C228F, 0x14235E59, 0x192F5F98, 0x0F10234E, 0x103E7495, 0x06010843,
+	0x0A267717, 0x1C190BC1, 0x03375C1A, 0x150820CC, 0x1804210D, 0x0E3B5DDB, 0x11150A00, 0x072A76D6,
+	0x0DF60EFC, 0x1BC9722A, 0x04E725F1, 0x12D85927, 0x1FD458E6, 0x09EB2430, 0x16C573EB, 0x00FA0F3D,
+	0x0CDD7069, 0x1AE20CBF, 0x05CC5B64, 0x13F327B2, 0x1EFF2673, 0x08C05AA5, 0x17EE0D7E, 0x01D171A8,
+	0x0FA0F3D6, 0x199F8F00, 0x06B1D8DB, 0x108EA40D, 0x1D82A5CC, 0x0BBDD91A, 0x14938EC1, 0x02ACF217,
+	0x0E8B8D43, 0x18B4F195, 0x079AA64E, 0x11A5DA98, 0x1CA9DB59, 0x0A96A78F, 0x15B8F054, 0x03878C82,
+	0x12B7E950, 0x04889586, 0x1BA6C25D, 0x0D99BE8B, 0x0095BF4A, 0x16AAC39C, 0x09849447, 0x1FBBE891,
+	0x139C97C5, 0x05A3EB13, 0x1A8DBCC8, 0x0CB2C01E, 0x01BEC1DF, 0x1781BD09, 0x08AFEAD2, 0x1E909604,
+	0x10E1147A, 0x06DE68AC, 0x19F03F77, 0x0FCF43A1, 0x02C34260, 0x14FC3EB6, 0x0BD2696D, 0x1DED15BB,
+	0x11CA6AEF, 0x07F51639, 0x18DB41E2, 0x0EE43D34, 0x03E83CF5, 0x15D74023, 0x0AF917F8, 0x1CC66B2E,
+	0x161A1304, 0x00256FD2, 0x1F0B3809, 0x093444DF, 0x0438451E, 0x120739C8, 0x0D296E13, 0x1B1612C5,
+	0x17316D91, 0x010E1147, 0x1E20469C, 0x081F3A4A, 0x05133B8B, 0x132C475D, 0x0C021086, 0x1A3D6C50,
+	0x144CEE2E, 0x027392F8, 0x1D5DC523, 0x0B62B9F5, 0x066EB834, 0x1051C4E2, 0x0F7F9339, 0x1940EFEF,
+	0x156790BB, 0x0358EC6D, 0x1C76BBB6, 0x0A49C760, 0x0745C6A1, 0x117ABA77, 0x0E54EDAC, 0x186B917A,
+	0x1BEC1DF8, 0x0DD3612E, 0x12FD36F5, 0x04C24A23, 0x09CE4BE2, 0x1FF13734, 0x00DF60EF, 0x16E01C39,
+	0x1AC7636D, 0x0CF81FBB, 0x13D64860, 0x05E934B6, 0x08E53577, 0x1EDA49A1, 0x01F41E7A, 0x17CB62AC,
+	0x19BAE0D2, 0x0F859C04, 0x10ABCBDF, 0x0694B709, 0x0B98B6C8, 0x1DA7CA1E, 0x02899DC5, 0x14B6E113,
+	0x18919E47, 0x0EAEE291, 0x1180B54A, 0x07BFC99C, 0x0AB3C85D, 0x1C8CB48B, 0x03A2E350, 0x159D9F86,
+	0x1F41E7AC, 0x097E9B7A, 0x1650CCA1, 0x006FB077, 0x0D63B1B6, 0x1B5CCD60, 0x04729ABB, 0x124DE66D,
+	0x1E6A9939, 0x0855E5EF, 0x177BB234, 0x0144CEE2, 0x0C48CF23, 0x1A77B3F5, 0x0559E42E, 0x136698F8,
+	0x1D171A86, 0x0B286650, 0x1406318B, 0x02394D5D, 0x0F354C9C, 0x190A304A, 0x06246791, 0x101B1B47,
+	0x1C3C6413, 0x0A0318C5, 0x152D4F1E, 0x031233C8, 0x0E1E3209, 0x18214EDF, 0x070F1904, 0x113065D2,
+	// Seed 0x5A
+	0x00000000, 0x8EF4305C, 0x0A95116D, 0x84612131, 0x152A22DA, 0x9BDE1286, 0x1FBF33B7, 0x914B03EB,
+	0x2A5445B4, 0xA4A075E8, 0x20C154D9, 0xAE356485, 0x3F7E676E, 0xB18A5732, 0x35EB7603, 0xBB1F465F,
+	0x54A88B68, 0xDA5CBB34, 0x5E3D9A05, 0xD0C9AA59, 0x4182A9B2, 0xCF7699EE, 0x4B17B8DF, 0xC5E38883,
+	0x7EFCCEDC, 0xF008FE80, 0x7469DFB1, 0xFA9DEFED, 0x6BD6EC06, 0xE522DC5A, 0x6143FD6B, 0xEFB7CD37,
+	0xA95116D0, 0x27A5268C, 0xA3C407BD, 0x2D3037E1, 0xBC7B340A, 0x328F0456, 0xB6EE2567, 0x381A153B,
+	0x83055364, 0x0DF16338, 0x89904209, 0x07647255, 0x962F71BE, 0x18DB41E2, 0x9CBA60D3, 0x124E508F,
+	0xFDF99DB8, 0x730DADE4, 0xF76C8CD5, 0x7998BC89, 0xE8D3BF62, 0x66278F3E, 0xE246AE0F, 0x6CB29E53,
+	0xD7ADD80C, 0x5959E850, 0xDD38C961, 0x53CCF93D, 0xC287FAD6, 0x4C73CA8A, 0xC812EBBB, 0x46E6DBE7,
+	0x45DF5C75, 0xCB2B6C29, 0x4F4A4D18, 0xC1BE7D44, 0x50F57EAF, 0xDE014EF3, 0x5A606FC2, 0xD4945F9E,
+	0x6F8B19C1, 0xE17F299D, 0x651E08AC, 0xEBEA38F0, 0x7AA13B1B, 0xF4550B47, 0x70342A76, 0xFEC01A2A,
+	0x1177D71D, 0x9F83E741, 0x1BE2C670, 0x9516F62C, 0x045DF5C7, 0x8AA9C59B, 0x0EC8E4AA, 0x803CD4F6,
+	0x3B2392A9, 0xB5D7A2F5, 0x31B683C4, 0xBF42B398, 0x2E09B073, 0xA0FD802F, 0x249CA11E, 0xAA689142,
+	0xEC8E4AA5, 0x627A7AF9, 0xE61B5BC8, 0x68EF6B94, 0xF9A4687F, 0x77505823, 0xF3317912, 0x7DC5494E,
+	0xC6DA0F11, 0x482E3F4D, 0xCC4F1E7C, 0x42BB2E20, 0xD3F02DCB, 0x5D041D97, 0xD9653CA6, 0x57910CFA,
+	0xB826C1CD, 0x36D2F191, 0xB2B3D0A0, 0x3C47E0FC, 0xAD0CE317, 0x23F8D34B, 0xA799F27A, 0x296DC226,
+	0x92728479, 0x1C86B425, 0x98E79514, 0x1613A548, 0x8758A6A3, 0x09AC96FF, 0x8DCDB7CE, 0x03398792,
+	0x8BBEB8EA, 0x054A88B6, 0x812BA987, 0x0FDF99DB, 0x9E949A30, 0x1060AA6C, 0x94018B5D, 0x1AF5BB01,
+	0xA1EAFD5E, 0x2F1ECD02, 0xAB7FEC33, 0x258BDC6F, 0xB4C0DF84, 0x3A34EFD8, 0xBE55CEE9, 0x30A1FEB5,
+	0xDF163382, 0x51E203DE, 0xD58322EF, 0x5B7712B3, 0xCA3C1158, 0x44C82104, 0xC0A90035, 0x4E5D3069,
+	0xF5427636, 0x7BB6466A, 0xFFD7675B, 0x71235707, 0xE06854EC, 0x6E9C64B0, 0xEAFD4581, 0x640975DD,
+	0x22EFAE3A, 0xAC1B9E66, 0x287ABF57, 0xA68E8F0B, 0x37C58CE0, 0xB931BCBC, 0x3D509D8D, 0xB3A4ADD1,
+	0x08BBEB8E, 0x864FDBD2, 0x022EFAE3, 0x8CDACABF, 0x1D91C954, 0x9365F908, 0x1704D839, 0x99F0E865,
+	0x76472552, 0xF8B3150E, 0x7CD2343F, 0xF2260463, 0x636D0788, 0xED9937D4, 0x69F816E5, 0xE70C26B9,
+	0x5C1360E6, 0xD2E750BA, 0x5686718B, 0xD87241D7, 0x4939423C, 0xC7CD7260, 0x43AC5351, 0xCD58630D,
+	0xCE61E49F, 0x4095D4C3, 0xC4F4F5F2, 0x4A00C5AE, 0xDB4BC645, 0x55BFF619, 0xD1DED728, 0x5F2AE774,
+	0xE435A12B, 0x6AC19177, 0xEEA0B046, 0x6054801A, 0xF11F83F1, 0x7FEBB3AD, 0xFB8A929C, 0x757EA2C0,
+	0x9AC96FF7, 0x143D5FAB, 0x905C7E9A, 0x1EA84EC6, 0x8FE34D2D, 0x01177D71, 0x85765C40, 0x0B826C1C,
+	0xB09D2A43, 0x3E691A1F, 0xBA083B2E, 0x34FC0B72, 0xA5B70899, 0x2B4338C5, 0xAF2219F4, 0x21D629A8,
+	0x6730F24F, 0xE9C4C213, 0x6DA5E322, 0xE351D37E, 0x721AD095, 0xFCEEE0C9, 0x788FC1F8, 0xF67BF1A4,
+	0x4D64B7FB, 0xC39087A7, 0x47F1A696, 0xC90596CA, 0x584E9521, 0xD6BAA57D, 0x52DB844C, 0xDC2FB410,
+	0x33987927, 0xBD6C497B, 0x390D684A, 0xB7F95816, 0x26B25BFD, 0xA8466BA1, 0x2C274A90, 0xA2D37ACC,
+	0x19CC3C93, 0x97380CCF, 0x13592DFE, 0x9DAD1DA2, 0x0CE61E49, 0x82122E15, 0x06730F24, 0x88873F78,
+	// Seed 0x5B
+	0x00000000, 0xD23230FB, 0x5D17710F, 0x8F2541F4, 0xBA2EE21E, 0x681CD2E5, 0xE7399311, 0x350BA3EA,
+	0x8D2ED4C5, 0x5F1CE43E, 0xD039A5CA, 0x020B9531, 0x370036DB, 0xE5320620, 0x6A1747D4, 0xB825772F,
+	0xE32EB973, 0x311C8988, 0xBE39C87C, 0x6C0BF887, 0x59005B6D, 0x8B326B96, 0x04172A62, 0xD6251A99,
+	0x6E006DB6, 0xBC325D4D, 0x33171CB9, 0xE1252C42, 0xD42E8FA8, 0x061CBF53, 0x8939FEA7, 0x5B0BCE5C,
+	0x3F2E621F, 0xED1C52E4, 0x62391310, 0xB00B23EB, 0x85008001, 0x5732B0FA, 0xD817F10E, 0x0A25C1F5,
+	0xB200B6DA, 0x60328621, 0xEF17C7D5, 0x3D25F72E, 0x082E54C4, 0xDA1C643F, 0x553925CB, 0x870B1530,
+	0xDC00DB6C, 0x0E32EB97, 0x8117AA63, 0x53259A98, 0x662E3972, 0xB41C0989, 0x3B39487D, 0xE90B7886,
+	0x512E0FA9, 0x831C3F52, 0x0C397EA6, 0xDE0B4E5D, 0xEB00EDB7, 0x3932DD4C, 0xB6179CB8, 0x6425AC43,
+	0x7E5CC43E, 0xAC6EF4C5, 0x234BB531, 0xF17985CA, 0xC4722620, 0x164016DB, 0x9965572F, 0x4B5767D4,
+	0xF37210FB, 0x21402000, 0xAE6561F4, 0x7C57510F, 0x495CF2E5, 0x9B6EC21E, 0x144B83EA, 0xC679B311,
+	0x9D727D4D, 0x4F404DB6, 0xC0650C42, 0x12573CB9, 0x275C9F53, 0xF56EAFA8, 0x7A4BEE5C, 0xA879DEA7,
+	0x105CA988, 0xC26E9973, 0x4D4BD887, 0x9F79E87C, 0xAA724B96, 0x78407B6D, 0xF7653A99, 0x25570A62,
+	0x4172A621, 0x934096DA, 0x1C65D72E, 0xCE57E7D5, 0xFB5C443F, 0x296E74C4, 0xA64B3530, 0x747905CB,
+	0xCC5C72E4, 0x1E6E421F, 0x914B03EB, 0x43793310, 0x767290FA, 0xA440A001, 0x2B65E1F5, 0xF957D10E,
+	0xA25C1F52, 0x706E2FA9, 0xFF4B6E5D, 0x2D795EA6, 0x1872FD4C, 0xCA40CDB7, 0x45658C43, 0x9757BCB8,
+	0x2F72CB97, 0xFD40FB6C, 0x7265BA98, 0xA0578A63, 0x955C2989, 0x476E1972, 0xC84B5886, 0x1A79687D,
+	0xFCB9887C, 0x2E8BB887, 0xA1AEF973, 0x739CC988, 0x46976A62, 0x94A55A99, 0x1B801B6D, 0xC9B22B96,
+	0x71975CB9, 0xA3A56C42, 0x2C802DB6, 0xFEB21D4D, 0xCBB9BEA7, 0x198B8E5C, 0x96AECFA8, 0x449CFF53,
+	0x1F97310F, 0xCDA501F4, 0x42804000, 0x90B270FB, 0xA5B9D311, 0x778BE3EA, 0xF8AEA21E, 0x2A9C92E5,
+	0x92B9E5CA, 0x408BD531, 0xCFAE94C5, 0x1D9CA43E, 0x289707D4, 0xFAA5372F, 0x758076DB, 0xA7B24620,
+	0xC397EA63, 0x11A5DA98, 0x9E809B6C, 0x4CB2AB97, 0x79B9087D, 0xAB8B3886, 0x24AE7972, 0xF69C4989,
+	0x4EB93EA6, 0x9C8B0E5D, 0x13AE4FA9, 0xC19C7F52, 0xF497DCB8, 0x26A5EC43, 0xA980ADB7, 0x7BB29D4C,
+	0x20B95310, 0xF28B63EB, 0x7DAE221F, 0xAF9C12E4, 0x9A97B10E, 0x48A581F5, 0xC780C001, 0x15B2F0FA,
+	0xAD9787D5, 0x7FA5B72E, 0xF080F6DA, 0x22B2C621, 0x17B965CB, 0xC58B5530, 0x4AAE14C4, 0x989C243F,
+	0x82E54C42, 0x50D77CB9, 0xDFF23D4D, 0x0DC00DB6, 0x38CBAE5C, 0xEAF99EA7, 0x65DCDF53, 0xB7EEEFA8,
+	0x0FCB9887, 0xDDF9A87C, 0x52DCE988, 0x80EED973, 0xB5E57A99, 0x67D74A62, 0xE8F20B96, 0x3AC03B6D,
+	0x61CBF531, 0xB3F9C5CA, 0x3CDC843E, 0xEEEEB4C5, 0xDBE5172F, 0x09D727D4, 0x86F26620, 0x54C056DB,
+	0xECE521F4, 0x3ED7110F, 0xB1F250FB, 0x63C06000, 0x56CBC3EA, 0x84F9F311, 0x0BDCB2E5, 0xD9EE821E,
+	0xBDCB2E5D, 0x6FF91EA6, 0xE0DC5F52, 0x32EE6FA9, 0x07E5CC43, 0xD5D7FCB8, 0x5AF2BD4C, 0x88C08DB7,
+	0x30E5FA98, 0xE2D7CA63, 0x6DF28B97, 0xBFC0BB6C, 0x8ACB1886, 0x58F9287D, 0xD7DC6989, 0x05EE5972,
+	0x5EE5972E, 0x8CD7A7D5, 0x03F2E621, 0xD1C0D6DA, 0xE4CB7530, 0x36F945CB, 0xB9DC043F, 0x6BEE34C4,
+	0xD3CB43EB, 0x01F97310, 0x8EDC32E4, 0x5CEE021F, 0x69E5A1F5, 0xBBD7910E, 0x34F2D0FA, 0xE6C0E001,
+	// Seed 0x5C
+	0x00000000, 0x302040A3, 0x60408146, 0x5060C1E5, 0x053B3933, 0x351B7990, 0x657BB875, 0x555BF8D6,
+	0x0A767266, 0x3A5632C5, 0x6A36F320, 0x5A16B383, 0x0F4D4B55, 0x3F6D0BF6, 0x6F0DCA13, 0x5F2D8AB0,
+	0x14ECE4CC, 0x24CCA46F, 0x74AC658A, 0x448C2529, 0x11D7DDFF, 0x21F79D5C, 0x71975CB9, 0x41B71C1A,
+	0x1E9A96AA, 0x2EBAD609, 0x7EDA17EC, 0x4EFA574F, 0x1BA1AF99, 0x2B81EF3A, 0x7BE12EDF, 0x4BC16E7C,
+	0x29D9C998, 0x19F9893B, 0x499948DE, 0x79B9087D, 0x2CE2F0AB, 0x1CC2B008, 0x4CA271ED, 0x7C82314E,
+	0x23AFBBFE, 0x138FFB5D, 0x43EF3AB8, 0x73CF7A1B, 0x269482CD, 0x16B4C26E, 0x46D4038B, 0x76F44328,
+	0x3D352D54, 0x0D156DF7, 0x5D75AC12, 0x6D55ECB1, 0x380E1467, 0x082E54C4, 0x584E9521, 0x686ED582,
+	0x37435F32, 0x07631F91, 0x5703DE74, 0x67239ED7, 0x32786601, 0x025826A2, 0x5238E747, 0x6218A7E4,
+	0x53B39330, 0x6393D393, 0x33F31276, 0x03D352D5, 0x5688AA03, 0x66A8EAA0, 0x36C82B45, 0x06E86BE6,
+	0x59C5E156, 0x69E5A1F5, 0x39856010, 0x09A520B3, 0x5CFED865, 0x6CDE98C6, 0x3CBE5923, 0x0C9E1980,
+	0x475F77FC, 0x777F375F, 0x271FF6BA, 0x173FB619, 0x42644ECF, 0x72440E6C, 0x2224CF89, 0x12048F2A,
+	0x4D29059A, 0x7D094539, 0x2D6984DC, 0x1D49C47F, 0x48123CA9, 0x78327C0A, 0x2852BDEF, 0x1872FD4C,
+	0x7A6A5AA8, 0x4A4A1A0B, 0x1A2ADBEE, 0x2A0A9B4D, 0x7F51639B, 0x4F712338, 0x1F11E2DD, 0x2F31A27E,
+	0x701C28CE, 0x403C686D, 0x105CA988, 0x207CE92B, 0x752711FD, 0x4507515E, 0x156790BB, 0x2547D018,
+	0x6E86BE64, 0x5EA6FEC7, 0x0EC63F22, 0x3EE67F81, 0x6BBD8757, 0x5B9DC7F4, 0x0BFD0611, 0x3BDD46B2,
+	0x64F0CC02, 0x54D08CA1, 0x04B04D44, 0x34900DE7, 0x61CBF531, 0x51EBB592, 0x018B7477, 0x31AB34D4,
+	0x62DD1DDF, 0x52FD5D7C, 0x029D9C99, 0x32BDDC3A, 0x67E624EC, 0x57C6644F, 0x07A6A5AA, 0x3786E509,
+	0x68AB6FB9, 0x588B2F1A, 0x08EBEEFF, 0x38CBAE5C, 0x6D90568A, 0x5DB01629, 0x0DD0D7CC, 0x3DF0976F,
+	0x7631F913, 0x4611B9B0, 0x16717855, 0x265138F6, 0x730AC020, 0x432A8083, 0x134A4166, 0x236A01C5,
+	0x7C478B75, 0x4C67CBD6, 0x1C070A33, 0x2C274A90, 0x797CB246, 0x495CF2E5, 0x193C3300, 0x291C73A3,
+	0x4B04D447, 0x7B2494E4, 0x2B445501, 0x1B6415A2, 0x4E3FED74, 0x7E1FADD7, 0x2E7F6C32, 0x1E5F2C91,
+	0x4172A621, 0x7152E682, 0x21322767, 0x111267C4, 0x44499F12, 0x7469DFB1, 0x24091E54, 0x14295EF7,
+	0x5FE8308B, 0x6FC87028, 0x3FA8B1CD, 0x0F88F16E, 0x5AD309B8, 0x6AF3491B, 0x3A9388FE, 0x0AB3C85D,
+	0x559E42ED, 0x65BE024E, 0x35DEC3AB, 0x05FE8308, 0x50A57BDE, 0x60853B7D, 0x30E5FA98, 0x00C5BA3B,
+	0x316E8EEF, 0x014ECE4C, 0x512E0FA9, 0x610E4F0A, 0x3455B7DC, 0x0475F77F, 0x5415369A, 0x64357639,
+	0x3B18FC89, 0x0B38BC2A, 0x5B587DCF, 0x6B783D6C, 0x3E23C5BA, 0x0E038519, 0x5E6344FC, 0x6E43045F,
+	0x25826A23, 0x15A22A80, 0x45C2EB65, 0x75E2ABC6, 0x20B95310, 0x109913B3, 0x40F9D256, 0x70D992F5,
+	0x2FF41845, 0x1FD458E6, 0x4FB49903, 0x7F94D9A0, 0x2ACF2176, 0x1AEF61D5, 0x4A8FA030, 0x7AAFE093,
+	0x18B74777, 0x289707D4, 0x78F7C631, 0x48D78692, 0x1D8C7E44, 0x2DAC3EE7, 0x7DCCFF02, 0x4DECBFA1,
+	0x12C13511, 0x22E175B2, 0x7281B457, 0x42A1F4F4, 0x17FA0C22, 0x27DA4C81, 0x77BA8D64, 0x479ACDC7,
+	0x0C5BA3BB, 0x3C7BE318, 0x6C1B22FD, 0x5C3B625E, 0x09609A88, 0x3940DA2B, 0x69201BCE, 0x59005B6D,
+	0x062DD1DD, 0x360D917E, 0x666D509B, 0x564D1038, 0x0316E8EE, 0x3336A84D, 0x635669A8, 0x5376290B,
+	// Seed 0x5D
+	0x00000000, 0x04F92403, 0x09F24806, 0x0D0B6C05, 0x13E4900C, 0x171DB40F, 0x1A16D80A, 0x1EEFFC09,
+	0x0C7D7A8B, 0x08845E88, 0x058F328D, 0x0176168E, 0x1F99EA87, 0x1B60CE84, 0x166BA281, 0x12928682,
+	0x18FAF516, 0x1C03D115, 0x1108BD10, 0x15F19913, 0x0B1E651A, 0x0FE74119, 0x02EC2D1C, 0x0615091F,
+	0x14878F9D, 0x107EAB9E, 0x1D75C79B, 0x198CE398, 0x07631F91, 0x039A3B92, 0x0E915797, 0x0A687394,
+	0x1A41B0BF, 0x1EB894BC, 0x13B3F8B9, 0x174ADCBA, 0x09A520B3, 0x0D5C04B0, 0x005768B5, 0x04AE4CB6,
+	0x163CCA34, 0x12C5EE37, 0x1FCE8232, 0x1B37A631, 0x05D85A38, 0x01217E3B, 0x0C2A123E, 0x08D3363D,
+	0x02BB45A9, 0x064261AA, 0x0B490DAF, 0x0FB029AC, 0x115FD5A5, 0x15A6F1A6, 0x18AD9DA3, 0x1C54B9A0,
+	0x0EC63F22, 0x0A3F1B21, 0x07347724, 0x03CD5327, 0x1D22AF2E, 0x19DB8B2D, 0x14D0E728, 0x1029C32B,
+	0x1F373BED, 0x1BCE1FEE, 0x16C573EB, 0x123C57E8, 0x0CD3ABE1, 0x082A8FE2, 0x0521E3E7, 0x01D8C7E4,
+	0x134A4166, 0x17B36565, 0x1AB80960, 0x1E412D63, 0x00AED16A, 0x0457F569, 0x095C996C, 0x0DA5BD6F,
+	0x07CDCEFB, 0x0334EAF8, 0x0E3F86FD, 0x0AC6A2FE, 0x14295EF7, 0x10D07AF4, 0x1DDB16F1, 0x192232F2,
+	0x0BB0B470, 0x0F499073, 0x0242FC76, 0x06BBD875, 0x1854247C, 0x1CAD007F, 0x11A66C7A, 0x155F4879,
+	0x05768B52, 0x018FAF51, 0x0C84C354, 0x087DE757, 0x16921B5E, 0x126B3F5D, 0x1F605358, 0x1B99775B,
+	0x090BF1D9, 0x0DF2D5DA, 0x00F9B9DF, 0x04009DDC, 0x1AEF61D5, 0x1E1645D6, 0x131D29D3, 0x17E40DD0,
+	0x1D8C7E44, 0x19755A47, 0x147E3642, 0x10871241, 0x0E68EE48, 0x0A91CA4B, 0x079AA64E, 0x0363824D,
+	0x11F104CF, 0x150820CC, 0x18034CC9, 0x1CFA68CA, 0x021594C3, 0x06ECB0C0, 0x0BE7DCC5, 0x0F1EF8C6,
+	0x15DA2D49, 0x1123094A, 0x1C28654F, 0x18D1414C, 0x063EBD45, 0x02C79946, 0x0FCCF543, 0x0B35D140,
+	0x19A757C2, 0x1D5E73C1, 0x10551FC4, 0x14AC3BC7, 0x0A43C7CE, 0x0EBAE3CD, 0x03B18FC8, 0x0748ABCB,
+	0x0D20D85F, 0x09D9FC5C, 0x04D29059, 0x002BB45A, 0x1EC44853, 0x1A3D6C50, 0x17360055, 0x13CF2456,
+	0x015DA2D4, 0x05A486D7, 0x08AFEAD2, 0x0C56CED1, 0x12B932D8, 0x164016DB, 0x1B4B7ADE, 0x1FB25EDD,
+	0x0F9B9DF6, 0x0B62B9F5, 0x0669D5F0, 0x0290F1F3, 0x1C7F0DFA, 0x188629F9, 0x158D45FC, 0x117461FF,
+	0x03E6E77D, 0x071FC37E, 0x0A14AF7B, 0x0EED8B78, 0x10027771, 0x14FB5372, 0x19F03F77, 0x1D091B74,
+	0x176168E0, 0x13984CE3, 0x1E9320E6, 0x1A6A04E5, 0x0485F8EC, 0x007CDCEF, 0x0D77B0EA, 0x098E94E9,
+	0x1B1C126B, 0x1FE53668, 0x12EE5A6D, 0x16177E6E, 0x08F88267, 0x0C01A664, 0x010ACA61, 0x05F3EE62,
+	0x0AED16A4, 0x0E1432A7, 0x031F5EA2, 0x07E67AA1, 0x190986A8, 0x1DF0A2AB, 0x10FBCEAE, 0x1402EAAD,
+	0x06906C2F, 0x0269482C, 0x0F622429, 0x0B9B002A, 0x1574FC23, 0x118DD820, 0x1C86B425, 0x187F9026,
+	0x1217E3B2, 0x16EEC7B1, 0x1BE5ABB4, 0x1F1C8FB7, 0x01F373BE, 0x050A57BD, 0x08013BB8, 0x0CF81FBB,
+	0x1E6A9939, 0x1A93BD3A, 0x1798D13F, 0x1361F53C, 0x0D8E0935, 0x09772D36, 0x047C4133, 0x00856530,
+	0x10ACA61B, 0x14558218, 0x195EEE1D, 0x1DA7CA1E, 0x03483617, 0x07B11214, 0x0ABA7E11, 0x0E435A12,
+	0x1CD1DC90, 0x1828F893, 0x15239496, 0x11DAB095, 0x0F354C9C, 0x0BCC689F, 0x06C7049A, 0x023E2099,
+	0x0856530D, 0x0CAF770E, 0x01A41B0B, 0x055D3F08, 0x1BB2C301, 0x1F4BE702, 0x12408B07, 0x16B9AF04,
+	0x042B2986, 0x00D20D85, 0x0DD96180, 0x09204583, 0x17CFB98A, 0x13369D89, 0x1E3DF18C, 0x1AC4D58F,
+	// Seed 0x5E
+	0x00000000, 0xB59A1094, 0x7292D8CF, 0xC708C85B, 0xE525B19E, 0x50BFA10A, 0x97B76951, 0x222D79C5,
+	0xD3ED9ADB, 0x66778A4F, 0xA17F4214, 0x14E55280, 0x36C82B45, 0x83523BD1, 0x445AF38A, 0xF1C0E31E,
+	0xBE7DCC51, 0x0BE7DCC5, 0xCCEF149E, 0x7975040A, 0x5B587DCF, 0xEEC26D5B, 0x29CAA500, 0x9C50B594,
+	0x6D90568A, 0xD80A461E, 0x1F028E45, 0xAA989ED1, 0x88B5E714, 0x3D2FF780, 0xFA273FDB, 0x4FBD2F4F,
+	0x655D6145, 0xD0C771D1, 0x17CFB98A, 0xA255A91E, 0x8078D0DB, 0x35E2C04F, 0xF2EA0814, 0x47701880,
+	0xB6B0FB9E, 0x032AEB0A, 0xC4222351, 0x71B833C5, 0x53954A00, 0xE60F5A94, 0x210792CF, 0x949D825B,
+	0xDB20AD14, 0x6EBABD80, 0xA9B275DB, 0x1C28654F, 0x3E051C8A, 0x8B9F0C1E, 0x4C97C445, 0xF90DD4D1,
+	0x08CD37CF, 0xBD57275B, 0x7A5FEF00, 0xCFC5FF94, 0xEDE88651, 0x587296C5, 0x9F7A5E9E, 0x2AE04E0A,
+	0xCABAC28A, 0x7F20D21E, 0xB8281A45, 0x0DB20AD1, 0x2F9F7314, 0x9A056380, 0x5D0DABDB, 0xE897BB4F,
+	0x19575851, 0xACCD48C5, 0x6BC5809E, 0xDE5F900A, 0xFC72E9CF, 0x49E8F95B, 0x8EE03100, 0x3B7A2194,
+	0x74C70EDB, 0xC15D1E4F, 0x0655D614, 0xB3CFC680, 0x91E2BF45, 0x2478AFD1, 0xE370678A, 0x56EA771E,
+	0xA72A9400, 0x12B08494, 0xD5B84CCF, 0x60225C5B, 0x420F259E, 0xF795350A, 0x309DFD51, 0x8507EDC5,
+	0xAFE7A3CF, 0x1A7DB35B, 0xDD757B00, 0x68EF6B94, 0x4AC21251, 0xFF5802C5, 0x3850CA9E, 0x8DCADA0A,
+	0x7C0A3914, 0xC9902980, 0x0E98E1DB, 0xBB02F14F, 0x992F888A, 0x2CB5981E, 0xEBBD5045, 0x5E2740D1,
+	0x119A6F9E, 0xA4007F0A, 0x6308B751, 0xD692A7C5, 0xF4BFDE00, 0x4125CE94, 0x862D06CF, 0x33B7165B,
+	0xC277F545, 0x77EDE5D1, 0xB0E52D8A, 0x057F3D1E, 0x275244DB, 0x92C8544F, 0x55C09C14, 0xE05A8C80,
+	0x8CD37CF3, 0x39496C67, 0xFE41A43C, 0x4BDBB4A8, 0x69F6CD6D, 0xDC6CDDF9, 0x1B6415A2, 0xAEFE0536,
+	0x5F3EE628, 0xEAA4F6BC, 0x2DAC3EE7, 0x98362E73, 0xBA1B57B6, 0x0F814722, 0xC8898F79, 0x7D139FED,
+	0x32AEB0A2, 0x8734A036, 0x403C686D, 0xF5A678F9, 0xD78B013C, 0x621111A8, 0xA519D9F3, 0x1083C967,
+	0xE1432A79, 0x54D93AED, 0x93D1F2B6, 0x264BE222, 0x04669BE7, 0xB1FC8B73, 0x76F44328, 0xC36E53BC,
+	0xE98E1DB6, 0x5C140D22, 0x9B1CC579, 0x2E86D5ED, 0x0CABAC28, 0xB931BCBC, 0x7E3974E7, 0xCBA36473,
+	0x3A63876D, 0x8FF997F9, 0x48F15FA2, 0xFD6B4F36, 0xDF4636F3, 0x6ADC2667, 0xADD4EE3C, 0x184EFEA8,
+	0x57F3D1E7, 0xE269C173, 0x25610928, 0x90FB19BC, 0xB2D66079, 0x074C70ED, 0xC044B8B6, 0x75DEA822,
+	0x841E4B3C, 0x31845BA8, 0xF68C93F3, 0x43168367, 0x613BFAA2, 0xD4A1EA36, 0x13A9226D, 0xA63332F9,
+	0x4669BE79, 0xF3F3AEED, 0x34FB66B6, 0x81617622, 0xA34C0FE7, 0x16D61F73, 0xD1DED728, 0x6444C7BC,
+	0x958424A2, 0x201E3436, 0xE716FC6D, 0x528CECF9, 0x70A1953C, 0xC53B85A8, 0x02334DF3, 0xB7A95D67,
+	0xF8147228, 0x4D8E62BC, 0x8A86AAE7, 0x3F1CBA73, 0x1D31C3B6, 0xA8ABD322, 0x6FA31B79, 0xDA390BED,
+	0x2BF9E8F3, 0x9E63F867, 0x596B303C, 0xECF120A8, 0xCEDC596D, 0x7B4649F9, 0xBC4E81A2, 0x09D49136,
+	0x2334DF3C, 0x96AECFA8, 0x51A607F3, 0xE43C1767, 0xC6116EA2, 0x738B7E36, 0xB483B66D, 0x0119A6F9,
+	0xF0D945E7, 0x45435573, 0x824B9D28, 0x37D18DBC, 0x15FCF479, 0xA066E4ED, 0x676E2CB6, 0xD2F43C22,
+	0x9D49136D, 0x28D303F9, 0xEFDBCBA2, 0x5A41DB36, 0x786CA2F3, 0xCDF6B267, 0x0AFE7A3C, 0xBF646AA8,
+	0x4EA489B6, 0xFB3E9922, 0x3C365179, 0x89AC41ED, 0xAB813828, 0x1E1B28BC, 0xD913E0E7, 0x6C89F073,
+	// Seed 0x5F
+	0x00000000, 0x6756F474, 0xCEADE8E8, 0xA9FB1C9C, 0x6AF3491B, 0x0DA5BD6F, 0xA45EA1F3, 0xC3085587,
+	0xD5E69236, 0xB2B06642, 0x1B4B7ADE, 0x7C1D8EAA, 0xBF15DB2D, 0xD8432F59, 0x71B833C5, 0x16EEC7B1,
+	0x5C65BCA7, 0x3B3348D3, 0x92C8544F, 0xF59EA03B, 0x3696F5BC, 0x51C001C8, 0xF83B1D54, 0x9F6DE920,
+	0x89832E91, 0xEED5DAE5, 0x472EC679, 0x2078320D, 0xE370678A, 0x842693FE, 0x2DDD8F62, 0x4A8B7B16,
+	0xB8CB794E, 0xDF9D8D3A, 0x766691A6, 0x113065D2, 0xD2383055, 0xB56EC421, 0x1C95D8BD, 0x7BC32CC9,
+	0x6D2DEB78, 0x0A7B1F0C, 0xA3800390, 0xC4D6F7E4, 0x07DEA263, 0x60885617, 0xC9734A8B, 0xAE25BEFF,
+	0xE4AEC5E9, 0x83F8319D, 0x2A032D01, 0x4D55D975, 0x8E5D8CF2, 0xE90B7886, 0x40F0641A, 0x27A6906E,
+	0x314857DF, 0x561EA3AB, 0xFFE5BF37, 0x98B34B43, 0x5BBB1EC4, 0x3CEDEAB0, 0x9516F62C, 0xF2400258,
+	0x863E6A57, 0xE1689E23, 0x489382BF, 0x2FC576CB, 0xECCD234C, 0x8B9BD738, 0x2260CBA4, 0x45363FD0,
+	0x53D8F861, 0x348E0C15, 0x9D751089, 0xFA23E4FD, 0x392BB17A, 0x5E7D450E, 0xF7865992, 0x90D0ADE6,
+	0xDA5BD6F0, 0xBD0D2284, 0x14F63E18, 0x73A0CA6C, 0xB0A89FEB, 0xD7FE6B9F, 0x7E057703, 0x19538377,
+	0x0FBD44C6, 0x68EBB0B2, 0xC110AC2E, 0xA646585A, 0x654E0DDD, 0x0218F9A9, 0xABE3E535, 0xCCB51141,
+	0x3EF51319, 0x59A3E76D, 0xF058FBF1, 0x970E0F85, 0x54065A02, 0x3350AE76, 0x9AABB2EA, 0xFDFD469E,
+	0xEB13812F, 0x8C45755B, 0x25BE69C7, 0x42E89DB3, 0x81E0C834, 0xE6B63C40, 0x4F4D20DC, 0x281BD4A8,
+	0x6290AFBE, 0x05C65BCA, 0xAC3D4756, 0xCB6BB322, 0x0863E6A5, 0x6F3512D1, 0xC6CE0E4D, 0xA198FA39,
+	0xB7763D88, 0xD020C9FC, 0x79DBD560, 0x1E8D2114, 0xDD857493, 0xBAD380E7, 0x13289C7B, 0x747E680F,
+	0xFBD44C65, 0x9C82B811, 0x3579A48D, 0x522F50F9, 0x9127057E, 0xF671F10A, 0x5F8AED96, 0x38DC19E2,
+	0x2E32DE53, 0x49642A27, 0xE09F36BB, 0x87C9C2CF, 0x44C19748, 0x2397633C, 0x8A6C7FA0, 0xED3A8BD4,
+	0xA7B1F0C2, 0xC0E704B6, 0x691C182A, 0x0E4AEC5E, 0xCD42B9D9, 0xAA144DAD, 0x03EF5131, 0x64B9A545,
+	0x725762F4, 0x15019680, 0xBCFA8A1C, 0xDBAC7E68, 0x18A42BEF, 0x7FF2DF9B, 0xD609C307, 0xB15F3773,
+	0x431F352B, 0x2449C15F, 0x8DB2DDC3, 0xEAE429B7, 0x29EC7C30, 0x4EBA8844, 0xE74194D8, 0x801760AC,
+	0x96F9A71D, 0xF1AF5369, 0x58544FF5, 0x3F02BB81, 0xFC0AEE06, 0x9B5C1A72, 0x32A706EE, 0x55F1F29A,
+	0x1F7A898C, 0x782C7DF8, 0xD1D76164, 0xB6819510, 0x7589C097, 0x12DF34E3, 0xBB24287F, 0xDC72DC0B,
+	0xCA9C1BBA, 0xADCAEFCE, 0x0431F352, 0x63670726, 0xA06F52A1, 0xC739A6D5, 0x6EC2BA49, 0x09944E3D,
+	0x7DEA2632, 0x1ABCD246, 0xB347CEDA, 0xD4113AAE, 0x17196F29, 0x704F9B5D, 0xD9B487C1, 0xBEE273B5,
+	0xA80CB404, 0xCF5A4070, 0x66A15CEC, 0x01F7A898, 0xC2FFFD1F, 0xA5A9096B, 0x0C5215F7, 0x6B04E183,
+	0x218F9A95, 0x46D96EE1, 0xEF22727D, 0x88748609, 0x4B7CD38E, 0x2C2A27FA, 0x85D13B66, 0xE287CF12,
+	0xF46908A3, 0x933FFCD7, 0x3AC4E04B, 0x5D92143F, 0x9E9A41B8, 0xF9CCB5CC, 0x5037A950, 0x37615D24,
+	0xC5215F7C, 0xA277AB08, 0x0B8CB794, 0x6CDA43E0, 0xAFD21667, 0xC884E213, 0x617FFE8F, 0x06290AFB,
+	0x10C7CD4A, 0x7791393E, 0xDE6A25A2, 0xB93CD1D6, 0x7A348451, 0x1D627025, 0xB4996CB9, 0xD3CF98CD,
+	0x9944E3DB, 0xFE1217AF, 0x57E90B33, 0x30BFFF47, 0xF3B7AAC0, 0x94E15EB4, 0x3D1A4228, 0x5A4CB65C,
+	0x4CA271ED, 0x2BF48599, 0x820F9905, 0xE5596D71, 0x265138F6, 0x4107CC82, 0xE8FCD01E, 0x8FAA246A,
+	// Seed 0x60
+	0x00000000, 0x57F3D1E7, 0x3483617F, 0x6370B098, 0x6906C2FE, 0x3EF51319, 0x5D85A381, 0x0A767266,
+	0x4969474D, 0x1E9A96AA, 0x7DEA2632, 0x2A19F7D5, 0x206F85B3, 0x779C5454, 0x14ECE4CC, 0x431F352B,
+	0x09B64C2B, 0x5E459DCC, 0x3D352D54, 0x6AC6FCB3, 0x60B08ED5, 0x37435F32, 0x5433EFAA, 0x03C03E4D,
+	0x40DF0B66, 0x172CDA81, 0x745C6A19, 0x23AFBBFE, 0x29D9C998, 0x7E2A187F, 0x1D5AA8E7, 0x4AA97900,
+	0x136C9856, 0x449F49B1, 0x27EFF929, 0x701C28CE, 0x7A6A5AA8, 0x2D998B4F, 0x4EE93BD7, 0x191AEA30,
+	0x5A05DF1B, 0x0DF60EFC, 0x6E86BE64, 0x39756F83, 0x33031DE5, 0x64F0CC02, 0x07807C9A, 0x5073AD7D,
+	0x1ADAD47D, 0x4D29059A, 0x2E59B502, 0x79AA64E5, 0x73DC1683, 0x242FC764, 0x475F77FC, 0x10ACA61B,
+	0x53B39330, 0x044042D7, 0x6730F24F, 0x30C323A8, 0x3AB551CE, 0x6D468029, 0x0E3630B1, 0x59C5E156,
+	0x26D930AC, 0x712AE14B, 0x125A51D3, 0x45A98034, 0x4FDFF252, 0x182C23B5, 0x7B5C932D, 0x2CAF42CA,
+	0x6FB077E1, 0x3843A606, 0x5B33169E, 0x0CC0C779, 0x06B6B51F, 0x514564F8, 0x3235D460, 0x65C60587,
+	0x2F6F7C87, 0x789CAD60, 0x1BEC1DF8, 0x4C1FCC1F, 0x4669BE79, 0x119A6F9E, 0x72EADF06, 0x25190EE1,
+	0x66063BCA, 0x31F5EA2D, 0x52855AB5, 0x05768B52, 0x0F00F934, 0x58F328D3, 0x3B83984B, 0x6C7049AC,
+	0x35B5A8FA, 0x6246791D, 0x0136C985, 0x56C51862, 0x5CB36A04, 0x0B40BBE3, 0x68300B7B, 0x3FC3DA9C,
+	0x7CDCEFB7, 0x2B2F3E50, 0x485F8EC8, 0x1FAC5F2F, 0x15DA2D49, 0x4229FCAE, 0x21594C36, 0x76AA9DD1,
+	0x3C03E4D1, 0x6BF03536, 0x088085AE, 0x5F735449, 0x5505262F, 0x02F6F7C8, 0x61864750, 0x367596B7,
+	0x756AA39C, 0x2299727B, 0x41E9C2E3, 0x161A1304, 0x1C6C6162, 0x4B9FB085, 0x28EF001D, 0x7F1CD1FA,
+	0x4DB26158, 0x1A41B0BF, 0x79310027, 0x2EC2D1C0, 0x24B4A3A6, 0x73477241, 0x1037C2D9, 0x47C4133E,
+	0x04DB2615, 0x5328F7F2, 0x3058476A, 0x67AB968D, 0x6DDDE4EB, 0x3A2E350C, 0x595E8594, 0x0EAD5473,
+	0x44042D73, 0x13F7FC94, 0x70874C0C, 0x27749DEB, 0x2D02EF8D, 0x7AF13E6A, 0x19818EF2, 0x4E725F15,
+	0x0D6D6A3E, 0x5A9EBBD9, 0x39EE0B41, 0x6E1DDAA6, 0x646BA8C0, 0x33987927, 0x50E8C9BF, 0x071B1858,
+	0x5EDEF90E, 0x092D28E9, 0x6A5D9871, 0x3DAE4996, 0x37D83BF0, 0x602BEA17, 0x035B5A8F, 0x54A88B68,
+	0x17B7BE43, 0x40446FA4, 0x2334DF3C, 0x74C70EDB, 0x7EB17CBD, 0x2942AD5A, 0x4A321DC2, 0x1DC1CC25,
+	0x5768B525, 0x009B64C2, 0x63EBD45A, 0x341805BD, 0x3E6E77DB, 0x699DA63C, 0x0AED16A4, 0x5D1EC743,
+	0x1E01F268, 0x49F2238F, 0x2A829317, 0x7D7142F0, 0x77073096, 0x20F4E171, 0x438451E9, 0x1477800E,
+	0x6B6B51F4, 0x3C988013, 0x5FE8308B, 0x081BE16C, 0x026D930A, 0x559E42ED, 0x36EEF275, 0x611D2392,
+	0x220216B9, 0x75F1C75E, 0x168177C6, 0x4172A621, 0x4B04D447, 0x1CF705A0, 0x7F87B538, 0x287464DF,
+	0x62DD1DDF, 0x352ECC38, 0x565E7CA0, 0x01ADAD47, 0x0BDBDF21, 0x5C280EC6, 0x3F58BE5E, 0x68AB6FB9,
+	0x2BB45A92, 0x7C478B75, 0x1F373BED, 0x48C4EA0A, 0x42B2986C, 0x1541498B, 0x7631F913, 0x21C228F4,
+	0x7807C9A2, 0x2FF41845, 0x4C84A8DD, 0x1B77793A, 0x11010B5C, 0x46F2DABB, 0x25826A23, 0x7271BBC4,
+	0x316E8EEF, 0x669D5F08, 0x05EDEF90, 0x521E3E77, 0x58684C11, 0x0F9B9DF6, 0x6CEB2D6E, 0x3B18FC89,
+	0x71B18589, 0x2642546E, 0x4532E4F6, 0x12C13511, 0x18B74777, 0x4F449690, 0x2C342608, 0x7BC7F7EF,
+	0x38D8C2C4, 0x6F2B1323, 0x0C5BA3BB, 0x5BA8725C, 0x51DE003A, 0x062DD1DD, 0x655D6145, 0x32AEB0A2,
+	// Seed 0x61
+	0x00000000, 0x020B9531, 0x04172A62, 0x061CBF53, 0x082E54C4, 0x0A25C1F5, 0x0C397EA6, 0x0E32EB97,
+	0x105CA988, 0x12573CB9, 0x144B83EA, 0x164016DB, 0x1872FD4C, 0x1A79687D, 0x1C65D72E, 0x1E6E421F,
+	0x20B95310, 0x22B2C621, 0x24AE7972, 0x26A5EC43, 0x289707D4, 0x2A9C92E5, 0x2C802DB6, 0x2E8BB887,
+	0x30E5FA98, 0x32EE6FA9, 0x34F2D0FA, 0x36F945CB, 0x38CBAE5C, 0x3AC03B6D, 0x3CDC843E, 0x3ED7110F,
+	0x341805BD, 0x3613908C, 0x300F2FDF, 0x3204BAEE, 0x3C365179, 0x3E3DC448, 0x38217B1B, 0x3A2AEE2A,
+	0x2444AC35, 0x264F3904, 0x20538657, 0x22581366, 0x2C6AF8F1, 0x2E616DC0, 0x287DD293, 0x2A7647A2,
+	0x14A156AD, 0x16AAC39C, 0x10B67CCF, 0x12BDE9FE, 0x1C8F0269, 0x1E849758, 0x1898280B, 0x1A93BD3A,
+	0x04FDFF25, 0x06F66A14, 0x00EAD547, 0x02E14076, 0x0CD3ABE1, 0x0ED83ED0, 0x08C48183, 0x0ACF14B2,
+	0x1D5AA8E7, 0x1F513DD6, 0x194D8285, 0x1B4617B4, 0x1574FC23, 0x177F6912, 0x1163D641, 0x13684370,
+	0x0D06016F, 0x0F0D945E, 0x09112B0D, 0x0B1ABE3C, 0x052855AB, 0x0723C09A, 0x013F7FC9, 0x0334EAF8,
+	0x3DE3FBF7, 0x3FE86EC6, 0x39F4D195, 0x3BFF44A4, 0x35CDAF33, 0x37C63A02, 0x31DA8551, 0x33D11060,
+	0x2DBF527F, 0x2FB4C74E, 0x29A8781D, 0x2BA3ED2C, 0x259106BB, 0x279A938A, 0x21862CD9, 0x238DB9E8,
+	0x2942AD5A, 0x2B49386B, 0x2D558738, 0x2F5E1209, 0x216CF99E, 0x23676CAF, 0x257BD3FC, 0x277046CD,
+	0x391E04D2, 0x3B1591E3, 0x3D092EB0, 0x3F02BB81, 0x31305016, 0x333BC527, 0x35277A74, 0x372CEF45,
+	0x09FBFE4A, 0x0BF06B7B, 0x0DECD428, 0x0FE74119, 0x01D5AA8E, 0x03DE3FBF, 0x05C280EC, 0x07C915DD,
+	0x19A757C2, 0x1BACC2F3, 0x1DB07DA0, 0x1FBBE891, 0x11890306, 0x13829637, 0x159E2964, 0x1795BC55,
+	0x3AB551CE, 0x38BEC4FF, 0x3EA27BAC, 0x3CA9EE9D, 0x329B050A, 0x3090903B, 0x368C2F68, 0x3487BA59,
+	0x2AE9F846, 0x28E26D77, 0x2EFED224, 0x2CF54715, 0x22C7AC82, 0x20CC39B3, 0x26D086E0, 0x24DB13D1,
+	0x1A0C02DE, 0x180797EF, 0x1E1B28BC, 0x1C10BD8D, 0x1222561A, 0x1029C32B, 0x16357C78, 0x143EE949,
+	0x0A50AB56, 0x085B3E67, 0x0E478134, 0x0C4C1405, 0x027EFF92, 0x00756AA3, 0x0669D5F0, 0x046240C1,
+	0x0EAD5473, 0x0CA6C142, 0x0ABA7E11, 0x08B1EB20, 0x068300B7, 0x04889586, 0x02942AD5, 0x009FBFE4,
+	0x1EF1FDFB, 0x1CFA68CA, 0x1AE6D799, 0x18ED42A8, 0x16DFA93F, 0x14D43C0E, 0x12C8835D, 0x10C3166C,
+	0x2E140763, 0x2C1F9252, 0x2A032D01, 0x2808B830, 0x263A53A7, 0x2431C696, 0x222D79C5, 0x2026ECF4,
+	0x3E48AEEB, 0x3C433BDA, 0x3A5F8489, 0x385411B8, 0x3666FA2F, 0x346D6F1E, 0x3271D04D, 0x307A457C,
+	0x27EFF929, 0x25E46C18, 0x23F8D34B, 0x21F3467A, 0x2FC1ADED, 0x2DCA38DC, 0x2BD6878F, 0x29DD12BE,
+	0x37B350A1, 0x35B8C590, 0x33A47AC3, 0x31AFEFF2, 0x3F9D0465, 0x3D969154, 0x3B8A2E07, 0x3981BB36,
+	0x0756AA39, 0x055D3F08, 0x0341805B, 0x014A156A, 0x0F78FEFD, 0x0D736BCC, 0x0B6FD49F, 0x096441AE,
+	0x170A03B1, 0x15019680, 0x131D29D3, 0x1116BCE2, 0x1F245775, 0x1D2FC244, 0x1B337D17, 0x1938E826,
+	0x13F7FC94, 0x11FC69A5, 0x17E0D6F6, 0x15EB43C7, 0x1BD9A850, 0x19D23D61, 0x1FCE8232, 0x1DC51703,
+	0x03AB551C, 0x01A0C02D, 0x07BC7F7E, 0x05B7EA4F, 0x0B8501D8, 0x098E94E9, 0x0F922BBA, 0x0D99BE8B,
+	0x334EAF84, 0x31453AB5, 0x375985E6, 0x355210D7, 0x3B60FB40, 0x396B6E71, 0x3F77D122, 0x3D7C4413,
+	0x2312060C, 0x2119933D, 0x27052C6E, 0x250EB95F, 0x2B3C52C8, 0x2937C7F9, 0x2F2B78AA, 0x2D20ED9B,
+	// Seed 0x62
+	0x00000000, 0x802FB86E, 0x47277035, 0xC708C85B, 0x8E4EE06A, 0x0E615804, 0xC969905F, 0x49462831,
+	0x5BE5C03D, 0xDBCA7853, 0x1CC2B008, 0x9CED0866, 0xD5AB2057, 0x55849839, 0x928C5062, 0x12A3E80C,
+	0xB7CB807A, 0x37E43814, 0xF0ECF04F, 0x70C34821, 0x39856010, 0xB9AAD87E, 0x7EA21025, 0xFE8DA84B,
+	0xEC2E4047, 0x6C01F829, 0xAB093072, 0x2B26881C, 0x6260A02D, 0xE24F1843, 0x2547D018, 0xA5686876,
+	0x28EF001D, 0xA8C0B873, 0x6FC87028, 0xEFE7C846, 0xA6A1E077, 0x268E5819, 0xE1869042, 0x61A9282C,
+	0x730AC020, 0xF325784E, 0x342DB015, 0xB402087B, 0xFD44204A, 0x7D6B9824, 0xBA63507F, 0x3A4CE811,
+	0x9F248067, 0x1F0B3809, 0xD803F052, 0x582C483C, 0x116A600D, 0x9145D863, 0x564D1038, 0xD662A856,
+	0xC4C1405A, 0x44EEF834, 0x83E6306F, 0x03C98801, 0x4A8FA030, 0xCAA0185E, 0x0DA8D005, 0x8D87686B,
+	0x51DE003A, 0xD1F1B854, 0x16F9700F, 0x96D6C861, 0xDF90E050, 0x5FBF583E, 0x98B79065, 0x1898280B,
+	0x0A3BC007, 0x8A147869, 0x4D1CB032, 0xCD33085C, 0x8475206D, 0x045A9803, 0xC3525058, 0x437DE836,
+	0xE6158040, 0x663A382E, 0xA132F075, 0x211D481B, 0x685B602A, 0xE874D844, 0x2F7C101F, 0xAF53A871,
+	0xBDF0407D, 0x3DDFF813, 0xFAD73048, 0x7AF88826, 0x33BEA017, 0xB3911879, 0x7499D022, 0xF4B6684C,
+	0x79310027, 0xF91EB849, 0x3E167012, 0xBE39C87C, 0xF77FE04D, 0x77505823, 0xB0589078, 0x30772816,
+	0x22D4C01A, 0xA2FB7874, 0x65F3B02F, 0xE5DC0841, 0xAC9A2070, 0x2CB5981E, 0xEBBD5045, 0x6B92E82B,
+	0xCEFA805D, 0x4ED53833, 0x89DDF068, 0x09F24806, 0x40B46037, 0xC09BD859, 0x07931002, 0x87BCA86C,
+	0x951F4060, 0x1530F80E, 0xD2383055, 0x5217883B, 0x1B51A00A, 0x9B7E1864, 0x5C76D03F, 0xDC596851,
+	0xA3BC0074, 0x2393B81A, 0xE49B7041, 0x64B4C82F, 0x2DF2E01E, 0xADDD5870, 0x6AD5902B, 0xEAFA2845,
+	0xF859C049, 0x78767827, 0xBF7EB07C, 0x3F510812, 0x76172023, 0xF638984D, 0x31305016, 0xB11FE878,
+	0x1477800E, 0x94583860, 0x5350F03B, 0xD37F4855, 0x9A396064, 0x1A16D80A, 0xDD1E1051, 0x5D31A83F,
+	0x4F924033, 0xCFBDF85D, 0x08B53006, 0x889A8868, 0xC1DCA059, 0x41F31837, 0x86FBD06C, 0x06D46802,
+	0x8B530069, 0x0B7CB807, 0xCC74705C, 0x4C5BC832, 0x051DE003, 0x8532586D, 0x423A9036, 0xC2152858,
+	0xD0B6C054, 0x5099783A, 0x9791B061, 0x17BE080F, 0x5EF8203E, 0xDED79850, 0x19DF500B, 0x99F0E865,
+	0x3C988013, 0xBCB7387D, 0x7BBFF026, 0xFB904848, 0xB2D66079, 0x32F9D817, 0xF5F1104C, 0x75DEA822,
+	0x677D402E, 0xE752F840, 0x205A301B, 0xA0758875, 0xE933A044, 0x691C182A, 0xAE14D071, 0x2E3B681F,
+	0xF262004E, 0x724DB820, 0xB545707B, 0x356AC815, 0x7C2CE024, 0xFC03584A, 0x3B0B9011, 0xBB24287F,
+	0xA987C073, 0x29A8781D, 0xEEA0B046, 0x6E8F0828, 0x27C92019, 0xA7E69877, 0x60EE502C, 0xE0C1E842,
+	0x45A98034, 0xC586385A, 0x028EF001, 0x82A1486F, 0xCBE7605E, 0x4BC8D830, 0x8CC0106B, 0x0CEFA805,
+	0x1E4C4009, 0x9E63F867, 0x596B303C, 0xD9448852, 0x9002A063, 0x102D180D, 0xD725D056, 0x570A6838,
+	0xDA8D0053, 0x5AA2B83D, 0x9DAA7066, 0x1D85C808, 0x54C3E039, 0xD4EC5857, 0x13E4900C, 0x93CB2862,
+	0x8168C06E, 0x01477800, 0xC64FB05B, 0x46600835, 0x0F262004, 0x8F09986A, 0x48015031, 0xC82EE85F,
+	0x6D468029, 0xED693847, 0x2A61F01C, 0xAA4E4872, 0xE3086043, 0x6327D82D, 0xA42F1076, 0x2400A818,
+	0x36A34014, 0xB68CF87A, 0x71843021, 0xF1AB884F, 0xB8EDA07E, 0x38C21810, 0xFFCAD04B, 0x7FE56825,
+	// Seed 0x63
+	0x00000000, 0xC920F918, 0x3B3793F5, 0xF2176AED, 0x766F27EA, 0xBF4FDEF2, 0x4D58B41F, 0x84784D07,
+	0xECDE4FD4, 0x25FEB6CC, 0xD7E9DC21, 0x1EC92539, 0x9AB1683E, 0x53919126, 0xA186FBCB, 0x68A602D3,
+	0x70CAFE6D, 0xB9EA0775, 0x4BFD6D98, 0x82DD9480, 0x06A5D987, 0xCF85209F, 0x3D924A72, 0xF4B2B36A,
+	0x9C14B1B9, 0x553448A1, 0xA723224C, 0x6E03DB54, 0xEA7B9653, 0x235B6F4B, 0xD14C05A6, 0x186CFCBE,
+	0xE195FCDA, 0x28B505C2, 0xDAA26F2F, 0x13829637, 0x97FADB30, 0x5EDA2228, 0xACCD48C5, 0x65EDB1DD,
+	0x0D4BB30E, 0xC46B4A16, 0x367C20FB, 0xFF5CD9E3, 0x7B2494E4, 0xB2046DFC, 0x40130711, 0x8933FE09,
+	0x915F02B7, 0x587FFBAF, 0xAA689142, 0x6348685A, 0xE730255D, 0x2E10DC45, 0xDC07B6A8, 0x15274FB0,
+	0x7D814D63, 0xB4A1B47B, 0x46B6DE96, 0x8F96278E, 0x0BEE6A89, 0xC2CE9391, 0x30D9F97C, 0xF9F90064,
+	0x6A5D9871, 0xA37D6169, 0x516A0B84, 0x984AF29C, 0x1C32BF9B, 0xD5124683, 0x27052C6E, 0xEE25D576,
+	0x8683D7A5, 0x4FA32EBD, 0xBDB44450, 0x7494BD48, 0xF0ECF04F, 0x39CC0957, 0xCBDB63BA, 0x02FB9AA2,
+	0x1A97661C, 0xD3B79F04, 0x21A0F5E9, 0xE8800CF1, 0x6CF841F6, 0xA5D8B8EE, 0x57CFD203, 0x9EEF2B1B,
+	0xF64929C8, 0x3F69D0D0, 0xCD7EBA3D, 0x045E4325, 0x80260E22, 0x4906F73A, 0xBB119DD7, 0x723164CF,
+	0x8BC864AB, 0x42E89DB3, 0xB0FFF75E, 0x79DF0E46, 0xFDA74341, 0x3487BA59, 0xC690D0B4, 0x0FB029AC,
+	0x67162B7F, 0xAE36D267, 0x5C21B88A, 0x95014192, 0x11790C95, 0xD859F58D, 0x2A4E9F60, 0xE36E6678,
+	0xFB029AC6, 0x322263DE, 0xC0350933, 0x0915F02B, 0x8D6DBD2C, 0x444D4434, 0xB65A2ED9, 0x7F7AD7C1,
+	0x17DCD512, 0xDEFC2C0A, 0x2CEB46E7, 0xE5CBBFFF, 0x61B3F2F8, 0xA8930BE0, 0x5A84610D, 0x93A49815,
+	0xD4BB30E2, 0x1D9BC9FA, 0xEF8CA317, 0x26AC5A0F, 0xA2D41708, 0x6BF4EE10, 0x99E384FD, 0x50C37DE5,
+	0x38657F36, 0xF145862E, 0x0352ECC3, 0xCA7215DB, 0x4E0A58DC, 0x872AA1C4, 0x753DCB29, 0xBC1D3231,
+	0xA471CE8F, 0x6D513797, 0x9F465D7A, 0x5666A462, 0xD21EE965, 0x1B3E107D, 0xE9297A90, 0x20098388,
+	0x48AF815B, 0x818F7843, 0x739812AE, 0xBAB8EBB6, 0x3EC0A6B1, 0xF7E05FA9, 0x05F73544, 0xCCD7CC5C,
+	0x352ECC38, 0xFC0E3520, 0x0E195FCD, 0xC739A6D5, 0x4341EBD2, 0x8A6112CA, 0x78767827, 0xB156813F,
+	0xD9F083EC, 0x10D07AF4, 0xE2C71019, 0x2BE7E901, 0xAF9FA406, 0x66BF5D1E, 0x94A837F3, 0x5D88CEEB,
+	0x45E43255, 0x8CC4CB4D, 0x7ED3A1A0, 0xB7F358B8, 0x338B15BF, 0xFAABECA7, 0x08BC864A, 0xC19C7F52,
+	0xA93A7D81, 0x601A8499, 0x920DEE74, 0x5B2D176C, 0xDF555A6B, 0x1675A373, 0xE462C99E, 0x2D423086,
+	0xBEE6A893, 0x77C6518B, 0x85D13B66, 0x4CF1C27E, 0xC8898F79, 0x01A97661, 0xF3BE1C8C, 0x3A9EE594,
+	0x5238E747, 0x9B181E5F, 0x690F74B2, 0xA02F8DAA, 0x2457C0AD, 0xED7739B5, 0x1F605358, 0xD640AA40,
+	0xCE2C56FE, 0x070CAFE6, 0xF51BC50B, 0x3C3B3C13, 0xB8437114, 0x7163880C, 0x8374E2E1, 0x4A541BF9,
+	0x22F2192A, 0xEBD2E032, 0x19C58ADF, 0xD0E573C7, 0x549D3EC0, 0x9DBDC7D8, 0x6FAAAD35, 0xA68A542D,
+	0x5F735449, 0x9653AD51, 0x6444C7BC, 0xAD643EA4, 0x291C73A3, 0xE03C8ABB, 0x122BE056, 0xDB0B194E,
+	0xB3AD1B9D, 0x7A8DE285, 0x889A8868, 0x41BA7170, 0xC5C23C77, 0x0CE2C56F, 0xFEF5AF82, 0x37D5569A,
+	0x2FB9AA24, 0xE699533C, 0x148E39D1, 0xDDAEC0C9, 0x59D68DCE, 0x90F674D6, 0x62E11E3B, 0xABC1E723,
+	0xC367E5F0, 0x0A471CE8, 0xF8507605, 0x31708F1D, 0xB508C21A, 0x7C283B02, 0x8E3F51EF, 0x471FA8F7,
+	// Seed 0x64
+	0x00000000, 0x39C609F9, 0x738C13F2, 0x4A4A1A0B, 0x72A76D67, 0x4B61649E, 0x012B7E95, 0x38ED776C,
+	0x70F1904D, 0x493799B4, 0x037D83BF, 0x3ABB8A46, 0x0256FD2A, 0x3B90F4D3, 0x71DAEED8, 0x481CE721,
+	0x745C6A19, 0x4D9A63E0, 0x07D079EB, 0x3E167012, 0x06FB077E, 0x3F3D0E87, 0x7577148C, 0x4CB11D75,
+	0x04ADFA54, 0x3D6BF3AD, 0x7721E9A6, 0x4EE7E05F, 0x760A9733, 0x4FCC9ECA, 0x058684C1, 0x3C408D38,
+	0x7D079EB1, 0x44C19748, 0x0E8B8D43, 0x374D84BA, 0x0FA0F3D6, 0x3666FA2F, 0x7C2CE024, 0x45EAE9DD,
+	0x0DF60EFC, 0x34300705, 0x7E7A1D0E, 0x47BC14F7, 0x7F51639B, 0x46976A62, 0x0CDD7069, 0x351B7990,
+	0x095BF4A8, 0x309DFD51, 0x7AD7E75A, 0x4311EEA3, 0x7BFC99CF, 0x423A9036, 0x08708A3D, 0x31B683C4,
+	0x79AA64E5, 0x406C6D1C, 0x0A267717, 0x33E07EEE, 0x0B0D0982, 0x32CB007B, 0x78811A70, 0x41471389,
+	0x6FB077E1, 0x56767E18, 0x1C3C6413, 0x25FA6DEA, 0x1D171A86, 0x24D1137F, 0x6E9B0974, 0x575D008D,
+	0x1F41E7AC, 0x2687EE55, 0x6CCDF45E, 0x550BFDA7, 0x6DE68ACB, 0x54208332, 0x1E6A9939, 0x27AC90C0,
+	0x1BEC1DF8, 0x222A1401, 0x68600E0A, 0x51A607F3, 0x694B709F, 0x508D7966, 0x1AC7636D, 0x23016A94,
+	0x6B1D8DB5, 0x52DB844C, 0x18919E47, 0x215797BE, 0x19BAE0D2, 0x207CE92B, 0x6A36F320, 0x53F0FAD9,
+	0x12B7E950, 0x2B71E0A9, 0x613BFAA2, 0x58FDF35B, 0x60108437, 0x59D68DCE, 0x139C97C5, 0x2A5A9E3C,
+	0x6246791D, 0x5B8070E4, 0x11CA6AEF, 0x280C6316, 0x10E1147A, 0x29271D83, 0x636D0788, 0x5AAB0E71,
+	0x66EB8349, 0x5F2D8AB0, 0x156790BB, 0x2CA19942, 0x144CEE2E, 0x2D8AE7D7, 0x67C0FDDC, 0x5E06F425,
+	0x161A1304, 0x2FDC1AFD, 0x659600F6, 0x5C50090F, 0x64BD7E63, 0x5D7B779A, 0x17316D91, 0x2EF76468,
+	0x4ADFA541, 0x7319ACB8, 0x3953B6B3, 0x0095BF4A, 0x3878C826, 0x01BEC1DF, 0x4BF4DBD4, 0x7232D22D,
+	0x3A2E350C, 0x03E83CF5, 0x49A226FE, 0x70642F07, 0x4889586B, 0x714F5192, 0x3B054B99, 0x02C34260,
+	0x3E83CF58, 0x0745C6A1, 0x4D0FDCAA, 0x74C9D553, 0x4C24A23F, 0x75E2ABC6, 0x3FA8B1CD, 0x066EB834,
+	0x4E725F15, 0x77B456EC, 0x3DFE4CE7, 0x0438451E, 0x3CD53272, 0x05133B8B, 0x4F592180, 0x769F2879,
+	0x37D83BF0, 0x0E1E3209, 0x44542802, 0x7D9221FB, 0x457F5697, 0x7CB95F6E, 0x36F34565, 0x0F354C9C,
+	0x4729ABBD, 0x7EEFA244, 0x34A5B84F, 0x0D63B1B6, 0x358EC6DA, 0x0C48CF23, 0x4602D528, 0x7FC4DCD1,
+	0x438451E9, 0x7A425810, 0x3008421B, 0x09CE4BE2, 0x31233C8E, 0x08E53577, 0x42AF2F7C, 0x7B692685,
+	0x3375C1A4, 0x0AB3C85D, 0x40F9D256, 0x793FDBAF, 0x41D2ACC3, 0x7814A53A, 0x325EBF31, 0x0B98B6C8,
+	0x256FD2A0, 0x1CA9DB59, 0x56E3C152, 0x6F25C8AB, 0x57C8BFC7, 0x6E0EB63E, 0x2444AC35, 0x1D82A5CC,
+	0x559E42ED, 0x6C584B14, 0x2612511F, 0x1FD458E6, 0x27392F8A, 0x1EFF2673, 0x54B53C78, 0x6D733581,
+	0x5133B8B9, 0x68F5B140, 0x22BFAB4B, 0x1B79A2B2, 0x2394D5DE, 0x1A52DC27, 0x5018C62C, 0x69DECFD5,
+	0x21C228F4, 0x1804210D, 0x524E3B06, 0x6B8832FF, 0x53654593, 0x6AA34C6A, 0x20E95661, 0x192F5F98,
+	0x58684C11, 0x61AE45E8, 0x2BE45FE3, 0x1222561A, 0x2ACF2176, 0x1309288F, 0x59433284, 0x60853B7D,
+	0x2899DC5C, 0x115FD5A5, 0x5B15CFAE, 0x62D3C657, 0x5A3EB13B, 0x63F8B8C2, 0x29B2A2C9, 0x1074AB30,
+	0x2C342608, 0x15F22FF1, 0x5FB835FA, 0x667E3C03, 0x5E934B6F, 0x67554296, 0x2D1F589D, 0x14D95164,
+	0x5CC5B645, 0x6503BFBC, 0x2F49A5B7, 0x168FAC4E, 0x2E62DB22, 0x17A4D2DB, 0x5DEEC8D0, 0x6428C129,
+	// Seed 0x65
+	0x00000000, 0x0737C1C6, 0x0E6F838C, 0x0958424A, 0x1CDF0718, 0x1BE8C6DE, 0x12B08494, 0x15874552,
+	0x39BE0E30, 0x3E89CFF6, 0x37D18DBC, 0x30E64C7A, 0x25610928, 0x2256C8EE, 0x2B0E8AA4, 0x2C394B62,
+	0x08CD37CF, 0x0FFAF609, 0x06A2B443, 0x01957585, 0x141230D7, 0x1325F111, 0x1A7DB35B, 0x1D4A729D,
+	0x317339FF, 0x3644F839, 0x3F1CBA73, 0x382B7BB5, 0x2DAC3EE7, 0x2A9BFF21, 0x23C3BD6B, 0x24F47CAD,
+	0x119A6F9E, 0x16ADAE58, 0x1FF5EC12, 0x18C22DD4, 0x0D456886, 0x0A72A940, 0x032AEB0A, 0x041D2ACC,
+	0x282461AE, 0x2F13A068, 0x264BE222, 0x217C23E4, 0x34FB66B6, 0x33CCA770, 0x3A94E53A, 0x3DA324FC,
+	0x19575851, 0x1E609997, 0x1738DBDD, 0x100F1A1B, 0x05885F49, 0x02BF9E8F, 0x0BE7DCC5, 0x0CD01D03,
+	0x20E95661, 0x27DE97A7, 0x2E86D5ED, 0x29B1142B, 0x3C365179, 0x3B0190BF, 0x3259D2F5, 0x356E1333,
+	0x2334DF3C, 0x24031EFA, 0x2D5B5CB0, 0x2A6C9D76, 0x3FEBD824, 0x38DC19E2, 0x31845BA8, 0x36B39A6E,
+	0x1A8AD10C, 0x1DBD10CA, 0x14E55280, 0x13D29346, 0x0655D614, 0x016217D2, 0x083A5598, 0x0F0D945E,
+	0x2BF9E8F3, 0x2CCE2935, 0x25966B7F, 0x22A1AAB9, 0x3726EFEB, 0x30112E2D, 0x39496C67, 0x3E7EADA1,
+	0x1247E6C3, 0x15702705, 0x1C28654F, 0x1B1FA489, 0x0E98E1DB, 0x09AF201D, 0x00F76257, 0x07C0A391,
+	0x32AEB0A2, 0x35997164, 0x3CC1332E, 0x3BF6F2E8, 0x2E71B7BA, 0x2946767C, 0x201E3436, 0x2729F5F0,
+	0x0B10BE92, 0x0C277F54, 0x057F3D1E, 0x0248FCD8, 0x17CFB98A, 0x10F8784C, 0x19A03A06, 0x1E97FBC0,
+	0x3A63876D, 0x3D5446AB, 0x340C04E1, 0x333BC527, 0x26BC8075, 0x218B41B3, 0x28D303F9, 0x2FE4C23F,
+	0x03DD895D, 0x04EA489B, 0x0DB20AD1, 0x0A85CB17, 0x1F028E45, 0x18354F83, 0x116D0DC9, 0x165ACC0F,
+	0x3DD895D7, 0x3AEF5411, 0x33B7165B, 0x3480D79D, 0x210792CF, 0x26305309, 0x2F681143, 0x285FD085,
+	0x04669BE7, 0x03515A21, 0x0A09186B, 0x0D3ED9AD, 0x18B99CFF, 0x1F8E5D39, 0x16D61F73, 0x11E1DEB5,
+	0x3515A218, 0x322263DE, 0x3B7A2194, 0x3C4DE052, 0x29CAA500, 0x2EFD64C6, 0x27A5268C, 0x2092E74A,
+	0x0CABAC28, 0x0B9C6DEE, 0x02C42FA4, 0x05F3EE62, 0x1074AB30, 0x17436AF6, 0x1E1B28BC, 0x192CE97A,
+	0x2C42FA49, 0x2B753B8F, 0x222D79C5, 0x251AB803, 0x309DFD51, 0x37AA3C97, 0x3EF27EDD, 0x39C5BF1B,
+	0x15FCF479, 0x12CB35BF, 0x1B9377F5, 0x1CA4B633, 0x0923F361, 0x0E1432A7, 0x074C70ED, 0x007BB12B,
+	0x248FCD86, 0x23B80C40, 0x2AE04E0A, 0x2DD78FCC, 0x3850CA9E, 0x3F670B58, 0x363F4912, 0x310888D4,
+	0x1D31C3B6, 0x1A060270, 0x135E403A, 0x146981FC, 0x01EEC4AE, 0x06D90568, 0x0F814722, 0x08B686E4,
+	0x1EEC4AEB, 0x19DB8B2D, 0x1083C967, 0x17B408A1, 0x02334DF3, 0x05048C35, 0x0C5CCE7F, 0x0B6B0FB9,
+	0x275244DB, 0x2065851D, 0x293DC757, 0x2E0A0691, 0x3B8D43C3, 0x3CBA8205, 0x35E2C04F, 0x32D50189,
+	0x16217D24, 0x1116BCE2, 0x184EFEA8, 0x1F793F6E, 0x0AFE7A3C, 0x0DC9BBFA, 0x0491F9B0, 0x03A63876,
+	0x2F9F7314, 0x28A8B2D2, 0x21F0F098, 0x26C7315E, 0x3340740C, 0x3477B5CA, 0x3D2FF780, 0x3A183646,
+	0x0F762575, 0x0841E4B3, 0x0119A6F9, 0x062E673F, 0x13A9226D, 0x149EE3AB, 0x1DC6A1E1, 0x1AF16027,
+	0x36C82B45, 0x31FFEA83, 0x38A7A8C9, 0x3F90690F, 0x2A172C5D, 0x2D20ED9B, 0x2478AFD1, 0x234F6E17,
+	0x07BB12BA, 0x008CD37C, 0x09D49136, 0x0EE350F0, 0x1B6415A2, 0x1C53D464, 0x150B962E, 0x123C57E8,
+	0x3E051C8A, 0x3932DD4C, 0x306A9F06, 0x375D5EC0, 0x22DA1B92, 0x25EDDA54, 0x2CB5981E, 0x2B8259D8,
+	// Seed 0x66
+	0x00000000, 0x06FC6ABA, 0x0DF8D574, 0x0B04BFCE, 0x1BF1AAE8, 0x1D0DC052, 0x16097F9C, 0x10F51526,
+	0x37E355D0, 0x311F3F6A, 0x3A1B80A4, 0x3CE7EA1E, 0x2C12FF38, 0x2AEE9582, 0x21EA2A4C, 0x271640F6,
+	0x6FC6ABA0, 0x693AC11A, 0x623E7ED4, 0x64C2146E, 0x74370148, 0x72CB6BF2, 0x79CFD43C, 0x7F33BE86,
+	0x5825FE70, 0x5ED994CA, 0x55DD2B04, 0x532141BE, 0x43D45498, 0x45283E22, 0x4E2C81EC, 0x48D0EB56,
+	0xDF8D5740, 0xD9713DFA, 0xD2758234, 0xD489E88E, 0xC47CFDA8, 0xC2809712, 0xC98428DC, 0xCF784266,
+	0xE86E0290, 0xEE92682A, 0xE596D7E4, 0xE36ABD5E, 0xF39FA878, 0xF563C2C2, 0xFE677D0C, 0xF89B17B6,
+	0xB04BFCE0, 0xB6B7965A, 0xBDB32994, 0xBB4F432E, 0xABBA5608, 0xAD463CB2, 0xA642837C, 0xA0BEE9C6,
+	0x87A8A930, 0x8154C38A, 0x8A507C44, 0x8CAC16FE, 0x9C5903D8, 0x9AA56962, 0x91A1D6AC, 0x975DBC16,
+	0xF6B9265B, 0xF0454CE1, 0xFB41F32F, 0xFDBD9995, 0xED488CB3, 0xEBB4E609, 0xE0B059C7, 0xE64C337D,
+	0xC15A738B, 0xC7A61931, 0xCCA2A6FF, 0xCA5ECC45, 0xDAABD963, 0xDC57B3D9, 0xD7530C17, 0xD1AF66AD,
+	0x997F8DFB, 0x9F83E741, 0x9487588F, 0x927B3235, 0x828E2713, 0x84724DA9, 0x8F76F267, 0x898A98DD,
+	0xAE9CD82B, 0xA860B291, 0xA3640D5F, 0xA59867E5, 0xB56D72C3, 0xB3911879, 0xB895A7B7, 0xBE69CD0D,
+	0x2934711B, 0x2FC81BA1, 0x24CCA46F, 0x2230CED5, 0x32C5DBF3, 0x3439B149, 0x3F3D0E87, 0x39C1643D,
+	0x1ED724CB, 0x182B4E71, 0x132FF1BF, 0x15D39B05, 0x05268E23, 0x03DAE499, 0x08DE5B57, 0x0E2231ED,
+	0x46F2DABB, 0x400EB001, 0x4B0A0FCF, 0x4DF66575, 0x5D037053, 0x5BFF1AE9, 0x50FBA527, 0x5607CF9D,
+	0x71118F6B, 0x77EDE5D1, 0x7CE95A1F, 0x7A1530A5, 0x6AE02583, 0x6C1C4F39, 0x6718F0F7, 0x61E49A4D,
+	0xA4D1C46D, 0xA22DAED7, 0xA9291119, 0xAFD57BA3, 0xBF206E85, 0xB9DC043F, 0xB2D8BBF1, 0xB424D14B,
+	0x933291BD, 0x95CEFB07, 0x9ECA44C9, 0x98362E73, 0x88C33B55, 0x8E3F51EF, 0x853BEE21, 0x83C7849B,
+	0xCB176FCD, 0xCDEB0577, 0xC6EFBAB9, 0xC013D003, 0xD0E6C525, 0xD61AAF9F, 0xDD1E1051, 0xDBE27AEB,
+	0xFCF43A1D, 0xFA0850A7, 0xF10CEF69, 0xF7F085D3, 0xE70590F5, 0xE1F9FA4F, 0xEAFD4581, 0xEC012F3B,
+	0x7B5C932D, 0x7DA0F997, 0x76A44659, 0x70582CE3, 0x60AD39C5, 0x6651537F, 0x6D55ECB1, 0x6BA9860B,
+	0x4CBFC6FD, 0x4A43AC47, 0x41471389, 0x47BB7933, 0x574E6C15, 0x51B206AF, 0x5AB6B961, 0x5C4AD3DB,
+	0x149A388D, 0x12665237, 0x1962EDF9, 0x1F9E8743, 0x0F6B9265, 0x0997F8DF, 0x02934711, 0x046F2DAB,
+	0x23796D5D, 0x258507E7, 0x2E81B829, 0x287DD293, 0x3888C7B5, 0x3E74AD0F, 0x357012C1, 0x338C787B,
+	0x5268E236, 0x5494888C, 0x5F903742, 0x596C5DF8, 0x499948DE, 0x4F652264, 0x44619DAA, 0x429DF710,
+	0x658BB7E6, 0x6377DD5C, 0x68736292, 0x6E8F0828, 0x7E7A1D0E, 0x788677B4, 0x7382C87A, 0x757EA2C0,
+	0x3DAE4996, 0x3B52232C, 0x30569CE2, 0x36AAF658, 0x265FE37E, 0x20A389C4, 0x2BA7360A, 0x2D5B5CB0,
+	0x0A4D1C46, 0x0CB176FC, 0x07B5C932, 0x0149A388, 0x11BCB6AE, 0x1740DC14, 0x1C4463DA, 0x1AB80960,
+	0x8DE5B576, 0x8B19DFCC, 0x801D6002, 0x86E10AB8, 0x96141F9E, 0x90E87524, 0x9BECCAEA, 0x9D10A050,
+	0xBA06E0A6, 0xBCFA8A1C, 0xB7FE35D2, 0xB1025F68, 0xA1F74A4E, 0xA70B20F4, 0xAC0F9F3A, 0xAAF3F580,
+	0xE2231ED6, 0xE4DF746C, 0xEFDBCBA2, 0xE927A118, 0xF9D2B43E, 0xFF2EDE84, 0xF42A614A, 0xF2D60BF0,
+	0xD5C04B06, 0xD33C21BC, 0xD8389E72, 0xDEC4F4C8, 0xCE31E1EE, 0xC8CD8B54, 0xC3C9349A, 0xC5355E20,
+	// Seed 0x67
+	0x00000000, 0x811DAACD, 0xA596BC6D, 0x248B16A0, 0xEC80912D, 0x6D9D3BE0, 0x49162D40, 0xC80B878D,
+	0x7EACCBAD, 0xFFB16160, 0xDB3A77C0, 0x5A27DD0D, 0x922C5A80, 0x1331F04D, 0x37BAE6ED, 0xB6A74C20,
+	0xFD59975A, 0x7C443D97, 0x58CF2B37, 0xD9D281FA, 0x11D90677, 0x90C4ACBA, 0xB44FBA1A, 0x355210D7,
+	0x83F55CF7, 0x02E8F63A, 0x2663E09A, 0xA77E4A57, 0x6F75CDDA, 0xEE686717, 0xCAE371B7, 0x4BFEDB7A,
+	0x5D1EC743, 0xDC036D8E, 0xF8887B2E, 0x7995D1E3, 0xB19E566E, 0x3083FCA3, 0x1408EA03, 0x951540CE,
+	0x23B20CEE, 0xA2AFA623, 0x8624B083, 0x07391A4E, 0xCF329DC3, 0x4E2F370E, 0x6AA421AE, 0xEBB98B63,
+	0xA0475019, 0x215AFAD4, 0x05D1EC74, 0x84CC46B9, 0x4CC7C134, 0xCDDA6BF9, 0xE9517D59, 0x684CD794,
+	0xDEEB9BB4, 0x5FF63179, 0x7B7D27D9, 0xFA608D14, 0x326B0A99, 0xB376A054, 0x97FDB6F4, 0x16E01C39,
+	0xBA3D8E86, 0x3B20244B, 0x1FAB32EB, 0x9EB69826, 0x56BD1FAB, 0xD7A0B566, 0xF32BA3C6, 0x7236090B,
+	0xC491452B, 0x458CEFE6, 0x6107F946, 0xE01A538B, 0x2811D406, 0xA90C7ECB, 0x8D87686B, 0x0C9AC2A6,
+	0x476419DC, 0xC679B311, 0xE2F2A5B1, 0x63EF0F7C, 0xABE488F1, 0x2AF9223C, 0x0E72349C, 0x8F6F9E51,
+	0x39C8D271, 0xB8D578BC, 0x9C5E6E1C, 0x1D43C4D1, 0xD548435C, 0x5455E991, 0x70DEFF31, 0xF1C355FC,
+	0xE72349C5, 0x663EE308, 0x42B5F5A8, 0xC3A85F65, 0x0BA3D8E8, 0x8ABE7225, 0xAE356485, 0x2F28CE48,
+	0x998F8268, 0x189228A5, 0x3C193E05, 0xBD0494C8, 0x750F1345, 0xF412B988, 0xD099AF28, 0x518405E5,
+	0x1A7ADE9F, 0x9B677452, 0xBFEC62F2, 0x3EF1C83F, 0xF6FA4FB2, 0x77E7E57F, 0x536CF3DF, 0xD2715912,
+	0x64D61532, 0xE5CBBFFF, 0xC140A95F, 0x405D0392, 0x8856841F, 0x094B2ED2, 0x2DC03872, 0xACDD92BF,
+	0xD3D6F4FB, 0x52CB5E36, 0x76404896, 0xF75DE25B, 0x3F5665D6, 0xBE4BCF1B, 0x9AC0D9BB, 0x1BDD7376,
+	0xAD7A3F56, 0x2C67959B, 0x08EC833B, 0x89F129F6, 0x41FAAE7B, 0xC0E704B6, 0xE46C1216, 0x6571B8DB,
+	0x2E8F63A1, 0xAF92C96C, 0x8B19DFCC, 0x0A047501, 0xC20FF28C, 0x43125841, 0x67994EE1, 0xE684E42C,
+	0x5023A80C, 0xD13E02C1, 0xF5B51461, 0x74A8BEAC, 0xBCA33921, 0x3DBE93EC, 0x1935854C, 0x98282F81,
+	0x8EC833B8, 0x0FD59975, 0x2B5E8FD5, 0xAA432518, 0x6248A295, 0xE3550858, 0xC7DE1EF8, 0x46C3B435,
+	0xF064F815, 0x717952D8, 0x55F24478, 0xD4EFEEB5, 0x1CE46938, 0x9DF9C3F5, 0xB972D555, 0x386F7F98,
+	0x7391A4E2, 0xF28C0E2F, 0xD607188F, 0x571AB242, 0x9F1135CF, 0x1E0C9F02, 0x3A8789A2, 0xBB9A236F,
+	0x0D3D6F4F, 0x8C20C582, 0xA8ABD322, 0x29B679EF, 0xE1BDFE62, 0x60A054AF, 0x442B420F, 0xC536E8C2,
+	0x69EB7A7D, 0xE8F6D0B0, 0xCC7DC610, 0x4D606CDD, 0x856BEB50, 0x0476419D, 0x20FD573D, 0xA1E0FDF0,
+	0x1747B1D0, 0x965A1B1D, 0xB2D10DBD, 0x33CCA770, 0xFBC720FD, 0x7ADA8A30, 0x5E519C90, 0xDF4C365D,
+	0x94B2ED27, 0x15AF47EA, 0x3124514A, 0xB039FB87, 0x78327C0A, 0xF92FD6C7, 0xDDA4C067, 0x5CB96AAA,
+	0xEA1E268A, 0x6B038C47, 0x4F889AE7, 0xCE95302A, 0x069EB7A7, 0x87831D6A, 0xA3080BCA, 0x2215A107,
+	0x34F5BD3E, 0xB5E817F3, 0x91630153, 0x107EAB9E, 0xD8752C13, 0x596886DE, 0x7DE3907E, 0xFCFE3AB3,
+	0x4A597693, 0xCB44DC5E, 0xEFCFCAFE, 0x6ED26033, 0xA6D9E7BE, 0x27C44D73, 0x034F5BD3, 0x8252F11E,
+	0xC9AC2A64, 0x48B180A9, 0x6C3A9609, 0xED273CC4, 0x252CBB49, 0xA4311184, 0x80BA0724, 0x01A7ADE9,
+	0xB700E1C9, 0x361D4B04, 0x12965DA4, 0x938BF769, 0x5B8070E4, 0xDA9DDA29, 0xFE16CC89, 0x7F0B6644,
+	// Seed 0x68
+	0x00000000, 0x41F475F3, 0x053B3933, 0x44CF4CC0, 0x0A767266, 0x4B820795, 0x0F4D4B55, 0x4EB93EA6,
+	0x14ECE4CC, 0x5518913F, 0x11D7DDFF, 0x5023A80C, 0x1E9A96AA, 0x5F6EE359, 0x1BA1AF99, 0x5A55DA6A,
+	0x29D9C998, 0x682DBC6B, 0x2CE2F0AB, 0x6D168558, 0x23AFBBFE, 0x625BCE0D, 0x269482CD, 0x6760F73E,
+	0x3D352D54, 0x7CC158A7, 0x380E1467, 0x79FA6194, 0x37435F32, 0x76B72AC1, 0x32786601, 0x738C13F2,
+	0x53B39330, 0x1247E6C3, 0x5688AA03, 0x177CDFF0, 0x59C5E156, 0x183194A5, 0x5CFED865, 0x1D0AAD96,
+	0x475F77FC, 0x06AB020F, 0x42644ECF, 0x03903B3C, 0x4D29059A, 0x0CDD7069, 0x48123CA9, 0x09E6495A,
+	0x7A6A5AA8, 0x3B9E2F5B, 0x7F51639B, 0x3EA51668, 0x701C28CE, 0x31E85D3D, 0x752711FD, 0x34D3640E,
+	0x6E86BE64, 0x2F72CB97, 0x6BBD8757, 0x2A49F2A4, 0x64F0CC02, 0x2504B9F1, 0x61CBF531, 0x203F80C2,
+	0x21B4F4B5, 0x60408146, 0x248FCD86, 0x657BB875, 0x2BC286D3, 0x6A36F320, 0x2EF9BFE0, 0x6F0DCA13,
+	0x35581079, 0x74AC658A, 0x3063294A, 0x71975CB9, 0x3F2E621F, 0x7EDA17EC, 0x3A155B2C, 0x7BE12EDF,
+	0x086D3D2D, 0x499948DE, 0x0D56041E, 0x4CA271ED, 0x021B4F4B, 0x43EF3AB8, 0x07207678, 0x46D4038B,
+	0x1C81D9E1, 0x5D75AC12, 0x19BAE0D2, 0x584E9521, 0x16F7AB87, 0x5703DE74, 0x13CC92B4, 0x5238E747,
+	0x72076785, 0x33F31276, 0x773C5EB6, 0x36C82B45, 0x787115E3, 0x39856010, 0x7D4A2CD0, 0x3CBE5923,
+	0x66EB8349, 0x271FF6BA, 0x63D0BA7A, 0x2224CF89, 0x6C9DF12F, 0x2D6984DC, 0x69A6C81C, 0x2852BDEF,
+	0x5BDEAE1D, 0x1A2ADBEE, 0x5EE5972E, 0x1F11E2DD, 0x51A8DC7B, 0x105CA988, 0x5493E548, 0x156790BB,
+	0x4F324AD1, 0x0EC63F22, 0x4A0973E2, 0x0BFD0611, 0x454438B7, 0x04B04D44, 0x407F0184, 0x018B7477,
+	0x4369E96A, 0x029D9C99, 0x4652D059, 0x07A6A5AA, 0x491F9B0C, 0x08EBEEFF, 0x4C24A23F, 0x0DD0D7CC,
+	0x57850DA6, 0x16717855, 0x52BE3495, 0x134A4166, 0x5DF37FC0, 0x1C070A33, 0x58C846F3, 0x193C3300,
+	0x6AB020F2, 0x2B445501, 0x6F8B19C1, 0x2E7F6C32, 0x60C65294, 0x21322767, 0x65FD6BA7, 0x24091E54,
+	0x7E5CC43E, 0x3FA8B1CD, 0x7B67FD0D, 0x3A9388FE, 0x742AB658, 0x35DEC3AB, 0x71118F6B, 0x30E5FA98,
+	0x10DA7A5A, 0x512E0FA9, 0x15E14369, 0x5415369A, 0x1AAC083C, 0x5B587DCF, 0x1F97310F, 0x5E6344FC,
+	0x04369E96, 0x45C2EB65, 0x010DA7A5, 0x40F9D256, 0x0E40ECF0, 0x4FB49903, 0x0B7BD5C3, 0x4A8FA030,
+	0x3903B3C2, 0x78F7C631, 0x3C388AF1, 0x7DCCFF02, 0x3375C1A4, 0x7281B457, 0x364EF897, 0x77BA8D64,
+	0x2DEF570E, 0x6C1B22FD, 0x28D46E3D, 0x69201BCE, 0x27992568, 0x666D509B, 0x22A21C5B, 0x635669A8,
+	0x62DD1DDF, 0x2329682C, 0x67E624EC, 0x2612511F, 0x68AB6FB9, 0x295F1A4A, 0x6D90568A, 0x2C642379,
+	0x7631F913, 0x37C58CE0, 0x730AC020, 0x32FEB5D3, 0x7C478B75, 0x3DB3FE86, 0x797CB246, 0x3888C7B5,
+	0x4B04D447, 0x0AF0A1B4, 0x4E3FED74, 0x0FCB9887, 0x4172A621, 0x0086D3D2, 0x44499F12, 0x05BDEAE1,
+	0x5FE8308B, 0x1E1C4578, 0x5AD309B8, 0x1B277C4B, 0x559E42ED, 0x146A371E, 0x50A57BDE, 0x11510E2D,
+	0x316E8EEF, 0x709AFB1C, 0x3455B7DC, 0x75A1C22F, 0x3B18FC89, 0x7AEC897A, 0x3E23C5BA, 0x7FD7B049,
+	0x25826A23, 0x64761FD0, 0x20B95310, 0x614D26E3, 0x2FF41845, 0x6E006DB6, 0x2ACF2176, 0x6B3B5485,
+	0x18B74777, 0x59433284, 0x1D8C7E44, 0x5C780BB7, 0x12C13511, 0x533540E2, 0x17FA0C22, 0x560E79D1,
+	0x0C5BA3BB, 0x4DAFD648, 0x09609A88, 0x4894EF7B, 0x062DD1DD, 0x47D9A42E, 0x0316E8EE, 0x42E29D1D,
+	// Seed 0x69
+	0x00000000, 0x3CD68490, 0x1170BAD9, 0x2DA63E49, 0x22E175B2, 0x1E37F122, 0x3391CF6B, 0x0F474BFB,
+	0x2D1F589D, 0x11C9DC0D, 0x3C6FE244, 0x00B966D4, 0x0FFE2D2F, 0x3328A9BF, 0x1E8E97F6, 0x22581366,
+	0x32E302C3, 0x0E358653, 0x2393B81A, 0x1F453C8A, 0x10027771, 0x2CD4F3E1, 0x0172CDA8, 0x3DA44938,
+	0x1FFC5A5E, 0x232ADECE, 0x0E8CE087, 0x325A6417, 0x3D1D2FEC, 0x01CBAB7C, 0x2C6D9535, 0x10BB11A5,
+	0x0D1BB67F, 0x31CD32EF, 0x1C6B0CA6, 0x20BD8836, 0x2FFAC3CD, 0x132C475D, 0x3E8A7914, 0x025CFD84,
+	0x2004EEE2, 0x1CD26A72, 0x3174543B, 0x0DA2D0AB, 0x02E59B50, 0x3E331FC0, 0x13952189, 0x2F43A519,
+	0x3FF8B4BC, 0x032E302C, 0x2E880E65, 0x125E8AF5, 0x1D19C10E, 0x21CF459E, 0x0C697BD7, 0x30BFFF47,
+	0x12E7EC21, 0x2E3168B1, 0x039756F8, 0x3F41D268, 0x30069993, 0x0CD01D03, 0x2176234A, 0x1DA0A7DA,
+	0x1A376CFE, 0x26E1E86E, 0x0B47D627, 0x379152B7, 0x38D6194C, 0x04009DDC, 0x29A6A395, 0x15702705,
+	0x37283463, 0x0BFEB0F3, 0x26588EBA, 0x1A8E0A2A, 0x15C941D1, 0x291FC541, 0x04B9FB08, 0x386F7F98,
+	0x28D46E3D, 0x1402EAAD, 0x39A4D4E4, 0x05725074, 0x0A351B8F, 0x36E39F1F, 0x1B45A156, 0x279325C6,
+	0x05CB36A0, 0x391DB230, 0x14BB8C79, 0x286D08E9, 0x272A4312, 0x1BFCC782, 0x365AF9CB, 0x0A8C7D5B,
+	0x172CDA81, 0x2BFA5E11, 0x065C6058, 0x3A8AE4C8, 0x35CDAF33, 0x091B2BA3, 0x24BD15EA, 0x186B917A,
+	0x3A33821C, 0x06E5068C, 0x2B4338C5, 0x1795BC55, 0x18D2F7AE, 0x2404733E, 0x09A24D77, 0x3574C9E7,
+	0x25CFD842, 0x19195CD2, 0x34BF629B, 0x0869E60B, 0x072EADF0, 0x3BF82960, 0x165E1729, 0x2A8893B9,
+	0x08D080DF, 0x3406044F, 0x19A03A06, 0x2576BE96, 0x2A31F56D, 0x16E771FD, 0x3B414FB4, 0x0797CB24,
+	0x346ED9FC, 0x08B85D6C, 0x251E6325, 0x19C8E7B5, 0x168FAC4E, 0x2A5928DE, 0x07FF1697, 0x3B299207,
+	0x19718161, 0x25A705F1, 0x08013BB8, 0x34D7BF28, 0x3B90F4D3, 0x07467043, 0x2AE04E0A, 0x1636CA9A,
+	0x068DDB3F, 0x3A5B5FAF, 0x17FD61E6, 0x2B2BE576, 0x246CAE8D, 0x18BA2A1D, 0x351C1454, 0x09CA90C4,
+	0x2B9283A2, 0x17440732, 0x3AE2397B, 0x0634BDEB, 0x0973F610, 0x35A57280, 0x18034CC9, 0x24D5C859,
+	0x39756F83, 0x05A3EB13, 0x2805D55A, 0x14D351CA, 0x1B941A31, 0x27429EA1, 0x0AE4A0E8, 0x36322478,
+	0x146A371E, 0x28BCB38E, 0x051A8DC7, 0x39CC0957, 0x368B42AC, 0x0A5DC63C, 0x27FBF875, 0x1B2D7CE5,
+	0x0B966D40, 0x3740E9D0, 0x1AE6D799, 0x26305309, 0x297718F2, 0x15A19C62, 0x3807A22B, 0x04D126BB,
+	0x268935DD, 0x1A5FB14D, 0x37F98F04, 0x0B2F0B94, 0x0468406F, 0x38BEC4FF, 0x1518FAB6, 0x29CE7E26,
+	0x2E59B502, 0x128F3192, 0x3F290FDB, 0x03FF8B4B, 0x0CB8C0B0, 0x306E4420, 0x1DC87A69, 0x211EFEF9,
+	0x0346ED9F, 0x3F90690F, 0x12365746, 0x2EE0D3D6, 0x21A7982D, 0x1D711CBD, 0x30D722F4, 0x0C01A664,
+	0x1CBAB7C1, 0x206C3351, 0x0DCA0D18, 0x311C8988, 0x3E5BC273, 0x028D46E3, 0x2F2B78AA, 0x13FDFC3A,
+	0x31A5EF5C, 0x0D736BCC, 0x20D55585, 0x1C03D115, 0x13449AEE, 0x2F921E7E, 0x02342037, 0x3EE2A4A7,
+	0x2342037D, 0x1F9487ED, 0x3232B9A4, 0x0EE43D34, 0x01A376CF, 0x3D75F25F, 0x10D3CC16, 0x2C054886,
+	0x0E5D5BE0, 0x328BDF70, 0x1F2DE139, 0x23FB65A9, 0x2CBC2E52, 0x106AAAC2, 0x3DCC948B, 0x011A101B,
+	0x11A101BE, 0x2D77852E, 0x00D1BB67, 0x3C073FF7, 0x3340740C, 0x0F96F09C, 0x2230CED5, 0x1EE64A45,
+	0x3CBE5923, 0x0068DDB3, 0x2DCEE3FA, 0x1118676A, 0x1E5F2C91, 0x2289A801, 0x0F2F9648, 0x33F912D8,
+	// Seed 0x6A
+	0x00000000, 0x1B4B7ADE, 0x3696F5BC, 0x2DDD8F62, 0x6D2DEB78, 0x766691A6, 0x5BBB1EC4, 0x40F0641A,
+	0xDA5BD6F0, 0xC110AC2E, 0xECCD234C, 0xF7865992, 0xB7763D88, 0xAC3D4756, 0x81E0C834, 0x9AABB2EA,
+	0xEE78BD6D, 0xF533C7B3, 0xD8EE48D1, 0xC3A5320F, 0x83555615, 0x981E2CCB, 0xB5C3A3A9, 0xAE88D977,
+	0x34236B9D, 0x2F681143, 0x02B59E21, 0x19FEE4FF, 0x590E80E5, 0x4245FA3B, 0x6F987559, 0x74D30F87,
+	0x863E6A57, 0x9D751089, 0xB0A89FEB, 0xABE3E535, 0xEB13812F, 0xF058FBF1, 0xDD857493, 0xC6CE0E4D,
+	0x5C65BCA7, 0x472EC679, 0x6AF3491B, 0x71B833C5, 0x314857DF, 0x2A032D01, 0x07DEA263, 0x1C95D8BD,
+	0x6846D73A, 0x730DADE4, 0x5ED02286, 0x459B5858, 0x056B3C42, 0x1E20469C, 0x33FDC9FE, 0x28B6B320,
+	0xB21D01CA, 0xA9567B14, 0x848BF476, 0x9FC08EA8, 0xDF30EAB2, 0xC47B906C, 0xE9A61F0E, 0xF2ED65D0,
+	0x56B3C423, 0x4DF8BEFD, 0x6025319F, 0x7B6E4B41, 0x3B9E2F5B, 0x20D55585, 0x0D08DAE7, 0x1643A039,
+	0x8CE812D3, 0x97A3680D, 0xBA7EE76F, 0xA1359DB1, 0xE1C5F9AB, 0xFA8E8375, 0xD7530C17, 0xCC1876C9,
+	0xB8CB794E, 0xA3800390, 0x8E5D8CF2, 0x9516F62C, 0xD5E69236, 0xCEADE8E8, 0xE370678A, 0xF83B1D54,
+	0x6290AFBE, 0x79DBD560, 0x54065A02, 0x4F4D20DC, 0x0FBD44C6, 0x14F63E18, 0x392BB17A, 0x2260CBA4,
+	0xD08DAE74, 0xCBC6D4AA, 0xE61B5BC8, 0xFD502116, 0xBDA0450C, 0xA6EB3FD2, 0x8B36B0B0, 0x907DCA6E,
+	0x0AD67884, 0x119D025A, 0x3C408D38, 0x270BF7E6, 0x67FB93FC, 0x7CB0E922, 0x516D6640, 0x4A261C9E,
+	0x3EF51319, 0x25BE69C7, 0x0863E6A5, 0x13289C7B, 0x53D8F861, 0x489382BF, 0x654E0DDD, 0x7E057703,
+	0xE4AEC5E9, 0xFFE5BF37, 0xD2383055, 0xC9734A8B, 0x89832E91, 0x92C8544F, 0xBF15DB2D, 0xA45EA1F3,
+	0xAD678846, 0xB62CF298, 0x9BF17DFA, 0x80BA0724, 0xC04A633E, 0xDB0119E0, 0xF6DC9682, 0xED97EC5C,
+	0x773C5EB6, 0x6C772468, 0x41AAAB0A, 0x5AE1D1D4, 0x1A11B5CE, 0x015ACF10, 0x2C874072, 0x37CC3AAC,
+	0x431F352B, 0x58544FF5, 0x7589C097, 0x6EC2BA49, 0x2E32DE53, 0x3579A48D, 0x18A42BEF, 0x03EF5131,
+	0x9944E3DB, 0x820F9905, 0xAFD21667, 0xB4996CB9, 0xF46908A3, 0xEF22727D, 0xC2FFFD1F, 0xD9B487C1,
+	0x2B59E211, 0x301298CF, 0x1DCF17AD, 0x06846D73, 0x46740969, 0x5D3F73B7, 0x70E2FCD5, 0x6BA9860B,
+	0xF10234E1, 0xEA494E3F, 0xC794C15D, 0xDCDFBB83, 0x9C2FDF99, 0x8764A547, 0xAAB92A25, 0xB1F250FB,
+	0xC5215F7C, 0xDE6A25A2, 0xF3B7AAC0, 0xE8FCD01E, 0xA80CB404, 0xB347CEDA, 0x9E9A41B8, 0x85D13B66,
+	0x1F7A898C, 0x0431F352, 0x29EC7C30, 0x32A706EE, 0x725762F4, 0x691C182A, 0x44C19748, 0x5F8AED96,
+	0xFBD44C65, 0xE09F36BB, 0xCD42B9D9, 0xD609C307, 0x96F9A71D, 0x8DB2DDC3, 0xA06F52A1, 0xBB24287F,
+	0x218F9A95, 0x3AC4E04B, 0x17196F29, 0x0C5215F7, 0x4CA271ED, 0x57E90B33, 0x7A348451, 0x617FFE8F,
+	0x15ACF108, 0x0EE78BD6, 0x233A04B4, 0x38717E6A, 0x78811A70, 0x63CA60AE, 0x4E17EFCC, 0x555C9512,
+	0xCFF727F8, 0xD4BC5D26, 0xF961D244, 0xE22AA89A, 0xA2DACC80, 0xB991B65E, 0x944C393C, 0x8F0743E2,
+	0x7DEA2632, 0x66A15CEC, 0x4B7CD38E, 0x5037A950, 0x10C7CD4A, 0x0B8CB794, 0x265138F6, 0x3D1A4228,
+	0xA7B1F0C2, 0xBCFA8A1C, 0x9127057E, 0x8A6C7FA0, 0xCA9C1BBA, 0xD1D76164, 0xFC0AEE06, 0xE74194D8,
+	0x93929B5F, 0x88D9E181, 0xA5046EE3, 0xBE4F143D, 0xFEBF7027, 0xE5F40AF9, 0xC829859B, 0xD362FF45,
+	0x49C94DAF, 0x52823771, 0x7F5FB813, 0x6414C2CD, 0x24E4A6D7, 0x3FAFDC09, 0x1272536B, 0x093929B5,
+	// Seed 0x6B
+	0x00000000, 0xED4C5795, 0x6E59DE8B, 0x8315891E, 0xDCB3BD16, 0x31FFEA83, 0xB2EA639D, 0x5FA63408,
+	0x0DA60B8D, 0xE0EA5C18, 0x63FFD506, 0x8EB38293, 0xD115B69B, 0x3C59E10E, 0xBF4C6810, 0x52003F85,
+	0x1B4C171A, 0xF600408F, 0x7515C991, 0x98599E04, 0xC7FFAA0C, 0x2AB3FD99, 0xA9A67487, 0x44EA2312,
+	0x16EA1C97, 0xFBA64B02, 0x78B3C21C, 0x95FF9589, 0xCA59A181, 0x2715F614, 0xA4007F0A, 0x494C289F,
+	0x36982E34, 0xDBD479A1, 0x58C1F0BF, 0xB58DA72A, 0xEA2B9322, 0x0767C4B7, 0x84724DA9, 0x693E1A3C,
+	0x3B3E25B9, 0xD672722C, 0x5567FB32, 0xB82BACA7, 0xE78D98AF, 0x0AC1CF3A, 0x89D44624, 0x649811B1,
+	0x2DD4392E, 0xC0986EBB, 0x438DE7A5, 0xAEC1B030, 0xF1678438, 0x1C2BD3AD, 0x9F3E5AB3, 0x72720D26,
+	0x207232A3, 0xCD3E6536, 0x4E2BEC28, 0xA367BBBD, 0xFCC18FB5, 0x118DD820, 0x9298513E, 0x7FD406AB,
+	0x6D305C68, 0x807C0BFD, 0x036982E3, 0xEE25D576, 0xB183E17E, 0x5CCFB6EB, 0xDFDA3FF5, 0x32966860,
+	0x609657E5, 0x8DDA0070, 0x0ECF896E, 0xE383DEFB, 0xBC25EAF3, 0x5169BD66, 0xD27C3478, 0x3F3063ED,
+	0x767C4B72, 0x9B301CE7, 0x182595F9, 0xF569C26C, 0xAACFF664, 0x4783A1F1, 0xC49628EF, 0x29DA7F7A,
+	0x7BDA40FF, 0x9696176A, 0x15839E74, 0xF8CFC9E1, 0xA769FDE9, 0x4A25AA7C, 0xC9302362, 0x247C74F7,
+	0x5BA8725C, 0xB6E425C9, 0x35F1ACD7, 0xD8BDFB42, 0x871BCF4A, 0x6A5798DF, 0xE94211C1, 0x040E4654,
+	0x560E79D1, 0xBB422E44, 0x3857A75A, 0xD51BF0CF, 0x8ABDC4C7, 0x67F19352, 0xE4E41A4C, 0x09A84DD9,
+	0x40E46546, 0xADA832D3, 0x2EBDBBCD, 0xC3F1EC58, 0x9C57D850, 0x711B8FC5, 0xF20E06DB, 0x1F42514E,
+	0x4D426ECB, 0xA00E395E, 0x231BB040, 0xCE57E7D5, 0x91F1D3DD, 0x7CBD8448, 0xFFA80D56, 0x12E45AC3,
+	0xDA60B8D0, 0x372CEF45, 0xB439665B, 0x597531CE, 0x06D305C6, 0xEB9F5253, 0x688ADB4D, 0x85C68CD8,
+	0xD7C6B35D, 0x3A8AE4C8, 0xB99F6DD6, 0x54D33A43, 0x0B750E4B, 0xE63959DE, 0x652CD0C0, 0x88608755,
+	0xC12CAFCA, 0x2C60F85F, 0xAF757141, 0x423926D4, 0x1D9F12DC, 0xF0D34549, 0x73C6CC57, 0x9E8A9BC2,
+	0xCC8AA447, 0x21C6F3D2, 0xA2D37ACC, 0x4F9F2D59, 0x10391951, 0xFD754EC4, 0x7E60C7DA, 0x932C904F,
+	0xECF896E4, 0x01B4C171, 0x82A1486F, 0x6FED1FFA, 0x304B2BF2, 0xDD077C67, 0x5E12F579, 0xB35EA2EC,
+	0xE15E9D69, 0x0C12CAFC, 0x8F0743E2, 0x624B1477, 0x3DED207F, 0xD0A177EA, 0x53B4FEF4, 0xBEF8A961,
+	0xF7B481FE, 0x1AF8D66B, 0x99ED5F75, 0x74A108E0, 0x2B073CE8, 0xC64B6B7D, 0x455EE263, 0xA812B5F6,
+	0xFA128A73, 0x175EDDE6, 0x944B54F8, 0x7907036D, 0x26A13765, 0xCBED60F0, 0x48F8E9EE, 0xA5B4BE7B,
+	0xB750E4B8, 0x5A1CB32D, 0xD9093A33, 0x34456DA6, 0x6BE359AE, 0x86AF0E3B, 0x05BA8725, 0xE8F6D0B0,
+	0xBAF6EF35, 0x57BAB8A0, 0xD4AF31BE, 0x39E3662B, 0x66455223, 0x8B0905B6, 0x081C8CA8, 0xE550DB3D,
+	0xAC1CF3A2, 0x4150A437, 0xC2452D29, 0x2F097ABC, 0x70AF4EB4, 0x9DE31921, 0x1EF6903F, 0xF3BAC7AA,
+	0xA1BAF82F, 0x4CF6AFBA, 0xCFE326A4, 0x22AF7131, 0x7D094539, 0x904512AC, 0x13509BB2, 0xFE1CCC27,
+	0x81C8CA8C, 0x6C849D19, 0xEF911407, 0x02DD4392, 0x5D7B779A, 0xB037200F, 0x3322A911, 0xDE6EFE84,
+	0x8C6EC101, 0x61229694, 0xE2371F8A, 0x0F7B481F, 0x50DD7C17, 0xBD912B82, 0x3E84A29C, 0xD3C8F509,
+	0x9A84DD96, 0x77C88A03, 0xF4DD031D, 0x19915488, 0x46376080, 0xAB7B3715, 0x286EBE0B, 0xC522E99E,
+	0x9722D61B, 0x7A6E818E, 0xF97B0890, 0x14375F05, 0x4B916B0D, 0xA6DD3C98, 0x25C8B586, 0xC884E213,
+	// Seed 0x6C
+	0x00000000, 0x585DF9B9, 0x38B3A995, 0x60EE502C, 0x7167532A, 0x293AAA93, 0x49D4FABF, 0x11890306,
+	0x6AC6FCB3, 0x329B050A, 0x52755526, 0x0A28AC9F, 0x1BA1AF99, 0x43FC5620, 0x2312060C, 0x7B4FFFB5,
+	0x5D85A381, 0x05D85A38, 0x65360A14, 0x3D6BF3AD, 0x2CE2F0AB, 0x74BF0912, 0x1451593E, 0x4C0CA087,
+	0x37435F32, 0x6F1EA68B, 0x0FF0F6A7, 0x57AD0F1E, 0x46240C18, 0x1E79F5A1, 0x7E97A58D, 0x26CA5C34,
+	0x33031DE5, 0x6B5EE45C, 0x0BB0B470, 0x53ED4DC9, 0x42644ECF, 0x1A39B776, 0x7AD7E75A, 0x228A1EE3,
+	0x59C5E156, 0x019818EF, 0x617648C3, 0x392BB17A, 0x28A2B27C, 0x70FF4BC5, 0x10111BE9, 0x484CE250,
+	0x6E86BE64, 0x36DB47DD, 0x563517F1, 0x0E68EE48, 0x1FE1ED4E, 0x47BC14F7, 0x275244DB, 0x7F0FBD62,
+	0x044042D7, 0x5C1DBB6E, 0x3CF3EB42, 0x64AE12FB, 0x752711FD, 0x2D7AE844, 0x4D94B868, 0x15C941D1,
+	0x66063BCA, 0x3E5BC273, 0x5EB5925F, 0x06E86BE6, 0x176168E0, 0x4F3C9159, 0x2FD2C175, 0x778F38CC,
+	0x0CC0C779, 0x549D3EC0, 0x34736EEC, 0x6C2E9755, 0x7DA79453, 0x25FA6DEA, 0x45143DC6, 0x1D49C47F,
+	0x3B83984B, 0x63DE61F2, 0x033031DE, 0x5B6DC867, 0x4AE4CB61, 0x12B932D8, 0x725762F4, 0x2A0A9B4D,
+	0x514564F8, 0x09189D41, 0x69F6CD6D, 0x31AB34D4, 0x202237D2, 0x787FCE6B, 0x18919E47, 0x40CC67FE,
+	0x5505262F, 0x0D58DF96, 0x6DB68FBA, 0x35EB7603, 0x24627505, 0x7C3F8CBC, 0x1CD1DC90, 0x448C2529,
+	0x3FC3DA9C, 0x679E2325, 0x07707309, 0x5F2D8AB0, 0x4EA489B6, 0x16F9700F, 0x76172023, 0x2E4AD99A,
+	0x088085AE, 0x50DD7C17, 0x30332C3B, 0x686ED582, 0x79E7D684, 0x21BA2F3D, 0x41547F11, 0x190986A8,
+	0x6246791D, 0x3A1B80A4, 0x5AF5D088, 0x02A82931, 0x13212A37, 0x4B7CD38E, 0x2B9283A2, 0x73CF7A1B,
+	0x44042D73, 0x1C59D4CA, 0x7CB784E6, 0x24EA7D5F, 0x35637E59, 0x6D3E87E0, 0x0DD0D7CC, 0x558D2E75,
+	0x2EC2D1C0, 0x769F2879, 0x16717855, 0x4E2C81EC, 0x5FA582EA, 0x07F87B53, 0x67162B7F, 0x3F4BD2C6,
+	0x19818EF2, 0x41DC774B, 0x21322767, 0x796FDEDE, 0x68E6DDD8, 0x30BB2461, 0x5055744D, 0x08088DF4,
+	0x73477241, 0x2B1A8BF8, 0x4BF4DBD4, 0x13A9226D, 0x0220216B, 0x5A7DD8D2, 0x3A9388FE, 0x62CE7147,
+	0x77073096, 0x2F5AC92F, 0x4FB49903, 0x17E960BA, 0x066063BC, 0x5E3D9A05, 0x3ED3CA29, 0x668E3390,
+	0x1DC1CC25, 0x459C359C, 0x257265B0, 0x7D2F9C09, 0x6CA69F0F, 0x34FB66B6, 0x5415369A, 0x0C48CF23,
+	0x2A829317, 0x72DF6AAE, 0x12313A82, 0x4A6CC33B, 0x5BE5C03D, 0x03B83984, 0x635669A8, 0x3B0B9011,
+	0x40446FA4, 0x1819961D, 0x78F7C631, 0x20AA3F88, 0x31233C8E, 0x697EC537, 0x0990951B, 0x51CD6CA2,
+	0x220216B9, 0x7A5FEF00, 0x1AB1BF2C, 0x42EC4695, 0x53654593, 0x0B38BC2A, 0x6BD6EC06, 0x338B15BF,
+	0x48C4EA0A, 0x109913B3, 0x7077439F, 0x282ABA26, 0x39A3B920, 0x61FE4099, 0x011010B5, 0x594DE90C,
+	0x7F87B538, 0x27DA4C81, 0x47341CAD, 0x1F69E514, 0x0EE0E612, 0x56BD1FAB, 0x36534F87, 0x6E0EB63E,
+	0x1541498B, 0x4D1CB032, 0x2DF2E01E, 0x75AF19A7, 0x64261AA1, 0x3C7BE318, 0x5C95B334, 0x04C84A8D,
+	0x11010B5C, 0x495CF2E5, 0x29B2A2C9, 0x71EF5B70, 0x60665876, 0x383BA1CF, 0x58D5F1E3, 0x0088085A,
+	0x7BC7F7EF, 0x239A0E56, 0x43745E7A, 0x1B29A7C3, 0x0AA0A4C5, 0x52FD5D7C, 0x32130D50, 0x6A4EF4E9,
+	0x4C84A8DD, 0x14D95164, 0x74370148, 0x2C6AF8F1, 0x3DE3FBF7, 0x65BE024E, 0x05505262, 0x5D0DABDB,
+	0x2642546E, 0x7E1FADD7, 0x1EF1FDFB, 0x46AC0442, 0x57250744, 0x0F78FEFD, 0x6F96AED1, 0x37CB5768,
+	// Seed 0x6D
+	0x00000000, 0x1ED3FFED, 0x3DA7FFDA, 0x23740037, 0x1D49C47F, 0x039A3B92, 0x20EE3BA5, 0x3E3DC448,
+	0x3A9388FE, 0x24407713, 0x07347724, 0x19E788C9, 0x27DA4C81, 0x3909B36C, 0x1A7DB35B, 0x04AE4CB6,
+	0x13212A37, 0x0DF2D5DA, 0x2E86D5ED, 0x30552A00, 0x0E68EE48, 0x10BB11A5, 0x33CF1192, 0x2D1CEE7F,
+	0x29B2A2C9, 0x37615D24, 0x14155D13, 0x0AC6A2FE, 0x34FB66B6, 0x2A28995B, 0x095C996C, 0x178F6681,
+	0x2642546E, 0x3891AB83, 0x1BE5ABB4, 0x05365459, 0x3B0B9011, 0x25D86FFC, 0x06AC6FCB, 0x187F9026,
+	0x1CD1DC90, 0x0202237D, 0x2176234A, 0x3FA5DCA7, 0x019818EF, 0x1F4BE702, 0x3C3FE735, 0x22EC18D8,
+	0x35637E59, 0x2BB081B4, 0x08C48183, 0x16177E6E, 0x282ABA26, 0x36F945CB, 0x158D45FC, 0x0B5EBA11,
+	0x0FF0F6A7, 0x1123094A, 0x3257097D, 0x2C84F690, 0x12B932D8, 0x0C6ACD35, 0x2F1ECD02, 0x31CD32EF,
+	0x2A829317, 0x34516CFA, 0x17256CCD, 0x09F69320, 0x37CB5768, 0x2918A885, 0x0A6CA8B2, 0x14BF575F,
+	0x10111BE9, 0x0EC2E404, 0x2DB6E433, 0x33651BDE, 0x0D58DF96, 0x138B207B, 0x30FF204C, 0x2E2CDFA1,
+	0x39A3B920, 0x277046CD, 0x040446FA, 0x1AD7B917, 0x24EA7D5F, 0x3A3982B2, 0x194D8285, 0x079E7D68,
+	0x033031DE, 0x1DE3CE33, 0x3E97CE04, 0x204431E9, 0x1E79F5A1, 0x00AA0A4C, 0x23DE0A7B, 0x3D0DF596,
+	0x0CC0C779, 0x12133894, 0x316738A3, 0x2FB4C74E, 0x11890306, 0x0F5AFCEB, 0x2C2EFCDC, 0x32FD0331,
+	0x36534F87, 0x2880B06A, 0x0BF4B05D, 0x15274FB0, 0x2B1A8BF8, 0x35C97415, 0x16BD7422, 0x086E8BCF,
+	0x1FE1ED4E, 0x013212A3, 0x22461294, 0x3C95ED79, 0x02A82931, 0x1C7BD6DC, 0x3F0FD6EB, 0x21DC2906,
+	0x257265B0, 0x3BA19A5D, 0x18D59A6A, 0x06066587, 0x383BA1CF, 0x26E85E22, 0x059C5E15, 0x1B4FA1F8,
+	0x33031DE5, 0x2DD0E208, 0x0EA4E23F, 0x10771DD2, 0x2E4AD99A, 0x30992677, 0x13ED2640, 0x0D3ED9AD,
+	0x0990951B, 0x17436AF6, 0x34376AC1, 0x2AE4952C, 0x14D95164, 0x0A0AAE89, 0x297EAEBE, 0x37AD5153,
+	0x202237D2, 0x3EF1C83F, 0x1D85C808, 0x035637E5, 0x3D6BF3AD, 0x23B80C40, 0x00CC0C77, 0x1E1FF39A,
+	0x1AB1BF2C, 0x046240C1, 0x271640F6, 0x39C5BF1B, 0x07F87B53, 0x192B84BE, 0x3A5F8489, 0x248C7B64,
+	0x1541498B, 0x0B92B666, 0x28E6B651, 0x363549BC, 0x08088DF4, 0x16DB7219, 0x35AF722E, 0x2B7C8DC3,
+	0x2FD2C175, 0x31013E98, 0x12753EAF, 0x0CA6C142, 0x329B050A, 0x2C48FAE7, 0x0F3CFAD0, 0x11EF053D,
+	0x066063BC, 0x18B39C51, 0x3BC79C66, 0x2514638B, 0x1B29A7C3, 0x05FA582E, 0x268E5819, 0x385DA7F4,
+	0x3CF3EB42, 0x222014AF, 0x01541498, 0x1F87EB75, 0x21BA2F3D, 0x3F69D0D0, 0x1C1DD0E7, 0x02CE2F0A,
+	0x19818EF2, 0x0752711F, 0x24267128, 0x3AF58EC5, 0x04C84A8D, 0x1A1BB560, 0x396FB557, 0x27BC4ABA,
+	0x2312060C, 0x3DC1F9E1, 0x1EB5F9D6, 0x0066063B, 0x3E5BC273, 0x20883D9E, 0x03FC3DA9, 0x1D2FC244,
+	0x0AA0A4C5, 0x14735B28, 0x37075B1F, 0x29D4A4F2, 0x17E960BA, 0x093A9F57, 0x2A4E9F60, 0x349D608D,
+	0x30332C3B, 0x2EE0D3D6, 0x0D94D3E1, 0x13472C0C, 0x2D7AE844, 0x33A917A9, 0x10DD179E, 0x0E0EE873,
+	0x3FC3DA9C, 0x21102571, 0x02642546, 0x1CB7DAAB, 0x228A1EE3, 0x3C59E10E, 0x1F2DE139, 0x01FE1ED4,
+	0x05505262, 0x1B83AD8F, 0x38F7ADB8, 0x26245255, 0x1819961D, 0x06CA69F0, 0x25BE69C7, 0x3B6D962A,
+	0x2CE2F0AB, 0x32310F46, 0x11450F71, 0x0F96F09C, 0x31AB34D4, 0x2F78CB39, 0x0C0CCB0E, 0x12DF34E3,
+	0x16717855, 0x08A287B8, 0x2BD6878F, 0x35057862, 0x0B38BC2A, 0x15EB43C7, 0x369F43F0, 0x284CBC1D,
+	// Seed 0x6E
+	0x00000000, 0x56F91B86, 0xADF2370C, 0xFB0B2C8A, 0x0FF0F6A7, 0x5909ED21, 0xA202C1AB, 0xF4FBDA2D,
+	0x1FE1ED4E, 0x4918F6C8, 0xB213DA42, 0xE4EAC1C4, 0x10111BE9, 0x46E8006F, 0xBDE32CE5, 0xEB1A3763,
+	0x3FC3DA9C, 0x693AC11A, 0x9231ED90, 0xC4C8F616, 0x30332C3B, 0x66CA37BD, 0x9DC11B37, 0xCB3800B1,
+	0x202237D2, 0x76DB2C54, 0x8DD000DE, 0xDB291B58, 0x2FD2C175, 0x792BDAF3, 0x8220F679, 0xD4D9EDFF,
+	0x7F87B538, 0x297EAEBE, 0xD2758234, 0x848C99B2, 0x7077439F, 0x268E5819, 0xDD857493, 0x8B7C6F15,
+	0x60665876, 0x369F43F0, 0xCD946F7A, 0x9B6D74FC, 0x6F96AED1, 0x396FB557, 0xC26499DD, 0x949D825B,
+	0x40446FA4, 0x16BD7422, 0xEDB658A8, 0xBB4F432E, 0x4FB49903, 0x194D8285, 0xE246AE0F, 0xB4BFB589,
+	0x5FA582EA, 0x095C996C, 0xF257B5E6, 0xA4AEAE60, 0x5055744D, 0x06AC6FCB, 0xFDA74341, 0xAB5E58C7,
+	0xFF0F6A70, 0xA9F671F6, 0x52FD5D7C, 0x040446FA, 0xF0FF9CD7, 0xA6068751, 0x5D0DABDB, 0x0BF4B05D,
+	0xE0EE873E, 0xB6179CB8, 0x4D1CB032, 0x1BE5ABB4, 0xEF1E7199, 0xB9E76A1F, 0x42EC4695, 0x14155D13,
+	0xC0CCB0EC, 0x9635AB6A, 0x6D3E87E0, 0x3BC79C66, 0xCF3C464B, 0x99C55DCD, 0x62CE7147, 0x34376AC1,
+	0xDF2D5DA2, 0x89D44624, 0x72DF6AAE, 0x24267128, 0xD0DDAB05, 0x8624B083, 0x7D2F9C09, 0x2BD6878F,
+	0x8088DF48, 0xD671C4CE, 0x2D7AE844, 0x7B83F3C2, 0x8F7829EF, 0xD9813269, 0x228A1EE3, 0x74730565,
+	0x9F693206, 0xC9902980, 0x329B050A, 0x64621E8C, 0x9099C4A1, 0xC660DF27, 0x3D6BF3AD, 0x6B92E82B,
+	0xBF4B05D4, 0xE9B21E52, 0x12B932D8, 0x4440295E, 0xB0BBF373, 0xE642E8F5, 0x1D49C47F, 0x4BB0DFF9,
+	0xA0AAE89A, 0xF653F31C, 0x0D58DF96, 0x5BA1C410, 0xAF5A1E3D, 0xF9A305BB, 0x02A82931, 0x545132B7,
+	0xAA0A4C5F, 0xFCF357D9, 0x07F87B53, 0x510160D5, 0xA5FABAF8, 0xF303A17E, 0x08088DF4, 0x5EF19672,
+	0xB5EBA111, 0xE312BA97, 0x1819961D, 0x4EE08D9B, 0xBA1B57B6, 0xECE24C30, 0x17E960BA, 0x41107B3C,
+	0x95C996C3, 0xC3308D45, 0x383BA1CF, 0x6EC2BA49, 0x9A396064, 0xCCC07BE2, 0x37CB5768, 0x61324CEE,
+	0x8A287B8D, 0xDCD1600B, 0x27DA4C81, 0x71235707, 0x85D88D2A, 0xD32196AC, 0x282ABA26, 0x7ED3A1A0,
+	0xD58DF967, 0x8374E2E1, 0x787FCE6B, 0x2E86D5ED, 0xDA7D0FC0, 0x8C841446, 0x778F38CC, 0x2176234A,
+	0xCA6C1429, 0x9C950FAF, 0x679E2325, 0x316738A3, 0xC59CE28E, 0x9365F908, 0x686ED582, 0x3E97CE04,
+	0xEA4E23FB, 0xBCB7387D, 0x47BC14F7, 0x11450F71, 0xE5BED55C, 0xB347CEDA, 0x484CE250, 0x1EB5F9D6,
+	0xF5AFCEB5, 0xA356D533, 0x585DF9B9, 0x0EA4E23F, 0xFA5F3812, 0xACA62394, 0x57AD0F1E, 0x01541498,
+	0x5505262F, 0x03FC3DA9, 0xF8F71123, 0xAE0E0AA5, 0x5AF5D088, 0x0C0CCB0E, 0xF707E784, 0xA1FEFC02,
+	0x4AE4CB61, 0x1C1DD0E7, 0xE716FC6D, 0xB1EFE7EB, 0x45143DC6, 0x13ED2640, 0xE8E60ACA, 0xBE1F114C,
+	0x6AC6FCB3, 0x3C3FE735, 0xC734CBBF, 0x91CDD039, 0x65360A14, 0x33CF1192, 0xC8C43D18, 0x9E3D269E,
+	0x752711FD, 0x23DE0A7B, 0xD8D526F1, 0x8E2C3D77, 0x7AD7E75A, 0x2C2EFCDC, 0xD725D056, 0x81DCCBD0,
+	0x2A829317, 0x7C7B8891, 0x8770A41B, 0xD189BF9D, 0x257265B0, 0x738B7E36, 0x888052BC, 0xDE79493A,
+	0x35637E59, 0x639A65DF, 0x98914955, 0xCE6852D3, 0x3A9388FE, 0x6C6A9378, 0x9761BFF2, 0xC198A474,
+	0x1541498B, 0x43B8520D, 0xB8B37E87, 0xEE4A6501, 0x1AB1BF2C, 0x4C48A4AA, 0xB7438820, 0xE1BA93A6,
+	0x0AA0A4C5, 0x5C59BF43, 0xA75293C9, 0xF1AB884F, 0x05505262, 0x53A949E4, 0xA8A2656E, 0xFE5B7EE8,
+	// Seed 0x6F
+	0x00000000, 0x3EB5CC12, 0x7D6B9824, 0x43DE5436, 0xFAD73048, 0xC462FC5A, 0x87BCA86C, 0xB909647E,
+	0x4FB49903, 0x71015511, 0x32DF0127, 0x0C6ACD35, 0xB563A94B, 0x8BD66559, 0xC808316F, 0xF6BDFD7D,
+	0x9F693206, 0xA1DCFE14, 0xE202AA22, 0xDCB76630, 0x65BE024E, 0x5B0BCE5C, 0x18D59A6A, 0x26605678,
+	0xD0DDAB05, 0xEE686717, 0xADB63321, 0x9303FF33, 0x2A0A9B4D, 0x14BF575F, 0x57610369, 0x69D4CF7B,
+	0x84C89D9F, 0xBA7D518D, 0xF9A305BB, 0xC716C9A9, 0x7E1FADD7, 0x40AA61C5, 0x037435F3, 0x3DC1F9E1,
+	0xCB7C049C, 0xF5C9C88E, 0xB6179CB8, 0x88A250AA, 0x31AB34D4, 0x0F1EF8C6, 0x4CC0ACF0, 0x727560E2,
+	0x1BA1AF99, 0x2514638B, 0x66CA37BD, 0x587FFBAF, 0xE1769FD1, 0xDFC353C3, 0x9C1D07F5, 0xA2A8CBE7,
+	0x5415369A, 0x6AA0FA88, 0x297EAEBE, 0x17CB62AC, 0xAEC206D2, 0x9077CAC0, 0xD3A99EF6, 0xED1C52E4,
+	0xB38BC2AD, 0x8D3E0EBF, 0xCEE05A89, 0xF055969B, 0x495CF2E5, 0x77E93EF7, 0x34376AC1, 0x0A82A6D3,
+	0xFC3F5BAE, 0xC28A97BC, 0x8154C38A, 0xBFE10F98, 0x06E86BE6, 0x385DA7F4, 0x7B83F3C2, 0x45363FD0,
+	0x2CE2F0AB, 0x12573CB9, 0x5189688F, 0x6F3CA49D, 0xD635C0E3, 0xE8800CF1, 0xAB5E58C7, 0x95EB94D5,
+	0x635669A8, 0x5DE3A5BA, 0x1E3DF18C, 0x20883D9E, 0x998159E0, 0xA73495F2, 0xE4EAC1C4, 0xDA5F0DD6,
+	0x37435F32, 0x09F69320, 0x4A28C716, 0x749D0B04, 0xCD946F7A, 0xF321A368, 0xB0FFF75E, 0x8E4A3B4C,
+	0x78F7C631, 0x46420A23, 0x059C5E15, 0x3B299207, 0x8220F679, 0xBC953A6B, 0xFF4B6E5D, 0xC1FEA24F,
+	0xA82A6D34, 0x969FA126, 0xD541F510, 0xEBF43902, 0x52FD5D7C, 0x6C48916E, 0x2F96C558, 0x1123094A,
+	0xE79EF437, 0xD92B3825, 0x9AF56C13, 0xA440A001, 0x1D49C47F, 0x23FC086D, 0x60225C5B, 0x5E979049,
+	0xDD0D7CC9, 0xE3B8B0DB, 0xA066E4ED, 0x9ED328FF, 0x27DA4C81, 0x196F8093, 0x5AB1D4A5, 0x640418B7,
+	0x92B9E5CA, 0xAC0C29D8, 0xEFD27DEE, 0xD167B1FC, 0x686ED582, 0x56DB1990, 0x15054DA6, 0x2BB081B4,
+	0x42644ECF, 0x7CD182DD, 0x3F0FD6EB, 0x01BA1AF9, 0xB8B37E87, 0x8606B295, 0xC5D8E6A3, 0xFB6D2AB1,
+	0x0DD0D7CC, 0x33651BDE, 0x70BB4FE8, 0x4E0E83FA, 0xF707E784, 0xC9B22B96, 0x8A6C7FA0, 0xB4D9B3B2,
+	0x59C5E156, 0x67702D44, 0x24AE7972, 0x1A1BB560, 0xA312D11E, 0x9DA71D0C, 0xDE79493A, 0xE0CC8528,
+	0x16717855, 0x28C4B447, 0x6B1AE071, 0x55AF2C63, 0xECA6481D, 0xD213840F, 0x91CDD039, 0xAF781C2B,
+	0xC6ACD350, 0xF8191F42, 0xBBC74B74, 0x85728766, 0x3C7BE318, 0x02CE2F0A, 0x41107B3C, 0x7FA5B72E,
+	0x89184A53, 0xB7AD8641, 0xF473D277, 0xCAC61E65, 0x73CF7A1B, 0x4D7AB609, 0x0EA4E23F, 0x30112E2D,
+	0x6E86BE64, 0x50337276, 0x13ED2640, 0x2D58EA52, 0x94518E2C, 0xAAE4423E, 0xE93A1608, 0xD78FDA1A,
+	0x21322767, 0x1F87EB75, 0x5C59BF43, 0x62EC7351, 0xDBE5172F, 0xE550DB3D, 0xA68E8F0B, 0x983B4319,
+	0xF1EF8C62, 0xCF5A4070, 0x8C841446, 0xB231D854, 0x0B38BC2A, 0x358D7038, 0x7653240E, 0x48E6E81C,
+	0xBE5B1561, 0x80EED973, 0xC3308D45, 0xFD854157, 0x448C2529, 0x7A39E93B, 0x39E7BD0D, 0x0752711F,
+	0xEA4E23FB, 0xD4FBEFE9, 0x9725BBDF, 0xA99077CD, 0x109913B3, 0x2E2CDFA1, 0x6DF28B97, 0x53474785,
+	0xA5FABAF8, 0x9B4F76EA, 0xD89122DC, 0xE624EECE, 0x5F2D8AB0, 0x619846A2, 0x22461294, 0x1CF3DE86,
+	0x752711FD, 0x4B92DDEF, 0x084C89D9, 0x36F945CB, 0x8FF021B5, 0xB145EDA7, 0xF29BB991, 0xCC2E7583,
+	0x3A9388FE, 0x042644EC, 0x47F810DA, 0x794DDCC8, 0xC044B8B6, 0xFEF174A4, 0xBD2F2092, 0x839AEC80,
+	// Seed 0x70
+	0x00000000, 0x1BA1AF99, 0x37435F32, 0x2CE2F0AB, 0x6E86BE64, 0x752711FD, 0x59C5E156, 0x42644ECF,
+	0x7D079EB1, 0x66A63128, 0x4A44C183, 0x51E56E1A, 0x138120D5, 0x08208F4C, 0x24C27FE7, 0x3F63D07E,
+	0x5A05DF1B, 0x41A47082, 0x6D468029, 0x76E72FB0, 0x3483617F, 0x2F22CEE6, 0x03C03E4D, 0x186191D4,
+	0x270241AA, 0x3CA3EE33, 0x10411E98, 0x0BE0B101, 0x4984FFCE, 0x52255057, 0x7EC7A0FC, 0x65660F65,
+	0x14015C4F, 0x0FA0F3D6, 0x2342037D, 0x38E3ACE4, 0x7A87E22B, 0x61264DB2, 0x4DC4BD19, 0x56651280,
+	0x6906C2FE, 0x72A76D67, 0x5E459DCC, 0x45E43255, 0x07807C9A, 0x1C21D303, 0x30C323A8, 0x2B628C31,
+	0x4E048354, 0x55A52CCD, 0x7947DC66, 0x62E673FF, 0x20823D30, 0x3B2392A9, 0x17C16202, 0x0C60CD9B,
+	0x33031DE5, 0x28A2B27C, 0x044042D7, 0x1FE1ED4E, 0x5D85A381, 0x46240C18, 0x6AC6FCB3, 0x7167532A,
+	0x2802B89E, 0x33A31707, 0x1F41E7AC, 0x04E04835, 0x468406FA, 0x5D25A963, 0x71C759C8, 0x6A66F651,
+	0x5505262F, 0x4EA489B6, 0x6246791D, 0x79E7D684, 0x3B83984B, 0x202237D2, 0x0CC0C779, 0x176168E0,
+	0x72076785, 0x69A6C81C, 0x454438B7, 0x5EE5972E, 0x1C81D9E1, 0x07207678, 0x2BC286D3, 0x3063294A,
+	0x0F00F934, 0x14A156AD, 0x3843A606, 0x23E2099F, 0x61864750, 0x7A27E8C9, 0x56C51862, 0x4D64B7FB,
+	0x3C03E4D1, 0x27A24B48, 0x0B40BBE3, 0x10E1147A, 0x52855AB5, 0x4924F52C, 0x65C60587, 0x7E67AA1E,
+	0x41047A60, 0x5AA5D5F9, 0x76472552, 0x6DE68ACB, 0x2F82C404, 0x34236B9D, 0x18C19B36, 0x036034AF,
+	0x66063BCA, 0x7DA79453, 0x514564F8, 0x4AE4CB61, 0x088085AE, 0x13212A37, 0x3FC3DA9C, 0x24627505,
+	0x1B01A57B, 0x00A00AE2, 0x2C42FA49, 0x37E355D0, 0x75871B1F, 0x6E26B486, 0x42C4442D, 0x5965EBB4,
+	0x5005713C, 0x4BA4DEA5, 0x67462E0E, 0x7CE78197, 0x3E83CF58, 0x252260C1, 0x09C0906A, 0x12613FF3,
+	0x2D02EF8D, 0x36A34014, 0x1A41B0BF, 0x01E01F26, 0x438451E9, 0x5825FE70, 0x74C70EDB, 0x6F66A142,
+	0x0A00AE27, 0x11A101BE, 0x3D43F115, 0x26E25E8C, 0x64861043, 0x7F27BFDA, 0x53C54F71, 0x4864E0E8,
+	0x77073096, 0x6CA69F0F, 0x40446FA4, 0x5BE5C03D, 0x19818EF2, 0x0220216B, 0x2EC2D1C0, 0x35637E59,
+	0x44042D73, 0x5FA582EA, 0x73477241, 0x68E6DDD8, 0x2A829317, 0x31233C8E, 0x1DC1CC25, 0x066063BC,
+	0x3903B3C2, 0x22A21C5B, 0x0E40ECF0, 0x15E14369, 0x57850DA6, 0x4C24A23F, 0x60C65294, 0x7B67FD0D,
+	0x1E01F268, 0x05A05DF1, 0x2942AD5A, 0x32E302C3, 0x70874C0C, 0x6B26E395, 0x47C4133E, 0x5C65BCA7,
+	0x63066CD9, 0x78A7C340, 0x544533EB, 0x4FE49C72, 0x0D80D2BD, 0x16217D24, 0x3AC38D8F, 0x21622216,
+	0x7807C9A2, 0x63A6663B, 0x4F449690, 0x54E53909, 0x168177C6, 0x0D20D85F, 0x21C228F4, 0x3A63876D,
+	0x05005713, 0x1EA1F88A, 0x32430821, 0x29E2A7B8, 0x6B86E977, 0x702746EE, 0x5CC5B645, 0x476419DC,
+	0x220216B9, 0x39A3B920, 0x1541498B, 0x0EE0E612, 0x4C84A8DD, 0x57250744, 0x7BC7F7EF, 0x60665876,
+	0x5F058808, 0x44A42791, 0x6846D73A, 0x73E778A3, 0x3183366C, 0x2A2299F5, 0x06C0695E, 0x1D61C6C7,
+	0x6C0695ED, 0x77A73A74, 0x5B45CADF, 0x40E46546, 0x02802B89, 0x19218410, 0x35C374BB, 0x2E62DB22,
+	0x11010B5C, 0x0AA0A4C5, 0x2642546E, 0x3DE3FBF7, 0x7F87B538, 0x64261AA1, 0x48C4EA0A, 0x53654593,
+	0x36034AF6, 0x2DA2E56F, 0x014015C4, 0x1AE1BA5D, 0x5885F492, 0x43245B0B, 0x6FC6ABA0, 0x74670439,
+	0x4B04D447, 0x50A57BDE, 0x7C478B75, 0x67E624EC, 0x25826A23, 0x3E23C5BA, 0x12C13511, 0x09609A88,
+	// Seed 0x71
+	0x00000000, 0x0176168E, 0x02EC2D1C, 0x039A3B92, 0x05D85A38, 0x04AE4CB6, 0x07347724, 0x064261AA,
+	0x0BB0B470, 0x0AC6A2FE, 0x095C996C, 0x082A8FE2, 0x0E68EE48, 0x0F1EF8C6, 0x0C84C354, 0x0DF2D5DA,
+	0x176168E0, 0x16177E6E, 0x158D45FC, 0x14FB5372, 0x12B932D8, 0x13CF2456, 0x10551FC4, 0x1123094A,
+	0x1CD1DC90, 0x1DA7CA1E, 0x1E3DF18C, 0x1F4BE702, 0x190986A8, 0x187F9026, 0x1BE5ABB4, 0x1A93BD3A,
+	0x2EC2D1C0, 0x2FB4C74E, 0x2C2EFCDC, 0x2D58EA52, 0x2B1A8BF8, 0x2A6C9D76, 0x29F6A6E4, 0x2880B06A,
+	0x257265B0, 0x2404733E, 0x279E48AC, 0x26E85E22, 0x20AA3F88, 0x21DC2906, 0x22461294, 0x2330041A,
+	0x39A3B920, 0x38D5AFAE, 0x3B4F943C, 0x3A3982B2, 0x3C7BE318, 0x3D0DF596, 0x3E97CE04, 0x3FE1D88A,
+	0x32130D50, 0x33651BDE, 0x30FF204C, 0x318936C2, 0x37CB5768, 0x36BD41E6, 0x35277A74, 0x34516CFA,
+	0x138120D5, 0x12F7365B, 0x116D0DC9, 0x101B1B47, 0x16597AED, 0x172F6C63, 0x14B557F1, 0x15C3417F,
+	0x183194A5, 0x1947822B, 0x1ADDB9B9, 0x1BABAF37, 0x1DE9CE9D, 0x1C9FD813, 0x1F05E381, 0x1E73F50F,
+	0x04E04835, 0x05965EBB, 0x060C6529, 0x077A73A7, 0x0138120D, 0x004E0483, 0x03D43F11, 0x02A2299F,
+	0x0F50FC45, 0x0E26EACB, 0x0DBCD159, 0x0CCAC7D7, 0x0A88A67D, 0x0BFEB0F3, 0x08648B61, 0x09129DEF,
+	0x3D43F115, 0x3C35E79B, 0x3FAFDC09, 0x3ED9CA87, 0x389BAB2D, 0x39EDBDA3, 0x3A778631, 0x3B0190BF,
+	0x36F34565, 0x378553EB, 0x341F6879, 0x35697EF7, 0x332B1F5D, 0x325D09D3, 0x31C73241, 0x30B124CF,
+	0x2A2299F5, 0x2B548F7B, 0x28CEB4E9, 0x29B8A267, 0x2FFAC3CD, 0x2E8CD543, 0x2D16EED1, 0x2C60F85F,
+	0x21922D85, 0x20E43B0B, 0x237E0099, 0x22081617, 0x244A77BD, 0x253C6133, 0x26A65AA1, 0x27D04C2F,
+	0x270241AA, 0x26745724, 0x25EE6CB6, 0x24987A38, 0x22DA1B92, 0x23AC0D1C, 0x2036368E, 0x21402000,
+	0x2CB2F5DA, 0x2DC4E354, 0x2E5ED8C6, 0x2F28CE48, 0x296AAFE2, 0x281CB96C, 0x2B8682FE, 0x2AF09470,
+	0x3063294A, 0x31153FC4, 0x328F0456, 0x33F912D8, 0x35BB7372, 0x34CD65FC, 0x37575E6E, 0x362148E0,
+	0x3BD39D3A, 0x3AA58BB4, 0x393FB026, 0x3849A6A8, 0x3E0BC702, 0x3F7DD18C, 0x3CE7EA1E, 0x3D91FC90,
+	0x09C0906A, 0x08B686E4, 0x0B2CBD76, 0x0A5AABF8, 0x0C18CA52, 0x0D6EDCDC, 0x0EF4E74E, 0x0F82F1C0,
+	0x0270241A, 0x03063294, 0x009C0906, 0x01EA1F88, 0x07A87E22, 0x06DE68AC, 0x0544533E, 0x043245B0,
+	0x1EA1F88A, 0x1FD7EE04, 0x1C4DD596, 0x1D3BC318, 0x1B79A2B2, 0x1A0FB43C, 0x19958FAE, 0x18E39920,
+	0x15114CFA, 0x14675A74, 0x17FD61E6, 0x168B7768, 0x10C916C2, 0x11BF004C, 0x12253BDE, 0x13532D50,
+	0x3483617F, 0x35F577F1, 0x366F4C63, 0x37195AED, 0x315B3B47, 0x302D2DC9, 0x33B7165B, 0x32C100D5,
+	0x3F33D50F, 0x3E45C381, 0x3DDFF813, 0x3CA9EE9D, 0x3AEB8F37, 0x3B9D99B9, 0x3807A22B, 0x3971B4A5,
+	0x23E2099F, 0x22941F11, 0x210E2483, 0x2078320D, 0x263A53A7, 0x274C4529, 0x24D67EBB, 0x25A06835,
+	0x2852BDEF, 0x2924AB61, 0x2ABE90F3, 0x2BC8867D, 0x2D8AE7D7, 0x2CFCF159, 0x2F66CACB, 0x2E10DC45,
+	0x1A41B0BF, 0x1B37A631, 0x18AD9DA3, 0x19DB8B2D, 0x1F99EA87, 0x1EEFFC09, 0x1D75C79B, 0x1C03D115,
+	0x11F104CF, 0x10871241, 0x131D29D3, 0x126B3F5D, 0x14295EF7, 0x155F4879, 0x16C573EB, 0x17B36565,
+	0x0D20D85F, 0x0C56CED1, 0x0FCCF543, 0x0EBAE3CD, 0x08F88267, 0x098E94E9, 0x0A14AF7B, 0x0B62B9F5,
+	0x06906C2F, 0x07E67AA1, 0x047C4133, 0x050A57BD, 0x03483617, 0x023E2099, 0x01A41B0B, 0x00D20D85,
+	// Seed 0x72
+	0x00000000, 0x2EFED224, 0x5DFDA448, 0x7303766C, 0xBBFB4890, 0x95059AB4, 0xE606ECD8, 0xC8F83EFC,
+	0x0BE0B101, 0x251E6325, 0x561D1549, 0x78E3C76D, 0xB01BF991, 0x9EE52BB5, 0xEDE65DD9, 0xC3188FFD,
+	0x17C16202, 0x393FB026, 0x4A3CC64A, 0x64C2146E, 0xAC3A2A92, 0x82C4F8B6, 0xF1C78EDA, 0xDF395CFE,
+	0x1C21D303, 0x32DF0127, 0x41DC774B, 0x6F22A56F, 0xA7DA9B93, 0x892449B7, 0xFA273FDB, 0xD4D9EDFF,
+	0x2F82C404, 0x017C1620, 0x727F604C, 0x5C81B268, 0x94798C94, 0xBA875EB0, 0xC98428DC, 0xE77AFAF8,
+	0x24627505, 0x0A9CA721, 0x799FD14D, 0x57610369, 0x9F993D95, 0xB167EFB1, 0xC26499DD, 0xEC9A4BF9,
+	0x3843A606, 0x16BD7422, 0x65BE024E, 0x4B40D06A, 0x83B8EE96, 0xAD463CB2, 0xDE454ADE, 0xF0BB98FA,
+	0x33A31707, 0x1D5DC523, 0x6E5EB34F, 0x40A0616B, 0x88585F97, 0xA6A68DB3, 0xD5A5FBDF, 0xFB5B29FB,
+	0x5F058808, 0x71FB5A2C, 0x02F82C40, 0x2C06FE64, 0xE4FEC098, 0xCA0012BC, 0xB90364D0, 0x97FDB6F4,
+	0x54E53909, 0x7A1BEB2D, 0x09189D41, 0x27E64F65, 0xEF1E7199, 0xC1E0A3BD, 0xB2E3D5D1, 0x9C1D07F5,
+	0x48C4EA0A, 0x663A382E, 0x15394E42, 0x3BC79C66, 0xF33FA29A, 0xDDC170BE, 0xAEC206D2, 0x803CD4F6,
+	0x43245B0B, 0x6DDA892F, 0x1ED9FF43, 0x30272D67, 0xF8DF139B, 0xD621C1BF, 0xA522B7D3, 0x8BDC65F7,
+	0x70874C0C, 0x5E799E28, 0x2D7AE844, 0x03843A60, 0xCB7C049C, 0xE582D6B8, 0x9681A0D4, 0xB87F72F0,
+	0x7B67FD0D, 0x55992F29, 0x269A5945, 0x08648B61, 0xC09CB59D, 0xEE6267B9, 0x9D6111D5, 0xB39FC3F1,
+	0x67462E0E, 0x49B8FC2A, 0x3ABB8A46, 0x14455862, 0xDCBD669E, 0xF243B4BA, 0x8140C2D6, 0xAFBE10F2,
+	0x6CA69F0F, 0x42584D2B, 0x315B3B47, 0x1FA5E963, 0xD75DD79F, 0xF9A305BB, 0x8AA073D7, 0xA45EA1F3,
+	0xBE0B1010, 0x90F5C234, 0xE3F6B458, 0xCD08667C, 0x05F05880, 0x2B0E8AA4, 0x580DFCC8, 0x76F32EEC,
+	0xB5EBA111, 0x9B157335, 0xE8160559, 0xC6E8D77D, 0x0E10E981, 0x20EE3BA5, 0x53ED4DC9, 0x7D139FED,
+	0xA9CA7212, 0x8734A036, 0xF437D65A, 0xDAC9047E, 0x12313A82, 0x3CCFE8A6, 0x4FCC9ECA, 0x61324CEE,
+	0xA22AC313, 0x8CD41137, 0xFFD7675B, 0xD129B57F, 0x19D18B83, 0x372F59A7, 0x442C2FCB, 0x6AD2FDEF,
+	0x9189D414, 0xBF770630, 0xCC74705C, 0xE28AA278, 0x2A729C84, 0x048C4EA0, 0x778F38CC, 0x5971EAE8,
+	0x9A696515, 0xB497B731, 0xC794C15D, 0xE96A1379, 0x21922D85, 0x0F6CFFA1, 0x7C6F89CD, 0x52915BE9,
+	0x8648B616, 0xA8B66432, 0xDBB5125E, 0xF54BC07A, 0x3DB3FE86, 0x134D2CA2, 0x604E5ACE, 0x4EB088EA,
+	0x8DA80717, 0xA356D533, 0xD055A35F, 0xFEAB717B, 0x36534F87, 0x18AD9DA3, 0x6BAEEBCF, 0x455039EB,
+	0xE10E9818, 0xCFF04A3C, 0xBCF33C50, 0x920DEE74, 0x5AF5D088, 0x740B02AC, 0x070874C0, 0x29F6A6E4,
+	0xEAEE2919, 0xC410FB3D, 0xB7138D51, 0x99ED5F75, 0x51156189, 0x7FEBB3AD, 0x0CE8C5C1, 0x221617E5,
+	0xF6CFFA1A, 0xD831283E, 0xAB325E52, 0x85CC8C76, 0x4D34B28A, 0x63CA60AE, 0x10C916C2, 0x3E37C4E6,
+	0xFD2F4B1B, 0xD3D1993F, 0xA0D2EF53, 0x8E2C3D77, 0x46D4038B, 0x682AD1AF, 0x1B29A7C3, 0x35D775E7,
+	0xCE8C5C1C, 0xE0728E38, 0x9371F854, 0xBD8F2A70, 0x7577148C, 0x5B89C6A8, 0x288AB0C4, 0x067462E0,
+	0xC56CED1D, 0xEB923F39, 0x98914955, 0xB66F9B71, 0x7E97A58D, 0x506977A9, 0x236A01C5, 0x0D94D3E1,
+	0xD94D3E1E, 0xF7B3EC3A, 0x84B09A56, 0xAA4E4872, 0x62B6768E, 0x4C48A4AA, 0x3F4BD2C6, 0x11B500E2,
+	0xD2AD8F1F, 0xFC535D3B, 0x8F502B57, 0xA1AEF973, 0x6956C78F, 0x47A815AB, 0x34AB63C7, 0x1A55B1E3,
+	// Seed 0x73
+	0x00000000, 0xDB671FDB, 0x24D67EBB, 0xFFB16160, 0x49ACFD76, 0x92CBE2AD, 0x6D7A83CD, 0xB61D9C16,
+	0x9359FAEC, 0x483EE537, 0xB78F8457, 0x6CE89B8C, 0xDAF5079A, 0x01921841, 0xFE237921, 0x254466FA,
+	0xB4ABB4D5, 0x6FCCAB0E, 0x907DCA6E, 0x4B1AD5B5, 0xFD0749A3, 0x26605678, 0xD9D13718, 0x02B628C3,
+	0x27F24E39, 0xFC9551E2, 0x03243082, 0xD8432F59, 0x6E5EB34F, 0xB539AC94, 0x4A88CDF4, 0x91EFD22F,
+	0xFB4F28A7, 0x2028377C, 0xDF99561C, 0x04FE49C7, 0xB2E3D5D1, 0x6984CA0A, 0x9635AB6A, 0x4D52B4B1,
+	0x6816D24B, 0xB371CD90, 0x4CC0ACF0, 0x97A7B32B, 0x21BA2F3D, 0xFADD30E6, 0x056C5186, 0xDE0B4E5D,
+	0x4FE49C72, 0x948383A9, 0x6B32E2C9, 0xB055FD12, 0x06486104, 0xDD2F7EDF, 0x229E1FBF, 0xF9F90064,
+	0xDCBD669E, 0x07DA7945, 0xF86B1825, 0x230C07FE, 0x95119BE8, 0x4E768433, 0xB1C7E553, 0x6AA0FA88,
+	0x64861043, 0xBFE10F98, 0x40506EF8, 0x9B377123, 0x2D2AED35, 0xF64DF2EE, 0x09FC938E, 0xD29B8C55,
+	0xF7DFEAAF, 0x2CB8F574, 0xD3099414, 0x086E8BCF, 0xBE7317D9, 0x65140802, 0x9AA56962, 0x41C276B9,
+	0xD02DA496, 0x0B4ABB4D, 0xF4FBDA2D, 0x2F9CC5F6, 0x998159E0, 0x42E6463B, 0xBD57275B, 0x66303880,
+	0x43745E7A, 0x981341A1, 0x67A220C1, 0xBCC53F1A, 0x0AD8A30C, 0xD1BFBCD7, 0x2E0EDDB7, 0xF569C26C,
+	0x9FC938E4, 0x44AE273F, 0xBB1F465F, 0x60785984, 0xD665C592, 0x0D02DA49, 0xF2B3BB29, 0x29D4A4F2,
+	0x0C90C208, 0xD7F7DDD3, 0x2846BCB3, 0xF321A368, 0x453C3F7E, 0x9E5B20A5, 0x61EA41C5, 0xBA8D5E1E,
+	0x2B628C31, 0xF00593EA, 0x0FB4F28A, 0xD4D3ED51, 0x62CE7147, 0xB9A96E9C, 0x46180FFC, 0x9D7F1027,
+	0xB83B76DD, 0x635C6906, 0x9CED0866, 0x478A17BD, 0xF1978BAB, 0x2AF09470, 0xD541F510, 0x0E26EACB,
+	0xC90C2086, 0x126B3F5D, 0xEDDA5E3D, 0x36BD41E6, 0x80A0DDF0, 0x5BC7C22B, 0xA476A34B, 0x7F11BC90,
+	0x5A55DA6A, 0x8132C5B1, 0x7E83A4D1, 0xA5E4BB0A, 0x13F9271C, 0xC89E38C7, 0x372F59A7, 0xEC48467C,
+	0x7DA79453, 0xA6C08B88, 0x5971EAE8, 0x8216F533, 0x340B6925, 0xEF6C76FE, 0x10DD179E, 0xCBBA0845,
+	0xEEFE6EBF, 0x35997164, 0xCA281004, 0x114F0FDF, 0xA75293C9, 0x7C358C12, 0x8384ED72, 0x58E3F2A9,
+	0x32430821, 0xE92417FA, 0x1695769A, 0xCDF26941, 0x7BEFF557, 0xA088EA8C, 0x5F398BEC, 0x845E9437,
+	0xA11AF2CD, 0x7A7DED16, 0x85CC8C76, 0x5EAB93AD, 0xE8B60FBB, 0x33D11060, 0xCC607100, 0x17076EDB,
+	0x86E8BCF4, 0x5D8FA32F, 0xA23EC24F, 0x7959DD94, 0xCF444182, 0x14235E59, 0xEB923F39, 0x30F520E2,
+	0x15B14618, 0xCED659C3, 0x316738A3, 0xEA002778, 0x5C1DBB6E, 0x877AA4B5, 0x78CBC5D5, 0xA3ACDA0E,
+	0xAD8A30C5, 0x76ED2F1E, 0x895C4E7E, 0x523B51A5, 0xE426CDB3, 0x3F41D268, 0xC0F0B308, 0x1B97ACD3,
+	0x3ED3CA29, 0xE5B4D5F2, 0x1A05B492, 0xC162AB49, 0x777F375F, 0xAC182884, 0x53A949E4, 0x88CE563F,
+	0x19218410, 0xC2469BCB, 0x3DF7FAAB, 0xE690E570, 0x508D7966, 0x8BEA66BD, 0x745B07DD, 0xAF3C1806,
+	0x8A787EFC, 0x511F6127, 0xAEAE0047, 0x75C91F9C, 0xC3D4838A, 0x18B39C51, 0xE702FD31, 0x3C65E2EA,
+	0x56C51862, 0x8DA207B9, 0x721366D9, 0xA9747902, 0x1F69E514, 0xC40EFACF, 0x3BBF9BAF, 0xE0D88474,
+	0xC59CE28E, 0x1EFBFD55, 0xE14A9C35, 0x3A2D83EE, 0x8C301FF8, 0x57570023, 0xA8E66143, 0x73817E98,
+	0xE26EACB7, 0x3909B36C, 0xC6B8D20C, 0x1DDFCDD7, 0xABC251C1, 0x70A54E1A, 0x8F142F7A, 0x547330A1,
+	0x7137565B, 0xAA504980, 0x55E128E0, 0x8E86373B, 0x389BAB2D, 0xE3FCB4F6, 0x1C4DD596, 0xC72ACA4D,
+	// Seed 0x74
+	0x00000000, 0x7579CF04, 0x4422F443, 0x315B3B47, 0x269482CD, 0x53ED4DC9, 0x62B6768E, 0x17CFB98A,
+	0x4D29059A, 0x3850CA9E, 0x090BF1D9, 0x7C723EDD, 0x6BBD8757, 0x1EC44853, 0x2F9F7314, 0x5AE6BC10,
+	0x3483617F, 0x41FAAE7B, 0x70A1953C, 0x05D85A38, 0x1217E3B2, 0x676E2CB6, 0x563517F1, 0x234CD8F5,
+	0x79AA64E5, 0x0CD3ABE1, 0x3D8890A6, 0x48F15FA2, 0x5F3EE628, 0x2A47292C, 0x1B1C126B, 0x6E65DD6F,
+	0x6906C2FE, 0x1C7F0DFA, 0x2D2436BD, 0x585DF9B9, 0x4F924033, 0x3AEB8F37, 0x0BB0B470, 0x7EC97B74,
+	0x242FC764, 0x51560860, 0x600D3327, 0x1574FC23, 0x02BB45A9, 0x77C28AAD, 0x4699B1EA, 0x33E07EEE,
+	0x5D85A381, 0x28FC6C85, 0x19A757C2, 0x6CDE98C6, 0x7B11214C, 0x0E68EE48, 0x3F33D50F, 0x4A4A1A0B,
+	0x10ACA61B, 0x65D5691F, 0x548E5258, 0x21F79D5C, 0x363824D6, 0x4341EBD2, 0x721AD095, 0x07631F91,
+	0x7CDCEFB7, 0x09A520B3, 0x38FE1BF4, 0x4D87D4F0, 0x5A486D7A, 0x2F31A27E, 0x1E6A9939, 0x6B13563D,
+	0x31F5EA2D, 0x448C2529, 0x75D71E6E, 0x00AED16A, 0x176168E0, 0x6218A7E4, 0x53439CA3, 0x263A53A7,
+	0x485F8EC8, 0x3D2641CC, 0x0C7D7A8B, 0x7904B58F, 0x6ECB0C05, 0x1BB2C301, 0x2AE9F846, 0x5F903742,
+	0x05768B52, 0x700F4456, 0x41547F11, 0x342DB015, 0x23E2099F, 0x569BC69B, 0x67C0FDDC, 0x12B932D8,
+	0x15DA2D49, 0x60A3E24D, 0x51F8D90A, 0x2481160E, 0x334EAF84, 0x46376080, 0x776C5BC7, 0x021594C3,
+	0x58F328D3, 0x2D8AE7D7, 0x1CD1DC90, 0x69A81394, 0x7E67AA1E, 0x0B1E651A, 0x3A455E5D, 0x4F3C9159,
+	0x21594C36, 0x54208332, 0x657BB875, 0x10027771, 0x07CDCEFB, 0x72B401FF, 0x43EF3AB8, 0x3696F5BC,
+	0x6C7049AC, 0x190986A8, 0x2852BDEF, 0x5D2B72EB, 0x4AE4CB61, 0x3F9D0465, 0x0EC63F22, 0x7BBFF026,
+	0x5768B525, 0x22117A21, 0x134A4166, 0x66338E62, 0x71FC37E8, 0x0485F8EC, 0x35DEC3AB, 0x40A70CAF,
+	0x1A41B0BF, 0x6F387FBB, 0x5E6344FC, 0x2B1A8BF8, 0x3CD53272, 0x49ACFD76, 0x78F7C631, 0x0D8E0935,
+	0x63EBD45A, 0x16921B5E, 0x27C92019, 0x52B0EF1D, 0x457F5697, 0x30069993, 0x015DA2D4, 0x74246DD0,
+	0x2EC2D1C0, 0x5BBB1EC4, 0x6AE02583, 0x1F99EA87, 0x0856530D, 0x7D2F9C09, 0x4C74A74E, 0x390D684A,
+	0x3E6E77DB, 0x4B17B8DF, 0x7A4C8398, 0x0F354C9C, 0x18FAF516, 0x6D833A12, 0x5CD80155, 0x29A1CE51,
+	0x73477241, 0x063EBD45, 0x37658602, 0x421C4906, 0x55D3F08C, 0x20AA3F88, 0x11F104CF, 0x6488CBCB,
+	0x0AED16A4, 0x7F94D9A0, 0x4ECFE2E7, 0x3BB62DE3, 0x2C799469, 0x59005B6D, 0x685B602A, 0x1D22AF2E,
+	0x47C4133E, 0x32BDDC3A, 0x03E6E77D, 0x769F2879, 0x615091F3, 0x14295EF7, 0x257265B0, 0x500BAAB4,
+	0x2BB45A92, 0x5ECD9596, 0x6F96AED1, 0x1AEF61D5, 0x0D20D85F, 0x7859175B, 0x49022C1C, 0x3C7BE318,
+	0x669D5F08, 0x13E4900C, 0x22BFAB4B, 0x57C6644F, 0x4009DDC5, 0x357012C1, 0x042B2986, 0x7152E682,
+	0x1F373BED, 0x6A4EF4E9, 0x5B15CFAE, 0x2E6C00AA, 0x39A3B920, 0x4CDA7624, 0x7D814D63, 0x08F88267,
+	0x521E3E77, 0x2767F173, 0x163CCA34, 0x63450530, 0x748ABCBA, 0x01F373BE, 0x30A848F9, 0x45D187FD,
+	0x42B2986C, 0x37CB5768, 0x06906C2F, 0x73E9A32B, 0x64261AA1, 0x115FD5A5, 0x2004EEE2, 0x557D21E6,
+	0x0F9B9DF6, 0x7AE252F2, 0x4BB969B5, 0x3EC0A6B1, 0x290F1F3B, 0x5C76D03F, 0x6D2DEB78, 0x1854247C,
+	0x7631F913, 0x03483617, 0x32130D50, 0x476AC254, 0x50A57BDE, 0x25DCB4DA, 0x14878F9D, 0x61FE4099,
+	0x3B18FC89, 0x4E61338D, 0x7F3A08CA, 0x0A43C7CE, 0x1D8C7E44, 0x68F5B140, 0x59AE8A07, 0x2CD74503,
+	// Seed 0x75
+	0x00000000, 0x0ED1889C, 0x1DA31138, 0x137299A4, 0x3B462270, 0x3597AAEC, 0x26E53348, 0x2834BBD4,
+	0x36534F87, 0x3882C71B, 0x2BF05EBF, 0x2521D623, 0x0D156DF7, 0x03C4E56B, 0x10B67CCF, 0x1E67F453,
+	0x2C799469, 0x22A81CF5, 0x31DA8551, 0x3F0B0DCD, 0x173FB619, 0x19EE3E85, 0x0A9CA721, 0x044D2FBD,
+	0x1A2ADBEE, 0x14FB5372, 0x0789CAD6, 0x0958424A, 0x216CF99E, 0x2FBD7102, 0x3CCFE8A6, 0x321E603A,
+	0x182C23B5, 0x16FDAB29, 0x058F328D, 0x0B5EBA11, 0x236A01C5, 0x2DBB8959, 0x3EC910FD, 0x30189861,
+	0x2E7F6C32, 0x20AEE4AE, 0x33DC7D0A, 0x3D0DF596, 0x15394E42, 0x1BE8C6DE, 0x089A5F7A, 0x064BD7E6,
+	0x3455B7DC, 0x3A843F40, 0x29F6A6E4, 0x27272E78, 0x0F1395AC, 0x01C21D30, 0x12B08494, 0x1C610C08,
+	0x0206F85B, 0x0CD770C7, 0x1FA5E963, 0x117461FF, 0x3940DA2B, 0x379152B7, 0x24E3CB13, 0x2A32438F,
+	0x3058476A, 0x3E89CFF6, 0x2DFB5652, 0x232ADECE, 0x0B1E651A, 0x05CFED86, 0x16BD7422, 0x186CFCBE,
+	0x060B08ED, 0x08DA8071, 0x1BA819D5, 0x15799149, 0x3D4D2A9D, 0x339CA201, 0x20EE3BA5, 0x2E3FB339,
+	0x1C21D303, 0x12F05B9F, 0x0182C23B, 0x0F534AA7, 0x2767F173, 0x29B679EF, 0x3AC4E04B, 0x341568D7,
+	0x2A729C84, 0x24A31418, 0x37D18DBC, 0x39000520, 0x1134BEF4, 0x1FE53668, 0x0C97AFCC, 0x02462750,
+	0x287464DF, 0x26A5EC43, 0x35D775E7, 0x3B06FD7B, 0x133246AF, 0x1DE3CE33, 0x0E915797, 0x0040DF0B,
+	0x1E272B58, 0x10F6A3C4, 0x03843A60, 0x0D55B2FC, 0x25610928, 0x2BB081B4, 0x38C21810, 0x3613908C,
+	0x040DF0B6, 0x0ADC782A, 0x19AEE18E, 0x177F6912, 0x3F4BD2C6, 0x319A5A5A, 0x22E8C3FE, 0x2C394B62,
+	0x325EBF31, 0x3C8F37AD, 0x2FFDAE09, 0x212C2695, 0x09189D41, 0x07C915DD, 0x14BB8C79, 0x1A6A04E5,
+	0x206F85B3, 0x2EBE0D2F, 0x3DCC948B, 0x331D1C17, 0x1B29A7C3, 0x15F82F5F, 0x068AB6FB, 0x085B3E67,
+	0x163CCA34, 0x18ED42A8, 0x0B9FDB0C, 0x054E5390, 0x2D7AE844, 0x23AB60D8, 0x30D9F97C, 0x3E0871E0,
+	0x0C1611DA, 0x02C79946, 0x11B500E2, 0x1F64887E, 0x375033AA, 0x3981BB36, 0x2AF32292, 0x2422AA0E,
+	0x3A455E5D, 0x3494D6C1, 0x27E64F65, 0x2937C7F9, 0x01037C2D, 0x0FD2F4B1, 0x1CA06D15, 0x1271E589,
+	0x3843A606, 0x36922E9A, 0x25E0B73E, 0x2B313FA2, 0x03058476, 0x0DD40CEA, 0x1EA6954E, 0x10771DD2,
+	0x0E10E981, 0x00C1611D, 0x13B3F8B9, 0x1D627025, 0x3556CBF1, 0x3B87436D, 0x28F5DAC9, 0x26245255,
+	0x143A326F, 0x1AEBBAF3, 0x09992357, 0x0748ABCB, 0x2F7C101F, 0x21AD9883, 0x32DF0127, 0x3C0E89BB,
+	0x22697DE8, 0x2CB8F574, 0x3FCA6CD0, 0x311BE44C, 0x192F5F98, 0x17FED704, 0x048C4EA0, 0x0A5DC63C,
+	0x1037C2D9, 0x1EE64A45, 0x0D94D3E1, 0x03455B7D, 0x2B71E0A9, 0x25A06835, 0x36D2F191, 0x3803790D,
+	0x26648D5E, 0x28B505C2, 0x3BC79C66, 0x351614FA, 0x1D22AF2E, 0x13F327B2, 0x0081BE16, 0x0E50368A,
+	0x3C4E56B0, 0x329FDE2C, 0x21ED4788, 0x2F3CCF14, 0x070874C0, 0x09D9FC5C, 0x1AAB65F8, 0x147AED64,
+	0x0A1D1937, 0x04CC91AB, 0x17BE080F, 0x196F8093, 0x315B3B47, 0x3F8AB3DB, 0x2CF82A7F, 0x2229A2E3,
+	0x081BE16C, 0x06CA69F0, 0x15B8F054, 0x1B6978C8, 0x335DC31C, 0x3D8C4B80, 0x2EFED224, 0x202F5AB8,
+	0x3E48AEEB, 0x30992677, 0x23EBBFD3, 0x2D3A374F, 0x050E8C9B, 0x0BDF0407, 0x18AD9DA3, 0x167C153F,
+	0x24627505, 0x2AB3FD99, 0x39C1643D, 0x3710ECA1, 0x1F245775, 0x11F5DFE9, 0x0287464D, 0x0C56CED1,
+	0x12313A82, 0x1CE0B21E, 0x0F922BBA, 0x0143A326, 0x297718F2, 0x27A6906E, 0x34D409CA, 0x3A058156,
+	// Seed 0x76
+	0x00000000, 0x9AF56C13, 0x47277035, 0xDDD21C26, 0x8E4EE06A, 0x14BB8C79, 0xC969905F, 0x539CFC4C,
+	0x6E5068C7, 0xF4A504D4, 0x297718F2, 0xB38274E1, 0xE01E88AD, 0x7AEBE4BE, 0xA739F898, 0x3DCC948B,
+	0xDCA0D18E, 0x4655BD9D, 0x9B87A1BB, 0x0172CDA8, 0x52EE31E4, 0xC81B5DF7, 0x15C941D1, 0x8F3C2DC2,
+	0xB2F0B949, 0x2805D55A, 0xF5D7C97C, 0x6F22A56F, 0x3CBE5923, 0xA64B3530, 0x7B992916, 0xE16C4505,
+	0xCB8C0B0F, 0x5179671C, 0x8CAB7B3A, 0x165E1729, 0x45C2EB65, 0xDF378776, 0x02E59B50, 0x9810F743,
+	0xA5DC63C8, 0x3F290FDB, 0xE2FB13FD, 0x780E7FEE, 0x2B9283A2, 0xB167EFB1, 0x6CB5F397, 0xF6409F84,
+	0x172CDA81, 0x8DD9B692, 0x500BAAB4, 0xCAFEC6A7, 0x99623AEB, 0x039756F8, 0xDE454ADE, 0x44B026CD,
+	0x797CB246, 0xE389DE55, 0x3E5BC273, 0xA4AEAE60, 0xF732522C, 0x6DC73E3F, 0xB0152219, 0x2AE04E0A,
+	0xE5D5BE0D, 0x7F20D21E, 0xA2F2CE38, 0x3807A22B, 0x6B9B5E67, 0xF16E3274, 0x2CBC2E52, 0xB6494241,
+	0x8B85D6CA, 0x1170BAD9, 0xCCA2A6FF, 0x5657CAEC, 0x05CB36A0, 0x9F3E5AB3, 0x42EC4695, 0xD8192A86,
+	0x39756F83, 0xA3800390, 0x7E521FB6, 0xE4A773A5, 0xB73B8FE9, 0x2DCEE3FA, 0xF01CFFDC, 0x6AE993CF,
+	0x57250744, 0xCDD06B57, 0x10027771, 0x8AF71B62, 0xD96BE72E, 0x439E8B3D, 0x9E4C971B, 0x04B9FB08,
+	0x2E59B502, 0xB4ACD911, 0x697EC537, 0xF38BA924, 0xA0175568, 0x3AE2397B, 0xE730255D, 0x7DC5494E,
+	0x4009DDC5, 0xDAFCB1D6, 0x072EADF0, 0x9DDBC1E3, 0xCE473DAF, 0x54B251BC, 0x89604D9A, 0x13952189,
+	0xF2F9648C, 0x680C089F, 0xB5DE14B9, 0x2F2B78AA, 0x7CB784E6, 0xE642E8F5, 0x3B90F4D3, 0xA16598C0,
+	0x9CA90C4B, 0x065C6058, 0xDB8E7C7E, 0x417B106D, 0x12E7EC21, 0x88128032, 0x55C09C14, 0xCF35F007,
+	0xB966D409, 0x2393B81A, 0xFE41A43C, 0x64B4C82F, 0x37283463, 0xADDD5870, 0x700F4456, 0xEAFA2845,
+	0xD736BCCE, 0x4DC3D0DD, 0x9011CCFB, 0x0AE4A0E8, 0x59785CA4, 0xC38D30B7, 0x1E5F2C91, 0x84AA4082,
+	0x65C60587, 0xFF336994, 0x22E175B2, 0xB81419A1, 0xEB88E5ED, 0x717D89FE, 0xACAF95D8, 0x365AF9CB,
+	0x0B966D40, 0x91630153, 0x4CB11D75, 0xD6447166, 0x85D88D2A, 0x1F2DE139, 0xC2FFFD1F, 0x580A910C,
+	0x72EADF06, 0xE81FB315, 0x35CDAF33, 0xAF38C320, 0xFCA43F6C, 0x6651537F, 0xBB834F59, 0x2176234A,
+	0x1CBAB7C1, 0x864FDBD2, 0x5B9DC7F4, 0xC168ABE7, 0x92F457AB, 0x08013BB8, 0xD5D3279E, 0x4F264B8D,
+	0xAE4A0E88, 0x34BF629B, 0xE96D7EBD, 0x739812AE, 0x2004EEE2, 0xBAF182F1, 0x67239ED7, 0xFDD6F2C4,
+	0xC01A664F, 0x5AEF0A5C, 0x873D167A, 0x1DC87A69, 0x4E548625, 0xD4A1EA36, 0x0973F610, 0x93869A03,
+	0x5CB36A04, 0xC6460617, 0x1B941A31, 0x81617622, 0xD2FD8A6E, 0x4808E67D, 0x95DAFA5B, 0x0F2F9648,
+	0x32E302C3, 0xA8166ED0, 0x75C472F6, 0xEF311EE5, 0xBCADE2A9, 0x26588EBA, 0xFB8A929C, 0x617FFE8F,
+	0x8013BB8A, 0x1AE6D799, 0xC734CBBF, 0x5DC1A7AC, 0x0E5D5BE0, 0x94A837F3, 0x497A2BD5, 0xD38F47C6,
+	0xEE43D34D, 0x74B6BF5E, 0xA964A378, 0x3391CF6B, 0x600D3327, 0xFAF85F34, 0x272A4312, 0xBDDF2F01,
+	0x973F610B, 0x0DCA0D18, 0xD018113E, 0x4AED7D2D, 0x19718161, 0x8384ED72, 0x5E56F154, 0xC4A39D47,
+	0xF96F09CC, 0x639A65DF, 0xBE4879F9, 0x24BD15EA, 0x7721E9A6, 0xEDD485B5, 0x30069993, 0xAAF3F580,
+	0x4B9FB085, 0xD16ADC96, 0x0CB8C0B0, 0x964DACA3, 0xC5D150EF, 0x5F243CFC, 0x82F620DA, 0x18034CC9,
+	0x25CFD842, 0xBF3AB451, 0x62E8A877, 0xF81DC464, 0xAB813828, 0x3174543B, 0xECA6481D, 0x7653240E,
+	// Seed 0x77
+	0x00000000, 0xABF4528B, 0xCB2B6C29, 0x60DF3EA2, 0x0A95116D, 0xA16143E6, 0xC1BE7D44, 0x6A4A2FCF,
+	0x152A22DA, 0xBEDE7051, 0xDE014EF3, 0x75F51C78, 0x1FBF33B7, 0xB44B613C, 0xD4945F9E, 0x7F600D15,
+	0x2A5445B4, 0x81A0173F, 0xE17F299D, 0x4A8B7B16, 0x20C154D9, 0x8B350652, 0xEBEA38F0, 0x401E6A7B,
+	0x3F7E676E, 0x948A35E5, 0xF4550B47, 0x5FA159CC, 0x35EB7603, 0x9E1F2488, 0xFEC01A2A, 0x553448A1,
+	0x54A88B68, 0xFF5CD9E3, 0x9F83E741, 0x3477B5CA, 0x5E3D9A05, 0xF5C9C88E, 0x9516F62C, 0x3EE2A4A7,
+	0x4182A9B2, 0xEA76FB39, 0x8AA9C59B, 0x215D9710, 0x4B17B8DF, 0xE0E3EA54, 0x803CD4F6, 0x2BC8867D,
+	0x7EFCCEDC, 0xD5089C57, 0xB5D7A2F5, 0x1E23F07E, 0x7469DFB1, 0xDF9D8D3A, 0xBF42B398, 0x14B6E113,
+	0x6BD6EC06, 0xC022BE8D, 0xA0FD802F, 0x0B09D2A4, 0x6143FD6B, 0xCAB7AFE0, 0xAA689142, 0x019CC3C9,
+	0xA95116D0, 0x02A5445B, 0x627A7AF9, 0xC98E2872, 0xA3C407BD, 0x08305536, 0x68EF6B94, 0xC31B391F,
+	0xBC7B340A, 0x178F6681, 0x77505823, 0xDCA40AA8, 0xB6EE2567, 0x1D1A77EC, 0x7DC5494E, 0xD6311BC5,
+	0x83055364, 0x28F101EF, 0x482E3F4D, 0xE3DA6DC6, 0x89904209, 0x22641082, 0x42BB2E20, 0xE94F7CAB,
+	0x962F71BE, 0x3DDB2335, 0x5D041D97, 0xF6F04F1C, 0x9CBA60D3, 0x374E3258, 0x57910CFA, 0xFC655E71,
+	0xFDF99DB8, 0x560DCF33, 0x36D2F191, 0x9D26A31A, 0xF76C8CD5, 0x5C98DE5E, 0x3C47E0FC, 0x97B3B277,
+	0xE8D3BF62, 0x4327EDE9, 0x23F8D34B, 0x880C81C0, 0xE246AE0F, 0x49B2FC84, 0x296DC226, 0x829990AD,
+	0xD7ADD80C, 0x7C598A87, 0x1C86B425, 0xB772E6AE, 0xDD38C961, 0x76CC9BEA, 0x1613A548, 0xBDE7F7C3,
+	0xC287FAD6, 0x6973A85D, 0x09AC96FF, 0xA258C474, 0xC812EBBB, 0x63E6B930, 0x03398792, 0xA8CDD519,
+	0xCE61E49F, 0x6595B614, 0x054A88B6, 0xAEBEDA3D, 0xC4F4F5F2, 0x6F00A779, 0x0FDF99DB, 0xA42BCB50,
+	0xDB4BC645, 0x70BF94CE, 0x1060AA6C, 0xBB94F8E7, 0xD1DED728, 0x7A2A85A3, 0x1AF5BB01, 0xB101E98A,
+	0xE435A12B, 0x4FC1F3A0, 0x2F1ECD02, 0x84EA9F89, 0xEEA0B046, 0x4554E2CD, 0x258BDC6F, 0x8E7F8EE4,
+	0xF11F83F1, 0x5AEBD17A, 0x3A34EFD8, 0x91C0BD53, 0xFB8A929C, 0x507EC017, 0x30A1FEB5, 0x9B55AC3E,
+	0x9AC96FF7, 0x313D3D7C, 0x51E203DE, 0xFA165155, 0x905C7E9A, 0x3BA82C11, 0x5B7712B3, 0xF0834038,
+	0x8FE34D2D, 0x24171FA6, 0x44C82104, 0xEF3C738F, 0x85765C40, 0x2E820ECB, 0x4E5D3069, 0xE5A962E2,
+	0xB09D2A43, 0x1B6978C8, 0x7BB6466A, 0xD04214E1, 0xBA083B2E, 0x11FC69A5, 0x71235707, 0xDAD7058C,
+	0xA5B70899, 0x0E435A12, 0x6E9C64B0, 0xC568363B, 0xAF2219F4, 0x04D64B7F, 0x640975DD, 0xCFFD2756,
+	0x6730F24F, 0xCCC4A0C4, 0xAC1B9E66, 0x07EFCCED, 0x6DA5E322, 0xC651B1A9, 0xA68E8F0B, 0x0D7ADD80,
+	0x721AD095, 0xD9EE821E, 0xB931BCBC, 0x12C5EE37, 0x788FC1F8, 0xD37B9373, 0xB3A4ADD1, 0x1850FF5A,
+	0x4D64B7FB, 0xE690E570, 0x864FDBD2, 0x2DBB8959, 0x47F1A696, 0xEC05F41D, 0x8CDACABF, 0x272E9834,
+	0x584E9521, 0xF3BAC7AA, 0x9365F908, 0x3891AB83, 0x52DB844C, 0xF92FD6C7, 0x99F0E865, 0x3204BAEE,
+	0x33987927, 0x986C2BAC, 0xF8B3150E, 0x53474785, 0x390D684A, 0x92F93AC1, 0xF2260463, 0x59D256E8,
+	0x26B25BFD, 0x8D460976, 0xED9937D4, 0x466D655F, 0x2C274A90, 0x87D3181B, 0xE70C26B9, 0x4CF87432,
+	0x19CC3C93, 0xB2386E18, 0xD2E750BA, 0x79130231, 0x13592DFE, 0xB8AD7F75, 0xD87241D7, 0x7386135C,
+	0x0CE61E49, 0xA7124CC2, 0xC7CD7260, 0x6C3920EB, 0x06730F24, 0xAD875DAF, 0xCD58630D, 0x66AC3186,
+	// Seed 0x78
+	0x00000000, 0x59785CA4, 0x0F4D4B55, 0x563517F1, 0x1E9A96AA, 0x47E2CA0E, 0x11D7DDFF, 0x48AF815B,
+	0x3D352D54, 0x644D71F0, 0x32786601, 0x6B003AA5, 0x23AFBBFE, 0x7AD7E75A, 0x2CE2F0AB, 0x759AAC0F,
+	0x7A6A5AA8, 0x2312060C, 0x752711FD, 0x2C5F4D59, 0x64F0CC02, 0x3D8890A6, 0x6BBD8757, 0x32C5DBF3,
+	0x475F77FC, 0x1E272B58, 0x48123CA9, 0x116A600D, 0x59C5E156, 0x00BDBDF2, 0x5688AA03, 0x0FF0F6A7,
+	0x4969474D, 0x10111BE9, 0x46240C18, 0x1F5C50BC, 0x57F3D1E7, 0x0E8B8D43, 0x58BE9AB2, 0x01C6C616,
+	0x745C6A19, 0x2D2436BD, 0x7B11214C, 0x22697DE8, 0x6AC6FCB3, 0x33BEA017, 0x658BB7E6, 0x3CF3EB42,
+	0x33031DE5, 0x6A7B4141, 0x3C4E56B0, 0x65360A14, 0x2D998B4F, 0x74E1D7EB, 0x22D4C01A, 0x7BAC9CBE,
+	0x0E3630B1, 0x574E6C15, 0x017B7BE4, 0x58032740, 0x10ACA61B, 0x49D4FABF, 0x1FE1ED4E, 0x4699B1EA,
+	0x2F6F7C87, 0x76172023, 0x202237D2, 0x795A6B76, 0x31F5EA2D, 0x688DB689, 0x3EB8A178, 0x67C0FDDC,
+	0x125A51D3, 0x4B220D77, 0x1D171A86, 0x446F4622, 0x0CC0C779, 0x55B89BDD, 0x038D8C2C, 0x5AF5D088,
+	0x5505262F, 0x0C7D7A8B, 0x5A486D7A, 0x033031DE, 0x4B9FB085, 0x12E7EC21, 0x44D2FBD0, 0x1DAAA774,
+	0x68300B7B, 0x314857DF, 0x677D402E, 0x3E051C8A, 0x76AA9DD1, 0x2FD2C175, 0x79E7D684, 0x209F8A20,
+	0x66063BCA, 0x3F7E676E, 0x694B709F, 0x30332C3B, 0x789CAD60, 0x21E4F1C4, 0x77D1E635, 0x2EA9BA91,
+	0x5B33169E, 0x024B4A3A, 0x547E5DCB, 0x0D06016F, 0x45A98034, 0x1CD1DC90, 0x4AE4CB61, 0x139C97C5,
+	0x1C6C6162, 0x45143DC6, 0x13212A37, 0x4A597693, 0x02F6F7C8, 0x5B8EAB6C, 0x0DBBBC9D, 0x54C3E039,
+	0x21594C36, 0x78211092, 0x2E140763, 0x776C5BC7, 0x3FC3DA9C, 0x66BB8638, 0x308E91C9, 0x69F6CD6D,
+	0x5EDEF90E, 0x07A6A5AA, 0x5193B25B, 0x08EBEEFF, 0x40446FA4, 0x193C3300, 0x4F0924F1, 0x16717855,
+	0x63EBD45A, 0x3A9388FE, 0x6CA69F0F, 0x35DEC3AB, 0x7D7142F0, 0x24091E54, 0x723C09A5, 0x2B445501,
+	0x24B4A3A6, 0x7DCCFF02, 0x2BF9E8F3, 0x7281B457, 0x3A2E350C, 0x635669A8, 0x35637E59, 0x6C1B22FD,
+	0x19818EF2, 0x40F9D256, 0x16CCC5A7, 0x4FB49903, 0x071B1858, 0x5E6344FC, 0x0856530D, 0x512E0FA9,
+	0x17B7BE43, 0x4ECFE2E7, 0x18FAF516, 0x4182A9B2, 0x092D28E9, 0x5055744D, 0x066063BC, 0x5F183F18,
+	0x2A829317, 0x73FACFB3, 0x25CFD842, 0x7CB784E6, 0x341805BD, 0x6D605919, 0x3B554EE8, 0x622D124C,
+	0x6DDDE4EB, 0x34A5B84F, 0x6290AFBE, 0x3BE8F31A, 0x73477241, 0x2A3F2EE5, 0x7C0A3914, 0x257265B0,
+	0x50E8C9BF, 0x0990951B, 0x5FA582EA, 0x06DDDE4E, 0x4E725F15, 0x170A03B1, 0x413F1440, 0x184748E4,
+	0x71B18589, 0x28C9D92D, 0x7EFCCEDC, 0x27849278, 0x6F2B1323, 0x36534F87, 0x60665876, 0x391E04D2,
+	0x4C84A8DD, 0x15FCF479, 0x43C9E388, 0x1AB1BF2C, 0x521E3E77, 0x0B6662D3, 0x5D537522, 0x042B2986,
+	0x0BDBDF21, 0x52A38385, 0x04969474, 0x5DEEC8D0, 0x1541498B, 0x4C39152F, 0x1A0C02DE, 0x43745E7A,
+	0x36EEF275, 0x6F96AED1, 0x39A3B920, 0x60DBE584, 0x287464DF, 0x710C387B, 0x27392F8A, 0x7E41732E,
+	0x38D8C2C4, 0x61A09E60, 0x37958991, 0x6EEDD535, 0x2642546E, 0x7F3A08CA, 0x290F1F3B, 0x7077439F,
+	0x05EDEF90, 0x5C95B334, 0x0AA0A4C5, 0x53D8F861, 0x1B77793A, 0x420F259E, 0x143A326F, 0x4D426ECB,
+	0x42B2986C, 0x1BCAC4C8, 0x4DFFD339, 0x14878F9D, 0x5C280EC6, 0x05505262, 0x53654593, 0x0A1D1937,
+	0x7F87B538, 0x26FFE99C, 0x70CAFE6D, 0x29B2A2C9, 0x611D2392, 0x38657F36, 0x6E5068C7, 0x37283463,
+	// Seed 0x79
+	0x00000000, 0x05688AB3, 0x0AD11566, 0x0FB99FD5, 0x15A22ACC, 0x10CAA07F, 0x1F733FAA, 0x1A1BB519,
+	0x2B445598, 0x2E2CDF2B, 0x219540FE, 0x24FDCA4D, 0x3EE67F54, 0x3B8EF5E7, 0x34376A32, 0x315FE081,
+	0x053B3921, 0x0053B392, 0x0FEA2C47, 0x0A82A6F4, 0x109913ED, 0x15F1995E, 0x1A48068B, 0x1F208C38,
+	0x2E7F6CB9, 0x2B17E60A, 0x24AE79DF, 0x21C6F36C, 0x3BDD4675, 0x3EB5CCC6, 0x310C5313, 0x3464D9A0,
+	0x0A767242, 0x0F1EF8F1, 0x00A76724, 0x05CFED97, 0x1FD4588E, 0x1ABCD23D, 0x15054DE8, 0x106DC75B,
+	0x213227DA, 0x245AAD69, 0x2BE332BC, 0x2E8BB80F, 0x34900D16, 0x31F887A5, 0x3E411870, 0x3B2992C3,
+	0x0F4D4B63, 0x0A25C1D0, 0x059C5E05, 0x00F4D4B6, 0x1AEF61AF, 0x1F87EB1C, 0x103E74C9, 0x1556FE7A,
+	0x24091EFB, 0x21619448, 0x2ED80B9D, 0x2BB0812E, 0x31AB3437, 0x34C3BE84, 0x3B7A2151, 0x3E12ABE2,
+	0x14ECE484, 0x11846E37, 0x1E3DF1E2, 0x1B557B51, 0x014ECE48, 0x042644FB, 0x0B9FDB2E, 0x0EF7519D,
+	0x3FA8B11C, 0x3AC03BAF, 0x3579A47A, 0x30112EC9, 0x2A0A9BD0, 0x2F621163, 0x20DB8EB6, 0x25B30405,
+	0x11D7DDA5, 0x14BF5716, 0x1B06C8C3, 0x1E6E4270, 0x0475F769, 0x011D7DDA, 0x0EA4E20F, 0x0BCC68BC,
+	0x3A93883D, 0x3FFB028E, 0x30429D5B, 0x352A17E8, 0x2F31A2F1, 0x2A592842, 0x25E0B797, 0x20883D24,
+	0x1E9A96C6, 0x1BF21C75, 0x144B83A0, 0x11230913, 0x0B38BC0A, 0x0E5036B9, 0x01E9A96C, 0x048123DF,
+	0x35DEC35E, 0x30B649ED, 0x3F0FD638, 0x3A675C8B, 0x207CE992, 0x25146321, 0x2AADFCF4, 0x2FC57647,
+	0x1BA1AFE7, 0x1EC92554, 0x1170BA81, 0x14183032, 0x0E03852B, 0x0B6B0F98, 0x04D2904D, 0x01BA1AFE,
+	0x30E5FA7F, 0x358D70CC, 0x3A34EF19, 0x3F5C65AA, 0x2547D0B3, 0x202F5A00, 0x2F96C5D5, 0x2AFE4F66,
+	0x29D9C908, 0x2CB143BB, 0x2308DC6E, 0x266056DD, 0x3C7BE3C4, 0x39136977, 0x36AAF6A2, 0x33C27C11,
+	0x029D9C90, 0x07F51623, 0x084C89F6, 0x0D240345, 0x173FB65C, 0x12573CEF, 0x1DEEA33A, 0x18862989,
+	0x2CE2F029, 0x298A7A9A, 0x2633E54F, 0x235B6FFC, 0x3940DAE5, 0x3C285056, 0x3391CF83, 0x36F94530,
+	0x07A6A5B1, 0x02CE2F02, 0x0D77B0D7, 0x081F3A64, 0x12048F7D, 0x176C05CE, 0x18D59A1B, 0x1DBD10A8,
+	0x23AFBB4A, 0x26C731F9, 0x297EAE2C, 0x2C16249F, 0x360D9186, 0x33651B35, 0x3CDC84E0, 0x39B40E53,
+	0x08EBEED2, 0x0D836461, 0x023AFBB4, 0x07527107, 0x1D49C41E, 0x18214EAD, 0x1798D178, 0x12F05BCB,
+	0x2694826B, 0x23FC08D8, 0x2C45970D, 0x292D1DBE, 0x3336A8A7, 0x365E2214, 0x39E7BDC1, 0x3C8F3772,
+	0x0DD0D7F3, 0x08B85D40, 0x0701C295, 0x02694826, 0x1872FD3F, 0x1D1A778C, 0x12A3E859, 0x17CB62EA,
+	0x3D352D8C, 0x385DA73F, 0x37E438EA, 0x328CB259, 0x28970740, 0x2DFF8DF3, 0x22461226, 0x272E9895,
+	0x16717814, 0x1319F2A7, 0x1CA06D72, 0x19C8E7C1, 0x03D352D8, 0x06BBD86B, 0x090247BE, 0x0C6ACD0D,
+	0x380E14AD, 0x3D669E1E, 0x32DF01CB, 0x37B78B78, 0x2DAC3E61, 0x28C4B4D2, 0x277D2B07, 0x2215A1B4,
+	0x134A4135, 0x1622CB86, 0x199B5453, 0x1CF3DEE0, 0x06E86BF9, 0x0380E14A, 0x0C397E9F, 0x0951F42C,
+	0x37435FCE, 0x322BD57D, 0x3D924AA8, 0x38FAC01B, 0x22E17502, 0x2789FFB1, 0x28306064, 0x2D58EAD7,
+	0x1C070A56, 0x196F80E5, 0x16D61F30, 0x13BE9583, 0x09A5209A, 0x0CCDAA29, 0x037435FC, 0x061CBF4F,
+	0x327866EF, 0x3710EC5C, 0x38A97389, 0x3DC1F93A, 0x27DA4C23, 0x22B2C690, 0x2D0B5945, 0x2863D3F6,
+	0x193C3377, 0x1C54B9C4, 0x13ED2611, 0x1685ACA2, 0x0C9E19BB, 0x09F69308, 0x064F0CDD, 0x0327866E,
+	// Seed 0x7A
+	0x00000000, 0x12FD36F5, 0x25FA6DEA, 0x37075B1F, 0x4BF4DBD4, 0x5909ED21, 0x6E0EB63E, 0x7CF380CB,
+	0x97E9B7A8, 0x8514815D, 0xB213DA42, 0xA0EEECB7, 0xDC1D6C7C, 0xCEE05A89, 0xF9E70196, 0xEB1A3763,
+	0x4E725F15, 0x5C8F69E0, 0x6B8832FF, 0x7975040A, 0x058684C1, 0x177BB234, 0x207CE92B, 0x3281DFDE,
+	0xD99BE8BD, 0xCB66DE48, 0xFC618557, 0xEE9CB3A2, 0x926F3369, 0x8092059C, 0xB7955E83, 0xA5686876,
+	0x9CE4BE2A, 0x8E1988DF, 0xB91ED3C0, 0xABE3E535, 0xD71065FE, 0xC5ED530B, 0xF2EA0814, 0xE0173EE1,
+	0x0B0D0982, 0x19F03F77, 0x2EF76468, 0x3C0A529D, 0x40F9D256, 0x5204E4A3, 0x6503BFBC, 0x77FE8949,
+	0xD296E13F, 0xC06BD7CA, 0xF76C8CD5, 0xE591BA20, 0x99623AEB, 0x8B9F0C1E, 0xBC985701, 0xAE6561F4,
+	0x457F5697, 0x57826062, 0x60853B7D, 0x72780D88, 0x0E8B8D43, 0x1C76BBB6, 0x2B71E0A9, 0x398CD65C,
+	0x58684C11, 0x4A957AE4, 0x7D9221FB, 0x6F6F170E, 0x139C97C5, 0x0161A130, 0x3666FA2F, 0x249BCCDA,
+	0xCF81FBB9, 0xDD7CCD4C, 0xEA7B9653, 0xF886A0A6, 0x8475206D, 0x96881698, 0xA18F4D87, 0xB3727B72,
+	0x161A1304, 0x04E725F1, 0x33E07EEE, 0x211D481B, 0x5DEEC8D0, 0x4F13FE25, 0x7814A53A, 0x6AE993CF,
+	0x81F3A4AC, 0x930E9259, 0xA409C946, 0xB6F4FFB3, 0xCA077F78, 0xD8FA498D, 0xEFFD1292, 0xFD002467,
+	0xC48CF23B, 0xD671C4CE, 0xE1769FD1, 0xF38BA924, 0x8F7829EF, 0x9D851F1A, 0xAA824405, 0xB87F72F0,
+	0x53654593, 0x41987366, 0x769F2879, 0x64621E8C, 0x18919E47, 0x0A6CA8B2, 0x3D6BF3AD, 0x2F96C558,
+	0x8AFEAD2E, 0x98039BDB, 0xAF04C0C4, 0xBDF9F631, 0xC10A76FA, 0xD3F7400F, 0xE4F01B10, 0xF60D2DE5,
+	0x1D171A86, 0x0FEA2C73, 0x38ED776C, 0x2A104199, 0x56E3C152, 0x441EF7A7, 0x7319ACB8, 0x61E49A4D,
+	0xB0D09822, 0xA22DAED7, 0x952AF5C8, 0x87D7C33D, 0xFB2443F6, 0xE9D97503, 0xDEDE2E1C, 0xCC2318E9,
+	0x27392F8A, 0x35C4197F, 0x02C34260, 0x103E7495, 0x6CCDF45E, 0x7E30C2AB, 0x493799B4, 0x5BCAAF41,
+	0xFEA2C737, 0xEC5FF1C2, 0xDB58AADD, 0xC9A59C28, 0xB5561CE3, 0xA7AB2A16, 0x90AC7109, 0x825147FC,
+	0x694B709F, 0x7BB6466A, 0x4CB11D75, 0x5E4C2B80, 0x22BFAB4B, 0x30429DBE, 0x0745C6A1, 0x15B8F054,
+	0x2C342608, 0x3EC910FD, 0x09CE4BE2, 0x1B337D17, 0x67C0FDDC, 0x753DCB29, 0x423A9036, 0x50C7A6C3,
+	0xBBDD91A0, 0xA920A755, 0x9E27FC4A, 0x8CDACABF, 0xF0294A74, 0xE2D47C81, 0xD5D3279E, 0xC72E116B,
+	0x6246791D, 0x70BB4FE8, 0x47BC14F7, 0x55412202, 0x29B2A2C9, 0x3B4F943C, 0x0C48CF23, 0x1EB5F9D6,
+	0xF5AFCEB5, 0xE752F840, 0xD055A35F, 0xC2A895AA, 0xBE5B1561, 0xACA62394, 0x9BA1788B, 0x895C4E7E,
+	0xE8B8D433, 0xFA45E2C6, 0xCD42B9D9, 0xDFBF8F2C, 0xA34C0FE7, 0xB1B13912, 0x86B6620D, 0x944B54F8,
+	0x7F51639B, 0x6DAC556E, 0x5AAB0E71, 0x48563884, 0x34A5B84F, 0x26588EBA, 0x115FD5A5, 0x03A2E350,
+	0xA6CA8B26, 0xB437BDD3, 0x8330E6CC, 0x91CDD039, 0xED3E50F2, 0xFFC36607, 0xC8C43D18, 0xDA390BED,
+	0x31233C8E, 0x23DE0A7B, 0x14D95164, 0x06246791, 0x7AD7E75A, 0x682AD1AF, 0x5F2D8AB0, 0x4DD0BC45,
+	0x745C6A19, 0x66A15CEC, 0x51A607F3, 0x435B3106, 0x3FA8B1CD, 0x2D558738, 0x1A52DC27, 0x08AFEAD2,
+	0xE3B5DDB1, 0xF148EB44, 0xC64FB05B, 0xD4B286AE, 0xA8410665, 0xBABC3090, 0x8DBB6B8F, 0x9F465D7A,
+	0x3A2E350C, 0x28D303F9, 0x1FD458E6, 0x0D296E13, 0x71DAEED8, 0x6327D82D, 0x54208332, 0x46DDB5C7,
+	0xADC782A4, 0xBF3AB451, 0x883DEF4E, 0x9AC0D9BB, 0xE6335970, 0xF4CE6F85, 0xC3C9349A, 0xD134026F,
+	// Seed 0x7B
+	0x00000000, 0x3C2E3FF7, 0x785C7FEE, 0x44724019, 0xF0B8FFDC, 0xCC96C02B, 0x88E48032, 0xB4CABFC5,
+	0x6FDEAED1, 0x53F09126, 0x1782D13F, 0x2BACEEC8, 0x9F66510D, 0xA3486EFA, 0xE73A2EE3, 0xDB141114,
+	0xDFBD5DA2, 0xE3936255, 0xA7E1224C, 0x9BCF1DBB, 0x2F05A27E, 0x132B9D89, 0x5759DD90, 0x6B77E267,
+	0xB063F373, 0x8C4DCC84, 0xC83F8C9D, 0xF411B36A, 0x40DB0CAF, 0x7CF53358, 0x38877341, 0x04A94CB6,
+	0x31D5EA2D, 0x0DFBD5DA, 0x498995C3, 0x75A7AA34, 0xC16D15F1, 0xFD432A06, 0xB9316A1F, 0x851F55E8,
+	0x5E0B44FC, 0x62257B0B, 0x26573B12, 0x1A7904E5, 0xAEB3BB20, 0x929D84D7, 0xD6EFC4CE, 0xEAC1FB39,
+	0xEE68B78F, 0xD2468878, 0x9634C861, 0xAA1AF796, 0x1ED04853, 0x22FE77A4, 0x668C37BD, 0x5AA2084A,
+	0x81B6195E, 0xBD9826A9, 0xF9EA66B0, 0xC5C45947, 0x710EE682, 0x4D20D975, 0x0952996C, 0x357CA69B,
+	0x63ABD45A, 0x5F85EBAD, 0x1BF7ABB4, 0x27D99443, 0x93132B86, 0xAF3D1471, 0xEB4F5468, 0xD7616B9F,
+	0x0C757A8B, 0x305B457C, 0x74290565, 0x48073A92, 0xFCCD8557, 0xC0E3BAA0, 0x8491FAB9, 0xB8BFC54E,
+	0xBC1689F8, 0x8038B60F, 0xC44AF616, 0xF864C9E1, 0x4CAE7624, 0x708049D3, 0x34F209CA, 0x08DC363D,
+	0xD3C82729, 0xEFE618DE, 0xAB9458C7, 0x97BA6730, 0x2370D8F5, 0x1F5EE702, 0x5B2CA71B, 0x670298EC,
+	0x527E3E77, 0x6E500180, 0x2A224199, 0x160C7E6E, 0xA2C6C1AB, 0x9EE8FE5C, 0xDA9ABE45, 0xE6B481B2,
+	0x3DA090A6, 0x018EAF51, 0x45FCEF48, 0x79D2D0BF, 0xCD186F7A, 0xF136508D, 0xB5441094, 0x896A2F63,
+	0x8DC363D5, 0xB1ED5C22, 0xF59F1C3B, 0xC9B123CC, 0x7D7B9C09, 0x4155A3FE, 0x0527E3E7, 0x3909DC10,
+	0xE21DCD04, 0xDE33F2F3, 0x9A41B2EA, 0xA66F8D1D, 0x12A532D8, 0x2E8B0D2F, 0x6AF94D36, 0x56D772C1,
+	0xC757A8B4, 0xFB799743, 0xBF0BD75A, 0x8325E8AD, 0x37EF5768, 0x0BC1689F, 0x4FB32886, 0x739D1771,
+	0xA8890665, 0x94A73992, 0xD0D5798B, 0xECFB467C, 0x5831F9B9, 0x641FC64E, 0x206D8657, 0x1C43B9A0,
+	0x18EAF516, 0x24C4CAE1, 0x60B68AF8, 0x5C98B50F, 0xE8520ACA, 0xD47C353D, 0x900E7524, 0xAC204AD3,
+	0x77345BC7, 0x4B1A6430, 0x0F682429, 0x33461BDE, 0x878CA41B, 0xBBA29BEC, 0xFFD0DBF5, 0xC3FEE402,
+	0xF6824299, 0xCAAC7D6E, 0x8EDE3D77, 0xB2F00280, 0x063ABD45, 0x3A1482B2, 0x7E66C2AB, 0x4248FD5C,
+	0x995CEC48, 0xA572D3BF, 0xE10093A6, 0xDD2EAC51, 0x69E41394, 0x55CA2C63, 0x11B86C7A, 0x2D96538D,
+	0x293F1F3B, 0x151120CC, 0x516360D5, 0x6D4D5F22, 0xD987E0E7, 0xE5A9DF10, 0xA1DB9F09, 0x9DF5A0FE,
+	0x46E1B1EA, 0x7ACF8E1D, 0x3EBDCE04, 0x0293F1F3, 0xB6594E36, 0x8A7771C1, 0xCE0531D8, 0xF22B0E2F,
+	0xA4FC7CEE, 0x98D24319, 0xDCA00300, 0xE08E3CF7, 0x54448332, 0x686ABCC5, 0x2C18FCDC, 0x1036C32B,
+	0xCB22D23F, 0xF70CEDC8, 0xB37EADD1, 0x8F509226, 0x3B9A2DE3, 0x07B41214, 0x43C6520D, 0x7FE86DFA,
+	0x7B41214C, 0x476F1EBB, 0x031D5EA2, 0x3F336155, 0x8BF9DE90, 0xB7D7E167, 0xF3A5A17E, 0xCF8B9E89,
+	0x149F8F9D, 0x28B1B06A, 0x6CC3F073, 0x50EDCF84, 0xE4277041, 0xD8094FB6, 0x9C7B0FAF, 0xA0553058,
+	0x952996C3, 0xA907A934, 0xED75E92D, 0xD15BD6DA, 0x6591691F, 0x59BF56E8, 0x1DCD16F1, 0x21E32906,
+	0xFAF73812, 0xC6D907E5, 0x82AB47FC, 0xBE85780B, 0x0A4FC7CE, 0x3661F839, 0x7213B820, 0x4E3D87D7,
+	0x4A94CB61, 0x76BAF496, 0x32C8B48F, 0x0EE68B78, 0xBA2C34BD, 0x86020B4A, 0xC2704B53, 0xFE5E74A4,
+	0x254A65B0, 0x19645A47, 0x5D161A5E, 0x613825A9, 0xD5F29A6C, 0xE9DCA59B, 0xADAEE582, 0x9180DA75,
+	// Seed 0x7C
+	0x00000000, 0x5350F03B, 0x15C79A59, 0x46976A62, 0x2B8F34B2, 0x78DFC489, 0x3E48AEEB, 0x6D185ED0,
+	0x571E6964, 0x044E995F, 0x42D9F33D, 0x11890306, 0x7C915DD6, 0x2FC1ADED, 0x6956C78F, 0x3A0637B4,
+	0x1D5AA8E7, 0x4E0A58DC, 0x089D32BE, 0x5BCDC285, 0x36D59C55, 0x65856C6E, 0x2312060C, 0x7042F637,
+	0x4A44C183, 0x191431B8, 0x5F835BDA, 0x0CD3ABE1, 0x61CBF531, 0x329B050A, 0x740C6F68, 0x275C9F53,
+	0x3AB551CE, 0x69E5A1F5, 0x2F72CB97, 0x7C223BAC, 0x113A657C, 0x426A9547, 0x04FDFF25, 0x57AD0F1E,
+	0x6DAB38AA, 0x3EFBC891, 0x786CA2F3, 0x2B3C52C8, 0x46240C18, 0x1574FC23, 0x53E39641, 0x00B3667A,
+	0x27EFF929, 0x74BF0912, 0x32286370, 0x6178934B, 0x0C60CD9B, 0x5F303DA0, 0x19A757C2, 0x4AF7A7F9,
+	0x70F1904D, 0x23A16076, 0x65360A14, 0x3666FA2F, 0x5B7EA4FF, 0x082E54C4, 0x4EB93EA6, 0x1DE9CE9D,
+	0x756AA39C, 0x263A53A7, 0x60AD39C5, 0x33FDC9FE, 0x5EE5972E, 0x0DB56715, 0x4B220D77, 0x1872FD4C,
+	0x2274CAF8, 0x71243AC3, 0x37B350A1, 0x64E3A09A, 0x09FBFE4A, 0x5AAB0E71, 0x1C3C6413, 0x4F6C9428,
+	0x68300B7B, 0x3B60FB40, 0x7DF79122, 0x2EA76119, 0x43BF3FC9, 0x10EFCFF2, 0x5678A590, 0x052855AB,
+	0x3F2E621F, 0x6C7E9224, 0x2AE9F846, 0x79B9087D, 0x14A156AD, 0x47F1A696, 0x0166CCF4, 0x52363CCF,
+	0x4FDFF252, 0x1C8F0269, 0x5A18680B, 0x09489830, 0x6450C6E0, 0x370036DB, 0x71975CB9, 0x22C7AC82,
+	0x18C19B36, 0x4B916B0D, 0x0D06016F, 0x5E56F154, 0x334EAF84, 0x601E5FBF, 0x268935DD, 0x75D9C5E6,
+	0x52855AB5, 0x01D5AA8E, 0x4742C0EC, 0x141230D7, 0x790A6E07, 0x2A5A9E3C, 0x6CCDF45E, 0x3F9D0465,
+	0x059B33D1, 0x56CBC3EA, 0x105CA988, 0x430C59B3, 0x2E140763, 0x7D44F758, 0x3BD39D3A, 0x68836D01,
+	0x59B33D17, 0x0AE3CD2C, 0x4C74A74E, 0x1F245775, 0x723C09A5, 0x216CF99E, 0x67FB93FC, 0x34AB63C7,
+	0x0EAD5473, 0x5DFDA448, 0x1B6ACE2A, 0x483A3E11, 0x252260C1, 0x767290FA, 0x30E5FA98, 0x63B50AA3,
+	0x44E995F0, 0x17B965CB, 0x512E0FA9, 0x027EFF92, 0x6F66A142, 0x3C365179, 0x7AA13B1B, 0x29F1CB20,
+	0x13F7FC94, 0x40A70CAF, 0x063066CD, 0x556096F6, 0x3878C826, 0x6B28381D, 0x2DBF527F, 0x7EEFA244,
+	0x63066CD9, 0x30569CE2, 0x76C1F680, 0x259106BB, 0x4889586B, 0x1BD9A850, 0x5D4EC232, 0x0E1E3209,
+	0x341805BD, 0x6748F586, 0x21DF9FE4, 0x728F6FDF, 0x1F97310F, 0x4CC7C134, 0x0A50AB56, 0x59005B6D,
+	0x7E5CC43E, 0x2D0C3405, 0x6B9B5E67, 0x38CBAE5C, 0x55D3F08C, 0x068300B7, 0x40146AD5, 0x13449AEE,
+	0x2942AD5A, 0x7A125D61, 0x3C853703, 0x6FD5C738, 0x02CD99E8, 0x519D69D3, 0x170A03B1, 0x445AF38A,
+	0x2CD99E8B, 0x7F896EB0, 0x391E04D2, 0x6A4EF4E9, 0x0756AA39, 0x54065A02, 0x12913060, 0x41C1C05B,
+	0x7BC7F7EF, 0x289707D4, 0x6E006DB6, 0x3D509D8D, 0x5048C35D, 0x03183366, 0x458F5904, 0x16DFA93F,
+	0x3183366C, 0x62D3C657, 0x2444AC35, 0x77145C0E, 0x1A0C02DE, 0x495CF2E5, 0x0FCB9887, 0x5C9B68BC,
+	0x669D5F08, 0x35CDAF33, 0x735AC551, 0x200A356A, 0x4D126BBA, 0x1E429B81, 0x58D5F1E3, 0x0B8501D8,
+	0x166CCF45, 0x453C3F7E, 0x03AB551C, 0x50FBA527, 0x3DE3FBF7, 0x6EB30BCC, 0x282461AE, 0x7B749195,
+	0x4172A621, 0x1222561A, 0x54B53C78, 0x07E5CC43, 0x6AFD9293, 0x39AD62A8, 0x7F3A08CA, 0x2C6AF8F1,
+	0x0B3667A2, 0x58669799, 0x1EF1FDFB, 0x4DA10DC0, 0x20B95310, 0x73E9A32B, 0x357EC949, 0x662E3972,
+	0x5C280EC6, 0x0F78FEFD, 0x49EF949F, 0x1ABF64A4, 0x77A73A74, 0x24F7CA4F, 0x6260A02D, 0x31305016,
+	// Seed 0x7D
+	0x00000000, 0x2B0CD108, 0x2B71B913, 0x007D681B, 0x2B8B6925, 0x0087B82D, 0x00FAD036, 0x2BF6013E,
+	0x2A7EC949, 0x01721841, 0x010F705A, 0x2A03A152, 0x01F5A06C, 0x2AF97164, 0x2A84197F, 0x0188C877,
+	0x29958991, 0x02995899, 0x02E43082, 0x29E8E18A, 0x021EE0B4, 0x291231BC, 0x296F59A7, 0x026388AF,
+	0x03EB40D8, 0x28E791D0, 0x289AF9CB, 0x039628C3, 0x286029FD, 0x036CF8F5, 0x031190EE, 0x281D41E6,
+	0x2E430821, 0x054FD929, 0x0532B132, 0x2E3E603A, 0x05C86104, 0x2EC4B00C, 0x2EB9D817, 0x05B5091F,
+	0x043DC168, 0x2F311060, 0x2F4C787B, 0x0440A973, 0x2FB6A84D, 0x04BA7945, 0x04C7115E, 0x2FCBC056,
+	0x07D681B0, 0x2CDA50B8, 0x2CA738A3, 0x07ABE9AB, 0x2C5DE895, 0x0751399D, 0x072C5186, 0x2C20808E,
+	0x2DA848F9, 0x06A499F1, 0x06D9F1EA, 0x2DD520E2, 0x062321DC, 0x2D2FF0D4, 0x2D5298CF, 0x065E49C7,
+	0x21EE0B41, 0x0AE2DA49, 0x0A9FB252, 0x2193635A, 0x0A656264, 0x2169B36C, 0x2114DB77, 0x0A180A7F,
+	0x0B90C208, 0x209C1300, 0x20E17B1B, 0x0BEDAA13, 0x201BAB2D, 0x0B177A25, 0x0B6A123E, 0x2066C336,
+	0x087B82D0, 0x237753D8, 0x230A3BC3, 0x0806EACB, 0x23F0EBF5, 0x08FC3AFD, 0x088152E6, 0x238D83EE,
+	0x22054B99, 0x09099A91, 0x0974F28A, 0x22782382, 0x098E22BC, 0x2282F3B4, 0x22FF9BAF, 0x09F34AA7,
+	0x0FAD0360, 0x24A1D268, 0x24DCBA73, 0x0FD06B7B, 0x24266A45, 0x0F2ABB4D, 0x0F57D356, 0x245B025E,
+	0x25D3CA29, 0x0EDF1B21, 0x0EA2733A, 0x25AEA232, 0x0E58A30C, 0x25547204, 0x25291A1F, 0x0E25CB17,
+	0x26388AF1, 0x0D345BF9, 0x0D4933E2, 0x2645E2EA, 0x0DB3E3D4, 0x26BF32DC, 0x26C25AC7, 0x0DCE8BCF,
+	0x0C4643B8, 0x274A92B0, 0x2737FAAB, 0x0C3B2BA3, 0x27CD2A9D, 0x0CC1FB95, 0x0CBC938E, 0x27B04286,
+	0x3EB40D81, 0x15B8DC89, 0x15C5B492, 0x3EC9659A, 0x153F64A4, 0x3E33B5AC, 0x3E4EDDB7, 0x15420CBF,
+	0x14CAC4C8, 0x3FC615C0, 0x3FBB7DDB, 0x14B7ACD3, 0x3F41ADED, 0x144D7CE5, 0x143014FE, 0x3F3CC5F6,
+	0x17218410, 0x3C2D5518, 0x3C503D03, 0x175CEC0B, 0x3CAAED35, 0x17A63C3D, 0x17DB5426, 0x3CD7852E,
+	0x3D5F4D59, 0x16539C51, 0x162EF44A, 0x3D222542, 0x16D4247C, 0x3DD8F574, 0x3DA59D6F, 0x16A94C67,
+	0x10F705A0, 0x3BFBD4A8, 0x3B86BCB3, 0x108A6DBB, 0x3B7C6C85, 0x1070BD8D, 0x100DD596, 0x3B01049E,
+	0x3A89CCE9, 0x11851DE1, 0x11F875FA, 0x3AF4A4F2, 0x1102A5CC, 0x3A0E74C4, 0x3A731CDF, 0x117FCDD7,
+	0x39628C31, 0x126E5D39, 0x12133522, 0x391FE42A, 0x12E9E514, 0x39E5341C, 0x39985C07, 0x12948D0F,
+	0x131C4578, 0x38109470, 0x386DFC6B, 0x13612D63, 0x38972C5D, 0x139BFD55, 0x13E6954E, 0x38EA4446,
+	0x1F5A06C0, 0x3456D7C8, 0x342BBFD3, 0x1F276EDB, 0x34D16FE5, 0x1FDDBEED, 0x1FA0D6F6, 0x34AC07FE,
+	0x3524CF89, 0x1E281E81, 0x1E55769A, 0x3559A792, 0x1EAFA6AC, 0x35A377A4, 0x35DE1FBF, 0x1ED2CEB7,
+	0x36CF8F51, 0x1DC35E59, 0x1DBE3642, 0x36B2E74A, 0x1D44E674, 0x3648377C, 0x36355F67, 0x1D398E6F,
+	0x1CB14618, 0x37BD9710, 0x37C0FF0B, 0x1CCC2E03, 0x373A2F3D, 0x1C36FE35, 0x1C4B962E, 0x37474726,
+	0x31190EE1, 0x1A15DFE9, 0x1A68B7F2, 0x316466FA, 0x1A9267C4, 0x319EB6CC, 0x31E3DED7, 0x1AEF0FDF,
+	0x1B67C7A8, 0x306B16A0, 0x30167EBB, 0x1B1AAFB3, 0x30ECAE8D, 0x1BE07F85, 0x1B9D179E, 0x3091C696,
+	0x188C8770, 0x33805678, 0x33FD3E63, 0x18F1EF6B, 0x3307EE55, 0x180B3F5D, 0x18765746, 0x337A864E,
+	0x32F24E39, 0x19FE9F31, 0x1983F72A, 0x328F2622, 0x1979271C, 0x3275F614, 0x32089E0F, 0x19044F07,
+	// Seed 0x7E
+	0x00000000, 0x7EFBA318, 0xFDF74630, 0x830CE528, 0x94943417, 0xEA6F970F, 0x69637227, 0x1798D13F,
+	0x4652D059, 0x38A97341, 0xBBA59669, 0xC55E3571, 0xD2C6E44E, 0xAC3D4756, 0x2F31A27E, 0x51CA0166,
+	0x8CA5A0B2, 0xF25E03AA, 0x7152E682, 0x0FA9459A, 0x183194A5, 0x66CA37BD, 0xE5C6D295, 0x9B3D718D,
+	0xCAF770EB, 0xB40CD3F3, 0x370036DB, 0x49FB95C3, 0x5E6344FC, 0x2098E7E4, 0xA39402CC, 0xDD6FA1D4,
+	0x7631F913, 0x08CA5A0B, 0x8BC6BF23, 0xF53D1C3B, 0xE2A5CD04, 0x9C5E6E1C, 0x1F528B34, 0x61A9282C,
+	0x3063294A, 0x4E988A52, 0xCD946F7A, 0xB36FCC62, 0xA4F71D5D, 0xDA0CBE45, 0x59005B6D, 0x27FBF875,
+	0xFA9459A1, 0x846FFAB9, 0x07631F91, 0x7998BC89, 0x6E006DB6, 0x10FBCEAE, 0x93F72B86, 0xED0C889E,
+	0xBCC689F8, 0xC23D2AE0, 0x4131CFC8, 0x3FCA6CD0, 0x2852BDEF, 0x56A91EF7, 0xD5A5FBDF, 0xAB5E58C7,
+	0xEC63F226, 0x9298513E, 0x1194B416, 0x6F6F170E, 0x78F7C631, 0x060C6529, 0x85008001, 0xFBFB2319,
+	0xAA31227F, 0xD4CA8167, 0x57C6644F, 0x293DC757, 0x3EA51668, 0x405EB570, 0xC3525058, 0xBDA9F340,
+	0x60C65294, 0x1E3DF18C, 0x9D3114A4, 0xE3CAB7BC, 0xF4526683, 0x8AA9C59B, 0x09A520B3, 0x775E83AB,
+	0x269482CD, 0x586F21D5, 0xDB63C4FD, 0xA59867E5, 0xB200B6DA, 0xCCFB15C2, 0x4FF7F0EA, 0x310C53F2,
+	0x9A520B35, 0xE4A9A82D, 0x67A54D05, 0x195EEE1D, 0x0EC63F22, 0x703D9C3A, 0xF3317912, 0x8DCADA0A,
+	0xDC00DB6C, 0xA2FB7874, 0x21F79D5C, 0x5F0C3E44, 0x4894EF7B, 0x366F4C63, 0xB563A94B, 0xCB980A53,
+	0x16F7AB87, 0x680C089F, 0xEB00EDB7, 0x95FB4EAF, 0x82639F90, 0xFC983C88, 0x7F94D9A0, 0x016F7AB8,
+	0x50A57BDE, 0x2E5ED8C6, 0xAD523DEE, 0xD3A99EF6, 0xC4314FC9, 0xBACAECD1, 0x39C609F9, 0x473DAAE1,
+	0xB7BD5C3B, 0xC946FF23, 0x4A4A1A0B, 0x34B1B913, 0x2329682C, 0x5DD2CB34, 0xDEDE2E1C, 0xA0258D04,
+	0xF1EF8C62, 0x8F142F7A, 0x0C18CA52, 0x72E3694A, 0x657BB875, 0x1B801B6D, 0x988CFE45, 0xE6775D5D,
+	0x3B18FC89, 0x45E35F91, 0xC6EFBAB9, 0xB81419A1, 0xAF8CC89E, 0xD1776B86, 0x527B8EAE, 0x2C802DB6,
+	0x7D4A2CD0, 0x03B18FC8, 0x80BD6AE0, 0xFE46C9F8, 0xE9DE18C7, 0x9725BBDF, 0x14295EF7, 0x6AD2FDEF,
+	0xC18CA528, 0xBF770630, 0x3C7BE318, 0x42804000, 0x5518913F, 0x2BE33227, 0xA8EFD70F, 0xD6147417,
+	0x87DE7571, 0xF925D669, 0x7A293341, 0x04D29059, 0x134A4166, 0x6DB1E27E, 0xEEBD0756, 0x9046A44E,
+	0x4D29059A, 0x33D2A682, 0xB0DE43AA, 0xCE25E0B2, 0xD9BD318D, 0xA7469295, 0x244A77BD, 0x5AB1D4A5,
+	0x0B7BD5C3, 0x758076DB, 0xF68C93F3, 0x887730EB, 0x9FEFE1D4, 0xE11442CC, 0x6218A7E4, 0x1CE304FC,
+	0x5BDEAE1D, 0x25250D05, 0xA629E82D, 0xD8D24B35, 0xCF4A9A0A, 0xB1B13912, 0x32BDDC3A, 0x4C467F22,
+	0x1D8C7E44, 0x6377DD5C, 0xE07B3874, 0x9E809B6C, 0x89184A53, 0xF7E3E94B, 0x74EF0C63, 0x0A14AF7B,
+	0xD77B0EAF, 0xA980ADB7, 0x2A8C489F, 0x5477EB87, 0x43EF3AB8, 0x3D1499A0, 0xBE187C88, 0xC0E3DF90,
+	0x9129DEF6, 0xEFD27DEE, 0x6CDE98C6, 0x12253BDE, 0x05BDEAE1, 0x7B4649F9, 0xF84AACD1, 0x86B10FC9,
+	0x2DEF570E, 0x5314F416, 0xD018113E, 0xAEE3B226, 0xB97B6319, 0xC780C001, 0x448C2529, 0x3A778631,
+	0x6BBD8757, 0x1546244F, 0x964AC167, 0xE8B1627F, 0xFF29B340, 0x81D21058, 0x02DEF570, 0x7C255668,
+	0xA14AF7BC, 0xDFB154A4, 0x5CBDB18C, 0x22461294, 0x35DEC3AB, 0x4B2560B3, 0xC829859B, 0xB6D22683,
+	0xE71827E5, 0x99E384FD, 0x1AEF61D5, 0x6414C2CD, 0x738C13F2, 0x0D77B0EA, 0x8E7B55C2, 0xF080F6DA,
+	// Seed 0x7F
+	0x00000000, 0xC43C22A3, 0x090C9C1D, 0xCD30BEBE, 0x1219383A, 0xD6251A99, 0x1B15A427, 0xDF298684,
+	0x24327074, 0xE00E52D7, 0x2D3EEC69, 0xE902CECA, 0x362B484E, 0xF2176AED, 0x3F27D453, 0xFB1BF6F0,
+	0x4864E0E8, 0x8C58C24B, 0x41687CF5, 0x85545E56, 0x5A7DD8D2, 0x9E41FA71, 0x537144CF, 0x974D666C,
+	0x6C56909C, 0xA86AB23F, 0x655A0C81, 0xA1662E22, 0x7E4FA8A6, 0xBA738A05, 0x774334BB, 0xB37F1618,
+	0x90C9C1D0, 0x54F5E373, 0x99C55DCD, 0x5DF97F6E, 0x82D0F9EA, 0x46ECDB49, 0x8BDC65F7, 0x4FE04754,
+	0xB4FBB1A4, 0x70C79307, 0xBDF72DB9, 0x79CB0F1A, 0xA6E2899E, 0x62DEAB3D, 0xAFEE1583, 0x6BD23720,
+	0xD8AD2138, 0x1C91039B, 0xD1A1BD25, 0x159D9F86, 0xCAB41902, 0x0E883BA1, 0xC3B8851F, 0x0784A7BC,
+	0xFC9F514C, 0x38A373EF, 0xF593CD51, 0x31AFEFF2, 0xEE866976, 0x2ABA4BD5, 0xE78AF56B, 0x23B6D7C8,
+	0xA0E75AFB, 0x64DB7858, 0xA9EBC6E6, 0x6DD7E445, 0xB2FE62C1, 0x76C24062, 0xBBF2FEDC, 0x7FCEDC7F,
+	0x84D52A8F, 0x40E9082C, 0x8DD9B692, 0x49E59431, 0x96CC12B5, 0x52F03016, 0x9FC08EA8, 0x5BFCAC0B,
+	0xE883BA13, 0x2CBF98B0, 0xE18F260E, 0x25B304AD, 0xFA9A8229, 0x3EA6A08A, 0xF3961E34, 0x37AA3C97,
+	0xCCB1CA67, 0x088DE8C4, 0xC5BD567A, 0x018174D9, 0xDEA8F25D, 0x1A94D0FE, 0xD7A46E40, 0x13984CE3,
+	0x302E9B2B, 0xF412B988, 0x39220736, 0xFD1E2595, 0x2237A311, 0xE60B81B2, 0x2B3B3F0C, 0xEF071DAF,
+	0x141CEB5F, 0xD020C9FC, 0x1D107742, 0xD92C55E1, 0x0605D365, 0xC239F1C6, 0x0F094F78, 0xCB356DDB,
+	0x784A7BC3, 0xBC765960, 0x7146E7DE, 0xB57AC57D, 0x6A5343F9, 0xAE6F615A, 0x635FDFE4, 0xA763FD47,
+	0x5C780BB7, 0x98442914, 0x557497AA, 0x9148B509, 0x4E61338D, 0x8A5D112E, 0x476DAF90, 0x83518D33,
+	0xC0BA6CAD, 0x04864E0E, 0xC9B6F0B0, 0x0D8AD213, 0xD2A35497, 0x169F7634, 0xDBAFC88A, 0x1F93EA29,
+	0xE4881CD9, 0x20B43E7A, 0xED8480C4, 0x29B8A267, 0xF69124E3, 0x32AD0640, 0xFF9DB8FE, 0x3BA19A5D,
+	0x88DE8C45, 0x4CE2AEE6, 0x81D21058, 0x45EE32FB, 0x9AC7B47F, 0x5EFB96DC, 0x93CB2862, 0x57F70AC1,
+	0xACECFC31, 0x68D0DE92, 0xA5E0602C, 0x61DC428F, 0xBEF5C40B, 0x7AC9E6A8, 0xB7F95816, 0x73C57AB5,
+	0x5073AD7D, 0x944F8FDE, 0x597F3160, 0x9D4313C3, 0x426A9547, 0x8656B7E4, 0x4B66095A, 0x8F5A2BF9,
+	0x7441DD09, 0xB07DFFAA, 0x7D4D4114, 0xB97163B7, 0x6658E533, 0xA264C790, 0x6F54792E, 0xAB685B8D,
+	0x18174D95, 0xDC2B6F36, 0x111BD188, 0xD527F32B, 0x0A0E75AF, 0xCE32570C, 0x0302E9B2, 0xC73ECB11,
+	0x3C253DE1, 0xF8191F42, 0x3529A1FC, 0xF115835F, 0x2E3C05DB, 0xEA002778, 0x273099C6, 0xE30CBB65,
+	0x605D3656, 0xA46114F5, 0x6951AA4B, 0xAD6D88E8, 0x72440E6C, 0xB6782CCF, 0x7B489271, 0xBF74B0D2,
+	0x446F4622, 0x80536481, 0x4D63DA3F, 0x895FF89C, 0x56767E18, 0x924A5CBB, 0x5F7AE205, 0x9B46C0A6,
+	0x2839D6BE, 0xEC05F41D, 0x21354AA3, 0xE5096800, 0x3A20EE84, 0xFE1CCC27, 0x332C7299, 0xF710503A,
+	0x0C0BA6CA, 0xC8378469, 0x05073AD7, 0xC13B1874, 0x1E129EF0, 0xDA2EBC53, 0x171E02ED, 0xD322204E,
+	0xF094F786, 0x34A8D525, 0xF9986B9B, 0x3DA44938, 0xE28DCFBC, 0x26B1ED1F, 0xEB8153A1, 0x2FBD7102,
+	0xD4A687F2, 0x109AA551, 0xDDAA1BEF, 0x1996394C, 0xC6BFBFC8, 0x02839D6B, 0xCFB323D5, 0x0B8F0176,
+	0xB8F0176E, 0x7CCC35CD, 0xB1FC8B73, 0x75C0A9D0, 0xAAE92F54, 0x6ED50DF7, 0xA3E5B349, 0x67D991EA,
+	0x9CC2671A, 0x58FE45B9, 0x95CEFB07, 0x51F2D9A4, 0x8EDB5F20, 0x4AE77D83, 0x87D7C33D, 0x43EBE19E,
+	// Seed 0x80
+	0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
+	0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
+	0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
+	0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
+	0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172, 0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
+	0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
+	0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
+	0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924, 0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
+	0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
+	0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
+	0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E, 0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
+	0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
+	0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
+	0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0, 0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
+	0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
+	0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
+	0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A, 0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
+	0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
+	0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
+	0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC, 0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
+	0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
+	0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
+	0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236, 0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
+	0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
+	0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
+	0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38, 0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
+	0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
+	0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
+	0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2, 0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
+	0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
+	0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
+	0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D,
+	// Seed 0x81
+	0x00000000, 0xEE530937, 0xE9D97503, 0x078A7C34, 0xE6CD8D6B, 0x089E845C, 0x0F14F868, 0xE147F15F,
+	0xF8E47DBB, 0x16B7748C, 0x113D08B8, 0xFF6E018F, 0x1E29F0D0, 0xF07AF9E7, 0xF7F085D3, 0x19A38CE4,
+	0xC4B79C1B, 0x2AE4952C, 0x2D6EE918, 0xC33DE02F, 0x227A1170, 0xCC291847, 0xCBA36473, 0x25F06D44,
+	0x3C53E1A0, 0xD200E897, 0xD58A94A3, 0x3BD99D94, 0xDA9E6CCB, 0x34CD65FC, 0x334719C8, 0xDD1410FF,
+	0xBC105F5B, 0x5243566C, 0x55C92A58, 0xBB9A236F, 0x5ADDD230, 0xB48EDB07, 0xB304A733, 0x5D57AE04,
+	0x44F422E0, 0xAAA72BD7, 0xAD2D57E3, 0x437E5ED4, 0xA239AF8B, 0x4C6AA6BC, 0x4BE0DA88, 0xA5B3D3BF,
+	0x78A7C340, 0x96F4CA77, 0x917EB643, 0x7F2DBF74, 0x9E6A4E2B, 0x7039471C, 0x77B33B28, 0x99E0321F,
+	0x8043BEFB, 0x6E10B7CC, 0x699ACBF8, 0x87C9C2CF, 0x668E3390, 0x88DD3AA7, 0x8F574693, 0x61044FA4,
+	0x4D5FD9DB, 0xA30CD0EC, 0xA486ACD8, 0x4AD5A5EF, 0xAB9254B0, 0x45C15D87, 0x424B21B3, 0xAC182884,
+	0xB5BBA460, 0x5BE8AD57, 0x5C62D163, 0xB231D854, 0x5376290B, 0xBD25203C, 0xBAAF5C08, 0x54FC553F,
+	0x89E845C0, 0x67BB4CF7, 0x603130C3, 0x8E6239F4, 0x6F25C8AB, 0x8176C19C, 0x86FCBDA8, 0x68AFB49F,
+	0x710C387B, 0x9F5F314C, 0x98D54D78, 0x7686444F, 0x97C1B510, 0x7992BC27, 0x7E18C013, 0x904BC924,
+	0xF14F8680, 0x1F1C8FB7, 0x1896F383, 0xF6C5FAB4, 0x17820BEB, 0xF9D102DC, 0xFE5B7EE8, 0x100877DF,
+	0x09ABFB3B, 0xE7F8F20C, 0xE0728E38, 0x0E21870F, 0xEF667650, 0x01357F67, 0x06BF0353, 0xE8EC0A64,
+	0x35F81A9B, 0xDBAB13AC, 0xDC216F98, 0x327266AF, 0xD33597F0, 0x3D669EC7, 0x3AECE2F3, 0xD4BFEBC4,
+	0xCD1C6720, 0x234F6E17, 0x24C51223, 0xCA961B14, 0x2BD1EA4B, 0xC582E37C, 0xC2089F48, 0x2C5B967F,
+	0x9ABFB3B6, 0x74ECBA81, 0x7366C6B5, 0x9D35CF82, 0x7C723EDD, 0x922137EA, 0x95AB4BDE, 0x7BF842E9,
+	0x625BCE0D, 0x8C08C73A, 0x8B82BB0E, 0x65D1B239, 0x84964366, 0x6AC54A51, 0x6D4F3665, 0x831C3F52,
+	0x5E082FAD, 0xB05B269A, 0xB7D15AAE, 0x59825399, 0xB8C5A2C6, 0x5696ABF1, 0x511CD7C5, 0xBF4FDEF2,
+	0xA6EC5216, 0x48BF5B21, 0x4F352715, 0xA1662E22, 0x4021DF7D, 0xAE72D64A, 0xA9F8AA7E, 0x47ABA349,
+	0x26AFECED, 0xC8FCE5DA, 0xCF7699EE, 0x212590D9, 0xC0626186, 0x2E3168B1, 0x29BB1485, 0xC7E81DB2,
+	0xDE4B9156, 0x30189861, 0x3792E455, 0xD9C1ED62, 0x38861C3D, 0xD6D5150A, 0xD15F693E, 0x3F0C6009,
+	0xE21870F6, 0x0C4B79C1, 0x0BC105F5, 0xE5920CC2, 0x04D5FD9D, 0xEA86F4AA, 0xED0C889E, 0x035F81A9,
+	0x1AFC0D4D, 0xF4AF047A, 0xF325784E, 0x1D767179, 0xFC318026, 0x12628911, 0x15E8F525, 0xFBBBFC12,
+	0xD7E06A6D, 0x39B3635A, 0x3E391F6E, 0xD06A1659, 0x312DE706, 0xDF7EEE31, 0xD8F49205, 0x36A79B32,
+	0x2F0417D6, 0xC1571EE1, 0xC6DD62D5, 0x288E6BE2, 0xC9C99ABD, 0x279A938A, 0x2010EFBE, 0xCE43E689,
+	0x1357F676, 0xFD04FF41, 0xFA8E8375, 0x14DD8A42, 0xF59A7B1D, 0x1BC9722A, 0x1C430E1E, 0xF2100729,
+	0xEBB38BCD, 0x05E082FA, 0x026AFECE, 0xEC39F7F9, 0x0D7E06A6, 0xE32D0F91, 0xE4A773A5, 0x0AF47A92,
+	0x6BF03536, 0x85A33C01, 0x82294035, 0x6C7A4902, 0x8D3DB85D, 0x636EB16A, 0x64E4CD5E, 0x8AB7C469,
+	0x9314488D, 0x7D4741BA, 0x7ACD3D8E, 0x949E34B9, 0x75D9C5E6, 0x9B8ACCD1, 0x9C00B0E5, 0x7253B9D2,
+	0xAF47A92D, 0x4114A01A, 0x469EDC2E, 0xA8CDD519, 0x498A2446, 0xA7D92D71, 0xA0535145, 0x4E005872,
+	0x57A3D496, 0xB9F0DDA1, 0xBE7AA195, 0x5029A8A2, 0xB16E59FD, 0x5F3D50CA, 0x58B72CFE, 0xB6E425C9,
+	// Seed 0x82
+	0x00000000, 0x0191AEA3, 0x03235D46, 0x02B2F3E5, 0x012B7E95, 0x00BAD036, 0x020823D3, 0x03998D70,
+	0x0256FD2A, 0x03C75389, 0x0175A06C, 0x00E40ECF, 0x037D83BF, 0x02EC2D1C, 0x005EDEF9, 0x01CF705A,
+	0x03C03E4D, 0x025190EE, 0x00E3630B, 0x0172CDA8, 0x02EB40D8, 0x037AEE7B, 0x01C81D9E, 0x0059B33D,
+	0x0196C367, 0x00076DC4, 0x02B59E21, 0x03243082, 0x00BDBDF2, 0x012C1351, 0x039EE0B4, 0x020F4E17,
+	0x00EDB883, 0x017C1620, 0x03CEE5C5, 0x025F4B66, 0x01C6C616, 0x005768B5, 0x02E59B50, 0x037435F3,
+	0x02BB45A9, 0x032AEB0A, 0x019818EF, 0x0009B64C, 0x03903B3C, 0x0201959F, 0x00B3667A, 0x0122C8D9,
+	0x032D86CE, 0x02BC286D, 0x000EDB88, 0x019F752B, 0x0206F85B, 0x039756F8, 0x0125A51D, 0x00B40BBE,
+	0x017B7BE4, 0x00EAD547, 0x025826A2, 0x03C98801, 0x00500571, 0x01C1ABD2, 0x03735837, 0x02E2F694,
+	0x01DB7106, 0x004ADFA5, 0x02F82C40, 0x036982E3, 0x00F00F93, 0x0161A130, 0x03D352D5, 0x0242FC76,
+	0x038D8C2C, 0x021C228F, 0x00AED16A, 0x013F7FC9, 0x02A6F2B9, 0x03375C1A, 0x0185AFFF, 0x0014015C,
+	0x021B4F4B, 0x038AE1E8, 0x0138120D, 0x00A9BCAE, 0x033031DE, 0x02A19F7D, 0x00136C98, 0x0182C23B,
+	0x004DB261, 0x01DC1CC2, 0x036EEF27, 0x02FF4184, 0x0166CCF4, 0x00F76257, 0x024591B2, 0x03D43F11,
+	0x0136C985, 0x00A76726, 0x021594C3, 0x03843A60, 0x001DB710, 0x018C19B3, 0x033EEA56, 0x02AF44F5,
+	0x036034AF, 0x02F19A0C, 0x004369E9, 0x01D2C74A, 0x024B4A3A, 0x03DAE499, 0x0168177C, 0x00F9B9DF,
+	0x02F6F7C8, 0x0367596B, 0x01D5AA8E, 0x0044042D, 0x03DD895D, 0x024C27FE, 0x00FED41B, 0x016F7AB8,
+	0x00A00AE2, 0x0131A441, 0x038357A4, 0x0212F907, 0x018B7477, 0x001ADAD4, 0x02A82931, 0x03398792,
+	0x03B6E20C, 0x02274CAF, 0x0095BF4A, 0x010411E9, 0x029D9C99, 0x030C323A, 0x01BEC1DF, 0x002F6F7C,
+	0x01E01F26, 0x0071B185, 0x02C34260, 0x0352ECC3, 0x00CB61B3, 0x015ACF10, 0x03E83CF5, 0x02799256,
+	0x0076DC41, 0x01E772E2, 0x03558107, 0x02C42FA4, 0x015DA2D4, 0x00CC0C77, 0x027EFF92, 0x03EF5131,
+	0x0220216B, 0x03B18FC8, 0x01037C2D, 0x0092D28E, 0x030B5FFE, 0x029AF15D, 0x002802B8, 0x01B9AC1B,
+	0x035B5A8F, 0x02CAF42C, 0x007807C9, 0x01E9A96A, 0x0270241A, 0x03E18AB9, 0x0153795C, 0x00C2D7FF,
+	0x010DA7A5, 0x009C0906, 0x022EFAE3, 0x03BF5440, 0x0026D930, 0x01B77793, 0x03058476, 0x02942AD5,
+	0x009B64C2, 0x010ACA61, 0x03B83984, 0x02299727, 0x01B01A57, 0x0021B4F4, 0x02934711, 0x0302E9B2,
+	0x02CD99E8, 0x035C374B, 0x01EEC4AE, 0x007F6A0D, 0x03E6E77D, 0x027749DE, 0x00C5BA3B, 0x01541498,
+	0x026D930A, 0x03FC3DA9, 0x014ECE4C, 0x00DF60EF, 0x0346ED9F, 0x02D7433C, 0x0065B0D9, 0x01F41E7A,
+	0x003B6E20, 0x01AAC083, 0x03183366, 0x02899DC5, 0x011010B5, 0x0081BE16, 0x02334DF3, 0x03A2E350,
+	0x01ADAD47, 0x003C03E4, 0x028EF001, 0x031F5EA2, 0x0086D3D2, 0x01177D71, 0x03A58E94, 0x02342037,
+	0x03FB506D, 0x026AFECE, 0x00D80D2B, 0x0149A388, 0x02D02EF8, 0x0341805B, 0x01F373BE, 0x0062DD1D,
+	0x02802B89, 0x0311852A, 0x01A376CF, 0x0032D86C, 0x03AB551C, 0x023AFBBF, 0x0088085A, 0x0119A6F9,
+	0x00D6D6A3, 0x01477800, 0x03F58BE5, 0x02642546, 0x01FDA836, 0x006C0695, 0x02DEF570, 0x034F5BD3,
+	0x014015C4, 0x00D1BB67, 0x02634882, 0x03F2E621, 0x006B6B51, 0x01FAC5F2, 0x03483617, 0x02D998B4,
+	0x0316E8EE, 0x0287464D, 0x0035B5A8, 0x01A41B0B, 0x023D967B, 0x03AC38D8, 0x011ECB3D, 0x008F659E,
+	// Seed 0x83
+	0x00000000, 0x243870DA, 0x4870E1B4, 0x6C48916E, 0x7982665D, 0x5DBA1687, 0x31F287E9, 0x15CAF733,
+	0x1A67698F, 0x3E5F1955, 0x5217883B, 0x762FF8E1, 0x63E50FD2, 0x47DD7F08, 0x2B95EE66, 0x0FAD9EBC,
+	0x34CED31E, 0x10F6A3C4, 0x7CBE32AA, 0x58864270, 0x4D4CB543, 0x6974C599, 0x053C54F7, 0x2104242D,
+	0x2EA9BA91, 0x0A91CA4B, 0x66D95B25, 0x42E12BFF, 0x572BDCCC, 0x7313AC16, 0x1F5B3D78, 0x3B634DA2,
+	0x699DA63C, 0x4DA5D6E6, 0x21ED4788, 0x05D53752, 0x101FC061, 0x3427B0BB, 0x586F21D5, 0x7C57510F,
+	0x73FACFB3, 0x57C2BF69, 0x3B8A2E07, 0x1FB25EDD, 0x0A78A9EE, 0x2E40D934, 0x4208485A, 0x66303880,
+	0x5D537522, 0x796B05F8, 0x15239496, 0x311BE44C, 0x24D1137F, 0x00E963A5, 0x6CA1F2CB, 0x48998211,
+	0x47341CAD, 0x630C6C77, 0x0F44FD19, 0x2B7C8DC3, 0x3EB67AF0, 0x1A8E0A2A, 0x76C69B44, 0x52FEEB9E,
+	0x3A58E94D, 0x1E609997, 0x722808F9, 0x56107823, 0x43DA8F10, 0x67E2FFCA, 0x0BAA6EA4, 0x2F921E7E,
+	0x203F80C2, 0x0407F018, 0x684F6176, 0x4C7711AC, 0x59BDE69F, 0x7D859645, 0x11CD072B, 0x35F577F1,
+	0x0E963A53, 0x2AAE4A89, 0x46E6DBE7, 0x62DEAB3D, 0x77145C0E, 0x532C2CD4, 0x3F64BDBA, 0x1B5CCD60,
+	0x14F153DC, 0x30C92306, 0x5C81B268, 0x78B9C2B2, 0x6D733581, 0x494B455B, 0x2503D435, 0x013BA4EF,
+	0x53C54F71, 0x77FD3FAB, 0x1BB5AEC5, 0x3F8DDE1F, 0x2A47292C, 0x0E7F59F6, 0x6237C898, 0x460FB842,
+	0x49A226FE, 0x6D9A5624, 0x01D2C74A, 0x25EAB790, 0x302040A3, 0x14183079, 0x7850A117, 0x5C68D1CD,
+	0x670B9C6F, 0x4333ECB5, 0x2F7B7DDB, 0x0B430D01, 0x1E89FA32, 0x3AB18AE8, 0x56F91B86, 0x72C16B5C,
+	0x7D6CF5E0, 0x5954853A, 0x351C1454, 0x1124648E, 0x04EE93BD, 0x20D6E367, 0x4C9E7209, 0x68A602D3,
+	0x74B1D29A, 0x5089A240, 0x3CC1332E, 0x18F943F4, 0x0D33B4C7, 0x290BC41D, 0x45435573, 0x617B25A9,
+	0x6ED6BB15, 0x4AEECBCF, 0x26A65AA1, 0x029E2A7B, 0x1754DD48, 0x336CAD92, 0x5F243CFC, 0x7B1C4C26,
+	0x407F0184, 0x6447715E, 0x080FE030, 0x2C3790EA, 0x39FD67D9, 0x1DC51703, 0x718D866D, 0x55B5F6B7,
+	0x5A18680B, 0x7E2018D1, 0x126889BF, 0x3650F965, 0x239A0E56, 0x07A27E8C, 0x6BEAEFE2, 0x4FD29F38,
+	0x1D2C74A6, 0x3914047C, 0x555C9512, 0x7164E5C8, 0x64AE12FB, 0x40966221, 0x2CDEF34F, 0x08E68395,
+	0x074B1D29, 0x23736DF3, 0x4F3BFC9D, 0x6B038C47, 0x7EC97B74, 0x5AF10BAE, 0x36B99AC0, 0x1281EA1A,
+	0x29E2A7B8, 0x0DDAD762, 0x6192460C, 0x45AA36D6, 0x5060C1E5, 0x7458B13F, 0x18102051, 0x3C28508B,
+	0x3385CE37, 0x17BDBEED, 0x7BF52F83, 0x5FCD5F59, 0x4A07A86A, 0x6E3FD8B0, 0x027749DE, 0x264F3904,
+	0x4EE93BD7, 0x6AD14B0D, 0x0699DA63, 0x22A1AAB9, 0x376B5D8A, 0x13532D50, 0x7F1BBC3E, 0x5B23CCE4,
+	0x548E5258, 0x70B62282, 0x1CFEB3EC, 0x38C6C336, 0x2D0C3405, 0x093444DF, 0x657CD5B1, 0x4144A56B,
+	0x7A27E8C9, 0x5E1F9813, 0x3257097D, 0x166F79A7, 0x03A58E94, 0x279DFE4E, 0x4BD56F20, 0x6FED1FFA,
+	0x60408146, 0x4478F19C, 0x283060F2, 0x0C081028, 0x19C2E71B, 0x3DFA97C1, 0x51B206AF, 0x758A7675,
+	0x27749DEB, 0x034CED31, 0x6F047C5F, 0x4B3C0C85, 0x5EF6FBB6, 0x7ACE8B6C, 0x16861A02, 0x32BE6AD8,
+	0x3D13F464, 0x192B84BE, 0x756315D0, 0x515B650A, 0x44919239, 0x60A9E2E3, 0x0CE1738D, 0x28D90357,
+	0x13BA4EF5, 0x37823E2F, 0x5BCAAF41, 0x7FF2DF9B, 0x6A3828A8, 0x4E005872, 0x2248C91C, 0x0670B9C6,
+	0x09DD277A, 0x2DE557A0, 0x41ADC6CE, 0x6595B614, 0x705F4127, 0x546731FD, 0x382FA093, 0x1C17D049,
+	// Seed 0x84
+	0x00000000, 0x7EEFA244, 0xFDDF4488, 0x8330E6CC, 0x2E140763, 0x50FBA527, 0xD3CB43EB, 0xAD24E1AF,
+	0x5C280EC6, 0x22C7AC82, 0xA1F74A4E, 0xDF18E80A, 0x723C09A5, 0x0CD3ABE1, 0x8FE34D2D, 0xF10CEF69,
+	0xB8501D8C, 0xC6BFBFC8, 0x458F5904, 0x3B60FB40, 0x96441AEF, 0xE8ABB8AB, 0x6B9B5E67, 0x1574FC23,
+	0xE478134A, 0x9A97B10E, 0x19A757C2, 0x6748F586, 0xCA6C1429, 0xB483B66D, 0x37B350A1, 0x495CF2E5,
+	0xA50AB56B, 0xDBE5172F, 0x58D5F1E3, 0x263A53A7, 0x8B1EB208, 0xF5F1104C, 0x76C1F680, 0x082E54C4,
+	0xF922BBAD, 0x87CD19E9, 0x04FDFF25, 0x7A125D61, 0xD736BCCE, 0xA9D91E8A, 0x2AE9F846, 0x54065A02,
+	0x1D5AA8E7, 0x63B50AA3, 0xE085EC6F, 0x9E6A4E2B, 0x334EAF84, 0x4DA10DC0, 0xCE91EB0C, 0xB07E4948,
+	0x4172A621, 0x3F9D0465, 0xBCADE2A9, 0xC24240ED, 0x6F66A142, 0x11890306, 0x92B9E5CA, 0xEC56478E,
+	0x9FBFE4A5, 0xE15046E1, 0x6260A02D, 0x1C8F0269, 0xB1ABE3C6, 0xCF444182, 0x4C74A74E, 0x329B050A,
+	0xC397EA63, 0xBD784827, 0x3E48AEEB, 0x40A70CAF, 0xED83ED00, 0x936C4F44, 0x105CA988, 0x6EB30BCC,
+	0x27EFF929, 0x59005B6D, 0xDA30BDA1, 0xA4DF1FE5, 0x09FBFE4A, 0x77145C0E, 0xF424BAC2, 0x8ACB1886,
+	0x7BC7F7EF, 0x052855AB, 0x8618B367, 0xF8F71123, 0x55D3F08C, 0x2B3C52C8, 0xA80CB404, 0xD6E31640,
+	0x3AB551CE, 0x445AF38A, 0xC76A1546, 0xB985B702, 0x14A156AD, 0x6A4EF4E9, 0xE97E1225, 0x9791B061,
+	0x669D5F08, 0x1872FD4C, 0x9B421B80, 0xE5ADB9C4, 0x4889586B, 0x3666FA2F, 0xB5561CE3, 0xCBB9BEA7,
+	0x82E54C42, 0xFC0AEE06, 0x7F3A08CA, 0x01D5AA8E, 0xACF14B21, 0xD21EE965, 0x512E0FA9, 0x2FC1ADED,
+	0xDECD4284, 0xA022E0C0, 0x2312060C, 0x5DFDA448, 0xF0D945E7, 0x8E36E7A3, 0x0D06016F, 0x73E9A32B,
+	0xEAD54739, 0x943AE57D, 0x170A03B1, 0x69E5A1F5, 0xC4C1405A, 0xBA2EE21E, 0x391E04D2, 0x47F1A696,
+	0xB6FD49FF, 0xC812EBBB, 0x4B220D77, 0x35CDAF33, 0x98E94E9C, 0xE606ECD8, 0x65360A14, 0x1BD9A850,
+	0x52855AB5, 0x2C6AF8F1, 0xAF5A1E3D, 0xD1B5BC79, 0x7C915DD6, 0x027EFF92, 0x814E195E, 0xFFA1BB1A,
+	0x0EAD5473, 0x7042F637, 0xF37210FB, 0x8D9DB2BF, 0x20B95310, 0x5E56F154, 0xDD661798, 0xA389B5DC,
+	0x4FDFF252, 0x31305016, 0xB200B6DA, 0xCCEF149E, 0x61CBF531, 0x1F245775, 0x9C14B1B9, 0xE2FB13FD,
+	0x13F7FC94, 0x6D185ED0, 0xEE28B81C, 0x90C71A58, 0x3DE3FBF7, 0x430C59B3, 0xC03CBF7F, 0xBED31D3B,
+	0xF78FEFDE, 0x89604D9A, 0x0A50AB56, 0x74BF0912, 0xD99BE8BD, 0xA7744AF9, 0x2444AC35, 0x5AAB0E71,
+	0xABA7E118, 0xD548435C, 0x5678A590, 0x289707D4, 0x85B3E67B, 0xFB5C443F, 0x786CA2F3, 0x068300B7,
+	0x756AA39C, 0x0B8501D8, 0x88B5E714, 0xF65A4550, 0x5B7EA4FF, 0x259106BB, 0xA6A1E077, 0xD84E4233,
+	0x2942AD5A, 0x57AD0F1E, 0xD49DE9D2, 0xAA724B96, 0x0756AA39, 0x79B9087D, 0xFA89EEB1, 0x84664CF5,
+	0xCD3ABE10, 0xB3D51C54, 0x30E5FA98, 0x4E0A58DC, 0xE32EB973, 0x9DC11B37, 0x1EF1FDFB, 0x601E5FBF,
+	0x9112B0D6, 0xEFFD1292, 0x6CCDF45E, 0x1222561A, 0xBF06B7B5, 0xC1E915F1, 0x42D9F33D, 0x3C365179,
+	0xD06016F7, 0xAE8FB4B3, 0x2DBF527F, 0x5350F03B, 0xFE741194, 0x809BB3D0, 0x03AB551C, 0x7D44F758,
+	0x8C481831, 0xF2A7BA75, 0x71975CB9, 0x0F78FEFD, 0xA25C1F52, 0xDCB3BD16, 0x5F835BDA, 0x216CF99E,
+	0x68300B7B, 0x16DFA93F, 0x95EF4FF3, 0xEB00EDB7, 0x46240C18, 0x38CBAE5C, 0xBBFB4890, 0xC514EAD4,
+	0x341805BD, 0x4AF7A7F9, 0xC9C74135, 0xB728E371, 0x1A0C02DE, 0x64E3A09A, 0xE7D34656, 0x993CE412,
+	// Seed 0x85
+	0x00000000, 0x243870DA, 0x4870E1B4, 0x6C48916E, 0x90E1C368, 0xB4D9B3B2, 0xD89122DC, 0xFCA95206,
+	0x1A67698F, 0x3E5F1955, 0x5217883B, 0x762FF8E1, 0x8A86AAE7, 0xAEBEDA3D, 0xC2F64B53, 0xE6CE3B89,
+	0x34CED31E, 0x10F6A3C4, 0x7CBE32AA, 0x58864270, 0xA42F1076, 0x801760AC, 0xEC5FF1C2, 0xC8678118,
+	0x2EA9BA91, 0x0A91CA4B, 0x66D95B25, 0x42E12BFF, 0xBE4879F9, 0x9A700923, 0xF638984D, 0xD200E897,
+	0x699DA63C, 0x4DA5D6E6, 0x21ED4788, 0x05D53752, 0xF97C6554, 0xDD44158E, 0xB10C84E0, 0x9534F43A,
+	0x73FACFB3, 0x57C2BF69, 0x3B8A2E07, 0x1FB25EDD, 0xE31B0CDB, 0xC7237C01, 0xAB6BED6F, 0x8F539DB5,
+	0x5D537522, 0x796B05F8, 0x15239496, 0x311BE44C, 0xCDB2B64A, 0xE98AC690, 0x85C257FE, 0xA1FA2724,
+	0x47341CAD, 0x630C6C77, 0x0F44FD19, 0x2B7C8DC3, 0xD7D5DFC5, 0xF3EDAF1F, 0x9FA53E71, 0xBB9D4EAB,
+	0xD33B4C78, 0xF7033CA2, 0x9B4BADCC, 0xBF73DD16, 0x43DA8F10, 0x67E2FFCA, 0x0BAA6EA4, 0x2F921E7E,
+	0xC95C25F7, 0xED64552D, 0x812CC443, 0xA514B499, 0x59BDE69F, 0x7D859645, 0x11CD072B, 0x35F577F1,
+	0xE7F59F66, 0xC3CDEFBC, 0xAF857ED2, 0x8BBD0E08, 0x77145C0E, 0x532C2CD4, 0x3F64BDBA, 0x1B5CCD60,
+	0xFD92F6E9, 0xD9AA8633, 0xB5E2175D, 0x91DA6787, 0x6D733581, 0x494B455B, 0x2503D435, 0x013BA4EF,
+	0xBAA6EA44, 0x9E9E9A9E, 0xF2D60BF0, 0xD6EE7B2A, 0x2A47292C, 0x0E7F59F6, 0x6237C898, 0x460FB842,
+	0xA0C183CB, 0x84F9F311, 0xE8B1627F, 0xCC8912A5, 0x302040A3, 0x14183079, 0x7850A117, 0x5C68D1CD,
+	0x8E68395A, 0xAA504980, 0xC618D8EE, 0xE220A834, 0x1E89FA32, 0x3AB18AE8, 0x56F91B86, 0x72C16B5C,
+	0x940F50D5, 0xB037200F, 0xDC7FB161, 0xF847C1BB, 0x04EE93BD, 0x20D6E367, 0x4C9E7209, 0x68A602D3,
+	0x9DD277AF, 0xB9EA0775, 0xD5A2961B, 0xF19AE6C1, 0x0D33B4C7, 0x290BC41D, 0x45435573, 0x617B25A9,
+	0x87B51E20, 0xA38D6EFA, 0xCFC5FF94, 0xEBFD8F4E, 0x1754DD48, 0x336CAD92, 0x5F243CFC, 0x7B1C4C26,
+	0xA91CA4B1, 0x8D24D46B, 0xE16C4505, 0xC55435DF, 0x39FD67D9, 0x1DC51703, 0x718D866D, 0x55B5F6B7,
+	0xB37BCD3E, 0x9743BDE4, 0xFB0B2C8A, 0xDF335C50, 0x239A0E56, 0x07A27E8C, 0x6BEAEFE2, 0x4FD29F38,
+	0xF44FD193, 0xD077A149, 0xBC3F3027, 0x980740FD, 0x64AE12FB, 0x40966221, 0x2CDEF34F, 0x08E68395,
+	0xEE28B81C, 0xCA10C8C6, 0xA65859A8, 0x82602972, 0x7EC97B74, 0x5AF10BAE, 0x36B99AC0, 0x1281EA1A,
+	0xC081028D, 0xE4B97257, 0x88F1E339, 0xACC993E3, 0x5060C1E5, 0x7458B13F, 0x18102051, 0x3C28508B,
+	0xDAE66B02, 0xFEDE1BD8, 0x92968AB6, 0xB6AEFA6C, 0x4A07A86A, 0x6E3FD8B0, 0x027749DE, 0x264F3904,
+	0x4EE93BD7, 0x6AD14B0D, 0x0699DA63, 0x22A1AAB9, 0xDE08F8BF, 0xFA308865, 0x9678190B, 0xB24069D1,
+	0x548E5258, 0x70B62282, 0x1CFEB3EC, 0x38C6C336, 0xC46F9130, 0xE057E1EA, 0x8C1F7084, 0xA827005E,
+	0x7A27E8C9, 0x5E1F9813, 0x3257097D, 0x166F79A7, 0xEAC62BA1, 0xCEFE5B7B, 0xA2B6CA15, 0x868EBACF,
+	0x60408146, 0x4478F19C, 0x283060F2, 0x0C081028, 0xF0A1422E, 0xD49932F4, 0xB8D1A39A, 0x9CE9D340,
+	0x27749DEB, 0x034CED31, 0x6F047C5F, 0x4B3C0C85, 0xB7955E83, 0x93AD2E59, 0xFFE5BF37, 0xDBDDCFED,
+	0x3D13F464, 0x192B84BE, 0x756315D0, 0x515B650A, 0xADF2370C, 0x89CA47D6, 0xE582D6B8, 0xC1BAA662,
+	0x13BA4EF5, 0x37823E2F, 0x5BCAAF41, 0x7FF2DF9B, 0x835B8D9D, 0xA763FD47, 0xCB2B6C29, 0xEF131CF3,
+	0x09DD277A, 0x2DE557A0, 0x41ADC6CE, 0x6595B614, 0x993CE412, 0xBD0494C8, 0xD14C05A6, 0xF574757C,
+	// Seed 0x86
+	0x00000000, 0x0191AEA3, 0x03235D46, 0x02B2F3E5, 0x0646BA8C, 0x07D7142F, 0x0565E7CA, 0x04F44969,
+	0x053B3933, 0x04AA9790, 0x06186475, 0x0789CAD6, 0x037D83BF, 0x02EC2D1C, 0x005EDEF9, 0x01CF705A,
+	0x03C03E4D, 0x025190EE, 0x00E3630B, 0x0172CDA8, 0x058684C1, 0x04172A62, 0x06A5D987, 0x07347724,
+	0x06FB077E, 0x076AA9DD, 0x05D85A38, 0x0449F49B, 0x00BDBDF2, 0x012C1351, 0x039EE0B4, 0x020F4E17,
+	0x07807C9A, 0x0611D239, 0x04A321DC, 0x05328F7F, 0x01C6C616, 0x005768B5, 0x02E59B50, 0x037435F3,
+	0x02BB45A9, 0x032AEB0A, 0x019818EF, 0x0009B64C, 0x04FDFF25, 0x056C5186, 0x07DEA263, 0x064F0CC0,
+	0x044042D7, 0x05D1EC74, 0x07631F91, 0x06F2B132, 0x0206F85B, 0x039756F8, 0x0125A51D, 0x00B40BBE,
+	0x017B7BE4, 0x00EAD547, 0x025826A2, 0x03C98801, 0x073DC168, 0x06AC6FCB, 0x041E9C2E, 0x058F328D,
+	0x06B6B51F, 0x07271BBC, 0x0595E859, 0x040446FA, 0x00F00F93, 0x0161A130, 0x03D352D5, 0x0242FC76,
+	0x038D8C2C, 0x021C228F, 0x00AED16A, 0x013F7FC9, 0x05CB36A0, 0x045A9803, 0x06E86BE6, 0x0779C545,
+	0x05768B52, 0x04E725F1, 0x0655D614, 0x07C478B7, 0x033031DE, 0x02A19F7D, 0x00136C98, 0x0182C23B,
+	0x004DB261, 0x01DC1CC2, 0x036EEF27, 0x02FF4184, 0x060B08ED, 0x079AA64E, 0x052855AB, 0x04B9FB08,
+	0x0136C985, 0x00A76726, 0x021594C3, 0x03843A60, 0x07707309, 0x06E1DDAA, 0x04532E4F, 0x05C280EC,
+	0x040DF0B6, 0x059C5E15, 0x072EADF0, 0x06BF0353, 0x024B4A3A, 0x03DAE499, 0x0168177C, 0x00F9B9DF,
+	0x02F6F7C8, 0x0367596B, 0x01D5AA8E, 0x0044042D, 0x04B04D44, 0x0521E3E7, 0x07931002, 0x0602BEA1,
+	0x07CDCEFB, 0x065C6058, 0x04EE93BD, 0x057F3D1E, 0x018B7477, 0x001ADAD4, 0x02A82931, 0x03398792,
+	0x04DB2615, 0x054A88B6, 0x07F87B53, 0x0669D5F0, 0x029D9C99, 0x030C323A, 0x01BEC1DF, 0x002F6F7C,
+	0x01E01F26, 0x0071B185, 0x02C34260, 0x0352ECC3, 0x07A6A5AA, 0x06370B09, 0x0485F8EC, 0x0514564F,
+	0x071B1858, 0x068AB6FB, 0x0438451E, 0x05A9EBBD, 0x015DA2D4, 0x00CC0C77, 0x027EFF92, 0x03EF5131,
+	0x0220216B, 0x03B18FC8, 0x01037C2D, 0x0092D28E, 0x04669BE7, 0x05F73544, 0x0745C6A1, 0x06D46802,
+	0x035B5A8F, 0x02CAF42C, 0x007807C9, 0x01E9A96A, 0x051DE003, 0x048C4EA0, 0x063EBD45, 0x07AF13E6,
+	0x066063BC, 0x07F1CD1F, 0x05433EFA, 0x04D29059, 0x0026D930, 0x01B77793, 0x03058476, 0x02942AD5,
+	0x009B64C2, 0x010ACA61, 0x03B83984, 0x02299727, 0x06DDDE4E, 0x074C70ED, 0x05FE8308, 0x046F2DAB,
+	0x05A05DF1, 0x0431F352, 0x068300B7, 0x0712AE14, 0x03E6E77D, 0x027749DE, 0x00C5BA3B, 0x01541498,
+	0x026D930A, 0x03FC3DA9, 0x014ECE4C, 0x00DF60EF, 0x042B2986, 0x05BA8725, 0x070874C0, 0x0699DA63,
+	0x0756AA39, 0x06C7049A, 0x0475F77F, 0x05E459DC, 0x011010B5, 0x0081BE16, 0x02334DF3, 0x03A2E350,
+	0x01ADAD47, 0x003C03E4, 0x028EF001, 0x031F5EA2, 0x07EB17CB, 0x067AB968, 0x04C84A8D, 0x0559E42E,
+	0x04969474, 0x05073AD7, 0x07B5C932, 0x06246791, 0x02D02EF8, 0x0341805B, 0x01F373BE, 0x0062DD1D,
+	0x05EDEF90, 0x047C4133, 0x06CEB2D6, 0x075F1C75, 0x03AB551C, 0x023AFBBF, 0x0088085A, 0x0119A6F9,
+	0x00D6D6A3, 0x01477800, 0x03F58BE5, 0x02642546, 0x06906C2F, 0x0701C28C, 0x05B33169, 0x04229FCA,
+	0x062DD1DD, 0x07BC7F7E, 0x050E8C9B, 0x049F2238, 0x006B6B51, 0x01FAC5F2, 0x03483617, 0x02D998B4,
+	0x0316E8EE, 0x0287464D, 0x0035B5A8, 0x01A41B0B, 0x05505262, 0x04C1FCC1, 0x06730F24, 0x07E2A187,
+	// Seed 0x87
+	0x00000000, 0x425C960D, 0x6301011D, 0x215D9710, 0x21BA2F3D, 0x63E6B930, 0x42BB2E20, 0x00E7B82D,
+	0x43745E7A, 0x0128C877, 0x20755F67, 0x6229C96A, 0x62CE7147, 0x2092E74A, 0x01CF705A, 0x4393E657,
+	0x615091F3, 0x230C07FE, 0x025190EE, 0x400D06E3, 0x40EABECE, 0x02B628C3, 0x23EBBFD3, 0x61B729DE,
+	0x2224CF89, 0x60785984, 0x4125CE94, 0x03795899, 0x039EE0B4, 0x41C276B9, 0x609FE1A9, 0x22C377A4,
+	0x25190EE1, 0x674598EC, 0x46180FFC, 0x044499F1, 0x04A321DC, 0x46FFB7D1, 0x67A220C1, 0x25FEB6CC,
+	0x666D509B, 0x2431C696, 0x056C5186, 0x4730C78B, 0x47D77FA6, 0x058BE9AB, 0x24D67EBB, 0x668AE8B6,
+	0x44499F12, 0x0615091F, 0x27489E0F, 0x65140802, 0x65F3B02F, 0x27AF2622, 0x06F2B132, 0x44AE273F,
+	0x073DC168, 0x45615765, 0x643CC075, 0x26605678, 0x2687EE55, 0x64DB7858, 0x4586EF48, 0x07DA7945,
+	0x4A321DC2, 0x086E8BCF, 0x29331CDF, 0x6B6F8AD2, 0x6B8832FF, 0x29D4A4F2, 0x088933E2, 0x4AD5A5EF,
+	0x094643B8, 0x4B1AD5B5, 0x6A4742A5, 0x281BD4A8, 0x28FC6C85, 0x6AA0FA88, 0x4BFD6D98, 0x09A1FB95,
+	0x2B628C31, 0x693E1A3C, 0x48638D2C, 0x0A3F1B21, 0x0AD8A30C, 0x48843501, 0x69D9A211, 0x2B85341C,
+	0x6816D24B, 0x2A4A4446, 0x0B17D356, 0x494B455B, 0x49ACFD76, 0x0BF06B7B, 0x2AADFC6B, 0x68F16A66,
+	0x6F2B1323, 0x2D77852E, 0x0C2A123E, 0x4E768433, 0x4E913C1E, 0x0CCDAA13, 0x2D903D03, 0x6FCCAB0E,
+	0x2C5F4D59, 0x6E03DB54, 0x4F5E4C44, 0x0D02DA49, 0x0DE56264, 0x4FB9F469, 0x6EE46379, 0x2CB8F574,
+	0x0E7B82D0, 0x4C2714DD, 0x6D7A83CD, 0x2F2615C0, 0x2FC1ADED, 0x6D9D3BE0, 0x4CC0ACF0, 0x0E9C3AFD,
+	0x4D0FDCAA, 0x0F534AA7, 0x2E0EDDB7, 0x6C524BBA, 0x6CB5F397, 0x2EE9659A, 0x0FB4F28A, 0x4DE86487,
+	0x73DC1683, 0x3180808E, 0x10DD179E, 0x52818193, 0x526639BE, 0x103AAFB3, 0x316738A3, 0x733BAEAE,
+	0x30A848F9, 0x72F4DEF4, 0x53A949E4, 0x11F5DFE9, 0x111267C4, 0x534EF1C9, 0x721366D9, 0x304FF0D4,
+	0x128C8770, 0x50D0117D, 0x718D866D, 0x33D11060, 0x3336A84D, 0x716A3E40, 0x5037A950, 0x126B3F5D,
+	0x51F8D90A, 0x13A44F07, 0x32F9D817, 0x70A54E1A, 0x7042F637, 0x321E603A, 0x1343F72A, 0x511F6127,
+	0x56C51862, 0x14998E6F, 0x35C4197F, 0x77988F72, 0x777F375F, 0x3523A152, 0x147E3642, 0x5622A04F,
+	0x15B14618, 0x57EDD015, 0x76B04705, 0x34ECD108, 0x340B6925, 0x7657FF28, 0x570A6838, 0x1556FE35,
+	0x37958991, 0x75C91F9C, 0x5494888C, 0x16C81E81, 0x162FA6AC, 0x547330A1, 0x752EA7B1, 0x377231BC,
+	0x74E1D7EB, 0x36BD41E6, 0x17E0D6F6, 0x55BC40FB, 0x555BF8D6, 0x17076EDB, 0x365AF9CB, 0x74066FC6,
+	0x39EE0B41, 0x7BB29D4C, 0x5AEF0A5C, 0x18B39C51, 0x1854247C, 0x5A08B271, 0x7B552561, 0x3909B36C,
+	0x7A9A553B, 0x38C6C336, 0x199B5426, 0x5BC7C22B, 0x5B207A06, 0x197CEC0B, 0x38217B1B, 0x7A7DED16,
+	0x58BE9AB2, 0x1AE20CBF, 0x3BBF9BAF, 0x79E30DA2, 0x7904B58F, 0x3B582382, 0x1A05B492, 0x5859229F,
+	0x1BCAC4C8, 0x599652C5, 0x78CBC5D5, 0x3A9753D8, 0x3A70EBF5, 0x782C7DF8, 0x5971EAE8, 0x1B2D7CE5,
+	0x1CF705A0, 0x5EAB93AD, 0x7FF604BD, 0x3DAA92B0, 0x3D4D2A9D, 0x7F11BC90, 0x5E4C2B80, 0x1C10BD8D,
+	0x5F835BDA, 0x1DDFCDD7, 0x3C825AC7, 0x7EDECCCA, 0x7E3974E7, 0x3C65E2EA, 0x1D3875FA, 0x5F64E3F7,
+	0x7DA79453, 0x3FFB025E, 0x1EA6954E, 0x5CFA0343, 0x5C1DBB6E, 0x1E412D63, 0x3F1CBA73, 0x7D402C7E,
+	0x3ED3CA29, 0x7C8F5C24, 0x5DD2CB34, 0x1F8E5D39, 0x1F69E514, 0x5D357319, 0x7C68E409, 0x3E347204,
+	// Seed 0x88
+	0x00000000, 0x53D8F861, 0xA7B1F0C2, 0xF46908A3, 0x89A5F7A1, 0xDA7D0FC0, 0x2E140763, 0x7DCCFF02,
+	0xD58DF967, 0x86550106, 0x723C09A5, 0x21E4F1C4, 0x5C280EC6, 0x0FF0F6A7, 0xFB99FE04, 0xA8410665,
+	0x6DDDE4EB, 0x3E051C8A, 0xCA6C1429, 0x99B4EC48, 0xE478134A, 0xB7A0EB2B, 0x43C9E388, 0x10111BE9,
+	0xB8501D8C, 0xEB88E5ED, 0x1FE1ED4E, 0x4C39152F, 0x31F5EA2D, 0x622D124C, 0x96441AEF, 0xC59CE28E,
+	0xDBBBC9D6, 0x886331B7, 0x7C0A3914, 0x2FD2C175, 0x521E3E77, 0x01C6C616, 0xF5AFCEB5, 0xA67736D4,
+	0x0E3630B1, 0x5DEEC8D0, 0xA987C073, 0xFA5F3812, 0x8793C710, 0xD44B3F71, 0x202237D2, 0x73FACFB3,
+	0xB6662D3D, 0xE5BED55C, 0x11D7DDFF, 0x420F259E, 0x3FC3DA9C, 0x6C1B22FD, 0x98722A5E, 0xCBAAD23F,
+	0x63EBD45A, 0x30332C3B, 0xC45A2498, 0x9782DCF9, 0xEA4E23FB, 0xB996DB9A, 0x4DFFD339, 0x1E272B58,
+	0x71B18589, 0x22697DE8, 0xD600754B, 0x85D88D2A, 0xF8147228, 0xABCC8A49, 0x5FA582EA, 0x0C7D7A8B,
+	0xA43C7CEE, 0xF7E4848F, 0x038D8C2C, 0x5055744D, 0x2D998B4F, 0x7E41732E, 0x8A287B8D, 0xD9F083EC,
+	0x1C6C6162, 0x4FB49903, 0xBBDD91A0, 0xE80569C1, 0x95C996C3, 0xC6116EA2, 0x32786601, 0x61A09E60,
+	0xC9E19805, 0x9A396064, 0x6E5068C7, 0x3D8890A6, 0x40446FA4, 0x139C97C5, 0xE7F59F66, 0xB42D6707,
+	0xAA0A4C5F, 0xF9D2B43E, 0x0DBBBC9D, 0x5E6344FC, 0x23AFBBFE, 0x7077439F, 0x841E4B3C, 0xD7C6B35D,
+	0x7F87B538, 0x2C5F4D59, 0xD83645FA, 0x8BEEBD9B, 0xF6224299, 0xA5FABAF8, 0x5193B25B, 0x024B4A3A,
+	0xC7D7A8B4, 0x940F50D5, 0x60665876, 0x33BEA017, 0x4E725F15, 0x1DAAA774, 0xE9C3AFD7, 0xBA1B57B6,
+	0x125A51D3, 0x4182A9B2, 0xB5EBA111, 0xE6335970, 0x9BFFA672, 0xC8275E13, 0x3C4E56B0, 0x6F96AED1,
+	0xE3630B12, 0xB0BBF373, 0x44D2FBD0, 0x170A03B1, 0x6AC6FCB3, 0x391E04D2, 0xCD770C71, 0x9EAFF410,
+	0x36EEF275, 0x65360A14, 0x915F02B7, 0xC287FAD6, 0xBF4B05D4, 0xEC93FDB5, 0x18FAF516, 0x4B220D77,
+	0x8EBEEFF9, 0xDD661798, 0x290F1F3B, 0x7AD7E75A, 0x071B1858, 0x54C3E039, 0xA0AAE89A, 0xF37210FB,
+	0x5B33169E, 0x08EBEEFF, 0xFC82E65C, 0xAF5A1E3D, 0xD296E13F, 0x814E195E, 0x752711FD, 0x26FFE99C,
+	0x38D8C2C4, 0x6B003AA5, 0x9F693206, 0xCCB1CA67, 0xB17D3565, 0xE2A5CD04, 0x16CCC5A7, 0x45143DC6,
+	0xED553BA3, 0xBE8DC3C2, 0x4AE4CB61, 0x193C3300, 0x64F0CC02, 0x37283463, 0xC3413CC0, 0x9099C4A1,
+	0x5505262F, 0x06DDDE4E, 0xF2B4D6ED, 0xA16C2E8C, 0xDCA0D18E, 0x8F7829EF, 0x7B11214C, 0x28C9D92D,
+	0x8088DF48, 0xD3502729, 0x27392F8A, 0x74E1D7EB, 0x092D28E9, 0x5AF5D088, 0xAE9CD82B, 0xFD44204A,
+	0x92D28E9B, 0xC10A76FA, 0x35637E59, 0x66BB8638, 0x1B77793A, 0x48AF815B, 0xBCC689F8, 0xEF1E7199,
+	0x475F77FC, 0x14878F9D, 0xE0EE873E, 0xB3367F5F, 0xCEFA805D, 0x9D22783C, 0x694B709F, 0x3A9388FE,
+	0xFF0F6A70, 0xACD79211, 0x58BE9AB2, 0x0B6662D3, 0x76AA9DD1, 0x257265B0, 0xD11B6D13, 0x82C39572,
+	0x2A829317, 0x795A6B76, 0x8D3363D5, 0xDEEB9BB4, 0xA32764B6, 0xF0FF9CD7, 0x04969474, 0x574E6C15,
+	0x4969474D, 0x1AB1BF2C, 0xEED8B78F, 0xBD004FEE, 0xC0CCB0EC, 0x9314488D, 0x677D402E, 0x34A5B84F,
+	0x9CE4BE2A, 0xCF3C464B, 0x3B554EE8, 0x688DB689, 0x1541498B, 0x4699B1EA, 0xB2F0B949, 0xE1284128,
+	0x24B4A3A6, 0x776C5BC7, 0x83055364, 0xD0DDAB05, 0xAD115407, 0xFEC9AC66, 0x0AA0A4C5, 0x59785CA4,
+	0xF1395AC1, 0xA2E1A2A0, 0x5688AA03, 0x05505262, 0x789CAD60, 0x2B445501, 0xDF2D5DA2, 0x8CF5A5C3,
+	// Seed 0x89
+	0x00000000, 0x425C960D, 0x84B92C1A, 0xC6E5BA17, 0x21BA2F3D, 0x63E6B930, 0xA5030327, 0xE75F952A,
+	0x43745E7A, 0x0128C877, 0xC7CD7260, 0x8591E46D, 0x62CE7147, 0x2092E74A, 0xE6775D5D, 0xA42BCB50,
+	0x86E8BCF4, 0xC4B42AF9, 0x025190EE, 0x400D06E3, 0xA75293C9, 0xE50E05C4, 0x23EBBFD3, 0x61B729DE,
+	0xC59CE28E, 0x87C07483, 0x4125CE94, 0x03795899, 0xE426CDB3, 0xA67A5BBE, 0x609FE1A9, 0x22C377A4,
+	0x25190EE1, 0x674598EC, 0xA1A022FB, 0xE3FCB4F6, 0x04A321DC, 0x46FFB7D1, 0x801A0DC6, 0xC2469BCB,
+	0x666D509B, 0x2431C696, 0xE2D47C81, 0xA088EA8C, 0x47D77FA6, 0x058BE9AB, 0xC36E53BC, 0x8132C5B1,
+	0xA3F1B215, 0xE1AD2418, 0x27489E0F, 0x65140802, 0x824B9D28, 0xC0170B25, 0x06F2B132, 0x44AE273F,
+	0xE085EC6F, 0xA2D97A62, 0x643CC075, 0x26605678, 0xC13FC352, 0x8363555F, 0x4586EF48, 0x07DA7945,
+	0x4A321DC2, 0x086E8BCF, 0xCE8B31D8, 0x8CD7A7D5, 0x6B8832FF, 0x29D4A4F2, 0xEF311EE5, 0xAD6D88E8,
+	0x094643B8, 0x4B1AD5B5, 0x8DFF6FA2, 0xCFA3F9AF, 0x28FC6C85, 0x6AA0FA88, 0xAC45409F, 0xEE19D692,
+	0xCCDAA136, 0x8E86373B, 0x48638D2C, 0x0A3F1B21, 0xED608E0B, 0xAF3C1806, 0x69D9A211, 0x2B85341C,
+	0x8FAEFF4C, 0xCDF26941, 0x0B17D356, 0x494B455B, 0xAE14D071, 0xEC48467C, 0x2AADFC6B, 0x68F16A66,
+	0x6F2B1323, 0x2D77852E, 0xEB923F39, 0xA9CEA934, 0x4E913C1E, 0x0CCDAA13, 0xCA281004, 0x88748609,
+	0x2C5F4D59, 0x6E03DB54, 0xA8E66143, 0xEABAF74E, 0x0DE56264, 0x4FB9F469, 0x895C4E7E, 0xCB00D873,
+	0xE9C3AFD7, 0xAB9F39DA, 0x6D7A83CD, 0x2F2615C0, 0xC87980EA, 0x8A2516E7, 0x4CC0ACF0, 0x0E9C3AFD,
+	0xAAB7F1AD, 0xE8EB67A0, 0x2E0EDDB7, 0x6C524BBA, 0x8B0DDE90, 0xC951489D, 0x0FB4F28A, 0x4DE86487,
+	0x94643B84, 0xD638AD89, 0x10DD179E, 0x52818193, 0xB5DE14B9, 0xF78282B4, 0x316738A3, 0x733BAEAE,
+	0xD71065FE, 0x954CF3F3, 0x53A949E4, 0x11F5DFE9, 0xF6AA4AC3, 0xB4F6DCCE, 0x721366D9, 0x304FF0D4,
+	0x128C8770, 0x50D0117D, 0x9635AB6A, 0xD4693D67, 0x3336A84D, 0x716A3E40, 0xB78F8457, 0xF5D3125A,
+	0x51F8D90A, 0x13A44F07, 0xD541F510, 0x971D631D, 0x7042F637, 0x321E603A, 0xF4FBDA2D, 0xB6A74C20,
+	0xB17D3565, 0xF321A368, 0x35C4197F, 0x77988F72, 0x90C71A58, 0xD29B8C55, 0x147E3642, 0x5622A04F,
+	0xF2096B1F, 0xB055FD12, 0x76B04705, 0x34ECD108, 0xD3B34422, 0x91EFD22F, 0x570A6838, 0x1556FE35,
+	0x37958991, 0x75C91F9C, 0xB32CA58B, 0xF1703386, 0x162FA6AC, 0x547330A1, 0x92968AB6, 0xD0CA1CBB,
+	0x74E1D7EB, 0x36BD41E6, 0xF058FBF1, 0xB2046DFC, 0x555BF8D6, 0x17076EDB, 0xD1E2D4CC, 0x93BE42C1,
+	0xDE562646, 0x9C0AB04B, 0x5AEF0A5C, 0x18B39C51, 0xFFEC097B, 0xBDB09F76, 0x7B552561, 0x3909B36C,
+	0x9D22783C, 0xDF7EEE31, 0x199B5426, 0x5BC7C22B, 0xBC985701, 0xFEC4C10C, 0x38217B1B, 0x7A7DED16,
+	0x58BE9AB2, 0x1AE20CBF, 0xDC07B6A8, 0x9E5B20A5, 0x7904B58F, 0x3B582382, 0xFDBD9995, 0xBFE10F98,
+	0x1BCAC4C8, 0x599652C5, 0x9F73E8D2, 0xDD2F7EDF, 0x3A70EBF5, 0x782C7DF8, 0xBEC9C7EF, 0xFC9551E2,
+	0xFB4F28A7, 0xB913BEAA, 0x7FF604BD, 0x3DAA92B0, 0xDAF5079A, 0x98A99197, 0x5E4C2B80, 0x1C10BD8D,
+	0xB83B76DD, 0xFA67E0D0, 0x3C825AC7, 0x7EDECCCA, 0x998159E0, 0xDBDDCFED, 0x1D3875FA, 0x5F64E3F7,
+	0x7DA79453, 0x3FFB025E, 0xF91EB849, 0xBB422E44, 0x5C1DBB6E, 0x1E412D63, 0xD8A49774, 0x9AF80179,
+	0x3ED3CA29, 0x7C8F5C24, 0xBA6AE633, 0xF836703E, 0x1F69E514, 0x5D357319, 0x9BD0C90E, 0xD98C5F03,
+	// Seed 0x8A
+	0x00000000, 0x0827E288, 0x0A95116D, 0x02B2F3E5, 0x0FF0F6A7, 0x07D7142F, 0x0565E7CA, 0x0D420542,
+	0x053B3933, 0x0D1CDBBB, 0x0FAE285E, 0x0789CAD6, 0x0ACBCF94, 0x02EC2D1C, 0x005EDEF9, 0x08793C71,
+	0x0A767266, 0x025190EE, 0x00E3630B, 0x08C48183, 0x058684C1, 0x0DA16649, 0x0F1395AC, 0x07347724,
+	0x0F4D4B55, 0x076AA9DD, 0x05D85A38, 0x0DFFB8B0, 0x00BDBDF2, 0x089A5F7A, 0x0A28AC9F, 0x020F4E17,
+	0x0E3630B1, 0x0611D239, 0x04A321DC, 0x0C84C354, 0x01C6C616, 0x09E1249E, 0x0B53D77B, 0x037435F3,
+	0x0B0D0982, 0x032AEB0A, 0x019818EF, 0x09BFFA67, 0x04FDFF25, 0x0CDA1DAD, 0x0E68EE48, 0x064F0CC0,
+	0x044042D7, 0x0C67A05F, 0x0ED553BA, 0x06F2B132, 0x0BB0B470, 0x039756F8, 0x0125A51D, 0x09024795,
+	0x017B7BE4, 0x095C996C, 0x0BEE6A89, 0x03C98801, 0x0E8B8D43, 0x06AC6FCB, 0x041E9C2E, 0x0C397EA6,
+	0x06B6B51F, 0x0E915797, 0x0C23A472, 0x040446FA, 0x094643B8, 0x0161A130, 0x03D352D5, 0x0BF4B05D,
+	0x038D8C2C, 0x0BAA6EA4, 0x09189D41, 0x013F7FC9, 0x0C7D7A8B, 0x045A9803, 0x06E86BE6, 0x0ECF896E,
+	0x0CC0C779, 0x04E725F1, 0x0655D614, 0x0E72349C, 0x033031DE, 0x0B17D356, 0x09A520B3, 0x0182C23B,
+	0x09FBFE4A, 0x01DC1CC2, 0x036EEF27, 0x0B490DAF, 0x060B08ED, 0x0E2CEA65, 0x0C9E1980, 0x04B9FB08,
+	0x088085AE, 0x00A76726, 0x021594C3, 0x0A32764B, 0x07707309, 0x0F579181, 0x0DE56264, 0x05C280EC,
+	0x0DBBBC9D, 0x059C5E15, 0x072EADF0, 0x0F094F78, 0x024B4A3A, 0x0A6CA8B2, 0x08DE5B57, 0x00F9B9DF,
+	0x02F6F7C8, 0x0AD11540, 0x0863E6A5, 0x0044042D, 0x0D06016F, 0x0521E3E7, 0x07931002, 0x0FB4F28A,
+	0x07CDCEFB, 0x0FEA2C73, 0x0D58DF96, 0x057F3D1E, 0x083D385C, 0x001ADAD4, 0x02A82931, 0x0A8FCBB9,
+	0x0D6D6A3E, 0x054A88B6, 0x07F87B53, 0x0FDF99DB, 0x029D9C99, 0x0ABA7E11, 0x08088DF4, 0x002F6F7C,
+	0x0856530D, 0x0071B185, 0x02C34260, 0x0AE4A0E8, 0x07A6A5AA, 0x0F814722, 0x0D33B4C7, 0x0514564F,
+	0x071B1858, 0x0F3CFAD0, 0x0D8E0935, 0x05A9EBBD, 0x08EBEEFF, 0x00CC0C77, 0x027EFF92, 0x0A591D1A,
+	0x0220216B, 0x0A07C3E3, 0x08B53006, 0x0092D28E, 0x0DD0D7CC, 0x05F73544, 0x0745C6A1, 0x0F622429,
+	0x035B5A8F, 0x0B7CB807, 0x09CE4BE2, 0x01E9A96A, 0x0CABAC28, 0x048C4EA0, 0x063EBD45, 0x0E195FCD,
+	0x066063BC, 0x0E478134, 0x0CF572D1, 0x04D29059, 0x0990951B, 0x01B77793, 0x03058476, 0x0B2266FE,
+	0x092D28E9, 0x010ACA61, 0x03B83984, 0x0B9FDB0C, 0x06DDDE4E, 0x0EFA3CC6, 0x0C48CF23, 0x046F2DAB,
+	0x0C1611DA, 0x0431F352, 0x068300B7, 0x0EA4E23F, 0x03E6E77D, 0x0BC105F5, 0x0973F610, 0x01541498,
+	0x0BDBDF21, 0x03FC3DA9, 0x014ECE4C, 0x09692CC4, 0x042B2986, 0x0C0CCB0E, 0x0EBE38EB, 0x0699DA63,
+	0x0EE0E612, 0x06C7049A, 0x0475F77F, 0x0C5215F7, 0x011010B5, 0x0937F23D, 0x0B8501D8, 0x03A2E350,
+	0x01ADAD47, 0x098A4FCF, 0x0B38BC2A, 0x031F5EA2, 0x0E5D5BE0, 0x067AB968, 0x04C84A8D, 0x0CEFA805,
+	0x04969474, 0x0CB176FC, 0x0E038519, 0x06246791, 0x0B6662D3, 0x0341805B, 0x01F373BE, 0x09D49136,
+	0x05EDEF90, 0x0DCA0D18, 0x0F78FEFD, 0x075F1C75, 0x0A1D1937, 0x023AFBBF, 0x0088085A, 0x08AFEAD2,
+	0x00D6D6A3, 0x08F1342B, 0x0A43C7CE, 0x02642546, 0x0F262004, 0x0701C28C, 0x05B33169, 0x0D94D3E1,
+	0x0F9B9DF6, 0x07BC7F7E, 0x050E8C9B, 0x0D296E13, 0x006B6B51, 0x084C89D9, 0x0AFE7A3C, 0x02D998B4,
+	0x0AA0A4C5, 0x0287464D, 0x0035B5A8, 0x08125720, 0x05505262, 0x0D77B0EA, 0x0FC5430F, 0x07E2A187,
+	// Seed 0x8B
+	0x00000000, 0x328CB2B4, 0x65196568, 0x5795D7DC, 0x3EE67F81, 0x0C6ACD35, 0x5BFF1AE9, 0x6973A85D,
+	0x7DCCFF02, 0x4F404DB6, 0x18D59A6A, 0x2A5928DE, 0x432A8083, 0x71A63237, 0x2633E5EB, 0x14BF575F,
+	0x0F4D4B55, 0x3DC1F9E1, 0x6A542E3D, 0x58D89C89, 0x31AB34D4, 0x03278660, 0x54B251BC, 0x663EE308,
+	0x7281B457, 0x400D06E3, 0x1798D13F, 0x2514638B, 0x4C67CBD6, 0x7EEB7962, 0x297EAEBE, 0x1BF21C0A,
+	0x1E9A96AA, 0x2C16241E, 0x7B83F3C2, 0x490F4176, 0x207CE92B, 0x12F05B9F, 0x45658C43, 0x77E93EF7,
+	0x635669A8, 0x51DADB1C, 0x064F0CC0, 0x34C3BE74, 0x5DB01629, 0x6F3CA49D, 0x38A97341, 0x0A25C1F5,
+	0x11D7DDFF, 0x235B6F4B, 0x74CEB897, 0x46420A23, 0x2F31A27E, 0x1DBD10CA, 0x4A28C716, 0x78A475A2,
+	0x6C1B22FD, 0x5E979049, 0x09024795, 0x3B8EF521, 0x52FD5D7C, 0x6071EFC8, 0x37E43814, 0x05688AA0,
+	0x3D352D54, 0x0FB99FE0, 0x582C483C, 0x6AA0FA88, 0x03D352D5, 0x315FE061, 0x66CA37BD, 0x54468509,
+	0x40F9D256, 0x727560E2, 0x25E0B73E, 0x176C058A, 0x7E1FADD7, 0x4C931F63, 0x1B06C8BF, 0x298A7A0B,
+	0x32786601, 0x00F4D4B5, 0x57610369, 0x65EDB1DD, 0x0C9E1980, 0x3E12AB34, 0x69877CE8, 0x5B0BCE5C,
+	0x4FB49903, 0x7D382BB7, 0x2AADFC6B, 0x18214EDF, 0x7152E682, 0x43DE5436, 0x144B83EA, 0x26C7315E,
+	0x23AFBBFE, 0x1123094A, 0x46B6DE96, 0x743A6C22, 0x1D49C47F, 0x2FC576CB, 0x7850A117, 0x4ADC13A3,
+	0x5E6344FC, 0x6CEFF648, 0x3B7A2194, 0x09F69320, 0x60853B7D, 0x520989C9, 0x059C5E15, 0x3710ECA1,
+	0x2CE2F0AB, 0x1E6E421F, 0x49FB95C3, 0x7B772777, 0x12048F2A, 0x20883D9E, 0x771DEA42, 0x459158F6,
+	0x512E0FA9, 0x63A2BD1D, 0x34376AC1, 0x06BBD875, 0x6FC87028, 0x5D44C29C, 0x0AD11540, 0x385DA7F4,
+	0x7A6A5AA8, 0x48E6E81C, 0x1F733FC0, 0x2DFF8D74, 0x448C2529, 0x7600979D, 0x21954041, 0x1319F2F5,
+	0x07A6A5AA, 0x352A171E, 0x62BFC0C2, 0x50337276, 0x3940DA2B, 0x0BCC689F, 0x5C59BF43, 0x6ED50DF7,
+	0x752711FD, 0x47ABA349, 0x103E7495, 0x22B2C621, 0x4BC16E7C, 0x794DDCC8, 0x2ED80B14, 0x1C54B9A0,
+	0x08EBEEFF, 0x3A675C4B, 0x6DF28B97, 0x5F7E3923, 0x360D917E, 0x048123CA, 0x5314F416, 0x619846A2,
+	0x64F0CC02, 0x567C7EB6, 0x01E9A96A, 0x33651BDE, 0x5A16B383, 0x689A0137, 0x3F0FD6EB, 0x0D83645F,
+	0x193C3300, 0x2BB081B4, 0x7C255668, 0x4EA9E4DC, 0x27DA4C81, 0x1556FE35, 0x42C329E9, 0x704F9B5D,
+	0x6BBD8757, 0x593135E3, 0x0EA4E23F, 0x3C28508B, 0x555BF8D6, 0x67D74A62, 0x30429DBE, 0x02CE2F0A,
+	0x16717855, 0x24FDCAE1, 0x73681D3D, 0x41E4AF89, 0x289707D4, 0x1A1BB560, 0x4D8E62BC, 0x7F02D008,
+	0x475F77FC, 0x75D3C548, 0x22461294, 0x10CAA020, 0x79B9087D, 0x4B35BAC9, 0x1CA06D15, 0x2E2CDFA1,
+	0x3A9388FE, 0x081F3A4A, 0x5F8AED96, 0x6D065F22, 0x0475F77F, 0x36F945CB, 0x616C9217, 0x53E020A3,
+	0x48123CA9, 0x7A9E8E1D, 0x2D0B59C1, 0x1F87EB75, 0x76F44328, 0x4478F19C, 0x13ED2640, 0x216194F4,
+	0x35DEC3AB, 0x0752711F, 0x50C7A6C3, 0x624B1477, 0x0B38BC2A, 0x39B40E9E, 0x6E21D942, 0x5CAD6BF6,
+	0x59C5E156, 0x6B4953E2, 0x3CDC843E, 0x0E50368A, 0x67239ED7, 0x55AF2C63, 0x023AFBBF, 0x30B6490B,
+	0x24091E54, 0x1685ACE0, 0x41107B3C, 0x739CC988, 0x1AEF61D5, 0x2863D361, 0x7FF604BD, 0x4D7AB609,
+	0x5688AA03, 0x640418B7, 0x3391CF6B, 0x011D7DDF, 0x686ED582, 0x5AE26736, 0x0D77B0EA, 0x3FFB025E,
+	0x2B445501, 0x19C8E7B5, 0x4E5D3069, 0x7CD182DD, 0x15A22A80, 0x272E9834, 0x70BB4FE8, 0x4237FD5C,
+	// Seed 0x8C
+	0x00000000, 0xE8160559, 0x183194A5, 0xF02791FC, 0x3063294A, 0xD8752C13, 0x2852BDEF, 0xC044B8B6,
+	0x60C65294, 0x88D057CD, 0x78F7C631, 0x90E1C368, 0x50A57BDE, 0xB8B37E87, 0x4894EF7B, 0xA082EA22,
+	0xC18CA528, 0x299AA071, 0xD9BD318D, 0x31AB34D4, 0xF1EF8C62, 0x19F9893B, 0xE9DE18C7, 0x01C81D9E,
+	0xA14AF7BC, 0x495CF2E5, 0xB97B6319, 0x516D6640, 0x9129DEF6, 0x793FDBAF, 0x89184A53, 0x610E4F0A,
+	0x4B04D447, 0xA312D11E, 0x533540E2, 0xBB2345BB, 0x7B67FD0D, 0x9371F854, 0x635669A8, 0x8B406CF1,
+	0x2BC286D3, 0xC3D4838A, 0x33F31276, 0xDBE5172F, 0x1BA1AF99, 0xF3B7AAC0, 0x03903B3C, 0xEB863E65,
+	0x8A88716F, 0x629E7436, 0x92B9E5CA, 0x7AAFE093, 0xBAEB5825, 0x52FD5D7C, 0xA2DACC80, 0x4ACCC9D9,
+	0xEA4E23FB, 0x025826A2, 0xF27FB75E, 0x1A69B207, 0xDA2D0AB1, 0x323B0FE8, 0xC21C9E14, 0x2A0A9B4D,
+	0x9609A88E, 0x7E1FADD7, 0x8E383C2B, 0x662E3972, 0xA66A81C4, 0x4E7C849D, 0xBE5B1561, 0x564D1038,
+	0xF6CFFA1A, 0x1ED9FF43, 0xEEFE6EBF, 0x06E86BE6, 0xC6ACD350, 0x2EBAD609, 0xDE9D47F5, 0x368B42AC,
+	0x57850DA6, 0xBF9308FF, 0x4FB49903, 0xA7A29C5A, 0x67E624EC, 0x8FF021B5, 0x7FD7B049, 0x97C1B510,
+	0x37435F32, 0xDF555A6B, 0x2F72CB97, 0xC764CECE, 0x07207678, 0xEF367321, 0x1F11E2DD, 0xF707E784,
+	0xDD0D7CC9, 0x351B7990, 0xC53CE86C, 0x2D2AED35, 0xED6E5583, 0x057850DA, 0xF55FC126, 0x1D49C47F,
+	0xBDCB2E5D, 0x55DD2B04, 0xA5FABAF8, 0x4DECBFA1, 0x8DA80717, 0x65BE024E, 0x959993B2, 0x7D8F96EB,
+	0x1C81D9E1, 0xF497DCB8, 0x04B04D44, 0xECA6481D, 0x2CE2F0AB, 0xC4F4F5F2, 0x34D3640E, 0xDCC56157,
+	0x7C478B75, 0x94518E2C, 0x64761FD0, 0x8C601A89, 0x4C24A23F, 0xA432A766, 0x5415369A, 0xBC0333C3,
+	0xE40ECF0B, 0x0C18CA52, 0xFC3F5BAE, 0x14295EF7, 0xD46DE641, 0x3C7BE318, 0xCC5C72E4, 0x244A77BD,
+	0x84C89D9F, 0x6CDE98C6, 0x9CF9093A, 0x74EF0C63, 0xB4ABB4D5, 0x5CBDB18C, 0xAC9A2070, 0x448C2529,
+	0x25826A23, 0xCD946F7A, 0x3DB3FE86, 0xD5A5FBDF, 0x15E14369, 0xFDF74630, 0x0DD0D7CC, 0xE5C6D295,
+	0x454438B7, 0xAD523DEE, 0x5D75AC12, 0xB563A94B, 0x752711FD, 0x9D3114A4, 0x6D168558, 0x85008001,
+	0xAF0A1B4C, 0x471C1E15, 0xB73B8FE9, 0x5F2D8AB0, 0x9F693206, 0x777F375F, 0x8758A6A3, 0x6F4EA3FA,
+	0xCFCC49D8, 0x27DA4C81, 0xD7FDDD7D, 0x3FEBD824, 0xFFAF6092, 0x17B965CB, 0xE79EF437, 0x0F88F16E,
+	0x6E86BE64, 0x8690BB3D, 0x76B72AC1, 0x9EA12F98, 0x5EE5972E, 0xB6F39277, 0x46D4038B, 0xAEC206D2,
+	0x0E40ECF0, 0xE656E9A9, 0x16717855, 0xFE677D0C, 0x3E23C5BA, 0xD635C0E3, 0x2612511F, 0xCE045446,
+	0x72076785, 0x9A1162DC, 0x6A36F320, 0x8220F679, 0x42644ECF, 0xAA724B96, 0x5A55DA6A, 0xB243DF33,
+	0x12C13511, 0xFAD73048, 0x0AF0A1B4, 0xE2E6A4ED, 0x22A21C5B, 0xCAB41902, 0x3A9388FE, 0xD2858DA7,
+	0xB38BC2AD, 0x5B9DC7F4, 0xABBA5608, 0x43AC5351, 0x83E8EBE7, 0x6BFEEEBE, 0x9BD97F42, 0x73CF7A1B,
+	0xD34D9039, 0x3B5B9560, 0xCB7C049C, 0x236A01C5, 0xE32EB973, 0x0B38BC2A, 0xFB1F2DD6, 0x1309288F,
+	0x3903B3C2, 0xD115B69B, 0x21322767, 0xC924223E, 0x09609A88, 0xE1769FD1, 0x11510E2D, 0xF9470B74,
+	0x59C5E156, 0xB1D3E40F, 0x41F475F3, 0xA9E270AA, 0x69A6C81C, 0x81B0CD45, 0x71975CB9, 0x998159E0,
+	0xF88F16EA, 0x109913B3, 0xE0BE824F, 0x08A88716, 0xC8EC3FA0, 0x20FA3AF9, 0xD0DDAB05, 0x38CBAE5C,
+	0x9849447E, 0x705F4127, 0x8078D0DB, 0x686ED582, 0xA82A6D34, 0x403C686D, 0xB01BF991, 0x580DFCC8,
+	// Seed 0x8D
+	0x00000000, 0x6AB4FBD4, 0xD569F7A8, 0xBFDD0C7C, 0x8CC0106B, 0xE674EBBF, 0x59A9E7C3, 0x331D1C17,
+	0x3F93DFED, 0x55272439, 0xEAFA2845, 0x804ED391, 0xB353CF86, 0xD9E73452, 0x663A382E, 0x0C8EC3FA,
+	0x7F27BFDA, 0x1593440E, 0xAA4E4872, 0xC0FAB3A6, 0xF3E7AFB1, 0x99535465, 0x268E5819, 0x4C3AA3CD,
+	0x40B46037, 0x2A009BE3, 0x95DD979F, 0xFF696C4B, 0xCC74705C, 0xA6C08B88, 0x191D87F4, 0x73A97C20,
+	0xFE4F7FB4, 0x94FB8460, 0x2B26881C, 0x419273C8, 0x728F6FDF, 0x183B940B, 0xA7E69877, 0xCD5263A3,
+	0xC1DCA059, 0xAB685B8D, 0x14B557F1, 0x7E01AC25, 0x4D1CB032, 0x27A84BE6, 0x9875479A, 0xF2C1BC4E,
+	0x8168C06E, 0xEBDC3BBA, 0x540137C6, 0x3EB5CC12, 0x0DA8D005, 0x671C2BD1, 0xD8C127AD, 0xB275DC79,
+	0xBEFB1F83, 0xD44FE457, 0x6B92E82B, 0x012613FF, 0x323B0FE8, 0x588FF43C, 0xE752F840, 0x8DE60394,
+	0xDA8D0053, 0xB039FB87, 0x0FE4F7FB, 0x65500C2F, 0x564D1038, 0x3CF9EBEC, 0x8324E790, 0xE9901C44,
+	0xE51EDFBE, 0x8FAA246A, 0x30772816, 0x5AC3D3C2, 0x69DECFD5, 0x036A3401, 0xBCB7387D, 0xD603C3A9,
+	0xA5AABF89, 0xCF1E445D, 0x70C34821, 0x1A77B3F5, 0x296AAFE2, 0x43DE5436, 0xFC03584A, 0x96B7A39E,
+	0x9A396064, 0xF08D9BB0, 0x4F5097CC, 0x25E46C18, 0x16F9700F, 0x7C4D8BDB, 0xC39087A7, 0xA9247C73,
+	0x24C27FE7, 0x4E768433, 0xF1AB884F, 0x9B1F739B, 0xA8026F8C, 0xC2B69458, 0x7D6B9824, 0x17DF63F0,
+	0x1B51A00A, 0x71E55BDE, 0xCE3857A2, 0xA48CAC76, 0x9791B061, 0xFD254BB5, 0x42F847C9, 0x284CBC1D,
+	0x5BE5C03D, 0x31513BE9, 0x8E8C3795, 0xE438CC41, 0xD725D056, 0xBD912B82, 0x024C27FE, 0x68F8DC2A,
+	0x64761FD0, 0x0EC2E404, 0xB11FE878, 0xDBAB13AC, 0xE8B60FBB, 0x8202F46F, 0x3DDFF813, 0x576B03C7,
+	0x9309FF9D, 0xF9BD0449, 0x46600835, 0x2CD4F3E1, 0x1FC9EFF6, 0x757D1422, 0xCAA0185E, 0xA014E38A,
+	0xAC9A2070, 0xC62EDBA4, 0x79F3D7D8, 0x13472C0C, 0x205A301B, 0x4AEECBCF, 0xF533C7B3, 0x9F873C67,
+	0xEC2E4047, 0x869ABB93, 0x3947B7EF, 0x53F34C3B, 0x60EE502C, 0x0A5AABF8, 0xB587A784, 0xDF335C50,
+	0xD3BD9FAA, 0xB909647E, 0x06D46802, 0x6C6093D6, 0x5F7D8FC1, 0x35C97415, 0x8A147869, 0xE0A083BD,
+	0x6D468029, 0x07F27BFD, 0xB82F7781, 0xD29B8C55, 0xE1869042, 0x8B326B96, 0x34EF67EA, 0x5E5B9C3E,
+	0x52D55FC4, 0x3861A410, 0x87BCA86C, 0xED0853B8, 0xDE154FAF, 0xB4A1B47B, 0x0B7CB807, 0x61C843D3,
+	0x12613FF3, 0x78D5C427, 0xC708C85B, 0xADBC338F, 0x9EA12F98, 0xF415D44C, 0x4BC8D830, 0x217C23E4,
+	0x2DF2E01E, 0x47461BCA, 0xF89B17B6, 0x922FEC62, 0xA132F075, 0xCB860BA1, 0x745B07DD, 0x1EEFFC09,
+	0x4984FFCE, 0x2330041A, 0x9CED0866, 0xF659F3B2, 0xC544EFA5, 0xAFF01471, 0x102D180D, 0x7A99E3D9,
+	0x76172023, 0x1CA3DBF7, 0xA37ED78B, 0xC9CA2C5F, 0xFAD73048, 0x9063CB9C, 0x2FBEC7E0, 0x450A3C34,
+	0x36A34014, 0x5C17BBC0, 0xE3CAB7BC, 0x897E4C68, 0xBA63507F, 0xD0D7ABAB, 0x6F0AA7D7, 0x05BE5C03,
+	0x09309FF9, 0x6384642D, 0xDC596851, 0xB6ED9385, 0x85F08F92, 0xEF447446, 0x5099783A, 0x3A2D83EE,
+	0xB7CB807A, 0xDD7F7BAE, 0x62A277D2, 0x08168C06, 0x3B0B9011, 0x51BF6BC5, 0xEE6267B9, 0x84D69C6D,
+	0x88585F97, 0xE2ECA443, 0x5D31A83F, 0x378553EB, 0x04984FFC, 0x6E2CB428, 0xD1F1B854, 0xBB454380,
+	0xC8EC3FA0, 0xA258C474, 0x1D85C808, 0x773133DC, 0x442C2FCB, 0x2E98D41F, 0x9145D863, 0xFBF123B7,
+	0xF77FE04D, 0x9DCB1B99, 0x221617E5, 0x48A2EC31, 0x7BBFF026, 0x110B0BF2, 0xAED6078E, 0xC462FC5A,
+	// Seed 0x8E
+	0x00000000, 0x06FC6ABA, 0x0DF8D574, 0x0B04BFCE, 0x0FF0F6A7, 0x090C9C1D, 0x020823D3, 0x04F44969,
+	0x0BE0B101, 0x0D1CDBBB, 0x06186475, 0x00E40ECF, 0x041047A6, 0x02EC2D1C, 0x09E892D2, 0x0F14F868,
+	0x03C03E4D, 0x053C54F7, 0x0E38EB39, 0x08C48183, 0x0C30C8EA, 0x0ACCA250, 0x01C81D9E, 0x07347724,
+	0x08208F4C, 0x0EDCE5F6, 0x05D85A38, 0x03243082, 0x07D079EB, 0x012C1351, 0x0A28AC9F, 0x0CD4C625,
+	0x07807C9A, 0x017C1620, 0x0A78A9EE, 0x0C84C354, 0x08708A3D, 0x0E8CE087, 0x05885F49, 0x037435F3,
+	0x0C60CD9B, 0x0A9CA721, 0x019818EF, 0x07647255, 0x03903B3C, 0x056C5186, 0x0E68EE48, 0x089484F2,
+	0x044042D7, 0x02BC286D, 0x09B897A3, 0x0F44FD19, 0x0BB0B470, 0x0D4CDECA, 0x06486104, 0x00B40BBE,
+	0x0FA0F3D6, 0x095C996C, 0x025826A2, 0x04A44C18, 0x00500571, 0x06AC6FCB, 0x0DA8D005, 0x0B54BABF,
+	0x0F00F934, 0x09FC938E, 0x02F82C40, 0x040446FA, 0x00F00F93, 0x060C6529, 0x0D08DAE7, 0x0BF4B05D,
+	0x04E04835, 0x021C228F, 0x09189D41, 0x0FE4F7FB, 0x0B10BE92, 0x0DECD428, 0x06E86BE6, 0x0014015C,
+	0x0CC0C779, 0x0A3CADC3, 0x0138120D, 0x07C478B7, 0x033031DE, 0x05CC5B64, 0x0EC8E4AA, 0x08348E10,
+	0x07207678, 0x01DC1CC2, 0x0AD8A30C, 0x0C24C9B6, 0x08D080DF, 0x0E2CEA65, 0x052855AB, 0x03D43F11,
+	0x088085AE, 0x0E7CEF14, 0x057850DA, 0x03843A60, 0x07707309, 0x018C19B3, 0x0A88A67D, 0x0C74CCC7,
+	0x036034AF, 0x059C5E15, 0x0E98E1DB, 0x08648B61, 0x0C90C208, 0x0A6CA8B2, 0x0168177C, 0x07947DC6,
+	0x0B40BBE3, 0x0DBCD159, 0x06B86E97, 0x0044042D, 0x04B04D44, 0x024C27FE, 0x09489830, 0x0FB4F28A,
+	0x00A00AE2, 0x065C6058, 0x0D58DF96, 0x0BA4B52C, 0x0F50FC45, 0x09AC96FF, 0x02A82931, 0x0454438B,
+	0x0A00AE27, 0x0CFCC49D, 0x07F87B53, 0x010411E9, 0x05F05880, 0x030C323A, 0x08088DF4, 0x0EF4E74E,
+	0x01E01F26, 0x071C759C, 0x0C18CA52, 0x0AE4A0E8, 0x0E10E981, 0x08EC833B, 0x03E83CF5, 0x0514564F,
+	0x09C0906A, 0x0F3CFAD0, 0x0438451E, 0x02C42FA4, 0x063066CD, 0x00CC0C77, 0x0BC8B3B9, 0x0D34D903,
+	0x0220216B, 0x04DC4BD1, 0x0FD8F41F, 0x09249EA5, 0x0DD0D7CC, 0x0B2CBD76, 0x002802B8, 0x06D46802,
+	0x0D80D2BD, 0x0B7CB807, 0x007807C9, 0x06846D73, 0x0270241A, 0x048C4EA0, 0x0F88F16E, 0x09749BD4,
+	0x066063BC, 0x009C0906, 0x0B98B6C8, 0x0D64DC72, 0x0990951B, 0x0F6CFFA1, 0x0468406F, 0x02942AD5,
+	0x0E40ECF0, 0x08BC864A, 0x03B83984, 0x0544533E, 0x01B01A57, 0x074C70ED, 0x0C48CF23, 0x0AB4A599,
+	0x05A05DF1, 0x035C374B, 0x08588885, 0x0EA4E23F, 0x0A50AB56, 0x0CACC1EC, 0x07A87E22, 0x01541498,
+	0x05005713, 0x03FC3DA9, 0x08F88267, 0x0E04E8DD, 0x0AF0A1B4, 0x0C0CCB0E, 0x070874C0, 0x01F41E7A,
+	0x0EE0E612, 0x081C8CA8, 0x03183366, 0x05E459DC, 0x011010B5, 0x07EC7A0F, 0x0CE8C5C1, 0x0A14AF7B,
+	0x06C0695E, 0x003C03E4, 0x0B38BC2A, 0x0DC4D690, 0x09309FF9, 0x0FCCF543, 0x04C84A8D, 0x02342037,
+	0x0D20D85F, 0x0BDCB2E5, 0x00D80D2B, 0x06246791, 0x02D02EF8, 0x042C4442, 0x0F28FB8C, 0x09D49136,
+	0x02802B89, 0x047C4133, 0x0F78FEFD, 0x09849447, 0x0D70DD2E, 0x0B8CB794, 0x0088085A, 0x067462E0,
+	0x09609A88, 0x0F9CF032, 0x04984FFC, 0x02642546, 0x06906C2F, 0x006C0695, 0x0B68B95B, 0x0D94D3E1,
+	0x014015C4, 0x07BC7F7E, 0x0CB8C0B0, 0x0A44AA0A, 0x0EB0E363, 0x084C89D9, 0x03483617, 0x05B45CAD,
+	0x0AA0A4C5, 0x0C5CCE7F, 0x075871B1, 0x01A41B0B, 0x05505262, 0x03AC38D8, 0x08A88716, 0x0E54EDAC,
+	// Seed 0x8F
+	0x00000000, 0x0A96A78F, 0x152D4F1E, 0x1FBBE891, 0x2A5A9E3C, 0x20CC39B3, 0x3F77D122, 0x35E176AD,
+	0x54B53C78, 0x5E239BF7, 0x41987366, 0x4B0ED4E9, 0x7EEFA244, 0x747905CB, 0x6BC2ED5A, 0x61544AD5,
+	0x53654593, 0x59F3E21C, 0x46480A8D, 0x4CDEAD02, 0x793FDBAF, 0x73A97C20, 0x6C1294B1, 0x6684333E,
+	0x07D079EB, 0x0D46DE64, 0x12FD36F5, 0x186B917A, 0x2D8AE7D7, 0x271C4058, 0x38A7A8C9, 0x32310F46,
+	0x5CC5B645, 0x565311CA, 0x49E8F95B, 0x437E5ED4, 0x769F2879, 0x7C098FF6, 0x63B26767, 0x6924C0E8,
+	0x08708A3D, 0x02E62DB2, 0x1D5DC523, 0x17CB62AC, 0x222A1401, 0x28BCB38E, 0x37075B1F, 0x3D91FC90,
+	0x0FA0F3D6, 0x05365459, 0x1A8DBCC8, 0x101B1B47, 0x25FA6DEA, 0x2F6CCA65, 0x30D722F4, 0x3A41857B,
+	0x5B15CFAE, 0x51836821, 0x4E3880B0, 0x44AE273F, 0x714F5192, 0x7BD9F61D, 0x64621E8C, 0x6EF4B903,
+	0x438451E9, 0x4912F666, 0x56A91EF7, 0x5C3FB978, 0x69DECFD5, 0x6348685A, 0x7CF380CB, 0x76652744,
+	0x17316D91, 0x1DA7CA1E, 0x021C228F, 0x088A8500, 0x3D6BF3AD, 0x37FD5422, 0x2846BCB3, 0x22D01B3C,
+	0x10E1147A, 0x1A77B3F5, 0x05CC5B64, 0x0F5AFCEB, 0x3ABB8A46, 0x302D2DC9, 0x2F96C558, 0x250062D7,
+	0x44542802, 0x4EC28F8D, 0x5179671C, 0x5BEFC093, 0x6E0EB63E, 0x649811B1, 0x7B23F920, 0x71B55EAF,
+	0x1F41E7AC, 0x15D74023, 0x0A6CA8B2, 0x00FA0F3D, 0x351B7990, 0x3F8DDE1F, 0x2036368E, 0x2AA09101,
+	0x4BF4DBD4, 0x41627C5B, 0x5ED994CA, 0x544F3345, 0x61AE45E8, 0x6B38E267, 0x74830AF6, 0x7E15AD79,
+	0x4C24A23F, 0x46B205B0, 0x5909ED21, 0x539F4AAE, 0x667E3C03, 0x6CE89B8C, 0x7353731D, 0x79C5D492,
+	0x18919E47, 0x120739C8, 0x0DBCD159, 0x072A76D6, 0x32CB007B, 0x385DA7F4, 0x27E64F65, 0x2D70E8EA,
+	0x7D079EB1, 0x7791393E, 0x682AD1AF, 0x62BC7620, 0x575D008D, 0x5DCBA702, 0x42704F93, 0x48E6E81C,
+	0x29B2A2C9, 0x23240546, 0x3C9FEDD7, 0x36094A58, 0x03E83CF5, 0x097E9B7A, 0x16C573EB, 0x1C53D464,
+	0x2E62DB22, 0x24F47CAD, 0x3B4F943C, 0x31D933B3, 0x0438451E, 0x0EAEE291, 0x11150A00, 0x1B83AD8F,
+	0x7AD7E75A, 0x704140D5, 0x6FFAA844, 0x656C0FCB, 0x508D7966, 0x5A1BDEE9, 0x45A03678, 0x4F3691F7,
+	0x21C228F4, 0x2B548F7B, 0x34EF67EA, 0x3E79C065, 0x0B98B6C8, 0x010E1147, 0x1EB5F9D6, 0x14235E59,
+	0x7577148C, 0x7FE1B303, 0x605A5B92, 0x6ACCFC1D, 0x5F2D8AB0, 0x55BB2D3F, 0x4A00C5AE, 0x40966221,
+	0x72A76D67, 0x7831CAE8, 0x678A2279, 0x6D1C85F6, 0x58FDF35B, 0x526B54D4, 0x4DD0BC45, 0x47461BCA,
+	0x2612511F, 0x2C84F690, 0x333F1E01, 0x39A9B98E, 0x0C48CF23, 0x06DE68AC, 0x1965803D, 0x13F327B2,
+	0x3E83CF58, 0x341568D7, 0x2BAE8046, 0x213827C9, 0x14D95164, 0x1E4FF6EB, 0x01F41E7A, 0x0B62B9F5,
+	0x6A36F320, 0x60A054AF, 0x7F1BBC3E, 0x758D1BB1, 0x406C6D1C, 0x4AFACA93, 0x55412202, 0x5FD7858D,
+	0x6DE68ACB, 0x67702D44, 0x78CBC5D5, 0x725D625A, 0x47BC14F7, 0x4D2AB378, 0x52915BE9, 0x5807FC66,
+	0x3953B6B3, 0x33C5113C, 0x2C7EF9AD, 0x26E85E22, 0x1309288F, 0x199F8F00, 0x06246791, 0x0CB2C01E,
+	0x6246791D, 0x68D0DE92, 0x776B3603, 0x7DFD918C, 0x481CE721, 0x428A40AE, 0x5D31A83F, 0x57A70FB0,
+	0x36F34565, 0x3C65E2EA, 0x23DE0A7B, 0x2948ADF4, 0x1CA9DB59, 0x163F7CD6, 0x09849447, 0x031233C8,
+	0x31233C8E, 0x3BB59B01, 0x240E7390, 0x2E98D41F, 0x1B79A2B2, 0x11EF053D, 0x0E54EDAC, 0x04C24A23,
+	0x659600F6, 0x6F00A779, 0x70BB4FE8, 0x7A2DE867, 0x4FCC9ECA, 0x455A3945, 0x5AE1D1D4, 0x5077765B,
+	// Seed 0x90
+	0x00000000, 0x86E8BCF4, 0xEDCE5F61, 0x6B26E395, 0x3B83984B, 0xBD6B24BF, 0xD64DC72A, 0x50A57BDE,
+	0x77073096, 0xF1EF8C62, 0x9AC96FF7, 0x1C21D303, 0x4C84A8DD, 0xCA6C1429, 0xA14AF7BC, 0x27A24B48,
+	0xEE0E612C, 0x68E6DDD8, 0x03C03E4D, 0x852882B9, 0xD58DF967, 0x53654593, 0x3843A606, 0xBEAB1AF2,
+	0x990951BA, 0x1FE1ED4E, 0x74C70EDB, 0xF22FB22F, 0xA28AC9F1, 0x24627505, 0x4F449690, 0xC9AC2A64,
+	0x3C03E4D1, 0xBAEB5825, 0xD1CDBBB0, 0x57250744, 0x07807C9A, 0x8168C06E, 0xEA4E23FB, 0x6CA69F0F,
+	0x4B04D447, 0xCDEC68B3, 0xA6CA8B26, 0x202237D2, 0x70874C0C, 0xF66FF0F8, 0x9D49136D, 0x1BA1AF99,
+	0xD20D85FD, 0x54E53909, 0x3FC3DA9C, 0xB92B6668, 0xE98E1DB6, 0x6F66A142, 0x044042D7, 0x82A8FE23,
+	0xA50AB56B, 0x23E2099F, 0x48C4EA0A, 0xCE2C56FE, 0x9E892D20, 0x186191D4, 0x73477241, 0xF5AFCEB5,
+	0x7807C9A2, 0xFEEF7556, 0x95C996C3, 0x13212A37, 0x438451E9, 0xC56CED1D, 0xAE4A0E88, 0x28A2B27C,
+	0x0F00F934, 0x89E845C0, 0xE2CEA655, 0x64261AA1, 0x3483617F, 0xB26BDD8B, 0xD94D3E1E, 0x5FA582EA,
+	0x9609A88E, 0x10E1147A, 0x7BC7F7EF, 0xFD2F4B1B, 0xAD8A30C5, 0x2B628C31, 0x40446FA4, 0xC6ACD350,
+	0xE10E9818, 0x67E624EC, 0x0CC0C779, 0x8A287B8D, 0xDA8D0053, 0x5C65BCA7, 0x37435F32, 0xB1ABE3C6,
+	0x44042D73, 0xC2EC9187, 0xA9CA7212, 0x2F22CEE6, 0x7F87B538, 0xF96F09CC, 0x9249EA59, 0x14A156AD,
+	0x33031DE5, 0xB5EBA111, 0xDECD4284, 0x5825FE70, 0x088085AE, 0x8E68395A, 0xE54EDACF, 0x63A6663B,
+	0xAA0A4C5F, 0x2CE2F0AB, 0x47C4133E, 0xC12CAFCA, 0x9189D414, 0x176168E0, 0x7C478B75, 0xFAAF3781,
+	0xDD0D7CC9, 0x5BE5C03D, 0x30C323A8, 0xB62B9F5C, 0xE68EE482, 0x60665876, 0x0B40BBE3, 0x8DA80717,
+	0xF00F9344, 0x76E72FB0, 0x1DC1CC25, 0x9B2970D1, 0xCB8C0B0F, 0x4D64B7FB, 0x2642546E, 0xA0AAE89A,
+	0x8708A3D2, 0x01E01F26, 0x6AC6FCB3, 0xEC2E4047, 0xBC8B3B99, 0x3A63876D, 0x514564F8, 0xD7ADD80C,
+	0x1E01F268, 0x98E94E9C, 0xF3CFAD09, 0x752711FD, 0x25826A23, 0xA36AD6D7, 0xC84C3542, 0x4EA489B6,
+	0x6906C2FE, 0xEFEE7E0A, 0x84C89D9F, 0x0220216B, 0x52855AB5, 0xD46DE641, 0xBF4B05D4, 0x39A3B920,
+	0xCC0C7795, 0x4AE4CB61, 0x21C228F4, 0xA72A9400, 0xF78FEFDE, 0x7167532A, 0x1A41B0BF, 0x9CA90C4B,
+	0xBB0B4703, 0x3DE3FBF7, 0x56C51862, 0xD02DA496, 0x8088DF48, 0x066063BC, 0x6D468029, 0xEBAE3CDD,
+	0x220216B9, 0xA4EAAA4D, 0xCFCC49D8, 0x4924F52C, 0x19818EF2, 0x9F693206, 0xF44FD193, 0x72A76D67,
+	0x5505262F, 0xD3ED9ADB, 0xB8CB794E, 0x3E23C5BA, 0x6E86BE64, 0xE86E0290, 0x8348E105, 0x05A05DF1,
+	0x88085AE6, 0x0EE0E612, 0x65C60587, 0xE32EB973, 0xB38BC2AD, 0x35637E59, 0x5E459DCC, 0xD8AD2138,
+	0xFF0F6A70, 0x79E7D684, 0x12C13511, 0x942989E5, 0xC48CF23B, 0x42644ECF, 0x2942AD5A, 0xAFAA11AE,
+	0x66063BCA, 0xE0EE873E, 0x8BC864AB, 0x0D20D85F, 0x5D85A381, 0xDB6D1F75, 0xB04BFCE0, 0x36A34014,
+	0x11010B5C, 0x97E9B7A8, 0xFCCF543D, 0x7A27E8C9, 0x2A829317, 0xAC6A2FE3, 0xC74CCC76, 0x41A47082,
+	0xB40BBE37, 0x32E302C3, 0x59C5E156, 0xDF2D5DA2, 0x8F88267C, 0x09609A88, 0x6246791D, 0xE4AEC5E9,
+	0xC30C8EA1, 0x45E43255, 0x2EC2D1C0, 0xA82A6D34, 0xF88F16EA, 0x7E67AA1E, 0x1541498B, 0x93A9F57F,
+	0x5A05DF1B, 0xDCED63EF, 0xB7CB807A, 0x31233C8E, 0x61864750, 0xE76EFBA4, 0x8C481831, 0x0AA0A4C5,
+	0x2D02EF8D, 0xABEA5379, 0xC0CCB0EC, 0x46240C18, 0x168177C6, 0x9069CB32, 0xFB4F28A7, 0x7DA79453,
+	// Seed 0x91
+	0x00000000, 0xF0999B06, 0xEF2273A9, 0x1FBBE8AF, 0xD055A2F7, 0x20CC39F1, 0x3F77D15E, 0xCFEE4A58,
+	0xAEBA004B, 0x5E239B4D, 0x419873E2, 0xB101E8E4, 0x7EEFA2BC, 0x8E7639BA, 0x91CDD115, 0x61544A13,
+	0x53654533, 0xA3FCDE35, 0xBC47369A, 0x4CDEAD9C, 0x8330E7C4, 0x73A97CC2, 0x6C12946D, 0x9C8B0F6B,
+	0xFDDF4578, 0x0D46DE7E, 0x12FD36D1, 0xE264ADD7, 0x2D8AE78F, 0xDD137C89, 0xC2A89426, 0x32310F20,
+	0xA6CA8A66, 0x56531160, 0x49E8F9CF, 0xB97162C9, 0x769F2891, 0x8606B397, 0x99BD5B38, 0x6924C03E,
+	0x08708A2D, 0xF8E9112B, 0xE752F984, 0x17CB6282, 0xD82528DA, 0x28BCB3DC, 0x37075B73, 0xC79EC075,
+	0xF5AFCF55, 0x05365453, 0x1A8DBCFC, 0xEA1427FA, 0x25FA6DA2, 0xD563F6A4, 0xCAD81E0B, 0x3A41850D,
+	0x5B15CF1E, 0xAB8C5418, 0xB437BCB7, 0x44AE27B1, 0x8B406DE9, 0x7BD9F6EF, 0x64621E40, 0x94FB8546,
+	0x43845169, 0xB31DCA6F, 0xACA622C0, 0x5C3FB9C6, 0x93D1F39E, 0x63486898, 0x7CF38037, 0x8C6A1B31,
+	0xED3E5122, 0x1DA7CA24, 0x021C228B, 0xF285B98D, 0x3D6BF3D5, 0xCDF268D3, 0xD249807C, 0x22D01B7A,
+	0x10E1145A, 0xE0788F5C, 0xFFC367F3, 0x0F5AFCF5, 0xC0B4B6AD, 0x302D2DAB, 0x2F96C504, 0xDF0F5E02,
+	0xBE5B1411, 0x4EC28F17, 0x517967B8, 0xA1E0FCBE, 0x6E0EB6E6, 0x9E972DE0, 0x812CC54F, 0x71B55E49,
+	0xE54EDB0F, 0x15D74009, 0x0A6CA8A6, 0xFAF533A0, 0x351B79F8, 0xC582E2FE, 0xDA390A51, 0x2AA09157,
+	0x4BF4DB44, 0xBB6D4042, 0xA4D6A8ED, 0x544F33EB, 0x9BA179B3, 0x6B38E2B5, 0x74830A1A, 0x841A911C,
+	0xB62B9E3C, 0x46B2053A, 0x5909ED95, 0xA9907693, 0x667E3CCB, 0x96E7A7CD, 0x895C4F62, 0x79C5D464,
+	0x18919E77, 0xE8080571, 0xF7B3EDDE, 0x072A76D8, 0xC8C43C80, 0x385DA786, 0x27E64F29, 0xD77FD42F,
+	0x8708A2D2, 0x779139D4, 0x682AD17B, 0x98B34A7D, 0x575D0025, 0xA7C49B23, 0xB87F738C, 0x48E6E88A,
+	0x29B2A299, 0xD92B399F, 0xC690D130, 0x36094A36, 0xF9E7006E, 0x097E9B68, 0x16C573C7, 0xE65CE8C1,
+	0xD46DE7E1, 0x24F47CE7, 0x3B4F9448, 0xCBD60F4E, 0x04384516, 0xF4A1DE10, 0xEB1A36BF, 0x1B83ADB9,
+	0x7AD7E7AA, 0x8A4E7CAC, 0x95F59403, 0x656C0F05, 0xAA82455D, 0x5A1BDE5B, 0x45A036F4, 0xB539ADF2,
+	0x21C228B4, 0xD15BB3B2, 0xCEE05B1D, 0x3E79C01B, 0xF1978A43, 0x010E1145, 0x1EB5F9EA, 0xEE2C62EC,
+	0x8F7828FF, 0x7FE1B3F9, 0x605A5B56, 0x90C3C050, 0x5F2D8A08, 0xAFB4110E, 0xB00FF9A1, 0x409662A7,
+	0x72A76D87, 0x823EF681, 0x9D851E2E, 0x6D1C8528, 0xA2F2CF70, 0x526B5476, 0x4DD0BCD9, 0xBD4927DF,
+	0xDC1D6DCC, 0x2C84F6CA, 0x333F1E65, 0xC3A68563, 0x0C48CF3B, 0xFCD1543D, 0xE36ABC92, 0x13F32794,
+	0xC48CF3BB, 0x341568BD, 0x2BAE8012, 0xDB371B14, 0x14D9514C, 0xE440CA4A, 0xFBFB22E5, 0x0B62B9E3,
+	0x6A36F3F0, 0x9AAF68F6, 0x85148059, 0x758D1B5F, 0xBA635107, 0x4AFACA01, 0x554122AE, 0xA5D8B9A8,
+	0x97E9B688, 0x67702D8E, 0x78CBC521, 0x88525E27, 0x47BC147F, 0xB7258F79, 0xA89E67D6, 0x5807FCD0,
+	0x3953B6C3, 0xC9CA2DC5, 0xD671C56A, 0x26E85E6C, 0xE9061434, 0x199F8F32, 0x0624679D, 0xF6BDFC9B,
+	0x624679DD, 0x92DFE2DB, 0x8D640A74, 0x7DFD9172, 0xB213DB2A, 0x428A402C, 0x5D31A883, 0xADA83385,
+	0xCCFC7996, 0x3C65E290, 0x23DE0A3F, 0xD3479139, 0x1CA9DB61, 0xEC304067, 0xF38BA8C8, 0x031233CE,
+	0x31233CEE, 0xC1BAA7E8, 0xDE014F47, 0x2E98D441, 0xE1769E19, 0x11EF051F, 0x0E54EDB0, 0xFECD76B6,
+	0x9F993CA5, 0x6F00A7A3, 0x70BB4F0C, 0x8022D40A, 0x4FCC9E52, 0xBF550554, 0xA0EEEDFB, 0x507776FD,
+	// Seed 0x92
+	0x00000000, 0x12FD36F5, 0x19F9893B, 0x0B04BFCE, 0x0FF0F6A7, 0x1D0DC052, 0x16097F9C, 0x04F44969,
+	0x1FE1ED4E, 0x0D1CDBBB, 0x06186475, 0x14E55280, 0x10111BE9, 0x02EC2D1C, 0x09E892D2, 0x1B15A427,
+	0x03C03E4D, 0x113D08B8, 0x1A39B776, 0x08C48183, 0x0C30C8EA, 0x1ECDFE1F, 0x15C941D1, 0x07347724,
+	0x1C21D303, 0x0EDCE5F6, 0x05D85A38, 0x17256CCD, 0x13D125A4, 0x012C1351, 0x0A28AC9F, 0x18D59A6A,
+	0x07807C9A, 0x157D4A6F, 0x1E79F5A1, 0x0C84C354, 0x08708A3D, 0x1A8DBCC8, 0x11890306, 0x037435F3,
+	0x186191D4, 0x0A9CA721, 0x019818EF, 0x13652E1A, 0x17916773, 0x056C5186, 0x0E68EE48, 0x1C95D8BD,
+	0x044042D7, 0x16BD7422, 0x1DB9CBEC, 0x0F44FD19, 0x0BB0B470, 0x194D8285, 0x12493D4B, 0x00B40BBE,
+	0x1BA1AF99, 0x095C996C, 0x025826A2, 0x10A51057, 0x1451593E, 0x06AC6FCB, 0x0DA8D005, 0x1F55E6F0,
+	0x0F00F934, 0x1DFDCFC1, 0x16F9700F, 0x040446FA, 0x00F00F93, 0x120D3966, 0x190986A8, 0x0BF4B05D,
+	0x10E1147A, 0x021C228F, 0x09189D41, 0x1BE5ABB4, 0x1F11E2DD, 0x0DECD428, 0x06E86BE6, 0x14155D13,
+	0x0CC0C779, 0x1E3DF18C, 0x15394E42, 0x07C478B7, 0x033031DE, 0x11CD072B, 0x1AC9B8E5, 0x08348E10,
+	0x13212A37, 0x01DC1CC2, 0x0AD8A30C, 0x182595F9, 0x1CD1DC90, 0x0E2CEA65, 0x052855AB, 0x17D5635E,
+	0x088085AE, 0x1A7DB35B, 0x11790C95, 0x03843A60, 0x07707309, 0x158D45FC, 0x1E89FA32, 0x0C74CCC7,
+	0x176168E0, 0x059C5E15, 0x0E98E1DB, 0x1C65D72E, 0x18919E47, 0x0A6CA8B2, 0x0168177C, 0x13952189,
+	0x0B40BBE3, 0x19BD8D16, 0x12B932D8, 0x0044042D, 0x04B04D44, 0x164D7BB1, 0x1D49C47F, 0x0FB4F28A,
+	0x14A156AD, 0x065C6058, 0x0D58DF96, 0x1FA5E963, 0x1B51A00A, 0x09AC96FF, 0x02A82931, 0x10551FC4,
+	0x1E01F268, 0x0CFCC49D, 0x07F87B53, 0x15054DA6, 0x11F104CF, 0x030C323A, 0x08088DF4, 0x1AF5BB01,
+	0x01E01F26, 0x131D29D3, 0x1819961D, 0x0AE4A0E8, 0x0E10E981, 0x1CEDDF74, 0x17E960BA, 0x0514564F,
+	0x1DC1CC25, 0x0F3CFAD0, 0x0438451E, 0x16C573EB, 0x12313A82, 0x00CC0C77, 0x0BC8B3B9, 0x1935854C,
+	0x0220216B, 0x10DD179E, 0x1BD9A850, 0x09249EA5, 0x0DD0D7CC, 0x1F2DE139, 0x14295EF7, 0x06D46802,
+	0x19818EF2, 0x0B7CB807, 0x007807C9, 0x1285313C, 0x16717855, 0x048C4EA0, 0x0F88F16E, 0x1D75C79B,
+	0x066063BC, 0x149D5549, 0x1F99EA87, 0x0D64DC72, 0x0990951B, 0x1B6DA3EE, 0x10691C20, 0x02942AD5,
+	0x1A41B0BF, 0x08BC864A, 0x03B83984, 0x11450F71, 0x15B14618, 0x074C70ED, 0x0C48CF23, 0x1EB5F9D6,
+	0x05A05DF1, 0x175D6B04, 0x1C59D4CA, 0x0EA4E23F, 0x0A50AB56, 0x18AD9DA3, 0x13A9226D, 0x01541498,
+	0x11010B5C, 0x03FC3DA9, 0x08F88267, 0x1A05B492, 0x1EF1FDFB, 0x0C0CCB0E, 0x070874C0, 0x15F54235,
+	0x0EE0E612, 0x1C1DD0E7, 0x17196F29, 0x05E459DC, 0x011010B5, 0x13ED2640, 0x18E9998E, 0x0A14AF7B,
+	0x12C13511, 0x003C03E4, 0x0B38BC2A, 0x19C58ADF, 0x1D31C3B6, 0x0FCCF543, 0x04C84A8D, 0x16357C78,
+	0x0D20D85F, 0x1FDDEEAA, 0x14D95164, 0x06246791, 0x02D02EF8, 0x102D180D, 0x1B29A7C3, 0x09D49136,
+	0x168177C6, 0x047C4133, 0x0F78FEFD, 0x1D85C808, 0x19718161, 0x0B8CB794, 0x0088085A, 0x12753EAF,
+	0x09609A88, 0x1B9DAC7D, 0x109913B3, 0x02642546, 0x06906C2F, 0x146D5ADA, 0x1F69E514, 0x0D94D3E1,
+	0x1541498B, 0x07BC7F7E, 0x0CB8C0B0, 0x1E45F645, 0x1AB1BF2C, 0x084C89D9, 0x03483617, 0x11B500E2,
+	0x0AA0A4C5, 0x185D9230, 0x13592DFE, 0x01A41B0B, 0x05505262, 0x17AD6497, 0x1CA9DB59, 0x0E54EDAC,
+	// Seed 0x93
+	0x00000000, 0x2BC8867D, 0x57910CFA, 0x7C598A87, 0x7D2F9C09, 0x56E71A74, 0x2ABE90F3, 0x0176168E,
+	0x2852BDEF, 0x039A3B92, 0x7FC3B115, 0x540B3768, 0x557D21E6, 0x7EB5A79B, 0x02EC2D1C, 0x2924AB61,
+	0x50A57BDE, 0x7B6DFDA3, 0x07347724, 0x2CFCF159, 0x2D8AE7D7, 0x064261AA, 0x7A1BEB2D, 0x51D36D50,
+	0x78F7C631, 0x533F404C, 0x2F66CACB, 0x04AE4CB6, 0x05D85A38, 0x2E10DC45, 0x524956C2, 0x7981D0BF,
+	0x73477241, 0x588FF43C, 0x24D67EBB, 0x0F1EF8C6, 0x0E68EE48, 0x25A06835, 0x59F9E2B2, 0x723164CF,
+	0x5B15CFAE, 0x70DD49D3, 0x0C84C354, 0x274C4529, 0x263A53A7, 0x0DF2D5DA, 0x71AB5F5D, 0x5A63D920,
+	0x23E2099F, 0x082A8FE2, 0x74730565, 0x5FBB8318, 0x5ECD9596, 0x750513EB, 0x095C996C, 0x22941F11,
+	0x0BB0B470, 0x2078320D, 0x5C21B88A, 0x77E93EF7, 0x769F2879, 0x5D57AE04, 0x210E2483, 0x0AC6A2FE,
+	0x3483617F, 0x1F4BE702, 0x63126D85, 0x48DAEBF8, 0x49ACFD76, 0x62647B0B, 0x1E3DF18C, 0x35F577F1,
+	0x1CD1DC90, 0x37195AED, 0x4B40D06A, 0x60885617, 0x61FE4099, 0x4A36C6E4, 0x366F4C63, 0x1DA7CA1E,
+	0x64261AA1, 0x4FEE9CDC, 0x33B7165B, 0x187F9026, 0x190986A8, 0x32C100D5, 0x4E988A52, 0x65500C2F,
+	0x4C74A74E, 0x67BC2133, 0x1BE5ABB4, 0x302D2DC9, 0x315B3B47, 0x1A93BD3A, 0x66CA37BD, 0x4D02B1C0,
+	0x47C4133E, 0x6C0C9543, 0x10551FC4, 0x3B9D99B9, 0x3AEB8F37, 0x1123094A, 0x6D7A83CD, 0x46B205B0,
+	0x6F96AED1, 0x445E28AC, 0x3807A22B, 0x13CF2456, 0x12B932D8, 0x3971B4A5, 0x45283E22, 0x6EE0B85F,
+	0x176168E0, 0x3CA9EE9D, 0x40F0641A, 0x6B38E267, 0x6A4EF4E9, 0x41867294, 0x3DDFF813, 0x16177E6E,
+	0x3F33D50F, 0x14FB5372, 0x68A2D9F5, 0x436A5F88, 0x421C4906, 0x69D4CF7B, 0x158D45FC, 0x3E45C381,
+	0x6906C2FE, 0x42CE4483, 0x3E97CE04, 0x155F4879, 0x14295EF7, 0x3FE1D88A, 0x43B8520D, 0x6870D470,
+	0x41547F11, 0x6A9CF96C, 0x16C573EB, 0x3D0DF596, 0x3C7BE318, 0x17B36565, 0x6BEAEFE2, 0x4022699F,
+	0x39A3B920, 0x126B3F5D, 0x6E32B5DA, 0x45FA33A7, 0x448C2529, 0x6F44A354, 0x131D29D3, 0x38D5AFAE,
+	0x11F104CF, 0x3A3982B2, 0x46600835, 0x6DA88E48, 0x6CDE98C6, 0x47161EBB, 0x3B4F943C, 0x10871241,
+	0x1A41B0BF, 0x318936C2, 0x4DD0BC45, 0x66183A38, 0x676E2CB6, 0x4CA6AACB, 0x30FF204C, 0x1B37A631,
+	0x32130D50, 0x19DB8B2D, 0x658201AA, 0x4E4A87D7, 0x4F3C9159, 0x64F41724, 0x18AD9DA3, 0x33651BDE,
+	0x4AE4CB61, 0x612C4D1C, 0x1D75C79B, 0x36BD41E6, 0x37CB5768, 0x1C03D115, 0x605A5B92, 0x4B92DDEF,
+	0x62B6768E, 0x497EF0F3, 0x35277A74, 0x1EEFFC09, 0x1F99EA87, 0x34516CFA, 0x4808E67D, 0x63C06000,
+	0x5D85A381, 0x764D25FC, 0x0A14AF7B, 0x21DC2906, 0x20AA3F88, 0x0B62B9F5, 0x773B3372, 0x5CF3B50F,
+	0x75D71E6E, 0x5E1F9813, 0x22461294, 0x098E94E9, 0x08F88267, 0x2330041A, 0x5F698E9D, 0x74A108E0,
+	0x0D20D85F, 0x26E85E22, 0x5AB1D4A5, 0x717952D8, 0x700F4456, 0x5BC7C22B, 0x279E48AC, 0x0C56CED1,
+	0x257265B0, 0x0EBAE3CD, 0x72E3694A, 0x592BEF37, 0x585DF9B9, 0x73957FC4, 0x0FCCF543, 0x2404733E,
+	0x2EC2D1C0, 0x050A57BD, 0x7953DD3A, 0x529B5B47, 0x53ED4DC9, 0x7825CBB4, 0x047C4133, 0x2FB4C74E,
+	0x06906C2F, 0x2D58EA52, 0x510160D5, 0x7AC9E6A8, 0x7BBFF026, 0x5077765B, 0x2C2EFCDC, 0x07E67AA1,
+	0x7E67AA1E, 0x55AF2C63, 0x29F6A6E4, 0x023E2099, 0x03483617, 0x2880B06A, 0x54D93AED, 0x7F11BC90,
+	0x563517F1, 0x7DFD918C, 0x01A41B0B, 0x2A6C9D76, 0x2B1A8BF8, 0x00D20D85, 0x7C8B8702, 0x5743017F,
+	// Seed 0x94
+	0x00000000, 0xB483B66D, 0x87C3C261, 0x3340740C, 0xE1432A79, 0x55C09C14, 0x6680E818, 0xD2035E75,
+	0x2C42FA49, 0x98C14C24, 0xAB813828, 0x1F028E45, 0xCD01D030, 0x7982665D, 0x4AC21251, 0xFE41A43C,
+	0x5885F492, 0xEC0642FF, 0xDF4636F3, 0x6BC5809E, 0xB9C6DEEB, 0x0D456886, 0x3E051C8A, 0x8A86AAE7,
+	0x74C70EDB, 0xC044B8B6, 0xF304CCBA, 0x47877AD7, 0x958424A2, 0x210792CF, 0x1247E6C3, 0xA6C450AE,
+	0xB10BE924, 0x05885F49, 0x36C82B45, 0x824B9D28, 0x5048C35D, 0xE4CB7530, 0xD78B013C, 0x6308B751,
+	0x9D49136D, 0x29CAA500, 0x1A8AD10C, 0xAE096761, 0x7C0A3914, 0xC8898F79, 0xFBC9FB75, 0x4F4A4D18,
+	0xE98E1DB6, 0x5D0DABDB, 0x6E4DDFD7, 0xDACE69BA, 0x08CD37CF, 0xBC4E81A2, 0x8F0EF5AE, 0x3B8D43C3,
+	0xC5CCE7FF, 0x714F5192, 0x420F259E, 0xF68C93F3, 0x248FCD86, 0x900C7BEB, 0xA34C0FE7, 0x17CFB98A,
+	0x8CD37CF3, 0x3850CA9E, 0x0B10BE92, 0xBF9308FF, 0x6D90568A, 0xD913E0E7, 0xEA5394EB, 0x5ED02286,
+	0xA09186BA, 0x141230D7, 0x275244DB, 0x93D1F2B6, 0x41D2ACC3, 0xF5511AAE, 0xC6116EA2, 0x7292D8CF,
+	0xD4568861, 0x60D53E0C, 0x53954A00, 0xE716FC6D, 0x3515A218, 0x81961475, 0xB2D66079, 0x0655D614,
+	0xF8147228, 0x4C97C445, 0x7FD7B049, 0xCB540624, 0x19575851, 0xADD4EE3C, 0x9E949A30, 0x2A172C5D,
+	0x3DD895D7, 0x895B23BA, 0xBA1B57B6, 0x0E98E1DB, 0xDC9BBFAE, 0x681809C3, 0x5B587DCF, 0xEFDBCBA2,
+	0x119A6F9E, 0xA519D9F3, 0x9659ADFF, 0x22DA1B92, 0xF0D945E7, 0x445AF38A, 0x771A8786, 0xC39931EB,
+	0x655D6145, 0xD1DED728, 0xE29EA324, 0x561D1549, 0x841E4B3C, 0x309DFD51, 0x03DD895D, 0xB75E3F30,
+	0x491F9B0C, 0xFD9C2D61, 0xCEDC596D, 0x7A5FEF00, 0xA85CB175, 0x1CDF0718, 0x2F9F7314, 0x9B1CC579,
+	0xF762575D, 0x43E1E130, 0x70A1953C, 0xC4222351, 0x16217D24, 0xA2A2CB49, 0x91E2BF45, 0x25610928,
+	0xDB20AD14, 0x6FA31B79, 0x5CE36F75, 0xE860D918, 0x3A63876D, 0x8EE03100, 0xBDA0450C, 0x0923F361,
+	0xAFE7A3CF, 0x1B6415A2, 0x282461AE, 0x9CA7D7C3, 0x4EA489B6, 0xFA273FDB, 0xC9674BD7, 0x7DE4FDBA,
+	0x83A55986, 0x3726EFEB, 0x04669BE7, 0xB0E52D8A, 0x62E673FF, 0xD665C592, 0xE525B19E, 0x51A607F3,
+	0x4669BE79, 0xF2EA0814, 0xC1AA7C18, 0x7529CA75, 0xA72A9400, 0x13A9226D, 0x20E95661, 0x946AE00C,
+	0x6A2B4430, 0xDEA8F25D, 0xEDE88651, 0x596B303C, 0x8B686E49, 0x3FEBD824, 0x0CABAC28, 0xB8281A45,
+	0x1EEC4AEB, 0xAA6FFC86, 0x992F888A, 0x2DAC3EE7, 0xFFAF6092, 0x4B2CD6FF, 0x786CA2F3, 0xCCEF149E,
+	0x32AEB0A2, 0x862D06CF, 0xB56D72C3, 0x01EEC4AE, 0xD3ED9ADB, 0x676E2CB6, 0x542E58BA, 0xE0ADEED7,
+	0x7BB12BAE, 0xCF329DC3, 0xFC72E9CF, 0x48F15FA2, 0x9AF201D7, 0x2E71B7BA, 0x1D31C3B6, 0xA9B275DB,
+	0x57F3D1E7, 0xE370678A, 0xD0301386, 0x64B3A5EB, 0xB6B0FB9E, 0x02334DF3, 0x317339FF, 0x85F08F92,
+	0x2334DF3C, 0x97B76951, 0xA4F71D5D, 0x1074AB30, 0xC277F545, 0x76F44328, 0x45B43724, 0xF1378149,
+	0x0F762575, 0xBBF59318, 0x88B5E714, 0x3C365179, 0xEE350F0C, 0x5AB6B961, 0x69F6CD6D, 0xDD757B00,
+	0xCABAC28A, 0x7E3974E7, 0x4D7900EB, 0xF9FAB686, 0x2BF9E8F3, 0x9F7A5E9E, 0xAC3A2A92, 0x18B99CFF,
+	0xE6F838C3, 0x527B8EAE, 0x613BFAA2, 0xD5B84CCF, 0x07BB12BA, 0xB338A4D7, 0x8078D0DB, 0x34FB66B6,
+	0x923F3618, 0x26BC8075, 0x15FCF479, 0xA17F4214, 0x737C1C61, 0xC7FFAA0C, 0xF4BFDE00, 0x403C686D,
+	0xBE7DCC51, 0x0AFE7A3C, 0x39BE0E30, 0x8D3DB85D, 0x5F3EE628, 0xEBBD5045, 0xD8FD2449, 0x6C7E9224,
+	// Seed 0x95
+	0x00000000, 0x0B07092C, 0x160E1258, 0x1D091B74, 0x2C1C24B0, 0x271B2D9C, 0x3A1236E8, 0x31153FC4,
+	0x58384960, 0x533F404C, 0x4E365B38, 0x45315214, 0x74246DD0, 0x7F2364FC, 0x622A7F88, 0x692D76A4,
+	0xB07092C0, 0xBB779BEC, 0xA67E8098, 0xAD7989B4, 0x9C6CB670, 0x976BBF5C, 0x8A62A428, 0x8165AD04,
+	0xE848DBA0, 0xE34FD28C, 0xFE46C9F8, 0xF541C0D4, 0xC454FF10, 0xCF53F63C, 0xD25AED48, 0xD95DE464,
+	0x602BEA17, 0x6B2CE33B, 0x7625F84F, 0x7D22F163, 0x4C37CEA7, 0x4730C78B, 0x5A39DCFF, 0x513ED5D3,
+	0x3813A377, 0x3314AA5B, 0x2E1DB12F, 0x251AB803, 0x140F87C7, 0x1F088EEB, 0x0201959F, 0x09069CB3,
+	0xD05B78D7, 0xDB5C71FB, 0xC6556A8F, 0xCD5263A3, 0xFC475C67, 0xF740554B, 0xEA494E3F, 0xE14E4713,
+	0x886331B7, 0x8364389B, 0x9E6D23EF, 0x956A2AC3, 0xA47F1507, 0xAF781C2B, 0xB271075F, 0xB9760E73,
+	0xC057D42E, 0xCB50DD02, 0xD659C676, 0xDD5ECF5A, 0xEC4BF09E, 0xE74CF9B2, 0xFA45E2C6, 0xF142EBEA,
+	0x986F9D4E, 0x93689462, 0x8E618F16, 0x8566863A, 0xB473B9FE, 0xBF74B0D2, 0xA27DABA6, 0xA97AA28A,
+	0x702746EE, 0x7B204FC2, 0x662954B6, 0x6D2E5D9A, 0x5C3B625E, 0x573C6B72, 0x4A357006, 0x4132792A,
+	0x281F0F8E, 0x231806A2, 0x3E111DD6, 0x351614FA, 0x04032B3E, 0x0F042212, 0x120D3966, 0x190A304A,
+	0xA07C3E39, 0xAB7B3715, 0xB6722C61, 0xBD75254D, 0x8C601A89, 0x876713A5, 0x9A6E08D1, 0x916901FD,
+	0xF8447759, 0xF3437E75, 0xEE4A6501, 0xE54D6C2D, 0xD45853E9, 0xDF5F5AC5, 0xC25641B1, 0xC951489D,
+	0x100CACF9, 0x1B0BA5D5, 0x0602BEA1, 0x0D05B78D, 0x3C108849, 0x37178165, 0x2A1E9A11, 0x2119933D,
+	0x4834E599, 0x4333ECB5, 0x5E3AF7C1, 0x553DFEED, 0x6428C129, 0x6F2FC805, 0x7226D371, 0x7921DA5D,
+	0x806567CB, 0x8B626EE7, 0x966B7593, 0x9D6C7CBF, 0xAC79437B, 0xA77E4A57, 0xBA775123, 0xB170580F,
+	0xD85D2EAB, 0xD35A2787, 0xCE533CF3, 0xC55435DF, 0xF4410A1B, 0xFF460337, 0xE24F1843, 0xE948116F,
+	0x3015F50B, 0x3B12FC27, 0x261BE753, 0x2D1CEE7F, 0x1C09D1BB, 0x170ED897, 0x0A07C3E3, 0x0100CACF,
+	0x682DBC6B, 0x632AB547, 0x7E23AE33, 0x7524A71F, 0x443198DB, 0x4F3691F7, 0x523F8A83, 0x593883AF,
+	0xE04E8DDC, 0xEB4984F0, 0xF6409F84, 0xFD4796A8, 0xCC52A96C, 0xC755A040, 0xDA5CBB34, 0xD15BB218,
+	0xB876C4BC, 0xB371CD90, 0xAE78D6E4, 0xA57FDFC8, 0x946AE00C, 0x9F6DE920, 0x8264F254, 0x8963FB78,
+	0x503E1F1C, 0x5B391630, 0x46300D44, 0x4D370468, 0x7C223BAC, 0x77253280, 0x6A2C29F4, 0x612B20D8,
+	0x0806567C, 0x03015F50, 0x1E084424, 0x150F4D08, 0x241A72CC, 0x2F1D7BE0, 0x32146094, 0x391369B8,
+	0x4032B3E5, 0x4B35BAC9, 0x563CA1BD, 0x5D3BA891, 0x6C2E9755, 0x67299E79, 0x7A20850D, 0x71278C21,
+	0x180AFA85, 0x130DF3A9, 0x0E04E8DD, 0x0503E1F1, 0x3416DE35, 0x3F11D719, 0x2218CC6D, 0x291FC541,
+	0xF0422125, 0xFB452809, 0xE64C337D, 0xED4B3A51, 0xDC5E0595, 0xD7590CB9, 0xCA5017CD, 0xC1571EE1,
+	0xA87A6845, 0xA37D6169, 0xBE747A1D, 0xB5737331, 0x84664CF5, 0x8F6145D9, 0x92685EAD, 0x996F5781,
+	0x201959F2, 0x2B1E50DE, 0x36174BAA, 0x3D104286, 0x0C057D42, 0x0702746E, 0x1A0B6F1A, 0x110C6636,
+	0x78211092, 0x732619BE, 0x6E2F02CA, 0x65280BE6, 0x543D3422, 0x5F3A3D0E, 0x4233267A, 0x49342F56,
+	0x9069CB32, 0x9B6EC21E, 0x8667D96A, 0x8D60D046, 0xBC75EF82, 0xB772E6AE, 0xAA7BFDDA, 0xA17CF4F6,
+	0xC8518252, 0xC3568B7E, 0xDE5F900A, 0xD5589926, 0xE44DA6E2, 0xEF4AAFCE, 0xF243B4BA, 0xF944BD96,
+	// Seed 0x96
+	0x00000000, 0x1B4B7ADE, 0x044E995F, 0x1F05E381, 0x089D32BE, 0x13D64860, 0x0CD3ABE1, 0x1798D13F,
+	0x113A657C, 0x0A711FA2, 0x1574FC23, 0x0E3F86FD, 0x19A757C2, 0x02EC2D1C, 0x1DE9CE9D, 0x06A2B443,
+	0x10ACA61B, 0x0BE7DCC5, 0x14E23F44, 0x0FA9459A, 0x183194A5, 0x037AEE7B, 0x1C7F0DFA, 0x07347724,
+	0x0196C367, 0x1ADDB9B9, 0x05D85A38, 0x1E9320E6, 0x090BF1D9, 0x12408B07, 0x0D456886, 0x160E1258,
+	0x138120D5, 0x08CA5A0B, 0x17CFB98A, 0x0C84C354, 0x1B1C126B, 0x005768B5, 0x1F528B34, 0x0419F1EA,
+	0x02BB45A9, 0x19F03F77, 0x06F5DCF6, 0x1DBEA628, 0x0A267717, 0x116D0DC9, 0x0E68EE48, 0x15239496,
+	0x032D86CE, 0x1866FC10, 0x07631F91, 0x1C28654F, 0x0BB0B470, 0x10FBCEAE, 0x0FFE2D2F, 0x14B557F1,
+	0x1217E3B2, 0x095C996C, 0x16597AED, 0x0D120033, 0x1A8AD10C, 0x01C1ABD2, 0x1EC44853, 0x058F328D,
+	0x15DA2D49, 0x0E915797, 0x1194B416, 0x0ADFCEC8, 0x1D471FF7, 0x060C6529, 0x190986A8, 0x0242FC76,
+	0x04E04835, 0x1FAB32EB, 0x00AED16A, 0x1BE5ABB4, 0x0C7D7A8B, 0x17360055, 0x0833E3D4, 0x1378990A,
+	0x05768B52, 0x1E3DF18C, 0x0138120D, 0x1A7368D3, 0x0DEBB9EC, 0x16A0C332, 0x09A520B3, 0x12EE5A6D,
+	0x144CEE2E, 0x0F0794F0, 0x10027771, 0x0B490DAF, 0x1CD1DC90, 0x079AA64E, 0x189F45CF, 0x03D43F11,
+	0x065B0D9C, 0x1D107742, 0x021594C3, 0x195EEE1D, 0x0EC63F22, 0x158D45FC, 0x0A88A67D, 0x11C3DCA3,
+	0x176168E0, 0x0C2A123E, 0x132FF1BF, 0x08648B61, 0x1FFC5A5E, 0x04B72080, 0x1BB2C301, 0x00F9B9DF,
+	0x16F7AB87, 0x0DBCD159, 0x12B932D8, 0x09F24806, 0x1E6A9939, 0x0521E3E7, 0x1A240066, 0x016F7AB8,
+	0x07CDCEFB, 0x1C86B425, 0x038357A4, 0x18C82D7A, 0x0F50FC45, 0x141B869B, 0x0B1E651A, 0x10551FC4,
+	0x196C3671, 0x02274CAF, 0x1D22AF2E, 0x0669D5F0, 0x11F104CF, 0x0ABA7E11, 0x15BF9D90, 0x0EF4E74E,
+	0x0856530D, 0x131D29D3, 0x0C18CA52, 0x1753B08C, 0x00CB61B3, 0x1B801B6D, 0x0485F8EC, 0x1FCE8232,
+	0x09C0906A, 0x128BEAB4, 0x0D8E0935, 0x16C573EB, 0x015DA2D4, 0x1A16D80A, 0x05133B8B, 0x1E584155,
+	0x18FAF516, 0x03B18FC8, 0x1CB46C49, 0x07FF1697, 0x1067C7A8, 0x0B2CBD76, 0x14295EF7, 0x0F622429,
+	0x0AED16A4, 0x11A66C7A, 0x0EA38FFB, 0x15E8F525, 0x0270241A, 0x193B5EC4, 0x063EBD45, 0x1D75C79B,
+	0x1BD773D8, 0x009C0906, 0x1F99EA87, 0x04D29059, 0x134A4166, 0x08013BB8, 0x1704D839, 0x0C4FA2E7,
+	0x1A41B0BF, 0x010ACA61, 0x1E0F29E0, 0x0544533E, 0x12DC8201, 0x0997F8DF, 0x16921B5E, 0x0DD96180,
+	0x0B7BD5C3, 0x1030AF1D, 0x0F354C9C, 0x147E3642, 0x03E6E77D, 0x18AD9DA3, 0x07A87E22, 0x1CE304FC,
+	0x0CB61B38, 0x17FD61E6, 0x08F88267, 0x13B3F8B9, 0x042B2986, 0x1F605358, 0x0065B0D9, 0x1B2ECA07,
+	0x1D8C7E44, 0x06C7049A, 0x19C2E71B, 0x02899DC5, 0x15114CFA, 0x0E5A3624, 0x115FD5A5, 0x0A14AF7B,
+	0x1C1ABD23, 0x0751C7FD, 0x1854247C, 0x031F5EA2, 0x14878F9D, 0x0FCCF543, 0x10C916C2, 0x0B826C1C,
+	0x0D20D85F, 0x166BA281, 0x096E4100, 0x12253BDE, 0x05BDEAE1, 0x1EF6903F, 0x01F373BE, 0x1AB80960,
+	0x1F373BED, 0x047C4133, 0x1B79A2B2, 0x0032D86C, 0x17AA0953, 0x0CE1738D, 0x13E4900C, 0x08AFEAD2,
+	0x0E0D5E91, 0x1546244F, 0x0A43C7CE, 0x1108BD10, 0x06906C2F, 0x1DDB16F1, 0x02DEF570, 0x19958FAE,
+	0x0F9B9DF6, 0x14D0E728, 0x0BD504A9, 0x109E7E77, 0x0706AF48, 0x1C4DD596, 0x03483617, 0x18034CC9,
+	0x1EA1F88A, 0x05EA8254, 0x1AEF61D5, 0x01A41B0B, 0x163CCA34, 0x0D77B0EA, 0x1272536B, 0x093929B5,
+	// Seed 0x97
+	0x00000000, 0x4E6C5EE7, 0x400EB001, 0x0E62EEE6, 0x5CCB6DCD, 0x12A7332A, 0x1CC5DDCC, 0x52A9832B,
+	0x6540D655, 0x2B2C88B2, 0x254E6654, 0x6B2238B3, 0x398BBB98, 0x77E7E57F, 0x79850B99, 0x37E9557E,
+	0x1657A165, 0x583BFF82, 0x56591164, 0x18354F83, 0x4A9CCCA8, 0x04F0924F, 0x0A927CA9, 0x44FE224E,
+	0x73177730, 0x3D7B29D7, 0x3319C731, 0x7D7599D6, 0x2FDC1AFD, 0x61B0441A, 0x6FD2AAFC, 0x21BEF41B,
+	0x2CAF42CA, 0x62C31C2D, 0x6CA1F2CB, 0x22CDAC2C, 0x70642F07, 0x3E0871E0, 0x306A9F06, 0x7E06C1E1,
+	0x49EF949F, 0x0783CA78, 0x09E1249E, 0x478D7A79, 0x1524F952, 0x5B48A7B5, 0x552A4953, 0x1B4617B4,
+	0x3AF8E3AF, 0x7494BD48, 0x7AF653AE, 0x349A0D49, 0x66338E62, 0x285FD085, 0x263D3E63, 0x68516084,
+	0x5FB835FA, 0x11D46B1D, 0x1FB685FB, 0x51DADB1C, 0x03735837, 0x4D1F06D0, 0x437DE836, 0x0D11B6D1,
+	0x595E8594, 0x1732DB73, 0x19503595, 0x573C6B72, 0x0595E859, 0x4BF9B6BE, 0x459B5858, 0x0BF706BF,
+	0x3C1E53C1, 0x72720D26, 0x7C10E3C0, 0x327CBD27, 0x60D53E0C, 0x2EB960EB, 0x20DB8E0D, 0x6EB7D0EA,
+	0x4F0924F1, 0x01657A16, 0x0F0794F0, 0x416BCA17, 0x13C2493C, 0x5DAE17DB, 0x53CCF93D, 0x1DA0A7DA,
+	0x2A49F2A4, 0x6425AC43, 0x6A4742A5, 0x242B1C42, 0x76829F69, 0x38EEC18E, 0x368C2F68, 0x78E0718F,
+	0x75F1C75E, 0x3B9D99B9, 0x35FF775F, 0x7B9329B8, 0x293AAA93, 0x6756F474, 0x69341A92, 0x27584475,
+	0x10B1110B, 0x5EDD4FEC, 0x50BFA10A, 0x1ED3FFED, 0x4C7A7CC6, 0x02162221, 0x0C74CCC7, 0x42189220,
+	0x63A6663B, 0x2DCA38DC, 0x23A8D63A, 0x6DC488DD, 0x3F6D0BF6, 0x71015511, 0x7F63BBF7, 0x310FE510,
+	0x06E6B06E, 0x488AEE89, 0x46E8006F, 0x08845E88, 0x5A2DDDA3, 0x14418344, 0x1A236DA2, 0x544F3345,
+	0x6E6B06E7, 0x20075800, 0x2E65B6E6, 0x6009E801, 0x32A06B2A, 0x7CCC35CD, 0x72AEDB2B, 0x3CC285CC,
+	0x0B2BD0B2, 0x45478E55, 0x4B2560B3, 0x05493E54, 0x57E0BD7F, 0x198CE398, 0x17EE0D7E, 0x59825399,
+	0x783CA782, 0x3650F965, 0x38321783, 0x765E4964, 0x24F7CA4F, 0x6A9B94A8, 0x64F97A4E, 0x2A9524A9,
+	0x1D7C71D7, 0x53102F30, 0x5D72C1D6, 0x131E9F31, 0x41B71C1A, 0x0FDB42FD, 0x01B9AC1B, 0x4FD5F2FC,
+	0x42C4442D, 0x0CA81ACA, 0x02CAF42C, 0x4CA6AACB, 0x1E0F29E0, 0x50637707, 0x5E0199E1, 0x106DC706,
+	0x27849278, 0x69E8CC9F, 0x678A2279, 0x29E67C9E, 0x7B4FFFB5, 0x3523A152, 0x3B414FB4, 0x752D1153,
+	0x5493E548, 0x1AFFBBAF, 0x149D5549, 0x5AF10BAE, 0x08588885, 0x4634D662, 0x48563884, 0x063A6663,
+	0x31D3331D, 0x7FBF6DFA, 0x71DD831C, 0x3FB1DDFB, 0x6D185ED0, 0x23740037, 0x2D16EED1, 0x637AB036,
+	0x37358373, 0x7959DD94, 0x773B3372, 0x39576D95, 0x6BFEEEBE, 0x2592B059, 0x2BF05EBF, 0x659C0058,
+	0x52755526, 0x1C190BC1, 0x127BE527, 0x5C17BBC0, 0x0EBE38EB, 0x40D2660C, 0x4EB088EA, 0x00DCD60D,
+	0x21622216, 0x6F0E7CF1, 0x616C9217, 0x2F00CCF0, 0x7DA94FDB, 0x33C5113C, 0x3DA7FFDA, 0x73CBA13D,
+	0x4422F443, 0x0A4EAAA4, 0x042C4442, 0x4A401AA5, 0x18E9998E, 0x5685C769, 0x58E7298F, 0x168B7768,
+	0x1B9AC1B9, 0x55F69F5E, 0x5B9471B8, 0x15F82F5F, 0x4751AC74, 0x093DF293, 0x075F1C75, 0x49334292,
+	0x7EDA17EC, 0x30B6490B, 0x3ED4A7ED, 0x70B8F90A, 0x22117A21, 0x6C7D24C6, 0x621FCA20, 0x2C7394C7,
+	0x0DCD60DC, 0x43A13E3B, 0x4DC3D0DD, 0x03AF8E3A, 0x51060D11, 0x1F6A53F6, 0x1108BD10, 0x5F64E3F7,
+	0x688DB689, 0x26E1E86E, 0x28830688, 0x66EF586F, 0x3446DB44, 0x7A2A85A3, 0x74486B45, 0x3A2435A2,
+	// Seed 0x98
+	0x00000000, 0x56E3C152, 0xADC782A4, 0xFB2443F6, 0xA62733A5, 0xF0C4F2F7, 0x0BE0B101, 0x5D037053,
+	0xB1E651A7, 0xE70590F5, 0x1C21D303, 0x4AC21251, 0x17C16202, 0x4122A350, 0xBA06E0A6, 0xECE521F4,
+	0x9E6495A3, 0xC88754F1, 0x33A31707, 0x6540D655, 0x3843A606, 0x6EA06754, 0x958424A2, 0xC367E5F0,
+	0x2F82C404, 0x79610556, 0x824546A0, 0xD4A687F2, 0x89A5F7A1, 0xDF4636F3, 0x24627505, 0x7281B457,
+	0xC1611DAB, 0x9782DCF9, 0x6CA69F0F, 0x3A455E5D, 0x67462E0E, 0x31A5EF5C, 0xCA81ACAA, 0x9C626DF8,
+	0x70874C0C, 0x26648D5E, 0xDD40CEA8, 0x8BA30FFA, 0xD6A07FA9, 0x8043BEFB, 0x7B67FD0D, 0x2D843C5F,
+	0x5F058808, 0x09E6495A, 0xF2C20AAC, 0xA421CBFE, 0xF922BBAD, 0xAFC17AFF, 0x54E53909, 0x0206F85B,
+	0xEEE3D9AF, 0xB80018FD, 0x43245B0B, 0x15C79A59, 0x48C4EA0A, 0x1E272B58, 0xE50368AE, 0xB3E0A9FC,
+	0x7F6A0DBB, 0x2989CCE9, 0xD2AD8F1F, 0x844E4E4D, 0xD94D3E1E, 0x8FAEFF4C, 0x748ABCBA, 0x22697DE8,
+	0xCE8C5C1C, 0x986F9D4E, 0x634BDEB8, 0x35A81FEA, 0x68AB6FB9, 0x3E48AEEB, 0xC56CED1D, 0x938F2C4F,
+	0xE10E9818, 0xB7ED594A, 0x4CC91ABC, 0x1A2ADBEE, 0x4729ABBD, 0x11CA6AEF, 0xEAEE2919, 0xBC0DE84B,
+	0x50E8C9BF, 0x060B08ED, 0xFD2F4B1B, 0xABCC8A49, 0xF6CFFA1A, 0xA02C3B48, 0x5B0878BE, 0x0DEBB9EC,
+	0xBE0B1010, 0xE8E8D142, 0x13CC92B4, 0x452F53E6, 0x182C23B5, 0x4ECFE2E7, 0xB5EBA111, 0xE3086043,
+	0x0FED41B7, 0x590E80E5, 0xA22AC313, 0xF4C90241, 0xA9CA7212, 0xFF29B340, 0x040DF0B6, 0x52EE31E4,
+	0x206F85B3, 0x768C44E1, 0x8DA80717, 0xDB4BC645, 0x8648B616, 0xD0AB7744, 0x2B8F34B2, 0x7D6CF5E0,
+	0x9189D414, 0xC76A1546, 0x3C4E56B0, 0x6AAD97E2, 0x37AEE7B1, 0x614D26E3, 0x9A696515, 0xCC8AA447,
+	0xFED41B76, 0xA837DA24, 0x531399D2, 0x05F05880, 0x58F328D3, 0x0E10E981, 0xF534AA77, 0xA3D76B25,
+	0x4F324AD1, 0x19D18B83, 0xE2F5C875, 0xB4160927, 0xE9157974, 0xBFF6B826, 0x44D2FBD0, 0x12313A82,
+	0x60B08ED5, 0x36534F87, 0xCD770C71, 0x9B94CD23, 0xC697BD70, 0x90747C22, 0x6B503FD4, 0x3DB3FE86,
+	0xD156DF72, 0x87B51E20, 0x7C915DD6, 0x2A729C84, 0x7771ECD7, 0x21922D85, 0xDAB66E73, 0x8C55AF21,
+	0x3FB506DD, 0x6956C78F, 0x92728479, 0xC491452B, 0x99923578, 0xCF71F42A, 0x3455B7DC, 0x62B6768E,
+	0x8E53577A, 0xD8B09628, 0x2394D5DE, 0x7577148C, 0x287464DF, 0x7E97A58D, 0x85B3E67B, 0xD3502729,
+	0xA1D1937E, 0xF732522C, 0x0C1611DA, 0x5AF5D088, 0x07F6A0DB, 0x51156189, 0xAA31227F, 0xFCD2E32D,
+	0x1037C2D9, 0x46D4038B, 0xBDF0407D, 0xEB13812F, 0xB610F17C, 0xE0F3302E, 0x1BD773D8, 0x4D34B28A,
+	0x81BE16CD, 0xD75DD79F, 0x2C799469, 0x7A9A553B, 0x27992568, 0x717AE43A, 0x8A5EA7CC, 0xDCBD669E,
+	0x3058476A, 0x66BB8638, 0x9D9FC5CE, 0xCB7C049C, 0x967F74CF, 0xC09CB59D, 0x3BB8F66B, 0x6D5B3739,
+	0x1FDA836E, 0x4939423C, 0xB21D01CA, 0xE4FEC098, 0xB9FDB0CB, 0xEF1E7199, 0x143A326F, 0x42D9F33D,
+	0xAE3CD2C9, 0xF8DF139B, 0x03FB506D, 0x5518913F, 0x081BE16C, 0x5EF8203E, 0xA5DC63C8, 0xF33FA29A,
+	0x40DF0B66, 0x163CCA34, 0xED1889C2, 0xBBFB4890, 0xE6F838C3, 0xB01BF991, 0x4B3FBA67, 0x1DDC7B35,
+	0xF1395AC1, 0xA7DA9B93, 0x5CFED865, 0x0A1D1937, 0x571E6964, 0x01FDA836, 0xFAD9EBC0, 0xAC3A2A92,
+	0xDEBB9EC5, 0x88585F97, 0x737C1C61, 0x259FDD33, 0x789CAD60, 0x2E7F6C32, 0xD55B2FC4, 0x83B8EE96,
+	0x6F5DCF62, 0x39BE0E30, 0xC29A4DC6, 0x94798C94, 0xC97AFCC7, 0x9F993D95, 0x64BD7E63, 0x325EBF31,
+	// Seed 0x99
+	0x00000000, 0xCC291847, 0x8BF4674F, 0x47DD7F08, 0x044E995F, 0xC8678118, 0x8FBAFE10, 0x4393E657,
+	0x089D32BE, 0xC4B42AF9, 0x836955F1, 0x4F404DB6, 0x0CD3ABE1, 0xC0FAB3A6, 0x8727CCAE, 0x4B0ED4E9,
+	0x113A657C, 0xDD137D3B, 0x9ACE0233, 0x56E71A74, 0x1574FC23, 0xD95DE464, 0x9E809B6C, 0x52A9832B,
+	0x19A757C2, 0xD58E4F85, 0x9253308D, 0x5E7A28CA, 0x1DE9CE9D, 0xD1C0D6DA, 0x961DA9D2, 0x5A34B195,
+	0x2274CAF8, 0xEE5DD2BF, 0xA980ADB7, 0x65A9B5F0, 0x263A53A7, 0xEA134BE0, 0xADCE34E8, 0x61E72CAF,
+	0x2AE9F846, 0xE6C0E001, 0xA11D9F09, 0x6D34874E, 0x2EA76119, 0xE28E795E, 0xA5530656, 0x697A1E11,
+	0x334EAF84, 0xFF67B7C3, 0xB8BAC8CB, 0x7493D08C, 0x370036DB, 0xFB292E9C, 0xBCF45194, 0x70DD49D3,
+	0x3BD39D3A, 0xF7FA857D, 0xB027FA75, 0x7C0EE232, 0x3F9D0465, 0xF3B41C22, 0xB469632A, 0x78407B6D,
+	0x44E995F0, 0x88C08DB7, 0xCF1DF2BF, 0x0334EAF8, 0x40A70CAF, 0x8C8E14E8, 0xCB536BE0, 0x077A73A7,
+	0x4C74A74E, 0x805DBF09, 0xC780C001, 0x0BA9D846, 0x483A3E11, 0x84132656, 0xC3CE595E, 0x0FE74119,
+	0x55D3F08C, 0x99FAE8CB, 0xDE2797C3, 0x120E8F84, 0x519D69D3, 0x9DB47194, 0xDA690E9C, 0x164016DB,
+	0x5D4EC232, 0x9167DA75, 0xD6BAA57D, 0x1A93BD3A, 0x59005B6D, 0x9529432A, 0xD2F43C22, 0x1EDD2465,
+	0x669D5F08, 0xAAB4474F, 0xED693847, 0x21402000, 0x62D3C657, 0xAEFADE10, 0xE927A118, 0x250EB95F,
+	0x6E006DB6, 0xA22975F1, 0xE5F40AF9, 0x29DD12BE, 0x6A4EF4E9, 0xA667ECAE, 0xE1BA93A6, 0x2D938BE1,
+	0x77A73A74, 0xBB8E2233, 0xFC535D3B, 0x307A457C, 0x73E9A32B, 0xBFC0BB6C, 0xF81DC464, 0x3434DC23,
+	0x7F3A08CA, 0xB313108D, 0xF4CE6F85, 0x38E777C2, 0x7B749195, 0xB75D89D2, 0xF080F6DA, 0x3CA9EE9D,
+	0x89D32BE0, 0x45FA33A7, 0x02274CAF, 0xCE0E54E8, 0x8D9DB2BF, 0x41B4AAF8, 0x0669D5F0, 0xCA40CDB7,
+	0x814E195E, 0x4D670119, 0x0ABA7E11, 0xC6936656, 0x85008001, 0x49299846, 0x0EF4E74E, 0xC2DDFF09,
+	0x98E94E9C, 0x54C056DB, 0x131D29D3, 0xDF343194, 0x9CA7D7C3, 0x508ECF84, 0x1753B08C, 0xDB7AA8CB,
+	0x90747C22, 0x5C5D6465, 0x1B801B6D, 0xD7A9032A, 0x943AE57D, 0x5813FD3A, 0x1FCE8232, 0xD3E79A75,
+	0xABA7E118, 0x678EF95F, 0x20538657, 0xEC7A9E10, 0xAFE97847, 0x63C06000, 0x241D1F08, 0xE834074F,
+	0xA33AD3A6, 0x6F13CBE1, 0x28CEB4E9, 0xE4E7ACAE, 0xA7744AF9, 0x6B5D52BE, 0x2C802DB6, 0xE0A935F1,
+	0xBA9D8464, 0x76B49C23, 0x3169E32B, 0xFD40FB6C, 0xBED31D3B, 0x72FA057C, 0x35277A74, 0xF90E6233,
+	0xB200B6DA, 0x7E29AE9D, 0x39F4D195, 0xF5DDC9D2, 0xB64E2F85, 0x7A6737C2, 0x3DBA48CA, 0xF193508D,
+	0xCD3ABE10, 0x0113A657, 0x46CED95F, 0x8AE7C118, 0xC974274F, 0x055D3F08, 0x42804000, 0x8EA95847,
+	0xC5A78CAE, 0x098E94E9, 0x4E53EBE1, 0x827AF3A6, 0xC1E915F1, 0x0DC00DB6, 0x4A1D72BE, 0x86346AF9,
+	0xDC00DB6C, 0x1029C32B, 0x57F4BC23, 0x9BDDA464, 0xD84E4233, 0x14675A74, 0x53BA257C, 0x9F933D3B,
+	0xD49DE9D2, 0x18B4F195, 0x5F698E9D, 0x934096DA, 0xD0D3708D, 0x1CFA68CA, 0x5B2717C2, 0x970E0F85,
+	0xEF4E74E8, 0x23676CAF, 0x64BA13A7, 0xA8930BE0, 0xEB00EDB7, 0x2729F5F0, 0x60F48AF8, 0xACDD92BF,
+	0xE7D34656, 0x2BFA5E11, 0x6C272119, 0xA00E395E, 0xE39DDF09, 0x2FB4C74E, 0x6869B846, 0xA440A001,
+	0xFE741194, 0x325D09D3, 0x758076DB, 0xB9A96E9C, 0xFA3A88CB, 0x3613908C, 0x71CEEF84, 0xBDE7F7C3,
+	0xF6E9232A, 0x3AC03B6D, 0x7D1D4465, 0xB1345C22, 0xF2A7BA75, 0x3E8EA232, 0x7953DD3A, 0xB57AC57D,
+	// Seed 0x9A
+	0x00000000, 0x1C26BEC7, 0x19F9893B, 0x05DF37FC, 0x1247E6C3, 0x0E615804, 0x0BBE6FF8, 0x1798D13F,
+	0x053B3933, 0x191D87F4, 0x1CC2B008, 0x00E40ECF, 0x177CDFF0, 0x0B5A6137, 0x0E8556CB, 0x12A3E80C,
+	0x0A767266, 0x1650CCA1, 0x138FFB5D, 0x0FA9459A, 0x183194A5, 0x04172A62, 0x01C81D9E, 0x1DEEA359,
+	0x0F4D4B55, 0x136BF592, 0x16B4C26E, 0x0A927CA9, 0x1D0AAD96, 0x012C1351, 0x04F324AD, 0x18D59A6A,
+	0x14ECE4CC, 0x08CA5A0B, 0x0D156DF7, 0x1133D330, 0x06AB020F, 0x1A8DBCC8, 0x1F528B34, 0x037435F3,
+	0x11D7DDFF, 0x0DF16338, 0x082E54C4, 0x1408EA03, 0x03903B3C, 0x1FB685FB, 0x1A69B207, 0x064F0CC0,
+	0x1E9A96AA, 0x02BC286D, 0x07631F91, 0x1B45A156, 0x0CDD7069, 0x10FBCEAE, 0x1524F952, 0x09024795,
+	0x1BA1AF99, 0x0787115E, 0x025826A2, 0x1E7E9865, 0x09E6495A, 0x15C0F79D, 0x101FC061, 0x0C397EA6,
+	0x086D3D2D, 0x144B83EA, 0x1194B416, 0x0DB20AD1, 0x1A2ADBEE, 0x060C6529, 0x03D352D5, 0x1FF5EC12,
+	0x0D56041E, 0x1170BAD9, 0x14AF8D25, 0x088933E2, 0x1F11E2DD, 0x03375C1A, 0x06E86BE6, 0x1ACED521,
+	0x021B4F4B, 0x1E3DF18C, 0x1BE2C670, 0x07C478B7, 0x105CA988, 0x0C7A174F, 0x09A520B3, 0x15839E74,
+	0x07207678, 0x1B06C8BF, 0x1ED9FF43, 0x02FF4184, 0x156790BB, 0x09412E7C, 0x0C9E1980, 0x10B8A747,
+	0x1C81D9E1, 0x00A76726, 0x057850DA, 0x195EEE1D, 0x0EC63F22, 0x12E081E5, 0x173FB619, 0x0B1908DE,
+	0x19BAE0D2, 0x059C5E15, 0x004369E9, 0x1C65D72E, 0x0BFD0611, 0x17DBB8D6, 0x12048F2A, 0x0E2231ED,
+	0x16F7AB87, 0x0AD11540, 0x0F0E22BC, 0x13289C7B, 0x04B04D44, 0x1896F383, 0x1D49C47F, 0x016F7AB8,
+	0x13CC92B4, 0x0FEA2C73, 0x0A351B8F, 0x1613A548, 0x018B7477, 0x1DADCAB0, 0x1872FD4C, 0x0454438B,
+	0x10DA7A5A, 0x0CFCC49D, 0x0923F361, 0x15054DA6, 0x029D9C99, 0x1EBB225E, 0x1B6415A2, 0x0742AB65,
+	0x15E14369, 0x09C7FDAE, 0x0C18CA52, 0x103E7495, 0x07A6A5AA, 0x1B801B6D, 0x1E5F2C91, 0x02799256,
+	0x1AAC083C, 0x068AB6FB, 0x03558107, 0x1F733FC0, 0x08EBEEFF, 0x14CD5038, 0x111267C4, 0x0D34D903,
+	0x1F97310F, 0x03B18FC8, 0x066EB834, 0x1A4806F3, 0x0DD0D7CC, 0x11F6690B, 0x14295EF7, 0x080FE030,
+	0x04369E96, 0x18102051, 0x1DCF17AD, 0x01E9A96A, 0x16717855, 0x0A57C692, 0x0F88F16E, 0x13AE4FA9,
+	0x010DA7A5, 0x1D2B1962, 0x18F42E9E, 0x04D29059, 0x134A4166, 0x0F6CFFA1, 0x0AB3C85D, 0x1695769A,
+	0x0E40ECF0, 0x12665237, 0x17B965CB, 0x0B9FDB0C, 0x1C070A33, 0x0021B4F4, 0x05FE8308, 0x19D83DCF,
+	0x0B7BD5C3, 0x175D6B04, 0x12825CF8, 0x0EA4E23F, 0x193C3300, 0x051A8DC7, 0x00C5BA3B, 0x1CE304FC,
+	0x18B74777, 0x0491F9B0, 0x014ECE4C, 0x1D68708B, 0x0AF0A1B4, 0x16D61F73, 0x1309288F, 0x0F2F9648,
+	0x1D8C7E44, 0x01AAC083, 0x0475F77F, 0x185349B8, 0x0FCB9887, 0x13ED2640, 0x163211BC, 0x0A14AF7B,
+	0x12C13511, 0x0EE78BD6, 0x0B38BC2A, 0x171E02ED, 0x0086D3D2, 0x1CA06D15, 0x197F5AE9, 0x0559E42E,
+	0x17FA0C22, 0x0BDCB2E5, 0x0E038519, 0x12253BDE, 0x05BDEAE1, 0x199B5426, 0x1C4463DA, 0x0062DD1D,
+	0x0C5BA3BB, 0x107D1D7C, 0x15A22A80, 0x09849447, 0x1E1C4578, 0x023AFBBF, 0x07E5CC43, 0x1BC37284,
+	0x09609A88, 0x1546244F, 0x109913B3, 0x0CBFAD74, 0x1B277C4B, 0x0701C28C, 0x02DEF570, 0x1EF84BB7,
+	0x062DD1DD, 0x1A0B6F1A, 0x1FD458E6, 0x03F2E621, 0x146A371E, 0x084C89D9, 0x0D93BE25, 0x11B500E2,
+	0x0316E8EE, 0x1F305629, 0x1AEF61D5, 0x06C9DF12, 0x11510E2D, 0x0D77B0EA, 0x08A88716, 0x148E39D1,
+	// Seed 0x9B
+	0x00000000, 0x5E7A28CA, 0x734EC40D, 0x2D34ECC7, 0x29271D83, 0x775D3549, 0x5A69D98E, 0x0413F144,
+	0x524E3B06, 0x0C3413CC, 0x2100FF0B, 0x7F7AD7C1, 0x7B692685, 0x25130E4F, 0x0827E288, 0x565DCA42,
+	0x6B26E395, 0x355CCB5F, 0x18682798, 0x46120F52, 0x4201FE16, 0x1C7BD6DC, 0x314F3A1B, 0x6F3512D1,
+	0x3968D893, 0x6712F059, 0x4A261C9E, 0x145C3454, 0x104FC510, 0x4E35EDDA, 0x6301011D, 0x3D7B29D7,
+	0x19F752B3, 0x478D7A79, 0x6AB996BE, 0x34C3BE74, 0x30D04F30, 0x6EAA67FA, 0x439E8B3D, 0x1DE4A3F7,
+	0x4BB969B5, 0x15C3417F, 0x38F7ADB8, 0x668D8572, 0x629E7436, 0x3CE45CFC, 0x11D0B03B, 0x4FAA98F1,
+	0x72D1B126, 0x2CAB99EC, 0x019F752B, 0x5FE55DE1, 0x5BF6ACA5, 0x058C846F, 0x28B868A8, 0x76C24062,
+	0x209F8A20, 0x7EE5A2EA, 0x53D14E2D, 0x0DAB66E7, 0x09B897A3, 0x57C2BF69, 0x7AF653AE, 0x248C7B64,
+	0x33EEA566, 0x6D948DAC, 0x40A0616B, 0x1EDA49A1, 0x1AC9B8E5, 0x44B3902F, 0x69877CE8, 0x37FD5422,
+	0x61A09E60, 0x3FDAB6AA, 0x12EE5A6D, 0x4C9472A7, 0x488783E3, 0x16FDAB29, 0x3BC947EE, 0x65B36F24,
+	0x58C846F3, 0x06B26E39, 0x2B8682FE, 0x75FCAA34, 0x71EF5B70, 0x2F9573BA, 0x02A19F7D, 0x5CDBB7B7,
+	0x0A867DF5, 0x54FC553F, 0x79C8B9F8, 0x27B29132, 0x23A16076, 0x7DDB48BC, 0x50EFA47B, 0x0E958CB1,
+	0x2A19F7D5, 0x7463DF1F, 0x595733D8, 0x072D1B12, 0x033EEA56, 0x5D44C29C, 0x70702E5B, 0x2E0A0691,
+	0x7857CCD3, 0x262DE419, 0x0B1908DE, 0x55632014, 0x5170D150, 0x0F0AF99A, 0x223E155D, 0x7C443D97,
+	0x413F1440, 0x1F453C8A, 0x3271D04D, 0x6C0BF887, 0x681809C3, 0x36622109, 0x1B56CDCE, 0x452CE504,
+	0x13712F46, 0x4D0B078C, 0x603FEB4B, 0x3E45C381, 0x3A5632C5, 0x642C1A0F, 0x4918F6C8, 0x1762DE02,
+	0x67DD4ACC, 0x39A76206, 0x14938EC1, 0x4AE9A60B, 0x4EFA574F, 0x10807F85, 0x3DB49342, 0x63CEBB88,
+	0x359371CA, 0x6BE95900, 0x46DDB5C7, 0x18A79D0D, 0x1CB46C49, 0x42CE4483, 0x6FFAA844, 0x3180808E,
+	0x0CFBA959, 0x52818193, 0x7FB56D54, 0x21CF459E, 0x25DCB4DA, 0x7BA69C10, 0x569270D7, 0x08E8581D,
+	0x5EB5925F, 0x00CFBA95, 0x2DFB5652, 0x73817E98, 0x77928FDC, 0x29E8A716, 0x04DC4BD1, 0x5AA6631B,
+	0x7E2A187F, 0x205030B5, 0x0D64DC72, 0x531EF4B8, 0x570D05FC, 0x09772D36, 0x2443C1F1, 0x7A39E93B,
+	0x2C642379, 0x721E0BB3, 0x5F2AE774, 0x0150CFBE, 0x05433EFA, 0x5B391630, 0x760DFAF7, 0x2877D23D,
+	0x150CFBEA, 0x4B76D320, 0x66423FE7, 0x3838172D, 0x3C2BE669, 0x6251CEA3, 0x4F652264, 0x111F0AAE,
+	0x4742C0EC, 0x1938E826, 0x340C04E1, 0x6A762C2B, 0x6E65DD6F, 0x301FF5A5, 0x1D2B1962, 0x435131A8,
+	0x5433EFAA, 0x0A49C760, 0x277D2BA7, 0x7907036D, 0x7D14F229, 0x236EDAE3, 0x0E5A3624, 0x50201EEE,
+	0x067DD4AC, 0x5807FC66, 0x753310A1, 0x2B49386B, 0x2F5AC92F, 0x7120E1E5, 0x5C140D22, 0x026E25E8,
+	0x3F150C3F, 0x616F24F5, 0x4C5BC832, 0x1221E0F8, 0x163211BC, 0x48483976, 0x657CD5B1, 0x3B06FD7B,
+	0x6D5B3739, 0x33211FF3, 0x1E15F334, 0x406FDBFE, 0x447C2ABA, 0x1A060270, 0x3732EEB7, 0x6948C67D,
+	0x4DC4BD19, 0x13BE95D3, 0x3E8A7914, 0x60F051DE, 0x64E3A09A, 0x3A998850, 0x17AD6497, 0x49D74C5D,
+	0x1F8A861F, 0x41F0AED5, 0x6CC44212, 0x32BE6AD8, 0x36AD9B9C, 0x68D7B356, 0x45E35F91, 0x1B99775B,
+	0x26E25E8C, 0x78987646, 0x55AC9A81, 0x0BD6B24B, 0x0FC5430F, 0x51BF6BC5, 0x7C8B8702, 0x22F1AFC8,
+	0x74AC658A, 0x2AD64D40, 0x07E2A187, 0x5998894D, 0x5D8B7809, 0x03F150C3, 0x2EC5BC04, 0x70BF94CE,
+	// Seed 0x9C
+	0x00000000, 0xC5C23C77, 0x78F7C631, 0xBD35FA46, 0xF1EF8C62, 0x342DB015, 0x89184A53, 0x4CDA7624,
+	0x10ACA61B, 0xD56E9A6C, 0x685B602A, 0xAD995C5D, 0xE1432A79, 0x2481160E, 0x99B4EC48, 0x5C76D03F,
+	0x21594C36, 0xE49B7041, 0x59AE8A07, 0x9C6CB670, 0xD0B6C054, 0x1574FC23, 0xA8410665, 0x6D833A12,
+	0x31F5EA2D, 0xF437D65A, 0x49022C1C, 0x8CC0106B, 0xC01A664F, 0x05D85A38, 0xB8EDA07E, 0x7D2F9C09,
+	0x42B2986C, 0x8770A41B, 0x3A455E5D, 0xFF87622A, 0xB35D140E, 0x769F2879, 0xCBAAD23F, 0x0E68EE48,
+	0x521E3E77, 0x97DC0200, 0x2AE9F846, 0xEF2BC431, 0xA3F1B215, 0x66338E62, 0xDB067424, 0x1EC44853,
+	0x63EBD45A, 0xA629E82D, 0x1B1C126B, 0xDEDE2E1C, 0x92045838, 0x57C6644F, 0xEAF39E09, 0x2F31A27E,
+	0x73477241, 0xB6854E36, 0x0BB0B470, 0xCE728807, 0x82A8FE23, 0x476AC254, 0xFA5F3812, 0x3F9D0465,
+	0x856530D8, 0x40A70CAF, 0xFD92F6E9, 0x3850CA9E, 0x748ABCBA, 0xB14880CD, 0x0C7D7A8B, 0xC9BF46FC,
+	0x95C996C3, 0x500BAAB4, 0xED3E50F2, 0x28FC6C85, 0x64261AA1, 0xA1E426D6, 0x1CD1DC90, 0xD913E0E7,
+	0xA43C7CEE, 0x61FE4099, 0xDCCBBADF, 0x190986A8, 0x55D3F08C, 0x9011CCFB, 0x2D2436BD, 0xE8E60ACA,
+	0xB490DAF5, 0x7152E682, 0xCC671CC4, 0x09A520B3, 0x457F5697, 0x80BD6AE0, 0x3D8890A6, 0xF84AACD1,
+	0xC7D7A8B4, 0x021594C3, 0xBF206E85, 0x7AE252F2, 0x363824D6, 0xF3FA18A1, 0x4ECFE2E7, 0x8B0DDE90,
+	0xD77B0EAF, 0x12B932D8, 0xAF8CC89E, 0x6A4EF4E9, 0x269482CD, 0xE356BEBA, 0x5E6344FC, 0x9BA1788B,
+	0xE68EE482, 0x234CD8F5, 0x9E7922B3, 0x5BBB1EC4, 0x176168E0, 0xD2A35497, 0x6F96AED1, 0xAA5492A6,
+	0xF6224299, 0x33E07EEE, 0x8ED584A8, 0x4B17B8DF, 0x07CDCEFB, 0xC20FF28C, 0x7F3A08CA, 0xBAF834BD,
+	0xF9B9DF6F, 0x3C7BE318, 0x814E195E, 0x448C2529, 0x0856530D, 0xCD946F7A, 0x70A1953C, 0xB563A94B,
+	0xE9157974, 0x2CD74503, 0x91E2BF45, 0x54208332, 0x18FAF516, 0xDD38C961, 0x600D3327, 0xA5CF0F50,
+	0xD8E09359, 0x1D22AF2E, 0xA0175568, 0x65D5691F, 0x290F1F3B, 0xECCD234C, 0x51F8D90A, 0x943AE57D,
+	0xC84C3542, 0x0D8E0935, 0xB0BBF373, 0x7579CF04, 0x39A3B920, 0xFC618557, 0x41547F11, 0x84964366,
+	0xBB0B4703, 0x7EC97B74, 0xC3FC8132, 0x063EBD45, 0x4AE4CB61, 0x8F26F716, 0x32130D50, 0xF7D13127,
+	0xABA7E118, 0x6E65DD6F, 0xD3502729, 0x16921B5E, 0x5A486D7A, 0x9F8A510D, 0x22BFAB4B, 0xE77D973C,
+	0x9A520B35, 0x5F903742, 0xE2A5CD04, 0x2767F173, 0x6BBD8757, 0xAE7FBB20, 0x134A4166, 0xD6887D11,
+	0x8AFEAD2E, 0x4F3C9159, 0xF2096B1F, 0x37CB5768, 0x7B11214C, 0xBED31D3B, 0x03E6E77D, 0xC624DB0A,
+	0x7CDCEFB7, 0xB91ED3C0, 0x042B2986, 0xC1E915F1, 0x8D3363D5, 0x48F15FA2, 0xF5C4A5E4, 0x30069993,
+	0x6C7049AC, 0xA9B275DB, 0x14878F9D, 0xD145B3EA, 0x9D9FC5CE, 0x585DF9B9, 0xE56803FF, 0x20AA3F88,
+	0x5D85A381, 0x98479FF6, 0x257265B0, 0xE0B059C7, 0xAC6A2FE3, 0x69A81394, 0xD49DE9D2, 0x115FD5A5,
+	0x4D29059A, 0x88EB39ED, 0x35DEC3AB, 0xF01CFFDC, 0xBCC689F8, 0x7904B58F, 0xC4314FC9, 0x01F373BE,
+	0x3E6E77DB, 0xFBAC4BAC, 0x4699B1EA, 0x835B8D9D, 0xCF81FBB9, 0x0A43C7CE, 0xB7763D88, 0x72B401FF,
+	0x2EC2D1C0, 0xEB00EDB7, 0x563517F1, 0x93F72B86, 0xDF2D5DA2, 0x1AEF61D5, 0xA7DA9B93, 0x6218A7E4,
+	0x1F373BED, 0xDAF5079A, 0x67C0FDDC, 0xA202C1AB, 0xEED8B78F, 0x2B1A8BF8, 0x962F71BE, 0x53ED4DC9,
+	0x0F9B9DF6, 0xCA59A181, 0x776C5BC7, 0xB2AE67B0, 0xFE741194, 0x3BB62DE3, 0x8683D7A5, 0x4341EBD2,
+	// Seed 0x9D
+	0x00000000, 0xC65807E5, 0x91CDD039, 0x5795D7DC, 0x3EE67F81, 0xF8BE7864, 0xAF2BAFB8, 0x6973A85D,
+	0x7DCCFF02, 0xBB94F8E7, 0xEC012F3B, 0x2A5928DE, 0x432A8083, 0x85728766, 0xD2E750BA, 0x14BF575F,
+	0xFB99FE04, 0x3DC1F9E1, 0x6A542E3D, 0xAC0C29D8, 0xC57F8185, 0x03278660, 0x54B251BC, 0x92EA5659,
+	0x86550106, 0x400D06E3, 0x1798D13F, 0xD1C0D6DA, 0xB8B37E87, 0x7EEB7962, 0x297EAEBE, 0xEF26A95B,
+	0xEA4E23FB, 0x2C16241E, 0x7B83F3C2, 0xBDDBF427, 0xD4A85C7A, 0x12F05B9F, 0x45658C43, 0x833D8BA6,
+	0x9782DCF9, 0x51DADB1C, 0x064F0CC0, 0xC0170B25, 0xA964A378, 0x6F3CA49D, 0x38A97341, 0xFEF174A4,
+	0x11D7DDFF, 0xD78FDA1A, 0x801A0DC6, 0x46420A23, 0x2F31A27E, 0xE969A59B, 0xBEFC7247, 0x78A475A2,
+	0x6C1B22FD, 0xAA432518, 0xFDD6F2C4, 0x3B8EF521, 0x52FD5D7C, 0x94A55A99, 0xC3308D45, 0x05688AA0,
+	0xC9E19805, 0x0FB99FE0, 0x582C483C, 0x9E744FD9, 0xF707E784, 0x315FE061, 0x66CA37BD, 0xA0923058,
+	0xB42D6707, 0x727560E2, 0x25E0B73E, 0xE3B8B0DB, 0x8ACB1886, 0x4C931F63, 0x1B06C8BF, 0xDD5ECF5A,
+	0x32786601, 0xF42061E4, 0xA3B5B638, 0x65EDB1DD, 0x0C9E1980, 0xCAC61E65, 0x9D53C9B9, 0x5B0BCE5C,
+	0x4FB49903, 0x89EC9EE6, 0xDE79493A, 0x18214EDF, 0x7152E682, 0xB70AE167, 0xE09F36BB, 0x26C7315E,
+	0x23AFBBFE, 0xE5F7BC1B, 0xB2626BC7, 0x743A6C22, 0x1D49C47F, 0xDB11C39A, 0x8C841446, 0x4ADC13A3,
+	0x5E6344FC, 0x983B4319, 0xCFAE94C5, 0x09F69320, 0x60853B7D, 0xA6DD3C98, 0xF148EB44, 0x3710ECA1,
+	0xD83645FA, 0x1E6E421F, 0x49FB95C3, 0x8FA39226, 0xE6D03A7B, 0x20883D9E, 0x771DEA42, 0xB145EDA7,
+	0xA5FABAF8, 0x63A2BD1D, 0x34376AC1, 0xF26F6D24, 0x9B1CC579, 0x5D44C29C, 0x0AD11540, 0xCC8912A5,
+	0x8EBEEFF9, 0x48E6E81C, 0x1F733FC0, 0xD92B3825, 0xB0589078, 0x7600979D, 0x21954041, 0xE7CD47A4,
+	0xF37210FB, 0x352A171E, 0x62BFC0C2, 0xA4E7C727, 0xCD946F7A, 0x0BCC689F, 0x5C59BF43, 0x9A01B8A6,
+	0x752711FD, 0xB37F1618, 0xE4EAC1C4, 0x22B2C621, 0x4BC16E7C, 0x8D996999, 0xDA0CBE45, 0x1C54B9A0,
+	0x08EBEEFF, 0xCEB3E91A, 0x99263EC6, 0x5F7E3923, 0x360D917E, 0xF055969B, 0xA7C04147, 0x619846A2,
+	0x64F0CC02, 0xA2A8CBE7, 0xF53D1C3B, 0x33651BDE, 0x5A16B383, 0x9C4EB466, 0xCBDB63BA, 0x0D83645F,
+	0x193C3300, 0xDF6434E5, 0x88F1E339, 0x4EA9E4DC, 0x27DA4C81, 0xE1824B64, 0xB6179CB8, 0x704F9B5D,
+	0x9F693206, 0x593135E3, 0x0EA4E23F, 0xC8FCE5DA, 0xA18F4D87, 0x67D74A62, 0x30429DBE, 0xF61A9A5B,
+	0xE2A5CD04, 0x24FDCAE1, 0x73681D3D, 0xB5301AD8, 0xDC43B285, 0x1A1BB560, 0x4D8E62BC, 0x8BD66559,
+	0x475F77FC, 0x81077019, 0xD692A7C5, 0x10CAA020, 0x79B9087D, 0xBFE10F98, 0xE874D844, 0x2E2CDFA1,
+	0x3A9388FE, 0xFCCB8F1B, 0xAB5E58C7, 0x6D065F22, 0x0475F77F, 0xC22DF09A, 0x95B82746, 0x53E020A3,
+	0xBCC689F8, 0x7A9E8E1D, 0x2D0B59C1, 0xEB535E24, 0x8220F679, 0x4478F19C, 0x13ED2640, 0xD5B521A5,
+	0xC10A76FA, 0x0752711F, 0x50C7A6C3, 0x969FA126, 0xFFEC097B, 0x39B40E9E, 0x6E21D942, 0xA879DEA7,
+	0xAD115407, 0x6B4953E2, 0x3CDC843E, 0xFA8483DB, 0x93F72B86, 0x55AF2C63, 0x023AFBBF, 0xC462FC5A,
+	0xD0DDAB05, 0x1685ACE0, 0x41107B3C, 0x87487CD9, 0xEE3BD484, 0x2863D361, 0x7FF604BD, 0xB9AE0358,
+	0x5688AA03, 0x90D0ADE6, 0xC7457A3A, 0x011D7DDF, 0x686ED582, 0xAE36D267, 0xF9A305BB, 0x3FFB025E,
+	0x2B445501, 0xED1C52E4, 0xBA898538, 0x7CD182DD, 0x15A22A80, 0xD3FA2D65, 0x846FFAB9, 0x4237FD5C,
+	// Seed 0x9E
+	0x00000000, 0x0827E288, 0x104FC510, 0x18682798, 0x0FF0F6A7, 0x07D7142F, 0x1FBF33B7, 0x1798D13F,
+	0x1FE1ED4E, 0x17C60FC6, 0x0FAE285E, 0x0789CAD6, 0x10111BE9, 0x1836F961, 0x005EDEF9, 0x08793C71,
+	0x10ACA61B, 0x188B4493, 0x00E3630B, 0x08C48183, 0x1F5C50BC, 0x177BB234, 0x0F1395AC, 0x07347724,
+	0x0F4D4B55, 0x076AA9DD, 0x1F028E45, 0x17256CCD, 0x00BDBDF2, 0x089A5F7A, 0x10F278E2, 0x18D59A6A,
+	0x0E3630B1, 0x0611D239, 0x1E79F5A1, 0x165E1729, 0x01C6C616, 0x09E1249E, 0x11890306, 0x19AEE18E,
+	0x11D7DDFF, 0x19F03F77, 0x019818EF, 0x09BFFA67, 0x1E272B58, 0x1600C9D0, 0x0E68EE48, 0x064F0CC0,
+	0x1E9A96AA, 0x16BD7422, 0x0ED553BA, 0x06F2B132, 0x116A600D, 0x194D8285, 0x0125A51D, 0x09024795,
+	0x017B7BE4, 0x095C996C, 0x1134BEF4, 0x19135C7C, 0x0E8B8D43, 0x06AC6FCB, 0x1EC44853, 0x16E3AADB,
+	0x1C6C6162, 0x144B83EA, 0x0C23A472, 0x040446FA, 0x139C97C5, 0x1BBB754D, 0x03D352D5, 0x0BF4B05D,
+	0x038D8C2C, 0x0BAA6EA4, 0x13C2493C, 0x1BE5ABB4, 0x0C7D7A8B, 0x045A9803, 0x1C32BF9B, 0x14155D13,
+	0x0CC0C779, 0x04E725F1, 0x1C8F0269, 0x14A8E0E1, 0x033031DE, 0x0B17D356, 0x137FF4CE, 0x1B581646,
+	0x13212A37, 0x1B06C8BF, 0x036EEF27, 0x0B490DAF, 0x1CD1DC90, 0x14F63E18, 0x0C9E1980, 0x04B9FB08,
+	0x125A51D3, 0x1A7DB35B, 0x021594C3, 0x0A32764B, 0x1DAAA774, 0x158D45FC, 0x0DE56264, 0x05C280EC,
+	0x0DBBBC9D, 0x059C5E15, 0x1DF4798D, 0x15D39B05, 0x024B4A3A, 0x0A6CA8B2, 0x12048F2A, 0x1A236DA2,
+	0x02F6F7C8, 0x0AD11540, 0x12B932D8, 0x1A9ED050, 0x0D06016F, 0x0521E3E7, 0x1D49C47F, 0x156E26F7,
+	0x1D171A86, 0x1530F80E, 0x0D58DF96, 0x057F3D1E, 0x12E7EC21, 0x1AC00EA9, 0x02A82931, 0x0A8FCBB9,
+	0x17B7BE43, 0x1F905CCB, 0x07F87B53, 0x0FDF99DB, 0x184748E4, 0x1060AA6C, 0x08088DF4, 0x002F6F7C,
+	0x0856530D, 0x0071B185, 0x1819961D, 0x103E7495, 0x07A6A5AA, 0x0F814722, 0x17E960BA, 0x1FCE8232,
+	0x071B1858, 0x0F3CFAD0, 0x1754DD48, 0x1F733FC0, 0x08EBEEFF, 0x00CC0C77, 0x18A42BEF, 0x1083C967,
+	0x18FAF516, 0x10DD179E, 0x08B53006, 0x0092D28E, 0x170A03B1, 0x1F2DE139, 0x0745C6A1, 0x0F622429,
+	0x19818EF2, 0x11A66C7A, 0x09CE4BE2, 0x01E9A96A, 0x16717855, 0x1E569ADD, 0x063EBD45, 0x0E195FCD,
+	0x066063BC, 0x0E478134, 0x162FA6AC, 0x1E084424, 0x0990951B, 0x01B77793, 0x19DF500B, 0x11F8B283,
+	0x092D28E9, 0x010ACA61, 0x1962EDF9, 0x11450F71, 0x06DDDE4E, 0x0EFA3CC6, 0x16921B5E, 0x1EB5F9D6,
+	0x16CCC5A7, 0x1EEB272F, 0x068300B7, 0x0EA4E23F, 0x193C3300, 0x111BD188, 0x0973F610, 0x01541498,
+	0x0BDBDF21, 0x03FC3DA9, 0x1B941A31, 0x13B3F8B9, 0x042B2986, 0x0C0CCB0E, 0x1464EC96, 0x1C430E1E,
+	0x143A326F, 0x1C1DD0E7, 0x0475F77F, 0x0C5215F7, 0x1BCAC4C8, 0x13ED2640, 0x0B8501D8, 0x03A2E350,
+	0x1B77793A, 0x13509BB2, 0x0B38BC2A, 0x031F5EA2, 0x14878F9D, 0x1CA06D15, 0x04C84A8D, 0x0CEFA805,
+	0x04969474, 0x0CB176FC, 0x14D95164, 0x1CFEB3EC, 0x0B6662D3, 0x0341805B, 0x1B29A7C3, 0x130E454B,
+	0x05EDEF90, 0x0DCA0D18, 0x15A22A80, 0x1D85C808, 0x0A1D1937, 0x023AFBBF, 0x1A52DC27, 0x12753EAF,
+	0x1A0C02DE, 0x122BE056, 0x0A43C7CE, 0x02642546, 0x15FCF479, 0x1DDB16F1, 0x05B33169, 0x0D94D3E1,
+	0x1541498B, 0x1D66AB03, 0x050E8C9B, 0x0D296E13, 0x1AB1BF2C, 0x12965DA4, 0x0AFE7A3C, 0x02D998B4,
+	0x0AA0A4C5, 0x0287464D, 0x1AEF61D5, 0x12C8835D, 0x05505262, 0x0D77B0EA, 0x151F9772, 0x1D3875FA,
+	// Seed 0x9F
+	0x00000000, 0x76CC9BEA, 0x2CF82A7F, 0x5A34B195, 0x59F054FE, 0x2F3CCF14, 0x75087E81, 0x03C4E56B,
+	0x7281B457, 0x044D2FBD, 0x5E799E28, 0x28B505C2, 0x2B71E0A9, 0x5DBD7B43, 0x0789CAD6, 0x7145513C,
+	0x24627505, 0x52AEEEEF, 0x089A5F7A, 0x7E56C490, 0x7D9221FB, 0x0B5EBA11, 0x516A0B84, 0x27A6906E,
+	0x56E3C152, 0x202F5AB8, 0x7A1BEB2D, 0x0CD770C7, 0x0F1395AC, 0x79DF0E46, 0x23EBBFD3, 0x55272439,
+	0x48C4EA0A, 0x3E0871E0, 0x643CC075, 0x12F05B9F, 0x1134BEF4, 0x67F8251E, 0x3DCC948B, 0x4B000F61,
+	0x3A455E5D, 0x4C89C5B7, 0x16BD7422, 0x6071EFC8, 0x63B50AA3, 0x15799149, 0x4F4D20DC, 0x3981BB36,
+	0x6CA69F0F, 0x1A6A04E5, 0x405EB570, 0x36922E9A, 0x3556CBF1, 0x439A501B, 0x19AEE18E, 0x6F627A64,
+	0x1E272B58, 0x68EBB0B2, 0x32DF0127, 0x44139ACD, 0x47D77FA6, 0x311BE44C, 0x6B2F55D9, 0x1DE3CE33,
+	0x50E8C9BF, 0x26245255, 0x7C10E3C0, 0x0ADC782A, 0x09189D41, 0x7FD406AB, 0x25E0B73E, 0x532C2CD4,
+	0x22697DE8, 0x54A5E602, 0x0E915797, 0x785DCC7D, 0x7B992916, 0x0D55B2FC, 0x57610369, 0x21AD9883,
+	0x748ABCBA, 0x02462750, 0x587296C5, 0x2EBE0D2F, 0x2D7AE844, 0x5BB673AE, 0x0182C23B, 0x774E59D1,
+	0x060B08ED, 0x70C79307, 0x2AF32292, 0x5C3FB978, 0x5FFB5C13, 0x2937C7F9, 0x7303766C, 0x05CFED86,
+	0x182C23B5, 0x6EE0B85F, 0x34D409CA, 0x42189220, 0x41DC774B, 0x3710ECA1, 0x6D245D34, 0x1BE8C6DE,
+	0x6AAD97E2, 0x1C610C08, 0x4655BD9D, 0x30992677, 0x335DC31C, 0x459158F6, 0x1FA5E963, 0x69697289,
+	0x3C4E56B0, 0x4A82CD5A, 0x10B67CCF, 0x667AE725, 0x65BE024E, 0x137299A4, 0x49462831, 0x3F8AB3DB,
+	0x4ECFE2E7, 0x3803790D, 0x6237C898, 0x14FB5372, 0x173FB619, 0x61F32DF3, 0x3BC79C66, 0x4D0B078C,
+	0x60B08ED5, 0x167C153F, 0x4C48A4AA, 0x3A843F40, 0x3940DA2B, 0x4F8C41C1, 0x15B8F054, 0x63746BBE,
+	0x12313A82, 0x64FDA168, 0x3EC910FD, 0x48058B17, 0x4BC16E7C, 0x3D0DF596, 0x67394403, 0x11F5DFE9,
+	0x44D2FBD0, 0x321E603A, 0x682AD1AF, 0x1EE64A45, 0x1D22AF2E, 0x6BEE34C4, 0x31DA8551, 0x47161EBB,
+	0x36534F87, 0x409FD46D, 0x1AAB65F8, 0x6C67FE12, 0x6FA31B79, 0x196F8093, 0x435B3106, 0x3597AAEC,
+	0x287464DF, 0x5EB8FF35, 0x048C4EA0, 0x7240D54A, 0x71843021, 0x0748ABCB, 0x5D7C1A5E, 0x2BB081B4,
+	0x5AF5D088, 0x2C394B62, 0x760DFAF7, 0x00C1611D, 0x03058476, 0x75C91F9C, 0x2FFDAE09, 0x593135E3,
+	0x0C1611DA, 0x7ADA8A30, 0x20EE3BA5, 0x5622A04F, 0x55E64524, 0x232ADECE, 0x791E6F5B, 0x0FD2F4B1,
+	0x7E97A58D, 0x085B3E67, 0x526F8FF2, 0x24A31418, 0x2767F173, 0x51AB6A99, 0x0B9FDB0C, 0x7D5340E6,
+	0x3058476A, 0x4694DC80, 0x1CA06D15, 0x6A6CF6FF, 0x69A81394, 0x1F64887E, 0x455039EB, 0x339CA201,
+	0x42D9F33D, 0x341568D7, 0x6E21D942, 0x18ED42A8, 0x1B29A7C3, 0x6DE53C29, 0x37D18DBC, 0x411D1656,
+	0x143A326F, 0x62F6A985, 0x38C21810, 0x4E0E83FA, 0x4DCA6691, 0x3B06FD7B, 0x61324CEE, 0x17FED704,
+	0x66BB8638, 0x10771DD2, 0x4A43AC47, 0x3C8F37AD, 0x3F4BD2C6, 0x4987492C, 0x13B3F8B9, 0x657F6353,
+	0x789CAD60, 0x0E50368A, 0x5464871F, 0x22A81CF5, 0x216CF99E, 0x57A06274, 0x0D94D3E1, 0x7B58480B,
+	0x0A1D1937, 0x7CD182DD, 0x26E53348, 0x5029A8A2, 0x53ED4DC9, 0x2521D623, 0x7F1567B6, 0x09D9FC5C,
+	0x5CFED865, 0x2A32438F, 0x7006F21A, 0x06CA69F0, 0x050E8C9B, 0x73C21771, 0x29F6A6E4, 0x5F3A3D0E,
+	0x2E7F6C32, 0x58B3F7D8, 0x0287464D, 0x744BDDA7, 0x778F38CC, 0x0143A326, 0x5B7712B3, 0x2DBB8959,
+	// Seed 0xA0
+	0x00000000, 0xA6CA8B26, 0xE038519D, 0x46F2DABB, 0x6DDDE4EB, 0xCB176FCD, 0x8DE5B576, 0x2B2F3E50,
+	0xDBBBC9D6, 0x7D7142F0, 0x3B83984B, 0x9D49136D, 0xB6662D3D, 0x10ACA61B, 0x565E7CA0, 0xF094F786,
+	0x1ADAD47D, 0xBC105F5B, 0xFAE285E0, 0x5C280EC6, 0x77073096, 0xD1CDBBB0, 0x973F610B, 0x31F5EA2D,
+	0xC1611DAB, 0x67AB968D, 0x21594C36, 0x8793C710, 0xACBCF940, 0x0A767266, 0x4C84A8DD, 0xEA4E23FB,
+	0x35B5A8FA, 0x937F23DC, 0xD58DF967, 0x73477241, 0x58684C11, 0xFEA2C737, 0xB8501D8C, 0x1E9A96AA,
+	0xEE0E612C, 0x48C4EA0A, 0x0E3630B1, 0xA8FCBB97, 0x83D385C7, 0x25190EE1, 0x63EBD45A, 0xC5215F7C,
+	0x2F6F7C87, 0x89A5F7A1, 0xCF572D1A, 0x699DA63C, 0x42B2986C, 0xE478134A, 0xA28AC9F1, 0x044042D7,
+	0xF4D4B551, 0x521E3E77, 0x14ECE4CC, 0xB2266FEA, 0x990951BA, 0x3FC3DA9C, 0x79310027, 0xDFFB8B01,
+	0x6B6B51F4, 0xCDA1DAD2, 0x8B530069, 0x2D998B4F, 0x06B6B51F, 0xA07C3E39, 0xE68EE482, 0x40446FA4,
+	0xB0D09822, 0x161A1304, 0x50E8C9BF, 0xF6224299, 0xDD0D7CC9, 0x7BC7F7EF, 0x3D352D54, 0x9BFFA672,
+	0x71B18589, 0xD77B0EAF, 0x9189D414, 0x37435F32, 0x1C6C6162, 0xBAA6EA44, 0xFC5430FF, 0x5A9EBBD9,
+	0xAA0A4C5F, 0x0CC0C779, 0x4A321DC2, 0xECF896E4, 0xC7D7A8B4, 0x611D2392, 0x27EFF929, 0x8125720F,
+	0x5EDEF90E, 0xF8147228, 0xBEE6A893, 0x182C23B5, 0x33031DE5, 0x95C996C3, 0xD33B4C78, 0x75F1C75E,
+	0x856530D8, 0x23AFBBFE, 0x655D6145, 0xC397EA63, 0xE8B8D433, 0x4E725F15, 0x088085AE, 0xAE4A0E88,
+	0x44042D73, 0xE2CEA655, 0xA43C7CEE, 0x02F6F7C8, 0x29D9C998, 0x8F1342BE, 0xC9E19805, 0x6F2B1323,
+	0x9FBFE4A5, 0x39756F83, 0x7F87B538, 0xD94D3E1E, 0xF262004E, 0x54A88B68, 0x125A51D3, 0xB490DAF5,
+	0xD6D6A3E8, 0x701C28CE, 0x36EEF275, 0x90247953, 0xBB0B4703, 0x1DC1CC25, 0x5B33169E, 0xFDF99DB8,
+	0x0D6D6A3E, 0xABA7E118, 0xED553BA3, 0x4B9FB085, 0x60B08ED5, 0xC67A05F3, 0x8088DF48, 0x2642546E,
+	0xCC0C7795, 0x6AC6FCB3, 0x2C342608, 0x8AFEAD2E, 0xA1D1937E, 0x071B1858, 0x41E9C2E3, 0xE72349C5,
+	0x17B7BE43, 0xB17D3565, 0xF78FEFDE, 0x514564F8, 0x7A6A5AA8, 0xDCA0D18E, 0x9A520B35, 0x3C988013,
+	0xE3630B12, 0x45A98034, 0x035B5A8F, 0xA591D1A9, 0x8EBEEFF9, 0x287464DF, 0x6E86BE64, 0xC84C3542,
+	0x38D8C2C4, 0x9E1249E2, 0xD8E09359, 0x7E2A187F, 0x5505262F, 0xF3CFAD09, 0xB53D77B2, 0x13F7FC94,
+	0xF9B9DF6F, 0x5F735449, 0x19818EF2, 0xBF4B05D4, 0x94643B84, 0x32AEB0A2, 0x745C6A19, 0xD296E13F,
+	0x220216B9, 0x84C89D9F, 0xC23A4724, 0x64F0CC02, 0x4FDFF252, 0xE9157974, 0xAFE7A3CF, 0x092D28E9,
+	0xBDBDF21C, 0x1B77793A, 0x5D85A381, 0xFB4F28A7, 0xD06016F7, 0x76AA9DD1, 0x3058476A, 0x9692CC4C,
+	0x66063BCA, 0xC0CCB0EC, 0x863E6A57, 0x20F4E171, 0x0BDBDF21, 0xAD115407, 0xEBE38EBC, 0x4D29059A,
+	0xA7672661, 0x01ADAD47, 0x475F77FC, 0xE195FCDA, 0xCABAC28A, 0x6C7049AC, 0x2A829317, 0x8C481831,
+	0x7CDCEFB7, 0xDA166491, 0x9CE4BE2A, 0x3A2E350C, 0x11010B5C, 0xB7CB807A, 0xF1395AC1, 0x57F3D1E7,
+	0x88085AE6, 0x2EC2D1C0, 0x68300B7B, 0xCEFA805D, 0xE5D5BE0D, 0x431F352B, 0x05EDEF90, 0xA32764B6,
+	0x53B39330, 0xF5791816, 0xB38BC2AD, 0x1541498B, 0x3E6E77DB, 0x98A4FCFD, 0xDE562646, 0x789CAD60,
+	0x92D28E9B, 0x341805BD, 0x72EADF06, 0xD4205420, 0xFF0F6A70, 0x59C5E156, 0x1F373BED, 0xB9FDB0CB,
+	0x4969474D, 0xEFA3CC6B, 0xA95116D0, 0x0F9B9DF6, 0x24B4A3A6, 0x827E2880, 0xC48CF23B, 0x6246791D,
+	// Seed 0xA1
+	0x00000000, 0x76CC9BEA, 0xED9937D4, 0x9B55AC3E, 0x98914955, 0xEE5DD2BF, 0x75087E81, 0x03C4E56B,
+	0x7281B457, 0x044D2FBD, 0x9F188383, 0xE9D41869, 0xEA10FD02, 0x9CDC66E8, 0x0789CAD6, 0x7145513C,
+	0xE50368AE, 0x93CFF344, 0x089A5F7A, 0x7E56C490, 0x7D9221FB, 0x0B5EBA11, 0x900B162F, 0xE6C78DC5,
+	0x9782DCF9, 0xE14E4713, 0x7A1BEB2D, 0x0CD770C7, 0x0F1395AC, 0x79DF0E46, 0xE28AA278, 0x94463992,
+	0x89A5F7A1, 0xFF696C4B, 0x643CC075, 0x12F05B9F, 0x1134BEF4, 0x67F8251E, 0xFCAD8920, 0x8A6112CA,
+	0xFB2443F6, 0x8DE8D81C, 0x16BD7422, 0x6071EFC8, 0x63B50AA3, 0x15799149, 0x8E2C3D77, 0xF8E0A69D,
+	0x6CA69F0F, 0x1A6A04E5, 0x813FA8DB, 0xF7F33331, 0xF437D65A, 0x82FB4DB0, 0x19AEE18E, 0x6F627A64,
+	0x1E272B58, 0x68EBB0B2, 0xF3BE1C8C, 0x85728766, 0x86B6620D, 0xF07AF9E7, 0x6B2F55D9, 0x1DE3CE33,
+	0x50E8C9BF, 0x26245255, 0xBD71FE6B, 0xCBBD6581, 0xC87980EA, 0xBEB51B00, 0x25E0B73E, 0x532C2CD4,
+	0x22697DE8, 0x54A5E602, 0xCFF04A3C, 0xB93CD1D6, 0xBAF834BD, 0xCC34AF57, 0x57610369, 0x21AD9883,
+	0xB5EBA111, 0xC3273AFB, 0x587296C5, 0x2EBE0D2F, 0x2D7AE844, 0x5BB673AE, 0xC0E3DF90, 0xB62F447A,
+	0xC76A1546, 0xB1A68EAC, 0x2AF32292, 0x5C3FB978, 0x5FFB5C13, 0x2937C7F9, 0xB2626BC7, 0xC4AEF02D,
+	0xD94D3E1E, 0xAF81A5F4, 0x34D409CA, 0x42189220, 0x41DC774B, 0x3710ECA1, 0xAC45409F, 0xDA89DB75,
+	0xABCC8A49, 0xDD0011A3, 0x4655BD9D, 0x30992677, 0x335DC31C, 0x459158F6, 0xDEC4F4C8, 0xA8086F22,
+	0x3C4E56B0, 0x4A82CD5A, 0xD1D76164, 0xA71BFA8E, 0xA4DF1FE5, 0xD213840F, 0x49462831, 0x3F8AB3DB,
+	0x4ECFE2E7, 0x3803790D, 0xA356D533, 0xD59A4ED9, 0xD65EABB2, 0xA0923058, 0x3BC79C66, 0x4D0B078C,
+	0xA1D1937E, 0xD71D0894, 0x4C48A4AA, 0x3A843F40, 0x3940DA2B, 0x4F8C41C1, 0xD4D9EDFF, 0xA2157615,
+	0xD3502729, 0xA59CBCC3, 0x3EC910FD, 0x48058B17, 0x4BC16E7C, 0x3D0DF596, 0xA65859A8, 0xD094C242,
+	0x44D2FBD0, 0x321E603A, 0xA94BCC04, 0xDF8757EE, 0xDC43B285, 0xAA8F296F, 0x31DA8551, 0x47161EBB,
+	0x36534F87, 0x409FD46D, 0xDBCA7853, 0xAD06E3B9, 0xAEC206D2, 0xD80E9D38, 0x435B3106, 0x3597AAEC,
+	0x287464DF, 0x5EB8FF35, 0xC5ED530B, 0xB321C8E1, 0xB0E52D8A, 0xC629B660, 0x5D7C1A5E, 0x2BB081B4,
+	0x5AF5D088, 0x2C394B62, 0xB76CE75C, 0xC1A07CB6, 0xC26499DD, 0xB4A80237, 0x2FFDAE09, 0x593135E3,
+	0xCD770C71, 0xBBBB979B, 0x20EE3BA5, 0x5622A04F, 0x55E64524, 0x232ADECE, 0xB87F72F0, 0xCEB3E91A,
+	0xBFF6B826, 0xC93A23CC, 0x526F8FF2, 0x24A31418, 0x2767F173, 0x51AB6A99, 0xCAFEC6A7, 0xBC325D4D,
+	0xF1395AC1, 0x87F5C12B, 0x1CA06D15, 0x6A6CF6FF, 0x69A81394, 0x1F64887E, 0x84312440, 0xF2FDBFAA,
+	0x83B8EE96, 0xF574757C, 0x6E21D942, 0x18ED42A8, 0x1B29A7C3, 0x6DE53C29, 0xF6B09017, 0x807C0BFD,
+	0x143A326F, 0x62F6A985, 0xF9A305BB, 0x8F6F9E51, 0x8CAB7B3A, 0xFA67E0D0, 0x61324CEE, 0x17FED704,
+	0x66BB8638, 0x10771DD2, 0x8B22B1EC, 0xFDEE2A06, 0xFE2ACF6D, 0x88E65487, 0x13B3F8B9, 0x657F6353,
+	0x789CAD60, 0x0E50368A, 0x95059AB4, 0xE3C9015E, 0xE00DE435, 0x96C17FDF, 0x0D94D3E1, 0x7B58480B,
+	0x0A1D1937, 0x7CD182DD, 0xE7842EE3, 0x9148B509, 0x928C5062, 0xE440CB88, 0x7F1567B6, 0x09D9FC5C,
+	0x9D9FC5CE, 0xEB535E24, 0x7006F21A, 0x06CA69F0, 0x050E8C9B, 0x73C21771, 0xE897BB4F, 0x9E5B20A5,
+	0xEF1E7199, 0x99D2EA73, 0x0287464D, 0x744BDDA7, 0x778F38CC, 0x0143A326, 0x9A160F18, 0xECDA94F2,
+	// Seed 0xA2
+	0x00000000, 0x27489E0F, 0x3F20B997, 0x18682798, 0x0FF0F6A7, 0x28B868A8, 0x30D04F30, 0x1798D13F,
+	0x1FE1ED4E, 0x38A97341, 0x20C154D9, 0x0789CAD6, 0x10111BE9, 0x375985E6, 0x2F31A27E, 0x08793C71,
+	0x3FC3DA9C, 0x188B4493, 0x00E3630B, 0x27ABFD04, 0x30332C3B, 0x177BB234, 0x0F1395AC, 0x285B0BA3,
+	0x202237D2, 0x076AA9DD, 0x1F028E45, 0x384A104A, 0x2FD2C175, 0x089A5F7A, 0x10F278E2, 0x37BAE6ED,
+	0x0E3630B1, 0x297EAEBE, 0x31168926, 0x165E1729, 0x01C6C616, 0x268E5819, 0x3EE67F81, 0x19AEE18E,
+	0x11D7DDFF, 0x369F43F0, 0x2EF76468, 0x09BFFA67, 0x1E272B58, 0x396FB557, 0x210792CF, 0x064F0CC0,
+	0x31F5EA2D, 0x16BD7422, 0x0ED553BA, 0x299DCDB5, 0x3E051C8A, 0x194D8285, 0x0125A51D, 0x266D3B12,
+	0x2E140763, 0x095C996C, 0x1134BEF4, 0x367C20FB, 0x21E4F1C4, 0x06AC6FCB, 0x1EC44853, 0x398CD65C,
+	0x1C6C6162, 0x3B24FF6D, 0x234CD8F5, 0x040446FA, 0x139C97C5, 0x34D409CA, 0x2CBC2E52, 0x0BF4B05D,
+	0x038D8C2C, 0x24C51223, 0x3CAD35BB, 0x1BE5ABB4, 0x0C7D7A8B, 0x2B35E484, 0x335DC31C, 0x14155D13,
+	0x23AFBBFE, 0x04E725F1, 0x1C8F0269, 0x3BC79C66, 0x2C5F4D59, 0x0B17D356, 0x137FF4CE, 0x34376AC1,
+	0x3C4E56B0, 0x1B06C8BF, 0x036EEF27, 0x24267128, 0x33BEA017, 0x14F63E18, 0x0C9E1980, 0x2BD6878F,
+	0x125A51D3, 0x3512CFDC, 0x2D7AE844, 0x0A32764B, 0x1DAAA774, 0x3AE2397B, 0x228A1EE3, 0x05C280EC,
+	0x0DBBBC9D, 0x2AF32292, 0x329B050A, 0x15D39B05, 0x024B4A3A, 0x2503D435, 0x3D6BF3AD, 0x1A236DA2,
+	0x2D998B4F, 0x0AD11540, 0x12B932D8, 0x35F1ACD7, 0x22697DE8, 0x0521E3E7, 0x1D49C47F, 0x3A015A70,
+	0x32786601, 0x1530F80E, 0x0D58DF96, 0x2A104199, 0x3D8890A6, 0x1AC00EA9, 0x02A82931, 0x25E0B73E,
+	0x38D8C2C4, 0x1F905CCB, 0x07F87B53, 0x20B0E55C, 0x37283463, 0x1060AA6C, 0x08088DF4, 0x2F4013FB,
+	0x27392F8A, 0x0071B185, 0x1819961D, 0x3F510812, 0x28C9D92D, 0x0F814722, 0x17E960BA, 0x30A1FEB5,
+	0x071B1858, 0x20538657, 0x383BA1CF, 0x1F733FC0, 0x08EBEEFF, 0x2FA370F0, 0x37CB5768, 0x1083C967,
+	0x18FAF516, 0x3FB26B19, 0x27DA4C81, 0x0092D28E, 0x170A03B1, 0x30429DBE, 0x282ABA26, 0x0F622429,
+	0x36EEF275, 0x11A66C7A, 0x09CE4BE2, 0x2E86D5ED, 0x391E04D2, 0x1E569ADD, 0x063EBD45, 0x2176234A,
+	0x290F1F3B, 0x0E478134, 0x162FA6AC, 0x316738A3, 0x26FFE99C, 0x01B77793, 0x19DF500B, 0x3E97CE04,
+	0x092D28E9, 0x2E65B6E6, 0x360D917E, 0x11450F71, 0x06DDDE4E, 0x21954041, 0x39FD67D9, 0x1EB5F9D6,
+	0x16CCC5A7, 0x31845BA8, 0x29EC7C30, 0x0EA4E23F, 0x193C3300, 0x3E74AD0F, 0x261C8A97, 0x01541498,
+	0x24B4A3A6, 0x03FC3DA9, 0x1B941A31, 0x3CDC843E, 0x2B445501, 0x0C0CCB0E, 0x1464EC96, 0x332C7299,
+	0x3B554EE8, 0x1C1DD0E7, 0x0475F77F, 0x233D6970, 0x34A5B84F, 0x13ED2640, 0x0B8501D8, 0x2CCD9FD7,
+	0x1B77793A, 0x3C3FE735, 0x2457C0AD, 0x031F5EA2, 0x14878F9D, 0x33CF1192, 0x2BA7360A, 0x0CEFA805,
+	0x04969474, 0x23DE0A7B, 0x3BB62DE3, 0x1CFEB3EC, 0x0B6662D3, 0x2C2EFCDC, 0x3446DB44, 0x130E454B,
+	0x2A829317, 0x0DCA0D18, 0x15A22A80, 0x32EAB48F, 0x257265B0, 0x023AFBBF, 0x1A52DC27, 0x3D1A4228,
+	0x35637E59, 0x122BE056, 0x0A43C7CE, 0x2D0B59C1, 0x3A9388FE, 0x1DDB16F1, 0x05B33169, 0x22FBAF66,
+	0x1541498B, 0x3209D784, 0x2A61F01C, 0x0D296E13, 0x1AB1BF2C, 0x3DF92123, 0x259106BB, 0x02D998B4,
+	0x0AA0A4C5, 0x2DE83ACA, 0x35801D52, 0x12C8835D, 0x05505262, 0x2218CC6D, 0x3A70EBF5, 0x1D3875FA,
+	// Seed 0xA3
+	0x00000000, 0x70DD49D3, 0x7E057703, 0x0ED83ED0, 0x63B50AA3, 0x13684370, 0x1DB07DA0, 0x6D6D3473,
+	0x58D5F1E3, 0x2808B830, 0x26D086E0, 0x560DCF33, 0x3B60FB40, 0x4BBDB293, 0x45658C43, 0x35B8C590,
+	0x2E140763, 0x5EC94EB0, 0x50117060, 0x20CC39B3, 0x4DA10DC0, 0x3D7C4413, 0x33A47AC3, 0x43793310,
+	0x76C1F680, 0x061CBF53, 0x08C48183, 0x7819C850, 0x1574FC23, 0x65A9B5F0, 0x6B718B20, 0x1BACC2F3,
+	0x5C280EC6, 0x2CF54715, 0x222D79C5, 0x52F03016, 0x3F9D0465, 0x4F404DB6, 0x41987366, 0x31453AB5,
+	0x04FDFF25, 0x7420B6F6, 0x7AF88826, 0x0A25C1F5, 0x6748F586, 0x1795BC55, 0x194D8285, 0x6990CB56,
+	0x723C09A5, 0x02E14076, 0x0C397EA6, 0x7CE43775, 0x11890306, 0x61544AD5, 0x6F8C7405, 0x1F513DD6,
+	0x2AE9F846, 0x5A34B195, 0x54EC8F45, 0x2431C696, 0x495CF2E5, 0x3981BB36, 0x375985E6, 0x4784CC35,
+	0x27EFF929, 0x5732B0FA, 0x59EA8E2A, 0x2937C7F9, 0x445AF38A, 0x3487BA59, 0x3A5F8489, 0x4A82CD5A,
+	0x7F3A08CA, 0x0FE74119, 0x013F7FC9, 0x71E2361A, 0x1C8F0269, 0x6C524BBA, 0x628A756A, 0x12573CB9,
+	0x09FBFE4A, 0x7926B799, 0x77FE8949, 0x0723C09A, 0x6A4EF4E9, 0x1A93BD3A, 0x144B83EA, 0x6496CA39,
+	0x512E0FA9, 0x21F3467A, 0x2F2B78AA, 0x5FF63179, 0x329B050A, 0x42464CD9, 0x4C9E7209, 0x3C433BDA,
+	0x7BC7F7EF, 0x0B1ABE3C, 0x05C280EC, 0x751FC93F, 0x1872FD4C, 0x68AFB49F, 0x66778A4F, 0x16AAC39C,
+	0x2312060C, 0x53CF4FDF, 0x5D17710F, 0x2DCA38DC, 0x40A70CAF, 0x307A457C, 0x3EA27BAC, 0x4E7F327F,
+	0x55D3F08C, 0x250EB95F, 0x2BD6878F, 0x5B0BCE5C, 0x3666FA2F, 0x46BBB3FC, 0x48638D2C, 0x38BEC4FF,
+	0x0D06016F, 0x7DDB48BC, 0x7303766C, 0x03DE3FBF, 0x6EB30BCC, 0x1E6E421F, 0x10B67CCF, 0x606B351C,
+	0x4FDFF252, 0x3F02BB81, 0x31DA8551, 0x4107CC82, 0x2C6AF8F1, 0x5CB7B122, 0x526F8FF2, 0x22B2C621,
+	0x170A03B1, 0x67D74A62, 0x690F74B2, 0x19D23D61, 0x74BF0912, 0x046240C1, 0x0ABA7E11, 0x7A6737C2,
+	0x61CBF531, 0x1116BCE2, 0x1FCE8232, 0x6F13CBE1, 0x027EFF92, 0x72A3B641, 0x7C7B8891, 0x0CA6C142,
+	0x391E04D2, 0x49C34D01, 0x471B73D1, 0x37C63A02, 0x5AAB0E71, 0x2A7647A2, 0x24AE7972, 0x547330A1,
+	0x13F7FC94, 0x632AB547, 0x6DF28B97, 0x1D2FC244, 0x7042F637, 0x009FBFE4, 0x0E478134, 0x7E9AC8E7,
+	0x4B220D77, 0x3BFF44A4, 0x35277A74, 0x45FA33A7, 0x289707D4, 0x584A4E07, 0x569270D7, 0x264F3904,
+	0x3DE3FBF7, 0x4D3EB224, 0x43E68CF4, 0x333BC527, 0x5E56F154, 0x2E8BB887, 0x20538657, 0x508ECF84,
+	0x65360A14, 0x15EB43C7, 0x1B337D17, 0x6BEE34C4, 0x068300B7, 0x765E4964, 0x788677B4, 0x085B3E67,
+	0x68300B7B, 0x18ED42A8, 0x16357C78, 0x66E835AB, 0x0B8501D8, 0x7B58480B, 0x758076DB, 0x055D3F08,
+	0x30E5FA98, 0x4038B34B, 0x4EE08D9B, 0x3E3DC448, 0x5350F03B, 0x238DB9E8, 0x2D558738, 0x5D88CEEB,
+	0x46240C18, 0x36F945CB, 0x38217B1B, 0x48FC32C8, 0x259106BB, 0x554C4F68, 0x5B9471B8, 0x2B49386B,
+	0x1EF1FDFB, 0x6E2CB428, 0x60F48AF8, 0x1029C32B, 0x7D44F758, 0x0D99BE8B, 0x0341805B, 0x739CC988,
+	0x341805BD, 0x44C54C6E, 0x4A1D72BE, 0x3AC03B6D, 0x57AD0F1E, 0x277046CD, 0x29A8781D, 0x597531CE,
+	0x6CCDF45E, 0x1C10BD8D, 0x12C8835D, 0x6215CA8E, 0x0F78FEFD, 0x7FA5B72E, 0x717D89FE, 0x01A0C02D,
+	0x1A0C02DE, 0x6AD14B0D, 0x640975DD, 0x14D43C0E, 0x79B9087D, 0x096441AE, 0x07BC7F7E, 0x776136AD,
+	0x42D9F33D, 0x3204BAEE, 0x3CDC843E, 0x4C01CDED, 0x216CF99E, 0x51B1B04D, 0x5F698E9D, 0x2FB4C74E,
+	// Seed 0xA4
+	0x00000000, 0xC2FFFD1F, 0x268935DD, 0xE476C8C2, 0x4D126BBA, 0x8FED96A5, 0x6B9B5E67, 0xA964A378,
+	0x9A24D774, 0x58DB2A6B, 0xBCADE2A9, 0x7E521FB6, 0xD736BCCE, 0x15C941D1, 0xF1BF8913, 0x3340740C,
+	0x973F610B, 0x55C09C14, 0xB1B654D6, 0x7349A9C9, 0xDA2D0AB1, 0x18D2F7AE, 0xFCA43F6C, 0x3E5BC273,
+	0x0D1BB67F, 0xCFE44B60, 0x2B9283A2, 0xE96D7EBD, 0x4009DDC5, 0x82F620DA, 0x6680E818, 0xA47F1507,
+	0x8D080DF5, 0x4FF7F0EA, 0xAB813828, 0x697EC537, 0xC01A664F, 0x02E59B50, 0xE6935392, 0x246CAE8D,
+	0x172CDA81, 0xD5D3279E, 0x31A5EF5C, 0xF35A1243, 0x5A3EB13B, 0x98C14C24, 0x7CB784E6, 0xBE4879F9,
+	0x1A376CFE, 0xD8C891E1, 0x3CBE5923, 0xFE41A43C, 0x57250744, 0x95DAFA5B, 0x71AC3299, 0xB353CF86,
+	0x8013BB8A, 0x42EC4695, 0xA69A8E57, 0x64657348, 0xCD01D030, 0x0FFE2D2F, 0xEB88E5ED, 0x297718F2,
+	0xB966D409, 0x7B992916, 0x9FEFE1D4, 0x5D101CCB, 0xF474BFB3, 0x368B42AC, 0xD2FD8A6E, 0x10027771,
+	0x2342037D, 0xE1BDFE62, 0x05CB36A0, 0xC734CBBF, 0x6E5068C7, 0xACAF95D8, 0x48D95D1A, 0x8A26A005,
+	0x2E59B502, 0xECA6481D, 0x08D080DF, 0xCA2F7DC0, 0x634BDEB8, 0xA1B423A7, 0x45C2EB65, 0x873D167A,
+	0xB47D6276, 0x76829F69, 0x92F457AB, 0x500BAAB4, 0xF96F09CC, 0x3B90F4D3, 0xDFE63C11, 0x1D19C10E,
+	0x346ED9FC, 0xF69124E3, 0x12E7EC21, 0xD018113E, 0x797CB246, 0xBB834F59, 0x5FF5879B, 0x9D0A7A84,
+	0xAE4A0E88, 0x6CB5F397, 0x88C33B55, 0x4A3CC64A, 0xE3586532, 0x21A7982D, 0xC5D150EF, 0x072EADF0,
+	0xA351B8F7, 0x61AE45E8, 0x85D88D2A, 0x47277035, 0xEE43D34D, 0x2CBC2E52, 0xC8CAE690, 0x0A351B8F,
+	0x39756F83, 0xFB8A929C, 0x1FFC5A5E, 0xDD03A741, 0x74670439, 0xB698F926, 0x52EE31E4, 0x9011CCFB,
+	0xD1BB67F1, 0x13449AEE, 0xF732522C, 0x35CDAF33, 0x9CA90C4B, 0x5E56F154, 0xBA203996, 0x78DFC489,
+	0x4B9FB085, 0x89604D9A, 0x6D168558, 0xAFE97847, 0x068DDB3F, 0xC4722620, 0x2004EEE2, 0xE2FB13FD,
+	0x468406FA, 0x847BFBE5, 0x600D3327, 0xA2F2CE38, 0x0B966D40, 0xC969905F, 0x2D1F589D, 0xEFE0A582,
+	0xDCA0D18E, 0x1E5F2C91, 0xFA29E453, 0x38D6194C, 0x91B2BA34, 0x534D472B, 0xB73B8FE9, 0x75C472F6,
+	0x5CB36A04, 0x9E4C971B, 0x7A3A5FD9, 0xB8C5A2C6, 0x11A101BE, 0xD35EFCA1, 0x37283463, 0xF5D7C97C,
+	0xC697BD70, 0x0468406F, 0xE01E88AD, 0x22E175B2, 0x8B85D6CA, 0x497A2BD5, 0xAD0CE317, 0x6FF31E08,
+	0xCB8C0B0F, 0x0973F610, 0xED053ED2, 0x2FFAC3CD, 0x869E60B5, 0x44619DAA, 0xA0175568, 0x62E8A877,
+	0x51A8DC7B, 0x93572164, 0x7721E9A6, 0xB5DE14B9, 0x1CBAB7C1, 0xDE454ADE, 0x3A33821C, 0xF8CC7F03,
+	0x68DDB3F8, 0xAA224EE7, 0x4E548625, 0x8CAB7B3A, 0x25CFD842, 0xE730255D, 0x0346ED9F, 0xC1B91080,
+	0xF2F9648C, 0x30069993, 0xD4705151, 0x168FAC4E, 0xBFEB0F36, 0x7D14F229, 0x99623AEB, 0x5B9DC7F4,
+	0xFFE2D2F3, 0x3D1D2FEC, 0xD96BE72E, 0x1B941A31, 0xB2F0B949, 0x700F4456, 0x94798C94, 0x5686718B,
+	0x65C60587, 0xA739F898, 0x434F305A, 0x81B0CD45, 0x28D46E3D, 0xEA2B9322, 0x0E5D5BE0, 0xCCA2A6FF,
+	0xE5D5BE0D, 0x272A4312, 0xC35C8BD0, 0x01A376CF, 0xA8C7D5B7, 0x6A3828A8, 0x8E4EE06A, 0x4CB11D75,
+	0x7FF16979, 0xBD0E9466, 0x59785CA4, 0x9B87A1BB, 0x32E302C3, 0xF01CFFDC, 0x146A371E, 0xD695CA01,
+	0x72EADF06, 0xB0152219, 0x5463EADB, 0x969C17C4, 0x3FF8B4BC, 0xFD0749A3, 0x19718161, 0xDB8E7C7E,
+	0xE8CE0872, 0x2A31F56D, 0xCE473DAF, 0x0CB8C0B0, 0xA5DC63C8, 0x67239ED7, 0x83555615, 0x41AAAB0A,
+	// Seed 0xA5
+	0x00000000, 0xCB4D6A12, 0xDBE27AEB, 0x10AF10F9, 0xFABC5B19, 0x31F1310B, 0x215E21F2, 0xEA134BE0,
+	0xB80018FD, 0x734D72EF, 0x63E26216, 0xA8AF0804, 0x42BC43E4, 0x89F129F6, 0x995E390F, 0x5213531D,
+	0x3D789F35, 0xF635F527, 0xE69AE5DE, 0x2DD78FCC, 0xC7C4C42C, 0x0C89AE3E, 0x1C26BEC7, 0xD76BD4D5,
+	0x857887C8, 0x4E35EDDA, 0x5E9AFD23, 0x95D79731, 0x7FC4DCD1, 0xB489B6C3, 0xA426A63A, 0x6F6BCC28,
+	0x7AF13E6A, 0xB1BC5478, 0xA1134481, 0x6A5E2E93, 0x804D6573, 0x4B000F61, 0x5BAF1F98, 0x90E2758A,
+	0xC2F12697, 0x09BC4C85, 0x19135C7C, 0xD25E366E, 0x384D7D8E, 0xF300179C, 0xE3AF0765, 0x28E26D77,
+	0x4789A15F, 0x8CC4CB4D, 0x9C6BDBB4, 0x5726B1A6, 0xBD35FA46, 0x76789054, 0x66D780AD, 0xAD9AEABF,
+	0xFF89B9A2, 0x34C4D3B0, 0x246BC349, 0xEF26A95B, 0x0535E2BB, 0xCE7888A9, 0xDED79850, 0x159AF242,
+	0xF5E27CD4, 0x3EAF16C6, 0x2E00063F, 0xE54D6C2D, 0x0F5E27CD, 0xC4134DDF, 0xD4BC5D26, 0x1FF13734,
+	0x4DE26429, 0x86AF0E3B, 0x96001EC2, 0x5D4D74D0, 0xB75E3F30, 0x7C135522, 0x6CBC45DB, 0xA7F12FC9,
+	0xC89AE3E1, 0x03D789F3, 0x1378990A, 0xD835F318, 0x3226B8F8, 0xF96BD2EA, 0xE9C4C213, 0x2289A801,
+	0x709AFB1C, 0xBBD7910E, 0xAB7881F7, 0x6035EBE5, 0x8A26A005, 0x416BCA17, 0x51C4DAEE, 0x9A89B0FC,
+	0x8F1342BE, 0x445E28AC, 0x54F13855, 0x9FBC5247, 0x75AF19A7, 0xBEE273B5, 0xAE4D634C, 0x6500095E,
+	0x37135A43, 0xFC5E3051, 0xECF120A8, 0x27BC4ABA, 0xCDAF015A, 0x06E26B48, 0x164D7BB1, 0xDD0011A3,
+	0xB26BDD8B, 0x7926B799, 0x6989A760, 0xA2C4CD72, 0x48D78692, 0x839AEC80, 0x9335FC79, 0x5878966B,
+	0x0A6BC576, 0xC126AF64, 0xD189BF9D, 0x1AC4D58F, 0xF0D79E6F, 0x3B9AF47D, 0x2B35E484, 0xE0788E96,
+	0xA6BC5767, 0x6DF13D75, 0x7D5E2D8C, 0xB613479E, 0x5C000C7E, 0x974D666C, 0x87E27695, 0x4CAF1C87,
+	0x1EBC4F9A, 0xD5F12588, 0xC55E3571, 0x0E135F63, 0xE4001483, 0x2F4D7E91, 0x3FE26E68, 0xF4AF047A,
+	0x9BC4C852, 0x5089A240, 0x4026B2B9, 0x8B6BD8AB, 0x6178934B, 0xAA35F959, 0xBA9AE9A0, 0x71D783B2,
+	0x23C4D0AF, 0xE889BABD, 0xF826AA44, 0x336BC056, 0xD9788BB6, 0x1235E1A4, 0x029AF15D, 0xC9D79B4F,
+	0xDC4D690D, 0x1700031F, 0x07AF13E6, 0xCCE279F4, 0x26F13214, 0xEDBC5806, 0xFD1348FF, 0x365E22ED,
+	0x644D71F0, 0xAF001BE2, 0xBFAF0B1B, 0x74E26109, 0x9EF12AE9, 0x55BC40FB, 0x45135002, 0x8E5E3A10,
+	0xE135F638, 0x2A789C2A, 0x3AD78CD3, 0xF19AE6C1, 0x1B89AD21, 0xD0C4C733, 0xC06BD7CA, 0x0B26BDD8,
+	0x5935EEC5, 0x927884D7, 0x82D7942E, 0x499AFE3C, 0xA389B5DC, 0x68C4DFCE, 0x786BCF37, 0xB326A525,
+	0x535E2BB3, 0x981341A1, 0x88BC5158, 0x43F13B4A, 0xA9E270AA, 0x62AF1AB8, 0x72000A41, 0xB94D6053,
+	0xEB5E334E, 0x2013595C, 0x30BC49A5, 0xFBF123B7, 0x11E26857, 0xDAAF0245, 0xCA0012BC, 0x014D78AE,
+	0x6E26B486, 0xA56BDE94, 0xB5C4CE6D, 0x7E89A47F, 0x949AEF9F, 0x5FD7858D, 0x4F789574, 0x8435FF66,
+	0xD626AC7B, 0x1D6BC669, 0x0DC4D690, 0xC689BC82, 0x2C9AF762, 0xE7D79D70, 0xF7788D89, 0x3C35E79B,
+	0x29AF15D9, 0xE2E27FCB, 0xF24D6F32, 0x39000520, 0xD3134EC0, 0x185E24D2, 0x08F1342B, 0xC3BC5E39,
+	0x91AF0D24, 0x5AE26736, 0x4A4D77CF, 0x81001DDD, 0x6B13563D, 0xA05E3C2F, 0xB0F12CD6, 0x7BBC46C4,
+	0x14D78AEC, 0xDF9AE0FE, 0xCF35F007, 0x04789A15, 0xEE6BD1F5, 0x2526BBE7, 0x3589AB1E, 0xFEC4C10C,
+	0xACD79211, 0x679AF803, 0x7735E8FA, 0xBC7882E8, 0x566BC908, 0x9D26A31A, 0x8D89B3E3, 0x46C4D9F1,
+	// Seed 0xA6
+	0x00000000, 0x2EFED224, 0x2297A9F3, 0x0C697BD7, 0x3A455E5D, 0x14BB8C79, 0x18D2F7AE, 0x362C258A,
+	0x0BE0B101, 0x251E6325, 0x297718F2, 0x0789CAD6, 0x31A5EF5C, 0x1F5B3D78, 0x133246AF, 0x3DCC948B,
+	0x17C16202, 0x393FB026, 0x3556CBF1, 0x1BA819D5, 0x2D843C5F, 0x037AEE7B, 0x0F1395AC, 0x21ED4788,
+	0x1C21D303, 0x32DF0127, 0x3EB67AF0, 0x1048A8D4, 0x26648D5E, 0x089A5F7A, 0x04F324AD, 0x2A0DF689,
+	0x2F82C404, 0x017C1620, 0x0D156DF7, 0x23EBBFD3, 0x15C79A59, 0x3B39487D, 0x375033AA, 0x19AEE18E,
+	0x24627505, 0x0A9CA721, 0x06F5DCF6, 0x280B0ED2, 0x1E272B58, 0x30D9F97C, 0x3CB082AB, 0x124E508F,
+	0x3843A606, 0x16BD7422, 0x1AD40FF5, 0x342ADDD1, 0x0206F85B, 0x2CF82A7F, 0x209151A8, 0x0E6F838C,
+	0x33A31707, 0x1D5DC523, 0x1134BEF4, 0x3FCA6CD0, 0x09E6495A, 0x27189B7E, 0x2B71E0A9, 0x058F328D,
+	0x206F85B3, 0x0E915797, 0x02F82C40, 0x2C06FE64, 0x1A2ADBEE, 0x34D409CA, 0x38BD721D, 0x1643A039,
+	0x2B8F34B2, 0x0571E696, 0x09189D41, 0x27E64F65, 0x11CA6AEF, 0x3F34B8CB, 0x335DC31C, 0x1DA31138,
+	0x37AEE7B1, 0x19503595, 0x15394E42, 0x3BC79C66, 0x0DEBB9EC, 0x23156BC8, 0x2F7C101F, 0x0182C23B,
+	0x3C4E56B0, 0x12B08494, 0x1ED9FF43, 0x30272D67, 0x060B08ED, 0x28F5DAC9, 0x249CA11E, 0x0A62733A,
+	0x0FED41B7, 0x21139393, 0x2D7AE844, 0x03843A60, 0x35A81FEA, 0x1B56CDCE, 0x173FB619, 0x39C1643D,
+	0x040DF0B6, 0x2AF32292, 0x269A5945, 0x08648B61, 0x3E48AEEB, 0x10B67CCF, 0x1CDF0718, 0x3221D53C,
+	0x182C23B5, 0x36D2F191, 0x3ABB8A46, 0x14455862, 0x22697DE8, 0x0C97AFCC, 0x00FED41B, 0x2E00063F,
+	0x13CC92B4, 0x3D324090, 0x315B3B47, 0x1FA5E963, 0x2989CCE9, 0x07771ECD, 0x0B1E651A, 0x25E0B73E,
+	0x3FB506DD, 0x114BD4F9, 0x1D22AF2E, 0x33DC7D0A, 0x05F05880, 0x2B0E8AA4, 0x2767F173, 0x09992357,
+	0x3455B7DC, 0x1AAB65F8, 0x16C21E2F, 0x383CCC0B, 0x0E10E981, 0x20EE3BA5, 0x2C874072, 0x02799256,
+	0x287464DF, 0x068AB6FB, 0x0AE3CD2C, 0x241D1F08, 0x12313A82, 0x3CCFE8A6, 0x30A69371, 0x1E584155,
+	0x2394D5DE, 0x0D6A07FA, 0x01037C2D, 0x2FFDAE09, 0x19D18B83, 0x372F59A7, 0x3B462270, 0x15B8F054,
+	0x1037C2D9, 0x3EC910FD, 0x32A06B2A, 0x1C5EB90E, 0x2A729C84, 0x048C4EA0, 0x08E53577, 0x261BE753,
+	0x1BD773D8, 0x3529A1FC, 0x3940DA2B, 0x17BE080F, 0x21922D85, 0x0F6CFFA1, 0x03058476, 0x2DFB5652,
+	0x07F6A0DB, 0x290872FF, 0x25610928, 0x0B9FDB0C, 0x3DB3FE86, 0x134D2CA2, 0x1F245775, 0x31DA8551,
+	0x0C1611DA, 0x22E8C3FE, 0x2E81B829, 0x007F6A0D, 0x36534F87, 0x18AD9DA3, 0x14C4E674, 0x3A3A3450,
+	0x1FDA836E, 0x3124514A, 0x3D4D2A9D, 0x13B3F8B9, 0x259FDD33, 0x0B610F17, 0x070874C0, 0x29F6A6E4,
+	0x143A326F, 0x3AC4E04B, 0x36AD9B9C, 0x185349B8, 0x2E7F6C32, 0x0081BE16, 0x0CE8C5C1, 0x221617E5,
+	0x081BE16C, 0x26E53348, 0x2A8C489F, 0x04729ABB, 0x325EBF31, 0x1CA06D15, 0x10C916C2, 0x3E37C4E6,
+	0x03FB506D, 0x2D058249, 0x216CF99E, 0x0F922BBA, 0x39BE0E30, 0x1740DC14, 0x1B29A7C3, 0x35D775E7,
+	0x3058476A, 0x1EA6954E, 0x12CFEE99, 0x3C313CBD, 0x0A1D1937, 0x24E3CB13, 0x288AB0C4, 0x067462E0,
+	0x3BB8F66B, 0x1546244F, 0x192F5F98, 0x37D18DBC, 0x01FDA836, 0x2F037A12, 0x236A01C5, 0x0D94D3E1,
+	0x27992568, 0x0967F74C, 0x050E8C9B, 0x2BF05EBF, 0x1DDC7B35, 0x3322A911, 0x3F4BD2C6, 0x11B500E2,
+	0x2C799469, 0x0287464D, 0x0EEE3D9A, 0x2010EFBE, 0x163CCA34, 0x38C21810, 0x34AB63C7, 0x1A55B1E3,
+	// Seed 0xA7
+	0x00000000, 0x05388FD1, 0x0A711FA2, 0x0F499073, 0x14E23F44, 0x11DAB095, 0x1E9320E6, 0x1BABAF37,
+	0x29C47E88, 0x2CFCF159, 0x23B5612A, 0x268DEEFB, 0x3D2641CC, 0x381ECE1D, 0x37575E6E, 0x326FD1BF,
+	0x5388FD10, 0x56B072C1, 0x59F9E2B2, 0x5CC16D63, 0x476AC254, 0x42524D85, 0x4D1BDDF6, 0x48235227,
+	0x7A4C8398, 0x7F740C49, 0x703D9C3A, 0x750513EB, 0x6EAEBCDC, 0x6B96330D, 0x64DFA37E, 0x61E72CAF,
+	0x367596B7, 0x334D1966, 0x3C048915, 0x393C06C4, 0x2297A9F3, 0x27AF2622, 0x28E6B651, 0x2DDE3980,
+	0x1FB1E83F, 0x1A8967EE, 0x15C0F79D, 0x10F8784C, 0x0B53D77B, 0x0E6B58AA, 0x0122C8D9, 0x041A4708,
+	0x65FD6BA7, 0x60C5E476, 0x6F8C7405, 0x6AB4FBD4, 0x711F54E3, 0x7427DB32, 0x7B6E4B41, 0x7E56C490,
+	0x4C39152F, 0x49019AFE, 0x46480A8D, 0x4370855C, 0x58DB2A6B, 0x5DE3A5BA, 0x52AA35C9, 0x5792BA18,
+	0x6CEB2D6E, 0x69D3A2BF, 0x669A32CC, 0x63A2BD1D, 0x7809122A, 0x7D319DFB, 0x72780D88, 0x77408259,
+	0x452F53E6, 0x4017DC37, 0x4F5E4C44, 0x4A66C395, 0x51CD6CA2, 0x54F5E373, 0x5BBC7300, 0x5E84FCD1,
+	0x3F63D07E, 0x3A5B5FAF, 0x3512CFDC, 0x302A400D, 0x2B81EF3A, 0x2EB960EB, 0x21F0F098, 0x24C87F49,
+	0x16A7AEF6, 0x139F2127, 0x1CD6B154, 0x19EE3E85, 0x024591B2, 0x077D1E63, 0x08348E10, 0x0D0C01C1,
+	0x5A9EBBD9, 0x5FA63408, 0x50EFA47B, 0x55D72BAA, 0x4E7C849D, 0x4B440B4C, 0x440D9B3F, 0x413514EE,
+	0x735AC551, 0x76624A80, 0x792BDAF3, 0x7C135522, 0x67B8FA15, 0x628075C4, 0x6DC9E5B7, 0x68F16A66,
+	0x091646C9, 0x0C2EC918, 0x0367596B, 0x065FD6BA, 0x1DF4798D, 0x18CCF65C, 0x1785662F, 0x12BDE9FE,
+	0x20D23841, 0x25EAB790, 0x2AA327E3, 0x2F9BA832, 0x34300705, 0x310888D4, 0x3E4118A7, 0x3B799776,
+	0x48B2364B, 0x4D8AB99A, 0x42C329E9, 0x47FBA638, 0x5C50090F, 0x596886DE, 0x562116AD, 0x5319997C,
+	0x617648C3, 0x644EC712, 0x6B075761, 0x6E3FD8B0, 0x75947787, 0x70ACF856, 0x7FE56825, 0x7ADDE7F4,
+	0x1B3ACB5B, 0x1E02448A, 0x114BD4F9, 0x14735B28, 0x0FD8F41F, 0x0AE07BCE, 0x05A9EBBD, 0x0091646C,
+	0x32FEB5D3, 0x37C63A02, 0x388FAA71, 0x3DB725A0, 0x261C8A97, 0x23240546, 0x2C6D9535, 0x29551AE4,
+	0x7EC7A0FC, 0x7BFF2F2D, 0x74B6BF5E, 0x718E308F, 0x6A259FB8, 0x6F1D1069, 0x6054801A, 0x656C0FCB,
+	0x5703DE74, 0x523B51A5, 0x5D72C1D6, 0x584A4E07, 0x43E1E130, 0x46D96EE1, 0x4990FE92, 0x4CA87143,
+	0x2D4F5DEC, 0x2877D23D, 0x273E424E, 0x2206CD9F, 0x39AD62A8, 0x3C95ED79, 0x33DC7D0A, 0x36E4F2DB,
+	0x048B2364, 0x01B3ACB5, 0x0EFA3CC6, 0x0BC2B317, 0x10691C20, 0x155193F1, 0x1A180382, 0x1F208C53,
+	0x24591B25, 0x216194F4, 0x2E280487, 0x2B108B56, 0x30BB2461, 0x3583ABB0, 0x3ACA3BC3, 0x3FF2B412,
+	0x0D9D65AD, 0x08A5EA7C, 0x07EC7A0F, 0x02D4F5DE, 0x197F5AE9, 0x1C47D538, 0x130E454B, 0x1636CA9A,
+	0x77D1E635, 0x72E969E4, 0x7DA0F997, 0x78987646, 0x6333D971, 0x660B56A0, 0x6942C6D3, 0x6C7A4902,
+	0x5E1598BD, 0x5B2D176C, 0x5464871F, 0x515C08CE, 0x4AF7A7F9, 0x4FCF2828, 0x4086B85B, 0x45BE378A,
+	0x122C8D92, 0x17140243, 0x185D9230, 0x1D651DE1, 0x06CEB2D6, 0x03F63D07, 0x0CBFAD74, 0x098722A5,
+	0x3BE8F31A, 0x3ED07CCB, 0x3199ECB8, 0x34A16369, 0x2F0ACC5E, 0x2A32438F, 0x257BD3FC, 0x20435C2D,
+	0x41A47082, 0x449CFF53, 0x4BD56F20, 0x4EEDE0F1, 0x55464FC6, 0x507EC017, 0x5F375064, 0x5A0FDFB5,
+	0x68600E0A, 0x6D5881DB, 0x621111A8, 0x67299E79, 0x7C82314E, 0x79BABE9F, 0x76F32EEC, 0x73CBA13D,
+	// Seed 0xA8
+	0x00000000, 0x857887C8, 0xBAEB5825, 0x3F93DFED, 0xC5CCE7FF, 0x40B46037, 0x7F27BFDA, 0xFA5F3812,
+	0x3B83984B, 0xBEFB1F83, 0x8168C06E, 0x041047A6, 0xFE4F7FB4, 0x7B37F87C, 0x44A42791, 0xC1DCA059,
+	0x77073096, 0xF27FB75E, 0xCDEC68B3, 0x4894EF7B, 0xB2CBD769, 0x37B350A1, 0x08208F4C, 0x8D580884,
+	0x4C84A8DD, 0xC9FC2F15, 0xF66FF0F8, 0x73177730, 0x89484F22, 0x0C30C8EA, 0x33A31707, 0xB6DB90CF,
+	0xEE0E612C, 0x6B76E6E4, 0x54E53909, 0xD19DBEC1, 0x2BC286D3, 0xAEBA011B, 0x9129DEF6, 0x1451593E,
+	0xD58DF967, 0x50F57EAF, 0x6F66A142, 0xEA1E268A, 0x10411E98, 0x95399950, 0xAAAA46BD, 0x2FD2C175,
+	0x990951BA, 0x1C71D672, 0x23E2099F, 0xA69A8E57, 0x5CC5B645, 0xD9BD318D, 0xE62EEE60, 0x635669A8,
+	0xA28AC9F1, 0x27F24E39, 0x186191D4, 0x9D19161C, 0x67462E0E, 0xE23EA9C6, 0xDDAD762B, 0x58D5F1E3,
+	0x6C0695ED, 0xE97E1225, 0xD6EDCDC8, 0x53954A00, 0xA9CA7212, 0x2CB2F5DA, 0x13212A37, 0x9659ADFF,
+	0x57850DA6, 0xD2FD8A6E, 0xED6E5583, 0x6816D24B, 0x9249EA59, 0x17316D91, 0x28A2B27C, 0xADDA35B4,
+	0x1B01A57B, 0x9E7922B3, 0xA1EAFD5E, 0x24927A96, 0xDECD4284, 0x5BB5C54C, 0x64261AA1, 0xE15E9D69,
+	0x20823D30, 0xA5FABAF8, 0x9A696515, 0x1F11E2DD, 0xE54EDACF, 0x60365D07, 0x5FA582EA, 0xDADD0522,
+	0x8208F4C1, 0x07707309, 0x38E3ACE4, 0xBD9B2B2C, 0x47C4133E, 0xC2BC94F6, 0xFD2F4B1B, 0x7857CCD3,
+	0xB98B6C8A, 0x3CF3EB42, 0x036034AF, 0x8618B367, 0x7C478B75, 0xF93F0CBD, 0xC6ACD350, 0x43D45498,
+	0xF50FC457, 0x7077439F, 0x4FE49C72, 0xCA9C1BBA, 0x30C323A8, 0xB5BBA460, 0x8A287B8D, 0x0F50FC45,
+	0xCE8C5C1C, 0x4BF4DBD4, 0x74670439, 0xF11F83F1, 0x0B40BBE3, 0x8E383C2B, 0xB1ABE3C6, 0x34D3640E,
+	0xD80D2BDA, 0x5D75AC12, 0x62E673FF, 0xE79EF437, 0x1DC1CC25, 0x98B94BED, 0xA72A9400, 0x225213C8,
+	0xE38EB391, 0x66F63459, 0x5965EBB4, 0xDC1D6C7C, 0x2642546E, 0xA33AD3A6, 0x9CA90C4B, 0x19D18B83,
+	0xAF0A1B4C, 0x2A729C84, 0x15E14369, 0x9099C4A1, 0x6AC6FCB3, 0xEFBE7B7B, 0xD02DA496, 0x5555235E,
+	0x94898307, 0x11F104CF, 0x2E62DB22, 0xAB1A5CEA, 0x514564F8, 0xD43DE330, 0xEBAE3CDD, 0x6ED6BB15,
+	0x36034AF6, 0xB37BCD3E, 0x8CE812D3, 0x0990951B, 0xF3CFAD09, 0x76B72AC1, 0x4924F52C, 0xCC5C72E4,
+	0x0D80D2BD, 0x88F85575, 0xB76B8A98, 0x32130D50, 0xC84C3542, 0x4D34B28A, 0x72A76D67, 0xF7DFEAAF,
+	0x41047A60, 0xC47CFDA8, 0xFBEF2245, 0x7E97A58D, 0x84C89D9F, 0x01B01A57, 0x3E23C5BA, 0xBB5B4272,
+	0x7A87E22B, 0xFFFF65E3, 0xC06CBA0E, 0x45143DC6, 0xBF4B05D4, 0x3A33821C, 0x05A05DF1, 0x80D8DA39,
+	0xB40BBE37, 0x317339FF, 0x0EE0E612, 0x8B9861DA, 0x71C759C8, 0xF4BFDE00, 0xCB2C01ED, 0x4E548625,
+	0x8F88267C, 0x0AF0A1B4, 0x35637E59, 0xB01BF991, 0x4A44C183, 0xCF3C464B, 0xF0AF99A6, 0x75D71E6E,
+	0xC30C8EA1, 0x46740969, 0x79E7D684, 0xFC9F514C, 0x06C0695E, 0x83B8EE96, 0xBC2B317B, 0x3953B6B3,
+	0xF88F16EA, 0x7DF79122, 0x42644ECF, 0xC71CC907, 0x3D43F115, 0xB83B76DD, 0x87A8A930, 0x02D02EF8,
+	0x5A05DF1B, 0xDF7D58D3, 0xE0EE873E, 0x659600F6, 0x9FC938E4, 0x1AB1BF2C, 0x252260C1, 0xA05AE709,
+	0x61864750, 0xE4FEC098, 0xDB6D1F75, 0x5E1598BD, 0xA44AA0AF, 0x21322767, 0x1EA1F88A, 0x9BD97F42,
+	0x2D02EF8D, 0xA87A6845, 0x97E9B7A8, 0x12913060, 0xE8CE0872, 0x6DB68FBA, 0x52255057, 0xD75DD79F,
+	0x168177C6, 0x93F9F00E, 0xAC6A2FE3, 0x2912A82B, 0xD34D9039, 0x563517F1, 0x69A6C81C, 0xECDE4FD4,
+	// Seed 0xA9
+	0x00000000, 0xE6C0E001, 0x9395F69B, 0x7555169A, 0x793FDBAF, 0x9FFF3BAE, 0xEAAA2D34, 0x0C6ACD35,
+	0xF27FB75E, 0x14BF575F, 0x61EA41C5, 0x872AA1C4, 0x8B406CF1, 0x6D808CF0, 0x18D59A6A, 0xFE157A6B,
+	0xBAEB5825, 0x5C2BB824, 0x297EAEBE, 0xCFBE4EBF, 0xC3D4838A, 0x2514638B, 0x50417511, 0xB6819510,
+	0x4894EF7B, 0xAE540F7A, 0xDB0119E0, 0x3DC1F9E1, 0x31AB34D4, 0xD76BD4D5, 0xA23EC24F, 0x44FE224E,
+	0x2BC286D3, 0xCD0266D2, 0xB8577048, 0x5E979049, 0x52FD5D7C, 0xB43DBD7D, 0xC168ABE7, 0x27A84BE6,
+	0xD9BD318D, 0x3F7DD18C, 0x4A28C716, 0xACE82717, 0xA082EA22, 0x46420A23, 0x33171CB9, 0xD5D7FCB8,
+	0x9129DEF6, 0x77E93EF7, 0x02BC286D, 0xE47CC86C, 0xE8160559, 0x0ED6E558, 0x7B83F3C2, 0x9D4313C3,
+	0x635669A8, 0x859689A9, 0xF0C39F33, 0x16037F32, 0x1A69B207, 0xFCA95206, 0x89FC449C, 0x6F3CA49D,
+	0x57850DA6, 0xB145EDA7, 0xC410FB3D, 0x22D01B3C, 0x2EBAD609, 0xC87A3608, 0xBD2F2092, 0x5BEFC093,
+	0xA5FABAF8, 0x433A5AF9, 0x366F4C63, 0xD0AFAC62, 0xDCC56157, 0x3A058156, 0x4F5097CC, 0xA99077CD,
+	0xED6E5583, 0x0BAEB582, 0x7EFBA318, 0x983B4319, 0x94518E2C, 0x72916E2D, 0x07C478B7, 0xE10498B6,
+	0x1F11E2DD, 0xF9D102DC, 0x8C841446, 0x6A44F447, 0x662E3972, 0x80EED973, 0xF5BBCFE9, 0x137B2FE8,
+	0x7C478B75, 0x9A876B74, 0xEFD27DEE, 0x09129DEF, 0x057850DA, 0xE3B8B0DB, 0x96EDA641, 0x702D4640,
+	0x8E383C2B, 0x68F8DC2A, 0x1DADCAB0, 0xFB6D2AB1, 0xF707E784, 0x11C70785, 0x6492111F, 0x8252F11E,
+	0xC6ACD350, 0x206C3351, 0x553925CB, 0xB3F9C5CA, 0xBF9308FF, 0x5953E8FE, 0x2C06FE64, 0xCAC61E65,
+	0x34D3640E, 0xD213840F, 0xA7469295, 0x41867294, 0x4DECBFA1, 0xAB2C5FA0, 0xDE79493A, 0x38B9A93B,
+	0xAF0A1B4C, 0x49CAFB4D, 0x3C9FEDD7, 0xDA5F0DD6, 0xD635C0E3, 0x30F520E2, 0x45A03678, 0xA360D679,
+	0x5D75AC12, 0xBBB54C13, 0xCEE05A89, 0x2820BA88, 0x244A77BD, 0xC28A97BC, 0xB7DF8126, 0x511F6127,
+	0x15E14369, 0xF321A368, 0x8674B5F2, 0x60B455F3, 0x6CDE98C6, 0x8A1E78C7, 0xFF4B6E5D, 0x198B8E5C,
+	0xE79EF437, 0x015E1436, 0x740B02AC, 0x92CBE2AD, 0x9EA12F98, 0x7861CF99, 0x0D34D903, 0xEBF43902,
+	0x84C89D9F, 0x62087D9E, 0x175D6B04, 0xF19D8B05, 0xFDF74630, 0x1B37A631, 0x6E62B0AB, 0x88A250AA,
+	0x76B72AC1, 0x9077CAC0, 0xE522DC5A, 0x03E23C5B, 0x0F88F16E, 0xE948116F, 0x9C1D07F5, 0x7ADDE7F4,
+	0x3E23C5BA, 0xD8E325BB, 0xADB63321, 0x4B76D320, 0x471C1E15, 0xA1DCFE14, 0xD489E88E, 0x3249088F,
+	0xCC5C72E4, 0x2A9C92E5, 0x5FC9847F, 0xB909647E, 0xB563A94B, 0x53A3494A, 0x26F65FD0, 0xC036BFD1,
+	0xF88F16EA, 0x1E4FF6EB, 0x6B1AE071, 0x8DDA0070, 0x81B0CD45, 0x67702D44, 0x12253BDE, 0xF4E5DBDF,
+	0x0AF0A1B4, 0xEC3041B5, 0x9965572F, 0x7FA5B72E, 0x73CF7A1B, 0x950F9A1A, 0xE05A8C80, 0x069A6C81,
+	0x42644ECF, 0xA4A4AECE, 0xD1F1B854, 0x37315855, 0x3B5B9560, 0xDD9B7561, 0xA8CE63FB, 0x4E0E83FA,
+	0xB01BF991, 0x56DB1990, 0x238E0F0A, 0xC54EEF0B, 0xC924223E, 0x2FE4C23F, 0x5AB1D4A5, 0xBC7134A4,
+	0xD34D9039, 0x358D7038, 0x40D866A2, 0xA61886A3, 0xAA724B96, 0x4CB2AB97, 0x39E7BD0D, 0xDF275D0C,
+	0x21322767, 0xC7F2C766, 0xB2A7D1FC, 0x546731FD, 0x580DFCC8, 0xBECD1CC9, 0xCB980A53, 0x2D58EA52,
+	0x69A6C81C, 0x8F66281D, 0xFA333E87, 0x1CF3DE86, 0x109913B3, 0xF659F3B2, 0x830CE528, 0x65CC0529,
+	0x9BD97F42, 0x7D199F43, 0x084C89D9, 0xEE8C69D8, 0xE2E6A4ED, 0x042644EC, 0x71735276, 0x97B3B277,
+	// Seed 0xAA
+	0x00000000, 0x12FD36F5, 0x25FA6DEA, 0x37075B1F, 0x27F24E39, 0x350F78CC, 0x020823D3, 0x10F51526,
+	0x23E2099F, 0x311F3F6A, 0x06186475, 0x14E55280, 0x041047A6, 0x16ED7153, 0x21EA2A4C, 0x33171CB9,
+	0x2BC286D3, 0x393FB026, 0x0E38EB39, 0x1CC5DDCC, 0x0C30C8EA, 0x1ECDFE1F, 0x29CAA500, 0x3B3793F5,
+	0x08208F4C, 0x1ADDB9B9, 0x2DDAE2A6, 0x3F27D453, 0x2FD2C175, 0x3D2FF780, 0x0A28AC9F, 0x18D59A6A,
+	0x3B83984B, 0x297EAEBE, 0x1E79F5A1, 0x0C84C354, 0x1C71D672, 0x0E8CE087, 0x398BBB98, 0x2B768D6D,
+	0x186191D4, 0x0A9CA721, 0x3D9BFC3E, 0x2F66CACB, 0x3F93DFED, 0x2D6EE918, 0x1A69B207, 0x089484F2,
+	0x10411E98, 0x02BC286D, 0x35BB7372, 0x27464587, 0x37B350A1, 0x254E6654, 0x12493D4B, 0x00B40BBE,
+	0x33A31707, 0x215E21F2, 0x16597AED, 0x04A44C18, 0x1451593E, 0x06AC6FCB, 0x31AB34D4, 0x23560221,
+	0x1B01A57B, 0x09FC938E, 0x3EFBC891, 0x2C06FE64, 0x3CF3EB42, 0x2E0EDDB7, 0x190986A8, 0x0BF4B05D,
+	0x38E3ACE4, 0x2A1E9A11, 0x1D19C10E, 0x0FE4F7FB, 0x1F11E2DD, 0x0DECD428, 0x3AEB8F37, 0x2816B9C2,
+	0x30C323A8, 0x223E155D, 0x15394E42, 0x07C478B7, 0x17316D91, 0x05CC5B64, 0x32CB007B, 0x2036368E,
+	0x13212A37, 0x01DC1CC2, 0x36DB47DD, 0x24267128, 0x34D3640E, 0x262E52FB, 0x112909E4, 0x03D43F11,
+	0x20823D30, 0x327F0BC5, 0x057850DA, 0x1785662F, 0x07707309, 0x158D45FC, 0x228A1EE3, 0x30772816,
+	0x036034AF, 0x119D025A, 0x269A5945, 0x34676FB0, 0x24927A96, 0x366F4C63, 0x0168177C, 0x13952189,
+	0x0B40BBE3, 0x19BD8D16, 0x2EBAD609, 0x3C47E0FC, 0x2CB2F5DA, 0x3E4FC32F, 0x09489830, 0x1BB5AEC5,
+	0x28A2B27C, 0x3A5F8489, 0x0D58DF96, 0x1FA5E963, 0x0F50FC45, 0x1DADCAB0, 0x2AAA91AF, 0x3857A75A,
+	0x36034AF6, 0x24FE7C03, 0x13F9271C, 0x010411E9, 0x11F104CF, 0x030C323A, 0x340B6925, 0x26F65FD0,
+	0x15E14369, 0x071C759C, 0x301B2E83, 0x22E61876, 0x32130D50, 0x20EE3BA5, 0x17E960BA, 0x0514564F,
+	0x1DC1CC25, 0x0F3CFAD0, 0x383BA1CF, 0x2AC6973A, 0x3A33821C, 0x28CEB4E9, 0x1FC9EFF6, 0x0D34D903,
+	0x3E23C5BA, 0x2CDEF34F, 0x1BD9A850, 0x09249EA5, 0x19D18B83, 0x0B2CBD76, 0x3C2BE669, 0x2ED6D09C,
+	0x0D80D2BD, 0x1F7DE448, 0x287ABF57, 0x3A8789A2, 0x2A729C84, 0x388FAA71, 0x0F88F16E, 0x1D75C79B,
+	0x2E62DB22, 0x3C9FEDD7, 0x0B98B6C8, 0x1965803D, 0x0990951B, 0x1B6DA3EE, 0x2C6AF8F1, 0x3E97CE04,
+	0x2642546E, 0x34BF629B, 0x03B83984, 0x11450F71, 0x01B01A57, 0x134D2CA2, 0x244A77BD, 0x36B74148,
+	0x05A05DF1, 0x175D6B04, 0x205A301B, 0x32A706EE, 0x225213C8, 0x30AF253D, 0x07A87E22, 0x155548D7,
+	0x2D02EF8D, 0x3FFFD978, 0x08F88267, 0x1A05B492, 0x0AF0A1B4, 0x180D9741, 0x2F0ACC5E, 0x3DF7FAAB,
+	0x0EE0E612, 0x1C1DD0E7, 0x2B1A8BF8, 0x39E7BD0D, 0x2912A82B, 0x3BEF9EDE, 0x0CE8C5C1, 0x1E15F334,
+	0x06C0695E, 0x143D5FAB, 0x233A04B4, 0x31C73241, 0x21322767, 0x33CF1192, 0x04C84A8D, 0x16357C78,
+	0x252260C1, 0x37DF5634, 0x00D80D2B, 0x12253BDE, 0x02D02EF8, 0x102D180D, 0x272A4312, 0x35D775E7,
+	0x168177C6, 0x047C4133, 0x337B1A2C, 0x21862CD9, 0x317339FF, 0x238E0F0A, 0x14895415, 0x067462E0,
+	0x35637E59, 0x279E48AC, 0x109913B3, 0x02642546, 0x12913060, 0x006C0695, 0x376B5D8A, 0x25966B7F,
+	0x3D43F115, 0x2FBEC7E0, 0x18B99CFF, 0x0A44AA0A, 0x1AB1BF2C, 0x084C89D9, 0x3F4BD2C6, 0x2DB6E433,
+	0x1EA1F88A, 0x0C5CCE7F, 0x3B5B9560, 0x29A6A395, 0x3953B6B3, 0x2BAE8046, 0x1CA9DB59, 0x0E54EDAC,
+	// Seed 0xAB
+	0x00000000, 0x61044FA4, 0x40006B89, 0x2104242D, 0x020823D3, 0x630C6C77, 0x4208485A, 0x230C07FE,
+	0x041047A6, 0x65140802, 0x44102C2F, 0x2514638B, 0x06186475, 0x671C2BD1, 0x46180FFC, 0x271C4058,
+	0x08208F4C, 0x6924C0E8, 0x4820E4C5, 0x2924AB61, 0x0A28AC9F, 0x6B2CE33B, 0x4A28C716, 0x2B2C88B2,
+	0x0C30C8EA, 0x6D34874E, 0x4C30A363, 0x2D34ECC7, 0x0E38EB39, 0x6F3CA49D, 0x4E3880B0, 0x2F3CCF14,
+	0x10411E98, 0x7145513C, 0x50417511, 0x31453AB5, 0x12493D4B, 0x734D72EF, 0x524956C2, 0x334D1966,
+	0x1451593E, 0x7555169A, 0x545132B7, 0x35557D13, 0x16597AED, 0x775D3549, 0x56591164, 0x375D5EC0,
+	0x186191D4, 0x7965DE70, 0x5861FA5D, 0x3965B5F9, 0x1A69B207, 0x7B6DFDA3, 0x5A69D98E, 0x3B6D962A,
+	0x1C71D672, 0x7D7599D6, 0x5C71BDFB, 0x3D75F25F, 0x1E79F5A1, 0x7F7DBA05, 0x5E799E28, 0x3F7DD18C,
+	0x20823D30, 0x41867294, 0x608256B9, 0x0186191D, 0x228A1EE3, 0x438E5147, 0x628A756A, 0x038E3ACE,
+	0x24927A96, 0x45963532, 0x6492111F, 0x05965EBB, 0x269A5945, 0x479E16E1, 0x669A32CC, 0x079E7D68,
+	0x28A2B27C, 0x49A6FDD8, 0x68A2D9F5, 0x09A69651, 0x2AAA91AF, 0x4BAEDE0B, 0x6AAAFA26, 0x0BAEB582,
+	0x2CB2F5DA, 0x4DB6BA7E, 0x6CB29E53, 0x0DB6D1F7, 0x2EBAD609, 0x4FBE99AD, 0x6EBABD80, 0x0FBEF224,
+	0x30C323A8, 0x51C76C0C, 0x70C34821, 0x11C70785, 0x32CB007B, 0x53CF4FDF, 0x72CB6BF2, 0x13CF2456,
+	0x34D3640E, 0x55D72BAA, 0x74D30F87, 0x15D74023, 0x36DB47DD, 0x57DF0879, 0x76DB2C54, 0x17DF63F0,
+	0x38E3ACE4, 0x59E7E340, 0x78E3C76D, 0x19E788C9, 0x3AEB8F37, 0x5BEFC093, 0x7AEBE4BE, 0x1BEFAB1A,
+	0x3CF3EB42, 0x5DF7A4E6, 0x7CF380CB, 0x1DF7CF6F, 0x3EFBC891, 0x5FFF8735, 0x7EFBA318, 0x1FFFECBC,
+	0x41047A60, 0x200035C4, 0x010411E9, 0x60005E4D, 0x430C59B3, 0x22081617, 0x030C323A, 0x62087D9E,
+	0x45143DC6, 0x24107262, 0x0514564F, 0x641019EB, 0x471C1E15, 0x261851B1, 0x071C759C, 0x66183A38,
+	0x4924F52C, 0x2820BA88, 0x09249EA5, 0x6820D101, 0x4B2CD6FF, 0x2A28995B, 0x0B2CBD76, 0x6A28F2D2,
+	0x4D34B28A, 0x2C30FD2E, 0x0D34D903, 0x6C3096A7, 0x4F3C9159, 0x2E38DEFD, 0x0F3CFAD0, 0x6E38B574,
+	0x514564F8, 0x30412B5C, 0x11450F71, 0x704140D5, 0x534D472B, 0x3249088F, 0x134D2CA2, 0x72496306,
+	0x5555235E, 0x34516CFA, 0x155548D7, 0x74510773, 0x575D008D, 0x36594F29, 0x175D6B04, 0x765924A0,
+	0x5965EBB4, 0x3861A410, 0x1965803D, 0x7861CF99, 0x5B6DC867, 0x3A6987C3, 0x1B6DA3EE, 0x7A69EC4A,
+	0x5D75AC12, 0x3C71E3B6, 0x1D75C79B, 0x7C71883F, 0x5F7D8FC1, 0x3E79C065, 0x1F7DE448, 0x7E79ABEC,
+	0x61864750, 0x008208F4, 0x21862CD9, 0x4082637D, 0x638E6483, 0x028A2B27, 0x238E0F0A, 0x428A40AE,
+	0x659600F6, 0x04924F52, 0x25966B7F, 0x449224DB, 0x679E2325, 0x069A6C81, 0x279E48AC, 0x469A0708,
+	0x69A6C81C, 0x08A287B8, 0x29A6A395, 0x48A2EC31, 0x6BAEEBCF, 0x0AAAA46B, 0x2BAE8046, 0x4AAACFE2,
+	0x6DB68FBA, 0x0CB2C01E, 0x2DB6E433, 0x4CB2AB97, 0x6FBEAC69, 0x0EBAE3CD, 0x2FBEC7E0, 0x4EBA8844,
+	0x71C759C8, 0x10C3166C, 0x31C73241, 0x50C37DE5, 0x73CF7A1B, 0x12CB35BF, 0x33CF1192, 0x52CB5E36,
+	0x75D71E6E, 0x14D351CA, 0x35D775E7, 0x54D33A43, 0x77DF3DBD, 0x16DB7219, 0x37DF5634, 0x56DB1990,
+	0x79E7D684, 0x18E39920, 0x39E7BD0D, 0x58E3F2A9, 0x7BEFF557, 0x1AEBBAF3, 0x3BEF9EDE, 0x5AEBD17A,
+	0x7DF79122, 0x1CF3DE86, 0x3DF7FAAB, 0x5CF3B50F, 0x7FFFB2F1, 0x1EFBFD55, 0x3FFFD978, 0x5EFB96DC,
+	// Seed 0xAC
+	0x00000000, 0x7B692685, 0xF6D24D0A, 0x8DBB6B8F, 0x53654593, 0x280C6316, 0xA5B70899, 0xDEDE2E1C,
+	0xA6CA8B26, 0xDDA3ADA3, 0x5018C62C, 0x2B71E0A9, 0xF5AFCEB5, 0x8EC6E830, 0x037D83BF, 0x7814A53A,
+	0xF354C9CB, 0x883DEF4E, 0x058684C1, 0x7EEFA244, 0xA0318C58, 0xDB58AADD, 0x56E3C152, 0x2D8AE7D7,
+	0x559E42ED, 0x2EF76468, 0xA34C0FE7, 0xD8252962, 0x06FB077E, 0x7D9221FB, 0xF0294A74, 0x8B406CF1,
+	0x58684C11, 0x23016A94, 0xAEBA011B, 0xD5D3279E, 0x0B0D0982, 0x70642F07, 0xFDDF4488, 0x86B6620D,
+	0xFEA2C737, 0x85CBE1B2, 0x08708A3D, 0x7319ACB8, 0xADC782A4, 0xD6AEA421, 0x5B15CFAE, 0x207CE92B,
+	0xAB3C85DA, 0xD055A35F, 0x5DEEC8D0, 0x2687EE55, 0xF859C049, 0x8330E6CC, 0x0E8B8D43, 0x75E2ABC6,
+	0x0DF60EFC, 0x769F2879, 0xFB2443F6, 0x804D6573, 0x5E934B6F, 0x25FA6DEA, 0xA8410665, 0xD32820E0,
+	0xB0D09822, 0xCBB9BEA7, 0x4602D528, 0x3D6BF3AD, 0xE3B5DDB1, 0x98DCFB34, 0x156790BB, 0x6E0EB63E,
+	0x161A1304, 0x6D733581, 0xE0C85E0E, 0x9BA1788B, 0x457F5697, 0x3E167012, 0xB3AD1B9D, 0xC8C43D18,
+	0x438451E9, 0x38ED776C, 0xB5561CE3, 0xCE3F3A66, 0x10E1147A, 0x6B8832FF, 0xE6335970, 0x9D5A7FF5,
+	0xE54EDACF, 0x9E27FC4A, 0x139C97C5, 0x68F5B140, 0xB62B9F5C, 0xCD42B9D9, 0x40F9D256, 0x3B90F4D3,
+	0xE8B8D433, 0x93D1F2B6, 0x1E6A9939, 0x6503BFBC, 0xBBDD91A0, 0xC0B4B725, 0x4D0FDCAA, 0x3666FA2F,
+	0x4E725F15, 0x351B7990, 0xB8A0121F, 0xC3C9349A, 0x1D171A86, 0x667E3C03, 0xEBC5578C, 0x90AC7109,
+	0x1BEC1DF8, 0x60853B7D, 0xED3E50F2, 0x96577677, 0x4889586B, 0x33E07EEE, 0xBE5B1561, 0xC53233E4,
+	0xBD2696DE, 0xC64FB05B, 0x4BF4DBD4, 0x309DFD51, 0xEE43D34D, 0x952AF5C8, 0x18919E47, 0x63F8B8C2,
+	0xDF60EFC3, 0xA409C946, 0x29B2A2C9, 0x52DB844C, 0x8C05AA50, 0xF76C8CD5, 0x7AD7E75A, 0x01BEC1DF,
+	0x79AA64E5, 0x02C34260, 0x8F7829EF, 0xF4110F6A, 0x2ACF2176, 0x51A607F3, 0xDC1D6C7C, 0xA7744AF9,
+	0x2C342608, 0x575D008D, 0xDAE66B02, 0xA18F4D87, 0x7F51639B, 0x0438451E, 0x89832E91, 0xF2EA0814,
+	0x8AFEAD2E, 0xF1978BAB, 0x7C2CE024, 0x0745C6A1, 0xD99BE8BD, 0xA2F2CE38, 0x2F49A5B7, 0x54208332,
+	0x8708A3D2, 0xFC618557, 0x71DAEED8, 0x0AB3C85D, 0xD46DE641, 0xAF04C0C4, 0x22BFAB4B, 0x59D68DCE,
+	0x21C228F4, 0x5AAB0E71, 0xD71065FE, 0xAC79437B, 0x72A76D67, 0x09CE4BE2, 0x8475206D, 0xFF1C06E8,
+	0x745C6A19, 0x0F354C9C, 0x828E2713, 0xF9E70196, 0x27392F8A, 0x5C50090F, 0xD1EB6280, 0xAA824405,
+	0xD296E13F, 0xA9FFC7BA, 0x2444AC35, 0x5F2D8AB0, 0x81F3A4AC, 0xFA9A8229, 0x7721E9A6, 0x0C48CF23,
+	0x6FB077E1, 0x14D95164, 0x99623AEB, 0xE20B1C6E, 0x3CD53272, 0x47BC14F7, 0xCA077F78, 0xB16E59FD,
+	0xC97AFCC7, 0xB213DA42, 0x3FA8B1CD, 0x44C19748, 0x9A1FB954, 0xE1769FD1, 0x6CCDF45E, 0x17A4D2DB,
+	0x9CE4BE2A, 0xE78D98AF, 0x6A36F320, 0x115FD5A5, 0xCF81FBB9, 0xB4E8DD3C, 0x3953B6B3, 0x423A9036,
+	0x3A2E350C, 0x41471389, 0xCCFC7806, 0xB7955E83, 0x694B709F, 0x1222561A, 0x9F993D95, 0xE4F01B10,
+	0x37D83BF0, 0x4CB11D75, 0xC10A76FA, 0xBA63507F, 0x64BD7E63, 0x1FD458E6, 0x926F3369, 0xE90615EC,
+	0x9112B0D6, 0xEA7B9653, 0x67C0FDDC, 0x1CA9DB59, 0xC277F545, 0xB91ED3C0, 0x34A5B84F, 0x4FCC9ECA,
+	0xC48CF23B, 0xBFE5D4BE, 0x325EBF31, 0x493799B4, 0x97E9B7A8, 0xEC80912D, 0x613BFAA2, 0x1A52DC27,
+	0x6246791D, 0x192F5F98, 0x94943417, 0xEFFD1292, 0x31233C8E, 0x4A4A1A0B, 0xC7F17184, 0xBC985701,
+	// Seed 0xAD
+	0x00000000, 0x91C0BD53, 0x734EC40D, 0xE28E795E, 0xE69D881A, 0x775D3549, 0x95D34C17, 0x0413F144,
+	0x9DF4AE9F, 0x0C3413CC, 0xEEBA6A92, 0x7F7AD7C1, 0x7B692685, 0xEAA99BD6, 0x0827E288, 0x99E75FDB,
+	0x6B26E395, 0xFAE65EC6, 0x18682798, 0x89A89ACB, 0x8DBB6B8F, 0x1C7BD6DC, 0xFEF5AF82, 0x6F3512D1,
+	0xF6D24D0A, 0x6712F059, 0x859C8907, 0x145C3454, 0x104FC510, 0x818F7843, 0x6301011D, 0xF2C1BC4E,
+	0xD64DC72A, 0x478D7A79, 0xA5030327, 0x34C3BE74, 0x30D04F30, 0xA110F263, 0x439E8B3D, 0xD25E366E,
+	0x4BB969B5, 0xDA79D4E6, 0x38F7ADB8, 0xA93710EB, 0xAD24E1AF, 0x3CE45CFC, 0xDE6A25A2, 0x4FAA98F1,
+	0xBD6B24BF, 0x2CAB99EC, 0xCE25E0B2, 0x5FE55DE1, 0x5BF6ACA5, 0xCA3611F6, 0x28B868A8, 0xB978D5FB,
+	0x209F8A20, 0xB15F3773, 0x53D14E2D, 0xC211F37E, 0xC602023A, 0x57C2BF69, 0xB54CC637, 0x248C7B64,
+	0xFC5430FF, 0x6D948DAC, 0x8F1AF4F2, 0x1EDA49A1, 0x1AC9B8E5, 0x8B0905B6, 0x69877CE8, 0xF847C1BB,
+	0x61A09E60, 0xF0602333, 0x12EE5A6D, 0x832EE73E, 0x873D167A, 0x16FDAB29, 0xF473D277, 0x65B36F24,
+	0x9772D36A, 0x06B26E39, 0xE43C1767, 0x75FCAA34, 0x71EF5B70, 0xE02FE623, 0x02A19F7D, 0x9361222E,
+	0x0A867DF5, 0x9B46C0A6, 0x79C8B9F8, 0xE80804AB, 0xEC1BF5EF, 0x7DDB48BC, 0x9F5531E2, 0x0E958CB1,
+	0x2A19F7D5, 0xBBD94A86, 0x595733D8, 0xC8978E8B, 0xCC847FCF, 0x5D44C29C, 0xBFCABBC2, 0x2E0A0691,
+	0xB7ED594A, 0x262DE419, 0xC4A39D47, 0x55632014, 0x5170D150, 0xC0B06C03, 0x223E155D, 0xB3FEA80E,
+	0x413F1440, 0xD0FFA913, 0x3271D04D, 0xA3B16D1E, 0xA7A29C5A, 0x36622109, 0xD4EC5857, 0x452CE504,
+	0xDCCBBADF, 0x4D0B078C, 0xAF857ED2, 0x3E45C381, 0x3A5632C5, 0xAB968F96, 0x4918F6C8, 0xD8D84B9B,
+	0xA867DF55, 0x39A76206, 0xDB291B58, 0x4AE9A60B, 0x4EFA574F, 0xDF3AEA1C, 0x3DB49342, 0xAC742E11,
+	0x359371CA, 0xA453CC99, 0x46DDB5C7, 0xD71D0894, 0xD30EF9D0, 0x42CE4483, 0xA0403DDD, 0x3180808E,
+	0xC3413CC0, 0x52818193, 0xB00FF8CD, 0x21CF459E, 0x25DCB4DA, 0xB41C0989, 0x569270D7, 0xC752CD84,
+	0x5EB5925F, 0xCF752F0C, 0x2DFB5652, 0xBC3BEB01, 0xB8281A45, 0x29E8A716, 0xCB66DE48, 0x5AA6631B,
+	0x7E2A187F, 0xEFEAA52C, 0x0D64DC72, 0x9CA46121, 0x98B79065, 0x09772D36, 0xEBF95468, 0x7A39E93B,
+	0xE3DEB6E0, 0x721E0BB3, 0x909072ED, 0x0150CFBE, 0x05433EFA, 0x948383A9, 0x760DFAF7, 0xE7CD47A4,
+	0x150CFBEA, 0x84CC46B9, 0x66423FE7, 0xF78282B4, 0xF39173F0, 0x6251CEA3, 0x80DFB7FD, 0x111F0AAE,
+	0x88F85575, 0x1938E826, 0xFBB69178, 0x6A762C2B, 0x6E65DD6F, 0xFFA5603C, 0x1D2B1962, 0x8CEBA431,
+	0x5433EFAA, 0xC5F352F9, 0x277D2BA7, 0xB6BD96F4, 0xB2AE67B0, 0x236EDAE3, 0xC1E0A3BD, 0x50201EEE,
+	0xC9C74135, 0x5807FC66, 0xBA898538, 0x2B49386B, 0x2F5AC92F, 0xBE9A747C, 0x5C140D22, 0xCDD4B071,
+	0x3F150C3F, 0xAED5B16C, 0x4C5BC832, 0xDD9B7561, 0xD9888425, 0x48483976, 0xAAC64028, 0x3B06FD7B,
+	0xA2E1A2A0, 0x33211FF3, 0xD1AF66AD, 0x406FDBFE, 0x447C2ABA, 0xD5BC97E9, 0x3732EEB7, 0xA6F253E4,
+	0x827E2880, 0x13BE95D3, 0xF130EC8D, 0x60F051DE, 0x64E3A09A, 0xF5231DC9, 0x17AD6497, 0x866DD9C4,
+	0x1F8A861F, 0x8E4A3B4C, 0x6CC44212, 0xFD04FF41, 0xF9170E05, 0x68D7B356, 0x8A59CA08, 0x1B99775B,
+	0xE958CB15, 0x78987646, 0x9A160F18, 0x0BD6B24B, 0x0FC5430F, 0x9E05FE5C, 0x7C8B8702, 0xED4B3A51,
+	0x74AC658A, 0xE56CD8D9, 0x07E2A187, 0x96221CD4, 0x9231ED90, 0x03F150C3, 0xE17F299D, 0x70BF94CE,
+	// Seed 0xAE
+	0x00000000, 0x3D924A72, 0x19F9893B, 0x246BC349, 0x33F31276, 0x0E615804, 0x2A0A9B4D, 0x1798D13F,
+	0x053B3933, 0x38A97341, 0x1CC2B008, 0x2150FA7A, 0x36C82B45, 0x0B5A6137, 0x2F31A27E, 0x12A3E80C,
+	0x0A767266, 0x37E43814, 0x138FFB5D, 0x2E1DB12F, 0x39856010, 0x04172A62, 0x207CE92B, 0x1DEEA359,
+	0x0F4D4B55, 0x32DF0127, 0x16B4C26E, 0x2B26881C, 0x3CBE5923, 0x012C1351, 0x2547D018, 0x18D59A6A,
+	0x14ECE4CC, 0x297EAEBE, 0x0D156DF7, 0x30872785, 0x271FF6BA, 0x1A8DBCC8, 0x3EE67F81, 0x037435F3,
+	0x11D7DDFF, 0x2C45978D, 0x082E54C4, 0x35BC1EB6, 0x2224CF89, 0x1FB685FB, 0x3BDD46B2, 0x064F0CC0,
+	0x1E9A96AA, 0x2308DCD8, 0x07631F91, 0x3AF155E3, 0x2D6984DC, 0x10FBCEAE, 0x34900DE7, 0x09024795,
+	0x1BA1AF99, 0x2633E5EB, 0x025826A2, 0x3FCA6CD0, 0x2852BDEF, 0x15C0F79D, 0x31AB34D4, 0x0C397EA6,
+	0x29D9C998, 0x144B83EA, 0x302040A3, 0x0DB20AD1, 0x1A2ADBEE, 0x27B8919C, 0x03D352D5, 0x3E4118A7,
+	0x2CE2F0AB, 0x1170BAD9, 0x351B7990, 0x088933E2, 0x1F11E2DD, 0x2283A8AF, 0x06E86BE6, 0x3B7A2194,
+	0x23AFBBFE, 0x1E3DF18C, 0x3A5632C5, 0x07C478B7, 0x105CA988, 0x2DCEE3FA, 0x09A520B3, 0x34376AC1,
+	0x269482CD, 0x1B06C8BF, 0x3F6D0BF6, 0x02FF4184, 0x156790BB, 0x28F5DAC9, 0x0C9E1980, 0x310C53F2,
+	0x3D352D54, 0x00A76726, 0x24CCA46F, 0x195EEE1D, 0x0EC63F22, 0x33547550, 0x173FB619, 0x2AADFC6B,
+	0x380E1467, 0x059C5E15, 0x21F79D5C, 0x1C65D72E, 0x0BFD0611, 0x366F4C63, 0x12048F2A, 0x2F96C558,
+	0x37435F32, 0x0AD11540, 0x2EBAD609, 0x13289C7B, 0x04B04D44, 0x39220736, 0x1D49C47F, 0x20DB8E0D,
+	0x32786601, 0x0FEA2C73, 0x2B81EF3A, 0x1613A548, 0x018B7477, 0x3C193E05, 0x1872FD4C, 0x25E0B73E,
+	0x316E8EEF, 0x0CFCC49D, 0x289707D4, 0x15054DA6, 0x029D9C99, 0x3F0FD6EB, 0x1B6415A2, 0x26F65FD0,
+	0x3455B7DC, 0x09C7FDAE, 0x2DAC3EE7, 0x103E7495, 0x07A6A5AA, 0x3A34EFD8, 0x1E5F2C91, 0x23CD66E3,
+	0x3B18FC89, 0x068AB6FB, 0x22E175B2, 0x1F733FC0, 0x08EBEEFF, 0x3579A48D, 0x111267C4, 0x2C802DB6,
+	0x3E23C5BA, 0x03B18FC8, 0x27DA4C81, 0x1A4806F3, 0x0DD0D7CC, 0x30429DBE, 0x14295EF7, 0x29BB1485,
+	0x25826A23, 0x18102051, 0x3C7BE318, 0x01E9A96A, 0x16717855, 0x2BE33227, 0x0F88F16E, 0x321ABB1C,
+	0x20B95310, 0x1D2B1962, 0x3940DA2B, 0x04D29059, 0x134A4166, 0x2ED80B14, 0x0AB3C85D, 0x3721822F,
+	0x2FF41845, 0x12665237, 0x360D917E, 0x0B9FDB0C, 0x1C070A33, 0x21954041, 0x05FE8308, 0x386CC97A,
+	0x2ACF2176, 0x175D6B04, 0x3336A84D, 0x0EA4E23F, 0x193C3300, 0x24AE7972, 0x00C5BA3B, 0x3D57F049,
+	0x18B74777, 0x25250D05, 0x014ECE4C, 0x3CDC843E, 0x2B445501, 0x16D61F73, 0x32BDDC3A, 0x0F2F9648,
+	0x1D8C7E44, 0x201E3436, 0x0475F77F, 0x39E7BD0D, 0x2E7F6C32, 0x13ED2640, 0x3786E509, 0x0A14AF7B,
+	0x12C13511, 0x2F537F63, 0x0B38BC2A, 0x36AAF658, 0x21322767, 0x1CA06D15, 0x38CBAE5C, 0x0559E42E,
+	0x17FA0C22, 0x2A684650, 0x0E038519, 0x3391CF6B, 0x24091E54, 0x199B5426, 0x3DF0976F, 0x0062DD1D,
+	0x0C5BA3BB, 0x31C9E9C9, 0x15A22A80, 0x283060F2, 0x3FA8B1CD, 0x023AFBBF, 0x265138F6, 0x1BC37284,
+	0x09609A88, 0x34F2D0FA, 0x109913B3, 0x2D0B59C1, 0x3A9388FE, 0x0701C28C, 0x236A01C5, 0x1EF84BB7,
+	0x062DD1DD, 0x3BBF9BAF, 0x1FD458E6, 0x22461294, 0x35DEC3AB, 0x084C89D9, 0x2C274A90, 0x11B500E2,
+	0x0316E8EE, 0x3E84A29C, 0x1AEF61D5, 0x277D2BA7, 0x30E5FA98, 0x0D77B0EA, 0x291C73A3, 0x148E39D1,
+	// Seed 0xAF
+	0x00000000, 0x629D27F4, 0x49E8531B, 0x2B7574EF, 0x1F02BAC5, 0x7D9F9D31, 0x56EAE9DE, 0x3477CE2A,
+	0x3E05758A, 0x5C98527E, 0x77ED2691, 0x15700165, 0x2107CF4F, 0x439AE8BB, 0x68EF9C54, 0x0A72BBA0,
+	0x7C0AEB14, 0x1E97CCE0, 0x35E2B80F, 0x577F9FFB, 0x630851D1, 0x01957625, 0x2AE002CA, 0x487D253E,
+	0x420F9E9E, 0x2092B96A, 0x0BE7CD85, 0x697AEA71, 0x5D0D245B, 0x3F9003AF, 0x14E57740, 0x767850B4,
+	0x74C7CADB, 0x165AED2F, 0x3D2F99C0, 0x5FB2BE34, 0x6BC5701E, 0x095857EA, 0x222D2305, 0x40B004F1,
+	0x4AC2BF51, 0x285F98A5, 0x032AEC4A, 0x61B7CBBE, 0x55C00594, 0x375D2260, 0x1C28568F, 0x7EB5717B,
+	0x08CD21CF, 0x6A50063B, 0x412572D4, 0x23B85520, 0x17CF9B0A, 0x7552BCFE, 0x5E27C811, 0x3CBAEFE5,
+	0x36C85445, 0x545573B1, 0x7F20075E, 0x1DBD20AA, 0x29CAEE80, 0x4B57C974, 0x6022BD9B, 0x02BF9A6F,
+	0x655D8945, 0x07C0AEB1, 0x2CB5DA5E, 0x4E28FDAA, 0x7A5F3380, 0x18C21474, 0x33B7609B, 0x512A476F,
+	0x5B58FCCF, 0x39C5DB3B, 0x12B0AFD4, 0x702D8820, 0x445A460A, 0x26C761FE, 0x0DB21511, 0x6F2F32E5,
+	0x19576251, 0x7BCA45A5, 0x50BF314A, 0x322216BE, 0x0655D894, 0x64C8FF60, 0x4FBD8B8F, 0x2D20AC7B,
+	0x275217DB, 0x45CF302F, 0x6EBA44C0, 0x0C276334, 0x3850AD1E, 0x5ACD8AEA, 0x71B8FE05, 0x1325D9F1,
+	0x119A439E, 0x7307646A, 0x58721085, 0x3AEF3771, 0x0E98F95B, 0x6C05DEAF, 0x4770AA40, 0x25ED8DB4,
+	0x2F9F3614, 0x4D0211E0, 0x6677650F, 0x04EA42FB, 0x309D8CD1, 0x5200AB25, 0x7975DFCA, 0x1BE8F83E,
+	0x6D90A88A, 0x0F0D8F7E, 0x2478FB91, 0x46E5DC65, 0x7292124F, 0x100F35BB, 0x3B7A4154, 0x59E766A0,
+	0x5395DD00, 0x3108FAF4, 0x1A7D8E1B, 0x78E0A9EF, 0x4C9767C5, 0x2E0A4031, 0x057F34DE, 0x67E2132A,
+	0x46690E79, 0x24F4298D, 0x0F815D62, 0x6D1C7A96, 0x596BB4BC, 0x3BF69348, 0x1083E7A7, 0x721EC053,
+	0x786C7BF3, 0x1AF15C07, 0x318428E8, 0x53190F1C, 0x676EC136, 0x05F3E6C2, 0x2E86922D, 0x4C1BB5D9,
+	0x3A63E56D, 0x58FEC299, 0x738BB676, 0x11169182, 0x25615FA8, 0x47FC785C, 0x6C890CB3, 0x0E142B47,
+	0x046690E7, 0x66FBB713, 0x4D8EC3FC, 0x2F13E408, 0x1B642A22, 0x79F90DD6, 0x528C7939, 0x30115ECD,
+	0x32AEC4A2, 0x5033E356, 0x7B4697B9, 0x19DBB04D, 0x2DAC7E67, 0x4F315993, 0x64442D7C, 0x06D90A88,
+	0x0CABB128, 0x6E3696DC, 0x4543E233, 0x27DEC5C7, 0x13A90BED, 0x71342C19, 0x5A4158F6, 0x38DC7F02,
+	0x4EA42FB6, 0x2C390842, 0x074C7CAD, 0x65D15B59, 0x51A69573, 0x333BB287, 0x184EC668, 0x7AD3E19C,
+	0x70A15A3C, 0x123C7DC8, 0x39490927, 0x5BD42ED3, 0x6FA3E0F9, 0x0D3EC70D, 0x264BB3E2, 0x44D69416,
+	0x2334873C, 0x41A9A0C8, 0x6ADCD427, 0x0841F3D3, 0x3C363DF9, 0x5EAB1A0D, 0x75DE6EE2, 0x17434916,
+	0x1D31F2B6, 0x7FACD542, 0x54D9A1AD, 0x36448659, 0x02334873, 0x60AE6F87, 0x4BDB1B68, 0x29463C9C,
+	0x5F3E6C28, 0x3DA34BDC, 0x16D63F33, 0x744B18C7, 0x403CD6ED, 0x22A1F119, 0x09D485F6, 0x6B49A202,
+	0x613B19A2, 0x03A63E56, 0x28D34AB9, 0x4A4E6D4D, 0x7E39A367, 0x1CA48493, 0x37D1F07C, 0x554CD788,
+	0x57F34DE7, 0x356E6A13, 0x1E1B1EFC, 0x7C863908, 0x48F1F722, 0x2A6CD0D6, 0x0119A439, 0x638483CD,
+	0x69F6386D, 0x0B6B1F99, 0x201E6B76, 0x42834C82, 0x76F482A8, 0x1469A55C, 0x3F1CD1B3, 0x5D81F647,
+	0x2BF9A6F3, 0x49648107, 0x6211F5E8, 0x008CD21C, 0x34FB1C36, 0x56663BC2, 0x7D134F2D, 0x1F8E68D9,
+	0x15FCD379, 0x7761F48D, 0x5C148062, 0x3E89A796, 0x0AFE69BC, 0x68634E48, 0x43163AA7, 0x218B1D53,
+	// Seed 0xB0
+	0x00000000, 0x71E157E8, 0xE3C2AFD0, 0x9223F838, 0x512638B9, 0x20C76F51, 0xB2E49769, 0xC305C081,
+	0xA24C7172, 0xD3AD269A, 0x418EDEA2, 0x306F894A, 0xF36A49CB, 0x828B1E23, 0x10A8E61B, 0x6149B1F3,
+	0xD23B85FD, 0xA3DAD215, 0x31F92A2D, 0x40187DC5, 0x831DBD44, 0xF2FCEAAC, 0x60DF1294, 0x113E457C,
+	0x7077F48F, 0x0196A367, 0x93B55B5F, 0xE2540CB7, 0x2151CC36, 0x50B09BDE, 0xC29363E6, 0xB372340E,
+	0x32D46CE3, 0x43353B0B, 0xD116C333, 0xA0F794DB, 0x63F2545A, 0x121303B2, 0x8030FB8A, 0xF1D1AC62,
+	0x90981D91, 0xE1794A79, 0x735AB241, 0x02BBE5A9, 0xC1BE2528, 0xB05F72C0, 0x227C8AF8, 0x539DDD10,
+	0xE0EFE91E, 0x910EBEF6, 0x032D46CE, 0x72CC1126, 0xB1C9D1A7, 0xC028864F, 0x520B7E77, 0x23EA299F,
+	0x42A3986C, 0x3342CF84, 0xA16137BC, 0xD0806054, 0x1385A0D5, 0x6264F73D, 0xF0470F05, 0x81A658ED,
+	0x65A8D9C6, 0x14498E2E, 0x866A7616, 0xF78B21FE, 0x348EE17F, 0x456FB697, 0xD74C4EAF, 0xA6AD1947,
+	0xC7E4A8B4, 0xB605FF5C, 0x24260764, 0x55C7508C, 0x96C2900D, 0xE723C7E5, 0x75003FDD, 0x04E16835,
+	0xB7935C3B, 0xC6720BD3, 0x5451F3EB, 0x25B0A403, 0xE6B56482, 0x9754336A, 0x0577CB52, 0x74969CBA,
+	0x15DF2D49, 0x643E7AA1, 0xF61D8299, 0x87FCD571, 0x44F915F0, 0x35184218, 0xA73BBA20, 0xD6DAEDC8,
+	0x577CB525, 0x269DE2CD, 0xB4BE1AF5, 0xC55F4D1D, 0x065A8D9C, 0x77BBDA74, 0xE598224C, 0x947975A4,
+	0xF530C457, 0x84D193BF, 0x16F26B87, 0x67133C6F, 0xA416FCEE, 0xD5F7AB06, 0x47D4533E, 0x363504D6,
+	0x854730D8, 0xF4A66730, 0x66859F08, 0x1764C8E0, 0xD4610861, 0xA5805F89, 0x37A3A7B1, 0x4642F059,
+	0x270B41AA, 0x56EA1642, 0xC4C9EE7A, 0xB528B992, 0x762D7913, 0x07CC2EFB, 0x95EFD6C3, 0xE40E812B,
+	0xCB51B38C, 0xBAB0E464, 0x28931C5C, 0x59724BB4, 0x9A778B35, 0xEB96DCDD, 0x79B524E5, 0x0854730D,
+	0x691DC2FE, 0x18FC9516, 0x8ADF6D2E, 0xFB3E3AC6, 0x383BFA47, 0x49DAADAF, 0xDBF95597, 0xAA18027F,
+	0x196A3671, 0x688B6199, 0xFAA899A1, 0x8B49CE49, 0x484C0EC8, 0x39AD5920, 0xAB8EA118, 0xDA6FF6F0,
+	0xBB264703, 0xCAC710EB, 0x58E4E8D3, 0x2905BF3B, 0xEA007FBA, 0x9BE12852, 0x09C2D06A, 0x78238782,
+	0xF985DF6F, 0x88648887, 0x1A4770BF, 0x6BA62757, 0xA8A3E7D6, 0xD942B03E, 0x4B614806, 0x3A801FEE,
+	0x5BC9AE1D, 0x2A28F9F5, 0xB80B01CD, 0xC9EA5625, 0x0AEF96A4, 0x7B0EC14C, 0xE92D3974, 0x98CC6E9C,
+	0x2BBE5A92, 0x5A5F0D7A, 0xC87CF542, 0xB99DA2AA, 0x7A98622B, 0x0B7935C3, 0x995ACDFB, 0xE8BB9A13,
+	0x89F22BE0, 0xF8137C08, 0x6A308430, 0x1BD1D3D8, 0xD8D41359, 0xA93544B1, 0x3B16BC89, 0x4AF7EB61,
+	0xAEF96A4A, 0xDF183DA2, 0x4D3BC59A, 0x3CDA9272, 0xFFDF52F3, 0x8E3E051B, 0x1C1DFD23, 0x6DFCAACB,
+	0x0CB51B38, 0x7D544CD0, 0xEF77B4E8, 0x9E96E300, 0x5D932381, 0x2C727469, 0xBE518C51, 0xCFB0DBB9,
+	0x7CC2EFB7, 0x0D23B85F, 0x9F004067, 0xEEE1178F, 0x2DE4D70E, 0x5C0580E6, 0xCE2678DE, 0xBFC72F36,
+	0xDE8E9EC5, 0xAF6FC92D, 0x3D4C3115, 0x4CAD66FD, 0x8FA8A67C, 0xFE49F194, 0x6C6A09AC, 0x1D8B5E44,
+	0x9C2D06A9, 0xEDCC5141, 0x7FEFA979, 0x0E0EFE91, 0xCD0B3E10, 0xBCEA69F8, 0x2EC991C0, 0x5F28C628,
+	0x3E6177DB, 0x4F802033, 0xDDA3D80B, 0xAC428FE3, 0x6F474F62, 0x1EA6188A, 0x8C85E0B2, 0xFD64B75A,
+	0x4E168354, 0x3FF7D4BC, 0xADD42C84, 0xDC357B6C, 0x1F30BBED, 0x6ED1EC05, 0xFCF2143D, 0x8D1343D5,
+	0xEC5AF226, 0x9DBBA5CE, 0x0F985DF6, 0x7E790A1E, 0xBD7CCA9F, 0xCC9D9D77, 0x5EBE654F, 0x2F5F32A7,
+	// Seed 0xB1
+	0x00000000, 0x75B2FA55, 0xEB65F4AA, 0x9ED70EFF, 0xAE0CEF61, 0xDBBE1534, 0x45691BCB, 0x30DBE19E,
+	0x24DED8F7, 0x516C22A2, 0xCFBB2C5D, 0xBA09D608, 0x8AD23796, 0xFF60CDC3, 0x61B7C33C, 0x14053969,
+	0x49BDB1EE, 0x3C0F4BBB, 0xA2D84544, 0xD76ABF11, 0xE7B15E8F, 0x9203A4DA, 0x0CD4AA25, 0x79665070,
+	0x6D636919, 0x18D1934C, 0x86069DB3, 0xF3B467E6, 0xC36F8678, 0xB6DD7C2D, 0x280A72D2, 0x5DB88887,
+	0x937B63DC, 0xE6C99989, 0x781E9776, 0x0DAC6D23, 0x3D778CBD, 0x48C576E8, 0xD6127817, 0xA3A08242,
+	0xB7A5BB2B, 0xC217417E, 0x5CC04F81, 0x2972B5D4, 0x19A9544A, 0x6C1BAE1F, 0xF2CCA0E0, 0x877E5AB5,
+	0xDAC6D232, 0xAF742867, 0x31A32698, 0x4411DCCD, 0x74CA3D53, 0x0178C706, 0x9FAFC9F9, 0xEA1D33AC,
+	0xFE180AC5, 0x8BAAF090, 0x157DFE6F, 0x60CF043A, 0x5014E5A4, 0x25A61FF1, 0xBB71110E, 0xCEC3EB5B,
+	0x5E31C18D, 0x2B833BD8, 0xB5543527, 0xC0E6CF72, 0xF03D2EEC, 0x858FD4B9, 0x1B58DA46, 0x6EEA2013,
+	0x7AEF197A, 0x0F5DE32F, 0x918AEDD0, 0xE4381785, 0xD4E3F61B, 0xA1510C4E, 0x3F8602B1, 0x4A34F8E4,
+	0x178C7063, 0x623E8A36, 0xFCE984C9, 0x895B7E9C, 0xB9809F02, 0xCC326557, 0x52E56BA8, 0x275791FD,
+	0x3352A894, 0x46E052C1, 0xD8375C3E, 0xAD85A66B, 0x9D5E47F5, 0xE8ECBDA0, 0x763BB35F, 0x0389490A,
+	0xCD4AA251, 0xB8F85804, 0x262F56FB, 0x539DACAE, 0x63464D30, 0x16F4B765, 0x8823B99A, 0xFD9143CF,
+	0xE9947AA6, 0x9C2680F3, 0x02F18E0C, 0x77437459, 0x479895C7, 0x322A6F92, 0xACFD616D, 0xD94F9B38,
+	0x84F713BF, 0xF145E9EA, 0x6F92E715, 0x1A201D40, 0x2AFBFCDE, 0x5F49068B, 0xC19E0874, 0xB42CF221,
+	0xA029CB48, 0xD59B311D, 0x4B4C3FE2, 0x3EFEC5B7, 0x0E252429, 0x7B97DE7C, 0xE540D083, 0x90F22AD6,
+	0xBC63831A, 0xC9D1794F, 0x570677B0, 0x22B48DE5, 0x126F6C7B, 0x67DD962E, 0xF90A98D1, 0x8CB86284,
+	0x98BD5BED, 0xED0FA1B8, 0x73D8AF47, 0x066A5512, 0x36B1B48C, 0x43034ED9, 0xDDD44026, 0xA866BA73,
+	0xF5DE32F4, 0x806CC8A1, 0x1EBBC65E, 0x6B093C0B, 0x5BD2DD95, 0x2E6027C0, 0xB0B7293F, 0xC505D36A,
+	0xD100EA03, 0xA4B21056, 0x3A651EA9, 0x4FD7E4FC, 0x7F0C0562, 0x0ABEFF37, 0x9469F1C8, 0xE1DB0B9D,
+	0x2F18E0C6, 0x5AAA1A93, 0xC47D146C, 0xB1CFEE39, 0x81140FA7, 0xF4A6F5F2, 0x6A71FB0D, 0x1FC30158,
+	0x0BC63831, 0x7E74C264, 0xE0A3CC9B, 0x951136CE, 0xA5CAD750, 0xD0782D05, 0x4EAF23FA, 0x3B1DD9AF,
+	0x66A55128, 0x1317AB7D, 0x8DC0A582, 0xF8725FD7, 0xC8A9BE49, 0xBD1B441C, 0x23CC4AE3, 0x567EB0B6,
+	0x427B89DF, 0x37C9738A, 0xA91E7D75, 0xDCAC8720, 0xEC7766BE, 0x99C59CEB, 0x07129214, 0x72A06841,
+	0xE2524297, 0x97E0B8C2, 0x0937B63D, 0x7C854C68, 0x4C5EADF6, 0x39EC57A3, 0xA73B595C, 0xD289A309,
+	0xC68C9A60, 0xB33E6035, 0x2DE96ECA, 0x585B949F, 0x68807501, 0x1D328F54, 0x83E581AB, 0xF6577BFE,
+	0xABEFF379, 0xDE5D092C, 0x408A07D3, 0x3538FD86, 0x05E31C18, 0x7051E64D, 0xEE86E8B2, 0x9B3412E7,
+	0x8F312B8E, 0xFA83D1DB, 0x6454DF24, 0x11E62571, 0x213DC4EF, 0x548F3EBA, 0xCA583045, 0xBFEACA10,
+	0x7129214B, 0x049BDB1E, 0x9A4CD5E1, 0xEFFE2FB4, 0xDF25CE2A, 0xAA97347F, 0x34403A80, 0x41F2C0D5,
+	0x55F7F9BC, 0x204503E9, 0xBE920D16, 0xCB20F743, 0xFBFB16DD, 0x8E49EC88, 0x109EE277, 0x652C1822,
+	0x389490A5, 0x4D266AF0, 0xD3F1640F, 0xA6439E5A, 0x96987FC4, 0xE32A8591, 0x7DFD8B6E, 0x084F713B,
+	0x1C4A4852, 0x69F8B207, 0xF72FBCF8, 0x829D46AD, 0xB246A733, 0xC7F45D66, 0x59235399, 0x2C91A9CC,
+	// Seed 0xB2
+	0x00000000, 0x12FD36F5, 0x25FA6DEA, 0x37075B1F, 0x012B7E95, 0x13D64860, 0x24D1137F, 0x362C258A,
+	0x0256FD2A, 0x10ABCBDF, 0x27AC90C0, 0x3551A635, 0x037D83BF, 0x1180B54A, 0x2687EE55, 0x347AD8A0,
+	0x04ADFA54, 0x1650CCA1, 0x215797BE, 0x33AAA14B, 0x058684C1, 0x177BB234, 0x207CE92B, 0x3281DFDE,
+	0x06FB077E, 0x1406318B, 0x23016A94, 0x31FC5C61, 0x07D079EB, 0x152D4F1E, 0x222A1401, 0x30D722F4,
+	0x095BF4A8, 0x1BA6C25D, 0x2CA19942, 0x3E5CAFB7, 0x08708A3D, 0x1A8DBCC8, 0x2D8AE7D7, 0x3F77D122,
+	0x0B0D0982, 0x19F03F77, 0x2EF76468, 0x3C0A529D, 0x0A267717, 0x18DB41E2, 0x2FDC1AFD, 0x3D212C08,
+	0x0DF60EFC, 0x1F0B3809, 0x280C6316, 0x3AF155E3, 0x0CDD7069, 0x1E20469C, 0x29271D83, 0x3BDA2B76,
+	0x0FA0F3D6, 0x1D5DC523, 0x2A5A9E3C, 0x38A7A8C9, 0x0E8B8D43, 0x1C76BBB6, 0x2B71E0A9, 0x398CD65C,
+	0x12B7E950, 0x004ADFA5, 0x374D84BA, 0x25B0B24F, 0x139C97C5, 0x0161A130, 0x3666FA2F, 0x249BCCDA,
+	0x10E1147A, 0x021C228F, 0x351B7990, 0x27E64F65, 0x11CA6AEF, 0x03375C1A, 0x34300705, 0x26CD31F0,
+	0x161A1304, 0x04E725F1, 0x33E07EEE, 0x211D481B, 0x17316D91, 0x05CC5B64, 0x32CB007B, 0x2036368E,
+	0x144CEE2E, 0x06B1D8DB, 0x31B683C4, 0x234BB531, 0x156790BB, 0x079AA64E, 0x309DFD51, 0x2260CBA4,
+	0x1BEC1DF8, 0x09112B0D, 0x3E167012, 0x2CEB46E7, 0x1AC7636D, 0x083A5598, 0x3F3D0E87, 0x2DC03872,
+	0x19BAE0D2, 0x0B47D627, 0x3C408D38, 0x2EBDBBCD, 0x18919E47, 0x0A6CA8B2, 0x3D6BF3AD, 0x2F96C558,
+	0x1F41E7AC, 0x0DBCD159, 0x3ABB8A46, 0x2846BCB3, 0x1E6A9939, 0x0C97AFCC, 0x3B90F4D3, 0x296DC226,
+	0x1D171A86, 0x0FEA2C73, 0x38ED776C, 0x2A104199, 0x1C3C6413, 0x0EC152E6, 0x39C609F9, 0x2B3B3F0C,
+	0x256FD2A0, 0x3792E455, 0x0095BF4A, 0x126889BF, 0x2444AC35, 0x36B99AC0, 0x01BEC1DF, 0x1343F72A,
+	0x27392F8A, 0x35C4197F, 0x02C34260, 0x103E7495, 0x2612511F, 0x34EF67EA, 0x03E83CF5, 0x11150A00,
+	0x21C228F4, 0x333F1E01, 0x0438451E, 0x16C573EB, 0x20E95661, 0x32146094, 0x05133B8B, 0x17EE0D7E,
+	0x2394D5DE, 0x3169E32B, 0x066EB834, 0x14938EC1, 0x22BFAB4B, 0x30429DBE, 0x0745C6A1, 0x15B8F054,
+	0x2C342608, 0x3EC910FD, 0x09CE4BE2, 0x1B337D17, 0x2D1F589D, 0x3FE26E68, 0x08E53577, 0x1A180382,
+	0x2E62DB22, 0x3C9FEDD7, 0x0B98B6C8, 0x1965803D, 0x2F49A5B7, 0x3DB49342, 0x0AB3C85D, 0x184EFEA8,
+	0x2899DC5C, 0x3A64EAA9, 0x0D63B1B6, 0x1F9E8743, 0x29B2A2C9, 0x3B4F943C, 0x0C48CF23, 0x1EB5F9D6,
+	0x2ACF2176, 0x38321783, 0x0F354C9C, 0x1DC87A69, 0x2BE45FE3, 0x39196916, 0x0E1E3209, 0x1CE304FC,
+	0x37D83BF0, 0x25250D05, 0x1222561A, 0x00DF60EF, 0x36F34565, 0x240E7390, 0x1309288F, 0x01F41E7A,
+	0x358EC6DA, 0x2773F02F, 0x1074AB30, 0x02899DC5, 0x34A5B84F, 0x26588EBA, 0x115FD5A5, 0x03A2E350,
+	0x3375C1A4, 0x2188F751, 0x168FAC4E, 0x04729ABB, 0x325EBF31, 0x20A389C4, 0x17A4D2DB, 0x0559E42E,
+	0x31233C8E, 0x23DE0A7B, 0x14D95164, 0x06246791, 0x3008421B, 0x22F574EE, 0x15F22FF1, 0x070F1904,
+	0x3E83CF58, 0x2C7EF9AD, 0x1B79A2B2, 0x09849447, 0x3FA8B1CD, 0x2D558738, 0x1A52DC27, 0x08AFEAD2,
+	0x3CD53272, 0x2E280487, 0x192F5F98, 0x0BD2696D, 0x3DFE4CE7, 0x2F037A12, 0x1804210D, 0x0AF917F8,
+	0x3A2E350C, 0x28D303F9, 0x1FD458E6, 0x0D296E13, 0x3B054B99, 0x29F87D6C, 0x1EFF2673, 0x0C021086,
+	0x3878C826, 0x2A85FED3, 0x1D82A5CC, 0x0F7F9339, 0x3953B6B3, 0x2BAE8046, 0x1CA9DB59, 0x0E54EDAC,
+	// Seed 0xB3
+	0x00000000, 0x629AAF10, 0x61E49A4D, 0x037E355D, 0x6718F0F7, 0x05825FE7, 0x06FC6ABA, 0x6466C5AA,
+	0x6AE02583, 0x087A8A93, 0x0B04BFCE, 0x699E10DE, 0x0DF8D574, 0x6F627A64, 0x6C1C4F39, 0x0E86E029,
+	0x71118F6B, 0x138B207B, 0x10F51526, 0x726FBA36, 0x16097F9C, 0x7493D08C, 0x77EDE5D1, 0x15774AC1,
+	0x1BF1AAE8, 0x796B05F8, 0x7A1530A5, 0x188F9FB5, 0x7CE95A1F, 0x1E73F50F, 0x1D0DC052, 0x7F976F42,
+	0x46F2DABB, 0x246875AB, 0x271640F6, 0x458CEFE6, 0x21EA2A4C, 0x4370855C, 0x400EB001, 0x22941F11,
+	0x2C12FF38, 0x4E885028, 0x4DF66575, 0x2F6CCA65, 0x4B0A0FCF, 0x2990A0DF, 0x2AEE9582, 0x48743A92,
+	0x37E355D0, 0x5579FAC0, 0x5607CF9D, 0x349D608D, 0x50FBA527, 0x32610A37, 0x311F3F6A, 0x5385907A,
+	0x5D037053, 0x3F99DF43, 0x3CE7EA1E, 0x5E7D450E, 0x3A1B80A4, 0x58812FB4, 0x5BFF1AE9, 0x3965B5F9,
+	0x2934711B, 0x4BAEDE0B, 0x48D0EB56, 0x2A4A4446, 0x4E2C81EC, 0x2CB62EFC, 0x2FC81BA1, 0x4D52B4B1,
+	0x43D45498, 0x214EFB88, 0x2230CED5, 0x40AA61C5, 0x24CCA46F, 0x46560B7F, 0x45283E22, 0x27B29132,
+	0x5825FE70, 0x3ABF5160, 0x39C1643D, 0x5B5BCB2D, 0x3F3D0E87, 0x5DA7A197, 0x5ED994CA, 0x3C433BDA,
+	0x32C5DBF3, 0x505F74E3, 0x532141BE, 0x31BBEEAE, 0x55DD2B04, 0x37478414, 0x3439B149, 0x56A31E59,
+	0x6FC6ABA0, 0x0D5C04B0, 0x0E2231ED, 0x6CB89EFD, 0x08DE5B57, 0x6A44F447, 0x693AC11A, 0x0BA06E0A,
+	0x05268E23, 0x67BC2133, 0x64C2146E, 0x0658BB7E, 0x623E7ED4, 0x00A4D1C4, 0x03DAE499, 0x61404B89,
+	0x1ED724CB, 0x7C4D8BDB, 0x7F33BE86, 0x1DA91196, 0x79CFD43C, 0x1B557B2C, 0x182B4E71, 0x7AB1E161,
+	0x74370148, 0x16ADAE58, 0x15D39B05, 0x77493415, 0x132FF1BF, 0x71B55EAF, 0x72CB6BF2, 0x1051C4E2,
+	0x5268E236, 0x30F24D26, 0x338C787B, 0x5116D76B, 0x357012C1, 0x57EABDD1, 0x5494888C, 0x360E279C,
+	0x3888C7B5, 0x5A1268A5, 0x596C5DF8, 0x3BF6F2E8, 0x5F903742, 0x3D0A9852, 0x3E74AD0F, 0x5CEE021F,
+	0x23796D5D, 0x41E3C24D, 0x429DF710, 0x20075800, 0x44619DAA, 0x26FB32BA, 0x258507E7, 0x471FA8F7,
+	0x499948DE, 0x2B03E7CE, 0x287DD293, 0x4AE77D83, 0x2E81B829, 0x4C1B1739, 0x4F652264, 0x2DFF8D74,
+	0x149A388D, 0x7600979D, 0x757EA2C0, 0x17E40DD0, 0x7382C87A, 0x1118676A, 0x12665237, 0x70FCFD27,
+	0x7E7A1D0E, 0x1CE0B21E, 0x1F9E8743, 0x7D042853, 0x1962EDF9, 0x7BF842E9, 0x788677B4, 0x1A1CD8A4,
+	0x658BB7E6, 0x071118F6, 0x046F2DAB, 0x66F582BB, 0x02934711, 0x6009E801, 0x6377DD5C, 0x01ED724C,
+	0x0F6B9265, 0x6DF13D75, 0x6E8F0828, 0x0C15A738, 0x68736292, 0x0AE9CD82, 0x0997F8DF, 0x6B0D57CF,
+	0x7B5C932D, 0x19C63C3D, 0x1AB80960, 0x7822A670, 0x1C4463DA, 0x7EDECCCA, 0x7DA0F997, 0x1F3A5687,
+	0x11BCB6AE, 0x732619BE, 0x70582CE3, 0x12C283F3, 0x76A44659, 0x143EE949, 0x1740DC14, 0x75DA7304,
+	0x0A4D1C46, 0x68D7B356, 0x6BA9860B, 0x0933291B, 0x6D55ECB1, 0x0FCF43A1, 0x0CB176FC, 0x6E2BD9EC,
+	0x60AD39C5, 0x023796D5, 0x0149A388, 0x63D30C98, 0x07B5C932, 0x652F6622, 0x6651537F, 0x04CBFC6F,
+	0x3DAE4996, 0x5F34E686, 0x5C4AD3DB, 0x3ED07CCB, 0x5AB6B961, 0x382C1671, 0x3B52232C, 0x59C88C3C,
+	0x574E6C15, 0x35D4C305, 0x36AAF658, 0x54305948, 0x30569CE2, 0x52CC33F2, 0x51B206AF, 0x3328A9BF,
+	0x4CBFC6FD, 0x2E2569ED, 0x2D5B5CB0, 0x4FC1F3A0, 0x2BA7360A, 0x493D991A, 0x4A43AC47, 0x28D90357,
+	0x265FE37E, 0x44C54C6E, 0x47BB7933, 0x2521D623, 0x41471389, 0x23DDBC99, 0x20A389C4, 0x423926D4,
+	// Seed 0xB4
+	0x00000000, 0x2E4AD99A, 0x5C95B334, 0x72DF6AAE, 0xB92B6668, 0x9761BFF2, 0xE5BED55C, 0xCBF40CC6,
+	0xEA4E23FB, 0xC404FA61, 0xB6DB90CF, 0x98914955, 0x53654593, 0x7D2F9C09, 0x0FF0F6A7, 0x21BA2F3D,
+	0x4C84A8DD, 0x62CE7147, 0x10111BE9, 0x3E5BC273, 0xF5AFCEB5, 0xDBE5172F, 0xA93A7D81, 0x8770A41B,
+	0xA6CA8B26, 0x888052BC, 0xFA5F3812, 0xD415E188, 0x1FE1ED4E, 0x31AB34D4, 0x43745E7A, 0x6D3E87E0,
+	0x990951BA, 0xB7438820, 0xC59CE28E, 0xEBD63B14, 0x202237D2, 0x0E68EE48, 0x7CB784E6, 0x52FD5D7C,
+	0x73477241, 0x5D0DABDB, 0x2FD2C175, 0x019818EF, 0xCA6C1429, 0xE426CDB3, 0x96F9A71D, 0xB8B37E87,
+	0xD58DF967, 0xFBC720FD, 0x89184A53, 0xA75293C9, 0x6CA69F0F, 0x42EC4695, 0x30332C3B, 0x1E79F5A1,
+	0x3FC3DA9C, 0x11890306, 0x635669A8, 0x4D1CB032, 0x86E8BCF4, 0xA8A2656E, 0xDA7D0FC0, 0xF437D65A,
+	0xAA0A4C5F, 0x844095C5, 0xF69FFF6B, 0xD8D526F1, 0x13212A37, 0x3D6BF3AD, 0x4FB49903, 0x61FE4099,
+	0x40446FA4, 0x6E0EB63E, 0x1CD1DC90, 0x329B050A, 0xF96F09CC, 0xD725D056, 0xA5FABAF8, 0x8BB06362,
+	0xE68EE482, 0xC8C43D18, 0xBA1B57B6, 0x94518E2C, 0x5FA582EA, 0x71EF5B70, 0x033031DE, 0x2D7AE844,
+	0x0CC0C779, 0x228A1EE3, 0x5055744D, 0x7E1FADD7, 0xB5EBA111, 0x9BA1788B, 0xE97E1225, 0xC734CBBF,
+	0x33031DE5, 0x1D49C47F, 0x6F96AED1, 0x41DC774B, 0x8A287B8D, 0xA462A217, 0xD6BDC8B9, 0xF8F71123,
+	0xD94D3E1E, 0xF707E784, 0x85D88D2A, 0xAB9254B0, 0x60665876, 0x4E2C81EC, 0x3CF3EB42, 0x12B932D8,
+	0x7F87B538, 0x51CD6CA2, 0x2312060C, 0x0D58DF96, 0xC6ACD350, 0xE8E60ACA, 0x9A396064, 0xB473B9FE,
+	0x95C996C3, 0xBB834F59, 0xC95C25F7, 0xE716FC6D, 0x2CE2F0AB, 0x02A82931, 0x7077439F, 0x5E3D9A05,
+	0xCC0C7795, 0xE246AE0F, 0x9099C4A1, 0xBED31D3B, 0x752711FD, 0x5B6DC867, 0x29B2A2C9, 0x07F87B53,
+	0x2642546E, 0x08088DF4, 0x7AD7E75A, 0x549D3EC0, 0x9F693206, 0xB123EB9C, 0xC3FC8132, 0xEDB658A8,
+	0x8088DF48, 0xAEC206D2, 0xDC1D6C7C, 0xF257B5E6, 0x39A3B920, 0x17E960BA, 0x65360A14, 0x4B7CD38E,
+	0x6AC6FCB3, 0x448C2529, 0x36534F87, 0x1819961D, 0xD3ED9ADB, 0xFDA74341, 0x8F7829EF, 0xA132F075,
+	0x5505262F, 0x7B4FFFB5, 0x0990951B, 0x27DA4C81, 0xEC2E4047, 0xC26499DD, 0xB0BBF373, 0x9EF12AE9,
+	0xBF4B05D4, 0x9101DC4E, 0xE3DEB6E0, 0xCD946F7A, 0x066063BC, 0x282ABA26, 0x5AF5D088, 0x74BF0912,
+	0x19818EF2, 0x37CB5768, 0x45143DC6, 0x6B5EE45C, 0xA0AAE89A, 0x8EE03100, 0xFC3F5BAE, 0xD2758234,
+	0xF3CFAD09, 0xDD857493, 0xAF5A1E3D, 0x8110C7A7, 0x4AE4CB61, 0x64AE12FB, 0x16717855, 0x383BA1CF,
+	0x66063BCA, 0x484CE250, 0x3A9388FE, 0x14D95164, 0xDF2D5DA2, 0xF1678438, 0x83B8EE96, 0xADF2370C,
+	0x8C481831, 0xA202C1AB, 0xD0DDAB05, 0xFE97729F, 0x35637E59, 0x1B29A7C3, 0x69F6CD6D, 0x47BC14F7,
+	0x2A829317, 0x04C84A8D, 0x76172023, 0x585DF9B9, 0x93A9F57F, 0xBDE32CE5, 0xCF3C464B, 0xE1769FD1,
+	0xC0CCB0EC, 0xEE866976, 0x9C5903D8, 0xB213DA42, 0x79E7D684, 0x57AD0F1E, 0x257265B0, 0x0B38BC2A,
+	0xFF0F6A70, 0xD145B3EA, 0xA39AD944, 0x8DD000DE, 0x46240C18, 0x686ED582, 0x1AB1BF2C, 0x34FB66B6,
+	0x1541498B, 0x3B0B9011, 0x49D4FABF, 0x679E2325, 0xAC6A2FE3, 0x8220F679, 0xF0FF9CD7, 0xDEB5454D,
+	0xB38BC2AD, 0x9DC11B37, 0xEF1E7199, 0xC154A803, 0x0AA0A4C5, 0x24EA7D5F, 0x563517F1, 0x787FCE6B,
+	0x59C5E156, 0x778F38CC, 0x05505262, 0x2B1A8BF8, 0xE0EE873E, 0xCEA45EA4, 0xBC7B340A, 0x9231ED90,
+	// Seed 0xB5
+	0x00000000, 0xF9C50380, 0x859C8907, 0x7C598A87, 0x7D2F9C09, 0x84EA9F89, 0xF8B3150E, 0x0176168E,
+	0xFA5F3812, 0x039A3B92, 0x7FC3B115, 0x8606B295, 0x8770A41B, 0x7EB5A79B, 0x02EC2D1C, 0xFB292E9C,
+	0x82A8FE23, 0x7B6DFDA3, 0x07347724, 0xFEF174A4, 0xFF87622A, 0x064261AA, 0x7A1BEB2D, 0x83DEE8AD,
+	0x78F7C631, 0x8132C5B1, 0xFD6B4F36, 0x04AE4CB6, 0x05D85A38, 0xFC1D59B8, 0x8044D33F, 0x7981D0BF,
+	0x73477241, 0x8A8271C1, 0xF6DBFB46, 0x0F1EF8C6, 0x0E68EE48, 0xF7ADEDC8, 0x8BF4674F, 0x723164CF,
+	0x89184A53, 0x70DD49D3, 0x0C84C354, 0xF541C0D4, 0xF437D65A, 0x0DF2D5DA, 0x71AB5F5D, 0x886E5CDD,
+	0xF1EF8C62, 0x082A8FE2, 0x74730565, 0x8DB606E5, 0x8CC0106B, 0x750513EB, 0x095C996C, 0xF0999AEC,
+	0x0BB0B470, 0xF275B7F0, 0x8E2C3D77, 0x77E93EF7, 0x769F2879, 0x8F5A2BF9, 0xF303A17E, 0x0AC6A2FE,
+	0xE68EE482, 0x1F4BE702, 0x63126D85, 0x9AD76E05, 0x9BA1788B, 0x62647B0B, 0x1E3DF18C, 0xE7F8F20C,
+	0x1CD1DC90, 0xE514DF10, 0x994D5597, 0x60885617, 0x61FE4099, 0x983B4319, 0xE462C99E, 0x1DA7CA1E,
+	0x64261AA1, 0x9DE31921, 0xE1BA93A6, 0x187F9026, 0x190986A8, 0xE0CC8528, 0x9C950FAF, 0x65500C2F,
+	0x9E7922B3, 0x67BC2133, 0x1BE5ABB4, 0xE220A834, 0xE356BEBA, 0x1A93BD3A, 0x66CA37BD, 0x9F0F343D,
+	0x95C996C3, 0x6C0C9543, 0x10551FC4, 0xE9901C44, 0xE8E60ACA, 0x1123094A, 0x6D7A83CD, 0x94BF804D,
+	0x6F96AED1, 0x9653AD51, 0xEA0A27D6, 0x13CF2456, 0x12B932D8, 0xEB7C3158, 0x9725BBDF, 0x6EE0B85F,
+	0x176168E0, 0xEEA46B60, 0x92FDE1E7, 0x6B38E267, 0x6A4EF4E9, 0x938BF769, 0xEFD27DEE, 0x16177E6E,
+	0xED3E50F2, 0x14FB5372, 0x68A2D9F5, 0x9167DA75, 0x9011CCFB, 0x69D4CF7B, 0x158D45FC, 0xEC48467C,
+	0xBB0B4703, 0x42CE4483, 0x3E97CE04, 0xC752CD84, 0xC624DB0A, 0x3FE1D88A, 0x43B8520D, 0xBA7D518D,
+	0x41547F11, 0xB8917C91, 0xC4C8F616, 0x3D0DF596, 0x3C7BE318, 0xC5BEE098, 0xB9E76A1F, 0x4022699F,
+	0x39A3B920, 0xC066BAA0, 0xBC3F3027, 0x45FA33A7, 0x448C2529, 0xBD4926A9, 0xC110AC2E, 0x38D5AFAE,
+	0xC3FC8132, 0x3A3982B2, 0x46600835, 0xBFA50BB5, 0xBED31D3B, 0x47161EBB, 0x3B4F943C, 0xC28A97BC,
+	0xC84C3542, 0x318936C2, 0x4DD0BC45, 0xB415BFC5, 0xB563A94B, 0x4CA6AACB, 0x30FF204C, 0xC93A23CC,
+	0x32130D50, 0xCBD60ED0, 0xB78F8457, 0x4E4A87D7, 0x4F3C9159, 0xB6F992D9, 0xCAA0185E, 0x33651BDE,
+	0x4AE4CB61, 0xB321C8E1, 0xCF784266, 0x36BD41E6, 0x37CB5768, 0xCE0E54E8, 0xB257DE6F, 0x4B92DDEF,
+	0xB0BBF373, 0x497EF0F3, 0x35277A74, 0xCCE279F4, 0xCD946F7A, 0x34516CFA, 0x4808E67D, 0xB1CDE5FD,
+	0x5D85A381, 0xA440A001, 0xD8192A86, 0x21DC2906, 0x20AA3F88, 0xD96F3C08, 0xA536B68F, 0x5CF3B50F,
+	0xA7DA9B93, 0x5E1F9813, 0x22461294, 0xDB831114, 0xDAF5079A, 0x2330041A, 0x5F698E9D, 0xA6AC8D1D,
+	0xDF2D5DA2, 0x26E85E22, 0x5AB1D4A5, 0xA374D725, 0xA202C1AB, 0x5BC7C22B, 0x279E48AC, 0xDE5B4B2C,
+	0x257265B0, 0xDCB76630, 0xA0EEECB7, 0x592BEF37, 0x585DF9B9, 0xA198FA39, 0xDDC170BE, 0x2404733E,
+	0x2EC2D1C0, 0xD707D240, 0xAB5E58C7, 0x529B5B47, 0x53ED4DC9, 0xAA284E49, 0xD671C4CE, 0x2FB4C74E,
+	0xD49DE9D2, 0x2D58EA52, 0x510160D5, 0xA8C46355, 0xA9B275DB, 0x5077765B, 0x2C2EFCDC, 0xD5EBFF5C,
+	0xAC6A2FE3, 0x55AF2C63, 0x29F6A6E4, 0xD033A564, 0xD145B3EA, 0x2880B06A, 0x54D93AED, 0xAD1C396D,
+	0x563517F1, 0xAFF01471, 0xD3A99EF6, 0x2A6C9D76, 0x2B1A8BF8, 0xD2DF8878, 0xAE8602FF, 0x5743017F,
+	// Seed 0xB6
+	0x00000000, 0x12FD37C9, 0x25FA6F92, 0x3707585B, 0x0FF0F657, 0x1D0DC19E, 0x2A0A99C5, 0x38F7AE0C,
+	0x1FE1ECAE, 0x0D1CDB67, 0x3A1B833C, 0x28E6B4F5, 0x10111AF9, 0x02EC2D30, 0x35EB756B, 0x271642A2,
+	0x3FC3D95C, 0x2D3EEE95, 0x1A39B6CE, 0x08C48107, 0x30332F0B, 0x22CE18C2, 0x15C94099, 0x07347750,
+	0x202235F2, 0x32DF023B, 0x05D85A60, 0x17256DA9, 0x2FD2C3A5, 0x3D2FF46C, 0x0A28AC37, 0x18D59BFE,
+	0x3B839BCB, 0x297EAC02, 0x1E79F459, 0x0C84C390, 0x34736D9C, 0x268E5A55, 0x1189020E, 0x037435C7,
+	0x24627765, 0x369F40AC, 0x019818F7, 0x13652F3E, 0x2B928132, 0x396FB6FB, 0x0E68EEA0, 0x1C95D969,
+	0x04404297, 0x16BD755E, 0x21BA2D05, 0x33471ACC, 0x0BB0B4C0, 0x194D8309, 0x2E4ADB52, 0x3CB7EC9B,
+	0x1BA1AE39, 0x095C99F0, 0x3E5BC1AB, 0x2CA6F662, 0x1451586E, 0x06AC6FA7, 0x31AB37FC, 0x23560035,
+	0x33031EE5, 0x21FE292C, 0x16F97177, 0x040446BE, 0x3CF3E8B2, 0x2E0EDF7B, 0x19098720, 0x0BF4B0E9,
+	0x2CE2F24B, 0x3E1FC582, 0x09189DD9, 0x1BE5AA10, 0x2312041C, 0x31EF33D5, 0x06E86B8E, 0x14155C47,
+	0x0CC0C7B9, 0x1E3DF070, 0x293AA82B, 0x3BC79FE2, 0x033031EE, 0x11CD0627, 0x26CA5E7C, 0x343769B5,
+	0x13212B17, 0x01DC1CDE, 0x36DB4485, 0x2426734C, 0x1CD1DD40, 0x0E2CEA89, 0x392BB2D2, 0x2BD6851B,
+	0x0880852E, 0x1A7DB2E7, 0x2D7AEABC, 0x3F87DD75, 0x07707379, 0x158D44B0, 0x228A1CEB, 0x30772B22,
+	0x17616980, 0x059C5E49, 0x329B0612, 0x206631DB, 0x18919FD7, 0x0A6CA81E, 0x3D6BF045, 0x2F96C78C,
+	0x37435C72, 0x25BE6BBB, 0x12B933E0, 0x00440429, 0x38B3AA25, 0x2A4E9DEC, 0x1D49C5B7, 0x0FB4F27E,
+	0x28A2B0DC, 0x3A5F8715, 0x0D58DF4E, 0x1FA5E887, 0x2752468B, 0x35AF7142, 0x02A82919, 0x10551ED0,
+	0x220214B9, 0x30FF2370, 0x07F87B2B, 0x15054CE2, 0x2DF2E2EE, 0x3F0FD527, 0x08088D7C, 0x1AF5BAB5,
+	0x3DE3F817, 0x2F1ECFDE, 0x18199785, 0x0AE4A04C, 0x32130E40, 0x20EE3989, 0x17E961D2, 0x0514561B,
+	0x1DC1CDE5, 0x0F3CFA2C, 0x383BA277, 0x2AC695BE, 0x12313BB2, 0x00CC0C7B, 0x37CB5420, 0x253663E9,
+	0x0220214B, 0x10DD1682, 0x27DA4ED9, 0x35277910, 0x0DD0D71C, 0x1F2DE0D5, 0x282AB88E, 0x3AD78F47,
+	0x19818F72, 0x0B7CB8BB, 0x3C7BE0E0, 0x2E86D729, 0x16717925, 0x048C4EEC, 0x338B16B7, 0x2176217E,
+	0x066063DC, 0x149D5415, 0x239A0C4E, 0x31673B87, 0x0990958B, 0x1B6DA242, 0x2C6AFA19, 0x3E97CDD0,
+	0x2642562E, 0x34BF61E7, 0x03B839BC, 0x11450E75, 0x29B2A079, 0x3B4F97B0, 0x0C48CFEB, 0x1EB5F822,
+	0x39A3BA80, 0x2B5E8D49, 0x1C59D512, 0x0EA4E2DB, 0x36534CD7, 0x24AE7B1E, 0x13A92345, 0x0154148C,
+	0x11010A5C, 0x03FC3D95, 0x34FB65CE, 0x26065207, 0x1EF1FC0B, 0x0C0CCBC2, 0x3B0B9399, 0x29F6A450,
+	0x0EE0E6F2, 0x1C1DD13B, 0x2B1A8960, 0x39E7BEA9, 0x011010A5, 0x13ED276C, 0x24EA7F37, 0x361748FE,
+	0x2EC2D300, 0x3C3FE4C9, 0x0B38BC92, 0x19C58B5B, 0x21322557, 0x33CF129E, 0x04C84AC5, 0x16357D0C,
+	0x31233FAE, 0x23DE0867, 0x14D9503C, 0x062467F5, 0x3ED3C9F9, 0x2C2EFE30, 0x1B29A66B, 0x09D491A2,
+	0x2A829197, 0x387FA65E, 0x0F78FE05, 0x1D85C9CC, 0x257267C0, 0x378F5009, 0x00880852, 0x12753F9B,
+	0x35637D39, 0x279E4AF0, 0x109912AB, 0x02642562, 0x3A938B6E, 0x286EBCA7, 0x1F69E4FC, 0x0D94D335,
+	0x154148CB, 0x07BC7F02, 0x30BB2759, 0x22461090, 0x1AB1BE9C, 0x084C8955, 0x3F4BD10E, 0x2DB6E6C7,
+	0x0AA0A465, 0x185D93AC, 0x2F5ACBF7, 0x3DA7FC3E, 0x05505232, 0x17AD65FB, 0x20AA3DA0, 0x32570A69,
+	// Seed 0xB7
+	0x00000000, 0x14BF575F, 0x297EAEBE, 0x3DC1F9E1, 0x52FD5D7C, 0x46420A23, 0x7B83F3C2, 0x6F3CA49D,
+	0x0FF0F6A7, 0x1B4FA1F8, 0x268E5819, 0x32310F46, 0x5D0DABDB, 0x49B2FC84, 0x74730565, 0x60CC523A,
+	0x1FE1ED4E, 0x0B5EBA11, 0x369F43F0, 0x222014AF, 0x4D1CB032, 0x59A3E76D, 0x64621E8C, 0x70DD49D3,
+	0x10111BE9, 0x04AE4CB6, 0x396FB557, 0x2DD0E208, 0x42EC4695, 0x565311CA, 0x6B92E82B, 0x7F2DBF74,
+	0x3FC3DA9C, 0x2B7C8DC3, 0x16BD7422, 0x0202237D, 0x6D3E87E0, 0x7981D0BF, 0x4440295E, 0x50FF7E01,
+	0x30332C3B, 0x248C7B64, 0x194D8285, 0x0DF2D5DA, 0x62CE7147, 0x76712618, 0x4BB0DFF9, 0x5F0F88A6,
+	0x202237D2, 0x349D608D, 0x095C996C, 0x1DE3CE33, 0x72DF6AAE, 0x66603DF1, 0x5BA1C410, 0x4F1E934F,
+	0x2FD2C175, 0x3B6D962A, 0x06AC6FCB, 0x12133894, 0x7D2F9C09, 0x6990CB56, 0x545132B7, 0x40EE65E8,
+	0x7F87B538, 0x6B38E267, 0x56F91B86, 0x42464CD9, 0x2D7AE844, 0x39C5BF1B, 0x040446FA, 0x10BB11A5,
+	0x7077439F, 0x64C814C0, 0x5909ED21, 0x4DB6BA7E, 0x228A1EE3, 0x363549BC, 0x0BF4B05D, 0x1F4BE702,
+	0x60665876, 0x74D90F29, 0x4918F6C8, 0x5DA7A197, 0x329B050A, 0x26245255, 0x1BE5ABB4, 0x0F5AFCEB,
+	0x6F96AED1, 0x7B29F98E, 0x46E8006F, 0x52575730, 0x3D6BF3AD, 0x29D4A4F2, 0x14155D13, 0x00AA0A4C,
+	0x40446FA4, 0x54FB38FB, 0x693AC11A, 0x7D859645, 0x12B932D8, 0x06066587, 0x3BC79C66, 0x2F78CB39,
+	0x4FB49903, 0x5B0BCE5C, 0x66CA37BD, 0x727560E2, 0x1D49C47F, 0x09F69320, 0x34376AC1, 0x20883D9E,
+	0x5FA582EA, 0x4B1AD5B5, 0x76DB2C54, 0x62647B0B, 0x0D58DF96, 0x19E788C9, 0x24267128, 0x30992677,
+	0x5055744D, 0x44EA2312, 0x792BDAF3, 0x6D948DAC, 0x02A82931, 0x16177E6E, 0x2BD6878F, 0x3F69D0D0,
+	0x5505262F, 0x41BA7170, 0x7C7B8891, 0x68C4DFCE, 0x07F87B53, 0x13472C0C, 0x2E86D5ED, 0x3A3982B2,
+	0x5AF5D088, 0x4E4A87D7, 0x738B7E36, 0x67342969, 0x08088DF4, 0x1CB7DAAB, 0x2176234A, 0x35C97415,
+	0x4AE4CB61, 0x5E5B9C3E, 0x639A65DF, 0x77253280, 0x1819961D, 0x0CA6C142, 0x316738A3, 0x25D86FFC,
+	0x45143DC6, 0x51AB6A99, 0x6C6A9378, 0x78D5C427, 0x17E960BA, 0x035637E5, 0x3E97CE04, 0x2A28995B,
+	0x6AC6FCB3, 0x7E79ABEC, 0x43B8520D, 0x57070552, 0x383BA1CF, 0x2C84F690, 0x11450F71, 0x05FA582E,
+	0x65360A14, 0x71895D4B, 0x4C48A4AA, 0x58F7F3F5, 0x37CB5768, 0x23740037, 0x1EB5F9D6, 0x0A0AAE89,
+	0x752711FD, 0x619846A2, 0x5C59BF43, 0x48E6E81C, 0x27DA4C81, 0x33651BDE, 0x0EA4E23F, 0x1A1BB560,
+	0x7AD7E75A, 0x6E68B005, 0x53A949E4, 0x47161EBB, 0x282ABA26, 0x3C95ED79, 0x01541498, 0x15EB43C7,
+	0x2A829317, 0x3E3DC448, 0x03FC3DA9, 0x17436AF6, 0x787FCE6B, 0x6CC09934, 0x510160D5, 0x45BE378A,
+	0x257265B0, 0x31CD32EF, 0x0C0CCB0E, 0x18B39C51, 0x778F38CC, 0x63306F93, 0x5EF19672, 0x4A4EC12D,
+	0x35637E59, 0x21DC2906, 0x1C1DD0E7, 0x08A287B8, 0x679E2325, 0x7321747A, 0x4EE08D9B, 0x5A5FDAC4,
+	0x3A9388FE, 0x2E2CDFA1, 0x13ED2640, 0x0752711F, 0x686ED582, 0x7CD182DD, 0x41107B3C, 0x55AF2C63,
+	0x1541498B, 0x01FE1ED4, 0x3C3FE735, 0x2880B06A, 0x47BC14F7, 0x530343A8, 0x6EC2BA49, 0x7A7DED16,
+	0x1AB1BF2C, 0x0E0EE873, 0x33CF1192, 0x277046CD, 0x484CE250, 0x5CF3B50F, 0x61324CEE, 0x758D1BB1,
+	0x0AA0A4C5, 0x1E1FF39A, 0x23DE0A7B, 0x37615D24, 0x585DF9B9, 0x4CE2AEE6, 0x71235707, 0x659C0058,
+	0x05505262, 0x11EF053D, 0x2C2EFCDC, 0x3891AB83, 0x57AD0F1E, 0x43125841, 0x7ED3A1A0, 0x6A6CF6FF,
+	// Seed 0xB8
+	0x00000000, 0x9DFD169F, 0xB0965A43, 0x2D6B4CDC, 0xEA40C3FB, 0x77BDD564, 0x5AD699B8, 0xC72B8F27,
+	0x5FEDF08B, 0xC210E614, 0xEF7BAAC8, 0x7286BC57, 0xB5AD3370, 0x285025EF, 0x053B6933, 0x98C67FAC,
+	0xBFDBE116, 0x2226F789, 0x0F4DBB55, 0x92B0ADCA, 0x559B22ED, 0xC8663472, 0xE50D78AE, 0x78F06E31,
+	0xE036119D, 0x7DCB0702, 0x50A04BDE, 0xCD5D5D41, 0x0A76D266, 0x978BC4F9, 0xBAE08825, 0x271D9EBA,
+	0xF4DBB551, 0x6926A3CE, 0x444DEF12, 0xD9B0F98D, 0x1E9B76AA, 0x83666035, 0xAE0D2CE9, 0x33F03A76,
+	0xAB3645DA, 0x36CB5345, 0x1BA01F99, 0x865D0906, 0x41768621, 0xDC8B90BE, 0xF1E0DC62, 0x6C1DCAFD,
+	0x4B005447, 0xD6FD42D8, 0xFB960E04, 0x666B189B, 0xA14097BC, 0x3CBD8123, 0x11D6CDFF, 0x8C2BDB60,
+	0x14EDA4CC, 0x8910B253, 0xA47BFE8F, 0x3986E810, 0xFEAD6737, 0x635071A8, 0x4E3B3D74, 0xD3C62BEB,
+	0x62DB1DDF, 0xFF260B40, 0xD24D479C, 0x4FB05103, 0x889BDE24, 0x1566C8BB, 0x380D8467, 0xA5F092F8,
+	0x3D36ED54, 0xA0CBFBCB, 0x8DA0B717, 0x105DA188, 0xD7762EAF, 0x4A8B3830, 0x67E074EC, 0xFA1D6273,
+	0xDD00FCC9, 0x40FDEA56, 0x6D96A68A, 0xF06BB015, 0x37403F32, 0xAABD29AD, 0x87D66571, 0x1A2B73EE,
+	0x82ED0C42, 0x1F101ADD, 0x327B5601, 0xAF86409E, 0x68ADCFB9, 0xF550D926, 0xD83B95FA, 0x45C68365,
+	0x9600A88E, 0x0BFDBE11, 0x2696F2CD, 0xBB6BE452, 0x7C406B75, 0xE1BD7DEA, 0xCCD63136, 0x512B27A9,
+	0xC9ED5805, 0x54104E9A, 0x797B0246, 0xE48614D9, 0x23AD9BFE, 0xBE508D61, 0x933BC1BD, 0x0EC6D722,
+	0x29DB4998, 0xB4265F07, 0x994D13DB, 0x04B00544, 0xC39B8A63, 0x5E669CFC, 0x730DD020, 0xEEF0C6BF,
+	0x7636B913, 0xEBCBAF8C, 0xC6A0E350, 0x5B5DF5CF, 0x9C767AE8, 0x018B6C77, 0x2CE020AB, 0xB11D3634,
+	0xC5B63BBE, 0x584B2D21, 0x752061FD, 0xE8DD7762, 0x2FF6F845, 0xB20BEEDA, 0x9F60A206, 0x029DB499,
+	0x9A5BCB35, 0x07A6DDAA, 0x2ACD9176, 0xB73087E9, 0x701B08CE, 0xEDE61E51, 0xC08D528D, 0x5D704412,
+	0x7A6DDAA8, 0xE790CC37, 0xCAFB80EB, 0x57069674, 0x902D1953, 0x0DD00FCC, 0x20BB4310, 0xBD46558F,
+	0x25802A23, 0xB87D3CBC, 0x95167060, 0x08EB66FF, 0xCFC0E9D8, 0x523DFF47, 0x7F56B39B, 0xE2ABA504,
+	0x316D8EEF, 0xAC909870, 0x81FBD4AC, 0x1C06C233, 0xDB2D4D14, 0x46D05B8B, 0x6BBB1757, 0xF64601C8,
+	0x6E807E64, 0xF37D68FB, 0xDE162427, 0x43EB32B8, 0x84C0BD9F, 0x193DAB00, 0x3456E7DC, 0xA9ABF143,
+	0x8EB66FF9, 0x134B7966, 0x3E2035BA, 0xA3DD2325, 0x64F6AC02, 0xF90BBA9D, 0xD460F641, 0x499DE0DE,
+	0xD15B9F72, 0x4CA689ED, 0x61CDC531, 0xFC30D3AE, 0x3B1B5C89, 0xA6E64A16, 0x8B8D06CA, 0x16701055,
+	0xA76D2661, 0x3A9030FE, 0x17FB7C22, 0x8A066ABD, 0x4D2DE59A, 0xD0D0F305, 0xFDBBBFD9, 0x6046A946,
+	0xF880D6EA, 0x657DC075, 0x48168CA9, 0xD5EB9A36, 0x12C01511, 0x8F3D038E, 0xA2564F52, 0x3FAB59CD,
+	0x18B6C777, 0x854BD1E8, 0xA8209D34, 0x35DD8BAB, 0xF2F6048C, 0x6F0B1213, 0x42605ECF, 0xDF9D4850,
+	0x475B37FC, 0xDAA62163, 0xF7CD6DBF, 0x6A307B20, 0xAD1BF407, 0x30E6E298, 0x1D8DAE44, 0x8070B8DB,
+	0x53B69330, 0xCE4B85AF, 0xE320C973, 0x7EDDDFEC, 0xB9F650CB, 0x240B4654, 0x09600A88, 0x949D1C17,
+	0x0C5B63BB, 0x91A67524, 0xBCCD39F8, 0x21302F67, 0xE61BA040, 0x7BE6B6DF, 0x568DFA03, 0xCB70EC9C,
+	0xEC6D7226, 0x719064B9, 0x5CFB2865, 0xC1063EFA, 0x062DB1DD, 0x9BD0A742, 0xB6BBEB9E, 0x2B46FD01,
+	0xB38082AD, 0x2E7D9432, 0x0316D8EE, 0x9EEBCE71, 0x59C04156, 0xC43D57C9, 0xE9561B15, 0x74AB0D8A,
+	// Seed 0xB9
+	0x00000000, 0x4E6C5EE7, 0x9CD8BDCE, 0xD2B4E329, 0x5CCB6DCD, 0x12A7332A, 0xC013D003, 0x8E7F8EE4,
+	0xB996DB9A, 0xF7FA857D, 0x254E6654, 0x6B2238B3, 0xE55DB657, 0xAB31E8B0, 0x79850B99, 0x37E9557E,
+	0x1657A165, 0x583BFF82, 0x8A8F1CAB, 0xC4E3424C, 0x4A9CCCA8, 0x04F0924F, 0xD6447166, 0x98282F81,
+	0xAFC17AFF, 0xE1AD2418, 0x3319C731, 0x7D7599D6, 0xF30A1732, 0xBD6649D5, 0x6FD2AAFC, 0x21BEF41B,
+	0x2CAF42CA, 0x62C31C2D, 0xB077FF04, 0xFE1BA1E3, 0x70642F07, 0x3E0871E0, 0xECBC92C9, 0xA2D0CC2E,
+	0x95399950, 0xDB55C7B7, 0x09E1249E, 0x478D7A79, 0xC9F2F49D, 0x879EAA7A, 0x552A4953, 0x1B4617B4,
+	0x3AF8E3AF, 0x7494BD48, 0xA6205E61, 0xE84C0086, 0x66338E62, 0x285FD085, 0xFAEB33AC, 0xB4876D4B,
+	0x836E3835, 0xCD0266D2, 0x1FB685FB, 0x51DADB1C, 0xDFA555F8, 0x91C90B1F, 0x437DE836, 0x0D11B6D1,
+	0x595E8594, 0x1732DB73, 0xC586385A, 0x8BEA66BD, 0x0595E859, 0x4BF9B6BE, 0x994D5597, 0xD7210B70,
+	0xE0C85E0E, 0xAEA400E9, 0x7C10E3C0, 0x327CBD27, 0xBC0333C3, 0xF26F6D24, 0x20DB8E0D, 0x6EB7D0EA,
+	0x4F0924F1, 0x01657A16, 0xD3D1993F, 0x9DBDC7D8, 0x13C2493C, 0x5DAE17DB, 0x8F1AF4F2, 0xC176AA15,
+	0xF69FFF6B, 0xB8F3A18C, 0x6A4742A5, 0x242B1C42, 0xAA5492A6, 0xE438CC41, 0x368C2F68, 0x78E0718F,
+	0x75F1C75E, 0x3B9D99B9, 0xE9297A90, 0xA7452477, 0x293AAA93, 0x6756F474, 0xB5E2175D, 0xFB8E49BA,
+	0xCC671CC4, 0x820B4223, 0x50BFA10A, 0x1ED3FFED, 0x90AC7109, 0xDEC02FEE, 0x0C74CCC7, 0x42189220,
+	0x63A6663B, 0x2DCA38DC, 0xFF7EDBF5, 0xB1128512, 0x3F6D0BF6, 0x71015511, 0xA3B5B638, 0xEDD9E8DF,
+	0xDA30BDA1, 0x945CE346, 0x46E8006F, 0x08845E88, 0x86FBD06C, 0xC8978E8B, 0x1A236DA2, 0x544F3345,
+	0xB2BD0B28, 0xFCD155CF, 0x2E65B6E6, 0x6009E801, 0xEE7666E5, 0xA01A3802, 0x72AEDB2B, 0x3CC285CC,
+	0x0B2BD0B2, 0x45478E55, 0x97F36D7C, 0xD99F339B, 0x57E0BD7F, 0x198CE398, 0xCB3800B1, 0x85545E56,
+	0xA4EAAA4D, 0xEA86F4AA, 0x38321783, 0x765E4964, 0xF821C780, 0xB64D9967, 0x64F97A4E, 0x2A9524A9,
+	0x1D7C71D7, 0x53102F30, 0x81A4CC19, 0xCFC892FE, 0x41B71C1A, 0x0FDB42FD, 0xDD6FA1D4, 0x9303FF33,
+	0x9E1249E2, 0xD07E1705, 0x02CAF42C, 0x4CA6AACB, 0xC2D9242F, 0x8CB57AC8, 0x5E0199E1, 0x106DC706,
+	0x27849278, 0x69E8CC9F, 0xBB5C2FB6, 0xF5307151, 0x7B4FFFB5, 0x3523A152, 0xE797427B, 0xA9FB1C9C,
+	0x8845E887, 0xC629B660, 0x149D5549, 0x5AF10BAE, 0xD48E854A, 0x9AE2DBAD, 0x48563884, 0x063A6663,
+	0x31D3331D, 0x7FBF6DFA, 0xAD0B8ED3, 0xE367D034, 0x6D185ED0, 0x23740037, 0xF1C0E31E, 0xBFACBDF9,
+	0xEBE38EBC, 0xA58FD05B, 0x773B3372, 0x39576D95, 0xB728E371, 0xF944BD96, 0x2BF05EBF, 0x659C0058,
+	0x52755526, 0x1C190BC1, 0xCEADE8E8, 0x80C1B60F, 0x0EBE38EB, 0x40D2660C, 0x92668525, 0xDC0ADBC2,
+	0xFDB42FD9, 0xB3D8713E, 0x616C9217, 0x2F00CCF0, 0xA17F4214, 0xEF131CF3, 0x3DA7FFDA, 0x73CBA13D,
+	0x4422F443, 0x0A4EAAA4, 0xD8FA498D, 0x9696176A, 0x18E9998E, 0x5685C769, 0x84312440, 0xCA5D7AA7,
+	0xC74CCC76, 0x89209291, 0x5B9471B8, 0x15F82F5F, 0x9B87A1BB, 0xD5EBFF5C, 0x075F1C75, 0x49334292,
+	0x7EDA17EC, 0x30B6490B, 0xE202AA22, 0xAC6EF4C5, 0x22117A21, 0x6C7D24C6, 0xBEC9C7EF, 0xF0A59908,
+	0xD11B6D13, 0x9F7733F4, 0x4DC3D0DD, 0x03AF8E3A, 0x8DD000DE, 0xC3BC5E39, 0x1108BD10, 0x5F64E3F7,
+	0x688DB689, 0x26E1E86E, 0xF4550B47, 0xBA3955A0, 0x3446DB44, 0x7A2A85A3, 0xA89E668A, 0xE6F2386D,
+	// Seed 0xBA
+	0x00000000, 0x1B4B7ADE, 0x3696F5BC, 0x2DDD8F62, 0x3A455E5D, 0x210E2483, 0x0CD3ABE1, 0x1798D13F,
+	0x23E2099F, 0x38A97341, 0x1574FC23, 0x0E3F86FD, 0x19A757C2, 0x02EC2D1C, 0x2F31A27E, 0x347AD8A0,
+	0x10ACA61B, 0x0BE7DCC5, 0x263A53A7, 0x3D712979, 0x2AE9F846, 0x31A28298, 0x1C7F0DFA, 0x07347724,
+	0x334EAF84, 0x2805D55A, 0x05D85A38, 0x1E9320E6, 0x090BF1D9, 0x12408B07, 0x3F9D0465, 0x24D67EBB,
+	0x21594C36, 0x3A1236E8, 0x17CFB98A, 0x0C84C354, 0x1B1C126B, 0x005768B5, 0x2D8AE7D7, 0x36C19D09,
+	0x02BB45A9, 0x19F03F77, 0x342DB015, 0x2F66CACB, 0x38FE1BF4, 0x23B5612A, 0x0E68EE48, 0x15239496,
+	0x31F5EA2D, 0x2ABE90F3, 0x07631F91, 0x1C28654F, 0x0BB0B470, 0x10FBCEAE, 0x3D2641CC, 0x266D3B12,
+	0x1217E3B2, 0x095C996C, 0x2481160E, 0x3FCA6CD0, 0x2852BDEF, 0x3319C731, 0x1EC44853, 0x058F328D,
+	0x15DA2D49, 0x0E915797, 0x234CD8F5, 0x3807A22B, 0x2F9F7314, 0x34D409CA, 0x190986A8, 0x0242FC76,
+	0x363824D6, 0x2D735E08, 0x00AED16A, 0x1BE5ABB4, 0x0C7D7A8B, 0x17360055, 0x3AEB8F37, 0x21A0F5E9,
+	0x05768B52, 0x1E3DF18C, 0x33E07EEE, 0x28AB0430, 0x3F33D50F, 0x2478AFD1, 0x09A520B3, 0x12EE5A6D,
+	0x269482CD, 0x3DDFF813, 0x10027771, 0x0B490DAF, 0x1CD1DC90, 0x079AA64E, 0x2A47292C, 0x310C53F2,
+	0x3483617F, 0x2FC81BA1, 0x021594C3, 0x195EEE1D, 0x0EC63F22, 0x158D45FC, 0x3850CA9E, 0x231BB040,
+	0x176168E0, 0x0C2A123E, 0x21F79D5C, 0x3ABCE782, 0x2D2436BD, 0x366F4C63, 0x1BB2C301, 0x00F9B9DF,
+	0x242FC764, 0x3F64BDBA, 0x12B932D8, 0x09F24806, 0x1E6A9939, 0x0521E3E7, 0x28FC6C85, 0x33B7165B,
+	0x07CDCEFB, 0x1C86B425, 0x315B3B47, 0x2A104199, 0x3D8890A6, 0x26C3EA78, 0x0B1E651A, 0x10551FC4,
+	0x2BB45A92, 0x30FF204C, 0x1D22AF2E, 0x0669D5F0, 0x11F104CF, 0x0ABA7E11, 0x2767F173, 0x3C2C8BAD,
+	0x0856530D, 0x131D29D3, 0x3EC0A6B1, 0x258BDC6F, 0x32130D50, 0x2958778E, 0x0485F8EC, 0x1FCE8232,
+	0x3B18FC89, 0x20538657, 0x0D8E0935, 0x16C573EB, 0x015DA2D4, 0x1A16D80A, 0x37CB5768, 0x2C802DB6,
+	0x18FAF516, 0x03B18FC8, 0x2E6C00AA, 0x35277A74, 0x22BFAB4B, 0x39F4D195, 0x14295EF7, 0x0F622429,
+	0x0AED16A4, 0x11A66C7A, 0x3C7BE318, 0x273099C6, 0x30A848F9, 0x2BE33227, 0x063EBD45, 0x1D75C79B,
+	0x290F1F3B, 0x324465E5, 0x1F99EA87, 0x04D29059, 0x134A4166, 0x08013BB8, 0x25DCB4DA, 0x3E97CE04,
+	0x1A41B0BF, 0x010ACA61, 0x2CD74503, 0x379C3FDD, 0x2004EEE2, 0x3B4F943C, 0x16921B5E, 0x0DD96180,
+	0x39A3B920, 0x22E8C3FE, 0x0F354C9C, 0x147E3642, 0x03E6E77D, 0x18AD9DA3, 0x357012C1, 0x2E3B681F,
+	0x3E6E77DB, 0x25250D05, 0x08F88267, 0x13B3F8B9, 0x042B2986, 0x1F605358, 0x32BDDC3A, 0x29F6A6E4,
+	0x1D8C7E44, 0x06C7049A, 0x2B1A8BF8, 0x3051F126, 0x27C92019, 0x3C825AC7, 0x115FD5A5, 0x0A14AF7B,
+	0x2EC2D1C0, 0x3589AB1E, 0x1854247C, 0x031F5EA2, 0x14878F9D, 0x0FCCF543, 0x22117A21, 0x395A00FF,
+	0x0D20D85F, 0x166BA281, 0x3BB62DE3, 0x20FD573D, 0x37658602, 0x2C2EFCDC, 0x01F373BE, 0x1AB80960,
+	0x1F373BED, 0x047C4133, 0x29A1CE51, 0x32EAB48F, 0x257265B0, 0x3E391F6E, 0x13E4900C, 0x08AFEAD2,
+	0x3CD53272, 0x279E48AC, 0x0A43C7CE, 0x1108BD10, 0x06906C2F, 0x1DDB16F1, 0x30069993, 0x2B4DE34D,
+	0x0F9B9DF6, 0x14D0E728, 0x390D684A, 0x22461294, 0x35DEC3AB, 0x2E95B975, 0x03483617, 0x18034CC9,
+	0x2C799469, 0x3732EEB7, 0x1AEF61D5, 0x01A41B0B, 0x163CCA34, 0x0D77B0EA, 0x20AA3F88, 0x3BE14556,
+	// Seed 0xBB
+	0x00000000, 0x2B2BE576, 0x5657CAEC, 0x7D7C2F9A, 0x15C941D1, 0x3EE2A4A7, 0x439E8B3D, 0x68B56E4B,
+	0x2B9283A2, 0x00B966D4, 0x7DC5494E, 0x56EEAC38, 0x3E5BC273, 0x15702705, 0x680C089F, 0x4327EDE9,
+	0x57250744, 0x7C0EE232, 0x0172CDA8, 0x2A5928DE, 0x42EC4695, 0x69C7A3E3, 0x14BB8C79, 0x3F90690F,
+	0x7CB784E6, 0x579C6190, 0x2AE04E0A, 0x01CBAB7C, 0x697EC537, 0x42552041, 0x3F290FDB, 0x1402EAAD,
+	0x172CDA81, 0x3C073FF7, 0x417B106D, 0x6A50F51B, 0x02E59B50, 0x29CE7E26, 0x54B251BC, 0x7F99B4CA,
+	0x3CBE5923, 0x1795BC55, 0x6AE993CF, 0x41C276B9, 0x297718F2, 0x025CFD84, 0x7F20D21E, 0x540B3768,
+	0x4009DDC5, 0x6B2238B3, 0x165E1729, 0x3D75F25F, 0x55C09C14, 0x7EEB7962, 0x039756F8, 0x28BCB38E,
+	0x6B9B5E67, 0x40B0BB11, 0x3DCC948B, 0x16E771FD, 0x7E521FB6, 0x5579FAC0, 0x2805D55A, 0x032E302C,
+	0x2E59B502, 0x05725074, 0x780E7FEE, 0x53259A98, 0x3B90F4D3, 0x10BB11A5, 0x6DC73E3F, 0x46ECDB49,
+	0x05CB36A0, 0x2EE0D3D6, 0x539CFC4C, 0x78B7193A, 0x10027771, 0x3B299207, 0x4655BD9D, 0x6D7E58EB,
+	0x797CB246, 0x52575730, 0x2F2B78AA, 0x04009DDC, 0x6CB5F397, 0x479E16E1, 0x3AE2397B, 0x11C9DC0D,
+	0x52EE31E4, 0x79C5D492, 0x04B9FB08, 0x2F921E7E, 0x47277035, 0x6C0C9543, 0x1170BAD9, 0x3A5B5FAF,
+	0x39756F83, 0x125E8AF5, 0x6F22A56F, 0x44094019, 0x2CBC2E52, 0x0797CB24, 0x7AEBE4BE, 0x51C001C8,
+	0x12E7EC21, 0x39CC0957, 0x44B026CD, 0x6F9BC3BB, 0x072EADF0, 0x2C054886, 0x5179671C, 0x7A52826A,
+	0x6E5068C7, 0x457B8DB1, 0x3807A22B, 0x132C475D, 0x7B992916, 0x50B2CC60, 0x2DCEE3FA, 0x06E5068C,
+	0x45C2EB65, 0x6EE90E13, 0x13952189, 0x38BEC4FF, 0x500BAAB4, 0x7B204FC2, 0x065C6058, 0x2D77852E,
+	0x5CB36A04, 0x77988F72, 0x0AE4A0E8, 0x21CF459E, 0x497A2BD5, 0x6251CEA3, 0x1F2DE139, 0x3406044F,
+	0x7721E9A6, 0x5C0A0CD0, 0x2176234A, 0x0A5DC63C, 0x62E8A877, 0x49C34D01, 0x34BF629B, 0x1F9487ED,
+	0x0B966D40, 0x20BD8836, 0x5DC1A7AC, 0x76EA42DA, 0x1E5F2C91, 0x3574C9E7, 0x4808E67D, 0x6323030B,
+	0x2004EEE2, 0x0B2F0B94, 0x7653240E, 0x5D78C178, 0x35CDAF33, 0x1EE64A45, 0x639A65DF, 0x48B180A9,
+	0x4B9FB085, 0x60B455F3, 0x1DC87A69, 0x36E39F1F, 0x5E56F154, 0x757D1422, 0x08013BB8, 0x232ADECE,
+	0x600D3327, 0x4B26D651, 0x365AF9CB, 0x1D711CBD, 0x75C472F6, 0x5EEF9780, 0x2393B81A, 0x08B85D6C,
+	0x1CBAB7C1, 0x379152B7, 0x4AED7D2D, 0x61C6985B, 0x0973F610, 0x22581366, 0x5F243CFC, 0x740FD98A,
+	0x37283463, 0x1C03D115, 0x617FFE8F, 0x4A541BF9, 0x22E175B2, 0x09CA90C4, 0x74B6BF5E, 0x5F9D5A28,
+	0x72EADF06, 0x59C13A70, 0x24BD15EA, 0x0F96F09C, 0x67239ED7, 0x4C087BA1, 0x3174543B, 0x1A5FB14D,
+	0x59785CA4, 0x7253B9D2, 0x0F2F9648, 0x2404733E, 0x4CB11D75, 0x679AF803, 0x1AE6D799, 0x31CD32EF,
+	0x25CFD842, 0x0EE43D34, 0x739812AE, 0x58B3F7D8, 0x30069993, 0x1B2D7CE5, 0x6651537F, 0x4D7AB609,
+	0x0E5D5BE0, 0x2576BE96, 0x580A910C, 0x7321747A, 0x1B941A31, 0x30BFFF47, 0x4DC3D0DD, 0x66E835AB,
+	0x65C60587, 0x4EEDE0F1, 0x3391CF6B, 0x18BA2A1D, 0x700F4456, 0x5B24A120, 0x26588EBA, 0x0D736BCC,
+	0x4E548625, 0x657F6353, 0x18034CC9, 0x3328A9BF, 0x5B9DC7F4, 0x70B62282, 0x0DCA0D18, 0x26E1E86E,
+	0x32E302C3, 0x19C8E7B5, 0x64B4C82F, 0x4F9F2D59, 0x272A4312, 0x0C01A664, 0x717D89FE, 0x5A566C88,
+	0x19718161, 0x325A6417, 0x4F264B8D, 0x640DAEFB, 0x0CB8C0B0, 0x279325C6, 0x5AEF0A5C, 0x71C4EF2A,
+	// Seed 0xBC
+	0x00000000, 0x4B0A0FCF, 0x96141F9E, 0xDD1E1051, 0xA987C073, 0xE28DCFBC, 0x3F93DFED, 0x7499D022,
+	0xD6A07FA9, 0x9DAA7066, 0x40B46037, 0x0BBE6FF8, 0x7F27BFDA, 0x342DB015, 0xE933A044, 0xA239AF8B,
+	0x28EF001D, 0x63E50FD2, 0xBEFB1F83, 0xF5F1104C, 0x8168C06E, 0xCA62CFA1, 0x177CDFF0, 0x5C76D03F,
+	0xFE4F7FB4, 0xB545707B, 0x685B602A, 0x23516FE5, 0x57C8BFC7, 0x1CC2B008, 0xC1DCA059, 0x8AD6AF96,
+	0x51DE003A, 0x1AD40FF5, 0xC7CA1FA4, 0x8CC0106B, 0xF859C049, 0xB353CF86, 0x6E4DDFD7, 0x2547D018,
+	0x877E7F93, 0xCC74705C, 0x116A600D, 0x5A606FC2, 0x2EF9BFE0, 0x65F3B02F, 0xB8EDA07E, 0xF3E7AFB1,
+	0x79310027, 0x323B0FE8, 0xEF251FB9, 0xA42F1076, 0xD0B6C054, 0x9BBCCF9B, 0x46A2DFCA, 0x0DA8D005,
+	0xAF917F8E, 0xE49B7041, 0x39856010, 0x728F6FDF, 0x0616BFFD, 0x4D1CB032, 0x9002A063, 0xDB08AFAC,
+	0xA3BC0074, 0xE8B60FBB, 0x35A81FEA, 0x7EA21025, 0x0A3BC007, 0x4131CFC8, 0x9C2FDF99, 0xD725D056,
+	0x751C7FDD, 0x3E167012, 0xE3086043, 0xA8026F8C, 0xDC9BBFAE, 0x9791B061, 0x4A8FA030, 0x0185AFFF,
+	0x8B530069, 0xC0590FA6, 0x1D471FF7, 0x564D1038, 0x22D4C01A, 0x69DECFD5, 0xB4C0DF84, 0xFFCAD04B,
+	0x5DF37FC0, 0x16F9700F, 0xCBE7605E, 0x80ED6F91, 0xF474BFB3, 0xBF7EB07C, 0x6260A02D, 0x296AAFE2,
+	0xF262004E, 0xB9680F81, 0x64761FD0, 0x2F7C101F, 0x5BE5C03D, 0x10EFCFF2, 0xCDF1DFA3, 0x86FBD06C,
+	0x24C27FE7, 0x6FC87028, 0xB2D66079, 0xF9DC6FB6, 0x8D45BF94, 0xC64FB05B, 0x1B51A00A, 0x505BAFC5,
+	0xDA8D0053, 0x91870F9C, 0x4C991FCD, 0x07931002, 0x730AC020, 0x3800CFEF, 0xE51EDFBE, 0xAE14D071,
+	0x0C2D7FFA, 0x47277035, 0x9A396064, 0xD1336FAB, 0xA5AABF89, 0xEEA0B046, 0x33BEA017, 0x78B4AFD8,
+	0xC2D7FFA7, 0x89DDF068, 0x54C3E039, 0x1FC9EFF6, 0x6B503FD4, 0x205A301B, 0xFD44204A, 0xB64E2F85,
+	0x1477800E, 0x5F7D8FC1, 0x82639F90, 0xC969905F, 0xBDF0407D, 0xF6FA4FB2, 0x2BE45FE3, 0x60EE502C,
+	0xEA38FFBA, 0xA132F075, 0x7C2CE024, 0x3726EFEB, 0x43BF3FC9, 0x08B53006, 0xD5AB2057, 0x9EA12F98,
+	0x3C988013, 0x77928FDC, 0xAA8C9F8D, 0xE1869042, 0x951F4060, 0xDE154FAF, 0x030B5FFE, 0x48015031,
+	0x9309FF9D, 0xD803F052, 0x051DE003, 0x4E17EFCC, 0x3A8E3FEE, 0x71843021, 0xAC9A2070, 0xE7902FBF,
+	0x45A98034, 0x0EA38FFB, 0xD3BD9FAA, 0x98B79065, 0xEC2E4047, 0xA7244F88, 0x7A3A5FD9, 0x31305016,
+	0xBBE6FF80, 0xF0ECF04F, 0x2DF2E01E, 0x66F8EFD1, 0x12613FF3, 0x596B303C, 0x8475206D, 0xCF7F2FA2,
+	0x6D468029, 0x264C8FE6, 0xFB529FB7, 0xB0589078, 0xC4C1405A, 0x8FCB4F95, 0x52D55FC4, 0x19DF500B,
+	0x616BFFD3, 0x2A61F01C, 0xF77FE04D, 0xBC75EF82, 0xC8EC3FA0, 0x83E6306F, 0x5EF8203E, 0x15F22FF1,
+	0xB7CB807A, 0xFCC18FB5, 0x21DF9FE4, 0x6AD5902B, 0x1E4C4009, 0x55464FC6, 0x88585F97, 0xC3525058,
+	0x4984FFCE, 0x028EF001, 0xDF90E050, 0x949AEF9F, 0xE0033FBD, 0xAB093072, 0x76172023, 0x3D1D2FEC,
+	0x9F248067, 0xD42E8FA8, 0x09309FF9, 0x423A9036, 0x36A34014, 0x7DA94FDB, 0xA0B75F8A, 0xEBBD5045,
+	0x30B5FFE9, 0x7BBFF026, 0xA6A1E077, 0xEDABEFB8, 0x99323F9A, 0xD2383055, 0x0F262004, 0x442C2FCB,
+	0xE6158040, 0xAD1F8F8F, 0x70019FDE, 0x3B0B9011, 0x4F924033, 0x04984FFC, 0xD9865FAD, 0x928C5062,
+	0x185AFFF4, 0x5350F03B, 0x8E4EE06A, 0xC544EFA5, 0xB1DD3F87, 0xFAD73048, 0x27C92019, 0x6CC32FD6,
+	0xCEFA805D, 0x85F08F92, 0x58EE9FC3, 0x13E4900C, 0x677D402E, 0x2C774FE1, 0xF1695FB0, 0xBA63507F,
+	// Seed 0xBD
+	0x00000000, 0x1BF571CE, 0x37EAE39C, 0x2C1F9252, 0x6FD5C738, 0x7420B6F6, 0x583F24A4, 0x43CA556A,
+	0xDFAB8E70, 0xC45EFFBE, 0xE8416DEC, 0xF3B41C22, 0xB07E4948, 0xAB8B3886, 0x8794AAD4, 0x9C61DB1A,
+	0xD4F68283, 0xCF03F34D, 0xE31C611F, 0xF8E910D1, 0xBB2345BB, 0xA0D63475, 0x8CC9A627, 0x973CD7E9,
+	0x0B5D0CF3, 0x10A87D3D, 0x3CB7EF6F, 0x27429EA1, 0x6488CBCB, 0x7F7DBA05, 0x53622857, 0x48975999,
+	0xC24C9B65, 0xD9B9EAAB, 0xF5A678F9, 0xEE530937, 0xAD995C5D, 0xB66C2D93, 0x9A73BFC1, 0x8186CE0F,
+	0x1DE71515, 0x061264DB, 0x2A0DF689, 0x31F88747, 0x7232D22D, 0x69C7A3E3, 0x45D831B1, 0x5E2D407F,
+	0x16BA19E6, 0x0D4F6828, 0x2150FA7A, 0x3AA58BB4, 0x796FDEDE, 0x629AAF10, 0x4E853D42, 0x55704C8C,
+	0xC9119796, 0xD2E4E658, 0xFEFB740A, 0xE50E05C4, 0xA6C450AE, 0xBD312160, 0x912EB332, 0x8ADBC2FC,
+	0xEF38A8A9, 0xF4CDD967, 0xD8D24B35, 0xC3273AFB, 0x80ED6F91, 0x9B181E5F, 0xB7078C0D, 0xACF2FDC3,
+	0x309326D9, 0x2B665717, 0x0779C545, 0x1C8CB48B, 0x5F46E1E1, 0x44B3902F, 0x68AC027D, 0x735973B3,
+	0x3BCE2A2A, 0x203B5BE4, 0x0C24C9B6, 0x17D1B878, 0x541BED12, 0x4FEE9CDC, 0x63F10E8E, 0x78047F40,
+	0xE465A45A, 0xFF90D594, 0xD38F47C6, 0xC87A3608, 0x8BB06362, 0x904512AC, 0xBC5A80FE, 0xA7AFF130,
+	0x2D7433CC, 0x36814202, 0x1A9ED050, 0x016BA19E, 0x42A1F4F4, 0x5954853A, 0x754B1768, 0x6EBE66A6,
+	0xF2DFBDBC, 0xE92ACC72, 0xC5355E20, 0xDEC02FEE, 0x9D0A7A84, 0x86FF0B4A, 0xAAE09918, 0xB115E8D6,
+	0xF982B14F, 0xE277C081, 0xCE6852D3, 0xD59D231D, 0x96577677, 0x8DA207B9, 0xA1BD95EB, 0xBA48E425,
+	0x26293F3F, 0x3DDC4EF1, 0x11C3DCA3, 0x0A36AD6D, 0x49FCF807, 0x520989C9, 0x7E161B9B, 0x65E36A55,
+	0xB5D0CF31, 0xAE25BEFF, 0x823A2CAD, 0x99CF5D63, 0xDA050809, 0xC1F079C7, 0xEDEFEB95, 0xF61A9A5B,
+	0x6A7B4141, 0x718E308F, 0x5D91A2DD, 0x4664D313, 0x05AE8679, 0x1E5BF7B7, 0x324465E5, 0x29B1142B,
+	0x61264DB2, 0x7AD33C7C, 0x56CCAE2E, 0x4D39DFE0, 0x0EF38A8A, 0x1506FB44, 0x39196916, 0x22EC18D8,
+	0xBE8DC3C2, 0xA578B20C, 0x8967205E, 0x92925190, 0xD15804FA, 0xCAAD7534, 0xE6B2E766, 0xFD4796A8,
+	0x779C5454, 0x6C69259A, 0x4076B7C8, 0x5B83C606, 0x1849936C, 0x03BCE2A2, 0x2FA370F0, 0x3456013E,
+	0xA837DA24, 0xB3C2ABEA, 0x9FDD39B8, 0x84284876, 0xC7E21D1C, 0xDC176CD2, 0xF008FE80, 0xEBFD8F4E,
+	0xA36AD6D7, 0xB89FA719, 0x9480354B, 0x8F754485, 0xCCBF11EF, 0xD74A6021, 0xFB55F273, 0xE0A083BD,
+	0x7CC158A7, 0x67342969, 0x4B2BBB3B, 0x50DECAF5, 0x13149F9F, 0x08E1EE51, 0x24FE7C03, 0x3F0B0DCD,
+	0x5AE86798, 0x411D1656, 0x6D028404, 0x76F7F5CA, 0x353DA0A0, 0x2EC8D16E, 0x02D7433C, 0x192232F2,
+	0x8543E9E8, 0x9EB69826, 0xB2A90A74, 0xA95C7BBA, 0xEA962ED0, 0xF1635F1E, 0xDD7CCD4C, 0xC689BC82,
+	0x8E1EE51B, 0x95EB94D5, 0xB9F40687, 0xA2017749, 0xE1CB2223, 0xFA3E53ED, 0xD621C1BF, 0xCDD4B071,
+	0x51B56B6B, 0x4A401AA5, 0x665F88F7, 0x7DAAF939, 0x3E60AC53, 0x2595DD9D, 0x098A4FCF, 0x127F3E01,
+	0x98A4FCFD, 0x83518D33, 0xAF4E1F61, 0xB4BB6EAF, 0xF7713BC5, 0xEC844A0B, 0xC09BD859, 0xDB6EA997,
+	0x470F728D, 0x5CFA0343, 0x70E59111, 0x6B10E0DF, 0x28DAB5B5, 0x332FC47B, 0x1F305629, 0x04C527E7,
+	0x4C527E7E, 0x57A70FB0, 0x7BB89DE2, 0x604DEC2C, 0x2387B946, 0x3872C888, 0x146D5ADA, 0x0F982B14,
+	0x93F9F00E, 0x880C81C0, 0xA4131392, 0xBFE6625C, 0xFC2C3736, 0xE7D946F8, 0xCBC6D4AA, 0xD033A564,
+	// Seed 0xBE
+	0x00000000, 0x2EFED224, 0x044E995F, 0x2AB04B7B, 0x089D32BE, 0x2663E09A, 0x0CD3ABE1, 0x222D79C5,
+	0x113A657C, 0x3FC4B758, 0x1574FC23, 0x3B8A2E07, 0x19A757C2, 0x375985E6, 0x1DE9CE9D, 0x33171CB9,
+	0x2274CAF8, 0x0C8A18DC, 0x263A53A7, 0x08C48183, 0x2AE9F846, 0x04172A62, 0x2EA76119, 0x0059B33D,
+	0x334EAF84, 0x1DB07DA0, 0x370036DB, 0x19FEE4FF, 0x3BD39D3A, 0x152D4F1E, 0x3F9D0465, 0x1163D641,
+	0x1D5AA8E7, 0x33A47AC3, 0x191431B8, 0x37EAE39C, 0x15C79A59, 0x3B39487D, 0x11890306, 0x3F77D122,
+	0x0C60CD9B, 0x229E1FBF, 0x082E54C4, 0x26D086E0, 0x04FDFF25, 0x2A032D01, 0x00B3667A, 0x2E4DB45E,
+	0x3F2E621F, 0x11D0B03B, 0x3B60FB40, 0x159E2964, 0x37B350A1, 0x194D8285, 0x33FDC9FE, 0x1D031BDA,
+	0x2E140763, 0x00EAD547, 0x2A5A9E3C, 0x04A44C18, 0x268935DD, 0x0877E7F9, 0x22C7AC82, 0x0C397EA6,
+	0x3AB551CE, 0x144B83EA, 0x3EFBC891, 0x10051AB5, 0x32286370, 0x1CD6B154, 0x3666FA2F, 0x1898280B,
+	0x2B8F34B2, 0x0571E696, 0x2FC1ADED, 0x013F7FC9, 0x2312060C, 0x0DECD428, 0x275C9F53, 0x09A24D77,
+	0x18C19B36, 0x363F4912, 0x1C8F0269, 0x3271D04D, 0x105CA988, 0x3EA27BAC, 0x141230D7, 0x3AECE2F3,
+	0x09FBFE4A, 0x27052C6E, 0x0DB56715, 0x234BB531, 0x0166CCF4, 0x2F981ED0, 0x052855AB, 0x2BD6878F,
+	0x27EFF929, 0x09112B0D, 0x23A16076, 0x0D5FB252, 0x2F72CB97, 0x018C19B3, 0x2B3C52C8, 0x05C280EC,
+	0x36D59C55, 0x182B4E71, 0x329B050A, 0x1C65D72E, 0x3E48AEEB, 0x10B67CCF, 0x3A0637B4, 0x14F8E590,
+	0x059B33D1, 0x2B65E1F5, 0x01D5AA8E, 0x2F2B78AA, 0x0D06016F, 0x23F8D34B, 0x09489830, 0x27B64A14,
+	0x14A156AD, 0x3A5F8489, 0x10EFCFF2, 0x3E111DD6, 0x1C3C6413, 0x32C2B637, 0x1872FD4C, 0x368C2F68,
+	0x2CD99E8B, 0x02274CAF, 0x289707D4, 0x0669D5F0, 0x2444AC35, 0x0ABA7E11, 0x200A356A, 0x0EF4E74E,
+	0x3DE3FBF7, 0x131D29D3, 0x39AD62A8, 0x1753B08C, 0x357EC949, 0x1B801B6D, 0x31305016, 0x1FCE8232,
+	0x0EAD5473, 0x20538657, 0x0AE3CD2C, 0x241D1F08, 0x063066CD, 0x28CEB4E9, 0x027EFF92, 0x2C802DB6,
+	0x1F97310F, 0x3169E32B, 0x1BD9A850, 0x35277A74, 0x170A03B1, 0x39F4D195, 0x13449AEE, 0x3DBA48CA,
+	0x3183366C, 0x1F7DE448, 0x35CDAF33, 0x1B337D17, 0x391E04D2, 0x17E0D6F6, 0x3D509D8D, 0x13AE4FA9,
+	0x20B95310, 0x0E478134, 0x24F7CA4F, 0x0A09186B, 0x282461AE, 0x06DAB38A, 0x2C6AF8F1, 0x02942AD5,
+	0x13F7FC94, 0x3D092EB0, 0x17B965CB, 0x3947B7EF, 0x1B6ACE2A, 0x35941C0E, 0x1F245775, 0x31DA8551,
+	0x02CD99E8, 0x2C334BCC, 0x068300B7, 0x287DD293, 0x0A50AB56, 0x24AE7972, 0x0E1E3209, 0x20E0E02D,
+	0x166CCF45, 0x38921D61, 0x1222561A, 0x3CDC843E, 0x1EF1FDFB, 0x300F2FDF, 0x1ABF64A4, 0x3441B680,
+	0x0756AA39, 0x29A8781D, 0x03183366, 0x2DE6E142, 0x0FCB9887, 0x21354AA3, 0x0B8501D8, 0x257BD3FC,
+	0x341805BD, 0x1AE6D799, 0x30569CE2, 0x1EA84EC6, 0x3C853703, 0x127BE527, 0x38CBAE5C, 0x16357C78,
+	0x252260C1, 0x0BDCB2E5, 0x216CF99E, 0x0F922BBA, 0x2DBF527F, 0x0341805B, 0x29F1CB20, 0x070F1904,
+	0x0B3667A2, 0x25C8B586, 0x0F78FEFD, 0x21862CD9, 0x03AB551C, 0x2D558738, 0x07E5CC43, 0x291B1E67,
+	0x1A0C02DE, 0x34F2D0FA, 0x1E429B81, 0x30BC49A5, 0x12913060, 0x3C6FE244, 0x16DFA93F, 0x38217B1B,
+	0x2942AD5A, 0x07BC7F7E, 0x2D0C3405, 0x03F2E621, 0x21DF9FE4, 0x0F214DC0, 0x259106BB, 0x0B6FD49F,
+	0x3878C826, 0x16861A02, 0x3C365179, 0x12C8835D, 0x30E5FA98, 0x1E1B28BC, 0x34AB63C7, 0x1A55B1E3,
+	// Seed 0xBF
+	0x00000000, 0x381ECE1D, 0x703D9C3A, 0x48235227, 0x57C6644F, 0x6FD8AA52, 0x27FBF875, 0x1FE53668,
+	0x183194A5, 0x202F5AB8, 0x680C089F, 0x5012C682, 0x4FF7F0EA, 0x77E93EF7, 0x3FCA6CD0, 0x07D4A2CD,
+	0x3063294A, 0x087DE757, 0x405EB570, 0x78407B6D, 0x67A54D05, 0x5FBB8318, 0x1798D13F, 0x2F861F22,
+	0x2852BDEF, 0x104C73F2, 0x586F21D5, 0x6071EFC8, 0x7F94D9A0, 0x478A17BD, 0x0FA9459A, 0x37B78B87,
+	0x60C65294, 0x58D89C89, 0x10FBCEAE, 0x28E500B3, 0x370036DB, 0x0F1EF8C6, 0x473DAAE1, 0x7F2364FC,
+	0x78F7C631, 0x40E9082C, 0x08CA5A0B, 0x30D49416, 0x2F31A27E, 0x172F6C63, 0x5F0C3E44, 0x6712F059,
+	0x50A57BDE, 0x68BBB5C3, 0x2098E7E4, 0x188629F9, 0x07631F91, 0x3F7DD18C, 0x775E83AB, 0x4F404DB6,
+	0x4894EF7B, 0x708A2166, 0x38A97341, 0x00B7BD5C, 0x1F528B34, 0x274C4529, 0x6F6F170E, 0x5771D913,
+	0x7631F913, 0x4E2F370E, 0x060C6529, 0x3E12AB34, 0x21F79D5C, 0x19E95341, 0x51CA0166, 0x69D4CF7B,
+	0x6E006DB6, 0x561EA3AB, 0x1E3DF18C, 0x26233F91, 0x39C609F9, 0x01D8C7E4, 0x49FB95C3, 0x71E55BDE,
+	0x4652D059, 0x7E4C1E44, 0x366F4C63, 0x0E71827E, 0x1194B416, 0x298A7A0B, 0x61A9282C, 0x59B7E631,
+	0x5E6344FC, 0x667D8AE1, 0x2E5ED8C6, 0x164016DB, 0x09A520B3, 0x31BBEEAE, 0x7998BC89, 0x41867294,
+	0x16F7AB87, 0x2EE9659A, 0x66CA37BD, 0x5ED4F9A0, 0x4131CFC8, 0x792F01D5, 0x310C53F2, 0x09129DEF,
+	0x0EC63F22, 0x36D8F13F, 0x7EFBA318, 0x46E56D05, 0x59005B6D, 0x611E9570, 0x293DC757, 0x1123094A,
+	0x269482CD, 0x1E8A4CD0, 0x56A91EF7, 0x6EB7D0EA, 0x7152E682, 0x494C289F, 0x016F7AB8, 0x3971B4A5,
+	0x3EA51668, 0x06BBD875, 0x4E988A52, 0x7686444F, 0x69637227, 0x517DBC3A, 0x195EEE1D, 0x21402000,
+	0x5BDEAE1D, 0x63C06000, 0x2BE33227, 0x13FDFC3A, 0x0C18CA52, 0x3406044F, 0x7C255668, 0x443B9875,
+	0x43EF3AB8, 0x7BF1F4A5, 0x33D2A682, 0x0BCC689F, 0x14295EF7, 0x2C3790EA, 0x6414C2CD, 0x5C0A0CD0,
+	0x6BBD8757, 0x53A3494A, 0x1B801B6D, 0x239ED570, 0x3C7BE318, 0x04652D05, 0x4C467F22, 0x7458B13F,
+	0x738C13F2, 0x4B92DDEF, 0x03B18FC8, 0x3BAF41D5, 0x244A77BD, 0x1C54B9A0, 0x5477EB87, 0x6C69259A,
+	0x3B18FC89, 0x03063294, 0x4B2560B3, 0x733BAEAE, 0x6CDE98C6, 0x54C056DB, 0x1CE304FC, 0x24FDCAE1,
+	0x2329682C, 0x1B37A631, 0x5314F416, 0x6B0A3A0B, 0x74EF0C63, 0x4CF1C27E, 0x04D29059, 0x3CCC5E44,
+	0x0B7BD5C3, 0x33651BDE, 0x7B4649F9, 0x435887E4, 0x5CBDB18C, 0x64A37F91, 0x2C802DB6, 0x149EE3AB,
+	0x134A4166, 0x2B548F7B, 0x6377DD5C, 0x5B691341, 0x448C2529, 0x7C92EB34, 0x34B1B913, 0x0CAF770E,
+	0x2DEF570E, 0x15F19913, 0x5DD2CB34, 0x65CC0529, 0x7A293341, 0x4237FD5C, 0x0A14AF7B, 0x320A6166,
+	0x35DEC3AB, 0x0DC00DB6, 0x45E35F91, 0x7DFD918C, 0x6218A7E4, 0x5A0669F9, 0x12253BDE, 0x2A3BF5C3,
+	0x1D8C7E44, 0x2592B059, 0x6DB1E27E, 0x55AF2C63, 0x4A4A1A0B, 0x7254D416, 0x3A778631, 0x0269482C,
+	0x05BDEAE1, 0x3DA324FC, 0x758076DB, 0x4D9EB8C6, 0x527B8EAE, 0x6A6540B3, 0x22461294, 0x1A58DC89,
+	0x4D29059A, 0x7537CB87, 0x3D1499A0, 0x050A57BD, 0x1AEF61D5, 0x22F1AFC8, 0x6AD2FDEF, 0x52CC33F2,
+	0x5518913F, 0x6D065F22, 0x25250D05, 0x1D3BC318, 0x02DEF570, 0x3AC03B6D, 0x72E3694A, 0x4AFDA757,
+	0x7D4A2CD0, 0x4554E2CD, 0x0D77B0EA, 0x35697EF7, 0x2A8C489F, 0x12928682, 0x5AB1D4A5, 0x62AF1AB8,
+	0x657BB875, 0x5D657668, 0x1546244F, 0x2D58EA52, 0x32BDDC3A, 0x0AA31227, 0x42804000, 0x7A9E8E1D,
+	// Seed 0xC0
+	0x00000000, 0x6A5DED11, 0xD4BBDA22, 0xBEE63733, 0x9FBF5125, 0xF5E2BC34, 0x4B048B07, 0x21596616,
+	0x09B6472B, 0x63EBAA3A, 0xDD0D9D09, 0xB7507018, 0x9609160E, 0xFC54FB1F, 0x42B2CC2C, 0x28EF213D,
+	0x136C8E56, 0x79316347, 0xC7D75474, 0xAD8AB965, 0x8CD3DF73, 0xE68E3262, 0x58680551, 0x3235E840,
+	0x1ADAC97D, 0x7087246C, 0xCE61135F, 0xA43CFE4E, 0x85659858, 0xEF387549, 0x51DE427A, 0x3B83AF6B,
+	0x26D91CAC, 0x4C84F1BD, 0xF262C68E, 0x983F2B9F, 0xB9664D89, 0xD33BA098, 0x6DDD97AB, 0x07807ABA,
+	0x2F6F5B87, 0x4532B696, 0xFBD481A5, 0x91896CB4, 0xB0D00AA2, 0xDA8DE7B3, 0x646BD080, 0x0E363D91,
+	0x35B592FA, 0x5FE87FEB, 0xE10E48D8, 0x8B53A5C9, 0xAA0AC3DF, 0xC0572ECE, 0x7EB119FD, 0x14ECF4EC,
+	0x3C03D5D1, 0x565E38C0, 0xE8B80FF3, 0x82E5E2E2, 0xA3BC84F4, 0xC9E169E5, 0x77075ED6, 0x1D5AB3C7,
+	0x4DB23958, 0x27EFD449, 0x9909E37A, 0xF3540E6B, 0xD20D687D, 0xB850856C, 0x06B6B25F, 0x6CEB5F4E,
+	0x44047E73, 0x2E599362, 0x90BFA451, 0xFAE24940, 0xDBBB2F56, 0xB1E6C247, 0x0F00F574, 0x655D1865,
+	0x5EDEB70E, 0x34835A1F, 0x8A656D2C, 0xE038803D, 0xC161E62B, 0xAB3C0B3A, 0x15DA3C09, 0x7F87D118,
+	0x5768F025, 0x3D351D34, 0x83D32A07, 0xE98EC716, 0xC8D7A100, 0xA28A4C11, 0x1C6C7B22, 0x76319633,
+	0x6B6B25F4, 0x0136C8E5, 0xBFD0FFD6, 0xD58D12C7, 0xF4D474D1, 0x9E8999C0, 0x206FAEF3, 0x4A3243E2,
+	0x62DD62DF, 0x08808FCE, 0xB666B8FD, 0xDC3B55EC, 0xFD6233FA, 0x973FDEEB, 0x29D9E9D8, 0x438404C9,
+	0x7807ABA2, 0x125A46B3, 0xACBC7180, 0xC6E19C91, 0xE7B8FA87, 0x8DE51796, 0x330320A5, 0x595ECDB4,
+	0x71B1EC89, 0x1BEC0198, 0xA50A36AB, 0xCF57DBBA, 0xEE0EBDAC, 0x845350BD, 0x3AB5678E, 0x50E88A9F,
+	0x9B6472B0, 0xF1399FA1, 0x4FDFA892, 0x25824583, 0x04DB2395, 0x6E86CE84, 0xD060F9B7, 0xBA3D14A6,
+	0x92D2359B, 0xF88FD88A, 0x4669EFB9, 0x2C3402A8, 0x0D6D64BE, 0x673089AF, 0xD9D6BE9C, 0xB38B538D,
+	0x8808FCE6, 0xE25511F7, 0x5CB326C4, 0x36EECBD5, 0x17B7ADC3, 0x7DEA40D2, 0xC30C77E1, 0xA9519AF0,
+	0x81BEBBCD, 0xEBE356DC, 0x550561EF, 0x3F588CFE, 0x1E01EAE8, 0x745C07F9, 0xCABA30CA, 0xA0E7DDDB,
+	0xBDBD6E1C, 0xD7E0830D, 0x6906B43E, 0x035B592F, 0x22023F39, 0x485FD228, 0xF6B9E51B, 0x9CE4080A,
+	0xB40B2937, 0xDE56C426, 0x60B0F315, 0x0AED1E04, 0x2BB47812, 0x41E99503, 0xFF0FA230, 0x95524F21,
+	0xAED1E04A, 0xC48C0D5B, 0x7A6A3A68, 0x1037D779, 0x316EB16F, 0x5B335C7E, 0xE5D56B4D, 0x8F88865C,
+	0xA767A761, 0xCD3A4A70, 0x73DC7D43, 0x19819052, 0x38D8F644, 0x52851B55, 0xEC632C66, 0x863EC177,
+	0xD6D64BE8, 0xBC8BA6F9, 0x026D91CA, 0x68307CDB, 0x49691ACD, 0x2334F7DC, 0x9DD2C0EF, 0xF78F2DFE,
+	0xDF600CC3, 0xB53DE1D2, 0x0BDBD6E1, 0x61863BF0, 0x40DF5DE6, 0x2A82B0F7, 0x946487C4, 0xFE396AD5,
+	0xC5BAC5BE, 0xAFE728AF, 0x11011F9C, 0x7B5CF28D, 0x5A05949B, 0x3058798A, 0x8EBE4EB9, 0xE4E3A3A8,
+	0xCC0C8295, 0xA6516F84, 0x18B758B7, 0x72EAB5A6, 0x53B3D3B0, 0x39EE3EA1, 0x87080992, 0xED55E483,
+	0xF00F5744, 0x9A52BA55, 0x24B48D66, 0x4EE96077, 0x6FB00661, 0x05EDEB70, 0xBB0BDC43, 0xD1563152,
+	0xF9B9106F, 0x93E4FD7E, 0x2D02CA4D, 0x475F275C, 0x6606414A, 0x0C5BAC5B, 0xB2BD9B68, 0xD8E07679,
+	0xE363D912, 0x893E3403, 0x37D80330, 0x5D85EE21, 0x7CDC8837, 0x16816526, 0xA8675215, 0xC23ABF04,
+	0xEAD59E39, 0x80887328, 0x3E6E441B, 0x5433A90A, 0x756ACF1C, 0x1F37220D, 0xA1D1153E, 0xCB8CF82F,
+	// Seed 0xC1
+	0x00000000, 0x8F7E9226, 0xC73AC001, 0x48445227, 0x57B2644F, 0xD8CCF669, 0x9088A44E, 0x1FF63668,
+	0xAF64C89E, 0x201A5AB8, 0x685E089F, 0xE7209AB9, 0xF8D6ACD1, 0x77A83EF7, 0x3FEC6CD0, 0xB092FEF6,
+	0x870E7571, 0x0870E757, 0x4034B570, 0xCF4A2756, 0xD0BC113E, 0x5FC28318, 0x1786D13F, 0x98F84319,
+	0x286ABDEF, 0xA7142FC9, 0xEF507DEE, 0x602EEFC8, 0x7FD8D9A0, 0xF0A64B86, 0xB8E219A1, 0x379C8B87,
+	0xD7DB0EAF, 0x58A59C89, 0x10E1CEAE, 0x9F9F5C88, 0x80696AE0, 0x0F17F8C6, 0x4753AAE1, 0xC82D38C7,
+	0x78BFC631, 0xF7C15417, 0xBF850630, 0x30FB9416, 0x2F0DA27E, 0xA0733058, 0xE837627F, 0x6749F059,
+	0x50D57BDE, 0xDFABE9F8, 0x97EFBBDF, 0x189129F9, 0x07671F91, 0x88198DB7, 0xC05DDF90, 0x4F234DB6,
+	0xFFB1B340, 0x70CF2166, 0x388B7341, 0xB7F5E167, 0xA803D70F, 0x277D4529, 0x6F39170E, 0xE0478528,
+	0x7671F913, 0xF90F6B35, 0xB14B3912, 0x3E35AB34, 0x21C39D5C, 0xAEBD0F7A, 0xE6F95D5D, 0x6987CF7B,
+	0xD915318D, 0x566BA3AB, 0x1E2FF18C, 0x915163AA, 0x8EA755C2, 0x01D9C7E4, 0x499D95C3, 0xC6E307E5,
+	0xF17F8C62, 0x7E011E44, 0x36454C63, 0xB93BDE45, 0xA6CDE82D, 0x29B37A0B, 0x61F7282C, 0xEE89BA0A,
+	0x5E1B44FC, 0xD165D6DA, 0x992184FD, 0x165F16DB, 0x09A920B3, 0x86D7B295, 0xCE93E0B2, 0x41ED7294,
+	0xA1AAF7BC, 0x2ED4659A, 0x669037BD, 0xE9EEA59B, 0xF61893F3, 0x796601D5, 0x312253F2, 0xBE5CC1D4,
+	0x0ECE3F22, 0x81B0AD04, 0xC9F4FF23, 0x468A6D05, 0x597C5B6D, 0xD602C94B, 0x9E469B6C, 0x1138094A,
+	0x26A482CD, 0xA9DA10EB, 0xE19E42CC, 0x6EE0D0EA, 0x7116E682, 0xFE6874A4, 0xB62C2683, 0x3952B4A5,
+	0x89C04A53, 0x06BED875, 0x4EFA8A52, 0xC1841874, 0xDE722E1C, 0x510CBC3A, 0x1948EE1D, 0x96367C3B,
+	0xECE3F226, 0x639D6000, 0x2BD93227, 0xA4A7A001, 0xBB519669, 0x342F044F, 0x7C6B5668, 0xF315C44E,
+	0x43873AB8, 0xCCF9A89E, 0x84BDFAB9, 0x0BC3689F, 0x14355EF7, 0x9B4BCCD1, 0xD30F9EF6, 0x5C710CD0,
+	0x6BED8757, 0xE4931571, 0xACD74756, 0x23A9D570, 0x3C5FE318, 0xB321713E, 0xFB652319, 0x741BB13F,
+	0xC4894FC9, 0x4BF7DDEF, 0x03B38FC8, 0x8CCD1DEE, 0x933B2B86, 0x1C45B9A0, 0x5401EB87, 0xDB7F79A1,
+	0x3B38FC89, 0xB4466EAF, 0xFC023C88, 0x737CAEAE, 0x6C8A98C6, 0xE3F40AE0, 0xABB058C7, 0x24CECAE1,
+	0x945C3417, 0x1B22A631, 0x5366F416, 0xDC186630, 0xC3EE5058, 0x4C90C27E, 0x04D49059, 0x8BAA027F,
+	0xBC3689F8, 0x33481BDE, 0x7B0C49F9, 0xF472DBDF, 0xEB84EDB7, 0x64FA7F91, 0x2CBE2DB6, 0xA3C0BF90,
+	0x13524166, 0x9C2CD340, 0xD4688167, 0x5B161341, 0x44E02529, 0xCB9EB70F, 0x83DAE528, 0x0CA4770E,
+	0x9A920B35, 0x15EC9913, 0x5DA8CB34, 0xD2D65912, 0xCD206F7A, 0x425EFD5C, 0x0A1AAF7B, 0x85643D5D,
+	0x35F6C3AB, 0xBA88518D, 0xF2CC03AA, 0x7DB2918C, 0x6244A7E4, 0xED3A35C2, 0xA57E67E5, 0x2A00F5C3,
+	0x1D9C7E44, 0x92E2EC62, 0xDAA6BE45, 0x55D82C63, 0x4A2E1A0B, 0xC550882D, 0x8D14DA0A, 0x026A482C,
+	0xB2F8B6DA, 0x3D8624FC, 0x75C276DB, 0xFABCE4FD, 0xE54AD295, 0x6A3440B3, 0x22701294, 0xAD0E80B2,
+	0x4D49059A, 0xC23797BC, 0x8A73C59B, 0x050D57BD, 0x1AFB61D5, 0x9585F3F3, 0xDDC1A1D4, 0x52BF33F2,
+	0xE22DCD04, 0x6D535F22, 0x25170D05, 0xAA699F23, 0xB59FA94B, 0x3AE13B6D, 0x72A5694A, 0xFDDBFB6C,
+	0xCA4770EB, 0x4539E2CD, 0x0D7DB0EA, 0x820322CC, 0x9DF514A4, 0x128B8682, 0x5ACFD4A5, 0xD5B14683,
+	0x6523B875, 0xEA5D2A53, 0xA2197874, 0x2D67EA52, 0x3291DC3A, 0xBDEF4E1C, 0xF5AB1C3B, 0x7AD58E1D,
+	// Seed 0xC2
+	0x00000000, 0x2EFED224, 0x5DFDA448, 0x7303766C, 0x512E0FA9, 0x7FD0DD8D, 0x0CD3ABE1, 0x222D79C5,
+	0x4889586B, 0x66778A4F, 0x1574FC23, 0x3B8A2E07, 0x19A757C2, 0x375985E6, 0x445AF38A, 0x6AA421AE,
+	0x7BC7F7EF, 0x553925CB, 0x263A53A7, 0x08C48183, 0x2AE9F846, 0x04172A62, 0x77145C0E, 0x59EA8E2A,
+	0x334EAF84, 0x1DB07DA0, 0x6EB30BCC, 0x404DD9E8, 0x6260A02D, 0x4C9E7209, 0x3F9D0465, 0x1163D641,
+	0x1D5AA8E7, 0x33A47AC3, 0x40A70CAF, 0x6E59DE8B, 0x4C74A74E, 0x628A756A, 0x11890306, 0x3F77D122,
+	0x55D3F08C, 0x7B2D22A8, 0x082E54C4, 0x26D086E0, 0x04FDFF25, 0x2A032D01, 0x59005B6D, 0x77FE8949,
+	0x669D5F08, 0x48638D2C, 0x3B60FB40, 0x159E2964, 0x37B350A1, 0x194D8285, 0x6A4EF4E9, 0x44B026CD,
+	0x2E140763, 0x00EAD547, 0x73E9A32B, 0x5D17710F, 0x7F3A08CA, 0x51C4DAEE, 0x22C7AC82, 0x0C397EA6,
+	0x3AB551CE, 0x144B83EA, 0x6748F586, 0x49B627A2, 0x6B9B5E67, 0x45658C43, 0x3666FA2F, 0x1898280B,
+	0x723C09A5, 0x5CC2DB81, 0x2FC1ADED, 0x013F7FC9, 0x2312060C, 0x0DECD428, 0x7EEFA244, 0x50117060,
+	0x4172A621, 0x6F8C7405, 0x1C8F0269, 0x3271D04D, 0x105CA988, 0x3EA27BAC, 0x4DA10DC0, 0x635FDFE4,
+	0x09FBFE4A, 0x27052C6E, 0x54065A02, 0x7AF88826, 0x58D5F1E3, 0x762B23C7, 0x052855AB, 0x2BD6878F,
+	0x27EFF929, 0x09112B0D, 0x7A125D61, 0x54EC8F45, 0x76C1F680, 0x583F24A4, 0x2B3C52C8, 0x05C280EC,
+	0x6F66A142, 0x41987366, 0x329B050A, 0x1C65D72E, 0x3E48AEEB, 0x10B67CCF, 0x63B50AA3, 0x4D4BD887,
+	0x5C280EC6, 0x72D6DCE2, 0x01D5AA8E, 0x2F2B78AA, 0x0D06016F, 0x23F8D34B, 0x50FBA527, 0x7E057703,
+	0x14A156AD, 0x3A5F8489, 0x495CF2E5, 0x67A220C1, 0x458F5904, 0x6B718B20, 0x1872FD4C, 0x368C2F68,
+	0x756AA39C, 0x5B9471B8, 0x289707D4, 0x0669D5F0, 0x2444AC35, 0x0ABA7E11, 0x79B9087D, 0x5747DA59,
+	0x3DE3FBF7, 0x131D29D3, 0x601E5FBF, 0x4EE08D9B, 0x6CCDF45E, 0x4233267A, 0x31305016, 0x1FCE8232,
+	0x0EAD5473, 0x20538657, 0x5350F03B, 0x7DAE221F, 0x5F835BDA, 0x717D89FE, 0x027EFF92, 0x2C802DB6,
+	0x46240C18, 0x68DADE3C, 0x1BD9A850, 0x35277A74, 0x170A03B1, 0x39F4D195, 0x4AF7A7F9, 0x640975DD,
+	0x68300B7B, 0x46CED95F, 0x35CDAF33, 0x1B337D17, 0x391E04D2, 0x17E0D6F6, 0x64E3A09A, 0x4A1D72BE,
+	0x20B95310, 0x0E478134, 0x7D44F758, 0x53BA257C, 0x71975CB9, 0x5F698E9D, 0x2C6AF8F1, 0x02942AD5,
+	0x13F7FC94, 0x3D092EB0, 0x4E0A58DC, 0x60F48AF8, 0x42D9F33D, 0x6C272119, 0x1F245775, 0x31DA8551,
+	0x5B7EA4FF, 0x758076DB, 0x068300B7, 0x287DD293, 0x0A50AB56, 0x24AE7972, 0x57AD0F1E, 0x7953DD3A,
+	0x4FDFF252, 0x61212076, 0x1222561A, 0x3CDC843E, 0x1EF1FDFB, 0x300F2FDF, 0x430C59B3, 0x6DF28B97,
+	0x0756AA39, 0x29A8781D, 0x5AAB0E71, 0x7455DC55, 0x5678A590, 0x788677B4, 0x0B8501D8, 0x257BD3FC,
+	0x341805BD, 0x1AE6D799, 0x69E5A1F5, 0x471B73D1, 0x65360A14, 0x4BC8D830, 0x38CBAE5C, 0x16357C78,
+	0x7C915DD6, 0x526F8FF2, 0x216CF99E, 0x0F922BBA, 0x2DBF527F, 0x0341805B, 0x7042F637, 0x5EBC2413,
+	0x52855AB5, 0x7C7B8891, 0x0F78FEFD, 0x21862CD9, 0x03AB551C, 0x2D558738, 0x5E56F154, 0x70A82370,
+	0x1A0C02DE, 0x34F2D0FA, 0x47F1A696, 0x690F74B2, 0x4B220D77, 0x65DCDF53, 0x16DFA93F, 0x38217B1B,
+	0x2942AD5A, 0x07BC7F7E, 0x74BF0912, 0x5A41DB36, 0x786CA2F3, 0x569270D7, 0x259106BB, 0x0B6FD49F,
+	0x61CBF531, 0x4F352715, 0x3C365179, 0x12C8835D, 0x30E5FA98, 0x1E1B28BC, 0x6D185ED0, 0x43E68CF4,
+	// Seed 0xC3
+	0x00000000, 0x01217E3B, 0x0242FC76, 0x0363824D, 0x005EDEF9, 0x017FA0C2, 0x021C228F, 0x033D5CB4,
+	0x00BDBDF2, 0x019CC3C9, 0x02FF4184, 0x03DE3FBF, 0x00E3630B, 0x01C21D30, 0x02A19F7D, 0x0380E146,
+	0x017B7BE4, 0x005A05DF, 0x03398792, 0x0218F9A9, 0x0125A51D, 0x0004DB26, 0x0367596B, 0x02462750,
+	0x01C6C616, 0x00E7B82D, 0x03843A60, 0x02A5445B, 0x019818EF, 0x00B966D4, 0x03DAE499, 0x02FB9AA2,
+	0x02F6F7C8, 0x03D789F3, 0x00B40BBE, 0x01957585, 0x02A82931, 0x0389570A, 0x00EAD547, 0x01CBAB7C,
+	0x024B4A3A, 0x036A3401, 0x0009B64C, 0x0128C877, 0x021594C3, 0x0334EAF8, 0x005768B5, 0x0176168E,
+	0x038D8C2C, 0x02ACF217, 0x01CF705A, 0x00EE0E61, 0x03D352D5, 0x02F22CEE, 0x0191AEA3, 0x00B0D098,
+	0x033031DE, 0x02114FE5, 0x0172CDA8, 0x0053B393, 0x036EEF27, 0x024F911C, 0x012C1351, 0x000D6D6A,
+	0x0136C985, 0x0017B7BE, 0x037435F3, 0x02554BC8, 0x0168177C, 0x00496947, 0x032AEB0A, 0x020B9531,
+	0x018B7477, 0x00AA0A4C, 0x03C98801, 0x02E8F63A, 0x01D5AA8E, 0x00F4D4B5, 0x039756F8, 0x02B628C3,
+	0x004DB261, 0x016CCC5A, 0x020F4E17, 0x032E302C, 0x00136C98, 0x013212A3, 0x025190EE, 0x0370EED5,
+	0x00F00F93, 0x01D171A8, 0x02B2F3E5, 0x03938DDE, 0x00AED16A, 0x018FAF51, 0x02EC2D1C, 0x03CD5327,
+	0x03C03E4D, 0x02E14076, 0x0182C23B, 0x00A3BC00, 0x039EE0B4, 0x02BF9E8F, 0x01DC1CC2, 0x00FD62F9,
+	0x037D83BF, 0x025CFD84, 0x013F7FC9, 0x001E01F2, 0x03235D46, 0x0202237D, 0x0161A130, 0x0040DF0B,
+	0x02BB45A9, 0x039A3B92, 0x00F9B9DF, 0x01D8C7E4, 0x02E59B50, 0x03C4E56B, 0x00A76726, 0x0186191D,
+	0x0206F85B, 0x03278660, 0x0044042D, 0x01657A16, 0x025826A2, 0x03795899, 0x001ADAD4, 0x013BA4EF,
+	0x026D930A, 0x034CED31, 0x002F6F7C, 0x010E1147, 0x02334DF3, 0x031233C8, 0x0071B185, 0x0150CFBE,
+	0x02D02EF8, 0x03F150C3, 0x0092D28E, 0x01B3ACB5, 0x028EF001, 0x03AF8E3A, 0x00CC0C77, 0x01ED724C,
+	0x0316E8EE, 0x023796D5, 0x01541498, 0x00756AA3, 0x03483617, 0x0269482C, 0x010ACA61, 0x002BB45A,
+	0x03AB551C, 0x028A2B27, 0x01E9A96A, 0x00C8D751, 0x03F58BE5, 0x02D4F5DE, 0x01B77793, 0x009609A8,
+	0x009B64C2, 0x01BA1AF9, 0x02D998B4, 0x03F8E68F, 0x00C5BA3B, 0x01E4C400, 0x0287464D, 0x03A63876,
+	0x0026D930, 0x0107A70B, 0x02642546, 0x03455B7D, 0x007807C9, 0x015979F2, 0x023AFBBF, 0x031B8584,
+	0x01E01F26, 0x00C1611D, 0x03A2E350, 0x02839D6B, 0x01BEC1DF, 0x009FBFE4, 0x03FC3DA9, 0x02DD4392,
+	0x015DA2D4, 0x007CDCEF, 0x031F5EA2, 0x023E2099, 0x01037C2D, 0x00220216, 0x0341805B, 0x0260FE60,
+	0x035B5A8F, 0x027A24B4, 0x0119A6F9, 0x0038D8C2, 0x03058476, 0x0224FA4D, 0x01477800, 0x0066063B,
+	0x03E6E77D, 0x02C79946, 0x01A41B0B, 0x00856530, 0x03B83984, 0x029947BF, 0x01FAC5F2, 0x00DBBBC9,
+	0x0220216B, 0x03015F50, 0x0062DD1D, 0x0143A326, 0x027EFF92, 0x035F81A9, 0x003C03E4, 0x011D7DDF,
+	0x029D9C99, 0x03BCE2A2, 0x00DF60EF, 0x01FE1ED4, 0x02C34260, 0x03E23C5B, 0x0081BE16, 0x01A0C02D,
+	0x01ADAD47, 0x008CD37C, 0x03EF5131, 0x02CE2F0A, 0x01F373BE, 0x00D20D85, 0x03B18FC8, 0x0290F1F3,
+	0x011010B5, 0x00316E8E, 0x0352ECC3, 0x027392F8, 0x014ECE4C, 0x006FB077, 0x030C323A, 0x022D4C01,
+	0x00D6D6A3, 0x01F7A898, 0x02942AD5, 0x03B554EE, 0x0088085A, 0x01A97661, 0x02CAF42C, 0x03EB8A17,
+	0x006B6B51, 0x014A156A, 0x02299727, 0x0308E91C, 0x0035B5A8, 0x0114CB93, 0x027749DE, 0x035637E5,
+	// Seed 0xC4
+	0x00000000, 0xFB672A1F, 0xCEDC596D, 0x35BB7372, 0xA5AABF89, 0x5ECD9596, 0x6B76E6E4, 0x9011CCFB,
+	0x73477241, 0x8820585E, 0xBD9B2B2C, 0x46FC0133, 0xD6EDCDC8, 0x2D8AE7D7, 0x183194A5, 0xE356BEBA,
+	0xE68EE482, 0x1DE9CE9D, 0x2852BDEF, 0xD33597F0, 0x43245B0B, 0xB8437114, 0x8DF80266, 0x769F2879,
+	0x95C996C3, 0x6EAEBCDC, 0x5B15CFAE, 0xA072E5B1, 0x3063294A, 0xCB040355, 0xFEBF7027, 0x05D85A38,
+	0xF50FC457, 0x0E68EE48, 0x3BD39D3A, 0xC0B4B725, 0x50A57BDE, 0xABC251C1, 0x9E7922B3, 0x651E08AC,
+	0x8648B616, 0x7D2F9C09, 0x4894EF7B, 0xB3F3C564, 0x23E2099F, 0xD8852380, 0xED3E50F2, 0x16597AED,
+	0x138120D5, 0xE8E60ACA, 0xDD5D79B8, 0x263A53A7, 0xB62B9F5C, 0x4D4CB543, 0x78F7C631, 0x8390EC2E,
+	0x60C65294, 0x9BA1788B, 0xAE1A0BF9, 0x557D21E6, 0xC56CED1D, 0x3E0BC702, 0x0BB0B470, 0xF0D79E6F,
+	0xD20D85FD, 0x296AAFE2, 0x1CD1DC90, 0xE7B6F68F, 0x77A73A74, 0x8CC0106B, 0xB97B6319, 0x421C4906,
+	0xA14AF7BC, 0x5A2DDDA3, 0x6F96AED1, 0x94F184CE, 0x04E04835, 0xFF87622A, 0xCA3C1158, 0x315B3B47,
+	0x3483617F, 0xCFE44B60, 0xFA5F3812, 0x0138120D, 0x9129DEF6, 0x6A4EF4E9, 0x5FF5879B, 0xA492AD84,
+	0x47C4133E, 0xBCA33921, 0x89184A53, 0x727F604C, 0xE26EACB7, 0x190986A8, 0x2CB2F5DA, 0xD7D5DFC5,
+	0x270241AA, 0xDC656BB5, 0xE9DE18C7, 0x12B932D8, 0x82A8FE23, 0x79CFD43C, 0x4C74A74E, 0xB7138D51,
+	0x544533EB, 0xAF2219F4, 0x9A996A86, 0x61FE4099, 0xF1EF8C62, 0x0A88A67D, 0x3F33D50F, 0xC454FF10,
+	0xC18CA528, 0x3AEB8F37, 0x0F50FC45, 0xF437D65A, 0x64261AA1, 0x9F4130BE, 0xAAFA43CC, 0x519D69D3,
+	0xB2CBD769, 0x49ACFD76, 0x7C178E04, 0x8770A41B, 0x176168E0, 0xEC0642FF, 0xD9BD318D, 0x22DA1B92,
+	0x9C0906A9, 0x676E2CB6, 0x52D55FC4, 0xA9B275DB, 0x39A3B920, 0xC2C4933F, 0xF77FE04D, 0x0C18CA52,
+	0xEF4E74E8, 0x14295EF7, 0x21922D85, 0xDAF5079A, 0x4AE4CB61, 0xB183E17E, 0x8438920C, 0x7F5FB813,
+	0x7A87E22B, 0x81E0C834, 0xB45BBB46, 0x4F3C9159, 0xDF2D5DA2, 0x244A77BD, 0x11F104CF, 0xEA962ED0,
+	0x09C0906A, 0xF2A7BA75, 0xC71CC907, 0x3C7BE318, 0xAC6A2FE3, 0x570D05FC, 0x62B6768E, 0x99D15C91,
+	0x6906C2FE, 0x9261E8E1, 0xA7DA9B93, 0x5CBDB18C, 0xCCAC7D77, 0x37CB5768, 0x0270241A, 0xF9170E05,
+	0x1A41B0BF, 0xE1269AA0, 0xD49DE9D2, 0x2FFAC3CD, 0xBFEB0F36, 0x448C2529, 0x7137565B, 0x8A507C44,
+	0x8F88267C, 0x74EF0C63, 0x41547F11, 0xBA33550E, 0x2A2299F5, 0xD145B3EA, 0xE4FEC098, 0x1F99EA87,
+	0xFCCF543D, 0x07A87E22, 0x32130D50, 0xC974274F, 0x5965EBB4, 0xA202C1AB, 0x97B9B2D9, 0x6CDE98C6,
+	0x4E048354, 0xB563A94B, 0x80D8DA39, 0x7BBFF026, 0xEBAE3CDD, 0x10C916C2, 0x257265B0, 0xDE154FAF,
+	0x3D43F115, 0xC624DB0A, 0xF39FA878, 0x08F88267, 0x98E94E9C, 0x638E6483, 0x563517F1, 0xAD523DEE,
+	0xA88A67D6, 0x53ED4DC9, 0x66563EBB, 0x9D3114A4, 0x0D20D85F, 0xF647F240, 0xC3FC8132, 0x389BAB2D,
+	0xDBCD1597, 0x20AA3F88, 0x15114CFA, 0xEE7666E5, 0x7E67AA1E, 0x85008001, 0xB0BBF373, 0x4BDCD96C,
+	0xBB0B4703, 0x406C6D1C, 0x75D71E6E, 0x8EB03471, 0x1EA1F88A, 0xE5C6D295, 0xD07DA1E7, 0x2B1A8BF8,
+	0xC84C3542, 0x332B1F5D, 0x06906C2F, 0xFDF74630, 0x6DE68ACB, 0x9681A0D4, 0xA33AD3A6, 0x585DF9B9,
+	0x5D85A381, 0xA6E2899E, 0x9359FAEC, 0x683ED0F3, 0xF82F1C08, 0x03483617, 0x36F34565, 0xCD946F7A,
+	0x2EC2D1C0, 0xD5A5FBDF, 0xE01E88AD, 0x1B79A2B2, 0x8B686E49, 0x700F4456, 0x45B43724, 0xBED31D3B,
+	// Seed 0xC5
+	0x00000000, 0xE974128B, 0x04F44969, 0xED805BE2, 0x09E892D2, 0xE09C8059, 0x0D1CDBBB, 0xE468C930,
+	0x13D125A4, 0xFAA5372F, 0x17256CCD, 0xFE517E46, 0x1A39B776, 0xF34DA5FD, 0x1ECDFE1F, 0xF7B9EC94,
+	0x27A24B48, 0xCED659C3, 0x23560221, 0xCA2210AA, 0x2E4AD99A, 0xC73ECB11, 0x2ABE90F3, 0xC3CA8278,
+	0x34736EEC, 0xDD077C67, 0x30872785, 0xD9F3350E, 0x3D9BFC3E, 0xD4EFEEB5, 0x396FB557, 0xD01BA7DC,
+	0x4F449690, 0xA630841B, 0x4BB0DFF9, 0xA2C4CD72, 0x46AC0442, 0xAFD816C9, 0x42584D2B, 0xAB2C5FA0,
+	0x5C95B334, 0xB5E1A1BF, 0x5861FA5D, 0xB115E8D6, 0x557D21E6, 0xBC09336D, 0x5189688F, 0xB8FD7A04,
+	0x68E6DDD8, 0x8192CF53, 0x6C1294B1, 0x8566863A, 0x610E4F0A, 0x887A5D81, 0x65FA0663, 0x8C8E14E8,
+	0x7B37F87C, 0x9243EAF7, 0x7FC3B115, 0x96B7A39E, 0x72DF6AAE, 0x9BAB7825, 0x762B23C7, 0x9F5F314C,
+	0x9E892D20, 0x77FD3FAB, 0x9A7D6449, 0x730976C2, 0x9761BFF2, 0x7E15AD79, 0x9395F69B, 0x7AE1E410,
+	0x8D580884, 0x642C1A0F, 0x89AC41ED, 0x60D85366, 0x84B09A56, 0x6DC488DD, 0x8044D33F, 0x6930C1B4,
+	0xB92B6668, 0x505F74E3, 0xBDDF2F01, 0x54AB3D8A, 0xB0C3F4BA, 0x59B7E631, 0xB437BDD3, 0x5D43AF58,
+	0xAAFA43CC, 0x438E5147, 0xAE0E0AA5, 0x477A182E, 0xA312D11E, 0x4A66C395, 0xA7E69877, 0x4E928AFC,
+	0xD1CDBBB0, 0x38B9A93B, 0xD539F2D9, 0x3C4DE052, 0xD8252962, 0x31513BE9, 0xDCD1600B, 0x35A57280,
+	0xC21C9E14, 0x2B688C9F, 0xC6E8D77D, 0x2F9CC5F6, 0xCBF40CC6, 0x22801E4D, 0xCF0045AF, 0x26745724,
+	0xF66FF0F8, 0x1F1BE273, 0xF29BB991, 0x1BEFAB1A, 0xFF87622A, 0x16F370A1, 0xFB732B43, 0x120739C8,
+	0xE5BED55C, 0x0CCAC7D7, 0xE14A9C35, 0x083E8EBE, 0xEC56478E, 0x05225505, 0xE8A20EE7, 0x01D61C6C,
+	0xEB0E363F, 0x027A24B4, 0xEFFA7F56, 0x068E6DDD, 0xE2E6A4ED, 0x0B92B666, 0xE612ED84, 0x0F66FF0F,
+	0xF8DF139B, 0x11AB0110, 0xFC2B5AF2, 0x155F4879, 0xF1378149, 0x184393C2, 0xF5C3C820, 0x1CB7DAAB,
+	0xCCAC7D77, 0x25D86FFC, 0xC858341E, 0x212C2695, 0xC544EFA5, 0x2C30FD2E, 0xC1B0A6CC, 0x28C4B447,
+	0xDF7D58D3, 0x36094A58, 0xDB8911BA, 0x32FD0331, 0xD695CA01, 0x3FE1D88A, 0xD2618368, 0x3B1591E3,
+	0xA44AA0AF, 0x4D3EB224, 0xA0BEE9C6, 0x49CAFB4D, 0xADA2327D, 0x44D620F6, 0xA9567B14, 0x4022699F,
+	0xB79B850B, 0x5EEF9780, 0xB36FCC62, 0x5A1BDEE9, 0xBE7317D9, 0x57070552, 0xBA875EB0, 0x53F34C3B,
+	0x83E8EBE7, 0x6A9CF96C, 0x871CA28E, 0x6E68B005, 0x8A007935, 0x63746BBE, 0x8EF4305C, 0x678022D7,
+	0x9039CE43, 0x794DDCC8, 0x94CD872A, 0x7DB995A1, 0x99D15C91, 0x70A54E1A, 0x9D2515F8, 0x74510773,
+	0x75871B1F, 0x9CF30994, 0x71735276, 0x980740FD, 0x7C6F89CD, 0x951B9B46, 0x789BC0A4, 0x91EFD22F,
+	0x66563EBB, 0x8F222C30, 0x62A277D2, 0x8BD66559, 0x6FBEAC69, 0x86CABEE2, 0x6B4AE500, 0x823EF78B,
+	0x52255057, 0xBB5142DC, 0x56D1193E, 0xBFA50BB5, 0x5BCDC285, 0xB2B9D00E, 0x5F398BEC, 0xB64D9967,
+	0x41F475F3, 0xA8806778, 0x45003C9A, 0xAC742E11, 0x481CE721, 0xA168F5AA, 0x4CE8AE48, 0xA59CBCC3,
+	0x3AC38D8F, 0xD3B79F04, 0x3E37C4E6, 0xD743D66D, 0x332B1F5D, 0xDA5F0DD6, 0x37DF5634, 0xDEAB44BF,
+	0x2912A82B, 0xC066BAA0, 0x2DE6E142, 0xC492F3C9, 0x20FA3AF9, 0xC98E2872, 0x240E7390, 0xCD7A611B,
+	0x1D61C6C7, 0xF415D44C, 0x19958FAE, 0xF0E19D25, 0x14895415, 0xFDFD469E, 0x107D1D7C, 0xF9090FF7,
+	0x0EB0E363, 0xE7C4F1E8, 0x0A44AA0A, 0xE330B881, 0x075871B1, 0xEE2C633A, 0x03AC38D8, 0xEAD82A53,
+	// Seed 0xC6
+	0x00000000, 0x7EFBADA2, 0x19F98A4F, 0x670227ED, 0x33F3149E, 0x4D08B93C, 0x2A0A9ED1, 0x54F13373,
+	0x67E6293C, 0x191D849E, 0x7E1FA373, 0x00E40ED1, 0x54153DA2, 0x2AEE9000, 0x4DECB7ED, 0x33171A4F,
+	0x2BC28373, 0x55392ED1, 0x323B093C, 0x4CC0A49E, 0x183197ED, 0x66CA3A4F, 0x01C81DA2, 0x7F33B000,
+	0x4C24AA4F, 0x32DF07ED, 0x55DD2000, 0x2B268DA2, 0x7FD7BED1, 0x012C1373, 0x662E349E, 0x18D5993C,
+	0x578506E6, 0x297EAB44, 0x4E7C8CA9, 0x3087210B, 0x64761278, 0x1A8DBFDA, 0x7D8F9837, 0x03743595,
+	0x30632FDA, 0x4E988278, 0x299AA595, 0x57610837, 0x03903B44, 0x7D6B96E6, 0x1A69B10B, 0x64921CA9,
+	0x7C478595, 0x02BC2837, 0x65BE0FDA, 0x1B45A278, 0x4FB4910B, 0x314F3CA9, 0x564D1B44, 0x28B6B6E6,
+	0x1BA1ACA9, 0x655A010B, 0x025826E6, 0x7CA38B44, 0x2852B837, 0x56A91595, 0x31AB3278, 0x4F509FDA,
+	0x4B04DCC7, 0x35FF7165, 0x52FD5688, 0x2C06FB2A, 0x78F7C859, 0x060C65FB, 0x610E4216, 0x1FF5EFB4,
+	0x2CE2F5FB, 0x52195859, 0x351B7FB4, 0x4BE0D216, 0x1F11E165, 0x61EA4CC7, 0x06E86B2A, 0x7813C688,
+	0x60C65FB4, 0x1E3DF216, 0x793FD5FB, 0x07C47859, 0x53354B2A, 0x2DCEE688, 0x4ACCC165, 0x34376CC7,
+	0x07207688, 0x79DBDB2A, 0x1ED9FCC7, 0x60225165, 0x34D36216, 0x4A28CFB4, 0x2D2AE859, 0x53D145FB,
+	0x1C81DA21, 0x627A7783, 0x0578506E, 0x7B83FDCC, 0x2F72CEBF, 0x5189631D, 0x368B44F0, 0x4870E952,
+	0x7B67F31D, 0x059C5EBF, 0x629E7952, 0x1C65D4F0, 0x4894E783, 0x366F4A21, 0x516D6DCC, 0x2F96C06E,
+	0x37435952, 0x49B8F4F0, 0x2EBAD31D, 0x50417EBF, 0x04B04DCC, 0x7A4BE06E, 0x1D49C783, 0x63B26A21,
+	0x50A5706E, 0x2E5EDDCC, 0x495CFA21, 0x37A75783, 0x635664F0, 0x1DADC952, 0x7AAFEEBF, 0x0454431D,
+	0x72076885, 0x0CFCC527, 0x6BFEE2CA, 0x15054F68, 0x41F47C1B, 0x3F0FD1B9, 0x580DF654, 0x26F65BF6,
+	0x15E141B9, 0x6B1AEC1B, 0x0C18CBF6, 0x72E36654, 0x26125527, 0x58E9F885, 0x3FEBDF68, 0x411072CA,
+	0x59C5EBF6, 0x273E4654, 0x403C61B9, 0x3EC7CC1B, 0x6A36FF68, 0x14CD52CA, 0x73CF7527, 0x0D34D885,
+	0x3E23C2CA, 0x40D86F68, 0x27DA4885, 0x5921E527, 0x0DD0D654, 0x732B7BF6, 0x14295C1B, 0x6AD2F1B9,
+	0x25826E63, 0x5B79C3C1, 0x3C7BE42C, 0x4280498E, 0x16717AFD, 0x688AD75F, 0x0F88F0B2, 0x71735D10,
+	0x4264475F, 0x3C9FEAFD, 0x5B9DCD10, 0x256660B2, 0x719753C1, 0x0F6CFE63, 0x686ED98E, 0x1695742C,
+	0x0E40ED10, 0x70BB40B2, 0x17B9675F, 0x6942CAFD, 0x3DB3F98E, 0x4348542C, 0x244A73C1, 0x5AB1DE63,
+	0x69A6C42C, 0x175D698E, 0x705F4E63, 0x0EA4E3C1, 0x5A55D0B2, 0x24AE7D10, 0x43AC5AFD, 0x3D57F75F,
+	0x3903B442, 0x47F819E0, 0x20FA3E0D, 0x5E0193AF, 0x0AF0A0DC, 0x740B0D7E, 0x13092A93, 0x6DF28731,
+	0x5EE59D7E, 0x201E30DC, 0x471C1731, 0x39E7BA93, 0x6D1689E0, 0x13ED2442, 0x74EF03AF, 0x0A14AE0D,
+	0x12C13731, 0x6C3A9A93, 0x0B38BD7E, 0x75C310DC, 0x213223AF, 0x5FC98E0D, 0x38CBA9E0, 0x46300442,
+	0x75271E0D, 0x0BDCB3AF, 0x6CDE9442, 0x122539E0, 0x46D40A93, 0x382FA731, 0x5F2D80DC, 0x21D62D7E,
+	0x6E86B2A4, 0x107D1F06, 0x777F38EB, 0x09849549, 0x5D75A63A, 0x238E0B98, 0x448C2C75, 0x3A7781D7,
+	0x09609B98, 0x779B363A, 0x109911D7, 0x6E62BC75, 0x3A938F06, 0x446822A4, 0x236A0549, 0x5D91A8EB,
+	0x454431D7, 0x3BBF9C75, 0x5CBDBB98, 0x2246163A, 0x76B72549, 0x084C88EB, 0x6F4EAF06, 0x11B502A4,
+	0x22A218EB, 0x5C59B549, 0x3B5B92A4, 0x45A03F06, 0x11510C75, 0x6FAAA1D7, 0x08A8863A, 0x76532B98,
+	// Seed 0xC7
+	0x00000000, 0x032E02CC, 0x065C0598, 0x05720754, 0x06B80517, 0x059607DB, 0x00E4008F, 0x03CA0243,
+	0x07700409, 0x045E06C5, 0x012C0191, 0x0202035D, 0x01C8011E, 0x02E603D2, 0x07940486, 0x04BA064A,
+	0x04E00635, 0x07CE04F9, 0x02BC03AD, 0x01920161, 0x02580322, 0x017601EE, 0x040406BA, 0x072A0476,
+	0x0390023C, 0x00BE00F0, 0x05CC07A4, 0x06E20568, 0x0528072B, 0x060605E7, 0x037402B3, 0x005A007F,
+	0x03C0024D, 0x00EE0081, 0x059C07D5, 0x06B20519, 0x0578075A, 0x06560596, 0x032402C2, 0x000A000E,
+	0x04B00644, 0x079E0488, 0x02EC03DC, 0x01C20110, 0x02080353, 0x0126019F, 0x045406CB, 0x077A0407,
+	0x07200478, 0x040E06B4, 0x017C01E0, 0x0252032C, 0x0198016F, 0x02B603A3, 0x07C404F7, 0x04EA063B,
+	0x00500071, 0x037E02BD, 0x060C05E9, 0x05220725, 0x06E80566, 0x05C607AA, 0x00B400FE, 0x039A0232,
+	0x0780049A, 0x04AE0656, 0x01DC0102, 0x02F203CE, 0x0138018D, 0x02160341, 0x07640415, 0x044A06D9,
+	0x00F00093, 0x03DE025F, 0x06AC050B, 0x058207C7, 0x06480584, 0x05660748, 0x0014001C, 0x033A02D0,
+	0x036002AF, 0x004E0063, 0x053C0737, 0x061205FB, 0x05D807B8, 0x06F60574, 0x03840220, 0x00AA00EC,
+	0x041006A6, 0x073E046A, 0x024C033E, 0x016201F2, 0x02A803B1, 0x0186017D, 0x04F40629, 0x07DA04E5,
+	0x044006D7, 0x076E041B, 0x021C034F, 0x01320183, 0x02F803C0, 0x01D6010C, 0x04A40658, 0x078A0494,
+	0x033002DE, 0x001E0012, 0x056C0746, 0x0642058A, 0x058807C9, 0x06A60505, 0x03D40251, 0x00FA009D,
+	0x00A000E2, 0x038E022E, 0x06FC057A, 0x05D207B6, 0x061805F5, 0x05360739, 0x0044006D, 0x036A02A1,
+	0x07D004EB, 0x04FE0627, 0x018C0173, 0x02A203BF, 0x016801FC, 0x02460330, 0x07340464, 0x041A06A8,
+	0x05000713, 0x062E05DF, 0x035C028B, 0x00720047, 0x03B80204, 0x009600C8, 0x05E4079C, 0x06CA0550,
+	0x0270031A, 0x015E01D6, 0x042C0682, 0x0702044E, 0x04C8060D, 0x07E604C1, 0x02940395, 0x01BA0159,
+	0x01E00126, 0x02CE03EA, 0x07BC04BE, 0x04920672, 0x07580431, 0x047606FD, 0x010401A9, 0x022A0365,
+	0x0690052F, 0x05BE07E3, 0x00CC00B7, 0x03E2027B, 0x00280038, 0x030602F4, 0x067405A0, 0x055A076C,
+	0x06C0055E, 0x05EE0792, 0x009C00C6, 0x03B2020A, 0x00780049, 0x03560285, 0x062405D1, 0x050A071D,
+	0x01B00157, 0x029E039B, 0x07EC04CF, 0x04C20603, 0x07080440, 0x0426068C, 0x015401D8, 0x027A0314,
+	0x0220036B, 0x010E01A7, 0x047C06F3, 0x0752043F, 0x0498067C, 0x07B604B0, 0x02C403E4, 0x01EA0128,
+	0x05500762, 0x067E05AE, 0x030C02FA, 0x00220036, 0x03E80275, 0x00C600B9, 0x05B407ED, 0x069A0521,
+	0x02800389, 0x01AE0145, 0x04DC0611, 0x07F204DD, 0x0438069E, 0x07160452, 0x02640306, 0x014A01CA,
+	0x05F00780, 0x06DE054C, 0x03AC0218, 0x008200D4, 0x03480297, 0x0066005B, 0x0514070F, 0x063A05C3,
+	0x066005BC, 0x054E0770, 0x003C0024, 0x031202E8, 0x00D800AB, 0x03F60267, 0x06840533, 0x05AA07FF,
+	0x011001B5, 0x023E0379, 0x074C042D, 0x046206E1, 0x07A804A2, 0x0486066E, 0x01F4013A, 0x02DA03F6,
+	0x014001C4, 0x026E0308, 0x071C045C, 0x04320690, 0x07F804D3, 0x04D6061F, 0x01A4014B, 0x028A0387,
+	0x063005CD, 0x051E0701, 0x006C0055, 0x03420299, 0x008800DA, 0x03A60216, 0x06D40542, 0x05FA078E,
+	0x05A007F1, 0x068E053D, 0x03FC0269, 0x00D200A5, 0x031802E6, 0x0036002A, 0x0544077E, 0x066A05B2,
+	0x02D003F8, 0x01FE0134, 0x048C0660, 0x07A204AC, 0x046806EF, 0x07460423, 0x02340377, 0x011A01BB,
+	// Seed 0xC8
+	0x00000000, 0x5DEEC984, 0xBBDD9308, 0xE6335A8C, 0x5CC5B715, 0x012B7E91, 0xE718241D, 0xBAF6ED99,
+	0xB98B6E2A, 0xE465A7AE, 0x0256FD22, 0x5FB834A6, 0xE54ED93F, 0xB8A010BB, 0x5E934A37, 0x037D83B3,
+	0x58684D51, 0x058684D5, 0xE3B5DE59, 0xBE5B17DD, 0x04ADFA44, 0x594333C0, 0xBF70694C, 0xE29EA0C8,
+	0xE1E3237B, 0xBC0DEAFF, 0x5A3EB073, 0x07D079F7, 0xBD26946E, 0xE0C85DEA, 0x06FB0766, 0x5B15CEE2,
+	0xB0D09AA2, 0xED3E5326, 0x0B0D09AA, 0x56E3C02E, 0xEC152DB7, 0xB1FBE433, 0x57C8BEBF, 0x0A26773B,
+	0x095BF488, 0x54B53D0C, 0xB2866780, 0xEF68AE04, 0x559E439D, 0x08708A19, 0xEE43D095, 0xB3AD1911,
+	0xE8B8D7F3, 0xB5561E77, 0x536544FB, 0x0E8B8D7F, 0xB47D60E6, 0xE993A962, 0x0FA0F3EE, 0x524E3A6A,
+	0x5133B9D9, 0x0CDD705D, 0xEAEE2AD1, 0xB700E355, 0x0DF60ECC, 0x5018C748, 0xB62B9DC4, 0xEBC55440,
+	0x4ADFA441, 0x17316DC5, 0xF1023749, 0xACECFECD, 0x161A1354, 0x4BF4DAD0, 0xADC7805C, 0xF02949D8,
+	0xF354CA6B, 0xAEBA03EF, 0x48895963, 0x156790E7, 0xAF917D7E, 0xF27FB4FA, 0x144CEE76, 0x49A227F2,
+	0x12B7E910, 0x4F592094, 0xA96A7A18, 0xF484B39C, 0x4E725E05, 0x139C9781, 0xF5AFCD0D, 0xA8410489,
+	0xAB3C873A, 0xF6D24EBE, 0x10E11432, 0x4D0FDDB6, 0xF7F9302F, 0xAA17F9AB, 0x4C24A327, 0x11CA6AA3,
+	0xFA0F3EE3, 0xA7E1F767, 0x41D2ADEB, 0x1C3C646F, 0xA6CA89F6, 0xFB244072, 0x1D171AFE, 0x40F9D37A,
+	0x438450C9, 0x1E6A994D, 0xF859C3C1, 0xA5B70A45, 0x1F41E7DC, 0x42AF2E58, 0xA49C74D4, 0xF972BD50,
+	0xA26773B2, 0xFF89BA36, 0x19BAE0BA, 0x4454293E, 0xFEA2C4A7, 0xA34C0D23, 0x457F57AF, 0x18919E2B,
+	0x1BEC1D98, 0x4602D41C, 0xA0318E90, 0xFDDF4714, 0x4729AA8D, 0x1AC76309, 0xFCF43985, 0xA11AF001,
+	0x95BF4882, 0xC8518106, 0x2E62DB8A, 0x738C120E, 0xC97AFF97, 0x94943613, 0x72A76C9F, 0x2F49A51B,
+	0x2C3426A8, 0x71DAEF2C, 0x97E9B5A0, 0xCA077C24, 0x70F191BD, 0x2D1F5839, 0xCB2C02B5, 0x96C2CB31,
+	0xCDD705D3, 0x9039CC57, 0x760A96DB, 0x2BE45F5F, 0x9112B2C6, 0xCCFC7B42, 0x2ACF21CE, 0x7721E84A,
+	0x745C6BF9, 0x29B2A27D, 0xCF81F8F1, 0x926F3175, 0x2899DCEC, 0x75771568, 0x93444FE4, 0xCEAA8660,
+	0x256FD220, 0x78811BA4, 0x9EB24128, 0xC35C88AC, 0x79AA6535, 0x2444ACB1, 0xC277F63D, 0x9F993FB9,
+	0x9CE4BC0A, 0xC10A758E, 0x27392F02, 0x7AD7E686, 0xC0210B1F, 0x9DCFC29B, 0x7BFC9817, 0x26125193,
+	0x7D079F71, 0x20E956F5, 0xC6DA0C79, 0x9B34C5FD, 0x21C22864, 0x7C2CE1E0, 0x9A1FBB6C, 0xC7F172E8,
+	0xC48CF15B, 0x996238DF, 0x7F516253, 0x22BFABD7, 0x9849464E, 0xC5A78FCA, 0x2394D546, 0x7E7A1CC2,
+	0xDF60ECC3, 0x828E2547, 0x64BD7FCB, 0x3953B64F, 0x83A55BD6, 0xDE4B9252, 0x3878C8DE, 0x6596015A,
+	0x66EB82E9, 0x3B054B6D, 0xDD3611E1, 0x80D8D865, 0x3A2E35FC, 0x67C0FC78, 0x81F3A6F4, 0xDC1D6F70,
+	0x8708A192, 0xDAE66816, 0x3CD5329A, 0x613BFB1E, 0xDBCD1687, 0x8623DF03, 0x6010858F, 0x3DFE4C0B,
+	0x3E83CFB8, 0x636D063C, 0x855E5CB0, 0xD8B09534, 0x624678AD, 0x3FA8B129, 0xD99BEBA5, 0x84752221,
+	0x6FB07661, 0x325EBFE5, 0xD46DE569, 0x89832CED, 0x3375C174, 0x6E9B08F0, 0x88A8527C, 0xD5469BF8,
+	0xD63B184B, 0x8BD5D1CF, 0x6DE68B43, 0x300842C7, 0x8AFEAF5E, 0xD71066DA, 0x31233C56, 0x6CCDF5D2,
+	0x37D83B30, 0x6A36F2B4, 0x8C05A838, 0xD1EB61BC, 0x6B1D8C25, 0x36F345A1, 0xD0C01F2D, 0x8D2ED6A9,
+	0x8E53551A, 0xD3BD9C9E, 0x358EC612, 0x68600F96, 0xD296E20F, 0x8F782B8B, 0x694B7107, 0x34A5B883,
+	// Seed 0xC9
+	0x00000000, 0x461CD4DA, 0x8C39A9B4, 0xCA257D6E, 0xDD03A741, 0x9B1F739B, 0x513A0EF5, 0x1726DA2F,
+	0x7F77BAAB, 0x396B6E71, 0xF34E131F, 0xB552C7C5, 0xA2741DEA, 0xE468C930, 0x2E4DB45E, 0x68516084,
+	0xFEEF7556, 0xB8F3A18C, 0x72D6DCE2, 0x34CA0838, 0x23ECD217, 0x65F006CD, 0xAFD57BA3, 0xE9C9AF79,
+	0x8198CFFD, 0xC7841B27, 0x0DA16649, 0x4BBDB293, 0x5C9B68BC, 0x1A87BC66, 0xD0A2C108, 0x96BE15D2,
+	0x38AE1E85, 0x7EB2CA5F, 0xB497B731, 0xF28B63EB, 0xE5ADB9C4, 0xA3B16D1E, 0x69941070, 0x2F88C4AA,
+	0x47D9A42E, 0x01C570F4, 0xCBE00D9A, 0x8DFCD940, 0x9ADA036F, 0xDCC6D7B5, 0x16E3AADB, 0x50FF7E01,
+	0xC6416BD3, 0x805DBF09, 0x4A78C267, 0x0C6416BD, 0x1B42CC92, 0x5D5E1848, 0x977B6526, 0xD167B1FC,
+	0xB936D178, 0xFF2A05A2, 0x350F78CC, 0x7313AC16, 0x64357639, 0x2229A2E3, 0xE80CDF8D, 0xAE100B57,
+	0x715C3D0A, 0x3740E9D0, 0xFD6594BE, 0xBB794064, 0xAC5F9A4B, 0xEA434E91, 0x206633FF, 0x667AE725,
+	0x0E2B87A1, 0x4837537B, 0x82122E15, 0xC40EFACF, 0xD32820E0, 0x9534F43A, 0x5F118954, 0x190D5D8E,
+	0x8FB3485C, 0xC9AF9C86, 0x038AE1E8, 0x45963532, 0x52B0EF1D, 0x14AC3BC7, 0xDE8946A9, 0x98959273,
+	0xF0C4F2F7, 0xB6D8262D, 0x7CFD5B43, 0x3AE18F99, 0x2DC755B6, 0x6BDB816C, 0xA1FEFC02, 0xE7E228D8,
+	0x49F2238F, 0x0FEEF755, 0xC5CB8A3B, 0x83D75EE1, 0x94F184CE, 0xD2ED5014, 0x18C82D7A, 0x5ED4F9A0,
+	0x36859924, 0x70994DFE, 0xBABC3090, 0xFCA0E44A, 0xEB863E65, 0xAD9AEABF, 0x67BF97D1, 0x21A3430B,
+	0xB71D56D9, 0xF1018203, 0x3B24FF6D, 0x7D382BB7, 0x6A1EF198, 0x2C022542, 0xE627582C, 0xA03B8CF6,
+	0xC86AEC72, 0x8E7638A8, 0x445345C6, 0x024F911C, 0x15694B33, 0x53759FE9, 0x9950E287, 0xDF4C365D,
+	0xE2B87A14, 0xA4A4AECE, 0x6E81D3A0, 0x289D077A, 0x3FBBDD55, 0x79A7098F, 0xB38274E1, 0xF59EA03B,
+	0x9DCFC0BF, 0xDBD31465, 0x11F6690B, 0x57EABDD1, 0x40CC67FE, 0x06D0B324, 0xCCF5CE4A, 0x8AE91A90,
+	0x1C570F42, 0x5A4BDB98, 0x906EA6F6, 0xD672722C, 0xC154A803, 0x87487CD9, 0x4D6D01B7, 0x0B71D56D,
+	0x6320B5E9, 0x253C6133, 0xEF191C5D, 0xA905C887, 0xBE2312A8, 0xF83FC672, 0x321ABB1C, 0x74066FC6,
+	0xDA166491, 0x9C0AB04B, 0x562FCD25, 0x103319FF, 0x0715C3D0, 0x4109170A, 0x8B2C6A64, 0xCD30BEBE,
+	0xA561DE3A, 0xE37D0AE0, 0x2958778E, 0x6F44A354, 0x7862797B, 0x3E7EADA1, 0xF45BD0CF, 0xB2470415,
+	0x24F911C7, 0x62E5C51D, 0xA8C0B873, 0xEEDC6CA9, 0xF9FAB686, 0xBFE6625C, 0x75C31F32, 0x33DFCBE8,
+	0x5B8EAB6C, 0x1D927FB6, 0xD7B702D8, 0x91ABD602, 0x868D0C2D, 0xC091D8F7, 0x0AB4A599, 0x4CA87143,
+	0x93E4471E, 0xD5F893C4, 0x1FDDEEAA, 0x59C13A70, 0x4EE7E05F, 0x08FB3485, 0xC2DE49EB, 0x84C29D31,
+	0xEC93FDB5, 0xAA8F296F, 0x60AA5401, 0x26B680DB, 0x31905AF4, 0x778C8E2E, 0xBDA9F340, 0xFBB5279A,
+	0x6D0B3248, 0x2B17E692, 0xE1329BFC, 0xA72E4F26, 0xB0089509, 0xF61441D3, 0x3C313CBD, 0x7A2DE867,
+	0x127C88E3, 0x54605C39, 0x9E452157, 0xD859F58D, 0xCF7F2FA2, 0x8963FB78, 0x43468616, 0x055A52CC,
+	0xAB4A599B, 0xED568D41, 0x2773F02F, 0x616F24F5, 0x7649FEDA, 0x30552A00, 0xFA70576E, 0xBC6C83B4,
+	0xD43DE330, 0x922137EA, 0x58044A84, 0x1E189E5E, 0x093E4471, 0x4F2290AB, 0x8507EDC5, 0xC31B391F,
+	0x55A52CCD, 0x13B9F817, 0xD99C8579, 0x9F8051A3, 0x88A68B8C, 0xCEBA5F56, 0x049F2238, 0x4283F6E2,
+	0x2AD29666, 0x6CCE42BC, 0xA6EB3FD2, 0xE0F7EB08, 0xF7D13127, 0xB1CDE5FD, 0x7BE89893, 0x3DF44C49,
+	// Seed 0xCA
+	0x00000000, 0x42F847C9, 0x7292D8CF, 0x306A9F06, 0x1247E6C3, 0x50BFA10A, 0x60D53E0C, 0x222D79C5,
+	0x248FCD86, 0x66778A4F, 0x561D1549, 0x14E55280, 0x36C82B45, 0x74306C8C, 0x445AF38A, 0x06A2B443,
+	0x491F9B0C, 0x0BE7DCC5, 0x3B8D43C3, 0x7975040A, 0x5B587DCF, 0x19A03A06, 0x29CAA500, 0x6B32E2C9,
+	0x6D90568A, 0x2F681143, 0x1F028E45, 0x5DFAC98C, 0x7FD7B049, 0x3D2FF780, 0x0D456886, 0x4FBD2F4F,
+	0x655D6145, 0x27A5268C, 0x17CFB98A, 0x5537FE43, 0x771A8786, 0x35E2C04F, 0x05885F49, 0x47701880,
+	0x41D2ACC3, 0x032AEB0A, 0x3340740C, 0x71B833C5, 0x53954A00, 0x116D0DC9, 0x210792CF, 0x63FFD506,
+	0x2C42FA49, 0x6EBABD80, 0x5ED02286, 0x1C28654F, 0x3E051C8A, 0x7CFD5B43, 0x4C97C445, 0x0E6F838C,
+	0x08CD37CF, 0x4A357006, 0x7A5FEF00, 0x38A7A8C9, 0x1A8AD10C, 0x587296C5, 0x681809C3, 0x2AE04E0A,
+	0x3DD895D7, 0x7F20D21E, 0x4F4A4D18, 0x0DB20AD1, 0x2F9F7314, 0x6D6734DD, 0x5D0DABDB, 0x1FF5EC12,
+	0x19575851, 0x5BAF1F98, 0x6BC5809E, 0x293DC757, 0x0B10BE92, 0x49E8F95B, 0x7982665D, 0x3B7A2194,
+	0x74C70EDB, 0x363F4912, 0x0655D614, 0x44AD91DD, 0x6680E818, 0x2478AFD1, 0x141230D7, 0x56EA771E,
+	0x5048C35D, 0x12B08494, 0x22DA1B92, 0x60225C5B, 0x420F259E, 0x00F76257, 0x309DFD51, 0x7265BA98,
+	0x5885F492, 0x1A7DB35B, 0x2A172C5D, 0x68EF6B94, 0x4AC21251, 0x083A5598, 0x3850CA9E, 0x7AA88D57,
+	0x7C0A3914, 0x3EF27EDD, 0x0E98E1DB, 0x4C60A612, 0x6E4DDFD7, 0x2CB5981E, 0x1CDF0718, 0x5E2740D1,
+	0x119A6F9E, 0x53622857, 0x6308B751, 0x21F0F098, 0x03DD895D, 0x4125CE94, 0x714F5192, 0x33B7165B,
+	0x3515A218, 0x77EDE5D1, 0x47877AD7, 0x057F3D1E, 0x275244DB, 0x65AA0312, 0x55C09C14, 0x1738DBDD,
+	0x7BB12BAE, 0x39496C67, 0x0923F361, 0x4BDBB4A8, 0x69F6CD6D, 0x2B0E8AA4, 0x1B6415A2, 0x599C526B,
+	0x5F3EE628, 0x1DC6A1E1, 0x2DAC3EE7, 0x6F54792E, 0x4D7900EB, 0x0F814722, 0x3FEBD824, 0x7D139FED,
+	0x32AEB0A2, 0x7056F76B, 0x403C686D, 0x02C42FA4, 0x20E95661, 0x621111A8, 0x527B8EAE, 0x1083C967,
+	0x16217D24, 0x54D93AED, 0x64B3A5EB, 0x264BE222, 0x04669BE7, 0x469EDC2E, 0x76F44328, 0x340C04E1,
+	0x1EEC4AEB, 0x5C140D22, 0x6C7E9224, 0x2E86D5ED, 0x0CABAC28, 0x4E53EBE1, 0x7E3974E7, 0x3CC1332E,
+	0x3A63876D, 0x789BC0A4, 0x48F15FA2, 0x0A09186B, 0x282461AE, 0x6ADC2667, 0x5AB6B961, 0x184EFEA8,
+	0x57F3D1E7, 0x150B962E, 0x25610928, 0x67994EE1, 0x45B43724, 0x074C70ED, 0x3726EFEB, 0x75DEA822,
+	0x737C1C61, 0x31845BA8, 0x01EEC4AE, 0x43168367, 0x613BFAA2, 0x23C3BD6B, 0x13A9226D, 0x515165A4,
+	0x4669BE79, 0x0491F9B0, 0x34FB66B6, 0x7603217F, 0x542E58BA, 0x16D61F73, 0x26BC8075, 0x6444C7BC,
+	0x62E673FF, 0x201E3436, 0x1074AB30, 0x528CECF9, 0x70A1953C, 0x3259D2F5, 0x02334DF3, 0x40CB0A3A,
+	0x0F762575, 0x4D8E62BC, 0x7DE4FDBA, 0x3F1CBA73, 0x1D31C3B6, 0x5FC9847F, 0x6FA31B79, 0x2D5B5CB0,
+	0x2BF9E8F3, 0x6901AF3A, 0x596B303C, 0x1B9377F5, 0x39BE0E30, 0x7B4649F9, 0x4B2CD6FF, 0x09D49136,
+	0x2334DF3C, 0x61CC98F5, 0x51A607F3, 0x135E403A, 0x317339FF, 0x738B7E36, 0x43E1E130, 0x0119A6F9,
+	0x07BB12BA, 0x45435573, 0x7529CA75, 0x37D18DBC, 0x15FCF479, 0x5704B3B0, 0x676E2CB6, 0x25966B7F,
+	0x6A2B4430, 0x28D303F9, 0x18B99CFF, 0x5A41DB36, 0x786CA2F3, 0x3A94E53A, 0x0AFE7A3C, 0x48063DF5,
+	0x4EA489B6, 0x0C5CCE7F, 0x3C365179, 0x7ECE16B0, 0x5CE36F75, 0x1E1B28BC, 0x2E71B7BA, 0x6C89F073,
+	// Seed 0xCB
+	0x00000000, 0x04F92403, 0x09F24806, 0x0D0B6C05, 0x0A88A67D, 0x0E71827E, 0x037AEE7B, 0x0783CA78,
+	0x0C7D7A8B, 0x08845E88, 0x058F328D, 0x0176168E, 0x06F5DCF6, 0x020CF8F5, 0x0F0794F0, 0x0BFEB0F3,
+	0x0196C367, 0x056FE764, 0x08648B61, 0x0C9DAF62, 0x0B1E651A, 0x0FE74119, 0x02EC2D1C, 0x0615091F,
+	0x0DEBB9EC, 0x09129DEF, 0x0419F1EA, 0x00E0D5E9, 0x07631F91, 0x039A3B92, 0x0E915797, 0x0A687394,
+	0x032D86CE, 0x07D4A2CD, 0x0ADFCEC8, 0x0E26EACB, 0x09A520B3, 0x0D5C04B0, 0x005768B5, 0x04AE4CB6,
+	0x0F50FC45, 0x0BA9D846, 0x06A2B443, 0x025B9040, 0x05D85A38, 0x01217E3B, 0x0C2A123E, 0x08D3363D,
+	0x02BB45A9, 0x064261AA, 0x0B490DAF, 0x0FB029AC, 0x0833E3D4, 0x0CCAC7D7, 0x01C1ABD2, 0x05388FD1,
+	0x0EC63F22, 0x0A3F1B21, 0x07347724, 0x03CD5327, 0x044E995F, 0x00B7BD5C, 0x0DBCD159, 0x0945F55A,
+	0x065B0D9C, 0x02A2299F, 0x0FA9459A, 0x0B506199, 0x0CD3ABE1, 0x082A8FE2, 0x0521E3E7, 0x01D8C7E4,
+	0x0A267717, 0x0EDF5314, 0x03D43F11, 0x072D1B12, 0x00AED16A, 0x0457F569, 0x095C996C, 0x0DA5BD6F,
+	0x07CDCEFB, 0x0334EAF8, 0x0E3F86FD, 0x0AC6A2FE, 0x0D456886, 0x09BC4C85, 0x04B72080, 0x004E0483,
+	0x0BB0B470, 0x0F499073, 0x0242FC76, 0x06BBD875, 0x0138120D, 0x05C1360E, 0x08CA5A0B, 0x0C337E08,
+	0x05768B52, 0x018FAF51, 0x0C84C354, 0x087DE757, 0x0FFE2D2F, 0x0B07092C, 0x060C6529, 0x02F5412A,
+	0x090BF1D9, 0x0DF2D5DA, 0x00F9B9DF, 0x04009DDC, 0x038357A4, 0x077A73A7, 0x0A711FA2, 0x0E883BA1,
+	0x04E04835, 0x00196C36, 0x0D120033, 0x09EB2430, 0x0E68EE48, 0x0A91CA4B, 0x079AA64E, 0x0363824D,
+	0x089D32BE, 0x0C6416BD, 0x016F7AB8, 0x05965EBB, 0x021594C3, 0x06ECB0C0, 0x0BE7DCC5, 0x0F1EF8C6,
+	0x0CB61B38, 0x084F3F3B, 0x0544533E, 0x01BD773D, 0x063EBD45, 0x02C79946, 0x0FCCF543, 0x0B35D140,
+	0x00CB61B3, 0x043245B0, 0x093929B5, 0x0DC00DB6, 0x0A43C7CE, 0x0EBAE3CD, 0x03B18FC8, 0x0748ABCB,
+	0x0D20D85F, 0x09D9FC5C, 0x04D29059, 0x002BB45A, 0x07A87E22, 0x03515A21, 0x0E5A3624, 0x0AA31227,
+	0x015DA2D4, 0x05A486D7, 0x08AFEAD2, 0x0C56CED1, 0x0BD504A9, 0x0F2C20AA, 0x02274CAF, 0x06DE68AC,
+	0x0F9B9DF6, 0x0B62B9F5, 0x0669D5F0, 0x0290F1F3, 0x05133B8B, 0x01EA1F88, 0x0CE1738D, 0x0818578E,
+	0x03E6E77D, 0x071FC37E, 0x0A14AF7B, 0x0EED8B78, 0x096E4100, 0x0D976503, 0x009C0906, 0x04652D05,
+	0x0E0D5E91, 0x0AF47A92, 0x07FF1697, 0x03063294, 0x0485F8EC, 0x007CDCEF, 0x0D77B0EA, 0x098E94E9,
+	0x0270241A, 0x06890019, 0x0B826C1C, 0x0F7B481F, 0x08F88267, 0x0C01A664, 0x010ACA61, 0x05F3EE62,
+	0x0AED16A4, 0x0E1432A7, 0x031F5EA2, 0x07E67AA1, 0x0065B0D9, 0x049C94DA, 0x0997F8DF, 0x0D6EDCDC,
+	0x06906C2F, 0x0269482C, 0x0F622429, 0x0B9B002A, 0x0C18CA52, 0x08E1EE51, 0x05EA8254, 0x0113A657,
+	0x0B7BD5C3, 0x0F82F1C0, 0x02899DC5, 0x0670B9C6, 0x01F373BE, 0x050A57BD, 0x08013BB8, 0x0CF81FBB,
+	0x0706AF48, 0x03FF8B4B, 0x0EF4E74E, 0x0A0DC34D, 0x0D8E0935, 0x09772D36, 0x047C4133, 0x00856530,
+	0x09C0906A, 0x0D39B469, 0x0032D86C, 0x04CBFC6F, 0x03483617, 0x07B11214, 0x0ABA7E11, 0x0E435A12,
+	0x05BDEAE1, 0x0144CEE2, 0x0C4FA2E7, 0x08B686E4, 0x0F354C9C, 0x0BCC689F, 0x06C7049A, 0x023E2099,
+	0x0856530D, 0x0CAF770E, 0x01A41B0B, 0x055D3F08, 0x02DEF570, 0x0627D173, 0x0B2CBD76, 0x0FD59975,
+	0x042B2986, 0x00D20D85, 0x0DD96180, 0x09204583, 0x0EA38FFB, 0x0A5AABF8, 0x0751C7FD, 0x03A8E3FE,
+	// Seed 0xCC
+	0x00000000, 0x2EF76468, 0x5DEEC8D0, 0x7319ACB8, 0xBBDD91A0, 0x952AF5C8, 0xE6335970, 0xC8C43D18,
+	0x521E3E77, 0x7CE95A1F, 0x0FF0F6A7, 0x210792CF, 0xE9C3AFD7, 0xC734CBBF, 0xB42D6707, 0x9ADA036F,
+	0xA43C7CEE, 0x8ACB1886, 0xF9D2B43E, 0xD725D056, 0x1FE1ED4E, 0x31168926, 0x420F259E, 0x6CF841F6,
+	0xF6224299, 0xD8D526F1, 0xABCC8A49, 0x853BEE21, 0x4DFFD339, 0x6308B751, 0x10111BE9, 0x3EE67F81,
+	0x6DDDE4EB, 0x432A8083, 0x30332C3B, 0x1EC44853, 0xD600754B, 0xF8F71123, 0x8BEEBD9B, 0xA519D9F3,
+	0x3FC3DA9C, 0x1134BEF4, 0x622D124C, 0x4CDA7624, 0x841E4B3C, 0xAAE92F54, 0xD9F083EC, 0xF707E784,
+	0xC9E19805, 0xE716FC6D, 0x940F50D5, 0xBAF834BD, 0x723C09A5, 0x5CCB6DCD, 0x2FD2C175, 0x0125A51D,
+	0x9BFFA672, 0xB508C21A, 0xC6116EA2, 0xE8E60ACA, 0x202237D2, 0x0ED553BA, 0x7DCCFF02, 0x533B9B6A,
+	0xDBBBC9D6, 0xF54CADBE, 0x86550106, 0xA8A2656E, 0x60665876, 0x4E913C1E, 0x3D8890A6, 0x137FF4CE,
+	0x89A5F7A1, 0xA75293C9, 0xD44B3F71, 0xFABC5B19, 0x32786601, 0x1C8F0269, 0x6F96AED1, 0x4161CAB9,
+	0x7F87B538, 0x5170D150, 0x22697DE8, 0x0C9E1980, 0xC45A2498, 0xEAAD40F0, 0x99B4EC48, 0xB7438820,
+	0x2D998B4F, 0x036EEF27, 0x7077439F, 0x5E8027F7, 0x96441AEF, 0xB8B37E87, 0xCBAAD23F, 0xE55DB657,
+	0xB6662D3D, 0x98914955, 0xEB88E5ED, 0xC57F8185, 0x0DBBBC9D, 0x234CD8F5, 0x5055744D, 0x7EA21025,
+	0xE478134A, 0xCA8F7722, 0xB996DB9A, 0x9761BFF2, 0x5FA582EA, 0x7152E682, 0x024B4A3A, 0x2CBC2E52,
+	0x125A51D3, 0x3CAD35BB, 0x4FB49903, 0x6143FD6B, 0xA987C073, 0x8770A41B, 0xF46908A3, 0xDA9E6CCB,
+	0x40446FA4, 0x6EB30BCC, 0x1DAAA774, 0x335DC31C, 0xFB99FE04, 0xD56E9A6C, 0xA67736D4, 0x888052BC,
+	0x92D28E9B, 0xBC25EAF3, 0xCF3C464B, 0xE1CB2223, 0x290F1F3B, 0x07F87B53, 0x74E1D7EB, 0x5A16B383,
+	0xC0CCB0EC, 0xEE3BD484, 0x9D22783C, 0xB3D51C54, 0x7B11214C, 0x55E64524, 0x26FFE99C, 0x08088DF4,
+	0x36EEF275, 0x1819961D, 0x6B003AA5, 0x45F75ECD, 0x8D3363D5, 0xA3C407BD, 0xD0DDAB05, 0xFE2ACF6D,
+	0x64F0CC02, 0x4A07A86A, 0x391E04D2, 0x17E960BA, 0xDF2D5DA2, 0xF1DA39CA, 0x82C39572, 0xAC34F11A,
+	0xFF0F6A70, 0xD1F80E18, 0xA2E1A2A0, 0x8C16C6C8, 0x44D2FBD0, 0x6A259FB8, 0x193C3300, 0x37CB5768,
+	0xAD115407, 0x83E6306F, 0xF0FF9CD7, 0xDE08F8BF, 0x16CCC5A7, 0x383BA1CF, 0x4B220D77, 0x65D5691F,
+	0x5B33169E, 0x75C472F6, 0x06DDDE4E, 0x282ABA26, 0xE0EE873E, 0xCE19E356, 0xBD004FEE, 0x93F72B86,
+	0x092D28E9, 0x27DA4C81, 0x54C3E039, 0x7A348451, 0xB2F0B949, 0x9C07DD21, 0xEF1E7199, 0xC1E915F1,
+	0x4969474D, 0x679E2325, 0x14878F9D, 0x3A70EBF5, 0xF2B4D6ED, 0xDC43B285, 0xAF5A1E3D, 0x81AD7A55,
+	0x1B77793A, 0x35801D52, 0x4699B1EA, 0x686ED582, 0xA0AAE89A, 0x8E5D8CF2, 0xFD44204A, 0xD3B34422,
+	0xED553BA3, 0xC3A25FCB, 0xB0BBF373, 0x9E4C971B, 0x5688AA03, 0x787FCE6B, 0x0B6662D3, 0x259106BB,
+	0xBF4B05D4, 0x91BC61BC, 0xE2A5CD04, 0xCC52A96C, 0x04969474, 0x2A61F01C, 0x59785CA4, 0x778F38CC,
+	0x24B4A3A6, 0x0A43C7CE, 0x795A6B76, 0x57AD0F1E, 0x9F693206, 0xB19E566E, 0xC287FAD6, 0xEC709EBE,
+	0x76AA9DD1, 0x585DF9B9, 0x2B445501, 0x05B33169, 0xCD770C71, 0xE3806819, 0x9099C4A1, 0xBE6EA0C9,
+	0x8088DF48, 0xAE7FBB20, 0xDD661798, 0xF39173F0, 0x3B554EE8, 0x15A22A80, 0x66BB8638, 0x484CE250,
+	0xD296E13F, 0xFC618557, 0x8F7829EF, 0xA18F4D87, 0x694B709F, 0x47BC14F7, 0x34A5B84F, 0x1A52DC27,
+	// Seed 0xCD
+	0x00000000, 0x924D317F, 0xEF311EE5, 0x7D7C2F9A, 0x15C941D1, 0x878470AE, 0xFAF85F34, 0x68B56E4B,
+	0x2B9283A2, 0xB9DFB2DD, 0xC4A39D47, 0x56EEAC38, 0x3E5BC273, 0xAC16F30C, 0xD16ADC96, 0x4327EDE9,
+	0x57250744, 0xC568363B, 0xB81419A1, 0x2A5928DE, 0x42EC4695, 0xD0A177EA, 0xADDD5870, 0x3F90690F,
+	0x7CB784E6, 0xEEFAB599, 0x93869A03, 0x01CBAB7C, 0x697EC537, 0xFB33F448, 0x864FDBD2, 0x1402EAAD,
+	0xAE4A0E88, 0x3C073FF7, 0x417B106D, 0xD3362112, 0xBB834F59, 0x29CE7E26, 0x54B251BC, 0xC6FF60C3,
+	0x85D88D2A, 0x1795BC55, 0x6AE993CF, 0xF8A4A2B0, 0x9011CCFB, 0x025CFD84, 0x7F20D21E, 0xED6DE361,
+	0xF96F09CC, 0x6B2238B3, 0x165E1729, 0x84132656, 0xECA6481D, 0x7EEB7962, 0x039756F8, 0x91DA6787,
+	0xD2FD8A6E, 0x40B0BB11, 0x3DCC948B, 0xAF81A5F4, 0xC734CBBF, 0x5579FAC0, 0x2805D55A, 0xBA48E425,
+	0x973F610B, 0x05725074, 0x780E7FEE, 0xEA434E91, 0x82F620DA, 0x10BB11A5, 0x6DC73E3F, 0xFF8A0F40,
+	0xBCADE2A9, 0x2EE0D3D6, 0x539CFC4C, 0xC1D1CD33, 0xA964A378, 0x3B299207, 0x4655BD9D, 0xD4188CE2,
+	0xC01A664F, 0x52575730, 0x2F2B78AA, 0xBD6649D5, 0xD5D3279E, 0x479E16E1, 0x3AE2397B, 0xA8AF0804,
+	0xEB88E5ED, 0x79C5D492, 0x04B9FB08, 0x96F4CA77, 0xFE41A43C, 0x6C0C9543, 0x1170BAD9, 0x833D8BA6,
+	0x39756F83, 0xAB385EFC, 0xD6447166, 0x44094019, 0x2CBC2E52, 0xBEF11F2D, 0xC38D30B7, 0x51C001C8,
+	0x12E7EC21, 0x80AADD5E, 0xFDD6F2C4, 0x6F9BC3BB, 0x072EADF0, 0x95639C8F, 0xE81FB315, 0x7A52826A,
+	0x6E5068C7, 0xFC1D59B8, 0x81617622, 0x132C475D, 0x7B992916, 0xE9D41869, 0x94A837F3, 0x06E5068C,
+	0x45C2EB65, 0xD78FDA1A, 0xAAF3F580, 0x38BEC4FF, 0x500BAAB4, 0xC2469BCB, 0xBF3AB451, 0x2D77852E,
+	0xE5D5BE0D, 0x77988F72, 0x0AE4A0E8, 0x98A99197, 0xF01CFFDC, 0x6251CEA3, 0x1F2DE139, 0x8D60D046,
+	0xCE473DAF, 0x5C0A0CD0, 0x2176234A, 0xB33B1235, 0xDB8E7C7E, 0x49C34D01, 0x34BF629B, 0xA6F253E4,
+	0xB2F0B949, 0x20BD8836, 0x5DC1A7AC, 0xCF8C96D3, 0xA739F898, 0x3574C9E7, 0x4808E67D, 0xDA45D702,
+	0x99623AEB, 0x0B2F0B94, 0x7653240E, 0xE41E1571, 0x8CAB7B3A, 0x1EE64A45, 0x639A65DF, 0xF1D754A0,
+	0x4B9FB085, 0xD9D281FA, 0xA4AEAE60, 0x36E39F1F, 0x5E56F154, 0xCC1BC02B, 0xB167EFB1, 0x232ADECE,
+	0x600D3327, 0xF2400258, 0x8F3C2DC2, 0x1D711CBD, 0x75C472F6, 0xE7894389, 0x9AF56C13, 0x08B85D6C,
+	0x1CBAB7C1, 0x8EF786BE, 0xF38BA924, 0x61C6985B, 0x0973F610, 0x9B3EC76F, 0xE642E8F5, 0x740FD98A,
+	0x37283463, 0xA565051C, 0xD8192A86, 0x4A541BF9, 0x22E175B2, 0xB0AC44CD, 0xCDD06B57, 0x5F9D5A28,
+	0x72EADF06, 0xE0A7EE79, 0x9DDBC1E3, 0x0F96F09C, 0x67239ED7, 0xF56EAFA8, 0x88128032, 0x1A5FB14D,
+	0x59785CA4, 0xCB356DDB, 0xB6494241, 0x2404733E, 0x4CB11D75, 0xDEFC2C0A, 0xA3800390, 0x31CD32EF,
+	0x25CFD842, 0xB782E93D, 0xCAFEC6A7, 0x58B3F7D8, 0x30069993, 0xA24BA8EC, 0xDF378776, 0x4D7AB609,
+	0x0E5D5BE0, 0x9C106A9F, 0xE16C4505, 0x7321747A, 0x1B941A31, 0x89D92B4E, 0xF4A504D4, 0x66E835AB,
+	0xDCA0D18E, 0x4EEDE0F1, 0x3391CF6B, 0xA1DCFE14, 0xC969905F, 0x5B24A120, 0x26588EBA, 0xB415BFC5,
+	0xF732522C, 0x657F6353, 0x18034CC9, 0x8A4E7DB6, 0xE2FB13FD, 0x70B62282, 0x0DCA0D18, 0x9F873C67,
+	0x8B85D6CA, 0x19C8E7B5, 0x64B4C82F, 0xF6F9F950, 0x9E4C971B, 0x0C01A664, 0x717D89FE, 0xE330B881,
+	0xA0175568, 0x325A6417, 0x4F264B8D, 0xDD6B7AF2, 0xB5DE14B9, 0x279325C6, 0x5AEF0A5C, 0xC8A23B23,
+	// Seed 0xCE
+	0x00000000, 0x4C23CFFB, 0x61FE4099, 0x2DDD8F62, 0x3A455E5D, 0x766691A6, 0x5BBB1EC4, 0x1798D13F,
+	0x748ABCBA, 0x38A97341, 0x1574FC23, 0x595733D8, 0x4ECFE2E7, 0x02EC2D1C, 0x2F31A27E, 0x63126D85,
+	0x10ACA61B, 0x5C8F69E0, 0x7152E682, 0x3D712979, 0x2AE9F846, 0x66CA37BD, 0x4B17B8DF, 0x07347724,
+	0x64261AA1, 0x2805D55A, 0x05D85A38, 0x49FB95C3, 0x5E6344FC, 0x12408B07, 0x3F9D0465, 0x73BECB9E,
+	0x21594C36, 0x6D7A83CD, 0x40A70CAF, 0x0C84C354, 0x1B1C126B, 0x573FDD90, 0x7AE252F2, 0x36C19D09,
+	0x55D3F08C, 0x19F03F77, 0x342DB015, 0x780E7FEE, 0x6F96AED1, 0x23B5612A, 0x0E68EE48, 0x424B21B3,
+	0x31F5EA2D, 0x7DD625D6, 0x500BAAB4, 0x1C28654F, 0x0BB0B470, 0x47937B8B, 0x6A4EF4E9, 0x266D3B12,
+	0x457F5697, 0x095C996C, 0x2481160E, 0x68A2D9F5, 0x7F3A08CA, 0x3319C731, 0x1EC44853, 0x52E787A8,
+	0x42B2986C, 0x0E915797, 0x234CD8F5, 0x6F6F170E, 0x78F7C631, 0x34D409CA, 0x190986A8, 0x552A4953,
+	0x363824D6, 0x7A1BEB2D, 0x57C6644F, 0x1BE5ABB4, 0x0C7D7A8B, 0x405EB570, 0x6D833A12, 0x21A0F5E9,
+	0x521E3E77, 0x1E3DF18C, 0x33E07EEE, 0x7FC3B115, 0x685B602A, 0x2478AFD1, 0x09A520B3, 0x4586EF48,
+	0x269482CD, 0x6AB74D36, 0x476AC254, 0x0B490DAF, 0x1CD1DC90, 0x50F2136B, 0x7D2F9C09, 0x310C53F2,
+	0x63EBD45A, 0x2FC81BA1, 0x021594C3, 0x4E365B38, 0x59AE8A07, 0x158D45FC, 0x3850CA9E, 0x74730565,
+	0x176168E0, 0x5B42A71B, 0x769F2879, 0x3ABCE782, 0x2D2436BD, 0x6107F946, 0x4CDA7624, 0x00F9B9DF,
+	0x73477241, 0x3F64BDBA, 0x12B932D8, 0x5E9AFD23, 0x49022C1C, 0x0521E3E7, 0x28FC6C85, 0x64DFA37E,
+	0x07CDCEFB, 0x4BEE0100, 0x66338E62, 0x2A104199, 0x3D8890A6, 0x71AB5F5D, 0x5C76D03F, 0x10551FC4,
+	0x7CDCEFB7, 0x30FF204C, 0x1D22AF2E, 0x510160D5, 0x4699B1EA, 0x0ABA7E11, 0x2767F173, 0x6B443E88,
+	0x0856530D, 0x44759CF6, 0x69A81394, 0x258BDC6F, 0x32130D50, 0x7E30C2AB, 0x53ED4DC9, 0x1FCE8232,
+	0x6C7049AC, 0x20538657, 0x0D8E0935, 0x41ADC6CE, 0x563517F1, 0x1A16D80A, 0x37CB5768, 0x7BE89893,
+	0x18FAF516, 0x54D93AED, 0x7904B58F, 0x35277A74, 0x22BFAB4B, 0x6E9C64B0, 0x4341EBD2, 0x0F622429,
+	0x5D85A381, 0x11A66C7A, 0x3C7BE318, 0x70582CE3, 0x67C0FDDC, 0x2BE33227, 0x063EBD45, 0x4A1D72BE,
+	0x290F1F3B, 0x652CD0C0, 0x48F15FA2, 0x04D29059, 0x134A4166, 0x5F698E9D, 0x72B401FF, 0x3E97CE04,
+	0x4D29059A, 0x010ACA61, 0x2CD74503, 0x60F48AF8, 0x776C5BC7, 0x3B4F943C, 0x16921B5E, 0x5AB1D4A5,
+	0x39A3B920, 0x758076DB, 0x585DF9B9, 0x147E3642, 0x03E6E77D, 0x4FC52886, 0x6218A7E4, 0x2E3B681F,
+	0x3E6E77DB, 0x724DB820, 0x5F903742, 0x13B3F8B9, 0x042B2986, 0x4808E67D, 0x65D5691F, 0x29F6A6E4,
+	0x4AE4CB61, 0x06C7049A, 0x2B1A8BF8, 0x67394403, 0x70A1953C, 0x3C825AC7, 0x115FD5A5, 0x5D7C1A5E,
+	0x2EC2D1C0, 0x62E11E3B, 0x4F3C9159, 0x031F5EA2, 0x14878F9D, 0x58A44066, 0x7579CF04, 0x395A00FF,
+	0x5A486D7A, 0x166BA281, 0x3BB62DE3, 0x7795E218, 0x600D3327, 0x2C2EFCDC, 0x01F373BE, 0x4DD0BC45,
+	0x1F373BED, 0x5314F416, 0x7EC97B74, 0x32EAB48F, 0x257265B0, 0x6951AA4B, 0x448C2529, 0x08AFEAD2,
+	0x6BBD8757, 0x279E48AC, 0x0A43C7CE, 0x46600835, 0x51F8D90A, 0x1DDB16F1, 0x30069993, 0x7C255668,
+	0x0F9B9DF6, 0x43B8520D, 0x6E65DD6F, 0x22461294, 0x35DEC3AB, 0x79FD0C50, 0x54208332, 0x18034CC9,
+	0x7B11214C, 0x3732EEB7, 0x1AEF61D5, 0x56CCAE2E, 0x41547F11, 0x0D77B0EA, 0x20AA3F88, 0x6C89F073,
+	// Seed 0xCF
+	0x00000000, 0x088DE8C4, 0x06AC6FCB, 0x0E21870F, 0x0D58DF96, 0x05D53752, 0x0BF4B05D, 0x03795899,
+	0x0D06016F, 0x058BE9AB, 0x0BAA6EA4, 0x03278660, 0x005EDEF9, 0x08D3363D, 0x06F2B132, 0x0E7F59F6,
+	0x0DBBBC9D, 0x05365459, 0x0B17D356, 0x039A3B92, 0x00E3630B, 0x086E8BCF, 0x064F0CC0, 0x0EC2E404,
+	0x00BDBDF2, 0x08305536, 0x0611D239, 0x0E9C3AFD, 0x0DE56264, 0x05688AA0, 0x0B490DAF, 0x03C4E56B,
+	0x0CC0C779, 0x044D2FBD, 0x0A6CA8B2, 0x02E14076, 0x019818EF, 0x0915F02B, 0x07347724, 0x0FB99FE0,
+	0x01C6C616, 0x094B2ED2, 0x076AA9DD, 0x0FE74119, 0x0C9E1980, 0x0413F144, 0x0A32764B, 0x02BF9E8F,
+	0x017B7BE4, 0x09F69320, 0x07D7142F, 0x0F5AFCEB, 0x0C23A472, 0x04AE4CB6, 0x0A8FCBB9, 0x0202237D,
+	0x0C7D7A8B, 0x04F0924F, 0x0AD11540, 0x025CFD84, 0x0125A51D, 0x09A84DD9, 0x0789CAD6, 0x0F042212,
+	0x0E3630B1, 0x06BBD875, 0x089A5F7A, 0x0017B7BE, 0x036EEF27, 0x0BE307E3, 0x05C280EC, 0x0D4F6828,
+	0x033031DE, 0x0BBDD91A, 0x059C5E15, 0x0D11B6D1, 0x0E68EE48, 0x06E5068C, 0x08C48183, 0x00496947,
+	0x038D8C2C, 0x0B0064E8, 0x0521E3E7, 0x0DAC0B23, 0x0ED553BA, 0x0658BB7E, 0x08793C71, 0x00F4D4B5,
+	0x0E8B8D43, 0x06066587, 0x0827E288, 0x00AA0A4C, 0x03D352D5, 0x0B5EBA11, 0x057F3D1E, 0x0DF2D5DA,
+	0x02F6F7C8, 0x0A7B1F0C, 0x045A9803, 0x0CD770C7, 0x0FAE285E, 0x0723C09A, 0x09024795, 0x018FAF51,
+	0x0FF0F6A7, 0x077D1E63, 0x095C996C, 0x01D171A8, 0x02A82931, 0x0A25C1F5, 0x040446FA, 0x0C89AE3E,
+	0x0F4D4B55, 0x07C0A391, 0x09E1249E, 0x016CCC5A, 0x021594C3, 0x0A987C07, 0x04B9FB08, 0x0C3413CC,
+	0x024B4A3A, 0x0AC6A2FE, 0x04E725F1, 0x0C6ACD35, 0x0F1395AC, 0x079E7D68, 0x09BFFA67, 0x013212A3,
+	0x0BDBDF21, 0x035637E5, 0x0D77B0EA, 0x05FA582E, 0x068300B7, 0x0E0EE873, 0x002F6F7C, 0x08A287B8,
+	0x06DDDE4E, 0x0E50368A, 0x0071B185, 0x08FC5941, 0x0B8501D8, 0x0308E91C, 0x0D296E13, 0x05A486D7,
+	0x066063BC, 0x0EED8B78, 0x00CC0C77, 0x0841E4B3, 0x0B38BC2A, 0x03B554EE, 0x0D94D3E1, 0x05193B25,
+	0x0B6662D3, 0x03EB8A17, 0x0DCA0D18, 0x0547E5DC, 0x063EBD45, 0x0EB35581, 0x0092D28E, 0x081F3A4A,
+	0x071B1858, 0x0F96F09C, 0x01B77793, 0x093A9F57, 0x0A43C7CE, 0x02CE2F0A, 0x0CEFA805, 0x046240C1,
+	0x0A1D1937, 0x0290F1F3, 0x0CB176FC, 0x043C9E38, 0x0745C6A1, 0x0FC82E65, 0x01E9A96A, 0x096441AE,
+	0x0AA0A4C5, 0x022D4C01, 0x0C0CCB0E, 0x048123CA, 0x07F87B53, 0x0F759397, 0x01541498, 0x09D9FC5C,
+	0x07A6A5AA, 0x0F2B4D6E, 0x010ACA61, 0x098722A5, 0x0AFE7A3C, 0x027392F8, 0x0C5215F7, 0x04DFFD33,
+	0x05EDEF90, 0x0D600754, 0x0341805B, 0x0BCC689F, 0x08B53006, 0x0038D8C2, 0x0E195FCD, 0x0694B709,
+	0x08EBEEFF, 0x0066063B, 0x0E478134, 0x06CA69F0, 0x05B33169, 0x0D3ED9AD, 0x031F5EA2, 0x0B92B666,
+	0x0856530D, 0x00DBBBC9, 0x0EFA3CC6, 0x0677D402, 0x050E8C9B, 0x0D83645F, 0x03A2E350, 0x0B2F0B94,
+	0x05505262, 0x0DDDBAA6, 0x03FC3DA9, 0x0B71D56D, 0x08088DF4, 0x00856530, 0x0EA4E23F, 0x06290AFB,
+	0x092D28E9, 0x01A0C02D, 0x0F814722, 0x070CAFE6, 0x0475F77F, 0x0CF81FBB, 0x02D998B4, 0x0A547070,
+	0x042B2986, 0x0CA6C142, 0x0287464D, 0x0A0AAE89, 0x0973F610, 0x01FE1ED4, 0x0FDF99DB, 0x0752711F,
+	0x04969474, 0x0C1B7CB0, 0x023AFBBF, 0x0AB7137B, 0x09CE4BE2, 0x0143A326, 0x0F622429, 0x07EFCCED,
+	0x0990951B, 0x011D7DDF, 0x0F3CFAD0, 0x07B11214, 0x04C84A8D, 0x0C45A249, 0x02642546, 0x0AE9CD82,
+	// Seed 0xD0
+	0x00000000, 0x6BBD8763, 0xD77B0EC6, 0xBCC689A5, 0xA351B8A5, 0xC8EC3FC6, 0x742AB663, 0x1F973100,
+	0x4B04D463, 0x20B95300, 0x9C7FDAA5, 0xF7C25DC6, 0xE8556CC6, 0x83E8EBA5, 0x3F2E6200, 0x5493E563,
+	0x9609A8C6, 0xFDB42FA5, 0x4172A600, 0x2ACF2163, 0x35581063, 0x5EE59700, 0xE2231EA5, 0x899E99C6,
+	0xDD0D7CA5, 0xB6B0FBC6, 0x0A767263, 0x61CBF500, 0x7E5CC400, 0x15E14363, 0xA927CAC6, 0xC29A4DA5,
+	0x21B4F4A5, 0x4A0973C6, 0xF6CFFA63, 0x9D727D00, 0x82E54C00, 0xE958CB63, 0x559E42C6, 0x3E23C5A5,
+	0x6AB020C6, 0x010DA7A5, 0xBDCB2E00, 0xD676A963, 0xC9E19863, 0xA25C1F00, 0x1E9A96A5, 0x752711C6,
+	0xB7BD5C63, 0xDC00DB00, 0x60C652A5, 0x0B7BD5C6, 0x14ECE4C6, 0x7F5163A5, 0xC397EA00, 0xA82A6D63,
+	0xFCB98800, 0x97040F63, 0x2BC286C6, 0x407F01A5, 0x5FE830A5, 0x3455B7C6, 0x88933E63, 0xE32EB900,
+	0x4369E94A, 0x28D46E29, 0x9412E78C, 0xFFAF60EF, 0xE03851EF, 0x8B85D68C, 0x37435F29, 0x5CFED84A,
+	0x086D3D29, 0x63D0BA4A, 0xDF1633EF, 0xB4ABB48C, 0xAB3C858C, 0xC08102EF, 0x7C478B4A, 0x17FA0C29,
+	0xD560418C, 0xBEDDC6EF, 0x021B4F4A, 0x69A6C829, 0x7631F929, 0x1D8C7E4A, 0xA14AF7EF, 0xCAF7708C,
+	0x9E6495EF, 0xF5D9128C, 0x491F9B29, 0x22A21C4A, 0x3D352D4A, 0x5688AA29, 0xEA4E238C, 0x81F3A4EF,
+	0x62DD1DEF, 0x09609A8C, 0xB5A61329, 0xDE1B944A, 0xC18CA54A, 0xAA312229, 0x16F7AB8C, 0x7D4A2CEF,
+	0x29D9C98C, 0x42644EEF, 0xFEA2C74A, 0x951F4029, 0x8A887129, 0xE135F64A, 0x5DF37FEF, 0x364EF88C,
+	0xF4D4B529, 0x9F69324A, 0x23AFBBEF, 0x48123C8C, 0x57850D8C, 0x3C388AEF, 0x80FE034A, 0xEB438429,
+	0xBFD0614A, 0xD46DE629, 0x68AB6F8C, 0x0316E8EF, 0x1C81D9EF, 0x773C5E8C, 0xCBFAD729, 0xA047504A,
+	0x86D3D294, 0xED6E55F7, 0x51A8DC52, 0x3A155B31, 0x25826A31, 0x4E3FED52, 0xF2F964F7, 0x9944E394,
+	0xCDD706F7, 0xA66A8194, 0x1AAC0831, 0x71118F52, 0x6E86BE52, 0x053B3931, 0xB9FDB094, 0xD24037F7,
+	0x10DA7A52, 0x7B67FD31, 0xC7A17494, 0xAC1CF3F7, 0xB38BC2F7, 0xD8364594, 0x64F0CC31, 0x0F4D4B52,
+	0x5BDEAE31, 0x30632952, 0x8CA5A0F7, 0xE7182794, 0xF88F1694, 0x933291F7, 0x2FF41852, 0x44499F31,
+	0xA7672631, 0xCCDAA152, 0x701C28F7, 0x1BA1AF94, 0x04369E94, 0x6F8B19F7, 0xD34D9052, 0xB8F01731,
+	0xEC63F252, 0x87DE7531, 0x3B18FC94, 0x50A57BF7, 0x4F324AF7, 0x248FCD94, 0x98494431, 0xF3F4C352,
+	0x316E8EF7, 0x5AD30994, 0xE6158031, 0x8DA80752, 0x923F3652, 0xF982B131, 0x45443894, 0x2EF9BFF7,
+	0x7A6A5A94, 0x11D7DDF7, 0xAD115452, 0xC6ACD331, 0xD93BE231, 0xB2866552, 0x0E40ECF7, 0x65FD6B94,
+	0xC5BA3BDE, 0xAE07BCBD, 0x12C13518, 0x797CB27B, 0x66EB837B, 0x0D560418, 0xB1908DBD, 0xDA2D0ADE,
+	0x8EBEEFBD, 0xE50368DE, 0x59C5E17B, 0x32786618, 0x2DEF5718, 0x4652D07B, 0xFA9459DE, 0x9129DEBD,
+	0x53B39318, 0x380E147B, 0x84C89DDE, 0xEF751ABD, 0xF0E22BBD, 0x9B5FACDE, 0x2799257B, 0x4C24A218,
+	0x18B7477B, 0x730AC018, 0xCFCC49BD, 0xA471CEDE, 0xBBE6FFDE, 0xD05B78BD, 0x6C9DF118, 0x0720767B,
+	0xE40ECF7B, 0x8FB34818, 0x3375C1BD, 0x58C846DE, 0x475F77DE, 0x2CE2F0BD, 0x90247918, 0xFB99FE7B,
+	0xAF0A1B18, 0xC4B79C7B, 0x787115DE, 0x13CC92BD, 0x0C5BA3BD, 0x67E624DE, 0xDB20AD7B, 0xB09D2A18,
+	0x720767BD, 0x19BAE0DE, 0xA57C697B, 0xCEC1EE18, 0xD156DF18, 0xBAEB587B, 0x062DD1DE, 0x6D9056BD,
+	0x3903B3DE, 0x52BE34BD, 0xEE78BD18, 0x85C53A7B, 0x9A520B7B, 0xF1EF8C18, 0x4D2905BD, 0x269482DE,
+	// Seed 0xD1
+	0x00000000, 0x916901FD, 0xC17BC77F, 0x5012C682, 0x615E4A7B, 0xF0374B86, 0xA0258D04, 0x314C8CF9,
+	0xC2BC94F6, 0x53D5950B, 0x03C75389, 0x92AE5274, 0xA3E2DE8D, 0x328BDF70, 0x629919F2, 0xF3F0180F,
+	0x66D0ED69, 0xF7B9EC94, 0xA7AB2A16, 0x36C22BEB, 0x078EA712, 0x96E7A6EF, 0xC6F5606D, 0x579C6190,
+	0xA46C799F, 0x35057862, 0x6517BEE0, 0xF47EBF1D, 0xC53233E4, 0x545B3219, 0x0449F49B, 0x9520F566,
+	0xCDA1DAD2, 0x5CC8DB2F, 0x0CDA1DAD, 0x9DB31C50, 0xACFF90A9, 0x3D969154, 0x6D8457D6, 0xFCED562B,
+	0x0F1D4E24, 0x9E744FD9, 0xCE66895B, 0x5F0F88A6, 0x6E43045F, 0xFF2A05A2, 0xAF38C320, 0x3E51C2DD,
+	0xAB7137BB, 0x3A183646, 0x6A0AF0C4, 0xFB63F139, 0xCA2F7DC0, 0x5B467C3D, 0x0B54BABF, 0x9A3DBB42,
+	0x69CDA34D, 0xF8A4A2B0, 0xA8B66432, 0x39DF65CF, 0x0893E936, 0x99FAE8CB, 0xC9E82E49, 0x58812FB4,
+	0x78EA7121, 0xE98370DC, 0xB991B65E, 0x28F8B7A3, 0x19B43B5A, 0x88DD3AA7, 0xD8CFFC25, 0x49A6FDD8,
+	0xBA56E5D7, 0x2B3FE42A, 0x7B2D22A8, 0xEA442355, 0xDB08AFAC, 0x4A61AE51, 0x1A7368D3, 0x8B1A692E,
+	0x1E3A9C48, 0x8F539DB5, 0xDF415B37, 0x4E285ACA, 0x7F64D633, 0xEE0DD7CE, 0xBE1F114C, 0x2F7610B1,
+	0xDC8608BE, 0x4DEF0943, 0x1DFDCFC1, 0x8C94CE3C, 0xBDD842C5, 0x2CB14338, 0x7CA385BA, 0xEDCA8447,
+	0xB54BABF3, 0x2422AA0E, 0x74306C8C, 0xE5596D71, 0xD415E188, 0x457CE075, 0x156E26F7, 0x8407270A,
+	0x77F73F05, 0xE69E3EF8, 0xB68CF87A, 0x27E5F987, 0x16A9757E, 0x87C07483, 0xD7D2B201, 0x46BBB3FC,
+	0xD39B469A, 0x42F24767, 0x12E081E5, 0x83898018, 0xB2C50CE1, 0x23AC0D1C, 0x73BECB9E, 0xE2D7CA63,
+	0x1127D26C, 0x804ED391, 0xD05C1513, 0x413514EE, 0x70799817, 0xE11099EA, 0xB1025F68, 0x206B5E95,
+	0xF1D4E242, 0x60BDE3BF, 0x30AF253D, 0xA1C624C0, 0x908AA839, 0x01E3A9C4, 0x51F16F46, 0xC0986EBB,
+	0x336876B4, 0xA2017749, 0xF213B1CB, 0x637AB036, 0x52363CCF, 0xC35F3D32, 0x934DFBB0, 0x0224FA4D,
+	0x97040F2B, 0x066D0ED6, 0x567FC854, 0xC716C9A9, 0xF65A4550, 0x673344AD, 0x3721822F, 0xA64883D2,
+	0x55B89BDD, 0xC4D19A20, 0x94C35CA2, 0x05AA5D5F, 0x34E6D1A6, 0xA58FD05B, 0xF59D16D9, 0x64F41724,
+	0x3C753890, 0xAD1C396D, 0xFD0EFFEF, 0x6C67FE12, 0x5D2B72EB, 0xCC427316, 0x9C50B594, 0x0D39B469,
+	0xFEC9AC66, 0x6FA0AD9B, 0x3FB26B19, 0xAEDB6AE4, 0x9F97E61D, 0x0EFEE7E0, 0x5EEC2162, 0xCF85209F,
+	0x5AA5D5F9, 0xCBCCD404, 0x9BDE1286, 0x0AB7137B, 0x3BFB9F82, 0xAA929E7F, 0xFA8058FD, 0x6BE95900,
+	0x9819410F, 0x097040F2, 0x59628670, 0xC80B878D, 0xF9470B74, 0x682E0A89, 0x383CCC0B, 0xA955CDF6,
+	0x893E9363, 0x1857929E, 0x4845541C, 0xD92C55E1, 0xE860D918, 0x7909D8E5, 0x291B1E67, 0xB8721F9A,
+	0x4B820795, 0xDAEB0668, 0x8AF9C0EA, 0x1B90C117, 0x2ADC4DEE, 0xBBB54C13, 0xEBA78A91, 0x7ACE8B6C,
+	0xEFEE7E0A, 0x7E877FF7, 0x2E95B975, 0xBFFCB888, 0x8EB03471, 0x1FD9358C, 0x4FCBF30E, 0xDEA2F2F3,
+	0x2D52EAFC, 0xBC3BEB01, 0xEC292D83, 0x7D402C7E, 0x4C0CA087, 0xDD65A17A, 0x8D7767F8, 0x1C1E6605,
+	0x449F49B1, 0xD5F6484C, 0x85E48ECE, 0x148D8F33, 0x25C103CA, 0xB4A80237, 0xE4BAC4B5, 0x75D3C548,
+	0x8623DD47, 0x174ADCBA, 0x47581A38, 0xD6311BC5, 0xE77D973C, 0x761496C1, 0x26065043, 0xB76F51BE,
+	0x224FA4D8, 0xB326A525, 0xE33463A7, 0x725D625A, 0x4311EEA3, 0xD278EF5E, 0x826A29DC, 0x13032821,
+	0xE0F3302E, 0x719A31D3, 0x2188F751, 0xB0E1F6AC, 0x81AD7A55, 0x10C47BA8, 0x40D6BD2A, 0xD1BFBCD7,
+	// Seed 0xD2
+	0x00000000, 0x4B4E0BE2, 0x47277035, 0x0C697BD7, 0x5FF5879B, 0x14BB8C79, 0x18D2F7AE, 0x539CFC4C,
+	0x6E5068C7, 0x251E6325, 0x297718F2, 0x62391310, 0x31A5EF5C, 0x7AEBE4BE, 0x76829F69, 0x3DCC948B,
+	0x0D1BB67F, 0x4655BD9D, 0x4A3CC64A, 0x0172CDA8, 0x52EE31E4, 0x19A03A06, 0x15C941D1, 0x5E874A33,
+	0x634BDEB8, 0x2805D55A, 0x246CAE8D, 0x6F22A56F, 0x3CBE5923, 0x77F052C1, 0x7B992916, 0x30D722F4,
+	0x1A376CFE, 0x5179671C, 0x5D101CCB, 0x165E1729, 0x45C2EB65, 0x0E8CE087, 0x02E59B50, 0x49AB90B2,
+	0x74670439, 0x3F290FDB, 0x3340740C, 0x780E7FEE, 0x2B9283A2, 0x60DC8840, 0x6CB5F397, 0x27FBF875,
+	0x172CDA81, 0x5C62D163, 0x500BAAB4, 0x1B45A156, 0x48D95D1A, 0x039756F8, 0x0FFE2D2F, 0x44B026CD,
+	0x797CB246, 0x3232B9A4, 0x3E5BC273, 0x7515C991, 0x268935DD, 0x6DC73E3F, 0x61AE45E8, 0x2AE04E0A,
+	0x346ED9FC, 0x7F20D21E, 0x7349A9C9, 0x3807A22B, 0x6B9B5E67, 0x20D55585, 0x2CBC2E52, 0x67F225B0,
+	0x5A3EB13B, 0x1170BAD9, 0x1D19C10E, 0x5657CAEC, 0x05CB36A0, 0x4E853D42, 0x42EC4695, 0x09A24D77,
+	0x39756F83, 0x723B6461, 0x7E521FB6, 0x351C1454, 0x6680E818, 0x2DCEE3FA, 0x21A7982D, 0x6AE993CF,
+	0x57250744, 0x1C6B0CA6, 0x10027771, 0x5B4C7C93, 0x08D080DF, 0x439E8B3D, 0x4FF7F0EA, 0x04B9FB08,
+	0x2E59B502, 0x6517BEE0, 0x697EC537, 0x2230CED5, 0x71AC3299, 0x3AE2397B, 0x368B42AC, 0x7DC5494E,
+	0x4009DDC5, 0x0B47D627, 0x072EADF0, 0x4C60A612, 0x1FFC5A5E, 0x54B251BC, 0x58DB2A6B, 0x13952189,
+	0x2342037D, 0x680C089F, 0x64657348, 0x2F2B78AA, 0x7CB784E6, 0x37F98F04, 0x3B90F4D3, 0x70DEFF31,
+	0x4D126BBA, 0x065C6058, 0x0A351B8F, 0x417B106D, 0x12E7EC21, 0x59A9E7C3, 0x55C09C14, 0x1E8E97F6,
+	0x68DDB3F8, 0x2393B81A, 0x2FFAC3CD, 0x64B4C82F, 0x37283463, 0x7C663F81, 0x700F4456, 0x3B414FB4,
+	0x068DDB3F, 0x4DC3D0DD, 0x41AAAB0A, 0x0AE4A0E8, 0x59785CA4, 0x12365746, 0x1E5F2C91, 0x55112773,
+	0x65C60587, 0x2E880E65, 0x22E175B2, 0x69AF7E50, 0x3A33821C, 0x717D89FE, 0x7D14F229, 0x365AF9CB,
+	0x0B966D40, 0x40D866A2, 0x4CB11D75, 0x07FF1697, 0x5463EADB, 0x1F2DE139, 0x13449AEE, 0x580A910C,
+	0x72EADF06, 0x39A4D4E4, 0x35CDAF33, 0x7E83A4D1, 0x2D1F589D, 0x6651537F, 0x6A3828A8, 0x2176234A,
+	0x1CBAB7C1, 0x57F4BC23, 0x5B9DC7F4, 0x10D3CC16, 0x434F305A, 0x08013BB8, 0x0468406F, 0x4F264B8D,
+	0x7FF16979, 0x34BF629B, 0x38D6194C, 0x739812AE, 0x2004EEE2, 0x6B4AE500, 0x67239ED7, 0x2C6D9535,
+	0x11A101BE, 0x5AEF0A5C, 0x5686718B, 0x1DC87A69, 0x4E548625, 0x051A8DC7, 0x0973F610, 0x423DFDF2,
+	0x5CB36A04, 0x17FD61E6, 0x1B941A31, 0x50DA11D3, 0x0346ED9F, 0x4808E67D, 0x44619DAA, 0x0F2F9648,
+	0x32E302C3, 0x79AD0921, 0x75C472F6, 0x3E8A7914, 0x6D168558, 0x26588EBA, 0x2A31F56D, 0x617FFE8F,
+	0x51A8DC7B, 0x1AE6D799, 0x168FAC4E, 0x5DC1A7AC, 0x0E5D5BE0, 0x45135002, 0x497A2BD5, 0x02342037,
+	0x3FF8B4BC, 0x74B6BF5E, 0x78DFC489, 0x3391CF6B, 0x600D3327, 0x2B4338C5, 0x272A4312, 0x6C6448F0,
+	0x468406FA, 0x0DCA0D18, 0x01A376CF, 0x4AED7D2D, 0x19718161, 0x523F8A83, 0x5E56F154, 0x1518FAB6,
+	0x28D46E3D, 0x639A65DF, 0x6FF31E08, 0x24BD15EA, 0x7721E9A6, 0x3C6FE244, 0x30069993, 0x7B489271,
+	0x4B9FB085, 0x00D1BB67, 0x0CB8C0B0, 0x47F6CB52, 0x146A371E, 0x5F243CFC, 0x534D472B, 0x18034CC9,
+	0x25CFD842, 0x6E81D3A0, 0x62E8A877, 0x29A6A395, 0x7A3A5FD9, 0x3174543B, 0x3D1D2FEC, 0x7653240E,
+	// Seed 0xD3
+	0x00000000, 0x0ED1889C, 0x1DA31138, 0x137299A4, 0x04F324AD, 0x0A22AC31, 0x19503595, 0x1781BD09,
+	0x09E6495A, 0x0737C1C6, 0x14455862, 0x1A94D0FE, 0x0D156DF7, 0x03C4E56B, 0x10B67CCF, 0x1E67F453,
+	0x13CC92B4, 0x1D1D1A28, 0x0E6F838C, 0x00BE0B10, 0x173FB619, 0x19EE3E85, 0x0A9CA721, 0x044D2FBD,
+	0x1A2ADBEE, 0x14FB5372, 0x0789CAD6, 0x0958424A, 0x1ED9FF43, 0x100877DF, 0x037AEE7B, 0x0DAB66E7,
+	0x182C23B5, 0x16FDAB29, 0x058F328D, 0x0B5EBA11, 0x1CDF0718, 0x120E8F84, 0x017C1620, 0x0FAD9EBC,
+	0x11CA6AEF, 0x1F1BE273, 0x0C697BD7, 0x02B8F34B, 0x15394E42, 0x1BE8C6DE, 0x089A5F7A, 0x064BD7E6,
+	0x0BE0B101, 0x0531399D, 0x1643A039, 0x189228A5, 0x0F1395AC, 0x01C21D30, 0x12B08494, 0x1C610C08,
+	0x0206F85B, 0x0CD770C7, 0x1FA5E963, 0x117461FF, 0x06F5DCF6, 0x0824546A, 0x1B56CDCE, 0x15874552,
+	0x0FED41B7, 0x013CC92B, 0x124E508F, 0x1C9FD813, 0x0B1E651A, 0x05CFED86, 0x16BD7422, 0x186CFCBE,
+	0x060B08ED, 0x08DA8071, 0x1BA819D5, 0x15799149, 0x02F82C40, 0x0C29A4DC, 0x1F5B3D78, 0x118AB5E4,
+	0x1C21D303, 0x12F05B9F, 0x0182C23B, 0x0F534AA7, 0x18D2F7AE, 0x16037F32, 0x0571E696, 0x0BA06E0A,
+	0x15C79A59, 0x1B1612C5, 0x08648B61, 0x06B503FD, 0x1134BEF4, 0x1FE53668, 0x0C97AFCC, 0x02462750,
+	0x17C16202, 0x1910EA9E, 0x0A62733A, 0x04B3FBA6, 0x133246AF, 0x1DE3CE33, 0x0E915797, 0x0040DF0B,
+	0x1E272B58, 0x10F6A3C4, 0x03843A60, 0x0D55B2FC, 0x1AD40FF5, 0x14058769, 0x07771ECD, 0x09A69651,
+	0x040DF0B6, 0x0ADC782A, 0x19AEE18E, 0x177F6912, 0x00FED41B, 0x0E2F5C87, 0x1D5DC523, 0x138C4DBF,
+	0x0DEBB9EC, 0x033A3170, 0x1048A8D4, 0x1E992048, 0x09189D41, 0x07C915DD, 0x14BB8C79, 0x1A6A04E5,
+	0x1FDA836E, 0x110B0BF2, 0x02799256, 0x0CA81ACA, 0x1B29A7C3, 0x15F82F5F, 0x068AB6FB, 0x085B3E67,
+	0x163CCA34, 0x18ED42A8, 0x0B9FDB0C, 0x054E5390, 0x12CFEE99, 0x1C1E6605, 0x0F6CFFA1, 0x01BD773D,
+	0x0C1611DA, 0x02C79946, 0x11B500E2, 0x1F64887E, 0x08E53577, 0x0634BDEB, 0x1546244F, 0x1B97ACD3,
+	0x05F05880, 0x0B21D01C, 0x185349B8, 0x1682C124, 0x01037C2D, 0x0FD2F4B1, 0x1CA06D15, 0x1271E589,
+	0x07F6A0DB, 0x09272847, 0x1A55B1E3, 0x1484397F, 0x03058476, 0x0DD40CEA, 0x1EA6954E, 0x10771DD2,
+	0x0E10E981, 0x00C1611D, 0x13B3F8B9, 0x1D627025, 0x0AE3CD2C, 0x043245B0, 0x1740DC14, 0x19915488,
+	0x143A326F, 0x1AEBBAF3, 0x09992357, 0x0748ABCB, 0x10C916C2, 0x1E189E5E, 0x0D6A07FA, 0x03BB8F66,
+	0x1DDC7B35, 0x130DF3A9, 0x007F6A0D, 0x0EAEE291, 0x192F5F98, 0x17FED704, 0x048C4EA0, 0x0A5DC63C,
+	0x1037C2D9, 0x1EE64A45, 0x0D94D3E1, 0x03455B7D, 0x14C4E674, 0x1A156EE8, 0x0967F74C, 0x07B67FD0,
+	0x19D18B83, 0x1700031F, 0x04729ABB, 0x0AA31227, 0x1D22AF2E, 0x13F327B2, 0x0081BE16, 0x0E50368A,
+	0x03FB506D, 0x0D2AD8F1, 0x1E584155, 0x1089C9C9, 0x070874C0, 0x09D9FC5C, 0x1AAB65F8, 0x147AED64,
+	0x0A1D1937, 0x04CC91AB, 0x17BE080F, 0x196F8093, 0x0EEE3D9A, 0x003FB506, 0x134D2CA2, 0x1D9CA43E,
+	0x081BE16C, 0x06CA69F0, 0x15B8F054, 0x1B6978C8, 0x0CE8C5C1, 0x02394D5D, 0x114BD4F9, 0x1F9A5C65,
+	0x01FDA836, 0x0F2C20AA, 0x1C5EB90E, 0x128F3192, 0x050E8C9B, 0x0BDF0407, 0x18AD9DA3, 0x167C153F,
+	0x1BD773D8, 0x1506FB44, 0x067462E0, 0x08A5EA7C, 0x1F245775, 0x11F5DFE9, 0x0287464D, 0x0C56CED1,
+	0x12313A82, 0x1CE0B21E, 0x0F922BBA, 0x0143A326, 0x16C21E2F, 0x181396B3, 0x0B610F17, 0x05B0878B,
+	// Seed 0xD4
+	0x00000000, 0x47D77FA6, 0x8FAEFF4C, 0xC87980EA, 0x1C21D303, 0x5BF6ACA5, 0x938F2C4F, 0xD45853E9,
+	0x3843A606, 0x7F94D9A0, 0xB7ED594A, 0xF03A26EC, 0x24627505, 0x63B50AA3, 0xABCC8A49, 0xEC1BF5EF,
+	0x70874C0C, 0x375033AA, 0xFF29B340, 0xB8FECCE6, 0x6CA69F0F, 0x2B71E0A9, 0xE3086043, 0xA4DF1FE5,
+	0x48C4EA0A, 0x0F1395AC, 0xC76A1546, 0x80BD6AE0, 0x54E53909, 0x133246AF, 0xDB4BC645, 0x9C9CB9E3,
+	0xE10E9818, 0xA6D9E7BE, 0x6EA06754, 0x297718F2, 0xFD2F4B1B, 0xBAF834BD, 0x7281B457, 0x3556CBF1,
+	0xD94D3E1E, 0x9E9A41B8, 0x56E3C152, 0x1134BEF4, 0xC56CED1D, 0x82BB92BB, 0x4AC21251, 0x0D156DF7,
+	0x9189D414, 0xD65EABB2, 0x1E272B58, 0x59F054FE, 0x8DA80717, 0xCA7F78B1, 0x0206F85B, 0x45D187FD,
+	0xA9CA7212, 0xEE1D0DB4, 0x26648D5E, 0x61B3F2F8, 0xB5EBA111, 0xF23CDEB7, 0x3A455E5D, 0x7D9221FB,
+	0xC1611DAB, 0x86B6620D, 0x4ECFE2E7, 0x09189D41, 0xDD40CEA8, 0x9A97B10E, 0x52EE31E4, 0x15394E42,
+	0xF922BBAD, 0xBEF5C40B, 0x768C44E1, 0x315B3B47, 0xE50368AE, 0xA2D41708, 0x6AAD97E2, 0x2D7AE844,
+	0xB1E651A7, 0xF6312E01, 0x3E48AEEB, 0x799FD14D, 0xADC782A4, 0xEA10FD02, 0x22697DE8, 0x65BE024E,
+	0x89A5F7A1, 0xCE728807, 0x060B08ED, 0x41DC774B, 0x958424A2, 0xD2535B04, 0x1A2ADBEE, 0x5DFDA448,
+	0x206F85B3, 0x67B8FA15, 0xAFC17AFF, 0xE8160559, 0x3C4E56B0, 0x7B992916, 0xB3E0A9FC, 0xF437D65A,
+	0x182C23B5, 0x5FFB5C13, 0x9782DCF9, 0xD055A35F, 0x040DF0B6, 0x43DA8F10, 0x8BA30FFA, 0xCC74705C,
+	0x50E8C9BF, 0x173FB619, 0xDF4636F3, 0x98914955, 0x4CC91ABC, 0x0B1E651A, 0xC367E5F0, 0x84B09A56,
+	0x68AB6FB9, 0x2F7C101F, 0xE70590F5, 0xA0D2EF53, 0x748ABCBA, 0x335DC31C, 0xFB2443F6, 0xBCF33C50,
+	0x81BE16CD, 0xC669696B, 0x0E10E981, 0x49C79627, 0x9D9FC5CE, 0xDA48BA68, 0x12313A82, 0x55E64524,
+	0xB9FDB0CB, 0xFE2ACF6D, 0x36534F87, 0x71843021, 0xA5DC63C8, 0xE20B1C6E, 0x2A729C84, 0x6DA5E322,
+	0xF1395AC1, 0xB6EE2567, 0x7E97A58D, 0x3940DA2B, 0xED1889C2, 0xAACFF664, 0x62B6768E, 0x25610928,
+	0xC97AFCC7, 0x8EAD8361, 0x46D4038B, 0x01037C2D, 0xD55B2FC4, 0x928C5062, 0x5AF5D088, 0x1D22AF2E,
+	0x60B08ED5, 0x2767F173, 0xEF1E7199, 0xA8C90E3F, 0x7C915DD6, 0x3B462270, 0xF33FA29A, 0xB4E8DD3C,
+	0x58F328D3, 0x1F245775, 0xD75DD79F, 0x908AA839, 0x44D2FBD0, 0x03058476, 0xCB7C049C, 0x8CAB7B3A,
+	0x1037C2D9, 0x57E0BD7F, 0x9F993D95, 0xD84E4233, 0x0C1611DA, 0x4BC16E7C, 0x83B8EE96, 0xC46F9130,
+	0x287464DF, 0x6FA31B79, 0xA7DA9B93, 0xE00DE435, 0x3455B7DC, 0x7382C87A, 0xBBFB4890, 0xFC2C3736,
+	0x40DF0B66, 0x070874C0, 0xCF71F42A, 0x88A68B8C, 0x5CFED865, 0x1B29A7C3, 0xD3502729, 0x9487588F,
+	0x789CAD60, 0x3F4BD2C6, 0xF732522C, 0xB0E52D8A, 0x64BD7E63, 0x236A01C5, 0xEB13812F, 0xACC4FE89,
+	0x3058476A, 0x778F38CC, 0xBFF6B826, 0xF821C780, 0x2C799469, 0x6BAEEBCF, 0xA3D76B25, 0xE4001483,
+	0x081BE16C, 0x4FCC9ECA, 0x87B51E20, 0xC0626186, 0x143A326F, 0x53ED4DC9, 0x9B94CD23, 0xDC43B285,
+	0xA1D1937E, 0xE606ECD8, 0x2E7F6C32, 0x69A81394, 0xBDF0407D, 0xFA273FDB, 0x325EBF31, 0x7589C097,
+	0x99923578, 0xDE454ADE, 0x163CCA34, 0x51EBB592, 0x85B3E67B, 0xC26499DD, 0x0A1D1937, 0x4DCA6691,
+	0xD156DF72, 0x9681A0D4, 0x5EF8203E, 0x192F5F98, 0xCD770C71, 0x8AA073D7, 0x42D9F33D, 0x050E8C9B,
+	0xE9157974, 0xAEC206D2, 0x66BB8638, 0x216CF99E, 0xF534AA77, 0xB2E3D5D1, 0x7A9A553B, 0x3D4D2A9D,
+	// Seed 0xD5
+	0x00000000, 0xC64B6B7D, 0x61E49A4D, 0xA7AFF130, 0xC3C9349A, 0x05825FE7, 0xA22DAED7, 0x6466C5AA,
+	0x6AE02583, 0xACAB4EFE, 0x0B04BFCE, 0xCD4FD4B3, 0xA9291119, 0x6F627A64, 0xC8CD8B54, 0x0E86E029,
+	0xD5C04B06, 0x138B207B, 0xB424D14B, 0x726FBA36, 0x16097F9C, 0xD04214E1, 0x77EDE5D1, 0xB1A68EAC,
+	0xBF206E85, 0x796B05F8, 0xDEC4F4C8, 0x188F9FB5, 0x7CE95A1F, 0xBAA23162, 0x1D0DC052, 0xDB46AB2F,
+	0x46F2DABB, 0x80B9B1C6, 0x271640F6, 0xE15D2B8B, 0x853BEE21, 0x4370855C, 0xE4DF746C, 0x22941F11,
+	0x2C12FF38, 0xEA599445, 0x4DF66575, 0x8BBD0E08, 0xEFDBCBA2, 0x2990A0DF, 0x8E3F51EF, 0x48743A92,
+	0x933291BD, 0x5579FAC0, 0xF2D60BF0, 0x349D608D, 0x50FBA527, 0x96B0CE5A, 0x311F3F6A, 0xF7545417,
+	0xF9D2B43E, 0x3F99DF43, 0x98362E73, 0x5E7D450E, 0x3A1B80A4, 0xFC50EBD9, 0x5BFF1AE9, 0x9DB47194,
+	0x8DE5B576, 0x4BAEDE0B, 0xEC012F3B, 0x2A4A4446, 0x4E2C81EC, 0x8867EA91, 0x2FC81BA1, 0xE98370DC,
+	0xE70590F5, 0x214EFB88, 0x86E10AB8, 0x40AA61C5, 0x24CCA46F, 0xE287CF12, 0x45283E22, 0x8363555F,
+	0x5825FE70, 0x9E6E950D, 0x39C1643D, 0xFF8A0F40, 0x9BECCAEA, 0x5DA7A197, 0xFA0850A7, 0x3C433BDA,
+	0x32C5DBF3, 0xF48EB08E, 0x532141BE, 0x956A2AC3, 0xF10CEF69, 0x37478414, 0x90E87524, 0x56A31E59,
+	0xCB176FCD, 0x0D5C04B0, 0xAAF3F580, 0x6CB89EFD, 0x08DE5B57, 0xCE95302A, 0x693AC11A, 0xAF71AA67,
+	0xA1F74A4E, 0x67BC2133, 0xC013D003, 0x0658BB7E, 0x623E7ED4, 0xA47515A9, 0x03DAE499, 0xC5918FE4,
+	0x1ED724CB, 0xD89C4FB6, 0x7F33BE86, 0xB978D5FB, 0xDD1E1051, 0x1B557B2C, 0xBCFA8A1C, 0x7AB1E161,
+	0x74370148, 0xB27C6A35, 0x15D39B05, 0xD398F078, 0xB7FE35D2, 0x71B55EAF, 0xD61AAF9F, 0x1051C4E2,
+	0xF6B9265B, 0x30F24D26, 0x975DBC16, 0x5116D76B, 0x357012C1, 0xF33B79BC, 0x5494888C, 0x92DFE3F1,
+	0x9C5903D8, 0x5A1268A5, 0xFDBD9995, 0x3BF6F2E8, 0x5F903742, 0x99DB5C3F, 0x3E74AD0F, 0xF83FC672,
+	0x23796D5D, 0xE5320620, 0x429DF710, 0x84D69C6D, 0xE0B059C7, 0x26FB32BA, 0x8154C38A, 0x471FA8F7,
+	0x499948DE, 0x8FD223A3, 0x287DD293, 0xEE36B9EE, 0x8A507C44, 0x4C1B1739, 0xEBB4E609, 0x2DFF8D74,
+	0xB04BFCE0, 0x7600979D, 0xD1AF66AD, 0x17E40DD0, 0x7382C87A, 0xB5C9A307, 0x12665237, 0xD42D394A,
+	0xDAABD963, 0x1CE0B21E, 0xBB4F432E, 0x7D042853, 0x1962EDF9, 0xDF298684, 0x788677B4, 0xBECD1CC9,
+	0x658BB7E6, 0xA3C0DC9B, 0x046F2DAB, 0xC22446D6, 0xA642837C, 0x6009E801, 0xC7A61931, 0x01ED724C,
+	0x0F6B9265, 0xC920F918, 0x6E8F0828, 0xA8C46355, 0xCCA2A6FF, 0x0AE9CD82, 0xAD463CB2, 0x6B0D57CF,
+	0x7B5C932D, 0xBD17F850, 0x1AB80960, 0xDCF3621D, 0xB895A7B7, 0x7EDECCCA, 0xD9713DFA, 0x1F3A5687,
+	0x11BCB6AE, 0xD7F7DDD3, 0x70582CE3, 0xB613479E, 0xD2758234, 0x143EE949, 0xB3911879, 0x75DA7304,
+	0xAE9CD82B, 0x68D7B356, 0xCF784266, 0x0933291B, 0x6D55ECB1, 0xAB1E87CC, 0x0CB176FC, 0xCAFA1D81,
+	0xC47CFDA8, 0x023796D5, 0xA59867E5, 0x63D30C98, 0x07B5C932, 0xC1FEA24F, 0x6651537F, 0xA01A3802,
+	0x3DAE4996, 0xFBE522EB, 0x5C4AD3DB, 0x9A01B8A6, 0xFE677D0C, 0x382C1671, 0x9F83E741, 0x59C88C3C,
+	0x574E6C15, 0x91050768, 0x36AAF658, 0xF0E19D25, 0x9487588F, 0x52CC33F2, 0xF563C2C2, 0x3328A9BF,
+	0xE86E0290, 0x2E2569ED, 0x898A98DD, 0x4FC1F3A0, 0x2BA7360A, 0xEDEC5D77, 0x4A43AC47, 0x8C08C73A,
+	0x828E2713, 0x44C54C6E, 0xE36ABD5E, 0x2521D623, 0x41471389, 0x870C78F4, 0x20A389C4, 0xE6E8E2B9,
+	// Seed 0xD6
+	0x00000000, 0x12FD36F5, 0x25FA6DEA, 0x37075B1F, 0x4BF4DBD4, 0x5909ED21, 0x6E0EB63E, 0x7CF380CB,
+	0x4889586B, 0x5A746E9E, 0x6D733581, 0x7F8E0374, 0x037D83BF, 0x1180B54A, 0x2687EE55, 0x347AD8A0,
+	0x4E725F15, 0x5C8F69E0, 0x6B8832FF, 0x7975040A, 0x058684C1, 0x177BB234, 0x207CE92B, 0x3281DFDE,
+	0x06FB077E, 0x1406318B, 0x23016A94, 0x31FC5C61, 0x4D0FDCAA, 0x5FF2EA5F, 0x68F5B140, 0x7A0887B5,
+	0x438451E9, 0x5179671C, 0x667E3C03, 0x74830AF6, 0x08708A3D, 0x1A8DBCC8, 0x2D8AE7D7, 0x3F77D122,
+	0x0B0D0982, 0x19F03F77, 0x2EF76468, 0x3C0A529D, 0x40F9D256, 0x5204E4A3, 0x6503BFBC, 0x77FE8949,
+	0x0DF60EFC, 0x1F0B3809, 0x280C6316, 0x3AF155E3, 0x4602D528, 0x54FFE3DD, 0x63F8B8C2, 0x71058E37,
+	0x457F5697, 0x57826062, 0x60853B7D, 0x72780D88, 0x0E8B8D43, 0x1C76BBB6, 0x2B71E0A9, 0x398CD65C,
+	0x58684C11, 0x4A957AE4, 0x7D9221FB, 0x6F6F170E, 0x139C97C5, 0x0161A130, 0x3666FA2F, 0x249BCCDA,
+	0x10E1147A, 0x021C228F, 0x351B7990, 0x27E64F65, 0x5B15CFAE, 0x49E8F95B, 0x7EEFA244, 0x6C1294B1,
+	0x161A1304, 0x04E725F1, 0x33E07EEE, 0x211D481B, 0x5DEEC8D0, 0x4F13FE25, 0x7814A53A, 0x6AE993CF,
+	0x5E934B6F, 0x4C6E7D9A, 0x7B692685, 0x69941070, 0x156790BB, 0x079AA64E, 0x309DFD51, 0x2260CBA4,
+	0x1BEC1DF8, 0x09112B0D, 0x3E167012, 0x2CEB46E7, 0x5018C62C, 0x42E5F0D9, 0x75E2ABC6, 0x671F9D33,
+	0x53654593, 0x41987366, 0x769F2879, 0x64621E8C, 0x18919E47, 0x0A6CA8B2, 0x3D6BF3AD, 0x2F96C558,
+	0x559E42ED, 0x47637418, 0x70642F07, 0x629919F2, 0x1E6A9939, 0x0C97AFCC, 0x3B90F4D3, 0x296DC226,
+	0x1D171A86, 0x0FEA2C73, 0x38ED776C, 0x2A104199, 0x56E3C152, 0x441EF7A7, 0x7319ACB8, 0x61E49A4D,
+	0x6FB077E1, 0x7D4D4114, 0x4A4A1A0B, 0x58B72CFE, 0x2444AC35, 0x36B99AC0, 0x01BEC1DF, 0x1343F72A,
+	0x27392F8A, 0x35C4197F, 0x02C34260, 0x103E7495, 0x6CCDF45E, 0x7E30C2AB, 0x493799B4, 0x5BCAAF41,
+	0x21C228F4, 0x333F1E01, 0x0438451E, 0x16C573EB, 0x6A36F320, 0x78CBC5D5, 0x4FCC9ECA, 0x5D31A83F,
+	0x694B709F, 0x7BB6466A, 0x4CB11D75, 0x5E4C2B80, 0x22BFAB4B, 0x30429DBE, 0x0745C6A1, 0x15B8F054,
+	0x2C342608, 0x3EC910FD, 0x09CE4BE2, 0x1B337D17, 0x67C0FDDC, 0x753DCB29, 0x423A9036, 0x50C7A6C3,
+	0x64BD7E63, 0x76404896, 0x41471389, 0x53BA257C, 0x2F49A5B7, 0x3DB49342, 0x0AB3C85D, 0x184EFEA8,
+	0x6246791D, 0x70BB4FE8, 0x47BC14F7, 0x55412202, 0x29B2A2C9, 0x3B4F943C, 0x0C48CF23, 0x1EB5F9D6,
+	0x2ACF2176, 0x38321783, 0x0F354C9C, 0x1DC87A69, 0x613BFAA2, 0x73C6CC57, 0x44C19748, 0x563CA1BD,
+	0x37D83BF0, 0x25250D05, 0x1222561A, 0x00DF60EF, 0x7C2CE024, 0x6ED1D6D1, 0x59D68DCE, 0x4B2BBB3B,
+	0x7F51639B, 0x6DAC556E, 0x5AAB0E71, 0x48563884, 0x34A5B84F, 0x26588EBA, 0x115FD5A5, 0x03A2E350,
+	0x79AA64E5, 0x6B575210, 0x5C50090F, 0x4EAD3FFA, 0x325EBF31, 0x20A389C4, 0x17A4D2DB, 0x0559E42E,
+	0x31233C8E, 0x23DE0A7B, 0x14D95164, 0x06246791, 0x7AD7E75A, 0x682AD1AF, 0x5F2D8AB0, 0x4DD0BC45,
+	0x745C6A19, 0x66A15CEC, 0x51A607F3, 0x435B3106, 0x3FA8B1CD, 0x2D558738, 0x1A52DC27, 0x08AFEAD2,
+	0x3CD53272, 0x2E280487, 0x192F5F98, 0x0BD2696D, 0x7721E9A6, 0x65DCDF53, 0x52DB844C, 0x4026B2B9,
+	0x3A2E350C, 0x28D303F9, 0x1FD458E6, 0x0D296E13, 0x71DAEED8, 0x6327D82D, 0x54208332, 0x46DDB5C7,
+	0x72A76D67, 0x605A5B92, 0x575D008D, 0x45A03678, 0x3953B6B3, 0x2BAE8046, 0x1CA9DB59, 0x0E54EDAC,
+	// Seed 0xD7
+	0x00000000, 0x0F1EF8C6, 0x1E3DF18C, 0x1123094A, 0x0D156DF7, 0x020B9531, 0x13289C7B, 0x1C3664BD,
+	0x1A2ADBEE, 0x15342328, 0x04172A62, 0x0B09D2A4, 0x173FB619, 0x18214EDF, 0x09024795, 0x061CBF53,
+	0x053B3933, 0x0A25C1F5, 0x1B06C8BF, 0x14183079, 0x082E54C4, 0x0730AC02, 0x1613A548, 0x190D5D8E,
+	0x1F11E2DD, 0x100F1A1B, 0x012C1351, 0x0E32EB97, 0x12048F2A, 0x1D1A77EC, 0x0C397EA6, 0x03278660,
+	0x0A767266, 0x05688AA0, 0x144B83EA, 0x1B557B2C, 0x07631F91, 0x087DE757, 0x195EEE1D, 0x164016DB,
+	0x105CA988, 0x1F42514E, 0x0E615804, 0x017FA0C2, 0x1D49C47F, 0x12573CB9, 0x037435F3, 0x0C6ACD35,
+	0x0F4D4B55, 0x0053B393, 0x1170BAD9, 0x1E6E421F, 0x025826A2, 0x0D46DE64, 0x1C65D72E, 0x137B2FE8,
+	0x156790BB, 0x1A79687D, 0x0B5A6137, 0x044499F1, 0x1872FD4C, 0x176C058A, 0x064F0CC0, 0x0951F406,
+	0x14ECE4CC, 0x1BF21C0A, 0x0AD11540, 0x05CFED86, 0x19F9893B, 0x16E771FD, 0x07C478B7, 0x08DA8071,
+	0x0EC63F22, 0x01D8C7E4, 0x10FBCEAE, 0x1FE53668, 0x03D352D5, 0x0CCDAA13, 0x1DEEA359, 0x12F05B9F,
+	0x11D7DDFF, 0x1EC92539, 0x0FEA2C73, 0x00F4D4B5, 0x1CC2B008, 0x13DC48CE, 0x02FF4184, 0x0DE1B942,
+	0x0BFD0611, 0x04E3FED7, 0x15C0F79D, 0x1ADE0F5B, 0x06E86BE6, 0x09F69320, 0x18D59A6A, 0x17CB62AC,
+	0x1E9A96AA, 0x11846E6C, 0x00A76726, 0x0FB99FE0, 0x138FFB5D, 0x1C91039B, 0x0DB20AD1, 0x02ACF217,
+	0x04B04D44, 0x0BAEB582, 0x1A8DBCC8, 0x1593440E, 0x09A520B3, 0x06BBD875, 0x1798D13F, 0x188629F9,
+	0x1BA1AF99, 0x14BF575F, 0x059C5E15, 0x0A82A6D3, 0x16B4C26E, 0x19AA3AA8, 0x088933E2, 0x0797CB24,
+	0x018B7477, 0x0E958CB1, 0x1FB685FB, 0x10A87D3D, 0x0C9E1980, 0x0380E146, 0x12A3E80C, 0x1DBD10CA,
+	0x18B74777, 0x17A9BFB1, 0x068AB6FB, 0x09944E3D, 0x15A22A80, 0x1ABCD246, 0x0B9FDB0C, 0x048123CA,
+	0x029D9C99, 0x0D83645F, 0x1CA06D15, 0x13BE95D3, 0x0F88F16E, 0x009609A8, 0x11B500E2, 0x1EABF824,
+	0x1D8C7E44, 0x12928682, 0x03B18FC8, 0x0CAF770E, 0x109913B3, 0x1F87EB75, 0x0EA4E23F, 0x01BA1AF9,
+	0x07A6A5AA, 0x08B85D6C, 0x199B5426, 0x1685ACE0, 0x0AB3C85D, 0x05AD309B, 0x148E39D1, 0x1B90C117,
+	0x12C13511, 0x1DDFCDD7, 0x0CFCC49D, 0x03E23C5B, 0x1FD458E6, 0x10CAA020, 0x01E9A96A, 0x0EF751AC,
+	0x08EBEEFF, 0x07F51639, 0x16D61F73, 0x19C8E7B5, 0x05FE8308, 0x0AE07BCE, 0x1BC37284, 0x14DD8A42,
+	0x17FA0C22, 0x18E4F4E4, 0x09C7FDAE, 0x06D90568, 0x1AEF61D5, 0x15F19913, 0x04D29059, 0x0BCC689F,
+	0x0DD0D7CC, 0x02CE2F0A, 0x13ED2640, 0x1CF3DE86, 0x00C5BA3B, 0x0FDB42FD, 0x1EF84BB7, 0x11E6B371,
+	0x0C5BA3BB, 0x03455B7D, 0x12665237, 0x1D78AAF1, 0x014ECE4C, 0x0E50368A, 0x1F733FC0, 0x106DC706,
+	0x16717855, 0x196F8093, 0x084C89D9, 0x0752711F, 0x1B6415A2, 0x147AED64, 0x0559E42E, 0x0A471CE8,
+	0x09609A88, 0x067E624E, 0x175D6B04, 0x184393C2, 0x0475F77F, 0x0B6B0FB9, 0x1A4806F3, 0x1556FE35,
+	0x134A4166, 0x1C54B9A0, 0x0D77B0EA, 0x0269482C, 0x1E5F2C91, 0x1141D457, 0x0062DD1D, 0x0F7C25DB,
+	0x062DD1DD, 0x0933291B, 0x18102051, 0x170ED897, 0x0B38BC2A, 0x042644EC, 0x15054DA6, 0x1A1BB560,
+	0x1C070A33, 0x1319F2F5, 0x023AFBBF, 0x0D240379, 0x111267C4, 0x1E0C9F02, 0x0F2F9648, 0x00316E8E,
+	0x0316E8EE, 0x0C081028, 0x1D2B1962, 0x1235E1A4, 0x0E038519, 0x011D7DDF, 0x103E7495, 0x1F208C53,
+	0x193C3300, 0x1622CBC6, 0x0701C28C, 0x081F3A4A, 0x14295EF7, 0x1B37A631, 0x0A14AF7B, 0x050A57BD,
+	// Seed 0xD8
+	0x00000000, 0xCD1C6725, 0x8A287B8B, 0x47341CAE, 0x044042D7, 0xC95C25F2, 0x8E68395C, 0x43745E79,
+	0x088085AE, 0xC59CE28B, 0x82A8FE25, 0x4FB49900, 0x0CC0C779, 0xC1DCA05C, 0x86E8BCF2, 0x4BF4DBD7,
+	0x11010B5C, 0xDC1D6C79, 0x9B2970D7, 0x563517F2, 0x1541498B, 0xD85D2EAE, 0x9F693200, 0x52755525,
+	0x19818EF2, 0xD49DE9D7, 0x93A9F579, 0x5EB5925C, 0x1DC1CC25, 0xD0DDAB00, 0x97E9B7AE, 0x5AF5D08B,
+	0x220216B8, 0xEF1E719D, 0xA82A6D33, 0x65360A16, 0x2642546F, 0xEB5E334A, 0xAC6A2FE4, 0x617648C1,
+	0x2A829316, 0xE79EF433, 0xA0AAE89D, 0x6DB68FB8, 0x2EC2D1C1, 0xE3DEB6E4, 0xA4EAAA4A, 0x69F6CD6F,
+	0x33031DE4, 0xFE1F7AC1, 0xB92B666F, 0x7437014A, 0x37435F33, 0xFA5F3816, 0xBD6B24B8, 0x7077439D,
+	0x3B83984A, 0xF69FFF6F, 0xB1ABE3C1, 0x7CB784E4, 0x3FC3DA9D, 0xF2DFBDB8, 0xB5EBA116, 0x78F7C633,
+	0x44042D70, 0x89184A55, 0xCE2C56FB, 0x033031DE, 0x40446FA7, 0x8D580882, 0xCA6C142C, 0x07707309,
+	0x4C84A8DE, 0x8198CFFB, 0xC6ACD355, 0x0BB0B470, 0x48C4EA09, 0x85D88D2C, 0xC2EC9182, 0x0FF0F6A7,
+	0x5505262C, 0x98194109, 0xDF2D5DA7, 0x12313A82, 0x514564FB, 0x9C5903DE, 0xDB6D1F70, 0x16717855,
+	0x5D85A382, 0x9099C4A7, 0xD7ADD809, 0x1AB1BF2C, 0x59C5E155, 0x94D98670, 0xD3ED9ADE, 0x1EF1FDFB,
+	0x66063BC8, 0xAB1A5CED, 0xEC2E4043, 0x21322766, 0x6246791F, 0xAF5A1E3A, 0xE86E0294, 0x257265B1,
+	0x6E86BE66, 0xA39AD943, 0xE4AEC5ED, 0x29B2A2C8, 0x6AC6FCB1, 0xA7DA9B94, 0xE0EE873A, 0x2DF2E01F,
+	0x77073094, 0xBA1B57B1, 0xFD2F4B1F, 0x30332C3A, 0x73477243, 0xBE5B1566, 0xF96F09C8, 0x34736EED,
+	0x7F87B53A, 0xB29BD21F, 0xF5AFCEB1, 0x38B3A994, 0x7BC7F7ED, 0xB6DB90C8, 0xF1EF8C66, 0x3CF3EB43,
+	0x88085AE0, 0x45143DC5, 0x0220216B, 0xCF3C464E, 0x8C481837, 0x41547F12, 0x066063BC, 0xCB7C0499,
+	0x8088DF4E, 0x4D94B86B, 0x0AA0A4C5, 0xC7BCC3E0, 0x84C89D99, 0x49D4FABC, 0x0EE0E612, 0xC3FC8137,
+	0x990951BC, 0x54153699, 0x13212A37, 0xDE3D4D12, 0x9D49136B, 0x5055744E, 0x176168E0, 0xDA7D0FC5,
+	0x9189D412, 0x5C95B337, 0x1BA1AF99, 0xD6BDC8BC, 0x95C996C5, 0x58D5F1E0, 0x1FE1ED4E, 0xD2FD8A6B,
+	0xAA0A4C58, 0x67162B7D, 0x202237D3, 0xED3E50F6, 0xAE4A0E8F, 0x635669AA, 0x24627504, 0xE97E1221,
+	0xA28AC9F6, 0x6F96AED3, 0x28A2B27D, 0xE5BED558, 0xA6CA8B21, 0x6BD6EC04, 0x2CE2F0AA, 0xE1FE978F,
+	0xBB0B4704, 0x76172021, 0x31233C8F, 0xFC3F5BAA, 0xBF4B05D3, 0x725762F6, 0x35637E58, 0xF87F197D,
+	0xB38BC2AA, 0x7E97A58F, 0x39A3B921, 0xF4BFDE04, 0xB7CB807D, 0x7AD7E758, 0x3DE3FBF6, 0xF0FF9CD3,
+	0xCC0C7790, 0x011010B5, 0x46240C1B, 0x8B386B3E, 0xC84C3547, 0x05505262, 0x42644ECC, 0x8F7829E9,
+	0xC48CF23E, 0x0990951B, 0x4EA489B5, 0x83B8EE90, 0xC0CCB0E9, 0x0DD0D7CC, 0x4AE4CB62, 0x87F8AC47,
+	0xDD0D7CCC, 0x10111BE9, 0x57250747, 0x9A396062, 0xD94D3E1B, 0x1451593E, 0x53654590, 0x9E7922B5,
+	0xD58DF962, 0x18919E47, 0x5FA582E9, 0x92B9E5CC, 0xD1CDBBB5, 0x1CD1DC90, 0x5BE5C03E, 0x96F9A71B,
+	0xEE0E6128, 0x2312060D, 0x64261AA3, 0xA93A7D86, 0xEA4E23FF, 0x275244DA, 0x60665874, 0xAD7A3F51,
+	0xE68EE486, 0x2B9283A3, 0x6CA69F0D, 0xA1BAF828, 0xE2CEA651, 0x2FD2C174, 0x68E6DDDA, 0xA5FABAFF,
+	0xFF0F6A74, 0x32130D51, 0x752711FF, 0xB83B76DA, 0xFB4F28A3, 0x36534F86, 0x71675328, 0xBC7B340D,
+	0xF78FEFDA, 0x3A9388FF, 0x7DA79451, 0xB0BBF374, 0xF3CFAD0D, 0x3ED3CA28, 0x79E7D686, 0xB4FBB1A3,
+	// Seed 0xD9
+	0x00000000, 0xB4291B00, 0x8A4CE2E1, 0x3E65F9E1, 0xF6871123, 0x42AE0A23, 0x7CCBF3C2, 0xC8E2E8C2,
+	0x0F10F6A7, 0xBB39EDA7, 0x855C1446, 0x31750F46, 0xF997E784, 0x4DBEFC84, 0x73DB0565, 0xC7F21E65,
+	0x1E21ED4E, 0xAA08F64E, 0x946D0FAF, 0x204414AF, 0xE8A6FC6D, 0x5C8FE76D, 0x62EA1E8C, 0xD6C3058C,
+	0x11311BE9, 0xA51800E9, 0x9B7DF908, 0x2F54E208, 0xE7B60ACA, 0x539F11CA, 0x6DFAE82B, 0xD9D3F32B,
+	0x3C43DA9C, 0x886AC19C, 0xB60F387D, 0x0226237D, 0xCAC4CBBF, 0x7EEDD0BF, 0x4088295E, 0xF4A1325E,
+	0x33532C3B, 0x877A373B, 0xB91FCEDA, 0x0D36D5DA, 0xC5D43D18, 0x71FD2618, 0x4F98DFF9, 0xFBB1C4F9,
+	0x226237D2, 0x964B2CD2, 0xA82ED533, 0x1C07CE33, 0xD4E526F1, 0x60CC3DF1, 0x5EA9C410, 0xEA80DF10,
+	0x2D72C175, 0x995BDA75, 0xA73E2394, 0x13173894, 0xDBF5D056, 0x6FDCCB56, 0x51B932B7, 0xE59029B7,
+	0x7887B538, 0xCCAEAE38, 0xF2CB57D9, 0x46E24CD9, 0x8E00A41B, 0x3A29BF1B, 0x044C46FA, 0xB0655DFA,
+	0x7797439F, 0xC3BE589F, 0xFDDBA17E, 0x49F2BA7E, 0x811052BC, 0x353949BC, 0x0B5CB05D, 0xBF75AB5D,
+	0x66A65876, 0xD28F4376, 0xECEABA97, 0x58C3A197, 0x90214955, 0x24085255, 0x1A6DABB4, 0xAE44B0B4,
+	0x69B6AED1, 0xDD9FB5D1, 0xE3FA4C30, 0x57D35730, 0x9F31BFF2, 0x2B18A4F2, 0x157D5D13, 0xA1544613,
+	0x44C46FA4, 0xF0ED74A4, 0xCE888D45, 0x7AA19645, 0xB2437E87, 0x066A6587, 0x380F9C66, 0x8C268766,
+	0x4BD49903, 0xFFFD8203, 0xC1987BE2, 0x75B160E2, 0xBD538820, 0x097A9320, 0x371F6AC1, 0x833671C1,
+	0x5AE582EA, 0xEECC99EA, 0xD0A9600B, 0x64807B0B, 0xAC6293C9, 0x184B88C9, 0x262E7128, 0x92076A28,
+	0x55F5744D, 0xE1DC6F4D, 0xDFB996AC, 0x6B908DAC, 0xA372656E, 0x175B7E6E, 0x293E878F, 0x9D179C8F,
+	0xF10F6A70, 0x45267170, 0x7B438891, 0xCF6A9391, 0x07887B53, 0xB3A16053, 0x8DC499B2, 0x39ED82B2,
+	0xFE1F9CD7, 0x4A3687D7, 0x74537E36, 0xC07A6536, 0x08988DF4, 0xBCB196F4, 0x82D46F15, 0x36FD7415,
+	0xEF2E873E, 0x5B079C3E, 0x656265DF, 0xD14B7EDF, 0x19A9961D, 0xAD808D1D, 0x93E574FC, 0x27CC6FFC,
+	0xE03E7199, 0x54176A99, 0x6A729378, 0xDE5B8878, 0x16B960BA, 0xA2907BBA, 0x9CF5825B, 0x28DC995B,
+	0xCD4CB0EC, 0x7965ABEC, 0x4700520D, 0xF329490D, 0x3BCBA1CF, 0x8FE2BACF, 0xB187432E, 0x05AE582E,
+	0xC25C464B, 0x76755D4B, 0x4810A4AA, 0xFC39BFAA, 0x34DB5768, 0x80F24C68, 0xBE97B589, 0x0ABEAE89,
+	0xD36D5DA2, 0x674446A2, 0x5921BF43, 0xED08A443, 0x25EA4C81, 0x91C35781, 0xAFA6AE60, 0x1B8FB560,
+	0xDC7DAB05, 0x6854B005, 0x563149E4, 0xE21852E4, 0x2AFABA26, 0x9ED3A126, 0xA0B658C7, 0x149F43C7,
+	0x8988DF48, 0x3DA1C448, 0x03C43DA9, 0xB7ED26A9, 0x7F0FCE6B, 0xCB26D56B, 0xF5432C8A, 0x416A378A,
+	0x869829EF, 0x32B132EF, 0x0CD4CB0E, 0xB8FDD00E, 0x701F38CC, 0xC43623CC, 0xFA53DA2D, 0x4E7AC12D,
+	0x97A93206, 0x23802906, 0x1DE5D0E7, 0xA9CCCBE7, 0x612E2325, 0xD5073825, 0xEB62C1C4, 0x5F4BDAC4,
+	0x98B9C4A1, 0x2C90DFA1, 0x12F52640, 0xA6DC3D40, 0x6E3ED582, 0xDA17CE82, 0xE4723763, 0x505B2C63,
+	0xB5CB05D4, 0x01E21ED4, 0x3F87E735, 0x8BAEFC35, 0x434C14F7, 0xF7650FF7, 0xC900F616, 0x7D29ED16,
+	0xBADBF373, 0x0EF2E873, 0x30971192, 0x84BE0A92, 0x4C5CE250, 0xF875F950, 0xC61000B1, 0x72391BB1,
+	0xABEAE89A, 0x1FC3F39A, 0x21A60A7B, 0x958F117B, 0x5D6DF9B9, 0xE944E2B9, 0xD7211B58, 0x63080058,
+	0xA4FA1E3D, 0x10D3053D, 0x2EB6FCDC, 0x9A9FE7DC, 0x527D0F1E, 0xE654141E, 0xD831EDFF, 0x6C18F6FF,
+	// Seed 0xDA
+	0x00000000, 0x56F91B86, 0x61FE4099, 0x37075B1F, 0x0FF0F6A7, 0x5909ED21, 0x6E0EB63E, 0x38F7ADB8,
+	0x1FE1ED4E, 0x4918F6C8, 0x7E1FADD7, 0x28E6B651, 0x10111BE9, 0x46E8006F, 0x71EF5B70, 0x271640F6,
+	0x3FC3DA9C, 0x693AC11A, 0x5E3D9A05, 0x08C48183, 0x30332C3B, 0x66CA37BD, 0x51CD6CA2, 0x07347724,
+	0x202237D2, 0x76DB2C54, 0x41DC774B, 0x17256CCD, 0x2FD2C175, 0x792BDAF3, 0x4E2C81EC, 0x18D59A6A,
+	0x7F87B538, 0x297EAEBE, 0x1E79F5A1, 0x4880EE27, 0x7077439F, 0x268E5819, 0x11890306, 0x47701880,
+	0x60665876, 0x369F43F0, 0x019818EF, 0x57610369, 0x6F96AED1, 0x396FB557, 0x0E68EE48, 0x5891F5CE,
+	0x40446FA4, 0x16BD7422, 0x21BA2F3D, 0x774334BB, 0x4FB49903, 0x194D8285, 0x2E4AD99A, 0x78B3C21C,
+	0x5FA582EA, 0x095C996C, 0x3E5BC273, 0x68A2D9F5, 0x5055744D, 0x06AC6FCB, 0x31AB34D4, 0x67522F52,
+	0x33031DE5, 0x65FA0663, 0x52FD5D7C, 0x040446FA, 0x3CF3EB42, 0x6A0AF0C4, 0x5D0DABDB, 0x0BF4B05D,
+	0x2CE2F0AB, 0x7A1BEB2D, 0x4D1CB032, 0x1BE5ABB4, 0x2312060C, 0x75EB1D8A, 0x42EC4695, 0x14155D13,
+	0x0CC0C779, 0x5A39DCFF, 0x6D3E87E0, 0x3BC79C66, 0x033031DE, 0x55C92A58, 0x62CE7147, 0x34376AC1,
+	0x13212A37, 0x45D831B1, 0x72DF6AAE, 0x24267128, 0x1CD1DC90, 0x4A28C716, 0x7D2F9C09, 0x2BD6878F,
+	0x4C84A8DD, 0x1A7DB35B, 0x2D7AE844, 0x7B83F3C2, 0x43745E7A, 0x158D45FC, 0x228A1EE3, 0x74730565,
+	0x53654593, 0x059C5E15, 0x329B050A, 0x64621E8C, 0x5C95B334, 0x0A6CA8B2, 0x3D6BF3AD, 0x6B92E82B,
+	0x73477241, 0x25BE69C7, 0x12B932D8, 0x4440295E, 0x7CB784E6, 0x2A4E9F60, 0x1D49C47F, 0x4BB0DFF9,
+	0x6CA69F0F, 0x3A5F8489, 0x0D58DF96, 0x5BA1C410, 0x635669A8, 0x35AF722E, 0x02A82931, 0x545132B7,
+	0x66063BCA, 0x30FF204C, 0x07F87B53, 0x510160D5, 0x69F6CD6D, 0x3F0FD6EB, 0x08088DF4, 0x5EF19672,
+	0x79E7D684, 0x2F1ECD02, 0x1819961D, 0x4EE08D9B, 0x76172023, 0x20EE3BA5, 0x17E960BA, 0x41107B3C,
+	0x59C5E156, 0x0F3CFAD0, 0x383BA1CF, 0x6EC2BA49, 0x563517F1, 0x00CC0C77, 0x37CB5768, 0x61324CEE,
+	0x46240C18, 0x10DD179E, 0x27DA4C81, 0x71235707, 0x49D4FABF, 0x1F2DE139, 0x282ABA26, 0x7ED3A1A0,
+	0x19818EF2, 0x4F789574, 0x787FCE6B, 0x2E86D5ED, 0x16717855, 0x408863D3, 0x778F38CC, 0x2176234A,
+	0x066063BC, 0x5099783A, 0x679E2325, 0x316738A3, 0x0990951B, 0x5F698E9D, 0x686ED582, 0x3E97CE04,
+	0x2642546E, 0x70BB4FE8, 0x47BC14F7, 0x11450F71, 0x29B2A2C9, 0x7F4BB94F, 0x484CE250, 0x1EB5F9D6,
+	0x39A3B920, 0x6F5AA2A6, 0x585DF9B9, 0x0EA4E23F, 0x36534F87, 0x60AA5401, 0x57AD0F1E, 0x01541498,
+	0x5505262F, 0x03FC3DA9, 0x34FB66B6, 0x62027D30, 0x5AF5D088, 0x0C0CCB0E, 0x3B0B9011, 0x6DF28B97,
+	0x4AE4CB61, 0x1C1DD0E7, 0x2B1A8BF8, 0x7DE3907E, 0x45143DC6, 0x13ED2640, 0x24EA7D5F, 0x721366D9,
+	0x6AC6FCB3, 0x3C3FE735, 0x0B38BC2A, 0x5DC1A7AC, 0x65360A14, 0x33CF1192, 0x04C84A8D, 0x5231510B,
+	0x752711FD, 0x23DE0A7B, 0x14D95164, 0x42204AE2, 0x7AD7E75A, 0x2C2EFCDC, 0x1B29A7C3, 0x4DD0BC45,
+	0x2A829317, 0x7C7B8891, 0x4B7CD38E, 0x1D85C808, 0x257265B0, 0x738B7E36, 0x448C2529, 0x12753EAF,
+	0x35637E59, 0x639A65DF, 0x549D3EC0, 0x02642546, 0x3A9388FE, 0x6C6A9378, 0x5B6DC867, 0x0D94D3E1,
+	0x1541498B, 0x43B8520D, 0x74BF0912, 0x22461294, 0x1AB1BF2C, 0x4C48A4AA, 0x7B4FFFB5, 0x2DB6E433,
+	0x0AA0A4C5, 0x5C59BF43, 0x6B5EE45C, 0x3DA7FFDA, 0x05505262, 0x53A949E4, 0x64AE12FB, 0x3257097D,
+	// Seed 0xDB
+	0x00000000, 0x1ED3FFED, 0x1FA5E963, 0x0176168E, 0x1D49C47F, 0x039A3B92, 0x02EC2D1C, 0x1C3FD2F1,
+	0x18919E47, 0x064261AA, 0x07347724, 0x19E788C9, 0x05D85A38, 0x1B0BA5D5, 0x1A7DB35B, 0x04AE4CB6,
+	0x13212A37, 0x0DF2D5DA, 0x0C84C354, 0x12573CB9, 0x0E68EE48, 0x10BB11A5, 0x11CD072B, 0x0F1EF8C6,
+	0x0BB0B470, 0x15634B9D, 0x14155D13, 0x0AC6A2FE, 0x16F9700F, 0x082A8FE2, 0x095C996C, 0x178F6681,
+	0x044042D7, 0x1A93BD3A, 0x1BE5ABB4, 0x05365459, 0x190986A8, 0x07DA7945, 0x06AC6FCB, 0x187F9026,
+	0x1CD1DC90, 0x0202237D, 0x037435F3, 0x1DA7CA1E, 0x019818EF, 0x1F4BE702, 0x1E3DF18C, 0x00EE0E61,
+	0x176168E0, 0x09B2970D, 0x08C48183, 0x16177E6E, 0x0A28AC9F, 0x14FB5372, 0x158D45FC, 0x0B5EBA11,
+	0x0FF0F6A7, 0x1123094A, 0x10551FC4, 0x0E86E029, 0x12B932D8, 0x0C6ACD35, 0x0D1CDBBB, 0x13CF2456,
+	0x088085AE, 0x16537A43, 0x17256CCD, 0x09F69320, 0x15C941D1, 0x0B1ABE3C, 0x0A6CA8B2, 0x14BF575F,
+	0x10111BE9, 0x0EC2E404, 0x0FB4F28A, 0x11670D67, 0x0D58DF96, 0x138B207B, 0x12FD36F5, 0x0C2EC918,
+	0x1BA1AF99, 0x05725074, 0x040446FA, 0x1AD7B917, 0x06E86BE6, 0x183B940B, 0x194D8285, 0x079E7D68,
+	0x033031DE, 0x1DE3CE33, 0x1C95D8BD, 0x02462750, 0x1E79F5A1, 0x00AA0A4C, 0x01DC1CC2, 0x1F0FE32F,
+	0x0CC0C779, 0x12133894, 0x13652E1A, 0x0DB6D1F7, 0x11890306, 0x0F5AFCEB, 0x0E2CEA65, 0x10FF1588,
+	0x1451593E, 0x0A82A6D3, 0x0BF4B05D, 0x15274FB0, 0x09189D41, 0x17CB62AC, 0x16BD7422, 0x086E8BCF,
+	0x1FE1ED4E, 0x013212A3, 0x0044042D, 0x1E97FBC0, 0x02A82931, 0x1C7BD6DC, 0x1D0DC052, 0x03DE3FBF,
+	0x07707309, 0x19A38CE4, 0x18D59A6A, 0x06066587, 0x1A39B776, 0x04EA489B, 0x059C5E15, 0x1B4FA1F8,
+	0x11010B5C, 0x0FD2F4B1, 0x0EA4E23F, 0x10771DD2, 0x0C48CF23, 0x129B30CE, 0x13ED2640, 0x0D3ED9AD,
+	0x0990951B, 0x17436AF6, 0x16357C78, 0x08E68395, 0x14D95164, 0x0A0AAE89, 0x0B7CB807, 0x15AF47EA,
+	0x0220216B, 0x1CF3DE86, 0x1D85C808, 0x035637E5, 0x1F69E514, 0x01BA1AF9, 0x00CC0C77, 0x1E1FF39A,
+	0x1AB1BF2C, 0x046240C1, 0x0514564F, 0x1BC7A9A2, 0x07F87B53, 0x192B84BE, 0x185D9230, 0x068E6DDD,
+	0x1541498B, 0x0B92B666, 0x0AE4A0E8, 0x14375F05, 0x08088DF4, 0x16DB7219, 0x17AD6497, 0x097E9B7A,
+	0x0DD0D7CC, 0x13032821, 0x12753EAF, 0x0CA6C142, 0x109913B3, 0x0E4AEC5E, 0x0F3CFAD0, 0x11EF053D,
+	0x066063BC, 0x18B39C51, 0x19C58ADF, 0x07167532, 0x1B29A7C3, 0x05FA582E, 0x048C4EA0, 0x1A5FB14D,
+	0x1EF1FDFB, 0x00220216, 0x01541498, 0x1F87EB75, 0x03B83984, 0x1D6BC669, 0x1C1DD0E7, 0x02CE2F0A,
+	0x19818EF2, 0x0752711F, 0x06246791, 0x18F7987C, 0x04C84A8D, 0x1A1BB560, 0x1B6DA3EE, 0x05BE5C03,
+	0x011010B5, 0x1FC3EF58, 0x1EB5F9D6, 0x0066063B, 0x1C59D4CA, 0x028A2B27, 0x03FC3DA9, 0x1D2FC244,
+	0x0AA0A4C5, 0x14735B28, 0x15054DA6, 0x0BD6B24B, 0x17E960BA, 0x093A9F57, 0x084C89D9, 0x169F7634,
+	0x12313A82, 0x0CE2C56F, 0x0D94D3E1, 0x13472C0C, 0x0F78FEFD, 0x11AB0110, 0x10DD179E, 0x0E0EE873,
+	0x1DC1CC25, 0x031233C8, 0x02642546, 0x1CB7DAAB, 0x0088085A, 0x1E5BF7B7, 0x1F2DE139, 0x01FE1ED4,
+	0x05505262, 0x1B83AD8F, 0x1AF5BB01, 0x042644EC, 0x1819961D, 0x06CA69F0, 0x07BC7F7E, 0x196F8093,
+	0x0EE0E612, 0x103319FF, 0x11450F71, 0x0F96F09C, 0x13A9226D, 0x0D7ADD80, 0x0C0CCB0E, 0x12DF34E3,
+	0x16717855, 0x08A287B8, 0x09D49136, 0x17076EDB, 0x0B38BC2A, 0x15EB43C7, 0x149D5549, 0x0A4EAAA4,
+	// Seed 0xDC
+	0x00000000, 0x03235D46, 0x0646BA8C, 0x0565E7CA, 0x0C8D7518, 0x0FAE285E, 0x0ACBCF94, 0x09E892D2,
+	0x191AEA30, 0x1A39B776, 0x1F5C50BC, 0x1C7F0DFA, 0x15979F28, 0x16B4C26E, 0x13D125A4, 0x10F278E2,
+	0x3235D460, 0x31168926, 0x34736EEC, 0x375033AA, 0x3EB8A178, 0x3D9BFC3E, 0x38FE1BF4, 0x3BDD46B2,
+	0x2B2F3E50, 0x280C6316, 0x2D6984DC, 0x2E4AD99A, 0x27A24B48, 0x2481160E, 0x21E4F1C4, 0x22C7AC82,
+	0x646BA8C0, 0x6748F586, 0x622D124C, 0x610E4F0A, 0x68E6DDD8, 0x6BC5809E, 0x6EA06754, 0x6D833A12,
+	0x7D7142F0, 0x7E521FB6, 0x7B37F87C, 0x7814A53A, 0x71FC37E8, 0x72DF6AAE, 0x77BA8D64, 0x7499D022,
+	0x565E7CA0, 0x557D21E6, 0x5018C62C, 0x533B9B6A, 0x5AD309B8, 0x59F054FE, 0x5C95B334, 0x5FB6EE72,
+	0x4F449690, 0x4C67CBD6, 0x49022C1C, 0x4A21715A, 0x43C9E388, 0x40EABECE, 0x458F5904, 0x46AC0442,
+	0xC8D75180, 0xCBF40CC6, 0xCE91EB0C, 0xCDB2B64A, 0xC45A2498, 0xC77979DE, 0xC21C9E14, 0xC13FC352,
+	0xD1CDBBB0, 0xD2EEE6F6, 0xD78B013C, 0xD4A85C7A, 0xDD40CEA8, 0xDE6393EE, 0xDB067424, 0xD8252962,
+	0xFAE285E0, 0xF9C1D8A6, 0xFCA43F6C, 0xFF87622A, 0xF66FF0F8, 0xF54CADBE, 0xF0294A74, 0xF30A1732,
+	0xE3F86FD0, 0xE0DB3296, 0xE5BED55C, 0xE69D881A, 0xEF751AC8, 0xEC56478E, 0xE933A044, 0xEA10FD02,
+	0xACBCF940, 0xAF9FA406, 0xAAFA43CC, 0xA9D91E8A, 0xA0318C58, 0xA312D11E, 0xA67736D4, 0xA5546B92,
+	0xB5A61370, 0xB6854E36, 0xB3E0A9FC, 0xB0C3F4BA, 0xB92B6668, 0xBA083B2E, 0xBF6DDCE4, 0xBC4E81A2,
+	0x9E892D20, 0x9DAA7066, 0x98CF97AC, 0x9BECCAEA, 0x92045838, 0x9127057E, 0x9442E2B4, 0x9761BFF2,
+	0x8793C710, 0x84B09A56, 0x81D57D9C, 0x82F620DA, 0x8B1EB208, 0x883DEF4E, 0x8D580884, 0x8E7B55C2,
+	0x8F659EFF, 0x8C46C3B9, 0x89232473, 0x8A007935, 0x83E8EBE7, 0x80CBB6A1, 0x85AE516B, 0x868D0C2D,
+	0x967F74CF, 0x955C2989, 0x9039CE43, 0x931A9305, 0x9AF201D7, 0x99D15C91, 0x9CB4BB5B, 0x9F97E61D,
+	0xBD504A9F, 0xBE7317D9, 0xBB16F013, 0xB835AD55, 0xB1DD3F87, 0xB2FE62C1, 0xB79B850B, 0xB4B8D84D,
+	0xA44AA0AF, 0xA769FDE9, 0xA20C1A23, 0xA12F4765, 0xA8C7D5B7, 0xABE488F1, 0xAE816F3B, 0xADA2327D,
+	0xEB0E363F, 0xE82D6B79, 0xED488CB3, 0xEE6BD1F5, 0xE7834327, 0xE4A01E61, 0xE1C5F9AB, 0xE2E6A4ED,
+	0xF214DC0F, 0xF1378149, 0xF4526683, 0xF7713BC5, 0xFE99A917, 0xFDBAF451, 0xF8DF139B, 0xFBFC4EDD,
+	0xD93BE25F, 0xDA18BF19, 0xDF7D58D3, 0xDC5E0595, 0xD5B69747, 0xD695CA01, 0xD3F02DCB, 0xD0D3708D,
+	0xC021086F, 0xC3025529, 0xC667B2E3, 0xC544EFA5, 0xCCAC7D77, 0xCF8F2031, 0xCAEAC7FB, 0xC9C99ABD,
+	0x47B2CF7F, 0x44919239, 0x41F475F3, 0x42D728B5, 0x4B3FBA67, 0x481CE721, 0x4D7900EB, 0x4E5A5DAD,
+	0x5EA8254F, 0x5D8B7809, 0x58EE9FC3, 0x5BCDC285, 0x52255057, 0x51060D11, 0x5463EADB, 0x5740B79D,
+	0x75871B1F, 0x76A44659, 0x73C1A193, 0x70E2FCD5, 0x790A6E07, 0x7A293341, 0x7F4CD48B, 0x7C6F89CD,
+	0x6C9DF12F, 0x6FBEAC69, 0x6ADB4BA3, 0x69F816E5, 0x60108437, 0x6333D971, 0x66563EBB, 0x657563FD,
+	0x23D967BF, 0x20FA3AF9, 0x259FDD33, 0x26BC8075, 0x2F5412A7, 0x2C774FE1, 0x2912A82B, 0x2A31F56D,
+	0x3AC38D8F, 0x39E0D0C9, 0x3C853703, 0x3FA66A45, 0x364EF897, 0x356DA5D1, 0x3008421B, 0x332B1F5D,
+	0x11ECB3DF, 0x12CFEE99, 0x17AA0953, 0x14895415, 0x1D61C6C7, 0x1E429B81, 0x1B277C4B, 0x1804210D,
+	0x08F659EF, 0x0BD504A9, 0x0EB0E363, 0x0D93BE25, 0x047B2CF7, 0x075871B1, 0x023D967B, 0x011ECB3D,
+	// Seed 0xDD
+	0x00000000, 0x487D8CDE, 0x90FB19BC, 0xD8869562, 0xD1336FAB, 0x994EE375, 0x41C87617, 0x09B5FAC9,
+	0x52A38385, 0x1ADE0F5B, 0xC2589A39, 0x8A2516E7, 0x8390EC2E, 0xCBED60F0, 0x136BF592, 0x5B16794C,
+	0xA547070A, 0xED3A8BD4, 0x35BC1EB6, 0x7DC19268, 0x747468A1, 0x3C09E47F, 0xE48F711D, 0xACF2FDC3,
+	0xF7E4848F, 0xBF990851, 0x671F9D33, 0x2F6211ED, 0x26D7EB24, 0x6EAA67FA, 0xB62CF298, 0xFE517E46,
+	0xBA4B52C7, 0xF236DE19, 0x2AB04B7B, 0x62CDC7A5, 0x6B783D6C, 0x2305B1B2, 0xFB8324D0, 0xB3FEA80E,
+	0xE8E8D142, 0xA0955D9C, 0x7813C8FE, 0x306E4420, 0x39DBBEE9, 0x71A63237, 0xA920A755, 0xE15D2B8B,
+	0x1F0C55CD, 0x5771D913, 0x8FF74C71, 0xC78AC0AF, 0xCE3F3A66, 0x8642B6B8, 0x5EC423DA, 0x16B9AF04,
+	0x4DAFD648, 0x05D25A96, 0xDD54CFF4, 0x9529432A, 0x9C9CB9E3, 0xD4E1353D, 0x0C67A05F, 0x441A2C81,
+	0x8453F95D, 0xCC2E7583, 0x14A8E0E1, 0x5CD56C3F, 0x556096F6, 0x1D1D1A28, 0xC59B8F4A, 0x8DE60394,
+	0xD6F07AD8, 0x9E8DF606, 0x460B6364, 0x0E76EFBA, 0x07C31573, 0x4FBE99AD, 0x97380CCF, 0xDF458011,
+	0x2114FE57, 0x69697289, 0xB1EFE7EB, 0xF9926B35, 0xF02791FC, 0xB85A1D22, 0x60DC8840, 0x28A1049E,
+	0x73B77DD2, 0x3BCAF10C, 0xE34C646E, 0xAB31E8B0, 0xA2841279, 0xEAF99EA7, 0x327F0BC5, 0x7A02871B,
+	0x3E18AB9A, 0x76652744, 0xAEE3B226, 0xE69E3EF8, 0xEF2BC431, 0xA75648EF, 0x7FD0DD8D, 0x37AD5153,
+	0x6CBB281F, 0x24C6A4C1, 0xFC4031A3, 0xB43DBD7D, 0xBD8847B4, 0xF5F5CB6A, 0x2D735E08, 0x650ED2D6,
+	0x9B5FAC90, 0xD322204E, 0x0BA4B52C, 0x43D939F2, 0x4A6CC33B, 0x02114FE5, 0xDA97DA87, 0x92EA5659,
+	0xC9FC2F15, 0x8181A3CB, 0x590736A9, 0x117ABA77, 0x18CF40BE, 0x50B2CC60, 0x88345902, 0xC049D5DC,
+	0xF862AE69, 0xB01F22B7, 0x6899B7D5, 0x20E43B0B, 0x2951C1C2, 0x612C4D1C, 0xB9AAD87E, 0xF1D754A0,
+	0xAAC12DEC, 0xE2BCA132, 0x3A3A3450, 0x7247B88E, 0x7BF24247, 0x338FCE99, 0xEB095BFB, 0xA374D725,
+	0x5D25A963, 0x155825BD, 0xCDDEB0DF, 0x85A33C01, 0x8C16C6C8, 0xC46B4A16, 0x1CEDDF74, 0x549053AA,
+	0x0F862AE6, 0x47FBA638, 0x9F7D335A, 0xD700BF84, 0xDEB5454D, 0x96C8C993, 0x4E4E5CF1, 0x0633D02F,
+	0x4229FCAE, 0x0A547070, 0xD2D2E512, 0x9AAF69CC, 0x931A9305, 0xDB671FDB, 0x03E18AB9, 0x4B9C0667,
+	0x108A7F2B, 0x58F7F3F5, 0x80716697, 0xC80CEA49, 0xC1B91080, 0x89C49C5E, 0x5142093C, 0x193F85E2,
+	0xE76EFBA4, 0xAF13777A, 0x7795E218, 0x3FE86EC6, 0x365D940F, 0x7E2018D1, 0xA6A68DB3, 0xEEDB016D,
+	0xB5CD7821, 0xFDB0F4FF, 0x2536619D, 0x6D4BED43, 0x64FE178A, 0x2C839B54, 0xF4050E36, 0xBC7882E8,
+	0x7C315734, 0x344CDBEA, 0xECCA4E88, 0xA4B7C256, 0xAD02389F, 0xE57FB441, 0x3DF92123, 0x7584ADFD,
+	0x2E92D4B1, 0x66EF586F, 0xBE69CD0D, 0xF61441D3, 0xFFA1BB1A, 0xB7DC37C4, 0x6F5AA2A6, 0x27272E78,
+	0xD976503E, 0x910BDCE0, 0x498D4982, 0x01F0C55C, 0x08453F95, 0x4038B34B, 0x98BE2629, 0xD0C3AAF7,
+	0x8BD5D3BB, 0xC3A85F65, 0x1B2ECA07, 0x535346D9, 0x5AE6BC10, 0x129B30CE, 0xCA1DA5AC, 0x82602972,
+	0xC67A05F3, 0x8E07892D, 0x56811C4F, 0x1EFC9091, 0x17496A58, 0x5F34E686, 0x87B273E4, 0xCFCFFF3A,
+	0x94D98676, 0xDCA40AA8, 0x04229FCA, 0x4C5F1314, 0x45EAE9DD, 0x0D976503, 0xD511F061, 0x9D6C7CBF,
+	0x633D02F9, 0x2B408E27, 0xF3C61B45, 0xBBBB979B, 0xB20E6D52, 0xFA73E18C, 0x22F574EE, 0x6A88F830,
+	0x319E817C, 0x79E30DA2, 0xA16598C0, 0xE918141E, 0xE0ADEED7, 0xA8D06209, 0x7056F76B, 0x382B7BB5,
+	// Seed 0xDE
+	0x00000000, 0x42F847C9, 0x47277035, 0x05DF37FC, 0x4C991FCD, 0x0E615804, 0x0BBE6FF8, 0x49462831,
+	0x5BE5C03D, 0x191D87F4, 0x1CC2B008, 0x5E3AF7C1, 0x177CDFF0, 0x55849839, 0x505BAFC5, 0x12A3E80C,
+	0x751C7FDD, 0x37E43814, 0x323B0FE8, 0x70C34821, 0x39856010, 0x7B7D27D9, 0x7EA21025, 0x3C5A57EC,
+	0x2EF9BFE0, 0x6C01F829, 0x69DECFD5, 0x2B26881C, 0x6260A02D, 0x2098E7E4, 0x2547D018, 0x67BF97D1,
+	0x28EF001D, 0x6A1747D4, 0x6FC87028, 0x2D3037E1, 0x64761FD0, 0x268E5819, 0x23516FE5, 0x61A9282C,
+	0x730AC020, 0x31F287E9, 0x342DB015, 0x76D5F7DC, 0x3F93DFED, 0x7D6B9824, 0x78B4AFD8, 0x3A4CE811,
+	0x5DF37FC0, 0x1F0B3809, 0x1AD40FF5, 0x582C483C, 0x116A600D, 0x539227C4, 0x564D1038, 0x14B557F1,
+	0x0616BFFD, 0x44EEF834, 0x4131CFC8, 0x03C98801, 0x4A8FA030, 0x0877E7F9, 0x0DA8D005, 0x4F5097CC,
+	0x51DE003A, 0x132647F3, 0x16F9700F, 0x540137C6, 0x1D471FF7, 0x5FBF583E, 0x5A606FC2, 0x1898280B,
+	0x0A3BC007, 0x48C387CE, 0x4D1CB032, 0x0FE4F7FB, 0x46A2DFCA, 0x045A9803, 0x0185AFFF, 0x437DE836,
+	0x24C27FE7, 0x663A382E, 0x63E50FD2, 0x211D481B, 0x685B602A, 0x2AA327E3, 0x2F7C101F, 0x6D8457D6,
+	0x7F27BFDA, 0x3DDFF813, 0x3800CFEF, 0x7AF88826, 0x33BEA017, 0x7146E7DE, 0x7499D022, 0x366197EB,
+	0x79310027, 0x3BC947EE, 0x3E167012, 0x7CEE37DB, 0x35A81FEA, 0x77505823, 0x728F6FDF, 0x30772816,
+	0x22D4C01A, 0x602C87D3, 0x65F3B02F, 0x270BF7E6, 0x6E4DDFD7, 0x2CB5981E, 0x296AAFE2, 0x6B92E82B,
+	0x0C2D7FFA, 0x4ED53833, 0x4B0A0FCF, 0x09F24806, 0x40B46037, 0x024C27FE, 0x07931002, 0x456B57CB,
+	0x57C8BFC7, 0x1530F80E, 0x10EFCFF2, 0x5217883B, 0x1B51A00A, 0x59A9E7C3, 0x5C76D03F, 0x1E8E97F6,
+	0x616BFFD3, 0x2393B81A, 0x264C8FE6, 0x64B4C82F, 0x2DF2E01E, 0x6F0AA7D7, 0x6AD5902B, 0x282DD7E2,
+	0x3A8E3FEE, 0x78767827, 0x7DA94FDB, 0x3F510812, 0x76172023, 0x34EF67EA, 0x31305016, 0x73C817DF,
+	0x1477800E, 0x568FC7C7, 0x5350F03B, 0x11A8B7F2, 0x58EE9FC3, 0x1A16D80A, 0x1FC9EFF6, 0x5D31A83F,
+	0x4F924033, 0x0D6A07FA, 0x08B53006, 0x4A4D77CF, 0x030B5FFE, 0x41F31837, 0x442C2FCB, 0x06D46802,
+	0x4984FFCE, 0x0B7CB807, 0x0EA38FFB, 0x4C5BC832, 0x051DE003, 0x47E5A7CA, 0x423A9036, 0x00C2D7FF,
+	0x12613FF3, 0x5099783A, 0x55464FC6, 0x17BE080F, 0x5EF8203E, 0x1C0067F7, 0x19DF500B, 0x5B2717C2,
+	0x3C988013, 0x7E60C7DA, 0x7BBFF026, 0x3947B7EF, 0x70019FDE, 0x32F9D817, 0x3726EFEB, 0x75DEA822,
+	0x677D402E, 0x258507E7, 0x205A301B, 0x62A277D2, 0x2BE45FE3, 0x691C182A, 0x6CC32FD6, 0x2E3B681F,
+	0x30B5FFE9, 0x724DB820, 0x77928FDC, 0x356AC815, 0x7C2CE024, 0x3ED4A7ED, 0x3B0B9011, 0x79F3D7D8,
+	0x6B503FD4, 0x29A8781D, 0x2C774FE1, 0x6E8F0828, 0x27C92019, 0x653167D0, 0x60EE502C, 0x221617E5,
+	0x45A98034, 0x0751C7FD, 0x028EF001, 0x4076B7C8, 0x09309FF9, 0x4BC8D830, 0x4E17EFCC, 0x0CEFA805,
+	0x1E4C4009, 0x5CB407C0, 0x596B303C, 0x1B9377F5, 0x52D55FC4, 0x102D180D, 0x15F22FF1, 0x570A6838,
+	0x185AFFF4, 0x5AA2B83D, 0x5F7D8FC1, 0x1D85C808, 0x54C3E039, 0x163BA7F0, 0x13E4900C, 0x511CD7C5,
+	0x43BF3FC9, 0x01477800, 0x04984FFC, 0x46600835, 0x0F262004, 0x4DDE67CD, 0x48015031, 0x0AF917F8,
+	0x6D468029, 0x2FBEC7E0, 0x2A61F01C, 0x6899B7D5, 0x21DF9FE4, 0x6327D82D, 0x66F8EFD1, 0x2400A818,
+	0x36A34014, 0x745B07DD, 0x71843021, 0x337C77E8, 0x7A3A5FD9, 0x38C21810, 0x3D1D2FEC, 0x7FE56825,
+	// Seed 0xDF
+	0x00000000, 0x020B9531, 0x04172A62, 0x061CBF53, 0x082E54C4, 0x0A25C1F5, 0x0C397EA6, 0x0E32EB97,
+	0x105CA988, 0x12573CB9, 0x144B83EA, 0x164016DB, 0x1872FD4C, 0x1A79687D, 0x1C65D72E, 0x1E6E421F,
+	0x0C60CD9B, 0x0E6B58AA, 0x0877E7F9, 0x0A7C72C8, 0x044E995F, 0x06450C6E, 0x0059B33D, 0x0252260C,
+	0x1C3C6413, 0x1E37F122, 0x182B4E71, 0x1A20DB40, 0x141230D7, 0x1619A5E6, 0x10051AB5, 0x120E8F84,
+	0x18C19B36, 0x1ACA0E07, 0x1CD6B154, 0x1EDD2465, 0x10EFCFF2, 0x12E45AC3, 0x14F8E590, 0x16F370A1,
+	0x089D32BE, 0x0A96A78F, 0x0C8A18DC, 0x0E818DED, 0x00B3667A, 0x02B8F34B, 0x04A44C18, 0x06AFD929,
+	0x14A156AD, 0x16AAC39C, 0x10B67CCF, 0x12BDE9FE, 0x1C8F0269, 0x1E849758, 0x1898280B, 0x1A93BD3A,
+	0x04FDFF25, 0x06F66A14, 0x00EAD547, 0x02E14076, 0x0CD3ABE1, 0x0ED83ED0, 0x08C48183, 0x0ACF14B2,
+	0x1D5AA8E7, 0x1F513DD6, 0x194D8285, 0x1B4617B4, 0x1574FC23, 0x177F6912, 0x1163D641, 0x13684370,
+	0x0D06016F, 0x0F0D945E, 0x09112B0D, 0x0B1ABE3C, 0x052855AB, 0x0723C09A, 0x013F7FC9, 0x0334EAF8,
+	0x113A657C, 0x1331F04D, 0x152D4F1E, 0x1726DA2F, 0x191431B8, 0x1B1FA489, 0x1D031BDA, 0x1F088EEB,
+	0x0166CCF4, 0x036D59C5, 0x0571E696, 0x077A73A7, 0x09489830, 0x0B430D01, 0x0D5FB252, 0x0F542763,
+	0x059B33D1, 0x0790A6E0, 0x018C19B3, 0x03878C82, 0x0DB56715, 0x0FBEF224, 0x09A24D77, 0x0BA9D846,
+	0x15C79A59, 0x17CC0F68, 0x11D0B03B, 0x13DB250A, 0x1DE9CE9D, 0x1FE25BAC, 0x19FEE4FF, 0x1BF571CE,
+	0x09FBFE4A, 0x0BF06B7B, 0x0DECD428, 0x0FE74119, 0x01D5AA8E, 0x03DE3FBF, 0x05C280EC, 0x07C915DD,
+	0x19A757C2, 0x1BACC2F3, 0x1DB07DA0, 0x1FBBE891, 0x11890306, 0x13829637, 0x159E2964, 0x1795BC55,
+	0x166CCF45, 0x14675A74, 0x127BE527, 0x10707016, 0x1E429B81, 0x1C490EB0, 0x1A55B1E3, 0x185E24D2,
+	0x063066CD, 0x043BF3FC, 0x02274CAF, 0x002CD99E, 0x0E1E3209, 0x0C15A738, 0x0A09186B, 0x08028D5A,
+	0x1A0C02DE, 0x180797EF, 0x1E1B28BC, 0x1C10BD8D, 0x1222561A, 0x1029C32B, 0x16357C78, 0x143EE949,
+	0x0A50AB56, 0x085B3E67, 0x0E478134, 0x0C4C1405, 0x027EFF92, 0x00756AA3, 0x0669D5F0, 0x046240C1,
+	0x0EAD5473, 0x0CA6C142, 0x0ABA7E11, 0x08B1EB20, 0x068300B7, 0x04889586, 0x02942AD5, 0x009FBFE4,
+	0x1EF1FDFB, 0x1CFA68CA, 0x1AE6D799, 0x18ED42A8, 0x16DFA93F, 0x14D43C0E, 0x12C8835D, 0x10C3166C,
+	0x02CD99E8, 0x00C60CD9, 0x06DAB38A, 0x04D126BB, 0x0AE3CD2C, 0x08E8581D, 0x0EF4E74E, 0x0CFF727F,
+	0x12913060, 0x109AA551, 0x16861A02, 0x148D8F33, 0x1ABF64A4, 0x18B4F195, 0x1EA84EC6, 0x1CA3DBF7,
+	0x0B3667A2, 0x093DF293, 0x0F214DC0, 0x0D2AD8F1, 0x03183366, 0x0113A657, 0x070F1904, 0x05048C35,
+	0x1B6ACE2A, 0x19615B1B, 0x1F7DE448, 0x1D767179, 0x13449AEE, 0x114F0FDF, 0x1753B08C, 0x155825BD,
+	0x0756AA39, 0x055D3F08, 0x0341805B, 0x014A156A, 0x0F78FEFD, 0x0D736BCC, 0x0B6FD49F, 0x096441AE,
+	0x170A03B1, 0x15019680, 0x131D29D3, 0x1116BCE2, 0x1F245775, 0x1D2FC244, 0x1B337D17, 0x1938E826,
+	0x13F7FC94, 0x11FC69A5, 0x17E0D6F6, 0x15EB43C7, 0x1BD9A850, 0x19D23D61, 0x1FCE8232, 0x1DC51703,
+	0x03AB551C, 0x01A0C02D, 0x07BC7F7E, 0x05B7EA4F, 0x0B8501D8, 0x098E94E9, 0x0F922BBA, 0x0D99BE8B,
+	0x1F97310F, 0x1D9CA43E, 0x1B801B6D, 0x198B8E5C, 0x17B965CB, 0x15B2F0FA, 0x13AE4FA9, 0x11A5DA98,
+	0x0FCB9887, 0x0DC00DB6, 0x0BDCB2E5, 0x09D727D4, 0x07E5CC43, 0x05EE5972, 0x03F2E621, 0x01F97310,
+	// Seed 0xE0
+	0x00000000, 0xCD4C6251, 0xDA8D0053, 0x17C16202, 0xF50FC457, 0x3843A606, 0x2F82C404, 0xE2CEA655,
+	0xAA0A4C5F, 0x67462E0E, 0x70874C0C, 0xBDCB2E5D, 0x5F058808, 0x9249EA59, 0x8588885B, 0x48C4EA0A,
+	0x14015C4F, 0xD94D3E1E, 0xCE8C5C1C, 0x03C03E4D, 0xE10E9818, 0x2C42FA49, 0x3B83984B, 0xF6CFFA1A,
+	0xBE0B1010, 0x73477241, 0x64861043, 0xA9CA7212, 0x4B04D447, 0x8648B616, 0x9189D414, 0x5CC5B645,
+	0x2802B89E, 0xE54EDACF, 0xF28FB8CD, 0x3FC3DA9C, 0xDD0D7CC9, 0x10411E98, 0x07807C9A, 0xCACC1ECB,
+	0x8208F4C1, 0x4F449690, 0x5885F492, 0x95C996C3, 0x77073096, 0xBA4B52C7, 0xAD8A30C5, 0x60C65294,
+	0x3C03E4D1, 0xF14F8680, 0xE68EE482, 0x2BC286D3, 0xC90C2086, 0x044042D7, 0x138120D5, 0xDECD4284,
+	0x9609A88E, 0x5B45CADF, 0x4C84A8DD, 0x81C8CA8C, 0x63066CD9, 0xAE4A0E88, 0xB98B6C8A, 0x74C70EDB,
+	0x5005713C, 0x9D49136D, 0x8A88716F, 0x47C4133E, 0xA50AB56B, 0x6846D73A, 0x7F87B538, 0xB2CBD769,
+	0xFA0F3D63, 0x37435F32, 0x20823D30, 0xEDCE5F61, 0x0F00F934, 0xC24C9B65, 0xD58DF967, 0x18C19B36,
+	0x44042D73, 0x89484F22, 0x9E892D20, 0x53C54F71, 0xB10BE924, 0x7C478B75, 0x6B86E977, 0xA6CA8B26,
+	0xEE0E612C, 0x2342037D, 0x3483617F, 0xF9CF032E, 0x1B01A57B, 0xD64DC72A, 0xC18CA528, 0x0CC0C779,
+	0x7807C9A2, 0xB54BABF3, 0xA28AC9F1, 0x6FC6ABA0, 0x8D080DF5, 0x40446FA4, 0x57850DA6, 0x9AC96FF7,
+	0xD20D85FD, 0x1F41E7AC, 0x088085AE, 0xC5CCE7FF, 0x270241AA, 0xEA4E23FB, 0xFD8F41F9, 0x30C323A8,
+	0x6C0695ED, 0xA14AF7BC, 0xB68B95BE, 0x7BC7F7EF, 0x990951BA, 0x544533EB, 0x438451E9, 0x8EC833B8,
+	0xC60CD9B2, 0x0B40BBE3, 0x1C81D9E1, 0xD1CDBBB0, 0x33031DE5, 0xFE4F7FB4, 0xE98E1DB6, 0x24C27FE7,
+	0xA00AE278, 0x6D468029, 0x7A87E22B, 0xB7CB807A, 0x5505262F, 0x9849447E, 0x8F88267C, 0x42C4442D,
+	0x0A00AE27, 0xC74CCC76, 0xD08DAE74, 0x1DC1CC25, 0xFF0F6A70, 0x32430821, 0x25826A23, 0xE8CE0872,
+	0xB40BBE37, 0x7947DC66, 0x6E86BE64, 0xA3CADC35, 0x41047A60, 0x8C481831, 0x9B897A33, 0x56C51862,
+	0x1E01F268, 0xD34D9039, 0xC48CF23B, 0x09C0906A, 0xEB0E363F, 0x2642546E, 0x3183366C, 0xFCCF543D,
+	0x88085AE6, 0x454438B7, 0x52855AB5, 0x9FC938E4, 0x7D079EB1, 0xB04BFCE0, 0xA78A9EE2, 0x6AC6FCB3,
+	0x220216B9, 0xEF4E74E8, 0xF88F16EA, 0x35C374BB, 0xD70DD2EE, 0x1A41B0BF, 0x0D80D2BD, 0xC0CCB0EC,
+	0x9C0906A9, 0x514564F8, 0x468406FA, 0x8BC864AB, 0x6906C2FE, 0xA44AA0AF, 0xB38BC2AD, 0x7EC7A0FC,
+	0x36034AF6, 0xFB4F28A7, 0xEC8E4AA5, 0x21C228F4, 0xC30C8EA1, 0x0E40ECF0, 0x19818EF2, 0xD4CDECA3,
+	0xF00F9344, 0x3D43F115, 0x2A829317, 0xE7CEF146, 0x05005713, 0xC84C3542, 0xDF8D5740, 0x12C13511,
+	0x5A05DF1B, 0x9749BD4A, 0x8088DF48, 0x4DC4BD19, 0xAF0A1B4C, 0x6246791D, 0x75871B1F, 0xB8CB794E,
+	0xE40ECF0B, 0x2942AD5A, 0x3E83CF58, 0xF3CFAD09, 0x11010B5C, 0xDC4D690D, 0xCB8C0B0F, 0x06C0695E,
+	0x4E048354, 0x8348E105, 0x94898307, 0x59C5E156, 0xBB0B4703, 0x76472552, 0x61864750, 0xACCA2501,
+	0xD80D2BDA, 0x1541498B, 0x02802B89, 0xCFCC49D8, 0x2D02EF8D, 0xE04E8DDC, 0xF78FEFDE, 0x3AC38D8F,
+	0x72076785, 0xBF4B05D4, 0xA88A67D6, 0x65C60587, 0x8708A3D2, 0x4A44C183, 0x5D85A381, 0x90C9C1D0,
+	0xCC0C7795, 0x014015C4, 0x168177C6, 0xDBCD1597, 0x3903B3C2, 0xF44FD193, 0xE38EB391, 0x2EC2D1C0,
+	0x66063BCA, 0xAB4A599B, 0xBC8B3B99, 0x71C759C8, 0x9309FF9D, 0x5E459DCC, 0x4984FFCE, 0x84C89D9F,
+	// Seed 0xE1
+	0x00000000, 0x61E0416B, 0xC3C082D6, 0xA220C3BD, 0x299AA071, 0x487AE11A, 0xEA5A22A7, 0x8BBA63CC,
+	0x533540E2, 0x32D50189, 0x90F5C234, 0xF115835F, 0x7AAFE093, 0x1B4FA1F8, 0xB96F6245, 0xD88F232E,
+	0xA66A81C4, 0xC78AC0AF, 0x65AA0312, 0x044A4279, 0x8FF021B5, 0xEE1060DE, 0x4C30A363, 0x2DD0E208,
+	0xF55FC126, 0x94BF804D, 0x369F43F0, 0x577F029B, 0xDCC56157, 0xBD25203C, 0x1F05E381, 0x7EE5A2EA,
+	0xE2CEA655, 0x832EE73E, 0x210E2483, 0x40EE65E8, 0xCB540624, 0xAAB4474F, 0x089484F2, 0x6974C599,
+	0xB1FBE6B7, 0xD01BA7DC, 0x723B6461, 0x13DB250A, 0x986146C6, 0xF98107AD, 0x5BA1C410, 0x3A41857B,
+	0x44A42791, 0x254466FA, 0x8764A547, 0xE684E42C, 0x6D3E87E0, 0x0CDEC68B, 0xAEFE0536, 0xCF1E445D,
+	0x17916773, 0x76712618, 0xD451E5A5, 0xB5B1A4CE, 0x3E0BC702, 0x5FEB8669, 0xFDCB45D4, 0x9C2B04BF,
+	0x6B86E977, 0x0A66A81C, 0xA8466BA1, 0xC9A62ACA, 0x421C4906, 0x23FC086D, 0x81DCCBD0, 0xE03C8ABB,
+	0x38B3A995, 0x5953E8FE, 0xFB732B43, 0x9A936A28, 0x112909E4, 0x70C9488F, 0xD2E98B32, 0xB309CA59,
+	0xCDEC68B3, 0xAC0C29D8, 0x0E2CEA65, 0x6FCCAB0E, 0xE476C8C2, 0x859689A9, 0x27B64A14, 0x46560B7F,
+	0x9ED92851, 0xFF39693A, 0x5D19AA87, 0x3CF9EBEC, 0xB7438820, 0xD6A3C94B, 0x74830AF6, 0x15634B9D,
+	0x89484F22, 0xE8A80E49, 0x4A88CDF4, 0x2B688C9F, 0xA0D2EF53, 0xC132AE38, 0x63126D85, 0x02F22CEE,
+	0xDA7D0FC0, 0xBB9D4EAB, 0x19BD8D16, 0x785DCC7D, 0xF3E7AFB1, 0x9207EEDA, 0x30272D67, 0x51C76C0C,
+	0x2F22CEE6, 0x4EC28F8D, 0xECE24C30, 0x8D020D5B, 0x06B86E97, 0x67582FFC, 0xC578EC41, 0xA498AD2A,
+	0x7C178E04, 0x1DF7CF6F, 0xBFD70CD2, 0xDE374DB9, 0x558D2E75, 0x346D6F1E, 0x964DACA3, 0xF7ADEDC8,
+	0xD70DD2EE, 0xB6ED9385, 0x14CD5038, 0x752D1153, 0xFE97729F, 0x9F7733F4, 0x3D57F049, 0x5CB7B122,
+	0x8438920C, 0xE5D8D367, 0x47F810DA, 0x261851B1, 0xADA2327D, 0xCC427316, 0x6E62B0AB, 0x0F82F1C0,
+	0x7167532A, 0x10871241, 0xB2A7D1FC, 0xD3479097, 0x58FDF35B, 0x391DB230, 0x9B3D718D, 0xFADD30E6,
+	0x225213C8, 0x43B252A3, 0xE192911E, 0x8072D075, 0x0BC8B3B9, 0x6A28F2D2, 0xC808316F, 0xA9E87004,
+	0x35C374BB, 0x542335D0, 0xF603F66D, 0x97E3B706, 0x1C59D4CA, 0x7DB995A1, 0xDF99561C, 0xBE791777,
+	0x66F63459, 0x07167532, 0xA536B68F, 0xC4D6F7E4, 0x4F6C9428, 0x2E8CD543, 0x8CAC16FE, 0xED4C5795,
+	0x93A9F57F, 0xF249B414, 0x506977A9, 0x318936C2, 0xBA33550E, 0xDBD31465, 0x79F3D7D8, 0x181396B3,
+	0xC09CB59D, 0xA17CF4F6, 0x035C374B, 0x62BC7620, 0xE90615EC, 0x88E65487, 0x2AC6973A, 0x4B26D651,
+	0xBC8B3B99, 0xDD6B7AF2, 0x7F4BB94F, 0x1EABF824, 0x95119BE8, 0xF4F1DA83, 0x56D1193E, 0x37315855,
+	0xEFBE7B7B, 0x8E5E3A10, 0x2C7EF9AD, 0x4D9EB8C6, 0xC624DB0A, 0xA7C49A61, 0x05E459DC, 0x640418B7,
+	0x1AE1BA5D, 0x7B01FB36, 0xD921388B, 0xB8C179E0, 0x337B1A2C, 0x529B5B47, 0xF0BB98FA, 0x915BD991,
+	0x49D4FABF, 0x2834BBD4, 0x8A147869, 0xEBF43902, 0x604E5ACE, 0x01AE1BA5, 0xA38ED818, 0xC26E9973,
+	0x5E459DCC, 0x3FA5DCA7, 0x9D851F1A, 0xFC655E71, 0x77DF3DBD, 0x163F7CD6, 0xB41FBF6B, 0xD5FFFE00,
+	0x0D70DD2E, 0x6C909C45, 0xCEB05FF8, 0xAF501E93, 0x24EA7D5F, 0x450A3C34, 0xE72AFF89, 0x86CABEE2,
+	0xF82F1C08, 0x99CF5D63, 0x3BEF9EDE, 0x5A0FDFB5, 0xD1B5BC79, 0xB055FD12, 0x12753EAF, 0x73957FC4,
+	0xAB1A5CEA, 0xCAFA1D81, 0x68DADE3C, 0x093A9F57, 0x8280FC9B, 0xE360BDF0, 0x41407E4D, 0x20A03F26,
+	// Seed 0xE2
+	0x00000000, 0x7EFBA318, 0x61FE4099, 0x1F05E381, 0x5FF5879B, 0x210E2483, 0x3E0BC702, 0x40F0641A,
+	0x23E2099F, 0x5D19AA87, 0x421C4906, 0x3CE7EA1E, 0x7C178E04, 0x02EC2D1C, 0x1DE9CE9D, 0x63126D85,
+	0x47C4133E, 0x393FB026, 0x263A53A7, 0x58C1F0BF, 0x183194A5, 0x66CA37BD, 0x79CFD43C, 0x07347724,
+	0x64261AA1, 0x1ADDB9B9, 0x05D85A38, 0x7B23F920, 0x3BD39D3A, 0x45283E22, 0x5A2DDDA3, 0x24D67EBB,
+	0x138120D5, 0x6D7A83CD, 0x727F604C, 0x0C84C354, 0x4C74A74E, 0x328F0456, 0x2D8AE7D7, 0x537144CF,
+	0x3063294A, 0x4E988A52, 0x519D69D3, 0x2F66CACB, 0x6F96AED1, 0x116D0DC9, 0x0E68EE48, 0x70934D50,
+	0x544533EB, 0x2ABE90F3, 0x35BB7372, 0x4B40D06A, 0x0BB0B470, 0x754B1768, 0x6A4EF4E9, 0x14B557F1,
+	0x77A73A74, 0x095C996C, 0x16597AED, 0x68A2D9F5, 0x2852BDEF, 0x56A91EF7, 0x49ACFD76, 0x37575E6E,
+	0x270241AA, 0x59F9E2B2, 0x46FC0133, 0x3807A22B, 0x78F7C631, 0x060C6529, 0x190986A8, 0x67F225B0,
+	0x04E04835, 0x7A1BEB2D, 0x651E08AC, 0x1BE5ABB4, 0x5B15CFAE, 0x25EE6CB6, 0x3AEB8F37, 0x44102C2F,
+	0x60C65294, 0x1E3DF18C, 0x0138120D, 0x7FC3B115, 0x3F33D50F, 0x41C87617, 0x5ECD9596, 0x2036368E,
+	0x43245B0B, 0x3DDFF813, 0x22DA1B92, 0x5C21B88A, 0x1CD1DC90, 0x622A7F88, 0x7D2F9C09, 0x03D43F11,
+	0x3483617F, 0x4A78C267, 0x557D21E6, 0x2B8682FE, 0x6B76E6E4, 0x158D45FC, 0x0A88A67D, 0x74730565,
+	0x176168E0, 0x699ACBF8, 0x769F2879, 0x08648B61, 0x4894EF7B, 0x366F4C63, 0x296AAFE2, 0x57910CFA,
+	0x73477241, 0x0DBCD159, 0x12B932D8, 0x6C4291C0, 0x2CB2F5DA, 0x524956C2, 0x4D4CB543, 0x33B7165B,
+	0x50A57BDE, 0x2E5ED8C6, 0x315B3B47, 0x4FA0985F, 0x0F50FC45, 0x71AB5F5D, 0x6EAEBCDC, 0x10551FC4,
+	0x4E048354, 0x30FF204C, 0x2FFAC3CD, 0x510160D5, 0x11F104CF, 0x6F0AA7D7, 0x700F4456, 0x0EF4E74E,
+	0x6DE68ACB, 0x131D29D3, 0x0C18CA52, 0x72E3694A, 0x32130D50, 0x4CE8AE48, 0x53ED4DC9, 0x2D16EED1,
+	0x09C0906A, 0x773B3372, 0x683ED0F3, 0x16C573EB, 0x563517F1, 0x28CEB4E9, 0x37CB5768, 0x4930F470,
+	0x2A2299F5, 0x54D93AED, 0x4BDCD96C, 0x35277A74, 0x75D71E6E, 0x0B2CBD76, 0x14295EF7, 0x6AD2FDEF,
+	0x5D85A381, 0x237E0099, 0x3C7BE318, 0x42804000, 0x0270241A, 0x7C8B8702, 0x638E6483, 0x1D75C79B,
+	0x7E67AA1E, 0x009C0906, 0x1F99EA87, 0x6162499F, 0x21922D85, 0x5F698E9D, 0x406C6D1C, 0x3E97CE04,
+	0x1A41B0BF, 0x64BA13A7, 0x7BBFF026, 0x0544533E, 0x45B43724, 0x3B4F943C, 0x244A77BD, 0x5AB1D4A5,
+	0x39A3B920, 0x47581A38, 0x585DF9B9, 0x26A65AA1, 0x66563EBB, 0x18AD9DA3, 0x07A87E22, 0x7953DD3A,
+	0x6906C2FE, 0x17FD61E6, 0x08F88267, 0x7603217F, 0x36F34565, 0x4808E67D, 0x570D05FC, 0x29F6A6E4,
+	0x4AE4CB61, 0x341F6879, 0x2B1A8BF8, 0x55E128E0, 0x15114CFA, 0x6BEAEFE2, 0x74EF0C63, 0x0A14AF7B,
+	0x2EC2D1C0, 0x503972D8, 0x4F3C9159, 0x31C73241, 0x7137565B, 0x0FCCF543, 0x10C916C2, 0x6E32B5DA,
+	0x0D20D85F, 0x73DB7B47, 0x6CDE98C6, 0x12253BDE, 0x52D55FC4, 0x2C2EFCDC, 0x332B1F5D, 0x4DD0BC45,
+	0x7A87E22B, 0x047C4133, 0x1B79A2B2, 0x658201AA, 0x257265B0, 0x5B89C6A8, 0x448C2529, 0x3A778631,
+	0x5965EBB4, 0x279E48AC, 0x389BAB2D, 0x46600835, 0x06906C2F, 0x786BCF37, 0x676E2CB6, 0x19958FAE,
+	0x3D43F115, 0x43B8520D, 0x5CBDB18C, 0x22461294, 0x62B6768E, 0x1C4DD596, 0x03483617, 0x7DB3950F,
+	0x1EA1F88A, 0x605A5B92, 0x7F5FB813, 0x01A41B0B, 0x41547F11, 0x3FAFDC09, 0x20AA3F88, 0x5E519C90,
+	// Seed 0xE3
+	0x00000000, 0x231806A2, 0x34376AC1, 0x172F6C63, 0x1A69B207, 0x3971B4A5, 0x2E5ED8C6, 0x0D46DE64,
+	0x34D3640E, 0x17CB62AC, 0x00E40ECF, 0x23FC086D, 0x2EBAD609, 0x0DA2D0AB, 0x1A8DBCC8, 0x3995BA6A,
+	0x1BA1AF99, 0x38B9A93B, 0x2F96C558, 0x0C8EC3FA, 0x01C81D9E, 0x22D01B3C, 0x35FF775F, 0x16E771FD,
+	0x2F72CB97, 0x0C6ACD35, 0x1B45A156, 0x385DA7F4, 0x351B7990, 0x16037F32, 0x012C1351, 0x223415F3,
+	0x37435F32, 0x145B5990, 0x037435F3, 0x206C3351, 0x2D2AED35, 0x0E32EB97, 0x191D87F4, 0x3A058156,
+	0x03903B3C, 0x20883D9E, 0x37A751FD, 0x14BF575F, 0x19F9893B, 0x3AE18F99, 0x2DCEE3FA, 0x0ED6E558,
+	0x2CE2F0AB, 0x0FFAF609, 0x18D59A6A, 0x3BCD9CC8, 0x368B42AC, 0x1593440E, 0x02BC286D, 0x21A42ECF,
+	0x183194A5, 0x3B299207, 0x2C06FE64, 0x0F1EF8C6, 0x025826A2, 0x21402000, 0x366F4C63, 0x15774AC1,
+	0x1C81D9E1, 0x3F99DF43, 0x28B6B320, 0x0BAEB582, 0x06E86BE6, 0x25F06D44, 0x32DF0127, 0x11C70785,
+	0x2852BDEF, 0x0B4ABB4D, 0x1C65D72E, 0x3F7DD18C, 0x323B0FE8, 0x1123094A, 0x060C6529, 0x2514638B,
+	0x07207678, 0x243870DA, 0x33171CB9, 0x100F1A1B, 0x1D49C47F, 0x3E51C2DD, 0x297EAEBE, 0x0A66A81C,
+	0x33F31276, 0x10EB14D4, 0x07C478B7, 0x24DC7E15, 0x299AA071, 0x0A82A6D3, 0x1DADCAB0, 0x3EB5CC12,
+	0x2BC286D3, 0x08DA8071, 0x1FF5EC12, 0x3CEDEAB0, 0x31AB34D4, 0x12B33276, 0x059C5E15, 0x268458B7,
+	0x1F11E2DD, 0x3C09E47F, 0x2B26881C, 0x083E8EBE, 0x057850DA, 0x26605678, 0x314F3A1B, 0x12573CB9,
+	0x3063294A, 0x137B2FE8, 0x0454438B, 0x274C4529, 0x2A0A9B4D, 0x09129DEF, 0x1E3DF18C, 0x3D25F72E,
+	0x04B04D44, 0x27A84BE6, 0x30872785, 0x139F2127, 0x1ED9FF43, 0x3DC1F9E1, 0x2AEE9582, 0x09F69320,
+	0x3903B3C2, 0x1A1BB560, 0x0D34D903, 0x2E2CDFA1, 0x236A01C5, 0x00720767, 0x175D6B04, 0x34456DA6,
+	0x0DD0D7CC, 0x2EC8D16E, 0x39E7BD0D, 0x1AFFBBAF, 0x17B965CB, 0x34A16369, 0x238E0F0A, 0x009609A8,
+	0x22A21C5B, 0x01BA1AF9, 0x1695769A, 0x358D7038, 0x38CBAE5C, 0x1BD3A8FE, 0x0CFCC49D, 0x2FE4C23F,
+	0x16717855, 0x35697EF7, 0x22461294, 0x015E1436, 0x0C18CA52, 0x2F00CCF0, 0x382FA093, 0x1B37A631,
+	0x0E40ECF0, 0x2D58EA52, 0x3A778631, 0x196F8093, 0x14295EF7, 0x37315855, 0x201E3436, 0x03063294,
+	0x3A9388FE, 0x198B8E5C, 0x0EA4E23F, 0x2DBCE49D, 0x20FA3AF9, 0x03E23C5B, 0x14CD5038, 0x37D5569A,
+	0x15E14369, 0x36F945CB, 0x21D629A8, 0x02CE2F0A, 0x0F88F16E, 0x2C90F7CC, 0x3BBF9BAF, 0x18A79D0D,
+	0x21322767, 0x022A21C5, 0x15054DA6, 0x361D4B04, 0x3B5B9560, 0x184393C2, 0x0F6CFFA1, 0x2C74F903,
+	0x25826A23, 0x069A6C81, 0x11B500E2, 0x32AD0640, 0x3FEBD824, 0x1CF3DE86, 0x0BDCB2E5, 0x28C4B447,
+	0x11510E2D, 0x3249088F, 0x256664EC, 0x067E624E, 0x0B38BC2A, 0x2820BA88, 0x3F0FD6EB, 0x1C17D049,
+	0x3E23C5BA, 0x1D3BC318, 0x0A14AF7B, 0x290CA9D9, 0x244A77BD, 0x0752711F, 0x107D1D7C, 0x33651BDE,
+	0x0AF0A1B4, 0x29E8A716, 0x3EC7CB75, 0x1DDFCDD7, 0x109913B3, 0x33811511, 0x24AE7972, 0x07B67FD0,
+	0x12C13511, 0x31D933B3, 0x26F65FD0, 0x05EE5972, 0x08A88716, 0x2BB081B4, 0x3C9FEDD7, 0x1F87EB75,
+	0x2612511F, 0x050A57BD, 0x12253BDE, 0x313D3D7C, 0x3C7BE318, 0x1F63E5BA, 0x084C89D9, 0x2B548F7B,
+	0x09609A88, 0x2A789C2A, 0x3D57F049, 0x1E4FF6EB, 0x1309288F, 0x30112E2D, 0x273E424E, 0x042644EC,
+	0x3DB3FE86, 0x1EABF824, 0x09849447, 0x2A9C92E5, 0x27DA4C81, 0x04C24A23, 0x13ED2640, 0x30F520E2,
+	// Seed 0xE4
+	0x00000000, 0x31AB34D4, 0x635669A8, 0x52FD5D7C, 0xC6ACD350, 0xF707E784, 0xA5FABAF8, 0x94518E2C,
+	0xC397EA63, 0xF23CDEB7, 0xA0C183CB, 0x916AB71F, 0x053B3933, 0x34900DE7, 0x666D509B, 0x57C6644F,
+	0xC9E19805, 0xF84AACD1, 0xAAB7F1AD, 0x9B1CC579, 0x0F4D4B55, 0x3EE67F81, 0x6C1B22FD, 0x5DB01629,
+	0x0A767266, 0x3BDD46B2, 0x69201BCE, 0x588B2F1A, 0xCCDAA136, 0xFD7195E2, 0xAF8CC89E, 0x9E27FC4A,
+	0xDD0D7CC9, 0xECA6481D, 0xBE5B1561, 0x8FF021B5, 0x1BA1AF99, 0x2A0A9B4D, 0x78F7C631, 0x495CF2E5,
+	0x1E9A96AA, 0x2F31A27E, 0x7DCCFF02, 0x4C67CBD6, 0xD83645FA, 0xE99D712E, 0xBB602C52, 0x8ACB1886,
+	0x14ECE4CC, 0x2547D018, 0x77BA8D64, 0x4611B9B0, 0xD240379C, 0xE3EB0348, 0xB1165E34, 0x80BD6AE0,
+	0xD77B0EAF, 0xE6D03A7B, 0xB42D6707, 0x858653D3, 0x11D7DDFF, 0x207CE92B, 0x7281B457, 0x432A8083,
+	0xF4D4B551, 0xC57F8185, 0x9782DCF9, 0xA629E82D, 0x32786601, 0x03D352D5, 0x512E0FA9, 0x60853B7D,
+	0x37435F32, 0x06E86BE6, 0x5415369A, 0x65BE024E, 0xF1EF8C62, 0xC044B8B6, 0x92B9E5CA, 0xA312D11E,
+	0x3D352D54, 0x0C9E1980, 0x5E6344FC, 0x6FC87028, 0xFB99FE04, 0xCA32CAD0, 0x98CF97AC, 0xA964A378,
+	0xFEA2C737, 0xCF09F3E3, 0x9DF4AE9F, 0xAC5F9A4B, 0x380E1467, 0x09A520B3, 0x5B587DCF, 0x6AF3491B,
+	0x29D9C998, 0x1872FD4C, 0x4A8FA030, 0x7B2494E4, 0xEF751AC8, 0xDEDE2E1C, 0x8C237360, 0xBD8847B4,
+	0xEA4E23FB, 0xDBE5172F, 0x89184A53, 0xB8B37E87, 0x2CE2F0AB, 0x1D49C47F, 0x4FB49903, 0x7E1FADD7,
+	0xE038519D, 0xD1936549, 0x836E3835, 0xB2C50CE1, 0x269482CD, 0x173FB619, 0x45C2EB65, 0x7469DFB1,
+	0x23AFBBFE, 0x12048F2A, 0x40F9D256, 0x7152E682, 0xE50368AE, 0xD4A85C7A, 0x86550106, 0xB7FE35D2,
+	0xA7672661, 0x96CC12B5, 0xC4314FC9, 0xF59A7B1D, 0x61CBF531, 0x5060C1E5, 0x029D9C99, 0x3336A84D,
+	0x64F0CC02, 0x555BF8D6, 0x07A6A5AA, 0x360D917E, 0xA25C1F52, 0x93F72B86, 0xC10A76FA, 0xF0A1422E,
+	0x6E86BE64, 0x5F2D8AB0, 0x0DD0D7CC, 0x3C7BE318, 0xA82A6D34, 0x998159E0, 0xCB7C049C, 0xFAD73048,
+	0xAD115407, 0x9CBA60D3, 0xCE473DAF, 0xFFEC097B, 0x6BBD8757, 0x5A16B383, 0x08EBEEFF, 0x3940DA2B,
+	0x7A6A5AA8, 0x4BC16E7C, 0x193C3300, 0x289707D4, 0xBCC689F8, 0x8D6DBD2C, 0xDF90E050, 0xEE3BD484,
+	0xB9FDB0CB, 0x8856841F, 0xDAABD963, 0xEB00EDB7, 0x7F51639B, 0x4EFA574F, 0x1C070A33, 0x2DAC3EE7,
+	0xB38BC2AD, 0x8220F679, 0xD0DDAB05, 0xE1769FD1, 0x752711FD, 0x448C2529, 0x16717855, 0x27DA4C81,
+	0x701C28CE, 0x41B71C1A, 0x134A4166, 0x22E175B2, 0xB6B0FB9E, 0x871BCF4A, 0xD5E69236, 0xE44DA6E2,
+	0x53B39330, 0x6218A7E4, 0x30E5FA98, 0x014ECE4C, 0x951F4060, 0xA4B474B4, 0xF64929C8, 0xC7E21D1C,
+	0x90247953, 0xA18F4D87, 0xF37210FB, 0xC2D9242F, 0x5688AA03, 0x67239ED7, 0x35DEC3AB, 0x0475F77F,
+	0x9A520B35, 0xABF93FE1, 0xF904629D, 0xC8AF5649, 0x5CFED865, 0x6D55ECB1, 0x3FA8B1CD, 0x0E038519,
+	0x59C5E156, 0x686ED582, 0x3A9388FE, 0x0B38BC2A, 0x9F693206, 0xAEC206D2, 0xFC3F5BAE, 0xCD946F7A,
+	0x8EBEEFF9, 0xBF15DB2D, 0xEDE88651, 0xDC43B285, 0x48123CA9, 0x79B9087D, 0x2B445501, 0x1AEF61D5,
+	0x4D29059A, 0x7C82314E, 0x2E7F6C32, 0x1FD458E6, 0x8B85D6CA, 0xBA2EE21E, 0xE8D3BF62, 0xD9788BB6,
+	0x475F77FC, 0x76F44328, 0x24091E54, 0x15A22A80, 0x81F3A4AC, 0xB0589078, 0xE2A5CD04, 0xD30EF9D0,
+	0x84C89D9F, 0xB563A94B, 0xE79EF437, 0xD635C0E3, 0x42644ECF, 0x73CF7A1B, 0x21322767, 0x109913B3,
+	// Seed 0xE5
+	0x00000000, 0x70DD49D3, 0xE1BA93A6, 0x9167DA75, 0x63B50AA3, 0x13684370, 0x820F9905, 0xF2D2D0D6,
+	0xC76A1546, 0xB7B75C95, 0x26D086E0, 0x560DCF33, 0xA4DF1FE5, 0xD4025636, 0x45658C43, 0x35B8C590,
+	0x2E140763, 0x5EC94EB0, 0xCFAE94C5, 0xBF73DD16, 0x4DA10DC0, 0x3D7C4413, 0xAC1B9E66, 0xDCC6D7B5,
+	0xE97E1225, 0x99A35BF6, 0x08C48183, 0x7819C850, 0x8ACB1886, 0xFA165155, 0x6B718B20, 0x1BACC2F3,
+	0x5C280EC6, 0x2CF54715, 0xBD929D60, 0xCD4FD4B3, 0x3F9D0465, 0x4F404DB6, 0xDE2797C3, 0xAEFADE10,
+	0x9B421B80, 0xEB9F5253, 0x7AF88826, 0x0A25C1F5, 0xF8F71123, 0x882A58F0, 0x194D8285, 0x6990CB56,
+	0x723C09A5, 0x02E14076, 0x93869A03, 0xE35BD3D0, 0x11890306, 0x61544AD5, 0xF03390A0, 0x80EED973,
+	0xB5561CE3, 0xC58B5530, 0x54EC8F45, 0x2431C696, 0xD6E31640, 0xA63E5F93, 0x375985E6, 0x4784CC35,
+	0xB8501D8C, 0xC88D545F, 0x59EA8E2A, 0x2937C7F9, 0xDBE5172F, 0xAB385EFC, 0x3A5F8489, 0x4A82CD5A,
+	0x7F3A08CA, 0x0FE74119, 0x9E809B6C, 0xEE5DD2BF, 0x1C8F0269, 0x6C524BBA, 0xFD3591CF, 0x8DE8D81C,
+	0x96441AEF, 0xE699533C, 0x77FE8949, 0x0723C09A, 0xF5F1104C, 0x852C599F, 0x144B83EA, 0x6496CA39,
+	0x512E0FA9, 0x21F3467A, 0xB0949C0F, 0xC049D5DC, 0x329B050A, 0x42464CD9, 0xD32196AC, 0xA3FCDF7F,
+	0xE478134A, 0x94A55A99, 0x05C280EC, 0x751FC93F, 0x87CD19E9, 0xF710503A, 0x66778A4F, 0x16AAC39C,
+	0x2312060C, 0x53CF4FDF, 0xC2A895AA, 0xB275DC79, 0x40A70CAF, 0x307A457C, 0xA11D9F09, 0xD1C0D6DA,
+	0xCA6C1429, 0xBAB15DFA, 0x2BD6878F, 0x5B0BCE5C, 0xA9D91E8A, 0xD9045759, 0x48638D2C, 0x38BEC4FF,
+	0x0D06016F, 0x7DDB48BC, 0xECBC92C9, 0x9C61DB1A, 0x6EB30BCC, 0x1E6E421F, 0x8F09986A, 0xFFD4D1B9,
+	0xD06016F7, 0xA0BD5F24, 0x31DA8551, 0x4107CC82, 0xB3D51C54, 0xC3085587, 0x526F8FF2, 0x22B2C621,
+	0x170A03B1, 0x67D74A62, 0xF6B09017, 0x866DD9C4, 0x74BF0912, 0x046240C1, 0x95059AB4, 0xE5D8D367,
+	0xFE741194, 0x8EA95847, 0x1FCE8232, 0x6F13CBE1, 0x9DC11B37, 0xED1C52E4, 0x7C7B8891, 0x0CA6C142,
+	0x391E04D2, 0x49C34D01, 0xD8A49774, 0xA879DEA7, 0x5AAB0E71, 0x2A7647A2, 0xBB119DD7, 0xCBCCD404,
+	0x8C481831, 0xFC9551E2, 0x6DF28B97, 0x1D2FC244, 0xEFFD1292, 0x9F205B41, 0x0E478134, 0x7E9AC8E7,
+	0x4B220D77, 0x3BFF44A4, 0xAA989ED1, 0xDA45D702, 0x289707D4, 0x584A4E07, 0xC92D9472, 0xB9F0DDA1,
+	0xA25C1F52, 0xD2815681, 0x43E68CF4, 0x333BC527, 0xC1E915F1, 0xB1345C22, 0x20538657, 0x508ECF84,
+	0x65360A14, 0x15EB43C7, 0x848C99B2, 0xF451D061, 0x068300B7, 0x765E4964, 0xE7399311, 0x97E4DAC2,
+	0x68300B7B, 0x18ED42A8, 0x898A98DD, 0xF957D10E, 0x0B8501D8, 0x7B58480B, 0xEA3F927E, 0x9AE2DBAD,
+	0xAF5A1E3D, 0xDF8757EE, 0x4EE08D9B, 0x3E3DC448, 0xCCEF149E, 0xBC325D4D, 0x2D558738, 0x5D88CEEB,
+	0x46240C18, 0x36F945CB, 0xA79E9FBE, 0xD743D66D, 0x259106BB, 0x554C4F68, 0xC42B951D, 0xB4F6DCCE,
+	0x814E195E, 0xF193508D, 0x60F48AF8, 0x1029C32B, 0xE2FB13FD, 0x92265A2E, 0x0341805B, 0x739CC988,
+	0x341805BD, 0x44C54C6E, 0xD5A2961B, 0xA57FDFC8, 0x57AD0F1E, 0x277046CD, 0xB6179CB8, 0xC6CAD56B,
+	0xF37210FB, 0x83AF5928, 0x12C8835D, 0x6215CA8E, 0x90C71A58, 0xE01A538B, 0x717D89FE, 0x01A0C02D,
+	0x1A0C02DE, 0x6AD14B0D, 0xFBB69178, 0x8B6BD8AB, 0x79B9087D, 0x096441AE, 0x98039BDB, 0xE8DED208,
+	0xDD661798, 0xADBB5E4B, 0x3CDC843E, 0x4C01CDED, 0xBED31D3B, 0xCE0E54E8, 0x5F698E9D, 0x2FB4C74E,
+	// Seed 0xE6
+	0x00000000, 0x27489E0F, 0x4E913C1E, 0x69D9A211, 0x0FF0F6A7, 0x28B868A8, 0x4161CAB9, 0x662954B6,
+	0x1FE1ED4E, 0x38A97341, 0x5170D150, 0x76384F5F, 0x10111BE9, 0x375985E6, 0x5E8027F7, 0x79C8B9F8,
+	0x3FC3DA9C, 0x188B4493, 0x7152E682, 0x561A788D, 0x30332C3B, 0x177BB234, 0x7EA21025, 0x59EA8E2A,
+	0x202237D2, 0x076AA9DD, 0x6EB30BCC, 0x49FB95C3, 0x2FD2C175, 0x089A5F7A, 0x6143FD6B, 0x460B6364,
+	0x7F87B538, 0x58CF2B37, 0x31168926, 0x165E1729, 0x7077439F, 0x573FDD90, 0x3EE67F81, 0x19AEE18E,
+	0x60665876, 0x472EC679, 0x2EF76468, 0x09BFFA67, 0x6F96AED1, 0x48DE30DE, 0x210792CF, 0x064F0CC0,
+	0x40446FA4, 0x670CF1AB, 0x0ED553BA, 0x299DCDB5, 0x4FB49903, 0x68FC070C, 0x0125A51D, 0x266D3B12,
+	0x5FA582EA, 0x78ED1CE5, 0x1134BEF4, 0x367C20FB, 0x5055744D, 0x771DEA42, 0x1EC44853, 0x398CD65C,
+	0x6DDDE4EB, 0x4A957AE4, 0x234CD8F5, 0x040446FA, 0x622D124C, 0x45658C43, 0x2CBC2E52, 0x0BF4B05D,
+	0x723C09A5, 0x557497AA, 0x3CAD35BB, 0x1BE5ABB4, 0x7DCCFF02, 0x5A84610D, 0x335DC31C, 0x14155D13,
+	0x521E3E77, 0x7556A078, 0x1C8F0269, 0x3BC79C66, 0x5DEEC8D0, 0x7AA656DF, 0x137FF4CE, 0x34376AC1,
+	0x4DFFD339, 0x6AB74D36, 0x036EEF27, 0x24267128, 0x420F259E, 0x6547BB91, 0x0C9E1980, 0x2BD6878F,
+	0x125A51D3, 0x3512CFDC, 0x5CCB6DCD, 0x7B83F3C2, 0x1DAAA774, 0x3AE2397B, 0x533B9B6A, 0x74730565,
+	0x0DBBBC9D, 0x2AF32292, 0x432A8083, 0x64621E8C, 0x024B4A3A, 0x2503D435, 0x4CDA7624, 0x6B92E82B,
+	0x2D998B4F, 0x0AD11540, 0x6308B751, 0x4440295E, 0x22697DE8, 0x0521E3E7, 0x6CF841F6, 0x4BB0DFF9,
+	0x32786601, 0x1530F80E, 0x7CE95A1F, 0x5BA1C410, 0x3D8890A6, 0x1AC00EA9, 0x7319ACB8, 0x545132B7,
+	0x4969474D, 0x6E21D942, 0x07F87B53, 0x20B0E55C, 0x4699B1EA, 0x61D12FE5, 0x08088DF4, 0x2F4013FB,
+	0x5688AA03, 0x71C0340C, 0x1819961D, 0x3F510812, 0x59785CA4, 0x7E30C2AB, 0x17E960BA, 0x30A1FEB5,
+	0x76AA9DD1, 0x51E203DE, 0x383BA1CF, 0x1F733FC0, 0x795A6B76, 0x5E12F579, 0x37CB5768, 0x1083C967,
+	0x694B709F, 0x4E03EE90, 0x27DA4C81, 0x0092D28E, 0x66BB8638, 0x41F31837, 0x282ABA26, 0x0F622429,
+	0x36EEF275, 0x11A66C7A, 0x787FCE6B, 0x5F375064, 0x391E04D2, 0x1E569ADD, 0x778F38CC, 0x50C7A6C3,
+	0x290F1F3B, 0x0E478134, 0x679E2325, 0x40D6BD2A, 0x26FFE99C, 0x01B77793, 0x686ED582, 0x4F264B8D,
+	0x092D28E9, 0x2E65B6E6, 0x47BC14F7, 0x60F48AF8, 0x06DDDE4E, 0x21954041, 0x484CE250, 0x6F047C5F,
+	0x16CCC5A7, 0x31845BA8, 0x585DF9B9, 0x7F1567B6, 0x193C3300, 0x3E74AD0F, 0x57AD0F1E, 0x70E59111,
+	0x24B4A3A6, 0x03FC3DA9, 0x6A259FB8, 0x4D6D01B7, 0x2B445501, 0x0C0CCB0E, 0x65D5691F, 0x429DF710,
+	0x3B554EE8, 0x1C1DD0E7, 0x75C472F6, 0x528CECF9, 0x34A5B84F, 0x13ED2640, 0x7A348451, 0x5D7C1A5E,
+	0x1B77793A, 0x3C3FE735, 0x55E64524, 0x72AEDB2B, 0x14878F9D, 0x33CF1192, 0x5A16B383, 0x7D5E2D8C,
+	0x04969474, 0x23DE0A7B, 0x4A07A86A, 0x6D4F3665, 0x0B6662D3, 0x2C2EFCDC, 0x45F75ECD, 0x62BFC0C2,
+	0x5B33169E, 0x7C7B8891, 0x15A22A80, 0x32EAB48F, 0x54C3E039, 0x738B7E36, 0x1A52DC27, 0x3D1A4228,
+	0x44D2FBD0, 0x639A65DF, 0x0A43C7CE, 0x2D0B59C1, 0x4B220D77, 0x6C6A9378, 0x05B33169, 0x22FBAF66,
+	0x64F0CC02, 0x43B8520D, 0x2A61F01C, 0x0D296E13, 0x6B003AA5, 0x4C48A4AA, 0x259106BB, 0x02D998B4,
+	0x7B11214C, 0x5C59BF43, 0x35801D52, 0x12C8835D, 0x74E1D7EB, 0x53A949E4, 0x3A70EBF5, 0x1D3875FA,
+	// Seed 0xE7
+	0x00000000, 0x32966860, 0x19F03F77, 0x2B665717, 0x33E07EEE, 0x0176168E, 0x2A104199, 0x188629F9,
+	0x1B1C126B, 0x298A7A0B, 0x02EC2D1C, 0x307A457C, 0x28FC6C85, 0x1A6A04E5, 0x310C53F2, 0x039A3B92,
+	0x363824D6, 0x04AE4CB6, 0x2FC81BA1, 0x1D5E73C1, 0x05D85A38, 0x374E3258, 0x1C28654F, 0x2EBE0D2F,
+	0x2D2436BD, 0x1FB25EDD, 0x34D409CA, 0x064261AA, 0x1EC44853, 0x2C522033, 0x07347724, 0x35A21F44,
+	0x10ACA61B, 0x223ACE7B, 0x095C996C, 0x3BCAF10C, 0x234CD8F5, 0x11DAB095, 0x3ABCE782, 0x082A8FE2,
+	0x0BB0B470, 0x3926DC10, 0x12408B07, 0x20D6E367, 0x3850CA9E, 0x0AC6A2FE, 0x21A0F5E9, 0x13369D89,
+	0x269482CD, 0x1402EAAD, 0x3F64BDBA, 0x0DF2D5DA, 0x1574FC23, 0x27E29443, 0x0C84C354, 0x3E12AB34,
+	0x3D8890A6, 0x0F1EF8C6, 0x2478AFD1, 0x16EEC7B1, 0x0E68EE48, 0x3CFE8628, 0x1798D13F, 0x250EB95F,
+	0x21594C36, 0x13CF2456, 0x38A97341, 0x0A3F1B21, 0x12B932D8, 0x202F5AB8, 0x0B490DAF, 0x39DF65CF,
+	0x3A455E5D, 0x08D3363D, 0x23B5612A, 0x1123094A, 0x09A520B3, 0x3B3348D3, 0x10551FC4, 0x22C377A4,
+	0x176168E0, 0x25F70080, 0x0E915797, 0x3C073FF7, 0x2481160E, 0x16177E6E, 0x3D712979, 0x0FE74119,
+	0x0C7D7A8B, 0x3EEB12EB, 0x158D45FC, 0x271B2D9C, 0x3F9D0465, 0x0D0B6C05, 0x266D3B12, 0x14FB5372,
+	0x31F5EA2D, 0x0363824D, 0x2805D55A, 0x1A93BD3A, 0x021594C3, 0x3083FCA3, 0x1BE5ABB4, 0x2973C3D4,
+	0x2AE9F846, 0x187F9026, 0x3319C731, 0x018FAF51, 0x190986A8, 0x2B9FEEC8, 0x00F9B9DF, 0x326FD1BF,
+	0x07CDCEFB, 0x355BA69B, 0x1E3DF18C, 0x2CAB99EC, 0x342DB015, 0x06BBD875, 0x2DDD8F62, 0x1F4BE702,
+	0x1CD1DC90, 0x2E47B4F0, 0x0521E3E7, 0x37B78B87, 0x2F31A27E, 0x1DA7CA1E, 0x36C19D09, 0x0457F569,
+	0x3E6E77DB, 0x0CF81FBB, 0x279E48AC, 0x150820CC, 0x0D8E0935, 0x3F186155, 0x147E3642, 0x26E85E22,
+	0x257265B0, 0x17E40DD0, 0x3C825AC7, 0x0E1432A7, 0x16921B5E, 0x2404733E, 0x0F622429, 0x3DF44C49,
+	0x0856530D, 0x3AC03B6D, 0x11A66C7A, 0x2330041A, 0x3BB62DE3, 0x09204583, 0x22461294, 0x10D07AF4,
+	0x134A4166, 0x21DC2906, 0x0ABA7E11, 0x382C1671, 0x20AA3F88, 0x123C57E8, 0x395A00FF, 0x0BCC689F,
+	0x2EC2D1C0, 0x1C54B9A0, 0x3732EEB7, 0x05A486D7, 0x1D22AF2E, 0x2FB4C74E, 0x04D29059, 0x3644F839,
+	0x35DEC3AB, 0x0748ABCB, 0x2C2EFCDC, 0x1EB894BC, 0x063EBD45, 0x34A8D525, 0x1FCE8232, 0x2D58EA52,
+	0x18FAF516, 0x2A6C9D76, 0x010ACA61, 0x339CA201, 0x2B1A8BF8, 0x198CE398, 0x32EAB48F, 0x007CDCEF,
+	0x03E6E77D, 0x31708F1D, 0x1A16D80A, 0x2880B06A, 0x30069993, 0x0290F1F3, 0x29F6A6E4, 0x1B60CE84,
+	0x1F373BED, 0x2DA1538D, 0x06C7049A, 0x34516CFA, 0x2CD74503, 0x1E412D63, 0x35277A74, 0x07B11214,
+	0x042B2986, 0x36BD41E6, 0x1DDB16F1, 0x2F4D7E91, 0x37CB5768, 0x055D3F08, 0x2E3B681F, 0x1CAD007F,
+	0x290F1F3B, 0x1B99775B, 0x30FF204C, 0x0269482C, 0x1AEF61D5, 0x287909B5, 0x031F5EA2, 0x318936C2,
+	0x32130D50, 0x00856530, 0x2BE33227, 0x19755A47, 0x01F373BE, 0x33651BDE, 0x18034CC9, 0x2A9524A9,
+	0x0F9B9DF6, 0x3D0DF596, 0x166BA281, 0x24FDCAE1, 0x3C7BE318, 0x0EED8B78, 0x258BDC6F, 0x171DB40F,
+	0x14878F9D, 0x2611E7FD, 0x0D77B0EA, 0x3FE1D88A, 0x2767F173, 0x15F19913, 0x3E97CE04, 0x0C01A664,
+	0x39A3B920, 0x0B35D140, 0x20538657, 0x12C5EE37, 0x0A43C7CE, 0x38D5AFAE, 0x13B3F8B9, 0x212590D9,
+	0x22BFAB4B, 0x1029C32B, 0x3B4F943C, 0x09D9FC5C, 0x115FD5A5, 0x23C9BDC5, 0x08AFEAD2, 0x3A3982B2,
+	// Seed 0xE8
+	0x00000000, 0xFD92F6E9, 0xA6873947, 0x5B15CFAE, 0x10ACA61B, 0xED3E50F2, 0xB62B9F5C, 0x4BB969B5,
+	0x21594C36, 0xDCCBBADF, 0x87DE7571, 0x7A4C8398, 0x31F5EA2D, 0xCC671CC4, 0x9772D36A, 0x6AE02583,
+	0x42B2986C, 0xBF206E85, 0xE435A12B, 0x19A757C2, 0x521E3E77, 0xAF8CC89E, 0xF4990730, 0x090BF1D9,
+	0x63EBD45A, 0x9E7922B3, 0xC56CED1D, 0x38FE1BF4, 0x73477241, 0x8ED584A8, 0xD5C04B06, 0x2852BDEF,
+	0x856530D8, 0x78F7C631, 0x23E2099F, 0xDE70FF76, 0x95C996C3, 0x685B602A, 0x334EAF84, 0xCEDC596D,
+	0xA43C7CEE, 0x59AE8A07, 0x02BB45A9, 0xFF29B340, 0xB490DAF5, 0x49022C1C, 0x1217E3B2, 0xEF85155B,
+	0xC7D7A8B4, 0x3A455E5D, 0x615091F3, 0x9CC2671A, 0xD77B0EAF, 0x2AE9F846, 0x71FC37E8, 0x8C6EC101,
+	0xE68EE482, 0x1B1C126B, 0x4009DDC5, 0xBD9B2B2C, 0xF6224299, 0x0BB0B470, 0x50A57BDE, 0xAD378D37,
+	0x5768B525, 0xAAFA43CC, 0xF1EF8C62, 0x0C7D7A8B, 0x47C4133E, 0xBA56E5D7, 0xE1432A79, 0x1CD1DC90,
+	0x7631F913, 0x8BA30FFA, 0xD0B6C054, 0x2D2436BD, 0x669D5F08, 0x9B0FA9E1, 0xC01A664F, 0x3D8890A6,
+	0x15DA2D49, 0xE848DBA0, 0xB35D140E, 0x4ECFE2E7, 0x05768B52, 0xF8E47DBB, 0xA3F1B215, 0x5E6344FC,
+	0x3483617F, 0xC9119796, 0x92045838, 0x6F96AED1, 0x242FC764, 0xD9BD318D, 0x82A8FE23, 0x7F3A08CA,
+	0xD20D85FD, 0x2F9F7314, 0x748ABCBA, 0x89184A53, 0xC2A123E6, 0x3F33D50F, 0x64261AA1, 0x99B4EC48,
+	0xF354C9CB, 0x0EC63F22, 0x55D3F08C, 0xA8410665, 0xE3F86FD0, 0x1E6A9939, 0x457F5697, 0xB8EDA07E,
+	0x90BF1D91, 0x6D2DEB78, 0x363824D6, 0xCBAAD23F, 0x8013BB8A, 0x7D814D63, 0x269482CD, 0xDB067424,
+	0xB1E651A7, 0x4C74A74E, 0x176168E0, 0xEAF39E09, 0xA14AF7BC, 0x5CD80155, 0x07CDCEFB, 0xFA5F3812,
+	0xAED16A4A, 0x53439CA3, 0x0856530D, 0xF5C4A5E4, 0xBE7DCC51, 0x43EF3AB8, 0x18FAF516, 0xE56803FF,
+	0x8F88267C, 0x721AD095, 0x290F1F3B, 0xD49DE9D2, 0x9F248067, 0x62B6768E, 0x39A3B920, 0xC4314FC9,
+	0xEC63F226, 0x11F104CF, 0x4AE4CB61, 0xB7763D88, 0xFCCF543D, 0x015DA2D4, 0x5A486D7A, 0xA7DA9B93,
+	0xCD3ABE10, 0x30A848F9, 0x6BBD8757, 0x962F71BE, 0xDD96180B, 0x2004EEE2, 0x7B11214C, 0x8683D7A5,
+	0x2BB45A92, 0xD626AC7B, 0x8D3363D5, 0x70A1953C, 0x3B18FC89, 0xC68A0A60, 0x9D9FC5CE, 0x600D3327,
+	0x0AED16A4, 0xF77FE04D, 0xAC6A2FE3, 0x51F8D90A, 0x1A41B0BF, 0xE7D34656, 0xBCC689F8, 0x41547F11,
+	0x6906C2FE, 0x94943417, 0xCF81FBB9, 0x32130D50, 0x79AA64E5, 0x8438920C, 0xDF2D5DA2, 0x22BFAB4B,
+	0x485F8EC8, 0xB5CD7821, 0xEED8B78F, 0x134A4166, 0x58F328D3, 0xA561DE3A, 0xFE741194, 0x03E6E77D,
+	0xF9B9DF6F, 0x042B2986, 0x5F3EE628, 0xA2AC10C1, 0xE9157974, 0x14878F9D, 0x4F924033, 0xB200B6DA,
+	0xD8E09359, 0x257265B0, 0x7E67AA1E, 0x83F55CF7, 0xC84C3542, 0x35DEC3AB, 0x6ECB0C05, 0x9359FAEC,
+	0xBB0B4703, 0x4699B1EA, 0x1D8C7E44, 0xE01E88AD, 0xABA7E118, 0x563517F1, 0x0D20D85F, 0xF0B22EB6,
+	0x9A520B35, 0x67C0FDDC, 0x3CD53272, 0xC147C49B, 0x8AFEAD2E, 0x776C5BC7, 0x2C799469, 0xD1EB6280,
+	0x7CDCEFB7, 0x814E195E, 0xDA5BD6F0, 0x27C92019, 0x6C7049AC, 0x91E2BF45, 0xCAF770EB, 0x37658602,
+	0x5D85A381, 0xA0175568, 0xFB029AC6, 0x06906C2F, 0x4D29059A, 0xB0BBF373, 0xEBAE3CDD, 0x163CCA34,
+	0x3E6E77DB, 0xC3FC8132, 0x98E94E9C, 0x657BB875, 0x2EC2D1C0, 0xD3502729, 0x8845E887, 0x75D71E6E,
+	0x1F373BED, 0xE2A5CD04, 0xB9B002AA, 0x4422F443, 0x0F9B9DF6, 0xF2096B1F, 0xA91CA4B1, 0x548E5258,
+	// Seed 0xE9
+	0x00000000, 0x945CE346, 0x9B157335, 0x0F499073, 0x858653D3, 0x11DAB095, 0x1E9320E6, 0x8ACFC3A0,
+	0xB8A0121F, 0x2CFCF159, 0x23B5612A, 0xB7E9826C, 0x3D2641CC, 0xA97AA28A, 0xA63332F9, 0x326FD1BF,
+	0xC2EC9187, 0x56B072C1, 0x59F9E2B2, 0xCDA501F4, 0x476AC254, 0xD3362112, 0xDC7FB161, 0x48235227,
+	0x7A4C8398, 0xEE1060DE, 0xE159F0AD, 0x750513EB, 0xFFCAD04B, 0x6B96330D, 0x64DFA37E, 0xF0834038,
+	0x367596B7, 0xA22975F1, 0xAD60E582, 0x393C06C4, 0xB3F3C564, 0x27AF2622, 0x28E6B651, 0xBCBA5517,
+	0x8ED584A8, 0x1A8967EE, 0x15C0F79D, 0x819C14DB, 0x0B53D77B, 0x9F0F343D, 0x9046A44E, 0x041A4708,
+	0xF4990730, 0x60C5E476, 0x6F8C7405, 0xFBD09743, 0x711F54E3, 0xE543B7A5, 0xEA0A27D6, 0x7E56C490,
+	0x4C39152F, 0xD865F669, 0xD72C661A, 0x4370855C, 0xC9BF46FC, 0x5DE3A5BA, 0x52AA35C9, 0xC6F6D68F,
+	0x6CEB2D6E, 0xF8B7CE28, 0xF7FE5E5B, 0x63A2BD1D, 0xE96D7EBD, 0x7D319DFB, 0x72780D88, 0xE624EECE,
+	0xD44B3F71, 0x4017DC37, 0x4F5E4C44, 0xDB02AF02, 0x51CD6CA2, 0xC5918FE4, 0xCAD81F97, 0x5E84FCD1,
+	0xAE07BCE9, 0x3A5B5FAF, 0x3512CFDC, 0xA14E2C9A, 0x2B81EF3A, 0xBFDD0C7C, 0xB0949C0F, 0x24C87F49,
+	0x16A7AEF6, 0x82FB4DB0, 0x8DB2DDC3, 0x19EE3E85, 0x9321FD25, 0x077D1E63, 0x08348E10, 0x9C686D56,
+	0x5A9EBBD9, 0xCEC2589F, 0xC18BC8EC, 0x55D72BAA, 0xDF18E80A, 0x4B440B4C, 0x440D9B3F, 0xD0517879,
+	0xE23EA9C6, 0x76624A80, 0x792BDAF3, 0xED7739B5, 0x67B8FA15, 0xF3E41953, 0xFCAD8920, 0x68F16A66,
+	0x98722A5E, 0x0C2EC918, 0x0367596B, 0x973BBA2D, 0x1DF4798D, 0x89A89ACB, 0x86E10AB8, 0x12BDE9FE,
+	0x20D23841, 0xB48EDB07, 0xBBC74B74, 0x2F9BA832, 0xA5546B92, 0x310888D4, 0x3E4118A7, 0xAA1DFBE1,
+	0xD9D65ADC, 0x4D8AB99A, 0x42C329E9, 0xD69FCAAF, 0x5C50090F, 0xC80CEA49, 0xC7457A3A, 0x5319997C,
+	0x617648C3, 0xF52AAB85, 0xFA633BF6, 0x6E3FD8B0, 0xE4F01B10, 0x70ACF856, 0x7FE56825, 0xEBB98B63,
+	0x1B3ACB5B, 0x8F66281D, 0x802FB86E, 0x14735B28, 0x9EBC9888, 0x0AE07BCE, 0x05A9EBBD, 0x91F508FB,
+	0xA39AD944, 0x37C63A02, 0x388FAA71, 0xACD34937, 0x261C8A97, 0xB24069D1, 0xBD09F9A2, 0x29551AE4,
+	0xEFA3CC6B, 0x7BFF2F2D, 0x74B6BF5E, 0xE0EA5C18, 0x6A259FB8, 0xFE797CFE, 0xF130EC8D, 0x656C0FCB,
+	0x5703DE74, 0xC35F3D32, 0xCC16AD41, 0x584A4E07, 0xD2858DA7, 0x46D96EE1, 0x4990FE92, 0xDDCC1DD4,
+	0x2D4F5DEC, 0xB913BEAA, 0xB65A2ED9, 0x2206CD9F, 0xA8C90E3F, 0x3C95ED79, 0x33DC7D0A, 0xA7809E4C,
+	0x95EF4FF3, 0x01B3ACB5, 0x0EFA3CC6, 0x9AA6DF80, 0x10691C20, 0x8435FF66, 0x8B7C6F15, 0x1F208C53,
+	0xB53D77B2, 0x216194F4, 0x2E280487, 0xBA74E7C1, 0x30BB2461, 0xA4E7C727, 0xABAE5754, 0x3FF2B412,
+	0x0D9D65AD, 0x99C186EB, 0x96881698, 0x02D4F5DE, 0x881B367E, 0x1C47D538, 0x130E454B, 0x8752A60D,
+	0x77D1E635, 0xE38D0573, 0xECC49500, 0x78987646, 0xF257B5E6, 0x660B56A0, 0x6942C6D3, 0xFD1E2595,
+	0xCF71F42A, 0x5B2D176C, 0x5464871F, 0xC0386459, 0x4AF7A7F9, 0xDEAB44BF, 0xD1E2D4CC, 0x45BE378A,
+	0x8348E105, 0x17140243, 0x185D9230, 0x8C017176, 0x06CEB2D6, 0x92925190, 0x9DDBC1E3, 0x098722A5,
+	0x3BE8F31A, 0xAFB4105C, 0xA0FD802F, 0x34A16369, 0xBE6EA0C9, 0x2A32438F, 0x257BD3FC, 0xB12730BA,
+	0x41A47082, 0xD5F893C4, 0xDAB103B7, 0x4EEDE0F1, 0xC4222351, 0x507EC017, 0x5F375064, 0xCB6BB322,
+	0xF904629D, 0x6D5881DB, 0x621111A8, 0xF64DF2EE, 0x7C82314E, 0xE8DED208, 0xE797427B, 0x73CBA13D,
+	// Seed 0xEA
+	0x00000000, 0x2EFED224, 0x5DFDA448, 0x7303766C, 0x3A455E5D, 0x14BB8C79, 0x67B8FA15, 0x49462831,
+	0x748ABCBA, 0x5A746E9E, 0x297718F2, 0x0789CAD6, 0x4ECFE2E7, 0x603130C3, 0x133246AF, 0x3DCC948B,
+	0x68AB6FB9, 0x4655BD9D, 0x3556CBF1, 0x1BA819D5, 0x52EE31E4, 0x7C10E3C0, 0x0F1395AC, 0x21ED4788,
+	0x1C21D303, 0x32DF0127, 0x41DC774B, 0x6F22A56F, 0x26648D5E, 0x089A5F7A, 0x7B992916, 0x5567FB32,
+	0x50E8C9BF, 0x7E161B9B, 0x0D156DF7, 0x23EBBFD3, 0x6AAD97E2, 0x445345C6, 0x375033AA, 0x19AEE18E,
+	0x24627505, 0x0A9CA721, 0x799FD14D, 0x57610369, 0x1E272B58, 0x30D9F97C, 0x43DA8F10, 0x6D245D34,
+	0x3843A606, 0x16BD7422, 0x65BE024E, 0x4B40D06A, 0x0206F85B, 0x2CF82A7F, 0x5FFB5C13, 0x71058E37,
+	0x4CC91ABC, 0x6237C898, 0x1134BEF4, 0x3FCA6CD0, 0x768C44E1, 0x587296C5, 0x2B71E0A9, 0x058F328D,
+	0x206F85B3, 0x0E915797, 0x7D9221FB, 0x536CF3DF, 0x1A2ADBEE, 0x34D409CA, 0x47D77FA6, 0x6929AD82,
+	0x54E53909, 0x7A1BEB2D, 0x09189D41, 0x27E64F65, 0x6EA06754, 0x405EB570, 0x335DC31C, 0x1DA31138,
+	0x48C4EA0A, 0x663A382E, 0x15394E42, 0x3BC79C66, 0x7281B457, 0x5C7F6673, 0x2F7C101F, 0x0182C23B,
+	0x3C4E56B0, 0x12B08494, 0x61B3F2F8, 0x4F4D20DC, 0x060B08ED, 0x28F5DAC9, 0x5BF6ACA5, 0x75087E81,
+	0x70874C0C, 0x5E799E28, 0x2D7AE844, 0x03843A60, 0x4AC21251, 0x643CC075, 0x173FB619, 0x39C1643D,
+	0x040DF0B6, 0x2AF32292, 0x59F054FE, 0x770E86DA, 0x3E48AEEB, 0x10B67CCF, 0x63B50AA3, 0x4D4BD887,
+	0x182C23B5, 0x36D2F191, 0x45D187FD, 0x6B2F55D9, 0x22697DE8, 0x0C97AFCC, 0x7F94D9A0, 0x516A0B84,
+	0x6CA69F0F, 0x42584D2B, 0x315B3B47, 0x1FA5E963, 0x56E3C152, 0x781D1376, 0x0B1E651A, 0x25E0B73E,
+	0x40DF0B66, 0x6E21D942, 0x1D22AF2E, 0x33DC7D0A, 0x7A9A553B, 0x5464871F, 0x2767F173, 0x09992357,
+	0x3455B7DC, 0x1AAB65F8, 0x69A81394, 0x4756C1B0, 0x0E10E981, 0x20EE3BA5, 0x53ED4DC9, 0x7D139FED,
+	0x287464DF, 0x068AB6FB, 0x7589C097, 0x5B7712B3, 0x12313A82, 0x3CCFE8A6, 0x4FCC9ECA, 0x61324CEE,
+	0x5CFED865, 0x72000A41, 0x01037C2D, 0x2FFDAE09, 0x66BB8638, 0x4845541C, 0x3B462270, 0x15B8F054,
+	0x1037C2D9, 0x3EC910FD, 0x4DCA6691, 0x6334B4B5, 0x2A729C84, 0x048C4EA0, 0x778F38CC, 0x5971EAE8,
+	0x64BD7E63, 0x4A43AC47, 0x3940DA2B, 0x17BE080F, 0x5EF8203E, 0x7006F21A, 0x03058476, 0x2DFB5652,
+	0x789CAD60, 0x56627F44, 0x25610928, 0x0B9FDB0C, 0x42D9F33D, 0x6C272119, 0x1F245775, 0x31DA8551,
+	0x0C1611DA, 0x22E8C3FE, 0x51EBB592, 0x7F1567B6, 0x36534F87, 0x18AD9DA3, 0x6BAEEBCF, 0x455039EB,
+	0x60B08ED5, 0x4E4E5CF1, 0x3D4D2A9D, 0x13B3F8B9, 0x5AF5D088, 0x740B02AC, 0x070874C0, 0x29F6A6E4,
+	0x143A326F, 0x3AC4E04B, 0x49C79627, 0x67394403, 0x2E7F6C32, 0x0081BE16, 0x7382C87A, 0x5D7C1A5E,
+	0x081BE16C, 0x26E53348, 0x55E64524, 0x7B189700, 0x325EBF31, 0x1CA06D15, 0x6FA31B79, 0x415DC95D,
+	0x7C915DD6, 0x526F8FF2, 0x216CF99E, 0x0F922BBA, 0x46D4038B, 0x682AD1AF, 0x1B29A7C3, 0x35D775E7,
+	0x3058476A, 0x1EA6954E, 0x6DA5E322, 0x435B3106, 0x0A1D1937, 0x24E3CB13, 0x57E0BD7F, 0x791E6F5B,
+	0x44D2FBD0, 0x6A2C29F4, 0x192F5F98, 0x37D18DBC, 0x7E97A58D, 0x506977A9, 0x236A01C5, 0x0D94D3E1,
+	0x58F328D3, 0x760DFAF7, 0x050E8C9B, 0x2BF05EBF, 0x62B6768E, 0x4C48A4AA, 0x3F4BD2C6, 0x11B500E2,
+	0x2C799469, 0x0287464D, 0x71843021, 0x5F7AE205, 0x163CCA34, 0x38C21810, 0x4BC16E7C, 0x653FBC58,
+	// Seed 0xEB
+	0x00000000, 0x21AD9883, 0x2CEB46E7, 0x0D46DE64, 0x3666FA2F, 0x17CB62AC, 0x1A8DBCC8, 0x3B20244B,
+	0x037D83BF, 0x22D01B3C, 0x2F96C558, 0x0E3B5DDB, 0x351B7990, 0x14B6E113, 0x19F03F77, 0x385DA7F4,
+	0x06FB077E, 0x27569FFD, 0x2A104199, 0x0BBDD91A, 0x309DFD51, 0x113065D2, 0x1C76BBB6, 0x3DDB2335,
+	0x058684C1, 0x242B1C42, 0x296DC226, 0x08C05AA5, 0x33E07EEE, 0x124DE66D, 0x1F0B3809, 0x3EA6A08A,
+	0x0DF60EFC, 0x2C5B967F, 0x211D481B, 0x00B0D098, 0x3B90F4D3, 0x1A3D6C50, 0x177BB234, 0x36D62AB7,
+	0x0E8B8D43, 0x2F2615C0, 0x2260CBA4, 0x03CD5327, 0x38ED776C, 0x1940EFEF, 0x1406318B, 0x35ABA908,
+	0x0B0D0982, 0x2AA09101, 0x27E64F65, 0x064BD7E6, 0x3D6BF3AD, 0x1CC66B2E, 0x1180B54A, 0x302D2DC9,
+	0x08708A3D, 0x29DD12BE, 0x249BCCDA, 0x05365459, 0x3E167012, 0x1FBBE891, 0x12FD36F5, 0x3350AE76,
+	0x1BEC1DF8, 0x3A41857B, 0x37075B1F, 0x16AAC39C, 0x2D8AE7D7, 0x0C277F54, 0x0161A130, 0x20CC39B3,
+	0x18919E47, 0x393C06C4, 0x347AD8A0, 0x15D74023, 0x2EF76468, 0x0F5AFCEB, 0x021C228F, 0x23B1BA0C,
+	0x1D171A86, 0x3CBA8205, 0x31FC5C61, 0x1051C4E2, 0x2B71E0A9, 0x0ADC782A, 0x079AA64E, 0x26373ECD,
+	0x1E6A9939, 0x3FC701BA, 0x3281DFDE, 0x132C475D, 0x280C6316, 0x09A1FB95, 0x04E725F1, 0x254ABD72,
+	0x161A1304, 0x37B78B87, 0x3AF155E3, 0x1B5CCD60, 0x207CE92B, 0x01D171A8, 0x0C97AFCC, 0x2D3A374F,
+	0x156790BB, 0x34CA0838, 0x398CD65C, 0x18214EDF, 0x23016A94, 0x02ACF217, 0x0FEA2C73, 0x2E47B4F0,
+	0x10E1147A, 0x314C8CF9, 0x3C0A529D, 0x1DA7CA1E, 0x2687EE55, 0x072A76D6, 0x0A6CA8B2, 0x2BC13031,
+	0x139C97C5, 0x32310F46, 0x3F77D122, 0x1EDA49A1, 0x25FA6DEA, 0x0457F569, 0x09112B0D, 0x28BCB38E,
+	0x37D83BF0, 0x1675A373, 0x1B337D17, 0x3A9EE594, 0x01BEC1DF, 0x2013595C, 0x2D558738, 0x0CF81FBB,
+	0x34A5B84F, 0x150820CC, 0x184EFEA8, 0x39E3662B, 0x02C34260, 0x236EDAE3, 0x2E280487, 0x0F859C04,
+	0x31233C8E, 0x108EA40D, 0x1DC87A69, 0x3C65E2EA, 0x0745C6A1, 0x26E85E22, 0x2BAE8046, 0x0A0318C5,
+	0x325EBF31, 0x13F327B2, 0x1EB5F9D6, 0x3F186155, 0x0438451E, 0x2595DD9D, 0x28D303F9, 0x097E9B7A,
+	0x3A2E350C, 0x1B83AD8F, 0x16C573EB, 0x3768EB68, 0x0C48CF23, 0x2DE557A0, 0x20A389C4, 0x010E1147,
+	0x3953B6B3, 0x18FE2E30, 0x15B8F054, 0x341568D7, 0x0F354C9C, 0x2E98D41F, 0x23DE0A7B, 0x027392F8,
+	0x3CD53272, 0x1D78AAF1, 0x103E7495, 0x3193EC16, 0x0AB3C85D, 0x2B1E50DE, 0x26588EBA, 0x07F51639,
+	0x3FA8B1CD, 0x1E05294E, 0x1343F72A, 0x32EE6FA9, 0x09CE4BE2, 0x2863D361, 0x25250D05, 0x04889586,
+	0x2C342608, 0x0D99BE8B, 0x00DF60EF, 0x2172F86C, 0x1A52DC27, 0x3BFF44A4, 0x36B99AC0, 0x17140243,
+	0x2F49A5B7, 0x0EE43D34, 0x03A2E350, 0x220F7BD3, 0x192F5F98, 0x3882C71B, 0x35C4197F, 0x146981FC,
+	0x2ACF2176, 0x0B62B9F5, 0x06246791, 0x2789FF12, 0x1CA9DB59, 0x3D0443DA, 0x30429DBE, 0x11EF053D,
+	0x29B2A2C9, 0x081F3A4A, 0x0559E42E, 0x24F47CAD, 0x1FD458E6, 0x3E79C065, 0x333F1E01, 0x12928682,
+	0x21C228F4, 0x006FB077, 0x0D296E13, 0x2C84F690, 0x17A4D2DB, 0x36094A58, 0x3B4F943C, 0x1AE20CBF,
+	0x22BFAB4B, 0x031233C8, 0x0E54EDAC, 0x2FF9752F, 0x14D95164, 0x3574C9E7, 0x38321783, 0x199F8F00,
+	0x27392F8A, 0x0694B709, 0x0BD2696D, 0x2A7FF1EE, 0x115FD5A5, 0x30F24D26, 0x3DB49342, 0x1C190BC1,
+	0x2444AC35, 0x05E934B6, 0x08AFEAD2, 0x29027251, 0x1222561A, 0x338FCE99, 0x3EC910FD, 0x1F64887E,
+	// Seed 0xEC
+	0x00000000, 0xCB540624, 0xC5D150EF, 0x0E8556CB, 0xD8DBFD79, 0x138FFB5D, 0x1D0AAD96, 0xD65EABB2,
+	0xE2CEA655, 0x299AA071, 0x271FF6BA, 0xEC4BF09E, 0x3A155B2C, 0xF1415D08, 0xFFC40BC3, 0x34900DE7,
+	0x96E4100D, 0x5DB01629, 0x533540E2, 0x986146C6, 0x4E3FED74, 0x856BEB50, 0x8BEEBD9B, 0x40BABBBF,
+	0x742AB658, 0xBF7EB07C, 0xB1FBE6B7, 0x7AAFE093, 0xACF14B21, 0x67A54D05, 0x69201BCE, 0xA2741DEA,
+	0x7EB17CBD, 0xB5E57A99, 0xBB602C52, 0x70342A76, 0xA66A81C4, 0x6D3E87E0, 0x63BBD12B, 0xA8EFD70F,
+	0x9C7FDAE8, 0x572BDCCC, 0x59AE8A07, 0x92FA8C23, 0x44A42791, 0x8FF021B5, 0x8175777E, 0x4A21715A,
+	0xE8556CB0, 0x23016A94, 0x2D843C5F, 0xE6D03A7B, 0x308E91C9, 0xFBDA97ED, 0xF55FC126, 0x3E0BC702,
+	0x0A9BCAE5, 0xC1CFCCC1, 0xCF4A9A0A, 0x041E9C2E, 0xD240379C, 0x191431B8, 0x17916773, 0xDCC56157,
+	0xFD62F97A, 0x3636FF5E, 0x38B3A995, 0xF3E7AFB1, 0x25B90403, 0xEEED0227, 0xE06854EC, 0x2B3C52C8,
+	0x1FAC5F2F, 0xD4F8590B, 0xDA7D0FC0, 0x112909E4, 0xC777A256, 0x0C23A472, 0x02A6F2B9, 0xC9F2F49D,
+	0x6B86E977, 0xA0D2EF53, 0xAE57B998, 0x6503BFBC, 0xB35D140E, 0x7809122A, 0x768C44E1, 0xBDD842C5,
+	0x89484F22, 0x421C4906, 0x4C991FCD, 0x87CD19E9, 0x5193B25B, 0x9AC7B47F, 0x9442E2B4, 0x5F16E490,
+	0x83D385C7, 0x488783E3, 0x4602D528, 0x8D56D30C, 0x5B0878BE, 0x905C7E9A, 0x9ED92851, 0x558D2E75,
+	0x611D2392, 0xAA4925B6, 0xA4CC737D, 0x6F987559, 0xB9C6DEEB, 0x7292D8CF, 0x7C178E04, 0xB7438820,
+	0x153795CA, 0xDE6393EE, 0xD0E6C525, 0x1BB2C301, 0xCDEC68B3, 0x06B86E97, 0x083D385C, 0xC3693E78,
+	0xF7F9339F, 0x3CAD35BB, 0x32286370, 0xF97C6554, 0x2F22CEE6, 0xE476C8C2, 0xEAF39E09, 0x21A7982D,
+	0xA9BCAE53, 0x62E8A877, 0x6C6DFEBC, 0xA739F898, 0x7167532A, 0xBA33550E, 0xB4B603C5, 0x7FE205E1,
+	0x4B720806, 0x80260E22, 0x8EA358E9, 0x45F75ECD, 0x93A9F57F, 0x58FDF35B, 0x5678A590, 0x9D2CA3B4,
+	0x3F58BE5E, 0xF40CB87A, 0xFA89EEB1, 0x31DDE895, 0xE7834327, 0x2CD74503, 0x225213C8, 0xE90615EC,
+	0xDD96180B, 0x16C21E2F, 0x184748E4, 0xD3134EC0, 0x054DE572, 0xCE19E356, 0xC09CB59D, 0x0BC8B3B9,
+	0xD70DD2EE, 0x1C59D4CA, 0x12DC8201, 0xD9888425, 0x0FD62F97, 0xC48229B3, 0xCA077F78, 0x0153795C,
+	0x35C374BB, 0xFE97729F, 0xF0122454, 0x3B462270, 0xED1889C2, 0x264C8FE6, 0x28C9D92D, 0xE39DDF09,
+	0x41E9C2E3, 0x8ABDC4C7, 0x8438920C, 0x4F6C9428, 0x99323F9A, 0x526639BE, 0x5CE36F75, 0x97B76951,
+	0xA32764B6, 0x68736292, 0x66F63459, 0xADA2327D, 0x7BFC99CF, 0xB0A89FEB, 0xBE2DC920, 0x7579CF04,
+	0x54DE5729, 0x9F8A510D, 0x910F07C6, 0x5A5B01E2, 0x8C05AA50, 0x4751AC74, 0x49D4FABF, 0x8280FC9B,
+	0xB610F17C, 0x7D44F758, 0x73C1A193, 0xB895A7B7, 0x6ECB0C05, 0xA59F0A21, 0xAB1A5CEA, 0x604E5ACE,
+	0xC23A4724, 0x096E4100, 0x07EB17CB, 0xCCBF11EF, 0x1AE1BA5D, 0xD1B5BC79, 0xDF30EAB2, 0x1464EC96,
+	0x20F4E171, 0xEBA0E755, 0xE525B19E, 0x2E71B7BA, 0xF82F1C08, 0x337B1A2C, 0x3DFE4CE7, 0xF6AA4AC3,
+	0x2A6F2B94, 0xE13B2DB0, 0xEFBE7B7B, 0x24EA7D5F, 0xF2B4D6ED, 0x39E0D0C9, 0x37658602, 0xFC318026,
+	0xC8A18DC1, 0x03F58BE5, 0x0D70DD2E, 0xC624DB0A, 0x107A70B8, 0xDB2E769C, 0xD5AB2057, 0x1EFF2673,
+	0xBC8B3B99, 0x77DF3DBD, 0x795A6B76, 0xB20E6D52, 0x6450C6E0, 0xAF04C0C4, 0xA181960F, 0x6AD5902B,
+	0x5E459DCC, 0x95119BE8, 0x9B94CD23, 0x50C0CB07, 0x869E60B5, 0x4DCA6691, 0x434F305A, 0x881B367E,
+	// Seed 0xED
+	0x00000000, 0x1FE53668, 0x3FCA6CD0, 0x202F5AB8, 0x7F94D9A0, 0x6071EFC8, 0x405EB570, 0x5FBB8318,
+	0xFF29B340, 0xE0CC8528, 0xC0E3DF90, 0xDF06E9F8, 0x80BD6AE0, 0x9F585C88, 0xBF770630, 0xA0923058,
+	0x43245B0B, 0x5CC16D63, 0x7CEE37DB, 0x630B01B3, 0x3CB082AB, 0x2355B4C3, 0x037AEE7B, 0x1C9FD813,
+	0xBC0DE84B, 0xA3E8DE23, 0x83C7849B, 0x9C22B2F3, 0xC39931EB, 0xDC7C0783, 0xFC535D3B, 0xE3B66B53,
+	0x8648B616, 0x99AD807E, 0xB982DAC6, 0xA667ECAE, 0xF9DC6FB6, 0xE63959DE, 0xC6160366, 0xD9F3350E,
+	0x79610556, 0x6684333E, 0x46AB6986, 0x594E5FEE, 0x06F5DCF6, 0x1910EA9E, 0x393FB026, 0x26DA864E,
+	0xC56CED1D, 0xDA89DB75, 0xFAA681CD, 0xE543B7A5, 0xBAF834BD, 0xA51D02D5, 0x8532586D, 0x9AD76E05,
+	0x3A455E5D, 0x25A06835, 0x058F328D, 0x1A6A04E5, 0x45D187FD, 0x5A34B195, 0x7A1BEB2D, 0x65FEDD45,
+	0xB1E651A7, 0xAE0367CF, 0x8E2C3D77, 0x91C90B1F, 0xCE728807, 0xD197BE6F, 0xF1B8E4D7, 0xEE5DD2BF,
+	0x4ECFE2E7, 0x512AD48F, 0x71058E37, 0x6EE0B85F, 0x315B3B47, 0x2EBE0D2F, 0x0E915797, 0x117461FF,
+	0xF2C20AAC, 0xED273CC4, 0xCD08667C, 0xD2ED5014, 0x8D56D30C, 0x92B3E564, 0xB29CBFDC, 0xAD7989B4,
+	0x0DEBB9EC, 0x120E8F84, 0x3221D53C, 0x2DC4E354, 0x727F604C, 0x6D9A5624, 0x4DB50C9C, 0x52503AF4,
+	0x37AEE7B1, 0x284BD1D9, 0x08648B61, 0x1781BD09, 0x483A3E11, 0x57DF0879, 0x77F052C1, 0x681564A9,
+	0xC88754F1, 0xD7626299, 0xF74D3821, 0xE8A80E49, 0xB7138D51, 0xA8F6BB39, 0x88D9E181, 0x973CD7E9,
+	0x748ABCBA, 0x6B6F8AD2, 0x4B40D06A, 0x54A5E602, 0x0B1E651A, 0x14FB5372, 0x34D409CA, 0x2B313FA2,
+	0x8BA30FFA, 0x94463992, 0xB469632A, 0xAB8C5542, 0xF437D65A, 0xEBD2E032, 0xCBFDBA8A, 0xD4188CE2,
+	0xDEBB9EC5, 0xC15EA8AD, 0xE171F215, 0xFE94C47D, 0xA12F4765, 0xBECA710D, 0x9EE52BB5, 0x81001DDD,
+	0x21922D85, 0x3E771BED, 0x1E584155, 0x01BD773D, 0x5E06F425, 0x41E3C24D, 0x61CC98F5, 0x7E29AE9D,
+	0x9D9FC5CE, 0x827AF3A6, 0xA255A91E, 0xBDB09F76, 0xE20B1C6E, 0xFDEE2A06, 0xDDC170BE, 0xC22446D6,
+	0x62B6768E, 0x7D5340E6, 0x5D7C1A5E, 0x42992C36, 0x1D22AF2E, 0x02C79946, 0x22E8C3FE, 0x3D0DF596,
+	0x58F328D3, 0x47161EBB, 0x67394403, 0x78DC726B, 0x2767F173, 0x3882C71B, 0x18AD9DA3, 0x0748ABCB,
+	0xA7DA9B93, 0xB83FADFB, 0x9810F743, 0x87F5C12B, 0xD84E4233, 0xC7AB745B, 0xE7842EE3, 0xF861188B,
+	0x1BD773D8, 0x043245B0, 0x241D1F08, 0x3BF82960, 0x6443AA78, 0x7BA69C10, 0x5B89C6A8, 0x446CF0C0,
+	0xE4FEC098, 0xFB1BF6F0, 0xDB34AC48, 0xC4D19A20, 0x9B6A1938, 0x848F2F50, 0xA4A075E8, 0xBB454380,
+	0x6F5DCF62, 0x70B8F90A, 0x5097A3B2, 0x4F7295DA, 0x10C916C2, 0x0F2C20AA, 0x2F037A12, 0x30E64C7A,
+	0x90747C22, 0x8F914A4A, 0xAFBE10F2, 0xB05B269A, 0xEFE0A582, 0xF00593EA, 0xD02AC952, 0xCFCFFF3A,
+	0x2C799469, 0x339CA201, 0x13B3F8B9, 0x0C56CED1, 0x53ED4DC9, 0x4C087BA1, 0x6C272119, 0x73C21771,
+	0xD3502729, 0xCCB51141, 0xEC9A4BF9, 0xF37F7D91, 0xACC4FE89, 0xB321C8E1, 0x930E9259, 0x8CEBA431,
+	0xE9157974, 0xF6F04F1C, 0xD6DF15A4, 0xC93A23CC, 0x9681A0D4, 0x896496BC, 0xA94BCC04, 0xB6AEFA6C,
+	0x163CCA34, 0x09D9FC5C, 0x29F6A6E4, 0x3613908C, 0x69A81394, 0x764D25FC, 0x56627F44, 0x4987492C,
+	0xAA31227F, 0xB5D41417, 0x95FB4EAF, 0x8A1E78C7, 0xD5A5FBDF, 0xCA40CDB7, 0xEA6F970F, 0xF58AA167,
+	0x5518913F, 0x4AFDA757, 0x6AD2FDEF, 0x7537CB87, 0x2A8C489F, 0x35697EF7, 0x1546244F, 0x0AA31227,
+	// Seed 0xEE
+	0x00000000, 0x0191AEA3, 0x03235D46, 0x02B2F3E5, 0x0646BA8C, 0x07D7142F, 0x0565E7CA, 0x04F44969,
+	0x0C8D7518, 0x0D1CDBBB, 0x0FAE285E, 0x0E3F86FD, 0x0ACBCF94, 0x0B5A6137, 0x09E892D2, 0x08793C71,
+	0x191AEA30, 0x188B4493, 0x1A39B776, 0x1BA819D5, 0x1F5C50BC, 0x1ECDFE1F, 0x1C7F0DFA, 0x1DEEA359,
+	0x15979F28, 0x1406318B, 0x16B4C26E, 0x17256CCD, 0x13D125A4, 0x12408B07, 0x10F278E2, 0x1163D641,
+	0x3235D460, 0x33A47AC3, 0x31168926, 0x30872785, 0x34736EEC, 0x35E2C04F, 0x375033AA, 0x36C19D09,
+	0x3EB8A178, 0x3F290FDB, 0x3D9BFC3E, 0x3C0A529D, 0x38FE1BF4, 0x396FB557, 0x3BDD46B2, 0x3A4CE811,
+	0x2B2F3E50, 0x2ABE90F3, 0x280C6316, 0x299DCDB5, 0x2D6984DC, 0x2CF82A7F, 0x2E4AD99A, 0x2FDB7739,
+	0x27A24B48, 0x2633E5EB, 0x2481160E, 0x2510B8AD, 0x21E4F1C4, 0x20755F67, 0x22C7AC82, 0x23560221,
+	0x646BA8C0, 0x65FA0663, 0x6748F586, 0x66D95B25, 0x622D124C, 0x63BCBCEF, 0x610E4F0A, 0x609FE1A9,
+	0x68E6DDD8, 0x6977737B, 0x6BC5809E, 0x6A542E3D, 0x6EA06754, 0x6F31C9F7, 0x6D833A12, 0x6C1294B1,
+	0x7D7142F0, 0x7CE0EC53, 0x7E521FB6, 0x7FC3B115, 0x7B37F87C, 0x7AA656DF, 0x7814A53A, 0x79850B99,
+	0x71FC37E8, 0x706D994B, 0x72DF6AAE, 0x734EC40D, 0x77BA8D64, 0x762B23C7, 0x7499D022, 0x75087E81,
+	0x565E7CA0, 0x57CFD203, 0x557D21E6, 0x54EC8F45, 0x5018C62C, 0x5189688F, 0x533B9B6A, 0x52AA35C9,
+	0x5AD309B8, 0x5B42A71B, 0x59F054FE, 0x5861FA5D, 0x5C95B334, 0x5D041D97, 0x5FB6EE72, 0x5E2740D1,
+	0x4F449690, 0x4ED53833, 0x4C67CBD6, 0x4DF66575, 0x49022C1C, 0x489382BF, 0x4A21715A, 0x4BB0DFF9,
+	0x43C9E388, 0x42584D2B, 0x40EABECE, 0x417B106D, 0x458F5904, 0x441EF7A7, 0x46AC0442, 0x473DAAE1,
+	0x47B2CF7F, 0x462361DC, 0x44919239, 0x45003C9A, 0x41F475F3, 0x4065DB50, 0x42D728B5, 0x43468616,
+	0x4B3FBA67, 0x4AAE14C4, 0x481CE721, 0x498D4982, 0x4D7900EB, 0x4CE8AE48, 0x4E5A5DAD, 0x4FCBF30E,
+	0x5EA8254F, 0x5F398BEC, 0x5D8B7809, 0x5C1AD6AA, 0x58EE9FC3, 0x597F3160, 0x5BCDC285, 0x5A5C6C26,
+	0x52255057, 0x53B4FEF4, 0x51060D11, 0x5097A3B2, 0x5463EADB, 0x55F24478, 0x5740B79D, 0x56D1193E,
+	0x75871B1F, 0x7416B5BC, 0x76A44659, 0x7735E8FA, 0x73C1A193, 0x72500F30, 0x70E2FCD5, 0x71735276,
+	0x790A6E07, 0x789BC0A4, 0x7A293341, 0x7BB89DE2, 0x7F4CD48B, 0x7EDD7A28, 0x7C6F89CD, 0x7DFE276E,
+	0x6C9DF12F, 0x6D0C5F8C, 0x6FBEAC69, 0x6E2F02CA, 0x6ADB4BA3, 0x6B4AE500, 0x69F816E5, 0x6869B846,
+	0x60108437, 0x61812A94, 0x6333D971, 0x62A277D2, 0x66563EBB, 0x67C79018, 0x657563FD, 0x64E4CD5E,
+	0x23D967BF, 0x2248C91C, 0x20FA3AF9, 0x216B945A, 0x259FDD33, 0x240E7390, 0x26BC8075, 0x272D2ED6,
+	0x2F5412A7, 0x2EC5BC04, 0x2C774FE1, 0x2DE6E142, 0x2912A82B, 0x28830688, 0x2A31F56D, 0x2BA05BCE,
+	0x3AC38D8F, 0x3B52232C, 0x39E0D0C9, 0x38717E6A, 0x3C853703, 0x3D1499A0, 0x3FA66A45, 0x3E37C4E6,
+	0x364EF897, 0x37DF5634, 0x356DA5D1, 0x34FC0B72, 0x3008421B, 0x3199ECB8, 0x332B1F5D, 0x32BAB1FE,
+	0x11ECB3DF, 0x107D1D7C, 0x12CFEE99, 0x135E403A, 0x17AA0953, 0x163BA7F0, 0x14895415, 0x1518FAB6,
+	0x1D61C6C7, 0x1CF06864, 0x1E429B81, 0x1FD33522, 0x1B277C4B, 0x1AB6D2E8, 0x1804210D, 0x19958FAE,
+	0x08F659EF, 0x0967F74C, 0x0BD504A9, 0x0A44AA0A, 0x0EB0E363, 0x0F214DC0, 0x0D93BE25, 0x0C021086,
+	0x047B2CF7, 0x05EA8254, 0x075871B1, 0x06C9DF12, 0x023D967B, 0x03AC38D8, 0x011ECB3D, 0x008F659E,
+	// Seed 0xEF
+	0x00000000, 0x165ACC0F, 0x2CB5981E, 0x3AEF5411, 0x3800CFEF, 0x2E5A03E0, 0x14B557F1, 0x02EF9BFE,
+	0x116A600D, 0x0730AC02, 0x3DDFF813, 0x2B85341C, 0x296AAFE2, 0x3F3063ED, 0x05DF37FC, 0x1385FBF3,
+	0x22D4C01A, 0x348E0C15, 0x0E615804, 0x183B940B, 0x1AD40FF5, 0x0C8EC3FA, 0x366197EB, 0x203B5BE4,
+	0x33BEA017, 0x25E46C18, 0x1F0B3809, 0x0951F406, 0x0BBE6FF8, 0x1DE4A3F7, 0x270BF7E6, 0x31513BE9,
+	0x24C27FE7, 0x3298B3E8, 0x0877E7F9, 0x1E2D2BF6, 0x1CC2B008, 0x0A987C07, 0x30772816, 0x262DE419,
+	0x35A81FEA, 0x23F2D3E5, 0x191D87F4, 0x0F474BFB, 0x0DA8D005, 0x1BF21C0A, 0x211D481B, 0x37478414,
+	0x0616BFFD, 0x104C73F2, 0x2AA327E3, 0x3CF9EBEC, 0x3E167012, 0x284CBC1D, 0x12A3E80C, 0x04F92403,
+	0x177CDFF0, 0x012613FF, 0x3BC947EE, 0x2D938BE1, 0x2F7C101F, 0x3926DC10, 0x03C98801, 0x1593440E,
+	0x28EF001D, 0x3EB5CC12, 0x045A9803, 0x1200540C, 0x10EFCFF2, 0x06B503FD, 0x3C5A57EC, 0x2A009BE3,
+	0x39856010, 0x2FDFAC1F, 0x1530F80E, 0x036A3401, 0x0185AFFF, 0x17DF63F0, 0x2D3037E1, 0x3B6AFBEE,
+	0x0A3BC007, 0x1C610C08, 0x268E5819, 0x30D49416, 0x323B0FE8, 0x2461C3E7, 0x1E8E97F6, 0x08D45BF9,
+	0x1B51A00A, 0x0D0B6C05, 0x37E43814, 0x21BEF41B, 0x23516FE5, 0x350BA3EA, 0x0FE4F7FB, 0x19BE3BF4,
+	0x0C2D7FFA, 0x1A77B3F5, 0x2098E7E4, 0x36C22BEB, 0x342DB015, 0x22777C1A, 0x1898280B, 0x0EC2E404,
+	0x1D471FF7, 0x0B1DD3F8, 0x31F287E9, 0x27A84BE6, 0x2547D018, 0x331D1C17, 0x09F24806, 0x1FA88409,
+	0x2EF9BFE0, 0x38A373EF, 0x024C27FE, 0x1416EBF1, 0x16F9700F, 0x00A3BC00, 0x3A4CE811, 0x2C16241E,
+	0x3F93DFED, 0x29C913E2, 0x132647F3, 0x057C8BFC, 0x07931002, 0x11C9DC0D, 0x2B26881C, 0x3D7C4413,
+	0x30B5FFE9, 0x26EF33E6, 0x1C0067F7, 0x0A5AABF8, 0x08B53006, 0x1EEFFC09, 0x2400A818, 0x325A6417,
+	0x21DF9FE4, 0x378553EB, 0x0D6A07FA, 0x1B30CBF5, 0x19DF500B, 0x0F859C04, 0x356AC815, 0x2330041A,
+	0x12613FF3, 0x043BF3FC, 0x3ED4A7ED, 0x288E6BE2, 0x2A61F01C, 0x3C3B3C13, 0x06D46802, 0x108EA40D,
+	0x030B5FFE, 0x155193F1, 0x2FBEC7E0, 0x39E40BEF, 0x3B0B9011, 0x2D515C1E, 0x17BE080F, 0x01E4C400,
+	0x1477800E, 0x022D4C01, 0x38C21810, 0x2E98D41F, 0x2C774FE1, 0x3A2D83EE, 0x00C2D7FF, 0x16981BF0,
+	0x051DE003, 0x13472C0C, 0x29A8781D, 0x3FF2B412, 0x3D1D2FEC, 0x2B47E3E3, 0x11A8B7F2, 0x07F27BFD,
+	0x36A34014, 0x20F98C1B, 0x1A16D80A, 0x0C4C1405, 0x0EA38FFB, 0x18F943F4, 0x221617E5, 0x344CDBEA,
+	0x27C92019, 0x3193EC16, 0x0B7CB807, 0x1D267408, 0x1FC9EFF6, 0x099323F9, 0x337C77E8, 0x2526BBE7,
+	0x185AFFF4, 0x0E0033FB, 0x34EF67EA, 0x22B5ABE5, 0x205A301B, 0x3600FC14, 0x0CEFA805, 0x1AB5640A,
+	0x09309FF9, 0x1F6A53F6, 0x258507E7, 0x33DFCBE8, 0x31305016, 0x276A9C19, 0x1D85C808, 0x0BDF0407,
+	0x3A8E3FEE, 0x2CD4F3E1, 0x163BA7F0, 0x00616BFF, 0x028EF001, 0x14D43C0E, 0x2E3B681F, 0x3861A410,
+	0x2BE45FE3, 0x3DBE93EC, 0x0751C7FD, 0x110B0BF2, 0x13E4900C, 0x05BE5C03, 0x3F510812, 0x290BC41D,
+	0x3C988013, 0x2AC24C1C, 0x102D180D, 0x0677D402, 0x04984FFC, 0x12C283F3, 0x282DD7E2, 0x3E771BED,
+	0x2DF2E01E, 0x3BA82C11, 0x01477800, 0x171DB40F, 0x15F22FF1, 0x03A8E3FE, 0x3947B7EF, 0x2F1D7BE0,
+	0x1E4C4009, 0x08168C06, 0x32F9D817, 0x24A31418, 0x264C8FE6, 0x301643E9, 0x0AF917F8, 0x1CA3DBF7,
+	0x0F262004, 0x197CEC0B, 0x2393B81A, 0x35C97415, 0x3726EFEB, 0x217C23E4, 0x1B9377F5, 0x0DC9BBFA,
+	// Seed 0xF0
+	0x00000000, 0x6CA69989, 0xD94D3312, 0xB5EBAA9B, 0xC9E1941D, 0xA5470D94, 0x10ACA70F, 0x7C0A3E86,
+	0xE8B8DA03, 0x841E438A, 0x31F5E911, 0x5D537098, 0x21594E1E, 0x4DFFD797, 0xF8147D0C, 0x94B2E485,
+	0xAA0A463F, 0xC6ACDFB6, 0x7347752D, 0x1FE1ECA4, 0x63EBD222, 0x0F4D4BAB, 0xBAA6E130, 0xD60078B9,
+	0x42B29C3C, 0x2E1405B5, 0x9BFFAF2E, 0xF75936A7, 0x8B530821, 0xE7F591A8, 0x521E3B33, 0x3EB8A2BA,
+	0x2F6F7E47, 0x43C9E7CE, 0xF6224D55, 0x9A84D4DC, 0xE68EEA5A, 0x8A2873D3, 0x3FC3D948, 0x536540C1,
+	0xC7D7A444, 0xAB713DCD, 0x1E9A9756, 0x723C0EDF, 0x0E363059, 0x6290A9D0, 0xD77B034B, 0xBBDD9AC2,
+	0x85653878, 0xE9C3A1F1, 0x5C280B6A, 0x308E92E3, 0x4C84AC65, 0x202235EC, 0x95C99F77, 0xF96F06FE,
+	0x6DDDE27B, 0x017B7BF2, 0xB490D169, 0xD83648E0, 0xA43C7666, 0xC89AEFEF, 0x7D714574, 0x11D7DCFD,
+	0x5EDEFC8E, 0x32786507, 0x8793CF9C, 0xEB355615, 0x973F6893, 0xFB99F11A, 0x4E725B81, 0x22D4C208,
+	0xB666268D, 0xDAC0BF04, 0x6F2B159F, 0x038D8C16, 0x7F87B290, 0x13212B19, 0xA6CA8182, 0xCA6C180B,
+	0xF4D4BAB1, 0x98722338, 0x2D9989A3, 0x413F102A, 0x3D352EAC, 0x5193B725, 0xE4781DBE, 0x88DE8437,
+	0x1C6C60B2, 0x70CAF93B, 0xC52153A0, 0xA987CA29, 0xD58DF4AF, 0xB92B6D26, 0x0CC0C7BD, 0x60665E34,
+	0x71B182C9, 0x1D171B40, 0xA8FCB1DB, 0xC45A2852, 0xB85016D4, 0xD4F68F5D, 0x611D25C6, 0x0DBBBC4F,
+	0x990958CA, 0xF5AFC143, 0x40446BD8, 0x2CE2F251, 0x50E8CCD7, 0x3C4E555E, 0x89A5FFC5, 0xE503664C,
+	0xDBBBC4F6, 0xB71D5D7F, 0x02F6F7E4, 0x6E506E6D, 0x125A50EB, 0x7EFCC962, 0xCB1763F9, 0xA7B1FA70,
+	0x33031EF5, 0x5FA5877C, 0xEA4E2DE7, 0x86E8B46E, 0xFAE28AE8, 0x96441361, 0x23AFB9FA, 0x4F092073,
+	0xBDBDF91C, 0xD11B6095, 0x64F0CA0E, 0x08565387, 0x745C6D01, 0x18FAF488, 0xAD115E13, 0xC1B7C79A,
+	0x5505231F, 0x39A3BA96, 0x8C48100D, 0xE0EE8984, 0x9CE4B702, 0xF0422E8B, 0x45A98410, 0x290F1D99,
+	0x17B7BF23, 0x7B1126AA, 0xCEFA8C31, 0xA25C15B8, 0xDE562B3E, 0xB2F0B2B7, 0x071B182C, 0x6BBD81A5,
+	0xFF0F6520, 0x93A9FCA9, 0x26425632, 0x4AE4CFBB, 0x36EEF13D, 0x5A4868B4, 0xEFA3C22F, 0x83055BA6,
+	0x92D2875B, 0xFE741ED2, 0x4B9FB449, 0x27392DC0, 0x5B331346, 0x37958ACF, 0x827E2054, 0xEED8B9DD,
+	0x7A6A5D58, 0x16CCC4D1, 0xA3276E4A, 0xCF81F7C3, 0xB38BC945, 0xDF2D50CC, 0x6AC6FA57, 0x066063DE,
+	0x38D8C164, 0x547E58ED, 0xE195F276, 0x8D336BFF, 0xF1395579, 0x9D9FCCF0, 0x2874666B, 0x44D2FFE2,
+	0xD0601B67, 0xBCC682EE, 0x092D2875, 0x658BB1FC, 0x19818F7A, 0x752716F3, 0xC0CCBC68, 0xAC6A25E1,
+	0xE3630592, 0x8FC59C1B, 0x3A2E3680, 0x5688AF09, 0x2A82918F, 0x46240806, 0xF3CFA29D, 0x9F693B14,
+	0x0BDBDF91, 0x677D4618, 0xD296EC83, 0xBE30750A, 0xC23A4B8C, 0xAE9CD205, 0x1B77789E, 0x77D1E117,
+	0x496943AD, 0x25CFDA24, 0x902470BF, 0xFC82E936, 0x8088D7B0, 0xEC2E4E39, 0x59C5E4A2, 0x35637D2B,
+	0xA1D199AE, 0xCD770027, 0x789CAABC, 0x143A3335, 0x68300DB3, 0x0496943A, 0xB17D3EA1, 0xDDDBA728,
+	0xCC0C7BD5, 0xA0AAE25C, 0x154148C7, 0x79E7D14E, 0x05EDEFC8, 0x694B7641, 0xDCA0DCDA, 0xB0064553,
+	0x24B4A1D6, 0x4812385F, 0xFDF992C4, 0x915F0B4D, 0xED5535CB, 0x81F3AC42, 0x341806D9, 0x58BE9F50,
+	0x66063DEA, 0x0AA0A463, 0xBF4B0EF8, 0xD3ED9771, 0xAFE7A9F7, 0xC341307E, 0x76AA9AE5, 0x1A0C036C,
+	0x8EBEE7E9, 0xE2187E60, 0x57F3D4FB, 0x3B554D72, 0x475F73F4, 0x2BF9EA7D, 0x9E1240E6, 0xF2B4D96F,
+	// Seed 0xF1
+	0x00000000, 0x629DC532, 0xC53B8A64, 0xA7A64F56, 0x1F028FDD, 0x7D9F4AEF, 0xDA3905B9, 0xB8A4C08B,
+	0x3E051FBA, 0x5C98DA88, 0xFB3E95DE, 0x99A350EC, 0x21079067, 0x439A5555, 0xE43C1A03, 0x86A1DF31,
+	0x7C0A3F74, 0x1E97FA46, 0xB931B510, 0xDBAC7022, 0x6308B0A9, 0x0195759B, 0xA6333ACD, 0xC4AEFFFF,
+	0x420F20CE, 0x2092E5FC, 0x8734AAAA, 0xE5A96F98, 0x5D0DAF13, 0x3F906A21, 0x98362577, 0xFAABE045,
+	0xF8147EE8, 0x9A89BBDA, 0x3D2FF48C, 0x5FB231BE, 0xE716F135, 0x858B3407, 0x222D7B51, 0x40B0BE63,
+	0xC6116152, 0xA48CA460, 0x032AEB36, 0x61B72E04, 0xD913EE8F, 0xBB8E2BBD, 0x1C2864EB, 0x7EB5A1D9,
+	0x841E419C, 0xE68384AE, 0x4125CBF8, 0x23B80ECA, 0x9B1CCE41, 0xF9810B73, 0x5E274425, 0x3CBA8117,
+	0xBA1B5E26, 0xD8869B14, 0x7F20D442, 0x1DBD1170, 0xA519D1FB, 0xC78414C9, 0x60225B9F, 0x02BF9EAD,
+	0x655D66C5, 0x07C0A3F7, 0xA066ECA1, 0xC2FB2993, 0x7A5FE918, 0x18C22C2A, 0xBF64637C, 0xDDF9A64E,
+	0x5B58797F, 0x39C5BC4D, 0x9E63F31B, 0xFCFE3629, 0x445AF6A2, 0x26C73390, 0x81617CC6, 0xE3FCB9F4,
+	0x195759B1, 0x7BCA9C83, 0xDC6CD3D5, 0xBEF116E7, 0x0655D66C, 0x64C8135E, 0xC36E5C08, 0xA1F3993A,
+	0x2752460B, 0x45CF8339, 0xE269CC6F, 0x80F4095D, 0x3850C9D6, 0x5ACD0CE4, 0xFD6B43B2, 0x9FF68680,
+	0x9D49182D, 0xFFD4DD1F, 0x58729249, 0x3AEF577B, 0x824B97F0, 0xE0D652C2, 0x47701D94, 0x25EDD8A6,
+	0xA34C0797, 0xC1D1C2A5, 0x66778DF3, 0x04EA48C1, 0xBC4E884A, 0xDED34D78, 0x7975022E, 0x1BE8C71C,
+	0xE1432759, 0x83DEE26B, 0x2478AD3D, 0x46E5680F, 0xFE41A884, 0x9CDC6DB6, 0x3B7A22E0, 0x59E7E7D2,
+	0xDF4638E3, 0xBDDBFDD1, 0x1A7DB287, 0x78E077B5, 0xC044B73E, 0xA2D9720C, 0x057F3D5A, 0x67E2F868,
+	0xCABACD8A, 0xA82708B8, 0x0F8147EE, 0x6D1C82DC, 0xD5B84257, 0xB7258765, 0x1083C833, 0x721E0D01,
+	0xF4BFD230, 0x96221702, 0x31845854, 0x53199D66, 0xEBBD5DED, 0x892098DF, 0x2E86D789, 0x4C1B12BB,
+	0xB6B0F2FE, 0xD42D37CC, 0x738B789A, 0x1116BDA8, 0xA9B27D23, 0xCB2FB811, 0x6C89F747, 0x0E143275,
+	0x88B5ED44, 0xEA282876, 0x4D8E6720, 0x2F13A212, 0x97B76299, 0xF52AA7AB, 0x528CE8FD, 0x30112DCF,
+	0x32AEB362, 0x50337650, 0xF7953906, 0x9508FC34, 0x2DAC3CBF, 0x4F31F98D, 0xE897B6DB, 0x8A0A73E9,
+	0x0CABACD8, 0x6E3669EA, 0xC99026BC, 0xAB0DE38E, 0x13A92305, 0x7134E637, 0xD692A961, 0xB40F6C53,
+	0x4EA48C16, 0x2C394924, 0x8B9F0672, 0xE902C340, 0x51A603CB, 0x333BC6F9, 0x949D89AF, 0xF6004C9D,
+	0x70A193AC, 0x123C569E, 0xB59A19C8, 0xD707DCFA, 0x6FA31C71, 0x0D3ED943, 0xAA989615, 0xC8055327,
+	0xAFE7AB4F, 0xCD7A6E7D, 0x6ADC212B, 0x0841E419, 0xB0E52492, 0xD278E1A0, 0x75DEAEF6, 0x17436BC4,
+	0x91E2B4F5, 0xF37F71C7, 0x54D93E91, 0x3644FBA3, 0x8EE03B28, 0xEC7DFE1A, 0x4BDBB14C, 0x2946747E,
+	0xD3ED943B, 0xB1705109, 0x16D61E5F, 0x744BDB6D, 0xCCEF1BE6, 0xAE72DED4, 0x09D49182, 0x6B4954B0,
+	0xEDE88B81, 0x8F754EB3, 0x28D301E5, 0x4A4EC4D7, 0xF2EA045C, 0x9077C16E, 0x37D18E38, 0x554C4B0A,
+	0x57F3D5A7, 0x356E1095, 0x92C85FC3, 0xF0559AF1, 0x48F15A7A, 0x2A6C9F48, 0x8DCAD01E, 0xEF57152C,
+	0x69F6CA1D, 0x0B6B0F2F, 0xACCD4079, 0xCE50854B, 0x76F445C0, 0x146980F2, 0xB3CFCFA4, 0xD1520A96,
+	0x2BF9EAD3, 0x49642FE1, 0xEEC260B7, 0x8C5FA585, 0x34FB650E, 0x5666A03C, 0xF1C0EF6A, 0x935D2A58,
+	0x15FCF569, 0x7761305B, 0xD0C77F0D, 0xB25ABA3F, 0x0AFE7AB4, 0x6863BF86, 0xCFC5F0D0, 0xAD5835E2,
+	// Seed 0xF2
+	0x00000000, 0x3D924FA8, 0x7B249F50, 0x46B6D0F8, 0x512E02C1, 0x6CBC4D69, 0x2A0A9D91, 0x1798D239,
+	0x053B39E3, 0x38A9764B, 0x7E1FA6B3, 0x438DE91B, 0x54153B22, 0x6987748A, 0x2F31A472, 0x12A3EBDA,
+	0x0A7673C6, 0x37E43C6E, 0x7152EC96, 0x4CC0A33E, 0x5B587107, 0x66CA3EAF, 0x207CEE57, 0x1DEEA1FF,
+	0x0F4D4A25, 0x32DF058D, 0x7469D575, 0x49FB9ADD, 0x5E6348E4, 0x63F1074C, 0x2547D7B4, 0x18D5981C,
+	0x14ECE78C, 0x297EA824, 0x6FC878DC, 0x525A3774, 0x45C2E54D, 0x7850AAE5, 0x3EE67A1D, 0x037435B5,
+	0x11D7DE6F, 0x2C4591C7, 0x6AF3413F, 0x57610E97, 0x40F9DCAE, 0x7D6B9306, 0x3BDD43FE, 0x064F0C56,
+	0x1E9A944A, 0x2308DBE2, 0x65BE0B1A, 0x582C44B2, 0x4FB4968B, 0x7226D923, 0x349009DB, 0x09024673,
+	0x1BA1ADA9, 0x2633E201, 0x608532F9, 0x5D177D51, 0x4A8FAF68, 0x771DE0C0, 0x31AB3038, 0x0C397F90,
+	0x29D9CF18, 0x144B80B0, 0x52FD5048, 0x6F6F1FE0, 0x78F7CDD9, 0x45658271, 0x03D35289, 0x3E411D21,
+	0x2CE2F6FB, 0x1170B953, 0x57C669AB, 0x6A542603, 0x7DCCF43A, 0x405EBB92, 0x06E86B6A, 0x3B7A24C2,
+	0x23AFBCDE, 0x1E3DF376, 0x588B238E, 0x65196C26, 0x7281BE1F, 0x4F13F1B7, 0x09A5214F, 0x34376EE7,
+	0x2694853D, 0x1B06CA95, 0x5DB01A6D, 0x602255C5, 0x77BA87FC, 0x4A28C854, 0x0C9E18AC, 0x310C5704,
+	0x3D352894, 0x00A7673C, 0x4611B7C4, 0x7B83F86C, 0x6C1B2A55, 0x518965FD, 0x173FB505, 0x2AADFAAD,
+	0x380E1177, 0x059C5EDF, 0x432A8E27, 0x7EB8C18F, 0x692013B6, 0x54B25C1E, 0x12048CE6, 0x2F96C34E,
+	0x37435B52, 0x0AD114FA, 0x4C67C402, 0x71F58BAA, 0x666D5993, 0x5BFF163B, 0x1D49C6C3, 0x20DB896B,
+	0x327862B1, 0x0FEA2D19, 0x495CFDE1, 0x74CEB249, 0x63566070, 0x5EC42FD8, 0x1872FF20, 0x25E0B088,
+	0x53B39E30, 0x6E21D198, 0x28970160, 0x15054EC8, 0x029D9CF1, 0x3F0FD359, 0x79B903A1, 0x442B4C09,
+	0x5688A7D3, 0x6B1AE87B, 0x2DAC3883, 0x103E772B, 0x07A6A512, 0x3A34EABA, 0x7C823A42, 0x411075EA,
+	0x59C5EDF6, 0x6457A25E, 0x22E172A6, 0x1F733D0E, 0x08EBEF37, 0x3579A09F, 0x73CF7067, 0x4E5D3FCF,
+	0x5CFED415, 0x616C9BBD, 0x27DA4B45, 0x1A4804ED, 0x0DD0D6D4, 0x3042997C, 0x76F44984, 0x4B66062C,
+	0x475F79BC, 0x7ACD3614, 0x3C7BE6EC, 0x01E9A944, 0x16717B7D, 0x2BE334D5, 0x6D55E42D, 0x50C7AB85,
+	0x4264405F, 0x7FF60FF7, 0x3940DF0F, 0x04D290A7, 0x134A429E, 0x2ED80D36, 0x686EDDCE, 0x55FC9266,
+	0x4D290A7A, 0x70BB45D2, 0x360D952A, 0x0B9FDA82, 0x1C0708BB, 0x21954713, 0x672397EB, 0x5AB1D843,
+	0x48123399, 0x75807C31, 0x3336ACC9, 0x0EA4E361, 0x193C3158, 0x24AE7EF0, 0x6218AE08, 0x5F8AE1A0,
+	0x7A6A5128, 0x47F81E80, 0x014ECE78, 0x3CDC81D0, 0x2B4453E9, 0x16D61C41, 0x5060CCB9, 0x6DF28311,
+	0x7F5168CB, 0x42C32763, 0x0475F79B, 0x39E7B833, 0x2E7F6A0A, 0x13ED25A2, 0x555BF55A, 0x68C9BAF2,
+	0x701C22EE, 0x4D8E6D46, 0x0B38BDBE, 0x36AAF216, 0x2132202F, 0x1CA06F87, 0x5A16BF7F, 0x6784F0D7,
+	0x75271B0D, 0x48B554A5, 0x0E03845D, 0x3391CBF5, 0x240919CC, 0x199B5664, 0x5F2D869C, 0x62BFC934,
+	0x6E86B6A4, 0x5314F90C, 0x15A229F4, 0x2830665C, 0x3FA8B465, 0x023AFBCD, 0x448C2B35, 0x791E649D,
+	0x6BBD8F47, 0x562FC0EF, 0x10991017, 0x2D0B5FBF, 0x3A938D86, 0x0701C22E, 0x41B712D6, 0x7C255D7E,
+	0x64F0C562, 0x59628ACA, 0x1FD45A32, 0x2246159A, 0x35DEC7A3, 0x084C880B, 0x4EFA58F3, 0x7368175B,
+	0x61CBFC81, 0x5C59B329, 0x1AEF63D1, 0x277D2C79, 0x30E5FE40, 0x0D77B1E8, 0x4BC16110, 0x76532EB8,
+	// Seed 0xF3
+	0x00000000, 0x31523061, 0x2BDD278F, 0x1A8F17EE, 0x1EC30853, 0x2F913832, 0x351E2FDC, 0x044C1FBD,
+	0x3D8610A6, 0x0CD420C7, 0x165B3729, 0x27090748, 0x234518F5, 0x12172894, 0x08983F7A, 0x39CA0F1B,
+	0x32756601, 0x03275660, 0x19A8418E, 0x28FA71EF, 0x2CB66E52, 0x1DE45E33, 0x076B49DD, 0x363979BC,
+	0x0FF376A7, 0x3EA146C6, 0x242E5128, 0x157C6149, 0x11307EF4, 0x20624E95, 0x3AED597B, 0x0BBF691A,
+	0x2D938B4F, 0x1CC1BB2E, 0x064EACC0, 0x371C9CA1, 0x3350831C, 0x0202B37D, 0x188DA493, 0x29DF94F2,
+	0x10159BE9, 0x2147AB88, 0x3BC8BC66, 0x0A9A8C07, 0x0ED693BA, 0x3F84A3DB, 0x250BB435, 0x14598454,
+	0x1FE6ED4E, 0x2EB4DD2F, 0x343BCAC1, 0x0569FAA0, 0x0125E51D, 0x3077D57C, 0x2AF8C292, 0x1BAAF2F3,
+	0x2260FDE8, 0x1332CD89, 0x09BDDA67, 0x38EFEA06, 0x3CA3F5BB, 0x0DF1C5DA, 0x177ED234, 0x262CE255,
+	0x125E51D3, 0x230C61B2, 0x3983765C, 0x08D1463D, 0x0C9D5980, 0x3DCF69E1, 0x27407E0F, 0x16124E6E,
+	0x2FD84175, 0x1E8A7114, 0x040566FA, 0x3557569B, 0x311B4926, 0x00497947, 0x1AC66EA9, 0x2B945EC8,
+	0x202B37D2, 0x117907B3, 0x0BF6105D, 0x3AA4203C, 0x3EE83F81, 0x0FBA0FE0, 0x1535180E, 0x2467286F,
+	0x1DAD2774, 0x2CFF1715, 0x367000FB, 0x0722309A, 0x036E2F27, 0x323C1F46, 0x28B308A8, 0x19E138C9,
+	0x3FCDDA9C, 0x0E9FEAFD, 0x1410FD13, 0x2542CD72, 0x210ED2CF, 0x105CE2AE, 0x0AD3F540, 0x3B81C521,
+	0x024BCA3A, 0x3319FA5B, 0x2996EDB5, 0x18C4DDD4, 0x1C88C269, 0x2DDAF208, 0x3755E5E6, 0x0607D587,
+	0x0DB8BC9D, 0x3CEA8CFC, 0x26659B12, 0x1737AB73, 0x137BB4CE, 0x222984AF, 0x38A69341, 0x09F4A320,
+	0x303EAC3B, 0x016C9C5A, 0x1BE38BB4, 0x2AB1BBD5, 0x2EFDA468, 0x1FAF9409, 0x052083E7, 0x3472B386,
+	0x24BCA3A6, 0x15EE93C7, 0x0F618429, 0x3E33B448, 0x3A7FABF5, 0x0B2D9B94, 0x11A28C7A, 0x20F0BC1B,
+	0x193AB300, 0x28688361, 0x32E7948F, 0x03B5A4EE, 0x07F9BB53, 0x36AB8B32, 0x2C249CDC, 0x1D76ACBD,
+	0x16C9C5A7, 0x279BF5C6, 0x3D14E228, 0x0C46D249, 0x080ACDF4, 0x3958FD95, 0x23D7EA7B, 0x1285DA1A,
+	0x2B4FD501, 0x1A1DE560, 0x0092F28E, 0x31C0C2EF, 0x358CDD52, 0x04DEED33, 0x1E51FADD, 0x2F03CABC,
+	0x092F28E9, 0x387D1888, 0x22F20F66, 0x13A03F07, 0x17EC20BA, 0x26BE10DB, 0x3C310735, 0x0D633754,
+	0x34A9384F, 0x05FB082E, 0x1F741FC0, 0x2E262FA1, 0x2A6A301C, 0x1B38007D, 0x01B71793, 0x30E527F2,
+	0x3B5A4EE8, 0x0A087E89, 0x10876967, 0x21D55906, 0x259946BB, 0x14CB76DA, 0x0E446134, 0x3F165155,
+	0x06DC5E4E, 0x378E6E2F, 0x2D0179C1, 0x1C5349A0, 0x181F561D, 0x294D667C, 0x33C27192, 0x029041F3,
+	0x36E2F275, 0x07B0C214, 0x1D3FD5FA, 0x2C6DE59B, 0x2821FA26, 0x1973CA47, 0x03FCDDA9, 0x32AEEDC8,
+	0x0B64E2D3, 0x3A36D2B2, 0x20B9C55C, 0x11EBF53D, 0x15A7EA80, 0x24F5DAE1, 0x3E7ACD0F, 0x0F28FD6E,
+	0x04979474, 0x35C5A415, 0x2F4AB3FB, 0x1E18839A, 0x1A549C27, 0x2B06AC46, 0x3189BBA8, 0x00DB8BC9,
+	0x391184D2, 0x0843B4B3, 0x12CCA35D, 0x239E933C, 0x27D28C81, 0x1680BCE0, 0x0C0FAB0E, 0x3D5D9B6F,
+	0x1B71793A, 0x2A23495B, 0x30AC5EB5, 0x01FE6ED4, 0x05B27169, 0x34E04108, 0x2E6F56E6, 0x1F3D6687,
+	0x26F7699C, 0x17A559FD, 0x0D2A4E13, 0x3C787E72, 0x383461CF, 0x096651AE, 0x13E94640, 0x22BB7621,
+	0x29041F3B, 0x18562F5A, 0x02D938B4, 0x338B08D5, 0x37C71768, 0x06952709, 0x1C1A30E7, 0x2D480086,
+	0x14820F9D, 0x25D03FFC, 0x3F5F2812, 0x0E0D1873, 0x0A4107CE, 0x3B1337AF, 0x219C2041, 0x10CE1020,
+	// Seed 0xF4
+	0x00000000, 0xABC25D27, 0x2224CC45, 0x89E69162, 0x4449988A, 0xEF8BC5AD, 0x666D54CF, 0xCDAF09E8,
+	0x88933114, 0x23516C33, 0xAAB7FD51, 0x0175A076, 0xCCDAA99E, 0x6718F4B9, 0xEEFE65DB, 0x453C38FC,
+	0x64861423, 0xCF444904, 0x46A2D866, 0xED608541, 0x20CF8CA9, 0x8B0DD18E, 0x02EB40EC, 0xA9291DCB,
+	0xEC152537, 0x47D77810, 0xCE31E972, 0x65F3B455, 0xA85CBDBD, 0x039EE09A, 0x8A7871F8, 0x21BA2CDF,
+	0xC90C2846, 0x62CE7561, 0xEB28E403, 0x40EAB924, 0x8D45B0CC, 0x2687EDEB, 0xAF617C89, 0x04A321AE,
+	0x419F1952, 0xEA5D4475, 0x63BBD517, 0xC8798830, 0x05D681D8, 0xAE14DCFF, 0x27F24D9D, 0x8C3010BA,
+	0xAD8A3C65, 0x06486142, 0x8FAEF020, 0x246CAD07, 0xE9C3A4EF, 0x4201F9C8, 0xCBE768AA, 0x6025358D,
+	0x25190D71, 0x8EDB5056, 0x073DC134, 0xACFF9C13, 0x615095FB, 0xCA92C8DC, 0x437459BE, 0xE8B60499,
+	0xE7B82687, 0x4C7A7BA0, 0xC59CEAC2, 0x6E5EB7E5, 0xA3F1BE0D, 0x0833E32A, 0x81D57248, 0x2A172F6F,
+	0x6F2B1793, 0xC4E94AB4, 0x4D0FDBD6, 0xE6CD86F1, 0x2B628F19, 0x80A0D23E, 0x0946435C, 0xA2841E7B,
+	0x833E32A4, 0x28FC6F83, 0xA11AFEE1, 0x0AD8A3C6, 0xC777AA2E, 0x6CB5F709, 0xE553666B, 0x4E913B4C,
+	0x0BAD03B0, 0xA06F5E97, 0x2989CFF5, 0x824B92D2, 0x4FE49B3A, 0xE426C61D, 0x6DC0577F, 0xC6020A58,
+	0x2EB40EC1, 0x857653E6, 0x0C90C284, 0xA7529FA3, 0x6AFD964B, 0xC13FCB6C, 0x48D95A0E, 0xE31B0729,
+	0xA6273FD5, 0x0DE562F2, 0x8403F390, 0x2FC1AEB7, 0xE26EA75F, 0x49ACFA78, 0xC04A6B1A, 0x6B88363D,
+	0x4A321AE2, 0xE1F047C5, 0x6816D6A7, 0xC3D48B80, 0x0E7B8268, 0xA5B9DF4F, 0x2C5F4E2D, 0x879D130A,
+	0xC2A12BF6, 0x696376D1, 0xE085E7B3, 0x4B47BA94, 0x86E8B37C, 0x2D2AEE5B, 0xA4CC7F39, 0x0F0E221E,
+	0xBAD03B05, 0x11126622, 0x98F4F740, 0x3336AA67, 0xFE99A38F, 0x555BFEA8, 0xDCBD6FCA, 0x777F32ED,
+	0x32430A11, 0x99815736, 0x1067C654, 0xBBA59B73, 0x760A929B, 0xDDC8CFBC, 0x542E5EDE, 0xFFEC03F9,
+	0xDE562F26, 0x75947201, 0xFC72E363, 0x57B0BE44, 0x9A1FB7AC, 0x31DDEA8B, 0xB83B7BE9, 0x13F926CE,
+	0x56C51E32, 0xFD074315, 0x74E1D277, 0xDF238F50, 0x128C86B8, 0xB94EDB9F, 0x30A84AFD, 0x9B6A17DA,
+	0x73DC1343, 0xD81E4E64, 0x51F8DF06, 0xFA3A8221, 0x37958BC9, 0x9C57D6EE, 0x15B1478C, 0xBE731AAB,
+	0xFB4F2257, 0x508D7F70, 0xD96BEE12, 0x72A9B335, 0xBF06BADD, 0x14C4E7FA, 0x9D227698, 0x36E02BBF,
+	0x175A0760, 0xBC985A47, 0x357ECB25, 0x9EBC9602, 0x53139FEA, 0xF8D1C2CD, 0x713753AF, 0xDAF50E88,
+	0x9FC93674, 0x340B6B53, 0xBDEDFA31, 0x162FA716, 0xDB80AEFE, 0x7042F3D9, 0xF9A462BB, 0x52663F9C,
+	0x5D681D82, 0xF6AA40A5, 0x7F4CD1C7, 0xD48E8CE0, 0x19218508, 0xB2E3D82F, 0x3B05494D, 0x90C7146A,
+	0xD5FB2C96, 0x7E3971B1, 0xF7DFE0D3, 0x5C1DBDF4, 0x91B2B41C, 0x3A70E93B, 0xB3967859, 0x1854257E,
+	0x39EE09A1, 0x922C5486, 0x1BCAC5E4, 0xB00898C3, 0x7DA7912B, 0xD665CC0C, 0x5F835D6E, 0xF4410049,
+	0xB17D38B5, 0x1ABF6592, 0x9359F4F0, 0x389BA9D7, 0xF534A03F, 0x5EF6FD18, 0xD7106C7A, 0x7CD2315D,
+	0x946435C4, 0x3FA668E3, 0xB640F981, 0x1D82A4A6, 0xD02DAD4E, 0x7BEFF069, 0xF209610B, 0x59CB3C2C,
+	0x1CF704D0, 0xB73559F7, 0x3ED3C895, 0x951195B2, 0x58BE9C5A, 0xF37CC17D, 0x7A9A501F, 0xD1580D38,
+	0xF0E221E7, 0x5B207CC0, 0xD2C6EDA2, 0x7904B085, 0xB4ABB96D, 0x1F69E44A, 0x968F7528, 0x3D4D280F,
+	0x787110F3, 0xD3B34DD4, 0x5A55DCB6, 0xF1978191, 0x3C388879, 0x97FAD55E, 0x1E1C443C, 0xB5DE191B,
+	// Seed 0xF5
+	0x00000000, 0xDA1C640A, 0x2F96C553, 0xF58AA159, 0x5F2D8AA6, 0x8531EEAC, 0x70BB4FF5, 0xAAA72BFF,
+	0xBE5B154C, 0x64477146, 0x91CDD01F, 0x4BD1B415, 0xE1769FEA, 0x3B6AFBE0, 0xCEE05AB9, 0x14FC3EB3,
+	0xE71827DF, 0x3D0443D5, 0xC88EE28C, 0x12928686, 0xB835AD79, 0x6229C973, 0x97A3682A, 0x4DBF0C20,
+	0x59433293, 0x835F5699, 0x76D5F7C0, 0xACC993CA, 0x066EB835, 0xDC72DC3F, 0x29F87D66, 0xF3E4196C,
+	0x559E42F9, 0x8F8226F3, 0x7A0887AA, 0xA014E3A0, 0x0AB3C85F, 0xD0AFAC55, 0x25250D0C, 0xFF396906,
+	0xEBC557B5, 0x31D933BF, 0xC45392E6, 0x1E4FF6EC, 0xB4E8DD13, 0x6EF4B919, 0x9B7E1840, 0x41627C4A,
+	0xB2866526, 0x689A012C, 0x9D10A075, 0x470CC47F, 0xEDABEF80, 0x37B78B8A, 0xC23D2AD3, 0x18214ED9,
+	0x0CDD706A, 0xD6C11460, 0x234BB539, 0xF957D133, 0x53F0FACC, 0x89EC9EC6, 0x7C663F9F, 0xA67A5B95,
+	0xAB3C85F2, 0x7120E1F8, 0x84AA40A1, 0x5EB624AB, 0xF4110F54, 0x2E0D6B5E, 0xDB87CA07, 0x019BAE0D,
+	0x156790BE, 0xCF7BF4B4, 0x3AF155ED, 0xE0ED31E7, 0x4A4A1A18, 0x90567E12, 0x65DCDF4B, 0xBFC0BB41,
+	0x4C24A22D, 0x9638C627, 0x63B2677E, 0xB9AE0374, 0x1309288B, 0xC9154C81, 0x3C9FEDD8, 0xE68389D2,
+	0xF27FB761, 0x2863D36B, 0xDDE97232, 0x07F51638, 0xAD523DC7, 0x774E59CD, 0x82C4F894, 0x58D89C9E,
+	0xFEA2C70B, 0x24BEA301, 0xD1340258, 0x0B286652, 0xA18F4DAD, 0x7B9329A7, 0x8E1988FE, 0x5405ECF4,
+	0x40F9D247, 0x9AE5B64D, 0x6F6F1714, 0xB573731E, 0x1FD458E1, 0xC5C83CEB, 0x30429DB2, 0xEA5EF9B8,
+	0x19BAE0D4, 0xC3A684DE, 0x362C2587, 0xEC30418D, 0x46976A72, 0x9C8B0E78, 0x6901AF21, 0xB31DCB2B,
+	0xA7E1F598, 0x7DFD9192, 0x887730CB, 0x526B54C1, 0xF8CC7F3E, 0x22D01B34, 0xD75ABA6D, 0x0D46DE67,
+	0xCDD706A3, 0x17CB62A9, 0xE241C3F0, 0x385DA7FA, 0x92FA8C05, 0x48E6E80F, 0xBD6C4956, 0x67702D5C,
+	0x738C13EF, 0xA99077E5, 0x5C1AD6BC, 0x8606B2B6, 0x2CA19949, 0xF6BDFD43, 0x03375C1A, 0xD92B3810,
+	0x2ACF217C, 0xF0D34576, 0x0559E42F, 0xDF458025, 0x75E2ABDA, 0xAFFECFD0, 0x5A746E89, 0x80680A83,
+	0x94943430, 0x4E88503A, 0xBB02F163, 0x611E9569, 0xCBB9BE96, 0x11A5DA9C, 0xE42F7BC5, 0x3E331FCF,
+	0x9849445A, 0x42552050, 0xB7DF8109, 0x6DC3E503, 0xC764CEFC, 0x1D78AAF6, 0xE8F20BAF, 0x32EE6FA5,
+	0x26125116, 0xFC0E351C, 0x09849445, 0xD398F04F, 0x793FDBB0, 0xA323BFBA, 0x56A91EE3, 0x8CB57AE9,
+	0x7F516385, 0xA54D078F, 0x50C7A6D6, 0x8ADBC2DC, 0x207CE923, 0xFA608D29, 0x0FEA2C70, 0xD5F6487A,
+	0xC10A76C9, 0x1B1612C3, 0xEE9CB39A, 0x3480D790, 0x9E27FC6F, 0x443B9865, 0xB1B1393C, 0x6BAD5D36,
+	0x66EB8351, 0xBCF7E75B, 0x497D4602, 0x93612208, 0x39C609F7, 0xE3DA6DFD, 0x1650CCA4, 0xCC4CA8AE,
+	0xD8B0961D, 0x02ACF217, 0xF726534E, 0x2D3A3744, 0x879D1CBB, 0x5D8178B1, 0xA80BD9E8, 0x7217BDE2,
+	0x81F3A48E, 0x5BEFC084, 0xAE6561DD, 0x747905D7, 0xDEDE2E28, 0x04C24A22, 0xF148EB7B, 0x2B548F71,
+	0x3FA8B1C2, 0xE5B4D5C8, 0x103E7491, 0xCA22109B, 0x60853B64, 0xBA995F6E, 0x4F13FE37, 0x950F9A3D,
+	0x3375C1A8, 0xE969A5A2, 0x1CE304FB, 0xC6FF60F1, 0x6C584B0E, 0xB6442F04, 0x43CE8E5D, 0x99D2EA57,
+	0x8D2ED4E4, 0x5732B0EE, 0xA2B811B7, 0x78A475BD, 0xD2035E42, 0x081F3A48, 0xFD959B11, 0x2789FF1B,
+	0xD46DE677, 0x0E71827D, 0xFBFB2324, 0x21E7472E, 0x8B406CD1, 0x515C08DB, 0xA4D6A982, 0x7ECACD88,
+	0x6A36F33B, 0xB02A9731, 0x45A03668, 0x9FBC5262, 0x351B799D, 0xEF071D97, 0x1A8DBCCE, 0xC091D8C4,
+	// Seed 0xF6
+	0x00000000, 0x39496C3F, 0x7292D87E, 0x4BDBB441, 0x4C991F2F, 0x75D07310, 0x3E0BC751, 0x0742AB6E,
+	0x308E918D, 0x09C7FDB2, 0x421C49F3, 0x7B5525CC, 0x7C178EA2, 0x455EE29D, 0x0E8556DC, 0x37CC3AE3,
+	0x611D231A, 0x58544F25, 0x138FFB64, 0x2AC6975B, 0x2D843C35, 0x14CD500A, 0x5F16E44B, 0x665F8874,
+	0x5193B297, 0x68DADEA8, 0x23016AE9, 0x1A4806D6, 0x1D0AADB8, 0x2443C187, 0x6F9875C6, 0x56D119F9,
+	0x6B86E9E7, 0x52CF85D8, 0x19143199, 0x205D5DA6, 0x271FF6C8, 0x1E569AF7, 0x558D2EB6, 0x6CC44289,
+	0x5B08786A, 0x62411455, 0x299AA014, 0x10D3CC2B, 0x17916745, 0x2ED80B7A, 0x6503BF3B, 0x5C4AD304,
+	0x0A9BCAFD, 0x33D2A6C2, 0x78091283, 0x41407EBC, 0x4602D5D2, 0x7F4BB9ED, 0x34900DAC, 0x0DD96193,
+	0x3A155B70, 0x035C374F, 0x4887830E, 0x71CEEF31, 0x768C445F, 0x4FC52860, 0x041E9C21, 0x3D57F01E,
+	0x7EB17C1D, 0x47F81022, 0x0C23A463, 0x356AC85C, 0x32286332, 0x0B610F0D, 0x40BABB4C, 0x79F3D773,
+	0x4E3FED90, 0x777681AF, 0x3CAD35EE, 0x05E459D1, 0x02A6F2BF, 0x3BEF9E80, 0x70342AC1, 0x497D46FE,
+	0x1FAC5F07, 0x26E53338, 0x6D3E8779, 0x5477EB46, 0x53354028, 0x6A7C2C17, 0x21A79856, 0x18EEF469,
+	0x2F22CE8A, 0x166BA2B5, 0x5DB016F4, 0x64F97ACB, 0x63BBD1A5, 0x5AF2BD9A, 0x112909DB, 0x286065E4,
+	0x153795FA, 0x2C7EF9C5, 0x67A54D84, 0x5EEC21BB, 0x59AE8AD5, 0x60E7E6EA, 0x2B3C52AB, 0x12753E94,
+	0x25B90477, 0x1CF06848, 0x572BDC09, 0x6E62B036, 0x69201B58, 0x50697767, 0x1BB2C326, 0x22FBAF19,
+	0x742AB6E0, 0x4D63DADF, 0x06B86E9E, 0x3FF102A1, 0x38B3A9CF, 0x01FAC5F0, 0x4A2171B1, 0x73681D8E,
+	0x44A4276D, 0x7DED4B52, 0x3636FF13, 0x0F7F932C, 0x083D3842, 0x3174547D, 0x7AAFE03C, 0x43E68C03,
+	0x54DE57E9, 0x6D973BD6, 0x264C8F97, 0x1F05E3A8, 0x184748C6, 0x210E24F9, 0x6AD590B8, 0x539CFC87,
+	0x6450C664, 0x5D19AA5B, 0x16C21E1A, 0x2F8B7225, 0x28C9D94B, 0x1180B574, 0x5A5B0135, 0x63126D0A,
+	0x35C374F3, 0x0C8A18CC, 0x4751AC8D, 0x7E18C0B2, 0x795A6BDC, 0x401307E3, 0x0BC8B3A2, 0x3281DF9D,
+	0x054DE57E, 0x3C048941, 0x77DF3D00, 0x4E96513F, 0x49D4FA51, 0x709D966E, 0x3B46222F, 0x020F4E10,
+	0x3F58BE0E, 0x0611D231, 0x4DCA6670, 0x74830A4F, 0x73C1A121, 0x4A88CD1E, 0x0153795F, 0x381A1560,
+	0x0FD62F83, 0x369F43BC, 0x7D44F7FD, 0x440D9BC2, 0x434F30AC, 0x7A065C93, 0x31DDE8D2, 0x089484ED,
+	0x5E459D14, 0x670CF12B, 0x2CD7456A, 0x159E2955, 0x12DC823B, 0x2B95EE04, 0x604E5A45, 0x5907367A,
+	0x6ECB0C99, 0x578260A6, 0x1C59D4E7, 0x2510B8D8, 0x225213B6, 0x1B1B7F89, 0x50C0CBC8, 0x6989A7F7,
+	0x2A6F2BF4, 0x132647CB, 0x58FDF38A, 0x61B49FB5, 0x66F634DB, 0x5FBF58E4, 0x1464ECA5, 0x2D2D809A,
+	0x1AE1BA79, 0x23A8D646, 0x68736207, 0x513A0E38, 0x5678A556, 0x6F31C969, 0x24EA7D28, 0x1DA31117,
+	0x4B7208EE, 0x723B64D1, 0x39E0D090, 0x00A9BCAF, 0x07EB17C1, 0x3EA27BFE, 0x7579CFBF, 0x4C30A380,
+	0x7BFC9963, 0x42B5F55C, 0x096E411D, 0x30272D22, 0x3765864C, 0x0E2CEA73, 0x45F75E32, 0x7CBE320D,
+	0x41E9C213, 0x78A0AE2C, 0x337B1A6D, 0x0A327652, 0x0D70DD3C, 0x3439B103, 0x7FE20542, 0x46AB697D,
+	0x7167539E, 0x482E3FA1, 0x03F58BE0, 0x3ABCE7DF, 0x3DFE4CB1, 0x04B7208E, 0x4F6C94CF, 0x7625F8F0,
+	0x20F4E109, 0x19BD8D36, 0x52663977, 0x6B2F5548, 0x6C6DFE26, 0x55249219, 0x1EFF2658, 0x27B64A67,
+	0x107A7084, 0x29331CBB, 0x62E8A8FA, 0x5BA1C4C5, 0x5CE36FAB, 0x65AA0394, 0x2E71B7D5, 0x1738DBEA,
+	// Seed 0xF7
+	0x00000000, 0x2311B0EE, 0x0191AEA3, 0x22801E4D, 0x03235D46, 0x2032EDA8, 0x02B2F3E5, 0x21A3430B,
+	0x0646BA8C, 0x25570A62, 0x07D7142F, 0x24C6A4C1, 0x0565E7CA, 0x26745724, 0x04F44969, 0x27E5F987,
+	0x0C8D7518, 0x2F9CC5F6, 0x0D1CDBBB, 0x2E0D6B55, 0x0FAE285E, 0x2CBF98B0, 0x0E3F86FD, 0x2D2E3613,
+	0x0ACBCF94, 0x29DA7F7A, 0x0B5A6137, 0x284BD1D9, 0x09E892D2, 0x2AF9223C, 0x08793C71, 0x2B688C9F,
+	0x191AEA30, 0x3A0B5ADE, 0x188B4493, 0x3B9AF47D, 0x1A39B776, 0x39280798, 0x1BA819D5, 0x38B9A93B,
+	0x1F5C50BC, 0x3C4DE052, 0x1ECDFE1F, 0x3DDC4EF1, 0x1C7F0DFA, 0x3F6EBD14, 0x1DEEA359, 0x3EFF13B7,
+	0x15979F28, 0x36862FC6, 0x1406318B, 0x37178165, 0x16B4C26E, 0x35A57280, 0x17256CCD, 0x3434DC23,
+	0x13D125A4, 0x30C0954A, 0x12408B07, 0x31513BE9, 0x10F278E2, 0x33E3C80C, 0x1163D641, 0x327266AF,
+	0x3235D460, 0x1124648E, 0x33A47AC3, 0x10B5CA2D, 0x31168926, 0x120739C8, 0x30872785, 0x1396976B,
+	0x34736EEC, 0x1762DE02, 0x35E2C04F, 0x16F370A1, 0x375033AA, 0x14418344, 0x36C19D09, 0x15D02DE7,
+	0x3EB8A178, 0x1DA91196, 0x3F290FDB, 0x1C38BF35, 0x3D9BFC3E, 0x1E8A4CD0, 0x3C0A529D, 0x1F1BE273,
+	0x38FE1BF4, 0x1BEFAB1A, 0x396FB557, 0x1A7E05B9, 0x3BDD46B2, 0x18CCF65C, 0x3A4CE811, 0x195D58FF,
+	0x2B2F3E50, 0x083E8EBE, 0x2ABE90F3, 0x09AF201D, 0x280C6316, 0x0B1DD3F8, 0x299DCDB5, 0x0A8C7D5B,
+	0x2D6984DC, 0x0E783432, 0x2CF82A7F, 0x0FE99A91, 0x2E4AD99A, 0x0D5B6974, 0x2FDB7739, 0x0CCAC7D7,
+	0x27A24B48, 0x04B3FBA6, 0x2633E5EB, 0x05225505, 0x2481160E, 0x0790A6E0, 0x2510B8AD, 0x06010843,
+	0x21E4F1C4, 0x02F5412A, 0x20755F67, 0x0364EF89, 0x22C7AC82, 0x01D61C6C, 0x23560221, 0x0047B2CF,
+	0x23D967BF, 0x00C8D751, 0x2248C91C, 0x015979F2, 0x20FA3AF9, 0x03EB8A17, 0x216B945A, 0x027A24B4,
+	0x259FDD33, 0x068E6DDD, 0x240E7390, 0x071FC37E, 0x26BC8075, 0x05AD309B, 0x272D2ED6, 0x043C9E38,
+	0x2F5412A7, 0x0C45A249, 0x2EC5BC04, 0x0DD40CEA, 0x2C774FE1, 0x0F66FF0F, 0x2DE6E142, 0x0EF751AC,
+	0x2912A82B, 0x0A0318C5, 0x28830688, 0x0B92B666, 0x2A31F56D, 0x09204583, 0x2BA05BCE, 0x08B1EB20,
+	0x3AC38D8F, 0x19D23D61, 0x3B52232C, 0x184393C2, 0x39E0D0C9, 0x1AF16027, 0x38717E6A, 0x1B60CE84,
+	0x3C853703, 0x1F9487ED, 0x3D1499A0, 0x1E05294E, 0x3FA66A45, 0x1CB7DAAB, 0x3E37C4E6, 0x1D267408,
+	0x364EF897, 0x155F4879, 0x37DF5634, 0x14CEE6DA, 0x356DA5D1, 0x167C153F, 0x34FC0B72, 0x17EDBB9C,
+	0x3008421B, 0x1319F2F5, 0x3199ECB8, 0x12885C56, 0x332B1F5D, 0x103AAFB3, 0x32BAB1FE, 0x11AB0110,
+	0x11ECB3DF, 0x32FD0331, 0x107D1D7C, 0x336CAD92, 0x12CFEE99, 0x31DE5E77, 0x135E403A, 0x304FF0D4,
+	0x17AA0953, 0x34BBB9BD, 0x163BA7F0, 0x352A171E, 0x14895415, 0x3798E4FB, 0x1518FAB6, 0x36094A58,
+	0x1D61C6C7, 0x3E707629, 0x1CF06864, 0x3FE1D88A, 0x1E429B81, 0x3D532B6F, 0x1FD33522, 0x3CC285CC,
+	0x1B277C4B, 0x3836CCA5, 0x1AB6D2E8, 0x39A76206, 0x1804210D, 0x3B1591E3, 0x19958FAE, 0x3A843F40,
+	0x08F659EF, 0x2BE7E901, 0x0967F74C, 0x2A7647A2, 0x0BD504A9, 0x28C4B447, 0x0A44AA0A, 0x29551AE4,
+	0x0EB0E363, 0x2DA1538D, 0x0F214DC0, 0x2C30FD2E, 0x0D93BE25, 0x2E820ECB, 0x0C021086, 0x2F13A068,
+	0x047B2CF7, 0x276A9C19, 0x05EA8254, 0x26FB32BA, 0x075871B1, 0x2449C15F, 0x06C9DF12, 0x25D86FFC,
+	0x023D967B, 0x212C2695, 0x03AC38D8, 0x20BD8836, 0x011ECB3D, 0x220F7BD3, 0x008F659E, 0x239ED570,
+	// Seed 0xF8
+	0x00000000, 0xE51ED36E, 0xACF14281, 0x49EF91EF, 0x3F2E615F, 0xDA30B231, 0x93DF23DE, 0x76C1F0B0,
+	0x7E5CC2BE, 0x9B4211D0, 0xD2AD803F, 0x37B35351, 0x4172A3E1, 0xA46C708F, 0xED83E160, 0x089D320E,
+	0xFCB9857C, 0x19A75612, 0x5048C7FD, 0xB5561493, 0xC397E423, 0x2689374D, 0x6F66A6A2, 0x8A7875CC,
+	0x82E547C2, 0x67FB94AC, 0x2E140543, 0xCB0AD62D, 0xBDCB269D, 0x58D5F5F3, 0x113A641C, 0xF424B772,
+	0x9FBFEEA5, 0x7AA13DCB, 0x334EAC24, 0xD6507F4A, 0xA0918FFA, 0x458F5C94, 0x0C60CD7B, 0xE97E1E15,
+	0xE1E32C1B, 0x04FDFF75, 0x4D126E9A, 0xA80CBDF4, 0xDECD4D44, 0x3BD39E2A, 0x723C0FC5, 0x9722DCAB,
+	0x63066BD9, 0x8618B8B7, 0xCFF72958, 0x2AE9FA36, 0x5C280A86, 0xB936D9E8, 0xF0D94807, 0x15C79B69,
+	0x1D5AA967, 0xF8447A09, 0xB1ABEBE6, 0x54B53888, 0x2274C838, 0xC76A1B56, 0x8E858AB9, 0x6B9B59D7,
+	0x59B33917, 0xBCADEA79, 0xF5427B96, 0x105CA8F8, 0x669D5848, 0x83838B26, 0xCA6C1AC9, 0x2F72C9A7,
+	0x27EFFBA9, 0xC2F128C7, 0x8B1EB928, 0x6E006A46, 0x18C19AF6, 0xFDDF4998, 0xB430D877, 0x512E0B19,
+	0xA50ABC6B, 0x40146F05, 0x09FBFEEA, 0xECE52D84, 0x9A24DD34, 0x7F3A0E5A, 0x36D59FB5, 0xD3CB4CDB,
+	0xDB567ED5, 0x3E48ADBB, 0x77A73C54, 0x92B9EF3A, 0xE4781F8A, 0x0166CCE4, 0x48895D0B, 0xAD978E65,
+	0xC60CD7B2, 0x231204DC, 0x6AFD9533, 0x8FE3465D, 0xF922B6ED, 0x1C3C6583, 0x55D3F46C, 0xB0CD2702,
+	0xB850150C, 0x5D4EC662, 0x14A1578D, 0xF1BF84E3, 0x877E7453, 0x6260A73D, 0x2B8F36D2, 0xCE91E5BC,
+	0x3AB552CE, 0xDFAB81A0, 0x9644104F, 0x735AC321, 0x059B3391, 0xE085E0FF, 0xA96A7110, 0x4C74A27E,
+	0x44E99070, 0xA1F7431E, 0xE818D2F1, 0x0D06019F, 0x7BC7F12F, 0x9ED92241, 0xD736B3AE, 0x322860C0,
+	0xB366722E, 0x5678A140, 0x1F9730AF, 0xFA89E3C1, 0x8C481371, 0x6956C01F, 0x20B951F0, 0xC5A7829E,
+	0xCD3AB090, 0x282463FE, 0x61CBF211, 0x84D5217F, 0xF214D1CF, 0x170A02A1, 0x5EE5934E, 0xBBFB4020,
+	0x4FDFF752, 0xAAC1243C, 0xE32EB5D3, 0x063066BD, 0x70F1960D, 0x95EF4563, 0xDC00D48C, 0x391E07E2,
+	0x318335EC, 0xD49DE682, 0x9D72776D, 0x786CA403, 0x0EAD54B3, 0xEBB387DD, 0xA25C1632, 0x4742C55C,
+	0x2CD99C8B, 0xC9C74FE5, 0x8028DE0A, 0x65360D64, 0x13F7FDD4, 0xF6E92EBA, 0xBF06BF55, 0x5A186C3B,
+	0x52855E35, 0xB79B8D5B, 0xFE741CB4, 0x1B6ACFDA, 0x6DAB3F6A, 0x88B5EC04, 0xC15A7DEB, 0x2444AE85,
+	0xD06019F7, 0x357ECA99, 0x7C915B76, 0x998F8818, 0xEF4E78A8, 0x0A50ABC6, 0x43BF3A29, 0xA6A1E947,
+	0xAE3CDB49, 0x4B220827, 0x02CD99C8, 0xE7D34AA6, 0x9112BA16, 0x740C6978, 0x3DE3F897, 0xD8FD2BF9,
+	0xEAD54B39, 0x0FCB9857, 0x462409B8, 0xA33ADAD6, 0xD5FB2A66, 0x30E5F908, 0x790A68E7, 0x9C14BB89,
+	0x94898987, 0x71975AE9, 0x3878CB06, 0xDD661868, 0xABA7E8D8, 0x4EB93BB6, 0x0756AA59, 0xE2487937,
+	0x166CCE45, 0xF3721D2B, 0xBA9D8CC4, 0x5F835FAA, 0x2942AF1A, 0xCC5C7C74, 0x85B3ED9B, 0x60AD3EF5,
+	0x68300CFB, 0x8D2EDF95, 0xC4C14E7A, 0x21DF9D14, 0x571E6DA4, 0xB200BECA, 0xFBEF2F25, 0x1EF1FC4B,
+	0x756AA59C, 0x907476F2, 0xD99BE71D, 0x3C853473, 0x4A44C4C3, 0xAF5A17AD, 0xE6B58642, 0x03AB552C,
+	0x0B366722, 0xEE28B44C, 0xA7C725A3, 0x42D9F6CD, 0x3418067D, 0xD106D513, 0x98E944FC, 0x7DF79792,
+	0x89D320E0, 0x6CCDF38E, 0x25226261, 0xC03CB10F, 0xB6FD41BF, 0x53E392D1, 0x1A0C033E, 0xFF12D050,
+	0xF78FE25E, 0x12913130, 0x5B7EA0DF, 0xBE6073B1, 0xC8A18301, 0x2DBF506F, 0x6450C180, 0x814E12EE,
+	// Seed 0xF9
+	0x00000000, 0x4A2C1C30, 0x94583860, 0xDE742450, 0xA072E5B1, 0xEA5EF981, 0x342ADDD1, 0x7E06C1E1,
+	0xC8275E13, 0x820B4223, 0x5C7F6673, 0x16537A43, 0x6855BBA2, 0x2279A792, 0xFC0D83C2, 0xB6219FF2,
+	0x188C2957, 0x52A03567, 0x8CD41137, 0xC6F80D07, 0xB8FECCE6, 0xF2D2D0D6, 0x2CA6F486, 0x668AE8B6,
+	0xD0AB7744, 0x9A876B74, 0x44F34F24, 0x0EDF5314, 0x70D992F5, 0x3AF58EC5, 0xE481AA95, 0xAEADB6A5,
+	0x311852AE, 0x7B344E9E, 0xA5406ACE, 0xEF6C76FE, 0x916AB71F, 0xDB46AB2F, 0x05328F7F, 0x4F1E934F,
+	0xF93F0CBD, 0xB313108D, 0x6D6734DD, 0x274B28ED, 0x594DE90C, 0x1361F53C, 0xCD15D16C, 0x8739CD5C,
+	0x29947BF9, 0x63B867C9, 0xBDCC4399, 0xF7E05FA9, 0x89E69E48, 0xC3CA8278, 0x1DBEA628, 0x5792BA18,
+	0xE1B325EA, 0xAB9F39DA, 0x75EB1D8A, 0x3FC701BA, 0x41C1C05B, 0x0BEDDC6B, 0xD599F83B, 0x9FB5E40B,
+	0x6230A55C, 0x281CB96C, 0xF6689D3C, 0xBC44810C, 0xC24240ED, 0x886E5CDD, 0x561A788D, 0x1C3664BD,
+	0xAA17FB4F, 0xE03BE77F, 0x3E4FC32F, 0x7463DF1F, 0x0A651EFE, 0x404902CE, 0x9E3D269E, 0xD4113AAE,
+	0x7ABC8C0B, 0x3090903B, 0xEEE4B46B, 0xA4C8A85B, 0xDACE69BA, 0x90E2758A, 0x4E9651DA, 0x04BA4DEA,
+	0xB29BD218, 0xF8B7CE28, 0x26C3EA78, 0x6CEFF648, 0x12E937A9, 0x58C52B99, 0x86B10FC9, 0xCC9D13F9,
+	0x5328F7F2, 0x1904EBC2, 0xC770CF92, 0x8D5CD3A2, 0xF35A1243, 0xB9760E73, 0x67022A23, 0x2D2E3613,
+	0x9B0FA9E1, 0xD123B5D1, 0x0F579181, 0x457B8DB1, 0x3B7D4C50, 0x71515060, 0xAF257430, 0xE5096800,
+	0x4BA4DEA5, 0x0188C295, 0xDFFCE6C5, 0x95D0FAF5, 0xEBD63B14, 0xA1FA2724, 0x7F8E0374, 0x35A21F44,
+	0x838380B6, 0xC9AF9C86, 0x17DBB8D6, 0x5DF7A4E6, 0x23F16507, 0x69DD7937, 0xB7A95D67, 0xFD854157,
+	0xC4614AB8, 0x8E4D5688, 0x503972D8, 0x1A156EE8, 0x6413AF09, 0x2E3FB339, 0xF04B9769, 0xBA678B59,
+	0x0C4614AB, 0x466A089B, 0x981E2CCB, 0xD23230FB, 0xAC34F11A, 0xE618ED2A, 0x386CC97A, 0x7240D54A,
+	0xDCED63EF, 0x96C17FDF, 0x48B55B8F, 0x029947BF, 0x7C9F865E, 0x36B39A6E, 0xE8C7BE3E, 0xA2EBA20E,
+	0x14CA3DFC, 0x5EE621CC, 0x8092059C, 0xCABE19AC, 0xB4B8D84D, 0xFE94C47D, 0x20E0E02D, 0x6ACCFC1D,
+	0xF5791816, 0xBF550426, 0x61212076, 0x2B0D3C46, 0x550BFDA7, 0x1F27E197, 0xC153C5C7, 0x8B7FD9F7,
+	0x3D5E4605, 0x77725A35, 0xA9067E65, 0xE32A6255, 0x9D2CA3B4, 0xD700BF84, 0x09749BD4, 0x435887E4,
+	0xEDF53141, 0xA7D92D71, 0x79AD0921, 0x33811511, 0x4D87D4F0, 0x07ABC8C0, 0xD9DFEC90, 0x93F3F0A0,
+	0x25D26F52, 0x6FFE7362, 0xB18A5732, 0xFBA64B02, 0x85A08AE3, 0xCF8C96D3, 0x11F8B283, 0x5BD4AEB3,
+	0xA651EFE4, 0xEC7DF3D4, 0x3209D784, 0x7825CBB4, 0x06230A55, 0x4C0F1665, 0x927B3235, 0xD8572E05,
+	0x6E76B1F7, 0x245AADC7, 0xFA2E8997, 0xB00295A7, 0xCE045446, 0x84284876, 0x5A5C6C26, 0x10707016,
+	0xBEDDC6B3, 0xF4F1DA83, 0x2A85FED3, 0x60A9E2E3, 0x1EAF2302, 0x54833F32, 0x8AF71B62, 0xC0DB0752,
+	0x76FA98A0, 0x3CD68490, 0xE2A2A0C0, 0xA88EBCF0, 0xD6887D11, 0x9CA46121, 0x42D04571, 0x08FC5941,
+	0x9749BD4A, 0xDD65A17A, 0x0311852A, 0x493D991A, 0x373B58FB, 0x7D1744CB, 0xA363609B, 0xE94F7CAB,
+	0x5F6EE359, 0x1542FF69, 0xCB36DB39, 0x811AC709, 0xFF1C06E8, 0xB5301AD8, 0x6B443E88, 0x216822B8,
+	0x8FC5941D, 0xC5E9882D, 0x1B9DAC7D, 0x51B1B04D, 0x2FB771AC, 0x659B6D9C, 0xBBEF49CC, 0xF1C355FC,
+	0x47E2CA0E, 0x0DCED63E, 0xD3BAF26E, 0x9996EE5E, 0xE7902FBF, 0xADBC338F, 0x73C817DF, 0x39E40BEF,
+	// Seed 0xFA
+	0x00000000, 0x2768BE0F, 0x4ED17C1E, 0x69B9C211, 0x27D2CE39, 0x00BA7036, 0x6903B227, 0x4E6B0C28,
+	0x4FA59C72, 0x68CD227D, 0x0174E06C, 0x261C5E63, 0x6877524B, 0x4F1FEC44, 0x26A62E55, 0x01CE905A,
+	0x253B0EE1, 0x0253B0EE, 0x6BEA72FF, 0x4C82CCF0, 0x02E9C0D8, 0x25817ED7, 0x4C38BCC6, 0x6B5002C9,
+	0x6A9E9293, 0x4DF62C9C, 0x244FEE8D, 0x03275082, 0x4D4C5CAA, 0x6A24E2A5, 0x039D20B4, 0x24F59EBB,
+	0x4A761DC2, 0x6D1EA3CD, 0x04A761DC, 0x23CFDFD3, 0x6DA4D3FB, 0x4ACC6DF4, 0x2375AFE5, 0x041D11EA,
+	0x05D381B0, 0x22BB3FBF, 0x4B02FDAE, 0x6C6A43A1, 0x22014F89, 0x0569F186, 0x6CD03397, 0x4BB88D98,
+	0x6F4D1323, 0x4825AD2C, 0x219C6F3D, 0x06F4D132, 0x489FDD1A, 0x6FF76315, 0x064EA104, 0x21261F0B,
+	0x20E88F51, 0x0780315E, 0x6E39F34F, 0x49514D40, 0x073A4168, 0x2052FF67, 0x49EB3D76, 0x6E838379,
+	0x2E9C0D81, 0x09F4B38E, 0x604D719F, 0x4725CF90, 0x094EC3B8, 0x2E267DB7, 0x479FBFA6, 0x60F701A9,
+	0x613991F3, 0x46512FFC, 0x2FE8EDED, 0x088053E2, 0x46EB5FCA, 0x6183E1C5, 0x083A23D4, 0x2F529DDB,
+	0x0BA70360, 0x2CCFBD6F, 0x45767F7E, 0x621EC171, 0x2C75CD59, 0x0B1D7356, 0x62A4B147, 0x45CC0F48,
+	0x44029F12, 0x636A211D, 0x0AD3E30C, 0x2DBB5D03, 0x63D0512B, 0x44B8EF24, 0x2D012D35, 0x0A69933A,
+	0x64EA1043, 0x4382AE4C, 0x2A3B6C5D, 0x0D53D252, 0x4338DE7A, 0x64506075, 0x0DE9A264, 0x2A811C6B,
+	0x2B4F8C31, 0x0C27323E, 0x659EF02F, 0x42F64E20, 0x0C9D4208, 0x2BF5FC07, 0x424C3E16, 0x65248019,
+	0x41D11EA2, 0x66B9A0AD, 0x0F0062BC, 0x2868DCB3, 0x6603D09B, 0x416B6E94, 0x28D2AC85, 0x0FBA128A,
+	0x0E7482D0, 0x291C3CDF, 0x40A5FECE, 0x67CD40C1, 0x29A64CE9, 0x0ECEF2E6, 0x677730F7, 0x401F8EF8,
+	0x5D381B02, 0x7A50A50D, 0x13E9671C, 0x3481D913, 0x7AEAD53B, 0x5D826B34, 0x343BA925, 0x1353172A,
+	0x129D8770, 0x35F5397F, 0x5C4CFB6E, 0x7B244561, 0x354F4949, 0x1227F746, 0x7B9E3557, 0x5CF68B58,
+	0x780315E3, 0x5F6BABEC, 0x36D269FD, 0x11BAD7F2, 0x5FD1DBDA, 0x78B965D5, 0x1100A7C4, 0x366819CB,
+	0x37A68991, 0x10CE379E, 0x7977F58F, 0x5E1F4B80, 0x107447A8, 0x371CF9A7, 0x5EA53BB6, 0x79CD85B9,
+	0x174E06C0, 0x3026B8CF, 0x599F7ADE, 0x7EF7C4D1, 0x309CC8F9, 0x17F476F6, 0x7E4DB4E7, 0x59250AE8,
+	0x58EB9AB2, 0x7F8324BD, 0x163AE6AC, 0x315258A3, 0x7F39548B, 0x5851EA84, 0x31E82895, 0x1680969A,
+	0x32750821, 0x151DB62E, 0x7CA4743F, 0x5BCCCA30, 0x15A7C618, 0x32CF7817, 0x5B76BA06, 0x7C1E0409,
+	0x7DD09453, 0x5AB82A5C, 0x3301E84D, 0x14695642, 0x5A025A6A, 0x7D6AE465, 0x14D32674, 0x33BB987B,
+	0x73A41683, 0x54CCA88C, 0x3D756A9D, 0x1A1DD492, 0x5476D8BA, 0x731E66B5, 0x1AA7A4A4, 0x3DCF1AAB,
+	0x3C018AF1, 0x1B6934FE, 0x72D0F6EF, 0x55B848E0, 0x1BD344C8, 0x3CBBFAC7, 0x550238D6, 0x726A86D9,
+	0x569F1862, 0x71F7A66D, 0x184E647C, 0x3F26DA73, 0x714DD65B, 0x56256854, 0x3F9CAA45, 0x18F4144A,
+	0x193A8410, 0x3E523A1F, 0x57EBF80E, 0x70834601, 0x3EE84A29, 0x1980F426, 0x70393637, 0x57518838,
+	0x39D20B41, 0x1EBAB54E, 0x7703775F, 0x506BC950, 0x1E00C578, 0x39687B77, 0x50D1B966, 0x77B90769,
+	0x76779733, 0x511F293C, 0x38A6EB2D, 0x1FCE5522, 0x51A5590A, 0x76CDE705, 0x1F742514, 0x381C9B1B,
+	0x1CE905A0, 0x3B81BBAF, 0x523879BE, 0x7550C7B1, 0x3B3BCB99, 0x1C537596, 0x75EAB787, 0x52820988,
+	0x534C99D2, 0x742427DD, 0x1D9DE5CC, 0x3AF55BC3, 0x749E57EB, 0x53F6E9E4, 0x3A4F2BF5, 0x1D2795FA,
+	// Seed 0xFB
+	0x00000000, 0x1D8C73C1, 0x3B18E782, 0x26949443, 0x20EF982D, 0x3D63EBEC, 0x1BF77FAF, 0x067B0C6E,
+	0x17016773, 0x0A8D14B2, 0x2C1980F1, 0x3195F330, 0x37EEFF5E, 0x2A628C9F, 0x0CF618DC, 0x117A6B1D,
+	0x2E02CEE6, 0x338EBD27, 0x151A2964, 0x08965AA5, 0x0EED56CB, 0x1361250A, 0x35F5B149, 0x2879C288,
+	0x3903A995, 0x248FDA54, 0x021B4E17, 0x1F973DD6, 0x19EC31B8, 0x04604279, 0x22F4D63A, 0x3F78A5FB,
+	0x0ADBCAE5, 0x1757B924, 0x31C32D67, 0x2C4F5EA6, 0x2A3452C8, 0x37B82109, 0x112CB54A, 0x0CA0C68B,
+	0x1DDAAD96, 0x0056DE57, 0x26C24A14, 0x3B4E39D5, 0x3D3535BB, 0x20B9467A, 0x062DD239, 0x1BA1A1F8,
+	0x24D90403, 0x395577C2, 0x1FC1E381, 0x024D9040, 0x04369C2E, 0x19BAEFEF, 0x3F2E7BAC, 0x22A2086D,
+	0x33D86370, 0x2E5410B1, 0x08C084F2, 0x154CF733, 0x1337FB5D, 0x0EBB889C, 0x282F1CDF, 0x35A36F1E,
+	0x15B795CA, 0x083BE60B, 0x2EAF7248, 0x33230189, 0x35580DE7, 0x28D47E26, 0x0E40EA65, 0x13CC99A4,
+	0x02B6F2B9, 0x1F3A8178, 0x39AE153B, 0x242266FA, 0x22596A94, 0x3FD51955, 0x19418D16, 0x04CDFED7,
+	0x3BB55B2C, 0x263928ED, 0x00ADBCAE, 0x1D21CF6F, 0x1B5AC301, 0x06D6B0C0, 0x20422483, 0x3DCE5742,
+	0x2CB43C5F, 0x31384F9E, 0x17ACDBDD, 0x0A20A81C, 0x0C5BA472, 0x11D7D7B3, 0x374343F0, 0x2ACF3031,
+	0x1F6C5F2F, 0x02E02CEE, 0x2474B8AD, 0x39F8CB6C, 0x3F83C702, 0x220FB4C3, 0x049B2080, 0x19175341,
+	0x086D385C, 0x15E14B9D, 0x3375DFDE, 0x2EF9AC1F, 0x2882A071, 0x350ED3B0, 0x139A47F3, 0x0E163432,
+	0x316E91C9, 0x2CE2E208, 0x0A76764B, 0x17FA058A, 0x118109E4, 0x0C0D7A25, 0x2A99EE66, 0x37159DA7,
+	0x266FF6BA, 0x3BE3857B, 0x1D771138, 0x00FB62F9, 0x06806E97, 0x1B0C1D56, 0x3D988915, 0x2014FAD4,
+	0x2B6F2B94, 0x36E35855, 0x1077CC16, 0x0DFBBFD7, 0x0B80B3B9, 0x160CC078, 0x3098543B, 0x2D1427FA,
+	0x3C6E4CE7, 0x21E23F26, 0x0776AB65, 0x1AFAD8A4, 0x1C81D4CA, 0x010DA70B, 0x27993348, 0x3A154089,
+	0x056DE572, 0x18E196B3, 0x3E7502F0, 0x23F97131, 0x25827D5F, 0x380E0E9E, 0x1E9A9ADD, 0x0316E91C,
+	0x126C8201, 0x0FE0F1C0, 0x29746583, 0x34F81642, 0x32831A2C, 0x2F0F69ED, 0x099BFDAE, 0x14178E6F,
+	0x21B4E171, 0x3C3892B0, 0x1AAC06F3, 0x07207532, 0x015B795C, 0x1CD70A9D, 0x3A439EDE, 0x27CFED1F,
+	0x36B58602, 0x2B39F5C3, 0x0DAD6180, 0x10211241, 0x165A1E2F, 0x0BD66DEE, 0x2D42F9AD, 0x30CE8A6C,
+	0x0FB62F97, 0x123A5C56, 0x34AEC815, 0x2922BBD4, 0x2F59B7BA, 0x32D5C47B, 0x14415038, 0x09CD23F9,
+	0x18B748E4, 0x053B3B25, 0x23AFAF66, 0x3E23DCA7, 0x3858D0C9, 0x25D4A308, 0x0340374B, 0x1ECC448A,
+	0x3ED8BE5E, 0x2354CD9F, 0x05C059DC, 0x184C2A1D, 0x1E372673, 0x03BB55B2, 0x252FC1F1, 0x38A3B230,
+	0x29D9D92D, 0x3455AAEC, 0x12C13EAF, 0x0F4D4D6E, 0x09364100, 0x14BA32C1, 0x322EA682, 0x2FA2D543,
+	0x10DA70B8, 0x0D560379, 0x2BC2973A, 0x364EE4FB, 0x3035E895, 0x2DB99B54, 0x0B2D0F17, 0x16A17CD6,
+	0x07DB17CB, 0x1A57640A, 0x3CC3F049, 0x214F8388, 0x27348FE6, 0x3AB8FC27, 0x1C2C6864, 0x01A01BA5,
+	0x340374BB, 0x298F077A, 0x0F1B9339, 0x1297E0F8, 0x14ECEC96, 0x09609F57, 0x2FF40B14, 0x327878D5,
+	0x230213C8, 0x3E8E6009, 0x181AF44A, 0x0596878B, 0x03ED8BE5, 0x1E61F824, 0x38F56C67, 0x25791FA6,
+	0x1A01BA5D, 0x078DC99C, 0x21195DDF, 0x3C952E1E, 0x3AEE2270, 0x276251B1, 0x01F6C5F2, 0x1C7AB633,
+	0x0D00DD2E, 0x108CAEEF, 0x36183AAC, 0x2B94496D, 0x2DEF4503, 0x306336C2, 0x16F7A281, 0x0B7BD140,
+	// Seed 0xFC
+	0x00000000, 0xFB8DAF6E, 0x9E8C22B3, 0x65018DDD, 0x548F3909, 0xAF029667, 0xCA031BBA, 0x318EB4D4,
+	0xA91E7212, 0x5293DD7C, 0x379250A1, 0xCC1FFFCF, 0xFD914B1B, 0x061CE475, 0x631D69A8, 0x9890C6C6,
+	0x3BAB984B, 0xC0263725, 0xA527BAF8, 0x5EAA1596, 0x6F24A142, 0x94A90E2C, 0xF1A883F1, 0x0A252C9F,
+	0x92B5EA59, 0x69384537, 0x0C39C8EA, 0xF7B46784, 0xC63AD350, 0x3DB77C3E, 0x58B6F1E3, 0xA33B5E8D,
+	0x77573096, 0x8CDA9FF8, 0xE9DB1225, 0x1256BD4B, 0x23D8099F, 0xD855A6F1, 0xBD542B2C, 0x46D98442,
+	0xDE494284, 0x25C4EDEA, 0x40C56037, 0xBB48CF59, 0x8AC67B8D, 0x714BD4E3, 0x144A593E, 0xEFC7F650,
+	0x4CFCA8DD, 0xB77107B3, 0xD2708A6E, 0x29FD2500, 0x187391D4, 0xE3FE3EBA, 0x86FFB367, 0x7D721C09,
+	0xE5E2DACF, 0x1E6F75A1, 0x7B6EF87C, 0x80E35712, 0xB16DE3C6, 0x4AE04CA8, 0x2FE1C175, 0xD46C6E1B,
+	0xEEAE612C, 0x1523CE42, 0x7022439F, 0x8BAFECF1, 0xBA215825, 0x41ACF74B, 0x24AD7A96, 0xDF20D5F8,
+	0x47B0133E, 0xBC3DBC50, 0xD93C318D, 0x22B19EE3, 0x133F2A37, 0xE8B28559, 0x8DB30884, 0x763EA7EA,
+	0xD505F967, 0x2E885609, 0x4B89DBD4, 0xB00474BA, 0x818AC06E, 0x7A076F00, 0x1F06E2DD, 0xE48B4DB3,
+	0x7C1B8B75, 0x8796241B, 0xE297A9C6, 0x191A06A8, 0x2894B27C, 0xD3191D12, 0xB61890CF, 0x4D953FA1,
+	0x99F951BA, 0x6274FED4, 0x07757309, 0xFCF8DC67, 0xCD7668B3, 0x36FBC7DD, 0x53FA4A00, 0xA877E56E,
+	0x30E723A8, 0xCB6A8CC6, 0xAE6B011B, 0x55E6AE75, 0x64681AA1, 0x9FE5B5CF, 0xFAE43812, 0x0169977C,
+	0xA252C9F1, 0x59DF669F, 0x3CDEEB42, 0xC753442C, 0xF6DDF0F8, 0x0D505F96, 0x6851D24B, 0x93DC7D25,
+	0x0B4CBBE3, 0xF0C1148D, 0x95C09950, 0x6E4D363E, 0x5FC382EA, 0xA44E2D84, 0xC14FA059, 0x3AC20F37,
+	0xB4CBBE37, 0x4F461159, 0x2A479C84, 0xD1CA33EA, 0xE044873E, 0x1BC92850, 0x7EC8A58D, 0x85450AE3,
+	0x1DD5CC25, 0xE658634B, 0x8359EE96, 0x78D441F8, 0x495AF52C, 0xB2D75A42, 0xD7D6D79F, 0x2C5B78F1,
+	0x8F60267C, 0x74ED8912, 0x11EC04CF, 0xEA61ABA1, 0xDBEF1F75, 0x2062B01B, 0x45633DC6, 0xBEEE92A8,
+	0x267E546E, 0xDDF3FB00, 0xB8F276DD, 0x437FD9B3, 0x72F16D67, 0x897CC209, 0xEC7D4FD4, 0x17F0E0BA,
+	0xC39C8EA1, 0x381121CF, 0x5D10AC12, 0xA69D037C, 0x9713B7A8, 0x6C9E18C6, 0x099F951B, 0xF2123A75,
+	0x6A82FCB3, 0x910F53DD, 0xF40EDE00, 0x0F83716E, 0x3E0DC5BA, 0xC5806AD4, 0xA081E709, 0x5B0C4867,
+	0xF83716EA, 0x03BAB984, 0x66BB3459, 0x9D369B37, 0xACB82FE3, 0x5735808D, 0x32340D50, 0xC9B9A23E,
+	0x512964F8, 0xAAA4CB96, 0xCFA5464B, 0x3428E925, 0x05A65DF1, 0xFE2BF29F, 0x9B2A7F42, 0x60A7D02C,
+	0x5A65DF1B, 0xA1E87075, 0xC4E9FDA8, 0x3F6452C6, 0x0EEAE612, 0xF567497C, 0x9066C4A1, 0x6BEB6BCF,
+	0xF37BAD09, 0x08F60267, 0x6DF78FBA, 0x967A20D4, 0xA7F49400, 0x5C793B6E, 0x3978B6B3, 0xC2F519DD,
+	0x61CE4750, 0x9A43E83E, 0xFF4265E3, 0x04CFCA8D, 0x35417E59, 0xCECCD137, 0xABCD5CEA, 0x5040F384,
+	0xC8D03542, 0x335D9A2C, 0x565C17F1, 0xADD1B89F, 0x9C5F0C4B, 0x67D2A325, 0x02D32EF8, 0xF95E8196,
+	0x2D32EF8D, 0xD6BF40E3, 0xB3BECD3E, 0x48336250, 0x79BDD684, 0x823079EA, 0xE731F437, 0x1CBC5B59,
+	0x842C9D9F, 0x7FA132F1, 0x1AA0BF2C, 0xE12D1042, 0xD0A3A496, 0x2B2E0BF8, 0x4E2F8625, 0xB5A2294B,
+	0x169977C6, 0xED14D8A8, 0x88155575, 0x7398FA1B, 0x42164ECF, 0xB99BE1A1, 0xDC9A6C7C, 0x2717C312,
+	0xBF8705D4, 0x440AAABA, 0x210B2767, 0xDA868809, 0xEB083CDD, 0x108593B3, 0x75841E6E, 0x8E09B100,
+	// Seed 0xFD
+	0x00000000, 0xE3EC3B65, 0x40416B89, 0xA3AD50EC, 0x8082D712, 0x636EEC77, 0xC0C3BC9B, 0x232F87FE,
+	0x869CB367, 0x65708802, 0xC6DDD8EE, 0x2531E38B, 0x061E6475, 0xE5F25F10, 0x465F0FFC, 0xA5B33499,
+	0x8AA07B8D, 0x694C40E8, 0xCAE11004, 0x290D2B61, 0x0A22AC9F, 0xE9CE97FA, 0x4A63C716, 0xA98FFC73,
+	0x0C3CC8EA, 0xEFD0F38F, 0x4C7DA363, 0xAF919806, 0x8CBE1FF8, 0x6F52249D, 0xCCFF7471, 0x2F134F14,
+	0x92D9EA59, 0x7135D13C, 0xD29881D0, 0x3174BAB5, 0x125B3D4B, 0xF1B7062E, 0x521A56C2, 0xB1F66DA7,
+	0x1445593E, 0xF7A9625B, 0x540432B7, 0xB7E809D2, 0x94C78E2C, 0x772BB549, 0xD486E5A5, 0x376ADEC0,
+	0x187991D4, 0xFB95AAB1, 0x5838FA5D, 0xBBD4C138, 0x98FB46C6, 0x7B177DA3, 0xD8BA2D4F, 0x3B56162A,
+	0x9EE522B3, 0x7D0919D6, 0xDEA4493A, 0x3D48725F, 0x1E67F5A1, 0xFD8BCEC4, 0x5E269E28, 0xBDCAA54D,
+	0xA22AC9F1, 0x41C6F294, 0xE26BA278, 0x0187991D, 0x22A81EE3, 0xC1442586, 0x62E9756A, 0x81054E0F,
+	0x24B67A96, 0xC75A41F3, 0x64F7111F, 0x871B2A7A, 0xA434AD84, 0x47D896E1, 0xE475C60D, 0x0799FD68,
+	0x288AB27C, 0xCB668919, 0x68CBD9F5, 0x8B27E290, 0xA808656E, 0x4BE45E0B, 0xE8490EE7, 0x0BA53582,
+	0xAE16011B, 0x4DFA3A7E, 0xEE576A92, 0x0DBB51F7, 0x2E94D609, 0xCD78ED6C, 0x6ED5BD80, 0x8D3986E5,
+	0x30F323A8, 0xD31F18CD, 0x70B24821, 0x935E7344, 0xB071F4BA, 0x539DCFDF, 0xF0309F33, 0x13DCA456,
+	0xB66F90CF, 0x5583ABAA, 0xF62EFB46, 0x15C2C023, 0x36ED47DD, 0xD5017CB8, 0x76AC2C54, 0x95401731,
+	0xBA535825, 0x59BF6340, 0xFA1233AC, 0x19FE08C9, 0x3AD18F37, 0xD93DB452, 0x7A90E4BE, 0x997CDFDB,
+	0x3CCFEB42, 0xDF23D027, 0x7C8E80CB, 0x9F62BBAE, 0xBC4D3C50, 0x5FA10735, 0xFC0C57D9, 0x1FE06CBC,
+	0xC3CC8EA1, 0x2020B5C4, 0x838DE528, 0x6061DE4D, 0x434E59B3, 0xA0A262D6, 0x030F323A, 0xE0E3095F,
+	0x45503DC6, 0xA6BC06A3, 0x0511564F, 0xE6FD6D2A, 0xC5D2EAD4, 0x263ED1B1, 0x8593815D, 0x667FBA38,
+	0x496CF52C, 0xAA80CE49, 0x092D9EA5, 0xEAC1A5C0, 0xC9EE223E, 0x2A02195B, 0x89AF49B7, 0x6A4372D2,
+	0xCFF0464B, 0x2C1C7D2E, 0x8FB12DC2, 0x6C5D16A7, 0x4F729159, 0xAC9EAA3C, 0x0F33FAD0, 0xECDFC1B5,
+	0x511564F8, 0xB2F95F9D, 0x11540F71, 0xF2B83414, 0xD197B3EA, 0x327B888F, 0x91D6D863, 0x723AE306,
+	0xD789D79F, 0x3465ECFA, 0x97C8BC16, 0x74248773, 0x570B008D, 0xB4E73BE8, 0x174A6B04, 0xF4A65061,
+	0xDBB51F75, 0x38592410, 0x9BF474FC, 0x78184F99, 0x5B37C867, 0xB8DBF302, 0x1B76A3EE, 0xF89A988B,
+	0x5D29AC12, 0xBEC59777, 0x1D68C79B, 0xFE84FCFE, 0xDDAB7B00, 0x3E474065, 0x9DEA1089, 0x7E062BEC,
+	0x61E64750, 0x820A7C35, 0x21A72CD9, 0xC24B17BC, 0xE1649042, 0x0288AB27, 0xA125FBCB, 0x42C9C0AE,
+	0xE77AF437, 0x0496CF52, 0xA73B9FBE, 0x44D7A4DB, 0x67F82325, 0x84141840, 0x27B948AC, 0xC45573C9,
+	0xEB463CDD, 0x08AA07B8, 0xAB075754, 0x48EB6C31, 0x6BC4EBCF, 0x8828D0AA, 0x2B858046, 0xC869BB23,
+	0x6DDA8FBA, 0x8E36B4DF, 0x2D9BE433, 0xCE77DF56, 0xED5858A8, 0x0EB463CD, 0xAD193321, 0x4EF50844,
+	0xF33FAD09, 0x10D3966C, 0xB37EC680, 0x5092FDE5, 0x73BD7A1B, 0x9051417E, 0x33FC1192, 0xD0102AF7,
+	0x75A31E6E, 0x964F250B, 0x35E275E7, 0xD60E4E82, 0xF521C97C, 0x16CDF219, 0xB560A2F5, 0x568C9990,
+	0x799FD684, 0x9A73EDE1, 0x39DEBD0D, 0xDA328668, 0xF91D0196, 0x1AF13AF3, 0xB95C6A1F, 0x5AB0517A,
+	0xFF0365E3, 0x1CEF5E86, 0xBF420E6A, 0x5CAE350F, 0x7F81B2F1, 0x9C6D8994, 0x3FC0D978, 0xDC2CE21D,
+	// Seed 0xFE
+	0x00000000, 0x12FF86F5, 0x25FF0DEA, 0x37008B1F, 0x4BFE1BD4, 0x59019D21, 0x6E01163E, 0x7CFE90CB,
+	0x23E7899F, 0x31180F6A, 0x06188475, 0x14E70280, 0x6819924B, 0x7AE614BE, 0x4DE69FA1, 0x5F191954,
+	0x47CF133E, 0x553095CB, 0x62301ED4, 0x70CF9821, 0x0C3108EA, 0x1ECE8E1F, 0x29CE0500, 0x3B3183F5,
+	0x64289AA1, 0x76D71C54, 0x41D7974B, 0x532811BE, 0x2FD68175, 0x3D290780, 0x0A298C9F, 0x18D60A6A,
+	0x3B85984B, 0x297A1EBE, 0x1E7A95A1, 0x0C851354, 0x707B839F, 0x6284056A, 0x55848E75, 0x477B0880,
+	0x186211D4, 0x0A9D9721, 0x3D9D1C3E, 0x2F629ACB, 0x539C0A00, 0x41638CF5, 0x766307EA, 0x649C811F,
+	0x7C4A8B75, 0x6EB50D80, 0x59B5869F, 0x4B4A006A, 0x37B490A1, 0x254B1654, 0x124B9D4B, 0x00B41BBE,
+	0x5FAD02EA, 0x4D52841F, 0x7A520F00, 0x68AD89F5, 0x1453193E, 0x06AC9FCB, 0x31AC14D4, 0x23539221,
+	0x770B3096, 0x65F4B663, 0x52F43D7C, 0x400BBB89, 0x3CF52B42, 0x2E0AADB7, 0x190A26A8, 0x0BF5A05D,
+	0x54ECB909, 0x46133FFC, 0x7113B4E3, 0x63EC3216, 0x1F12A2DD, 0x0DED2428, 0x3AEDAF37, 0x281229C2,
+	0x30C423A8, 0x223BA55D, 0x153B2E42, 0x07C4A8B7, 0x7B3A387C, 0x69C5BE89, 0x5EC53596, 0x4C3AB363,
+	0x1323AA37, 0x01DC2CC2, 0x36DCA7DD, 0x24232128, 0x58DDB1E3, 0x4A223716, 0x7D22BC09, 0x6FDD3AFC,
+	0x4C8EA8DD, 0x5E712E28, 0x6971A537, 0x7B8E23C2, 0x0770B309, 0x158F35FC, 0x228FBEE3, 0x30703816,
+	0x6F692142, 0x7D96A7B7, 0x4A962CA8, 0x5869AA5D, 0x24973A96, 0x3668BC63, 0x0168377C, 0x1397B189,
+	0x0B41BBE3, 0x19BE3D16, 0x2EBEB609, 0x3C4130FC, 0x40BFA037, 0x524026C2, 0x6540ADDD, 0x77BF2B28,
+	0x28A6327C, 0x3A59B489, 0x0D593F96, 0x1FA6B963, 0x635829A8, 0x71A7AF5D, 0x46A72442, 0x5458A2B7,
+	0x5A0DDF1B, 0x48F259EE, 0x7FF2D2F1, 0x6D0D5404, 0x11F3C4CF, 0x030C423A, 0x340CC925, 0x26F34FD0,
+	0x79EA5684, 0x6B15D071, 0x5C155B6E, 0x4EEADD9B, 0x32144D50, 0x20EBCBA5, 0x17EB40BA, 0x0514C64F,
+	0x1DC2CC25, 0x0F3D4AD0, 0x383DC1CF, 0x2AC2473A, 0x563CD7F1, 0x44C35104, 0x73C3DA1B, 0x613C5CEE,
+	0x3E2545BA, 0x2CDAC34F, 0x1BDA4850, 0x0925CEA5, 0x75DB5E6E, 0x6724D89B, 0x50245384, 0x42DBD571,
+	0x61884750, 0x7377C1A5, 0x44774ABA, 0x5688CC4F, 0x2A765C84, 0x3889DA71, 0x0F89516E, 0x1D76D79B,
+	0x426FCECF, 0x5090483A, 0x6790C325, 0x756F45D0, 0x0991D51B, 0x1B6E53EE, 0x2C6ED8F1, 0x3E915E04,
+	0x2647546E, 0x34B8D29B, 0x03B85984, 0x1147DF71, 0x6DB94FBA, 0x7F46C94F, 0x48464250, 0x5AB9C4A5,
+	0x05A0DDF1, 0x175F5B04, 0x205FD01B, 0x32A056EE, 0x4E5EC625, 0x5CA140D0, 0x6BA1CBCF, 0x795E4D3A,
+	0x2D06EF8D, 0x3FF96978, 0x08F9E267, 0x1A066492, 0x66F8F459, 0x740772AC, 0x4307F9B3, 0x51F87F46,
+	0x0EE16612, 0x1C1EE0E7, 0x2B1E6BF8, 0x39E1ED0D, 0x451F7DC6, 0x57E0FB33, 0x60E0702C, 0x721FF6D9,
+	0x6AC9FCB3, 0x78367A46, 0x4F36F159, 0x5DC977AC, 0x2137E767, 0x33C86192, 0x04C8EA8D, 0x16376C78,
+	0x492E752C, 0x5BD1F3D9, 0x6CD178C6, 0x7E2EFE33, 0x02D06EF8, 0x102FE80D, 0x272F6312, 0x35D0E5E7,
+	0x168377C6, 0x047CF133, 0x337C7A2C, 0x2183FCD9, 0x5D7D6C12, 0x4F82EAE7, 0x788261F8, 0x6A7DE70D,
+	0x3564FE59, 0x279B78AC, 0x109BF3B3, 0x02647546, 0x7E9AE58D, 0x6C656378, 0x5B65E867, 0x499A6E92,
+	0x514C64F8, 0x43B3E20D, 0x74B36912, 0x664CEFE7, 0x1AB27F2C, 0x084DF9D9, 0x3F4D72C6, 0x2DB2F433,
+	0x72ABED67, 0x60546B92, 0x5754E08D, 0x45AB6678, 0x3955F6B3, 0x2BAA7046, 0x1CAAFB59, 0x0E557DAC,
+	// Seed 0xFF
+	0x00000000, 0x3A05824A, 0x2E0EDF8F, 0x140B5DC5, 0x06186405, 0x3C1DE64F, 0x2816BB8A, 0x121339C0,
+	0x0C30C80A, 0x36354A40, 0x223E1785, 0x183B95CF, 0x0A28AC0F, 0x302D2E45, 0x24267380, 0x1E23F1CA,
+	0x18619014, 0x2264125E, 0x366F4F9B, 0x0C6ACDD1, 0x1E79F411, 0x247C765B, 0x30772B9E, 0x0A72A9D4,
+	0x1451581E, 0x2E54DA54, 0x3A5F8791, 0x005A05DB, 0x12493C1B, 0x284CBE51, 0x3C47E394, 0x064261DE,
+	0x30C32028, 0x0AC6A262, 0x1ECDFFA7, 0x24C87DED, 0x36DB442D, 0x0CDEC667, 0x18D59BA2, 0x22D019E8,
+	0x3CF3E822, 0x06F66A68, 0x12FD37AD, 0x28F8B5E7, 0x3AEB8C27, 0x00EE0E6D, 0x14E553A8, 0x2EE0D1E2,
+	0x28A2B03C, 0x12A73276, 0x06AC6FB3, 0x3CA9EDF9, 0x2EBAD439, 0x14BF5673, 0x00B40BB6, 0x3AB189FC,
+	0x24927836, 0x1E97FA7C, 0x0A9CA7B9, 0x309925F3, 0x228A1C33, 0x188F9E79, 0x0C84C3BC, 0x368141F6,
+	0x3B839B4B, 0x01861901, 0x158D44C4, 0x2F88C68E, 0x3D9BFF4E, 0x079E7D04, 0x139520C1, 0x2990A28B,
+	0x37B35341, 0x0DB6D10B, 0x19BD8CCE, 0x23B80E84, 0x31AB3744, 0x0BAEB50E, 0x1FA5E8CB, 0x25A06A81,
+	0x23E20B5F, 0x19E78915, 0x0DECD4D0, 0x37E9569A, 0x25FA6F5A, 0x1FFFED10, 0x0BF4B0D5, 0x31F1329F,
+	0x2FD2C355, 0x15D7411F, 0x01DC1CDA, 0x3BD99E90, 0x29CAA750, 0x13CF251A, 0x07C478DF, 0x3DC1FA95,
+	0x0B40BB63, 0x31453929, 0x254E64EC, 0x1F4BE6A6, 0x0D58DF66, 0x375D5D2C, 0x235600E9, 0x195382A3,
+	0x07707369, 0x3D75F123, 0x297EACE6, 0x137B2EAC, 0x0168176C, 0x3B6D9526, 0x2F66C8E3, 0x15634AA9,
+	0x13212B77, 0x2924A93D, 0x3D2FF4F8, 0x072A76B2, 0x15394F72, 0x2F3CCD38, 0x3B3790FD, 0x013212B7,
+	0x1F11E37D, 0x25146137, 0x311F3CF2, 0x0B1ABEB8, 0x19098778, 0x230C0532, 0x370758F7, 0x0D02DABD,
+	0x2D02ED8D, 0x17076FC7, 0x030C3202, 0x3909B048, 0x2B1A8988, 0x111F0BC2, 0x05145607, 0x3F11D44D,
+	0x21322587, 0x1B37A7CD, 0x0F3CFA08, 0x35397842, 0x272A4182, 0x1D2FC3C8, 0x09249E0D, 0x33211C47,
+	0x35637D99, 0x0F66FFD3, 0x1B6DA216, 0x2168205C, 0x337B199C, 0x097E9BD6, 0x1D75C613, 0x27704459,
+	0x3953B593, 0x035637D9, 0x175D6A1C, 0x2D58E856, 0x3F4BD196, 0x054E53DC, 0x11450E19, 0x2B408C53,
+	0x1DC1CDA5, 0x27C44FEF, 0x33CF122A, 0x09CA9060, 0x1BD9A9A0, 0x21DC2BEA, 0x35D7762F, 0x0FD2F465,
+	0x11F105AF, 0x2BF487E5, 0x3FFFDA20, 0x05FA586A, 0x17E961AA, 0x2DECE3E0, 0x39E7BE25, 0x03E23C6F,
+	0x05A05DB1, 0x3FA5DFFB, 0x2BAE823E, 0x11AB0074, 0x03B839B4, 0x39BDBBFE, 0x2DB6E63B, 0x17B36471,
+	0x099095BB, 0x339517F1, 0x279E4A34, 0x1D9BC87E, 0x0F88F1BE, 0x358D73F4, 0x21862E31, 0x1B83AC7B,
+	0x168176C6, 0x2C84F48C, 0x388FA949, 0x028A2B03, 0x109912C3, 0x2A9C9089, 0x3E97CD4C, 0x04924F06,
+	0x1AB1BECC, 0x20B43C86, 0x34BF6143, 0x0EBAE309, 0x1CA9DAC9, 0x26AC5883, 0x32A70546, 0x08A2870C,
+	0x0EE0E6D2, 0x34E56498, 0x20EE395D, 0x1AEBBB17, 0x08F882D7, 0x32FD009D, 0x26F65D58, 0x1CF3DF12,
+	0x02D02ED8, 0x38D5AC92, 0x2CDEF157, 0x16DB731D, 0x04C84ADD, 0x3ECDC897, 0x2AC69552, 0x10C31718,
+	0x264256EE, 0x1C47D4A4, 0x084C8961, 0x32490B2B, 0x205A32EB, 0x1A5FB0A1, 0x0E54ED64, 0x34516F2E,
+	0x2A729EE4, 0x10771CAE, 0x047C416B, 0x3E79C321, 0x2C6AFAE1, 0x166F78AB, 0x0264256E, 0x3861A724,
+	0x3E23C6FA, 0x042644B0, 0x102D1975, 0x2A289B3F, 0x383BA2FF, 0x023E20B5, 0x16357D70, 0x2C30FF3A,
+	0x32130EF0, 0x08168CBA, 0x1C1DD17F, 0x26185335, 0x340B6AF5, 0x0E0EE8BF, 0x1A05B57A, 0x20003730,
+};
+
+//-----------------------------------------------------------------------------
@@ -0,0 +1,23 @@
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+#ifndef SECURITY_TABLE_H_
+#define SECURITY_TABLE_H_
+
+//-----------------------------------------------------------------------------
+
+#include <stdint.h>
+
+//-----------------------------------------------------------------------------
+
+// Table the client uses to generate the crc security byte. There is one row of
+// 256 entries per crc seed. Each entry is the entry's index run through 8 bits
+// of a crc using that seed's value from the client's base security table as
+// the polynomial. The table is stored as constant data rather than generated
+// at startup, so it lives in read only pages that every process can share.
+extern const uint32_t SecurityTable[ 0x10000 ];
+
+//-----------------------------------------------------------------------------
+
+#endif
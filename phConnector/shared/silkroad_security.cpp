@@ -1,14 +1,63 @@
 #include "silkroad_security.h"
 #include "blowfish.h"
-#include <boost/random.hpp>
+#include "ring_queue.h"
+#include "security_table.h"
+#include "opcode_table.h"
+#include "buffer_pool.h"
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/random_device.hpp>
+#include <boost/random/seed_seq.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/tss.hpp>
+#include <boost/make_shared.hpp>
 #include <exception>
-#include <list>
+#include <cstring>
 #include <vector>
-#include <set>
 
 //-----------------------------------------------------------------------------
 
-std::vector< uint8_t > FormatPacket( SilkroadSecurity * silkroad_security, uint16_t opcode, StreamUtility & data, uint8_t encrypted );
+void FormatPacket( SilkroadSecurity * silkroad_security, uint16_t opcode, const uint8_t * prefix, int32_t prefix_count, const uint8_t * data, int32_t count, uint8_t encrypted, std::vector< uint8_t > & output );
+
+//-----------------------------------------------------------------------------
+
+// Queue slots keep their buffers for the next packet unless they grew past this
+#define MAX_POOLED_BUFFER 0x10000
+
+// Most data a single 0x600D part carries and the most space reserved up front
+// for reassembling a massive packet. The part count comes from the peer, so
+// only this much is reserved before any data arrives; larger packets grow as
+// their parts are copied in.
+#define MASSIVE_PART_SIZE 4089
+#define MAX_MASSIVE_RESERVE 0x10000
+
+// Releases a slot's buffer if it is too large to keep around
+void TrimBuffer( StreamUtility & stream )
+{
+	if( stream.GetStreamVector().capacity() > MAX_POOLED_BUFFER )
+	{
+		StreamUtility empty;
+		empty.Swap( stream );
+	}
+}
+
+// Smallest buffer a slot grows to
+#define MIN_POOLED_BUFFER 0x100
+
+// Makes room for count bytes in an empty slot. Buffers move between slots as
+// packets are queued and sent, growing them in powers of two lets every one
+// of them settle on a size after a few packets instead of growing again each
+// time a slightly larger packet comes along.
+void ReserveBuffer( StreamUtility & stream, int32_t count )
+{
+	size_t capacity = MIN_POOLED_BUFFER;
+	while( capacity < static_cast< size_t >( count ) )
+	{
+		capacity <<= 1;
+	}
+	stream.Reserve( static_cast< int32_t >( capacity ) );
+}
 
 //-----------------------------------------------------------------------------
 
@@ -22,118 +71,84 @@ std::vector< uint8_t > FormatPacket( SilkroadSecurity * silkroad_security, uint1
 
 //-----------------------------------------------------------------------------
 
-// Base security values the client uses to build the security table from.
-static uint8_t BaseSecurityTable[] = 
-{
-	0xB1, 0xD6, 0x8B, 0x96, 0x96, 0x30, 0x07, 0x77, 0x2C, 0x61, 0x0E, 0xEE, 0xBA, 0x51, 0x09, 0x99, 
-	0x19, 0xC4, 0x6D, 0x07, 0x8F, 0xF4, 0x6A, 0x70, 0x35, 0xA5, 0x63, 0xE9, 0xA3, 0x95, 0x64, 0x9E,
-	0x32, 0x88, 0xDB, 0x0E, 0xA4, 0xB8, 0xDC, 0x79, 0x1E, 0xE9, 0xD5, 0xE0, 0x88, 0xD9, 0xD2, 0x97, 
-	0x2B, 0x4C, 0xB6, 0x09, 0xBD, 0x7C, 0xB1, 0x7E, 0x07, 0x2D, 0xB8, 0xE7, 0x91, 0x1D, 0xBF, 0x90,
-	0x64, 0x10, 0xB7, 0x1D, 0xF2, 0x20, 0xB0, 0x6A, 0x48, 0x71, 0xB1, 0xF3, 0xDE, 0x41, 0xBE, 0x8C, 
-	0x7D, 0xD4, 0xDA, 0x1A, 0xEB, 0xE4, 0xDD, 0x6D, 0x51, 0xB5, 0xD4, 0xF4, 0xC7, 0x85, 0xD3, 0x83,
-	0x56, 0x98, 0x6C, 0x13, 0xC0, 0xA8, 0x6B, 0x64, 0x7A, 0xF9, 0x62, 0xFD, 0xEC, 0xC9, 0x65, 0x8A, 
-	0x4F, 0x5C, 0x01, 0x14, 0xD9, 0x6C, 0x06, 0x63, 0x63, 0x3D, 0x0F, 0xFA, 0xF5, 0x0D, 0x08, 0x8D,
-	0xC8, 0x20, 0x6E, 0x3B, 0x5E, 0x10, 0x69, 0x4C, 0xE4, 0x41, 0x60, 0xD5, 0x72, 0x71, 0x67, 0xA2, 
-	0xD1, 0xE4, 0x03, 0x3C, 0x47, 0xD4, 0x04, 0x4B, 0xFD, 0x85, 0x0D, 0xD2, 0x6B, 0xB5, 0x0A, 0xA5,
-	0xFA, 0xA8, 0xB5, 0x35, 0x6C, 0x98, 0xB2, 0x42, 0xD6, 0xC9, 0xBB, 0xDB, 0x40, 0xF9, 0xBC, 0xAC, 
-	0xE3, 0x6C, 0xD8, 0x32, 0x75, 0x5C, 0xDF, 0x45, 0xCF, 0x0D, 0xD6, 0xDC, 0x59, 0x3D, 0xD1, 0xAB,
-	0xAC, 0x30, 0xD9, 0x26, 0x3A, 0x00, 0xDE, 0x51, 0x80, 0x51, 0xD7, 0xC8, 0x16, 0x61, 0xD0, 0xBF, 
-	0xB5, 0xF4, 0xB4, 0x21, 0x23, 0xC4, 0xB3, 0x56, 0x99, 0x95, 0xBA, 0xCF, 0x0F, 0xA5, 0xB7, 0xB8,
-	0x9E, 0xB8, 0x02, 0x28, 0x08, 0x88, 0x05, 0x5F, 0xB2, 0xD9, 0xEC, 0xC6, 0x24, 0xE9, 0x0B, 0xB1, 
-	0x87, 0x7C, 0x6F, 0x2F, 0x11, 0x4C, 0x68, 0x58, 0xAB, 0x1D, 0x61, 0xC1, 0x3D, 0x2D, 0x66, 0xB6,
-	0x90, 0x41, 0xDC, 0x76, 0x06, 0x71, 0xDB, 0x01, 0xBC, 0x20, 0xD2, 0x98, 0x2A, 0x10, 0xD5, 0xEF, 
-	0x89, 0x85, 0xB1, 0x71, 0x1F, 0xB5, 0xB6, 0x06, 0xA5, 0xE4, 0xBF, 0x9F, 0x33, 0xD4, 0xB8, 0xE8,
-	0xA2, 0xC9, 0x07, 0x78, 0x34, 0xF9, 0xA0, 0x0F, 0x8E, 0xA8, 0x09, 0x96, 0x18, 0x98, 0x0E, 0xE1, 
-	0xBB, 0x0D, 0x6A, 0x7F, 0x2D, 0x3D, 0x6D, 0x08, 0x97, 0x6C, 0x64, 0x91, 0x01, 0x5C, 0x63, 0xE6,
-	0xF4, 0x51, 0x6B, 0x6B, 0x62, 0x61, 0x6C, 0x1C, 0xD8, 0x30, 0x65, 0x85, 0x4E, 0x00, 0x62, 0xF2, 
-	0xED, 0x95, 0x06, 0x6C, 0x7B, 0xA5, 0x01, 0x1B, 0xC1, 0xF4, 0x08, 0x82, 0x57, 0xC4, 0x0F, 0xF5,
-	0xC6, 0xD9, 0xB0, 0x63, 0x50, 0xE9, 0xB7, 0x12, 0xEA, 0xB8, 0xBE, 0x8B, 0x7C, 0x88, 0xB9, 0xFC, 
-	0xDF, 0x1D, 0xDD, 0x62, 0x49, 0x2D, 0xDA, 0x15, 0xF3, 0x7C, 0xD3, 0x8C, 0x65, 0x4C, 0xD4, 0xFB,
-	0x58, 0x61, 0xB2, 0x4D, 0xCE, 0x51, 0xB5, 0x3A, 0x74, 0x00, 0xBC, 0xA3, 0xE2, 0x30, 0xBB, 0xD4, 
-	0x41, 0xA5, 0xDF, 0x4A, 0xD7, 0x95, 0xD8, 0x3D, 0x6D, 0xC4, 0xD1, 0xA4, 0xFB, 0xF4, 0xD6, 0xD3,
-	0x6A, 0xE9, 0x69, 0x43, 0xFC, 0xD9, 0x6E, 0x34, 0x46, 0x88, 0x67, 0xAD, 0xD0, 0xB8, 0x60, 0xDA, 
-	0x73, 0x2D, 0x04, 0x44, 0xE5, 0x1D, 0x03, 0x33, 0x5F, 0x4C, 0x0A, 0xAA, 0xC9, 0x7C, 0x0D, 0xDD,
-	0x3C, 0x71, 0x05, 0x50, 0xAA, 0x41, 0x02, 0x27, 0x10, 0x10, 0x0B, 0xBE, 0x86, 0x20, 0x0C, 0xC9, 
-	0x25, 0xB5, 0x68, 0x57, 0xB3, 0x85, 0x6F, 0x20, 0x09, 0xD4, 0x66, 0xB9, 0x9F, 0xE4, 0x61, 0xCE,
-	0x0E, 0xF9, 0xDE, 0x5E, 0x08, 0xC9, 0xD9, 0x29, 0x22, 0x98, 0xD0, 0xB0, 0xB4, 0xA8, 0x57, 0xC7, 
-	0x17, 0x3D, 0xB3, 0x59, 0x81, 0x0D, 0xB4, 0x3E, 0x3B, 0x5C, 0xBD, 0xB7, 0xAD, 0x6C, 0xBA, 0xC0,
-	0x20, 0x83, 0xB8, 0xED, 0xB6, 0xB3, 0xBF, 0x9A, 0x0C, 0xE2, 0xB6, 0x03, 0x9A, 0xD2, 0xB1, 0x74, 
-	0x39, 0x47, 0xD5, 0xEA, 0xAF, 0x77, 0xD2, 0x9D, 0x15, 0x26, 0xDB, 0x04, 0x83, 0x16, 0xDC, 0x73,
-	0x12, 0x0B, 0x63, 0xE3, 0x84, 0x3B, 0x64, 0x94, 0x3E, 0x6A, 0x6D, 0x0D, 0xA8, 0x5A, 0x6A, 0x7A, 
-	0x0B, 0xCF, 0x0E, 0xE4, 0x9D, 0xFF, 0x09, 0x93, 0x27, 0xAE, 0x00, 0x0A, 0xB1, 0x9E, 0x07, 0x7D,
-	0x44, 0x93, 0x0F, 0xF0, 0xD2, 0xA2, 0x08, 0x87, 0x68, 0xF2, 0x01, 0x1E, 0xFE, 0xC2, 0x06, 0x69, 
-	0x5D, 0x57, 0x62, 0xF7, 0xCB, 0x67, 0x65, 0x80, 0x71, 0x36, 0x6C, 0x19, 0xE7, 0x06, 0x6B, 0x6E,
-	0x76, 0x1B, 0xD4, 0xFE, 0xE0, 0x2B, 0xD3, 0x89, 0x5A, 0x7A, 0xDA, 0x10, 0xCC, 0x4A, 0xDD, 0x67, 
-	0x6F, 0xDF, 0xB9, 0xF9, 0xF9, 0xEF, 0xBE, 0x8E, 0x43, 0xBE, 0xB7, 0x17, 0xD5, 0x8E, 0xB0, 0x60,
-	0xE8, 0xA3, 0xD6, 0xD6, 0x7E, 0x93, 0xD1, 0xA1, 0xC4, 0xC2, 0xD8, 0x38, 0x52, 0xF2, 0xDF, 0x4F, 
-	0xF1, 0x67, 0xBB, 0xD1, 0x67, 0x57, 0xBC, 0xA6, 0xDD, 0x06, 0xB5, 0x3F, 0x4B, 0x36, 0xB2, 0x48,
-	0xDA, 0x2B, 0x0D, 0xD8, 0x4C, 0x1B, 0x0A, 0xAF, 0xF6, 0x4A, 0x03, 0x36, 0x60, 0x7A, 0x04, 0x41, 
-	0xC3, 0xEF, 0x60, 0xDF, 0x55, 0xDF, 0x67, 0xA8, 0xEF, 0x8E, 0x6E, 0x31, 0x79, 0x0E, 0x69, 0x46,
-	0x8C, 0xB3, 0x51, 0xCB, 0x1A, 0x83, 0x63, 0xBC, 0xA0, 0xD2, 0x6F, 0x25, 0x36, 0xE2, 0x68, 0x52, 
-	0x95, 0x77, 0x0C, 0xCC, 0x03, 0x47, 0x0B, 0xBB, 0xB9, 0x14, 0x02, 0x22, 0x2F, 0x26, 0x05, 0x55,
-	0xBE, 0x3B, 0xB6, 0xC5, 0x28, 0x0B, 0xBD, 0xB2, 0x92, 0x5A, 0xB4, 0x2B, 0x04, 0x6A, 0xB3, 0x5C, 
-	0xA7, 0xFF, 0xD7, 0xC2, 0x31, 0xCF, 0xD0, 0xB5, 0x8B, 0x9E, 0xD9, 0x2C, 0x1D, 0xAE, 0xDE, 0x5B,
-	0xB0, 0x72, 0x64, 0x9B, 0x26, 0xF2, 0xE3, 0xEC, 0x9C, 0xA3, 0x6A, 0x75, 0x0A, 0x93, 0x6D, 0x02, 
-	0xA9, 0x06, 0x09, 0x9C, 0x3F, 0x36, 0x0E, 0xEB, 0x85, 0x68, 0x07, 0x72, 0x13, 0x07, 0x00, 0x05,
-	0x82, 0x48, 0xBF, 0x95, 0x14, 0x7A, 0xB8, 0xE2, 0xAE, 0x2B, 0xB1, 0x7B, 0x38, 0x1B, 0xB6, 0x0C, 
-	0x9B, 0x8E, 0xD2, 0x92, 0x0D, 0xBE, 0xD5, 0xE5, 0xB7, 0xEF, 0xDC, 0x7C, 0x21, 0xDF, 0xDB, 0x0B,
-	0x94, 0xD2, 0xD3, 0x86, 0x42, 0xE2, 0xD4, 0xF1, 0xF8, 0xB3, 0xDD, 0x68, 0x6E, 0x83, 0xDA, 0x1F, 
-	0xCD, 0x16, 0xBE, 0x81, 0x5B, 0x26, 0xB9, 0xF6, 0xE1, 0x77, 0xB0, 0x6F, 0x77, 0x47, 0xB7, 0x18,
-	0xE0, 0x5A, 0x08, 0x88, 0x70, 0x6A, 0x0F, 0xF1, 0xCA, 0x3B, 0x06, 0x66, 0x5C, 0x0B, 0x01, 0x11, 
-	0xFF, 0x9E, 0x65, 0x8F, 0x69, 0xAE, 0x62, 0xF8, 0xD3, 0xFF, 0x6B, 0x61, 0x45, 0xCF, 0x6C, 0x16,
-	0x78, 0xE2, 0x0A, 0xA0, 0xEE, 0xD2, 0x0D, 0xD7, 0x54, 0x83, 0x04, 0x4E, 0xC2, 0xB3, 0x03, 0x39, 
-	0x61, 0x26, 0x67, 0xA7, 0xF7, 0x16, 0x60, 0xD0, 0x4D, 0x47, 0x69, 0x49, 0xDB, 0x77, 0x6E, 0x3E,
-	0x4A, 0x6A, 0xD1, 0xAE, 0xDC, 0x5A, 0xD6, 0xD9, 0x66, 0x0B, 0xDF, 0x40, 0xF0, 0x3B, 0xD8, 0x37, 
-	0x53, 0xAE, 0xBC, 0xA9, 0xC5, 0x9E, 0xBB, 0xDE, 0x7F, 0xCF, 0xB2, 0x47, 0xE9, 0xFF, 0xB5, 0x30,
-	0x1C, 0xF9, 0xBD, 0xBD, 0x8A, 0xCD, 0xBA, 0xCA, 0x30, 0x9E, 0xB3, 0x53, 0xA6, 0xA3, 0xBC, 0x24, 
-	0x05, 0x3B, 0xD0, 0xBA, 0xA3, 0x06, 0xD7, 0xCD, 0xE9, 0x57, 0xDE, 0x54, 0xBF, 0x67, 0xD9, 0x23,
-	0x2E, 0x72, 0x66, 0xB3, 0xB8, 0x4A, 0x61, 0xC4, 0x02, 0x1B, 0x38, 0x5D, 0x94, 0x2B, 0x6F, 0x2B, 
-	0x37, 0xBE, 0xCB, 0xB4, 0xA1, 0x8E, 0xCC, 0xC3, 0x1B, 0xDF, 0x0D, 0x5A, 0x8D, 0xED, 0x02, 0x2D,
-};
+// Slicing-by-8 tables for a crc seed. Table 0 is the seed's row of the
+// security table and every following table advances one more byte. These are
+// built on demand instead of stored with the security table since a process
+// only ever sees a few seeds and all 256 of them would take 2MB.
+#define CRC_SLICES 8
+static uint32_t * CrcTables[ 256 ] = { 0 };
+static boost::mutex CrcTablesMutex;
 
-//-----------------------------------------------------------------------------
-
-uint32_t SecurityTable[ 0x10000 ] = { 0 };
-bool GenerateSecurityTable()
+// Returns the tables for a seed, building them the first time it is used
+const uint32_t * GetCrcTables( uint32_t seed )
 {
-	uint32_t * outPtr = SecurityTable;
-	for( uint32_t EDI = 0; EDI < 1024; EDI += 4 )
+	seed &= 0xFF;
+	boost::mutex::scoped_lock lock( CrcTablesMutex );
+	if( !CrcTables[ seed ] )
 	{
-		uint32_t EDX = *(uint32_t *)(BaseSecurityTable + EDI);
-		for( int ECX = 0; ECX < 256; ++ECX )
+		uint32_t * tables = new uint32_t[ CRC_SLICES * 256 ];
+		memcpy( tables, SecurityTable + ( seed << 8 ), 256 * sizeof( uint32_t ) );
+		for( int32_t slice = 1; slice < CRC_SLICES; ++slice )
 		{
-			uint32_t EAX = ECX >> 1;
-			if( ECX & 1 )
+			for( int32_t x = 0; x < 256; ++x )
 			{
-				EAX ^= EDX;
-			}
-			for( int bit = 0; bit < 7; ++bit )
-			{
-				if( EAX & 1 )
-				{
-					EAX >>= 1;
-					EAX ^= EDX;
-				}
-				else
-				{
-					EAX >>= 1;
-				}
+				uint32_t prev = tables[ ( slice - 1 ) * 256 + x ];
+				tables[ slice * 256 + x ] = ( prev >> 8 ) ^ tables[ prev & 0xFF ];
 			}
-			*outPtr++ = EAX;
 		}
+		CrcTables[ seed ] = tables;
 	}
-	return true;
+	return CrcTables[ seed ];
+}
+
+// Every connection starts with seed 0. Its tables are built before main (a
+// function local static is not thread safe on older compilers), so creating
+// a connection does not take the lock.
+static const uint32_t * const DefaultCrcTables = GetCrcTables( 0 );
+
+// Runs the seeded crc over a buffer, eight bytes per step
+uint32_t UpdateChecksum( const uint32_t * tables, uint32_t checksum, const uint8_t * data, int32_t length )
+{
+	while( length >= 8 )
+	{
+		uint32_t one = ( data[ 0 ] | ( data[ 1 ] << 8 ) | ( data[ 2 ] << 16 ) | ( static_cast< uint32_t >( data[ 3 ] ) << 24 ) ) ^ checksum;
+		uint32_t two = data[ 4 ] | ( data[ 5 ] << 8 ) | ( data[ 6 ] << 16 ) | ( static_cast< uint32_t >( data[ 7 ] ) << 24 );
+		checksum = tables[ 7 * 256 + ( one & 0xFF ) ] ^ tables[ 6 * 256 + ( ( one >> 8 ) & 0xFF ) ] ^
+			tables[ 5 * 256 + ( ( one >> 16 ) & 0xFF ) ] ^ tables[ 4 * 256 + ( one >> 24 ) ] ^
+			tables[ 3 * 256 + ( two & 0xFF ) ] ^ tables[ 2 * 256 + ( ( two >> 8 ) & 0xFF ) ] ^
+			tables[ 1 * 256 + ( ( two >> 16 ) & 0xFF ) ] ^ tables[ two >> 24 ];
+		data += 8;
+		length -= 8;
+	}
+	while( length-- )
+	{
+		checksum = ( checksum >> 8 ) ^ tables[ ( *data++ ^ checksum ) & 0xFF ];
+	}
+	return checksum;
 }
-static bool init_security_table = GenerateSecurityTable();
 
 //-----------------------------------------------------------------------------
 
+// Every thread gets its own generator, seeded from the system's entropy
+// source the first time that thread needs a random number
+static boost::thread_specific_ptr< boost::random::mt19937_64 > ThreadRng;
+
 uint64_t rng()
 {
-	static boost::mt19937 randgen;
-	static boost::uniform_int< uint64_t > range( 0, 0xFFFFFFFFFFFFFFFF );
-	boost::variate_generator< boost::mt19937 &, boost::uniform_int< uint64_t > > die( randgen, range );
-	return die();
+	boost::random::mt19937_64 * generator = ThreadRng.get();
+	if( !generator )
+	{
+		boost::random::random_device device;
+		uint32_t entropy[ 8 ];
+		for( int x = 0; x < 8; ++x )
+		{
+			entropy[ x ] = device();
+		}
+		boost::random::seed_seq seed( entropy, entropy + 8 );
+		generator = new boost::random::mt19937_64( seed );
+		ThreadRng.reset( generator );
+	}
+	return ( *generator )();
 }
 
 //-----------------------------------------------------------------------------
@@ -154,15 +169,195 @@ struct TFlags
 
 //-----------------------------------------------------------------------------
 
+// A framed packet waiting to be processed. The payload either lives in the
+// receive buffer at the given offset or, for massive packets, in the front
+// of the massive packet list.
+struct IncomingPacket
+{
+	uint16_t opcode;
+	uint8_t encrypted;
+	uint8_t massive;
+	size_t offset;
+	int32_t size;
+};
+
+//-----------------------------------------------------------------------------
+
+// Helper function used in the handshake, X may be a or b, this clean version of the function is from jMerlin (Func_X_4)
+uint32_t G_pow_X_mod_P( uint32_t P, uint32_t X, uint32_t G )
+{
+	uint64_t result = 1;
+	uint64_t mult = G;
+	if( X == 0 ) return 1;
+	while( X )
+	{
+		if( X & 1 ) result = ( mult * result ) % P;
+		X = X >> 1;
+		mult = ( mult * mult ) % P;
+	}
+	return static_cast< uint32_t >( result );
+}
+
+//-----------------------------------------------------------------------------
+
+// Server side handshake values, none of which depend on the client
+struct HandshakeParameters
+{
+	uint64_t initial_blowfish_key;
+	Blowfish initial_blowfish;
+	uint32_t seed_count;
+	uint32_t crc_seed;
+	uint64_t handshake_blowfish_key;
+	uint32_t value_x;
+	uint32_t value_g;
+	uint32_t value_p;
+	uint32_t value_A;
+};
+
+// Generates the values a handshake in this mode needs
+void GenerateHandshakeParameters( HandshakeParameters & params, uint8_t mode )
+{
+	TFlags * flags = reinterpret_cast< TFlags * >( &mode );
+	if( flags->blowfish )
+	{
+		params.initial_blowfish_key = rng();
+		params.initial_blowfish.Initialize( &params.initial_blowfish_key, sizeof( params.initial_blowfish_key ) );
+	}
+	if( flags->security_bytes )
+	{
+		params.seed_count = static_cast< uint32_t >( rng() % 0xFF );
+		params.crc_seed = static_cast< uint32_t >( rng() % 0xFF );
+	}
+	if( flags->handshake )
+	{
+		params.handshake_blowfish_key = rng();
+		params.value_x = static_cast< uint32_t >( rng() & 0x7FFFFFFF );
+		params.value_g = static_cast< uint32_t >( rng() & 0x7FFFFFFF );
+		params.value_p = static_cast< uint32_t >( rng() & 0x7FFFFFFF );
+		params.value_A = G_pow_X_mod_P( params.value_p, params.value_x, params.value_g );
+	}
+}
+
+// Keeps a number of full handshakes worth of values ready on its own thread
+class HandshakePool
+{
+private:
+	boost::mutex m_mutex;
+	boost::condition_variable m_wake;
+	RingQueue< HandshakeParameters > m_ready;
+	size_t m_count;
+	bool m_running;
+	boost::thread m_thread;
+
+private:
+	HandshakePool( const HandshakePool & rhs );
+	HandshakePool & operator =( const HandshakePool & rhs );
+
+	void Run()
+	{
+		uint8_t mode = 0;
+		TFlags * flags = reinterpret_cast< TFlags * >( &mode );
+		flags->blowfish = 1;
+		flags->security_bytes = 1;
+		flags->handshake = 1;
+
+		HandshakeParameters params;
+		while( true )
+		{
+			{
+				boost::mutex::scoped_lock lock( m_mutex );
+				while( m_running && m_ready.size() >= m_count )
+				{
+					m_wake.wait( lock );
+				}
+				if( !m_running )
+				{
+					return;
+				}
+			}
+
+			GenerateHandshakeParameters( params, mode );
+
+			boost::mutex::scoped_lock lock( m_mutex );
+			m_ready.push_back() = params;
+		}
+	}
+
+public:
+	explicit HandshakePool( size_t count )
+		: m_ready( 16 ), m_count( count ), m_running( true )
+	{
+		m_thread = boost::thread( &HandshakePool::Run, this );
+	}
+
+	~HandshakePool()
+	{
+		{
+			boost::mutex::scoped_lock lock( m_mutex );
+			m_running = false;
+		}
+		m_wake.notify_one();
+		m_thread.join();
+	}
+
+	// Takes a ready set of values, returns false if there are none
+	bool Take( HandshakeParameters & params )
+	{
+		boost::mutex::scoped_lock lock( m_mutex );
+		if( m_ready.empty() )
+		{
+			return false;
+		}
+		params = m_ready.front();
+		m_ready.pop_front();
+		m_wake.notify_one();
+		return true;
+	}
+};
+
+static HandshakePool * Pool = 0;
+
+//-----------------------------------------------------------------------------
+
+// The GatewayServer opcodes that have to be sent encrypted in every mode
+boost::shared_ptr< const OpcodeTable > CreateDefaultOpcodes()
+{
+	boost::shared_ptr< OpcodeTable > opcodes = boost::make_shared< OpcodeTable >();
+	opcodes->Set( 0x2001, Opcode_Encrypted );
+	opcodes->Set( 0x6100, Opcode_Encrypted );
+	opcodes->Set( 0x6101, Opcode_Encrypted );
+	opcodes->Set( 0x6102, Opcode_Encrypted );
+	opcodes->Set( 0x6103, Opcode_Encrypted );
+	return opcodes;
+}
+
+// Shared by every security object until AddEncryptedOpcode gives it its own
+static const boost::shared_ptr< const OpcodeTable > DefaultOpcodes = CreateDefaultOpcodes();
+
+//-----------------------------------------------------------------------------
+
+// The packet paths are compiled once for every combination of security flags.
+// The flags are fixed by the time a packet is formatted or framed, so each
+// object points at the combination that matches its own.
+struct SilkroadSecurityData;
+typedef void ( * FormatPacketFunction )( SilkroadSecurityData * security, uint16_t opcode, const uint8_t * prefix, int32_t prefix_count, const uint8_t * data, int32_t count, uint8_t encrypted, std::vector< uint8_t > & output );
+typedef bool ( * RecvPacketsFunction )( SilkroadSecurityData * security );
+
+//-----------------------------------------------------------------------------
+
 struct SilkroadSecurityData
 {
-	StreamUtility m_pending_stream;
+	std::vector< uint8_t > m_recv_buffer;
+	size_t m_recv_begin;
+	size_t m_recv_end;
 	uint16_t m_massive_count;
 	uint16_t m_massive_opcode;
 	bool m_massive_header;
-	StreamUtility m_massive_packet;
-	std::list< PacketContainer > m_incoming_packets;
-	std::list< PacketContainer > m_outgoing_packets;
+	bool m_massive_passthrough;
+	RingQueue< StreamUtility > m_massive_packets;
+	RingQueue< IncomingPacket > m_incoming_packets;
+	RingQueue< PacketContainer > m_outgoing_packets;
+	PacketContainer m_send_packet;
 	uint32_t m_value_x;
 	uint32_t m_value_g;
 	uint32_t m_value_p;
@@ -171,6 +366,7 @@ struct SilkroadSecurityData
 	uint32_t m_value_K;
 	uint32_t m_seed_count;
 	uint32_t m_crc_seed;
+	const uint32_t * m_crc_tables;
 	uint64_t m_initial_blowfish_key;
 	uint64_t m_handshake_blowfish_key;
 	uint8_t m_count_byte_seeds[3];
@@ -184,7 +380,9 @@ struct SilkroadSecurityData
 	uint8_t m_identity_flag;
 	bool m_accepted_handshake;
 	bool m_started_handshake;
-	std::set< uint16_t > m_enc_opcodes;
+	boost::shared_ptr< const OpcodeTable > m_opcodes;
+	FormatPacketFunction m_format_packet;
+	RecvPacketsFunction m_recv_packets;
 
 private:
 	SilkroadSecurityData( const SilkroadSecurityData & rhs );
@@ -192,7 +390,7 @@ private:
 
 public:
 	SilkroadSecurityData()
-		: m_massive_count( 0 ), m_massive_opcode( 0 ), m_massive_header( false ), m_accepted_handshake( false ), m_started_handshake( false )
+		: m_recv_begin( 0 ), m_recv_end( 0 ), m_massive_count( 0 ), m_massive_opcode( 0 ), m_massive_header( false ), m_massive_passthrough( false ), m_accepted_handshake( false ), m_started_handshake( false )
 	{
 		m_identity_name = "SR_Client";
 		m_identity_flag = 0;
@@ -206,6 +404,7 @@ public:
 		m_count_byte_seeds[1] = 0;
 		m_count_byte_seeds[2] = 0;
 		m_crc_seed = 0;
+		m_crc_tables = DefaultCrcTables;
 		m_seed_count = 0;
 		m_handshake_blowfish_key = 0;
 		m_initial_blowfish_key = 0;
@@ -214,11 +413,8 @@ public:
 		m_client_security = false;
 		m_security_flag = 0;
 		m_security_flags = reinterpret_cast< TFlags *>( &m_security_flag );
-		m_enc_opcodes.insert( 0x2001 );
-		m_enc_opcodes.insert( 0x6100 );
-		m_enc_opcodes.insert( 0x6101 );
-		m_enc_opcodes.insert( 0x6102 );
-		m_enc_opcodes.insert( 0x6103 );
+		SelectPacketFunctions();
+		m_opcodes = DefaultOpcodes;
 	}
 
 	~SilkroadSecurityData()
@@ -226,6 +422,9 @@ public:
 	}
 
 public:
+	// Points the packet paths at the ones compiled for the current flags
+	void SelectPacketFunctions();
+
 	// This function's logic was written by jMerlin as part of the article "How to generate the security bytes for SRO"
 	uint32_t GenerateValue( uint32_t * ptr )
 	{
@@ -256,21 +455,6 @@ public:
 		m_count_byte_seeds[ 2 ] = byte1;
 	}
 
-	// Helper function used in the handshake, X may be a or b, this clean version of the function is from jMerlin (Func_X_4)
-	uint32_t G_pow_X_mod_P( uint32_t P, uint32_t X, uint32_t G )
-	{
-		uint64_t result = 1;
-		uint64_t mult = G;
-		if( X == 0 ) return 1;
-		while( X )
-		{
-			if( X & 1 ) result = ( mult * result ) % P;
-			X = X >> 1;
-			mult = ( mult * mult ) % P;
-		}
-		return static_cast< uint32_t >( result );
-	}
-
 	// Helper function used in the handshake (Func_X_2)
 	void KeyTransformValue( uint64_t & val, uint32_t key, uint8_t key_byte )
 	{
@@ -300,50 +484,75 @@ public:
 	uint8_t GenerateCheckByte( StreamUtility & stream )
 	{
 		const std::vector< uint8_t > & packet = stream.GetStreamVector();
-		uint32_t checksum = 0xFFFFFFFF;
-		uint32_t moddedseed = m_crc_seed << 8;
-		int32_t length = static_cast< int32_t >( packet.size() );
-		for( int32_t x = 0; x < length; ++x )
-		{
-			checksum = ( checksum >> 8 ) ^ SecurityTable[ moddedseed + ( ( packet[ x ] ^ checksum ) & 0xFF ) ];
-		}
+		return GenerateCheckByte( packet.empty() ? 0 : &packet[ 0 ], static_cast< int32_t >( packet.size() ) );
+	}
+
+	uint8_t GenerateCheckByte( const uint8_t * packet, int32_t length )
+	{
+		uint32_t checksum = UpdateChecksum( m_crc_tables, 0xFFFFFFFF, packet, length );
+		return ( uint8_t )( ( ( checksum >> 24 ) & 0xFF ) + ( ( checksum >> 8 ) & 0xFF ) + ( ( checksum >> 16 ) & 0xFF ) + ( checksum & 0xFF ) );
+	}
+
+	// Generates the crc byte of a received packet where it sits, the header is
+	// rebuilt on the stack with the crc byte as zero
+	uint8_t GenerateCheckByte( uint16_t size, uint16_t opcode, uint8_t count, const uint8_t * data, int32_t length )
+	{
+		uint8_t header[ 6 ] = { LOBYTE_( size ), HIBYTE_( size ), LOBYTE_( opcode ), HIBYTE_( opcode ), count, 0 };
+		uint32_t checksum = UpdateChecksum( m_crc_tables, 0xFFFFFFFF, header, 6 );
+		checksum = UpdateChecksum( m_crc_tables, checksum, data, length );
 		return ( uint8_t )( ( ( checksum >> 24 ) & 0xFF ) + ( ( checksum >> 8 ) & 0xFF ) + ( ( checksum >> 16 ) & 0xFF ) + ( checksum & 0xFF ) );
 	}
 
+	// Changes the crc seed along with the tables it uses
+	void SetCrcSeed( uint32_t seed )
+	{
+		m_crc_seed = seed;
+		m_crc_tables = GetCrcTables( seed );
+	}
+
 	void GenerateHandshake( uint8_t mode )
 	{
 		m_security_flag = mode;
 		m_client_security = true;
+		SelectPacketFunctions();
+
+		// The key schedule and g/p/x/A are usually ready in the pool
+		HandshakeParameters params;
+		if( !Pool || !Pool->Take( params ) )
+		{
+			GenerateHandshakeParameters( params, mode );
+		}
+
 		PacketContainer response;
 		response.opcode = 0x5000;
 		response.data.Write< uint8_t >( mode );
 		if( m_security_flags->blowfish )
 		{
-			m_initial_blowfish_key = rng();
-			m_blowfish.Initialize( &m_initial_blowfish_key, sizeof( m_initial_blowfish_key ) );
+			m_initial_blowfish_key = params.initial_blowfish_key;
+			m_blowfish = params.initial_blowfish;
 			response.data.Write< uint64_t >( m_initial_blowfish_key );
 		}
 		if( m_security_flags->security_bytes )
 		{
-			m_seed_count = static_cast< uint32_t >( rng() % 0xFF );
+			m_seed_count = params.seed_count;
 			SetupCountByte( m_seed_count );
-			m_crc_seed = static_cast< uint32_t >( rng() % 0xFF );
+			SetCrcSeed( params.crc_seed );
 			response.data.Write< uint32_t >( m_seed_count );
 			response.data.Write< uint32_t >( m_crc_seed );
 		}
 		if( m_security_flags->handshake )
 		{
-			m_handshake_blowfish_key = rng();
-			m_value_x = static_cast< uint32_t >( rng() & 0x7FFFFFFF );
-			m_value_g = static_cast< uint32_t >( rng() & 0x7FFFFFFF );
-			m_value_p = static_cast< uint32_t >( rng() & 0x7FFFFFFF );
-			m_value_A = G_pow_X_mod_P( m_value_p, m_value_x, m_value_g );
+			m_handshake_blowfish_key = params.handshake_blowfish_key;
+			m_value_x = params.value_x;
+			m_value_g = params.value_g;
+			m_value_p = params.value_p;
+			m_value_A = params.value_A;
 			response.data.Write< uint64_t >( m_handshake_blowfish_key );
 			response.data.Write< uint32_t >( m_value_g );
 			response.data.Write< uint32_t >( m_value_p );
 			response.data.Write< uint32_t >( m_value_A );
 		}
-		m_outgoing_packets.push_front( response );
+		m_outgoing_packets.push_front() = boost::move( response );
 	}
 
 	void Handshake( uint16_t packet_opcode, StreamUtility & packet_data, bool packet_encrypted )
@@ -451,7 +660,7 @@ public:
 			response.opcode = 0x5000;
 			response.data.Write< uint8_t >( tmp_flag );
 			response.data.Write< uint64_t >( m_challenge_key );
-			m_outgoing_packets.push_front( response );
+			m_outgoing_packets.push_front() = boost::move( response );
 		}
 		else
 		{
@@ -467,6 +676,7 @@ public:
 			if( m_security_flag == 0 )
 			{
 				m_security_flag = flag;
+				SelectPacketFunctions();
 			}
 
 			if( flags->blowfish )
@@ -478,7 +688,7 @@ public:
 			if( flags->security_bytes )
 			{
 				m_seed_count = packet_data.Read< uint32_t >();
-				m_crc_seed = packet_data.Read< uint32_t >();
+				SetCrcSeed( packet_data.Read< uint32_t >() );
 				SetupCountByte( m_seed_count );
 			}
 
@@ -534,7 +744,7 @@ public:
 				response.opcode = 0x5000;
 				response.data.Write< uint32_t >( m_value_B );
 				response.data.Write< uint64_t >( m_client_key );
-				m_outgoing_packets.push_front( response );
+				m_outgoing_packets.push_front() = boost::move( response );
 
 				// The handshake has started
 				m_started_handshake = true;
@@ -559,8 +769,8 @@ public:
 				response2.data.Write_Ascii( m_identity_name );
 				response2.data.Write< uint8_t >( m_identity_flag );
 
-				m_outgoing_packets.push_front( response2 );
-				m_outgoing_packets.push_front( response1 );
+				m_outgoing_packets.push_front() = boost::move( response2 );
+				m_outgoing_packets.push_front() = boost::move( response1 );
 
 				// Mark the handshake as accepted now
 				m_started_handshake = true;
@@ -623,66 +833,88 @@ uint8_t SilkroadSecurity::HasPacketToSend() const
 //-----------------------------------------------------------------------------
 
 std::vector< uint8_t > SilkroadSecurity::GetPacketToSend()
+{
+	std::vector< uint8_t > output;
+	GetPacketToSend( output );
+	return output;
+}
+
+//-----------------------------------------------------------------------------
+
+void SilkroadSecurity::GetPacketToSend( std::vector< uint8_t > & output )
 {
 	if( m_data->m_outgoing_packets.empty() )
 	{
 		throw( std::runtime_error( "[SilkroadSecurity::GetPacketToSend] No packets are avaliable to send.") );
 	}
 
-	PacketContainer packet_container = m_data->m_outgoing_packets.front();
+	// Popped before formatting so a packet that cannot be formatted does not
+	// stay in front of every later one. Moving it out trades buffers with the
+	// slot, so this does not allocate.
+	PacketContainer & packet_container = m_data->m_send_packet;
+	packet_container = boost::move( m_data->m_outgoing_packets.front() );
 	m_data->m_outgoing_packets.pop_front();
 
+	const uint8_t * data = packet_container.data.GetStreamPtr();
+	int32_t total_size = packet_container.data.GetStreamSize();
+
 	if( packet_container.massive )
 	{
-		uint8_t workspace[ 4089 ];
-		uint16_t parts = 0;
-
-		StreamUtility final;
-		StreamUtility final_data;
-
-		int32_t total_size = packet_container.data.GetStreamSize();
+		// Massive packets are sent from the current read position
+		data += packet_container.data.GetReadIndex();
+		total_size = packet_container.data.GetReadStreamSize();
+
+		uint16_t parts = static_cast< uint16_t >( ( total_size + MASSIVE_PART_SIZE - 1 ) / MASSIVE_PART_SIZE );
+		output.reserve( output.size() + total_size + ( parts + 1 ) * 32 );
+
+		// The header packet goes first so the security bytes are generated in wire order
+		uint8_t header[ 5 ];
+		header[ 0 ] = 1; // Header flag
+		header[ 1 ] = LOBYTE_( parts );
+		header[ 2 ] = HIBYTE_( parts );
+		header[ 3 ] = LOBYTE_( packet_container.opcode );
+		header[ 4 ] = HIBYTE_( packet_container.opcode );
+		FormatPacket( this, 0x600D, header, 5, 0, 0, packet_container.encrypted, output );
+
+		// Every part is formatted straight from the packet data
+		uint8_t flag = 0; // Data flag
 		while( total_size )
 		{
-			StreamUtility part_data;
-
-			int32_t cur_size = total_size > 4089 ? 4089 : total_size; // Max buffer size is 4kb for the client
-
-			part_data.Write< uint8_t >( 0 ); // Data flag
+			int32_t cur_size = total_size > MASSIVE_PART_SIZE ? MASSIVE_PART_SIZE : total_size; // Max buffer size is 4kb for the client
 
-			packet_container.data.Read< uint8_t >( workspace, cur_size );
-			part_data.Write< uint8_t >( workspace, cur_size );
+			FormatPacket( this, 0x600D, &flag, 1, data, cur_size, packet_container.encrypted, output );
 
+			data += cur_size;
 			total_size -= cur_size; // Update the size
-
-			final_data.Write( FormatPacket( this, 0x600D, part_data, packet_container.encrypted ) );
-
-			++parts; // Track how many parts there are
 		}
-
-		// Write the final header packet to the front of the packet
-		StreamUtility final_header;
-		final_header.Write< uint8_t >( 1 ); // Header flag
-		final_header.Write< uint16_t >( parts );
-		final_header.Write< uint16_t >( packet_container.opcode );
-		final.Write( FormatPacket( this, 0x600D, final_header, packet_container.encrypted ) );
-
-		// Finish the large packet of all the data
-		final.Write( final_data.GetStreamVector() );
-
-		// Return the collated data
-		return final.GetStreamVector();
 	}
 	else
 	{
+		uint8_t encrypted = packet_container.encrypted;
 		if( !m_data->m_client_security )
 		{
-			if( m_data->m_enc_opcodes.find( packet_container.opcode ) != m_data->m_enc_opcodes.end() )
+			if( m_data->m_opcodes->Get( packet_container.opcode ) & Opcode_Encrypted )
 			{
-				packet_container.encrypted = true;
+				encrypted = true;
 			}
 		}
-		return FormatPacket( this, packet_container.opcode, packet_container.data, packet_container.encrypted );
+		FormatPacket( this, packet_container.opcode, 0, 0, data, total_size, encrypted, output );
+	}
+
+	TrimBuffer( packet_container.data );
+}
+
+//-----------------------------------------------------------------------------
+
+int32_t SilkroadSecurity::GetPacketsToSend( std::vector< uint8_t > & output )
+{
+	int32_t count = 0;
+	while( HasPacketToSend() )
+	{
+		GetPacketToSend( output );
+		++count;
 	}
+	return count;
 }
 
 //-----------------------------------------------------------------------------
@@ -694,26 +926,129 @@ uint8_t SilkroadSecurity::HasPacketToRecv() const
 
 //-----------------------------------------------------------------------------
 
-PacketContainer SilkroadSecurity::GetPacketToRecv()
+PacketView SilkroadSecurity::PeekPacketToRecv()
+{
+	if( m_data->m_incoming_packets.empty() )
+	{
+		throw( std::runtime_error( "[SilkroadSecurity::PeekPacketToRecv] No packets are avaliable to process.") );
+	}
+
+	const IncomingPacket & packet = m_data->m_incoming_packets.front();
+
+	PacketView view;
+	view.opcode = packet.opcode;
+	view.size = packet.size;
+	view.encrypted = packet.encrypted;
+	view.massive = packet.massive;
+	view.data = 0;
+	if( packet.size )
+	{
+		if( packet.massive )
+		{
+			view.data = m_data->m_massive_packets.front().GetStreamPtr();
+		}
+		else
+		{
+			view.data = &m_data->m_recv_buffer[ packet.offset ];
+		}
+	}
+	return view;
+}
+
+//-----------------------------------------------------------------------------
+
+void SilkroadSecurity::PopPacketToRecv()
 {
 	if( m_data->m_incoming_packets.empty() )
 	{
-		throw( std::runtime_error( "[SilkroadSecurity::GetPacketToRecv] No packets are avaliable to process.") );
+		throw( std::runtime_error( "[SilkroadSecurity::PopPacketToRecv] No packets are avaliable to process.") );
 	}
 
-	PacketContainer packet_container = m_data->m_incoming_packets.front();
+	if( m_data->m_incoming_packets.front().massive )
+	{
+		TrimBuffer( m_data->m_massive_packets.front() );
+		m_data->m_massive_packets.pop_front();
+	}
 	m_data->m_incoming_packets.pop_front();
+}
+
+//-----------------------------------------------------------------------------
+
+int32_t SilkroadSecurity::GetPacketsToRecv( std::vector< PacketView > & packets )
+{
+	RingQueue< IncomingPacket > & incoming = m_data->m_incoming_packets;
+	size_t massive = 0;
+	for( size_t x = 0; x < incoming.size(); ++x )
+	{
+		const IncomingPacket & packet = incoming[ x ];
+		PacketView view;
+		view.opcode = packet.opcode;
+		view.size = packet.size;
+		view.encrypted = packet.encrypted;
+		view.massive = packet.massive;
+		view.data = 0;
+		if( packet.massive )
+		{
+			view.data = m_data->m_massive_packets[ massive ].GetStreamPtr();
+			++massive;
+		}
+		else if( packet.size )
+		{
+			view.data = &m_data->m_recv_buffer[ packet.offset ];
+		}
+		packets.push_back( view );
+	}
+	return static_cast< int32_t >( incoming.size() );
+}
+
+//-----------------------------------------------------------------------------
+
+void SilkroadSecurity::PopPacketsToRecv( int32_t count )
+{
+	while( count-- > 0 )
+	{
+		PopPacketToRecv();
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+PacketContainer SilkroadSecurity::GetPacketToRecv()
+{
+	PacketView view = PeekPacketToRecv();
+
+	PacketContainer packet_container;
+	packet_container.opcode = view.opcode;
+	packet_container.encrypted = view.encrypted;
+	packet_container.massive = view.massive;
+	if( view.massive )
+	{
+		packet_container.data.Swap( m_data->m_massive_packets.front() );
+	}
+	else
+	{
+		packet_container.data.Write< uint8_t >( view.data, view.size );
+	}
 
-	return packet_container;
+	PopPacketToRecv();
+	return boost::move( packet_container );
 }
 
 //-----------------------------------------------------------------------------
 
 void SilkroadSecurity::Send( uint16_t opcode, const uint8_t * data, int32_t count, uint8_t encrypted, uint8_t massive )
 {
-	StreamUtility su;
-	su.Write< uint8_t >( data, count );
-	Send( opcode, su, encrypted, massive );
+	if( opcode == 0x5000 || opcode == 0x9000 )
+	{
+		throw( std::runtime_error( "[SilkroadSecurity::Send] Handshake packets cannot be sent through this function.") );
+	}
+	PacketContainer & container = m_data->m_outgoing_packets.push_back();
+	container.opcode = opcode;
+	container.data.Clear();
+	ReserveBuffer( container.data, count );
+	container.data.Write< uint8_t >( data, count );
+	container.encrypted = encrypted;
+	container.massive = massive;
 }
 
 //-----------------------------------------------------------------------------
@@ -724,7 +1059,11 @@ void SilkroadSecurity::Send( uint16_t opcode, const StreamUtility & data, uint8_
 	{
 		throw( std::runtime_error( "[SilkroadSecurity::Send] Handshake packets cannot be sent through this function.") );
 	}
-	m_data->m_outgoing_packets.push_back( PacketContainer( opcode, data, encrypted, massive ) );
+	PacketContainer & container = m_data->m_outgoing_packets.push_back();
+	container.opcode = opcode;
+	container.data = data;
+	container.encrypted = encrypted;
+	container.massive = massive;
 }
 
 //-----------------------------------------------------------------------------
@@ -741,148 +1080,112 @@ void SilkroadSecurity::Recv( const std::vector< uint8_t > & stream )
 
 void SilkroadSecurity::Recv( const uint8_t * stream, int32_t count )
 {
-	m_data->m_pending_stream.Write< uint8_t >( stream, count );
-	int32_t total_bytes = m_data->m_pending_stream.GetStreamSize();
-	while( total_bytes > 2 )
+	if( count > 0 )
 	{
-		bool packet_encrypted = false;
+		int32_t size = 0;
+		uint8_t * buffer = GetRecvBuffer( count, size );
+		memcpy( buffer, stream, count );
+		CommitRecv( count );
+	}
+}
 
-		uint16_t required_size = m_data->m_pending_stream.Read< uint16_t >( true );
+//-----------------------------------------------------------------------------
 
-		if( required_size & 0x8000 )
+uint8_t * SilkroadSecurity::GetRecvBuffer( int32_t min_size, int32_t & size )
+{
+	std::vector< uint8_t > & buffer = m_data->m_recv_buffer;
+	RingQueue< IncomingPacket > & packets = m_data->m_incoming_packets;
+
+	if( min_size < 1 )
+	{
+		min_size = 1;
+	}
+
+	// Find the first byte that is still in use, either by a queued packet or
+	// by a packet that has not been completely received yet
+	size_t live = m_data->m_recv_begin;
+	for( size_t x = 0; x < packets.size(); ++x )
+	{
+		if( !packets[ x ].massive )
 		{
-			required_size &= 0x7FFF;
-			if( m_data->m_security_flags->blowfish )
+			if( packets[ x ].offset < live )
 			{
-				required_size = static_cast< uint16_t>( 2 + m_data->m_blowfish.GetOutputLength( required_size + 4 ) );
+				live = packets[ x ].offset;
 			}
-			else
-			{
-				required_size += 6;
-			}
-			packet_encrypted = true;
+			break;
 		}
-		else
+	}
+
+	// Move the live bytes to the front when nothing is left or the free space runs out
+	if( live && ( live == m_data->m_recv_end || buffer.size() - m_data->m_recv_end < static_cast< size_t >( min_size ) ) )
+	{
+		if( live != m_data->m_recv_end )
 		{
-			required_size += 6;
+			memmove( &buffer[ 0 ], &buffer[ live ], m_data->m_recv_end - live );
 		}
-
-		// If we have enough bytes to extract the next packet
-		if( required_size <= total_bytes )
+		m_data->m_recv_begin -= live;
+		m_data->m_recv_end -= live;
+		for( size_t x = 0; x < packets.size(); ++x )
 		{
-			if( packet_encrypted && m_data->m_security_flags->blowfish )
+			if( !packets[ x ].massive )
 			{
-				uint16_t index = 2;
-				uint16_t left = required_size - 2;
-				uint8_t work_buffer[ 8 ];
-				m_data->m_pending_stream.SeekRead( 2, Seek_Set );
-				while( left )
-				{
-					m_data->m_pending_stream.Read< uint8_t >( work_buffer, 8 );
-					m_data->m_blowfish.Decode( work_buffer, 8, work_buffer, 8 );
-					m_data->m_pending_stream.Overwrite< uint8_t >( index, work_buffer, 8 );
-					left -= 8;
-					index += 8;
-				}
-				m_data->m_pending_stream.SeekRead( 0, Seek_Set );
+				packets[ x ].offset -= live;
 			}
+		}
+	}
 
-			// Save the current packet's header
-			uint16_t packet_size = m_data->m_pending_stream.Read< uint16_t >();
-			uint16_t packet_opcode = m_data->m_pending_stream.Read< uint16_t >();
-			uint8_t packet_security_count = m_data->m_pending_stream.Read< uint8_t >(); 
-			uint8_t packet_security_crc = m_data->m_pending_stream.Read< uint8_t >(); 
+	// Trade the buffer for a larger one from the pool, only the bytes before
+	// the end are still needed after the move above
+	if( buffer.size() - m_data->m_recv_end < static_cast< size_t >( min_size ) )
+	{
+		std::vector< uint8_t > larger;
+		BufferPool::Borrow( larger, m_data->m_recv_end + min_size );
+		if( m_data->m_recv_end )
+		{
+			memcpy( &larger[ 0 ], &buffer[ 0 ], m_data->m_recv_end );
+		}
+		BufferPool::Release( buffer );
+		buffer.swap( larger );
+	}
 
-			// Client object whose bytes the server might need to verify
-			if( m_data->m_client_security )
-			{
-				if( m_data->m_security_flags->security_bytes )
-				{
-					StreamUtility whole_packet = m_data->m_pending_stream.Extract( 0, 6 + ( packet_size & 0x7FFF ) );
+	size = static_cast< int32_t >( buffer.size() - m_data->m_recv_end );
+	return &buffer[ m_data->m_recv_end ];
+}
 
-					uint8_t expected_count = m_data->GenerateCountByte( true );
-					if( packet_security_count != expected_count )
-					{
-						throw( std::runtime_error( "[SilkroadSecurity::Recv] Count byte mismatch." ) );
-					}
+//-----------------------------------------------------------------------------
 
-					if( m_data->m_security_flags->security_bytes && !m_data->m_security_flags->blowfish )
-					{
-						if( m_data->m_enc_opcodes.find( packet_opcode ) != m_data->m_enc_opcodes.end() )
-						{
-							whole_packet.Overwrite< uint16_t >( 0, packet_size | 0x8000 );
-							packet_encrypted = true;
-						}
-					}
+void SilkroadSecurity::ReleaseRecvBuffer()
+{
+	if( m_data->m_recv_begin != m_data->m_recv_end || m_data->m_recv_buffer.empty() )
+	{
+		return;
+	}
 
-					whole_packet.Overwrite< uint8_t >( 5, 0 );
-					uint8_t expected_crc = m_data->GenerateCheckByte( whole_packet );
-					if( packet_security_crc != expected_crc )
-					{
-						throw( std::runtime_error( "[SilkroadSecurity::Recv] CRC byte mismatch." ) );
-					}
-				}
-			}
+	// Queued packets still point into the buffer
+	RingQueue< IncomingPacket > & packets = m_data->m_incoming_packets;
+	for( size_t x = 0; x < packets.size(); ++x )
+	{
+		if( !packets[ x ].massive )
+		{
+			return;
+		}
+	}
 
-			// Save the current packet's data
-			StreamUtility packet_data = m_data->m_pending_stream.Extract( 6, packet_size & 0x7FFF );
+	BufferPool::Release( m_data->m_recv_buffer );
+	m_data->m_recv_begin = 0;
+	m_data->m_recv_end = 0;
+}
 
-			// Sliding window update of remaining bytes
-			m_data->m_pending_stream.Delete( 0, required_size );
-			m_data->m_pending_stream.SeekRead( 0, Seek_Set );
-			total_bytes -= required_size;
+//-----------------------------------------------------------------------------
 
-			if( packet_opcode == 0x5000 || packet_opcode == 0x9000 ) // New logic processing!
-			{
-				m_data->Handshake( packet_opcode, packet_data, packet_encrypted );
-			}
-			else
-			{
-				if( m_data->m_client_security )
-				{
-					// Make sure the client accepted the security system first
-					if( !m_data->m_accepted_handshake )
-					{
-						throw( std::runtime_error( "[SilkroadSecurity::Recv] The client has not accepted the handshake." ) );
-					}
-				}
-				if( packet_opcode == 0x600D ) // Auto process massive messages for the user
-				{
-					uint8_t mode = packet_data.Read< uint8_t >();
-					if( mode == 1 )
-					{
-						m_data->m_massive_header = true;
-						m_data->m_massive_count = packet_data.Read< uint16_t >();
-						m_data->m_massive_opcode = packet_data.Read< uint16_t >();
-					}
-					else
-					{
-						if( m_data->m_massive_header == false )
-						{
-							throw( std::runtime_error( "[SilkroadSecurity::Recv] A malformed 0x600D packet was received." ) );
-						}
-						packet_data.Delete( 0, 1 ); // Remove the data flag
-						packet_data.SeekRead( 0, Seek_Set );
-						m_data->m_massive_packet.Write( packet_data.GetStreamVector() );
-						m_data->m_massive_count--;
-						if( m_data->m_massive_count == 0 )
-						{
-							m_data->m_incoming_packets.push_back( PacketContainer( m_data->m_massive_opcode, m_data->m_massive_packet, packet_encrypted, true ) );
-							m_data->m_massive_header = false;
-							m_data->m_massive_packet = StreamUtility();
-						}
-					}
-				}
-				else // Everything else
-				{
-					m_data->m_incoming_packets.push_back( PacketContainer( packet_opcode, packet_data, packet_encrypted, false ) );
-				}
-			}
-		}
-		else
-		{
-			break; // Otherwise we are done in this loop
-		}
+void SilkroadSecurity::CommitRecv( int32_t count )
+{
+	m_data->m_recv_end += count;
+
+	// The flags can change with each handshake packet, so the packet path is
+	// looked up again after every one
+	while( m_data->m_recv_packets( m_data ) )
+	{
 	}
 }
 
@@ -916,103 +1219,307 @@ void SilkroadSecurity::GenerateHandshake( uint8_t blowfish, uint8_t security_byt
 
 //-----------------------------------------------------------------------------
 
-void SilkroadSecurity::AddEncryptedOpcode( uint16_t opcode )
+uint8_t SilkroadSecurity::IsHandshakeComplete() const
 {
-	m_data->m_enc_opcodes.insert( opcode );
+	return m_data->m_accepted_handshake ? 1 : 0;
 }
 
 //-----------------------------------------------------------------------------
 
-std::vector< uint8_t > FormatPacket( SilkroadSecurity * silkroad_security, uint16_t opcode, StreamUtility & data, uint8_t encrypted )
+void SilkroadSecurity::StartHandshakePool( int32_t count )
 {
-	// Sanity check
-	if( data.GetStreamSize() > 0x7FFF )
+	if( Pool || count <= 0 )
 	{
-		throw( std::runtime_error( "[FormatPacket] Packet too large." ) );
+		return;
 	}
+	Pool = new HandshakePool( count );
+}
 
-	// Add the packet header to the start of the data
-	data.Insert< uint16_t >( 0, static_cast< uint16_t >( data.GetStreamSize() ) ); // packet size
-	data.Insert< uint16_t >( 2, opcode ); // packet opcode
-	data.Insert< uint16_t >( 4, 0 ); // packet security bytes
+void SilkroadSecurity::StopHandshakePool()
+{
+	delete Pool;
+	Pool = 0;
+}
 
-	// Determine if we need to mark the packet size as encrypted
-	if( encrypted && ( silkroad_security->m_data->m_security_flags->blowfish || ( silkroad_security->m_data->m_security_flags->security_bytes && !silkroad_security->m_data->m_security_flags->blowfish ) ) )
-	{
-		uint16_t packet_size = static_cast< uint16_t >( data.GetStreamSize() - 6 );
-		packet_size |= 0x8000;
-		data.Overwrite< uint16_t >( 0, packet_size );
-	}
+//-----------------------------------------------------------------------------
 
-	// Only need to stamp bytes if this is a clientless object
-	if( !silkroad_security->m_data->m_client_security && silkroad_security->m_data->m_security_flags->security_bytes )
-	{
-		uint8_t sb = 0;
+void SilkroadSecurity::AddEncryptedOpcode( uint16_t opcode )
+{
+	// The table may be shared, so the change is made to a copy
+	boost::shared_ptr< OpcodeTable > opcodes = boost::make_shared< OpcodeTable >( *m_data->m_opcodes );
+	opcodes->Set( opcode, Opcode_Encrypted );
+	m_data->m_opcodes = opcodes;
+}
 
-		sb = silkroad_security->m_data->GenerateCountByte( true );
-		data.Overwrite< uint8_t >( 4, sb );
+//-----------------------------------------------------------------------------
 
-		sb = silkroad_security->m_data->GenerateCheckByte( data );
-		data.Overwrite< uint8_t >( 5, sb );
-	}
+void SilkroadSecurity::SetMassivePassthrough( uint8_t enabled )
+{
+	m_data->m_massive_passthrough = enabled ? true : false;
+}
 
-	// If the packet should be physically encrypted, return an encrypted version of it
-	if( encrypted && silkroad_security->m_data->m_security_flags->blowfish )
+//-----------------------------------------------------------------------------
+
+// Frames, decrypts and verifies received packets. Returns true right after a
+// handshake packet, since that can change the flags this was compiled for.
+template< bool blowfish_mode, bool security_bytes_mode, bool client_security >
+bool RecvPackets( SilkroadSecurityData * security )
+{
+	while( security->m_recv_end - security->m_recv_begin > 2 )
 	{
-		// Store how many data bytes there are and how many encrypted bytes are needed
-		int32_t total_bytes = data.GetStreamSize() - 2;
-		int32_t needed_bytes = static_cast< int32_t >( silkroad_security->m_data->m_blowfish.GetOutputLength( total_bytes ) );
+		uint8_t * packet = &security->m_recv_buffer[ security->m_recv_begin ];
+		size_t total_bytes = security->m_recv_end - security->m_recv_begin;
 
-		// Write extra padding as needed
-		for( int32_t x = 0; x < ( needed_bytes - total_bytes ); ++x )
+		bool packet_encrypted = false;
+
+		uint16_t required_size = MAKEWORD_( packet[ 0 ], packet[ 1 ] );
+
+		if( required_size & 0x8000 )
+		{
+			required_size &= 0x7FFF;
+			if( blowfish_mode )
+			{
+				required_size = static_cast< uint16_t>( 2 + security->m_blowfish.GetOutputLength( required_size + 4 ) );
+			}
+			else
+			{
+				required_size += 6;
+			}
+			packet_encrypted = true;
+		}
+		else
 		{
-			data.Write< uint8_t >( 0 );
+			required_size += 6;
 		}
 
-		// Blowfish work buffer, has to be mod 8 in size!
-		uint8_t work_buffer[ 8 ];
-
-		// We want to start writing after the packet size field
-		int32_t write_index = 2;
+		// Otherwise we are done in this loop
+		if( required_size > total_bytes )
+		{
+			break;
+		}
 
-		// We want to start reading the data to be encrypted
-		data.SeekRead( write_index, Seek_Set );
+		// Decrypt everything after the size field in place
+		if( blowfish_mode && packet_encrypted )
+		{
+			security->m_blowfish.DecodeBlocks( packet + 2, required_size - 2 );
+		}
 
-		// Store how many bytes there are to process
-		int32_t bytes_left = total_bytes;
+		// Save the current packet's header
+		uint16_t packet_size = MAKEWORD_( packet[ 0 ], packet[ 1 ] );
+		uint16_t packet_opcode = MAKEWORD_( packet[ 2 ], packet[ 3 ] );
+		uint8_t packet_security_count = packet[ 4 ];
+		uint8_t packet_security_crc = packet[ 5 ];
+		int32_t data_size = packet_size & 0x7FFF;
 
-		// Loop while we have bytes left to process
-		while( bytes_left )
+		// Client object whose bytes the server might need to verify
+		if( client_security )
 		{
-			// Calculate how many bytes we can process
-			int32_t process_count = bytes_left > 8 ? 8 : bytes_left;
+			if( security_bytes_mode )
+			{
+				uint8_t expected_count = security->GenerateCountByte( true );
+				if( packet_security_count != expected_count )
+				{
+					throw( std::runtime_error( "[SilkroadSecurity::Recv] Count byte mismatch." ) );
+				}
 
-			// Read in the plain text
-			data.Read< uint8_t >( work_buffer, process_count );
+				// The checksum is generated over the packet where it sits
+				uint16_t check_size = packet_size;
+				if( !blowfish_mode )
+				{
+					if( security->m_opcodes->Get( packet_opcode ) & Opcode_Encrypted )
+					{
+						check_size |= 0x8000;
+						packet_encrypted = true;
+					}
+				}
 
-			// Generate the cipher text
-			silkroad_security->m_data->m_blowfish.Encode( work_buffer, process_count, work_buffer, 8 );
+				uint8_t expected_crc = security->GenerateCheckByte( check_size, packet_opcode, packet_security_count, packet + 6, data_size );
+				if( packet_security_crc != expected_crc )
+				{
+					throw( std::runtime_error( "[SilkroadSecurity::Recv] CRC byte mismatch." ) );
+				}
+			}
+		}
+
+		// The packet's data stays where it is
+		size_t data_offset = security->m_recv_begin + 6;
+		const uint8_t * packet_data = packet + 6;
 
-			// Write the final data
-			data.Overwrite< uint8_t >( write_index, work_buffer, 8 );
+		// Sliding window update of remaining bytes
+		security->m_recv_begin += required_size;
 
-			// Update state
-			bytes_left -= process_count;
-			write_index += process_count;
+		if( packet_opcode == 0x5000 || packet_opcode == 0x9000 ) // New logic processing!
+		{
+			StreamUtility handshake_data( packet_data, data_size );
+			security->Handshake( packet_opcode, handshake_data, packet_encrypted );
+			return true;
+		}
+		else
+		{
+			if( client_security )
+			{
+				// Make sure the client accepted the security system first
+				if( !security->m_accepted_handshake )
+				{
+					throw( std::runtime_error( "[SilkroadSecurity::Recv] The client has not accepted the handshake." ) );
+				}
+			}
+			if( packet_opcode == 0x600D && !security->m_massive_passthrough ) // Auto process massive messages for the user
+			{
+				uint8_t mode = data_size ? packet_data[ 0 ] : 0;
+				if( mode == 1 )
+				{
+					StreamUtility header( packet_data, data_size );
+					header.Read< uint8_t >();
+					if( !security->m_massive_header )
+					{
+						security->m_massive_packets.push_back().Clear();
+					}
+					security->m_massive_header = true;
+					security->m_massive_count = header.Read< uint16_t >();
+					security->m_massive_opcode = header.Read< uint16_t >();
+
+					// Small packets are then copied once into space reserved for all their parts
+					int32_t reserve = security->m_massive_count * MASSIVE_PART_SIZE;
+					security->m_massive_packets.back().Reserve( reserve > MAX_MASSIVE_RESERVE ? MAX_MASSIVE_RESERVE : reserve );
+				}
+				else
+				{
+					if( security->m_massive_header == false )
+					{
+						throw( std::runtime_error( "[SilkroadSecurity::Recv] A malformed 0x600D packet was received." ) );
+					}
+					StreamUtility & massive_packet = security->m_massive_packets.back();
+					if( data_size > 1 )
+					{
+						massive_packet.Write< uint8_t >( packet_data + 1, data_size - 1 ); // Skip the data flag
+					}
+					security->m_massive_count--;
+					if( security->m_massive_count == 0 )
+					{
+						IncomingPacket & incoming = security->m_incoming_packets.push_back();
+						incoming.opcode = security->m_massive_opcode;
+						incoming.encrypted = packet_encrypted;
+						incoming.massive = true;
+						incoming.offset = 0;
+						incoming.size = massive_packet.GetStreamSize();
+						security->m_massive_header = false;
+					}
+				}
+			}
+			else // Everything else
+			{
+				IncomingPacket & incoming = security->m_incoming_packets.push_back();
+				incoming.opcode = packet_opcode;
+				incoming.encrypted = packet_encrypted;
+				incoming.massive = false;
+				incoming.offset = data_offset;
+				incoming.size = data_size;
+			}
 		}
 	}
+	return false;
+}
+
+//-----------------------------------------------------------------------------
+
+// Builds a packet in the wire format for one combination of security flags
+template< bool blowfish_mode, bool security_bytes_mode, bool client_security >
+void FormatPacket( SilkroadSecurityData * security, uint16_t opcode, const uint8_t * prefix, int32_t prefix_count, const uint8_t * data, int32_t count, uint8_t encrypted, std::vector< uint8_t > & output )
+{
+	// Sanity check
+	if( prefix_count + count > 0x7FFF )
+	{
+		throw( std::runtime_error( "[FormatPacket] Packet too large." ) );
+	}
+
+	// Physically encrypted packets are padded to the blowfish block size after the size field
+	bool blowfish = blowfish_mode && encrypted;
+	int32_t total_bytes = 6 + prefix_count + count;
+	int32_t output_bytes = blowfish ? 2 + static_cast< int32_t >( security->m_blowfish.GetOutputLength( total_bytes - 2 ) ) : total_bytes;
+
+	// Reserve the header and padding up front so the packet is built in one pass
+	size_t index = output.size();
+	output.resize( index + output_bytes );
+	uint8_t * packet = &output[ index ];
+
+	// Determine if we need to mark the packet size as encrypted
+	uint16_t packet_size = static_cast< uint16_t >( prefix_count + count );
+	if( ( blowfish_mode || security_bytes_mode ) && encrypted )
+	{
+		packet_size |= 0x8000;
+	}
+
+	// Packet header
+	packet[ 0 ] = LOBYTE_( packet_size );
+	packet[ 1 ] = HIBYTE_( packet_size );
+	packet[ 2 ] = LOBYTE_( opcode );
+	packet[ 3 ] = HIBYTE_( opcode );
+	packet[ 4 ] = 0;
+	packet[ 5 ] = 0;
+	if( prefix_count )
+	{
+		memcpy( packet + 6, prefix, prefix_count );
+	}
+	if( count )
+	{
+		memcpy( packet + 6 + prefix_count, data, count );
+	}
+	if( output_bytes > total_bytes )
+	{
+		memset( packet + total_bytes, 0, output_bytes - total_bytes );
+	}
+
+	// Only need to stamp bytes if this is a clientless object
+	if( !client_security && security_bytes_mode )
+	{
+		packet[ 4 ] = security->GenerateCountByte( true );
+		packet[ 5 ] = security->GenerateCheckByte( packet, total_bytes );
+	}
+
+	// If the packet should be physically encrypted, encrypt everything after the size field in place
+	if( blowfish )
+	{
+		security->m_blowfish.EncodeBlocks( packet + 2, output_bytes - 2 );
+	}
 	else
 	{
 		// Determine if we need to unmark the packet size from being encrypted but not physically encrypted
-		if( encrypted && ( silkroad_security->m_data->m_security_flags->security_bytes && !silkroad_security->m_data->m_security_flags->blowfish ) )
+		if( !blowfish_mode && security_bytes_mode && encrypted )
 		{
-			uint16_t packet_size = static_cast< uint16_t >( data.GetStreamSize() - 6 );
-			data.Overwrite< uint16_t >( 0, packet_size );
+			packet[ 0 ] = LOBYTE_( prefix_count + count );
+			packet[ 1 ] = HIBYTE_( prefix_count + count );
 		}
 	}
+}
+
+void FormatPacket( SilkroadSecurity * silkroad_security, uint16_t opcode, const uint8_t * prefix, int32_t prefix_count, const uint8_t * data, int32_t count, uint8_t encrypted, std::vector< uint8_t > & output )
+{
+	SilkroadSecurityData * security = silkroad_security->m_data;
+	security->m_format_packet( security, opcode, prefix, prefix_count, data, count, encrypted, output );
+}
+
+//-----------------------------------------------------------------------------
 
-	// Return the final data
-	return data.GetStreamVector();
+void SilkroadSecurityData::SelectPacketFunctions()
+{
+	static const FormatPacketFunction format_functions[ 8 ] =
+	{
+		FormatPacket< false, false, false >, FormatPacket< false, false, true >,
+		FormatPacket< false, true, false >, FormatPacket< false, true, true >,
+		FormatPacket< true, false, false >, FormatPacket< true, false, true >,
+		FormatPacket< true, true, false >, FormatPacket< true, true, true >,
+	};
+	static const RecvPacketsFunction recv_functions[ 8 ] =
+	{
+		RecvPackets< false, false, false >, RecvPackets< false, false, true >,
+		RecvPackets< false, true, false >, RecvPackets< false, true, true >,
+		RecvPackets< true, false, false >, RecvPackets< true, false, true >,
+		RecvPackets< true, true, false >, RecvPackets< true, true, true >,
+	};
+	int32_t index = ( m_security_flags->blowfish ? 4 : 0 ) | ( m_security_flags->security_bytes ? 2 : 0 ) | ( m_client_security ? 1 : 0 );
+	m_format_packet = format_functions[ index ];
+	m_recv_packets = recv_functions[ index ];
 }
 
 //-----------------------------------------------------------------------------
@@ -1027,20 +1534,19 @@ PacketContainer::PacketContainer( uint16_t packet_opcode, const StreamUtility &
 {
 }
 
-PacketContainer::PacketContainer( const PacketContainer & rhs )
+PacketContainer::PacketContainer( BOOST_RV_REF( PacketContainer ) rhs )
+: opcode( rhs.opcode ), encrypted( rhs.encrypted ), massive( rhs.massive )
 {
-	opcode = rhs.opcode;
-	data = rhs.data;
-	encrypted = rhs.encrypted;
-	massive = rhs.massive;
+	data.Swap( rhs.data );
 }
 
-PacketContainer & PacketContainer::operator =( const PacketContainer & rhs )
+PacketContainer & PacketContainer::operator =( BOOST_RV_REF( PacketContainer ) rhs )
 {
 	if( this != &rhs )
 	{
 		opcode = rhs.opcode;
-		data = rhs.data;
+		data.Clear();
+		data.Swap( rhs.data );
 		encrypted = rhs.encrypted;
 		massive = rhs.massive;
 	}
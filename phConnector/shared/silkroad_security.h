@@ -7,13 +7,19 @@
 
 #include <stdint.h>
 #include "stream_utility.h"
+#include <boost/move/move.hpp>
 #include <vector>
 #include <string>
 
 //-----------------------------------------------------------------------------
 
+// Packets are moved rather than copied, use boost::move to hand one over.
 struct PacketContainer
 {
+private:
+	BOOST_MOVABLE_BUT_NOT_COPYABLE( PacketContainer )
+
+public:
 	uint16_t opcode;
 	StreamUtility data;
 	uint8_t encrypted;
@@ -21,13 +27,27 @@ struct PacketContainer
 
 	PacketContainer();
 	PacketContainer( uint16_t packet_opcode, const StreamUtility & packet_data, uint8_t packet_encrypted, uint8_t packet_massive );
-	PacketContainer( const PacketContainer & rhs );
-	PacketContainer & operator =( const PacketContainer & rhs );
+	PacketContainer( BOOST_RV_REF( PacketContainer ) rhs );
+	PacketContainer & operator =( BOOST_RV_REF( PacketContainer ) rhs );
 	~PacketContainer();
 };
 
 //-----------------------------------------------------------------------------
 
+// A received packet that has not been copied out of the security object. The
+// data pointer stays valid until the packet is popped or GetRecvBuffer/Recv
+// is called again.
+struct PacketView
+{
+	uint16_t opcode;
+	const uint8_t * data;
+	int32_t size;
+	uint8_t encrypted;
+	uint8_t massive;
+};
+
+//-----------------------------------------------------------------------------
+
 struct SilkroadSecurityData;
 class SilkroadSecurity
 {
@@ -61,6 +81,19 @@ public:
 	void Recv( const uint8_t * stream, int32_t count );
 	void Recv( const std::vector< uint8_t > & stream );
 
+	// Zero copy version of Recv. GetRecvBuffer returns a writable region of at
+	// least min_size bytes (size receives the real amount) that network data
+	// can be read into directly. CommitRecv then frames, decrypts and verifies
+	// the bytes written in place. Do not call GetRecvBuffer again until the
+	// region has been committed. Can throw.
+	uint8_t * GetRecvBuffer( int32_t min_size, int32_t & size );
+	void CommitRecv( int32_t count );
+
+	// Returns the receive buffer to the pool it was borrowed from if it holds
+	// no partial or queued packets. The next GetRecvBuffer borrows a new one.
+	// Lets idle connections keep no receive memory.
+	void ReleaseRecvBuffer();
+
 	// Returns true if there are any packets ready to be processed. This function
 	// should be called after Recv or at some regular interval depending 
 	// on your implementation.
@@ -70,9 +103,20 @@ public:
 	// NOTE: Certain packets are processed internally and then returned to the user
 	// in a usable form. For example: 0x600D packets are handled internally and the
 	// data they contain is returned through this function. You will never get a
-	// a 0x600D packet to process. Can throw.
+	// a 0x600D packet to process unless SetMassivePassthrough is enabled. Can throw.
 	PacketContainer GetPacketToRecv();
 
+	// Same as GetPacketToRecv without copying the packet data. PeekPacketToRecv
+	// returns the next packet and PopPacketToRecv releases it. Can throw.
+	PacketView PeekPacketToRecv();
+	void PopPacketToRecv();
+
+	// Appends views of every packet waiting to be processed and returns how
+	// many were added. Pass the count to PopPacketsToRecv once done with them.
+	// Reusing the same vector keeps this free of allocations.
+	int32_t GetPacketsToRecv( std::vector< PacketView > & packets );
+	void PopPacketsToRecv( int32_t count );
+
 	// Transfers formatted outgoing data into the security object. A packet
 	// is then queued internally and will be processed when the GetPacketToSend
 	// function is called. This function is very lightweight, so no heavy processing
@@ -90,11 +134,37 @@ public:
 	// called within a serialized network thread. Can throw.
 	std::vector< uint8_t > GetPacketToSend();
 
+	// Same as above, but the formatted packet is appended to the end of output
+	// so the caller can reuse its buffer. Can throw.
+	void GetPacketToSend( std::vector< uint8_t > & output );
+
+	// Appends every packet that can be sent right now to output, ready for a
+	// single write, and returns how many were added. Can throw.
+	int32_t GetPacketsToSend( std::vector< uint8_t > & output );
+
 	// When the security mode is set to include security bytes, certain opcodes 
 	// must be added to comply with the security system. The security system will
 	// pre-add the GatewayServer packet opcodes as needed. The user should add the
 	// * item use opcode * for the current version of Silkroad they are using.
 	void AddEncryptedOpcode( uint16_t opcode );
+
+	// When enabled, 0x600D parts are not reassembled. Every part is returned
+	// as its own 0x600D packet the moment it arrives, so a proxy can forward
+	// it right away (sending it back out as a normal 0x600D packet). Defaults
+	// to false.
+	void SetMassivePassthrough( uint8_t enabled );
+
+	// Returns true once the handshake has been accepted. Until then incoming
+	// data can carry handshake packets that need the expensive key setup.
+	uint8_t IsHandshakeComplete() const;
+
+	// Starts a background thread that keeps up to count sets of server side
+	// handshake values (keys, seeds and g/p/x/A) generated ahead of time so
+	// GenerateHandshake only has to pick one up. When the pool is empty the
+	// values are generated inline as before. Call these before any security
+	// objects are created and after they are all gone.
+	static void StartHandshakePool( int32_t count );
+	static void StopHandshakePool();
 };
 
 //-----------------------------------------------------------------------------
@@ -3,6 +3,7 @@
 #include <iomanip>
 #include <cctype>
 #include <sstream>
+#include <algorithm>
 
 //-----------------------------------------------------------------------------
 
@@ -57,6 +58,19 @@ void StreamUtility::Clear()
 	m_write_error = false;
 }
 
+void StreamUtility::Swap( StreamUtility & rhs )
+{
+	m_stream.swap( rhs.m_stream );
+	std::swap( m_read_index, rhs.m_read_index );
+	std::swap( m_read_error, rhs.m_read_error );
+	std::swap( m_write_error, rhs.m_write_error );
+}
+
+void StreamUtility::Reserve( int32_t count )
+{
+	m_stream.reserve( m_stream.size() + count );
+}
+
 bool StreamUtility::WasWriteError()
 {
 	return m_write_error;
@@ -40,6 +40,8 @@ public:
 	~StreamUtility();
 	StreamUtility & operator =( const StreamUtility & rhs );
 	void Clear();
+	void Swap( StreamUtility & rhs );
+	void Reserve( int32_t count );
 	bool WasWriteError();
 	bool WasReadError();
 	void ClearReadError();
@@ -113,7 +115,8 @@ public:
 	{
 		if( count )
 		{
-			std::copy( (uint8_t *)input, (count * sizeof(type)) + (uint8_t *)input, std::back_inserter( m_stream ) );
+			const uint8_t * bytes = reinterpret_cast< const uint8_t * >( input );
+			m_stream.insert( m_stream.end(), bytes, bytes + ( count * sizeof( type ) ) );
 		}
 	}
 
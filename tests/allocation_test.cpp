@@ -0,0 +1,128 @@
+#include "test.h"
+#include <cstring>
+
+//-----------------------------------------------------------------------------
+
+// Packets forwarded before counting starts. Queue slots keep the largest
+// buffer they have needed, so this runs through every packet size (the sizes
+// repeat every 900 packets) before anything is counted.
+#define WARM_UP_PACKETS 1000
+
+// Packets forwarded while counting
+#define COUNTED_PACKETS 2000
+
+//-----------------------------------------------------------------------------
+
+namespace
+{
+	// client <-> proxy_in ... proxy_out <-> server, the same chain a session
+	// forwards packets through
+	struct Chain
+	{
+		SilkroadSecurity client;
+		SilkroadSecurity proxy_in;
+		SilkroadSecurity proxy_out;
+		SilkroadSecurity server;
+
+		std::vector< uint8_t > wire;
+		std::vector< PacketView > packets;
+		std::vector< uint8_t > payload;
+	};
+
+	// Hands every packet from one security object to the other, as a session does
+	int32_t Forward( SilkroadSecurity & from, SilkroadSecurity & to, std::vector< PacketView > & packets )
+	{
+		packets.clear();
+		int32_t count = from.GetPacketsToRecv( packets );
+		for( int32_t x = 0; x < count; ++x )
+		{
+			const PacketView & p = packets[ x ];
+			to.Send( p.opcode, p.data, p.size, p.encrypted, p.massive );
+		}
+		from.PopPacketsToRecv( count );
+		return count;
+	}
+
+	// Sends one packet from the client to the server and the reply back.
+	// Returns false if either one did not arrive intact.
+	bool RoundTrip( Chain & chain, int32_t index )
+	{
+		int32_t size = 1 + ( index * 37 ) % 900;
+		uint8_t encrypted = index % 2 ? 1 : 0;
+		for( int32_t x = 0; x < size; ++x )
+		{
+			chain.payload[ x ] = static_cast< uint8_t >( x * 131 + index );
+		}
+
+		chain.client.Send( 0x7001, &chain.payload[ 0 ], size, encrypted );
+		Deliver( chain.client, chain.proxy_in, chain.wire );
+		Forward( chain.proxy_in, chain.proxy_out, chain.packets );
+		Deliver( chain.proxy_out, chain.server, chain.wire );
+
+		bool intact = false;
+		chain.packets.clear();
+		int32_t count = chain.server.GetPacketsToRecv( chain.packets );
+		if( count == 1 )
+		{
+			const PacketView & p = chain.packets[ 0 ];
+			intact = p.opcode == 0x7001 && p.size == size && p.encrypted == encrypted && memcmp( p.data, &chain.payload[ 0 ], size ) == 0;
+
+			// Echo it back
+			chain.server.Send( 0xB001, p.data, p.size, p.encrypted );
+		}
+		chain.server.PopPacketsToRecv( count );
+
+		Deliver( chain.server, chain.proxy_out, chain.wire );
+		Forward( chain.proxy_out, chain.proxy_in, chain.packets );
+		Deliver( chain.proxy_in, chain.client, chain.wire );
+
+		chain.packets.clear();
+		count = chain.client.GetPacketsToRecv( chain.packets );
+		intact = intact && count == 1 && chain.packets[ 0 ].opcode == 0xB001 && chain.packets[ 0 ].size == size;
+		chain.client.PopPacketsToRecv( count );
+
+		// Idle connections give their receive buffers back between reads
+		chain.proxy_in.ReleaseRecvBuffer();
+		chain.proxy_out.ReleaseRecvBuffer();
+
+		return intact;
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+// Forwarding a packet through a warm session must not allocate
+void TestAllocations()
+{
+	Chain chain;
+	chain.payload.resize( 1024 );
+
+	chain.proxy_in.GenerateHandshake();
+	chain.server.GenerateHandshake();
+	CHECK( CompleteHandshake( chain.proxy_in, chain.client, chain.wire ) );
+	CHECK( CompleteHandshake( chain.server, chain.proxy_out, chain.wire ) );
+	DiscardPackets( chain.client, chain.packets );
+	DiscardPackets( chain.proxy_in, chain.packets );
+	DiscardPackets( chain.proxy_out, chain.packets );
+	DiscardPackets( chain.server, chain.packets );
+
+	int32_t index = 0;
+	bool intact = true;
+	for( ; index < WARM_UP_PACKETS; ++index )
+	{
+		intact = RoundTrip( chain, index ) && intact;
+	}
+
+	long before = AllocationCount();
+	for( ; index < WARM_UP_PACKETS + COUNTED_PACKETS; ++index )
+	{
+		intact = RoundTrip( chain, index ) && intact;
+	}
+	long allocations = AllocationCount() - before;
+
+	CHECK( intact );
+	CHECK( allocations == 0 );
+	std::cout << "TestAllocations: " << allocations << " allocation(s) over " << COUNTED_PACKETS << " round trips" << std::endl;
+}
+
+//-----------------------------------------------------------------------------
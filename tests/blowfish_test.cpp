@@ -0,0 +1,74 @@
+#include "test.h"
+#include "shared/blowfish.h"
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <cstring>
+
+//-----------------------------------------------------------------------------
+
+// Random keys and spans compared, with a fixed seed so failures repeat
+#define BLOWFISH_TRIALS 500
+
+// The first trials use every span length up to this many blocks, which covers
+// 0 to 3 blocks left over after the four block loop, with and without it running
+#define BLOWFISH_SHORT_BLOCKS 16
+
+// Longest random span in blocks
+#define BLOWFISH_MAX_BLOCKS 256
+
+//-----------------------------------------------------------------------------
+
+namespace
+{
+	void FillRandom( boost::random::mt19937 & generator, uint8_t * data, int32_t size )
+	{
+		boost::random::uniform_int_distribution< int32_t > byte( 0, 255 );
+		for( int32_t x = 0; x < size; ++x )
+		{
+			data[ x ] = static_cast< uint8_t >( byte( generator ) );
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+// EncodeBlocks and DecodeBlocks have to give the same bytes as Encode and
+// Decode one block at a time
+void TestBlowfishBlocks()
+{
+	boost::random::mt19937 generator( 0x5EED );
+	boost::random::uniform_int_distribution< int32_t > key_size( 1, 56 );
+	boost::random::uniform_int_distribution< int32_t > span_blocks( 0, BLOWFISH_MAX_BLOCKS );
+
+	uint8_t key[ 56 ];
+	std::vector< uint8_t > plain( BLOWFISH_MAX_BLOCKS * 8 );
+	std::vector< uint8_t > expected( BLOWFISH_MAX_BLOCKS * 8 );
+	std::vector< uint8_t > actual( BLOWFISH_MAX_BLOCKS * 8 );
+
+	for( int32_t x = 0; x < BLOWFISH_TRIALS; ++x )
+	{
+		int32_t size = ( x < BLOWFISH_SHORT_BLOCKS ? x : span_blocks( generator ) ) * 8;
+
+		Blowfish blowfish;
+		int32_t key_length = key_size( generator );
+		FillRandom( generator, key, key_length );
+		CHECK( blowfish.Initialize( key, key_length ) );
+
+		FillRandom( generator, &plain[ 0 ], size );
+
+		// Encode
+		CHECK( blowfish.Encode( &plain[ 0 ], size, &expected[ 0 ], size ) );
+		memcpy( &actual[ 0 ], &plain[ 0 ], size );
+		CHECK( blowfish.EncodeBlocks( &actual[ 0 ], size ) );
+		CHECK( memcmp( &actual[ 0 ], &expected[ 0 ], size ) == 0 );
+
+		// Decode what Encode produced
+		memcpy( &actual[ 0 ], &expected[ 0 ], size );
+		CHECK( blowfish.Decode( &actual[ 0 ], size, &expected[ 0 ], size ) );
+		CHECK( blowfish.DecodeBlocks( &actual[ 0 ], size ) );
+		CHECK( memcmp( &actual[ 0 ], &expected[ 0 ], size ) == 0 );
+		CHECK( memcmp( &actual[ 0 ], &plain[ 0 ], size ) == 0 );
+	}
+}
+
+//-----------------------------------------------------------------------------
@@ -0,0 +1,136 @@
+#include "test.h"
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+#include <cstring>
+#include <set>
+
+//-----------------------------------------------------------------------------
+
+#define HANDSHAKE_THREADS 8
+#define HANDSHAKES_PER_THREAD 50
+
+//-----------------------------------------------------------------------------
+
+namespace
+{
+	// What one thread saw
+	struct HandshakeResults
+	{
+		int32_t completed;
+
+		// The first packet each side sent, it carries the keys and values
+		// generated for the handshake
+		std::vector< std::vector< uint8_t > > server_keys;
+		std::vector< std::vector< uint8_t > > client_keys;
+
+		HandshakeResults() : completed( 0 )
+		{
+		}
+	};
+
+	// Runs handshakes between fresh server and client security objects and
+	// checks that a packet gets through each way afterwards
+	void RunHandshakes( HandshakeResults * results )
+	{
+		std::vector< uint8_t > wire;
+		std::vector< PacketView > packets;
+
+		for( int32_t x = 0; x < HANDSHAKES_PER_THREAD; ++x )
+		{
+			SilkroadSecurity server;
+			SilkroadSecurity client;
+			server.GenerateHandshake();
+
+			wire.clear();
+			server.GetPacketsToSend( wire );
+			results->server_keys.push_back( wire );
+			if( wire.empty() )
+			{
+				continue;
+			}
+			int32_t size = 0;
+			memcpy( client.GetRecvBuffer( static_cast< int32_t >( wire.size() ), size ), &wire[ 0 ], wire.size() );
+			client.CommitRecv( static_cast< int32_t >( wire.size() ) );
+
+			wire.clear();
+			client.GetPacketsToSend( wire );
+			results->client_keys.push_back( wire );
+			if( wire.empty() )
+			{
+				continue;
+			}
+			memcpy( server.GetRecvBuffer( static_cast< int32_t >( wire.size() ), size ), &wire[ 0 ], wire.size() );
+			server.CommitRecv( static_cast< int32_t >( wire.size() ) );
+
+			if( !CompleteHandshake( server, client, wire ) )
+			{
+				continue;
+			}
+			DiscardPackets( server, packets );
+			DiscardPackets( client, packets );
+
+			uint8_t payload[ 4 ] = { 1, 2, 3, static_cast< uint8_t >( x ) };
+			client.Send( 0x7001, payload, sizeof( payload ), true );
+			server.Send( 0xB001, payload, sizeof( payload ), true );
+			Deliver( client, server, wire );
+			Deliver( server, client, wire );
+
+			packets.clear();
+			bool server_ok = server.GetPacketsToRecv( packets ) == 1 && packets[ 0 ].opcode == 0x7001 && packets[ 0 ].size == sizeof( payload ) && memcmp( packets[ 0 ].data, payload, sizeof( payload ) ) == 0;
+			server.PopPacketsToRecv( static_cast< int32_t >( packets.size() ) );
+
+			packets.clear();
+			bool client_ok = client.GetPacketsToRecv( packets ) == 1 && packets[ 0 ].opcode == 0xB001 && packets[ 0 ].size == sizeof( payload ) && memcmp( packets[ 0 ].data, payload, sizeof( payload ) ) == 0;
+			client.PopPacketsToRecv( static_cast< int32_t >( packets.size() ) );
+
+			if( server_ok && client_ok )
+			{
+				++results->completed;
+			}
+		}
+	}
+
+	// Runs handshakes on many threads at once, every one has to complete and
+	// no two may share keys
+	void RunParallelHandshakes( const char * name )
+	{
+		std::vector< HandshakeResults > results( HANDSHAKE_THREADS );
+
+		boost::thread_group threads;
+		for( int32_t x = 0; x < HANDSHAKE_THREADS; ++x )
+		{
+			threads.create_thread( boost::bind( &RunHandshakes, &results[ x ] ) );
+		}
+		threads.join_all();
+
+		int32_t completed = 0;
+		std::set< std::vector< uint8_t > > server_keys;
+		std::set< std::vector< uint8_t > > client_keys;
+		for( int32_t x = 0; x < HANDSHAKE_THREADS; ++x )
+		{
+			completed += results[ x ].completed;
+			server_keys.insert( results[ x ].server_keys.begin(), results[ x ].server_keys.end() );
+			client_keys.insert( results[ x ].client_keys.begin(), results[ x ].client_keys.end() );
+		}
+
+		CHECK( completed == HANDSHAKE_THREADS * HANDSHAKES_PER_THREAD );
+		CHECK( server_keys.size() == HANDSHAKE_THREADS * HANDSHAKES_PER_THREAD );
+		CHECK( client_keys.size() == HANDSHAKE_THREADS * HANDSHAKES_PER_THREAD );
+		std::cout << name << ": " << completed << " of " << HANDSHAKE_THREADS * HANDSHAKES_PER_THREAD << " handshakes completed, "
+			<< server_keys.size() << " distinct server keys, " << client_keys.size() << " distinct client keys" << std::endl;
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+// Every thread generates its own handshake values, with and without the pool
+void TestParallelHandshakes()
+{
+	RunParallelHandshakes( "TestParallelHandshakes" );
+
+	SilkroadSecurity::StartHandshakePool( 64 );
+	RunParallelHandshakes( "TestParallelHandshakes (pool)" );
+	SilkroadSecurity::StopHandshakePool();
+}
+
+//-----------------------------------------------------------------------------
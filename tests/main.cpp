@@ -0,0 +1,127 @@
+#include "test.h"
+#include <boost/detail/atomic_count.hpp>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+//-----------------------------------------------------------------------------
+
+int TestFailures = 0;
+
+//-----------------------------------------------------------------------------
+
+// Every allocation in the program goes through these, so the tests can tell
+// how many happened while they ran
+static boost::detail::atomic_count Allocations( 0 );
+
+void * operator new( std::size_t size )
+{
+	++Allocations;
+	void * pointer = malloc( size ? size : 1 );
+	if( pointer == 0 )
+	{
+		throw std::bad_alloc();
+	}
+	return pointer;
+}
+
+void * operator new[]( std::size_t size )
+{
+	return operator new( size );
+}
+
+void operator delete( void * pointer ) throw()
+{
+	free( pointer );
+}
+
+void operator delete[]( void * pointer ) throw()
+{
+	free( pointer );
+}
+
+// Compilers with sized deallocation call these instead, the size is not needed
+void operator delete( void * pointer, std::size_t /*size*/ ) throw()
+{
+	operator delete( pointer );
+}
+
+void operator delete[]( void * pointer, std::size_t /*size*/ ) throw()
+{
+	operator delete[]( pointer );
+}
+
+long AllocationCount()
+{
+	return Allocations;
+}
+
+//-----------------------------------------------------------------------------
+
+void Deliver( SilkroadSecurity & from, SilkroadSecurity & to, std::vector< uint8_t > & wire )
+{
+	wire.clear();
+	from.GetPacketsToSend( wire );
+	if( wire.empty() )
+	{
+		return;
+	}
+
+	int32_t size = 0;
+	uint8_t * buffer = to.GetRecvBuffer( static_cast< int32_t >( wire.size() ), size );
+	memcpy( buffer, &wire[ 0 ], wire.size() );
+	to.CommitRecv( static_cast< int32_t >( wire.size() ) );
+}
+
+//-----------------------------------------------------------------------------
+
+bool CompleteHandshake( SilkroadSecurity & server, SilkroadSecurity & client, std::vector< uint8_t > & wire )
+{
+	// Each side needs at most a few round trips
+	for( int x = 0; x < 8; ++x )
+	{
+		Deliver( server, client, wire );
+		Deliver( client, server, wire );
+		if( server.IsHandshakeComplete() && client.IsHandshakeComplete() && !server.HasPacketToSend() && !client.HasPacketToSend() )
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+//-----------------------------------------------------------------------------
+
+void DiscardPackets( SilkroadSecurity & security, std::vector< PacketView > & packets )
+{
+	packets.clear();
+	security.PopPacketsToRecv( security.GetPacketsToRecv( packets ) );
+}
+
+//-----------------------------------------------------------------------------
+
+int main( int /*argc*/, char * /*argv*/[] )
+{
+	try
+	{
+		TestBlowfishBlocks();
+		TestAllocations();
+		TestParallelHandshakes();
+	}
+	catch( std::exception & e )
+	{
+		std::cout << "Unexpected exception: " << e.what() << std::endl;
+		++TestFailures;
+	}
+
+	if( TestFailures )
+	{
+		std::cout << TestFailures << " check(s) failed" << std::endl;
+		return 1;
+	}
+
+	std::cout << "All tests passed" << std::endl;
+	return 0;
+}
+
+//-----------------------------------------------------------------------------
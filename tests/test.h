@@ -0,0 +1,51 @@
+#pragma once
+
+#ifndef TEST_H_
+#define TEST_H_
+
+//-----------------------------------------------------------------------------
+
+#include "shared/silkroad_security.h"
+#include <iostream>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+
+// Number of failed checks, the test program fails if it is not zero
+extern int TestFailures;
+
+#define CHECK( condition ) \
+	do \
+	{ \
+		if( !( condition ) ) \
+		{ \
+			std::cout << __FILE__ << "(" << __LINE__ << "): check failed: " << #condition << std::endl; \
+			++TestFailures; \
+		} \
+	} while( 0 )
+
+// Number of times operator new has been called so far, on any thread
+long AllocationCount();
+
+//-----------------------------------------------------------------------------
+
+// Moves everything one security object has ready to send into the other's
+// receive buffer, the same way a socket read would
+void Deliver( SilkroadSecurity & from, SilkroadSecurity & to, std::vector< uint8_t > & wire );
+
+// Runs the handshake between a server and a client security object. Returns
+// true once both sides have accepted it.
+bool CompleteHandshake( SilkroadSecurity & server, SilkroadSecurity & client, std::vector< uint8_t > & wire );
+
+// Pops every received packet
+void DiscardPackets( SilkroadSecurity & security, std::vector< PacketView > & packets );
+
+//-----------------------------------------------------------------------------
+
+void TestAllocations();
+void TestBlowfishBlocks();
+void TestParallelHandshakes();
+
+//-----------------------------------------------------------------------------
+
+#endif